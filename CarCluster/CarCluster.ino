@@ -38,6 +38,8 @@
 // A correction factor for the RPM value. RPM will be multiplied by this value.
 // This enables you to fix displayed values that are slightly off, though you might not be able
 // to ever fully get them calibrated correctly - depending on the cluster. 
+// For non linear gauges use the calibration assistant instead (/api/calibration or serial action 37),
+// a stored calibration replaces this factor.
 #define RPM_CORRECTION_FACTOR 1.0
 
 // Configure the maximum speed shown on the cluster (in km/h)
@@ -47,6 +49,8 @@
 // A correction factor for the speed. Speed will be multiplied by this value.
 // This enables you to fix displayed values that are slightly off, though you might not be able
 // to ever fully get them calibrated correctly - depending on the cluster. 
+// For non linear gauges use the calibration assistant instead (/api/calibration or serial action 37),
+// a stored calibration replaces this factor.
 #define SPEED_CORRECTION_FACTOR 1.0
 
 // Define the minimum and maximum coolant temperature your cluster can display
@@ -62,7 +66,7 @@
 //
 // In order to connect to wifi the ESP will on first boot create a wifi access point called CarCluster. Connect to it (password is "carcluster"),
 // then open your web browser and navigate to 192.168.4.1 and use the UI there to connect your wifi network (if configuration popup doesn't open automatically).
-// If wifi is not connected after 3 minutes the ESP will continue normal operation and you can use it in Simhub/serial mode
+// The cluster and Simhub/serial mode work while the access point is open. If wifi is not configured in 3 minutes the access point is closed.
 // 
 // 1 for enabled
 // 0 for disabled
@@ -118,6 +122,9 @@
 // How often is the web dashboard updated
 #define WIFI_WEB_DASHBOARD_UPDATE_INTERVAL 3000
 
+// How often is the state pushed to web dashboards connected to the /api/stream websocket (33 ms = 30 Hz)
+#define WIFI_WEB_DASHBOARD_STREAM_INTERVAL 33
+
 // Name of the access point created
 #define WIFI_CONFIG_PORTAL_ACCESS_POINT_NAME "CarCluster"
 
@@ -133,12 +140,49 @@
 // Baud rate of the USB serial connection (if using Simhub set this to the same value)
 #define SERIAL_BAUD_RATE 921600
 
+// Size of the serial receive buffer. Larger than the default, so batches of SLCAN frames from the host fit.
+#define SERIAL_RX_BUFFER_SIZE 2048
+
 // UDP/TCP ports used for various games and other stuff.
 // Only applicable if wifi is enabled.
 #define WIFI_FORZA_UDP_PORT 1101
 #define WIFI_BEAM_UDP_PORT 1102
 #define WIFI_WEB_DASHBOARD_PORT 80
 
+// Telemetry fan-out for running multiple clusters on one rig (most games can only send data to one address).
+// The leader receives game data as usual and re-publishes the decoded state to followers using UDP multicast.
+// Only applicable if wifi is enabled.
+// 0 = disabled, 1 = leader, 2 = follower
+#define WIFI_FANOUT_MODE 0
+#define WIFI_FANOUT_MULTICAST_ADDRESS 239, 255, 67, 67
+#define WIFI_FANOUT_UDP_PORT 1103
+#define WIFI_FANOUT_MINIMUM_INTERVAL 10    // Minimum time between two state packets (ms)
+#define WIFI_FANOUT_HEARTBEAT_INTERVAL 200 // State is re-sent after this time even if nothing changed (ms)
+
+// MQTT publisher. Game state samples and device health are batched into one message on <topic>/telemetry,
+// commands (gear, lights, buttons) are taken from <topic>/cmd. See src/Other/MqttPublisher.h for the formats.
+// Only applicable if wifi is enabled.
+// 1 for enabled, 0 for disabled
+#define WIFI_MQTT_ENABLED 0
+#define WIFI_MQTT_URL "mqtt://192.168.1.10:1883"
+#define WIFI_MQTT_TOPIC "carcluster"
+#define WIFI_MQTT_SAMPLE_INTERVAL 50       // State is sampled this often, if it changed (ms)
+#define WIFI_MQTT_PUBLISH_INTERVAL 500     // One message with the samples is sent this often (ms)
+
+// Size of the telemetry recorder buffer in bytes (allocated in PSRAM if the board has it).
+// A typical session needs around 10 bytes per game state change.
+#define TELEMETRY_RECORDER_BUFFER_SIZE 32768
+
+// Number of CAN frames kept by the CAN capture (24 bytes per frame, allocated in PSRAM if the board has it)
+#define CAN_CAPTURE_BUFFER_FRAMES 512
+
+// Duration of one bucket of the signal history shown on the web dashboard (60 buckets are kept)
+#define SIGNAL_HISTORY_BUCKET_DURATION 1000
+
+// Check every frame the cluster sends against its schedule and the game state from the start (1), or only once it is
+// turned on with serial action 43 or /api/validation (0). Costs a frame decode per sent frame while on.
+#define FRAME_VALIDATOR_ENABLED 0
+
 // ------------------------ END OTHER CONFIGURATION -------------------
 
 
@@ -150,9 +194,25 @@
 
 #include "src/Games/GameSimulation.h"
 #include "src/Games/SimhubGame.h"
+#include "src/Other/TelemetryRecorder.h"
+#include "src/Other/SignalHistory.h"
+#include "src/Other/CanCapture.h"
+#include "src/Other/CalibrationAssistant.h"
+#include "src/Other/BootTimeline.h"
+#include "src/Other/CanBusController.h"
+#include "src/Other/RuntimeMetrics.h"
+#include "src/Other/LatencyTracer.h"
+#include "src/Other/FrameValidator.h"
+#include "src/Other/SlcanInterface.h"
+#include "src/Other/SerialOutput.h"
+#include "src/Other/InjectionSequencer.h"
+#include "src/Clusters/ClusterBusSchedules.h"
+#include "src/Clusters/ClusterSignalFrames.h"
+#include "src/Clusters/ClusterFrameDecoders.h"
 
 // CAN bus configuration
 MCP_CAN CAN(SPI_CS_PIN);  // Set CS pin
+CanBusController canBus(CAN, 1);
 
 // CAN bus Receiving
 long unsigned int canRxId;
@@ -199,6 +259,7 @@ char canRxMsgString[128];  // Array to store serial string
 #elif CLUSTER == 8
   // Mercedes Benz C Class (W204)
   MCP_CAN CAN2(CAN2_CS);  // Set CS pin
+  CanBusController canBus2(CAN2, 2);
 
   #include "src/Clusters/MERCEDES_W204/MercedesW204Cluster.h"
   MercedesW204Cluster cluster(CAN, CAN2);
@@ -211,6 +272,7 @@ char canRxMsgString[128];  // Array to store serial string
 #elif CLUSTER == 99
   // Golf 7 Passthrough mode
   MCP_CAN CAN2(CAN2_CS);  // Set CS pin
+  CanBusController canBus2(CAN2, 2);
 
   long unsigned int canRxId2;
   unsigned char canRxLen2 = 0;
@@ -222,9 +284,108 @@ char canRxMsgString[128];  // Array to store serial string
 #endif
 
 // Game simulation variables
+#if CLUSTER == 99 || CLUSTER == 8
+  CanBusController *canControllers[] = { &canBus, &canBus2 };
+#else
+  CanBusController *canControllers[] = { &canBus };
+#endif
+const uint8_t canControllerCount = sizeof(canControllers) / sizeof(canControllers[0]);
+SlcanInterface slcanInterface(canControllers, canControllerCount);
+InjectionSequencer injectionSequencer(canControllers, canControllerCount);
+
+// Frames the cluster sends on each bus, for the bus load report (checked at compile time in ClusterBusSchedules.h)
+#if CLUSTER == 1 || CLUSTER == 2
+  const CanBusLoad::Bus *busSchedules = bmwFSeriesBuses;
+  const uint8_t busScheduleCount = sizeof(bmwFSeriesBuses) / sizeof(bmwFSeriesBuses[0]);
+#elif CLUSTER == 3 || CLUSTER == 99
+  const CanBusLoad::Bus *busSchedules = vwMQBBuses;
+  const uint8_t busScheduleCount = sizeof(vwMQBBuses) / sizeof(vwMQBBuses[0]);
+#elif CLUSTER == 4
+  const CanBusLoad::Bus *busSchedules = vwPQ25Buses;
+  const uint8_t busScheduleCount = sizeof(vwPQ25Buses) / sizeof(vwPQ25Buses[0]);
+#elif CLUSTER == 5
+  const CanBusLoad::Bus *busSchedules = vwPQ46Buses;
+  const uint8_t busScheduleCount = sizeof(vwPQ46Buses) / sizeof(vwPQ46Buses[0]);
+#elif CLUSTER == 6
+  const CanBusLoad::Bus *busSchedules = bmwESeriesBuses;
+  const uint8_t busScheduleCount = sizeof(bmwESeriesBuses) / sizeof(bmwESeriesBuses[0]);
+#elif CLUSTER == 7
+  const CanBusLoad::Bus *busSchedules = bmwE46Buses;
+  const uint8_t busScheduleCount = sizeof(bmwE46Buses) / sizeof(bmwE46Buses[0]);
+#elif CLUSTER == 8
+  const CanBusLoad::Bus *busSchedules = mercedesW204Buses;
+  const uint8_t busScheduleCount = sizeof(mercedesW204Buses) / sizeof(mercedesW204Buses[0]);
+#elif CLUSTER == 9
+  const CanBusLoad::Bus *busSchedules = mercedesW221Buses;
+  const uint8_t busScheduleCount = sizeof(mercedesW221Buses) / sizeof(mercedesW221Buses[0]);
+#endif
+
+// Frames that carry the signals traced by the latency tracer
+#if CLUSTER == 1 || CLUSTER == 2
+  const SignalFrame *signalFrames = bmwFSeriesSignalFrames;
+  const uint8_t signalFrameCount = sizeof(bmwFSeriesSignalFrames) / sizeof(bmwFSeriesSignalFrames[0]);
+#elif CLUSTER == 3
+  const SignalFrame *signalFrames = vwMQBSignalFrames;
+  const uint8_t signalFrameCount = sizeof(vwMQBSignalFrames) / sizeof(vwMQBSignalFrames[0]);
+#elif CLUSTER == 99
+  const SignalFrame *signalFrames = vwMQBPassthroughSignalFrames;
+  const uint8_t signalFrameCount = sizeof(vwMQBPassthroughSignalFrames) / sizeof(vwMQBPassthroughSignalFrames[0]);
+#elif CLUSTER == 4 || CLUSTER == 5
+  const SignalFrame *signalFrames = vwPQSignalFrames;
+  const uint8_t signalFrameCount = sizeof(vwPQSignalFrames) / sizeof(vwPQSignalFrames[0]);
+#elif CLUSTER == 6
+  const SignalFrame *signalFrames = bmwESeriesSignalFrames;
+  const uint8_t signalFrameCount = sizeof(bmwESeriesSignalFrames) / sizeof(bmwESeriesSignalFrames[0]);
+#elif CLUSTER == 7
+  const SignalFrame *signalFrames = bmwE46SignalFrames;
+  const uint8_t signalFrameCount = sizeof(bmwE46SignalFrames) / sizeof(bmwE46SignalFrames[0]);
+#elif CLUSTER == 8 || CLUSTER == 9
+  const SignalFrame *signalFrames = mercedesSignalFrames;
+  const uint8_t signalFrameCount = sizeof(mercedesSignalFrames) / sizeof(mercedesSignalFrames[0]);
+#endif
+
+// Decodes the frames of the cluster for the frame validator (without one only the frame periods are checked)
+#if CLUSTER == 1 || CLUSTER == 2
+  BMWFSeriesFrameDecoder frameDecoder;
+  ClusterFrameDecoder *clusterFrameDecoder = &frameDecoder;
+#elif CLUSTER == 3 || CLUSTER == 99
+  VWMQBFrameDecoder frameDecoder;
+  ClusterFrameDecoder *clusterFrameDecoder = &frameDecoder;
+#elif CLUSTER == 8
+  MercedesW204FrameDecoder frameDecoder;
+  ClusterFrameDecoder *clusterFrameDecoder = &frameDecoder;
+#elif CLUSTER == 9
+  MercedesW221FrameDecoder frameDecoder;
+  ClusterFrameDecoder *clusterFrameDecoder = &frameDecoder;
+#else
+  ClusterFrameDecoder *clusterFrameDecoder = nullptr;
+#endif
+
 ClusterConfiguration clusterConfig = ClusterConfiguration::updatedFromDefaults(defaultClusterConfig, SPEED_CORRECTION_FACTOR, RPM_CORRECTION_FACTOR, MAXIMUM_RPM, MAXIMUM_SPEED, MINIMUM_COOLANT_TEMPERATURE, MAXIMUM_COOLANT_TEMPERATURE, ANALOG_FUEL_POT_MINIMUM_VALUE, ANALOG_FUEL_POT_MAXIMUM_VALUE, ANALOG_FUEL_POT_MINIMUM_VALUE2, ANALOG_FUEL_POT_MAXIMUM_VALUE2);
 GameState game(clusterConfig);
 SimhubGame simhubGame(game);
+TelemetryRecorder telemetryRecorder(game, TELEMETRY_RECORDER_BUFFER_SIZE);
+RuntimeMetrics runtimeMetrics;
+SignalHistory signalHistory(game, runtimeMetrics, SIGNAL_HISTORY_BUCKET_DURATION);
+CanCapture canCapture(CAN_CAPTURE_BUFFER_FRAMES);
+CalibrationAssistant calibrationAssistant(game);
+BootTimeline bootTimeline;
+LatencyTracer latencyTracer(game, signalFrames, signalFrameCount);
+FrameValidator frameValidator(game, busSchedules, busScheduleCount, clusterFrameDecoder, FRAME_VALIDATOR_ENABLED == 1);
+
+// Called by the CAN library for every received and sent frame. Context is the bus number.
+void canFrameHook(void *context, INT8U direction, INT32U id, INT8U ext, INT8U rtr, INT8U len, const INT8U *buf, INT8U result) {
+  canCapture.captureFrame((uintptr_t)context, direction == MCP_FRAME_TX, id, ext, rtr, len, buf, result != CAN_OK);
+  runtimeMetrics.countFrame((uintptr_t)context, direction == MCP_FRAME_TX, id, ext, result);
+  if (direction == MCP_FRAME_RX || result == CAN_OK) {
+    slcanInterface.frameSeen((uintptr_t)context, direction == MCP_FRAME_TX, id, ext, rtr, len, buf);
+  }
+  if (direction == MCP_FRAME_TX && result == CAN_OK) {
+    bootTimeline.mark(BootTimeline::Milestone_FirstFrame);
+    latencyTracer.frameSent(id);
+    if (frameValidator.isEnabled()) frameValidator.frameSent((uintptr_t)context, id, len, buf, millis());
+  }
+}
 
 #if WIFI_ENABLED == 1
   // Wifi/web portal variables
@@ -235,13 +396,26 @@ SimhubGame simhubGame(game);
 
   #include "src/Games/ForzaHorizonGame.h"
   #include "src/Games/BeamNGGame.h"
+  #include "src/Games/FanoutGame.h"
+  #include "src/Other/FanoutPublisher.h"
+  #include "src/Other/MqttPublisher.h"
 
   WifiFunctions wifiFunctions;
-  WebDashboard webDashboard(game, WIFI_WEB_DASHBOARD_UPDATE_INTERVAL);
+  WebDashboard webDashboard(game, WIFI_WEB_DASHBOARD_UPDATE_INTERVAL, WIFI_WEB_DASHBOARD_STREAM_INTERVAL);
 
   ForzaHorizonGame forzaHorizonGame(game, WIFI_FORZA_UDP_PORT);
   BeamNGGame beamNGGame(game, WIFI_BEAM_UDP_PORT);
 
+  #if WIFI_FANOUT_MODE == 1
+    FanoutPublisher fanoutPublisher(game, IPAddress(WIFI_FANOUT_MULTICAST_ADDRESS), WIFI_FANOUT_UDP_PORT, WIFI_FANOUT_MINIMUM_INTERVAL, WIFI_FANOUT_HEARTBEAT_INTERVAL);
+  #elif WIFI_FANOUT_MODE == 2
+    FanoutGame fanoutGame(game, IPAddress(WIFI_FANOUT_MULTICAST_ADDRESS), WIFI_FANOUT_UDP_PORT);
+  #endif
+
+  #if WIFI_MQTT_ENABLED == 1
+    MqttPublisher mqttPublisher(game, runtimeMetrics, canControllers, canControllerCount, WIFI_MQTT_URL, WIFI_MQTT_TOPIC, WIFI_MQTT_SAMPLE_INTERVAL, WIFI_MQTT_PUBLISH_INTERVAL);
+  #endif
+
   void webDashboardGetState(struct state *data) {
     webDashboard.getState(data);
   }
@@ -261,34 +435,92 @@ SimhubGame simhubGame(game);
   void webDashboardSetDebug(struct debug *data) {
     debugState = *data; // Sync with your device
   }
+  void webDashboardTimeseries(struct mg_connection *c, struct mg_http_message *hm) {
+    webDashboard.handleTimeseries(c, hm, signalHistory);
+  }
+  void webDashboardCanCapture(struct mg_connection *c, int ev, void *ev_data) {
+    webDashboard.handleCanCapture(c, ev, ev_data, canCapture);
+  }
+  void webDashboardTelemetryRecording(struct mg_connection *c, int ev, void *ev_data) {
+    webDashboard.handleTelemetryRecording(c, ev, ev_data, telemetryRecorder);
+  }
+  void webDashboardCalibration(struct mg_connection *c, int ev, void *ev_data) {
+    webDashboard.handleCalibration(c, ev, ev_data, calibrationAssistant);
+  }
+  void webDashboardStatus(struct mg_connection *c, int ev, void *ev_data) {
+    webDashboard.handleStatus(c, ev, ev_data, canControllers, canControllerCount, bootTimeline);
+  }
+  void webDashboardBusLoad(struct mg_connection *c, int ev, void *ev_data) {
+    webDashboard.handleBusLoad(c, ev, ev_data, busSchedules, busScheduleCount);
+  }
+  void webDashboardMetrics(struct mg_connection *c, int ev, void *ev_data) {
+    webDashboard.handleMetrics(c, ev, ev_data, runtimeMetrics, canControllers, canControllerCount);
+  }
+  void webDashboardLatency(struct mg_connection *c, int ev, void *ev_data) {
+    webDashboard.handleLatency(c, ev, ev_data, latencyTracer);
+  }
+  void webDashboardValidation(struct mg_connection *c, int ev, void *ev_data) {
+    webDashboard.handleValidation(c, ev, ev_data, frameValidator);
+  }
+  void webDashboardSequencer(struct mg_connection *c, int ev, void *ev_data) {
+    webDashboard.handleSequencer(c, ev, ev_data, injectionSequencer);
+  }
+
+  // Started once wifi is connected (until then the config portal might be using port 80)
+  void beginNetworkServices() {
+    mongoose_init();
+    mg_log_set(MG_LL_ERROR);
+    mg_log_set_fn(SerialOutput::writeCharacter, NULL);
+    mongoose_set_http_handlers("state", webDashboardGetState, webDashBoardSetState);
+    mongoose_set_http_handlers("debug", webDashboardGetDebug, webDashboardSetDebug);
+    mongoose_set_http_handlers("steering_button_pressed", webDashboardCheckSteeringButtonPressed, webDashboardSetSteeringButtonPressed);
+    mongoose_set_http_handlers("timeseries", webDashboardTimeseries);
+    mongoose_add_custom_handler("/api/recording", webDashboardTelemetryRecording, 0, 0);
+    mongoose_add_custom_handler("/api/capture#", webDashboardCanCapture, 0, 0);
+    mongoose_add_custom_handler("/api/calibration", webDashboardCalibration, 0, 0);
+    mongoose_add_custom_handler("/api/status", webDashboardStatus, 0, 0);
+    mongoose_add_custom_handler("/api/busload", webDashboardBusLoad, 0, 0);
+    mongoose_add_custom_handler("/metrics", webDashboardMetrics, 0, 0);
+    mongoose_add_custom_handler("/api/latency", webDashboardLatency, 0, 0);
+    mongoose_add_custom_handler("/api/validation", webDashboardValidation, 0, 0);
+    mongoose_add_custom_handler("/api/sequencer", webDashboardSequencer, 0, 0);
+    forzaHorizonGame.begin();
+    beamNGGame.begin();
+    #if WIFI_FANOUT_MODE == 2
+      fanoutGame.begin();
+    #endif
+  }
 #endif 
 
 // Serial JSON parsing
 JsonDocument doc;
 
 void setup() {
+  bootTimeline.mark(BootTimeline::Milestone_Setup);
+
   // Define the outputs
   pinMode(SPI_CS_PIN, OUTPUT);
   pinMode(CAN_INT, INPUT);
 
   //Begin with Serial Connection
+  Serial.setRxBufferSize(SERIAL_RX_BUFFER_SIZE);
   Serial.begin(SERIAL_BAUD_RATE);
-
-  delay(1000);
   Serial.println("Starting CarCluster...");
 
+  // CAN and Simhub come first, so the cluster is running before wifi is (wifi connects in the background from loop)
+  simhubGame.begin();
+  telemetryRecorder.begin();
+  canCapture.begin();
+  calibrationAssistant.begin();
+
+  runtimeMetrics.addGame("simhub", simhubGame);
   #if WIFI_ENABLED == 1
-    wifiFunctions.begin(WIFI_CONFIG_PORTAL_ACCESS_POINT_NAME, WIFI_CONFIG_PORTAL_ACCESS_POINT_PASSWORD, WIFI_CONFIG_PORTAL_TIMEOUT);
-    mongoose_init();
-    mg_log_set(MG_LL_ERROR);
-    mongoose_set_http_handlers("state", webDashboardGetState, webDashBoardSetState);
-    mongoose_set_http_handlers("debug", webDashboardGetDebug, webDashboardSetDebug);
-    mongoose_set_http_handlers("steering_button_pressed", webDashboardCheckSteeringButtonPressed, webDashboardSetSteeringButtonPressed);
-    forzaHorizonGame.begin();
-    beamNGGame.begin();
+    runtimeMetrics.addGame("forza", forzaHorizonGame);
+    runtimeMetrics.addGame("beamng", beamNGGame);
+    #if WIFI_FANOUT_MODE == 2
+      runtimeMetrics.addGame("fanout", fanoutGame);
+    #endif
   #endif
-
-  simhubGame.begin();
   
   #if CLUSTER == 6
     INT8U canSpeed = CAN_100KBPS;
@@ -301,69 +533,138 @@ void setup() {
     INT8U can2Speed = CAN_500KBPS;
   #endif
 
-  //Begin with CAN Bus Initialization
-START_INIT:
-  if (CAN_OK == CAN.begin(MCP_ANY, canSpeed, MCP_8MHZ))  // init can bus
-  {
-    Serial.println("CAN BUS Shield init ok!");
-  } else {
-    Serial.println("CAN BUS Shield init fail");
-    Serial.println("Init CAN BUS Shield again");
-    delay(100);
-    goto START_INIT;
-  }
-  CAN.setMode(MCP_NORMAL);
+  // Begin with CAN Bus Initialization. Controllers that fail are retried from loop (with backoff), so a missing
+  // transceiver does not stop the rest of the sketch
+  canBus.begin(canSpeed, canFrameHook);
 
   #if CLUSTER == 99 || CLUSTER == 8
     pinMode(CAN2_INT, INPUT);
+    canBus2.begin(can2Speed, canFrameHook);
+  #endif
 
-    //Begin with CAN Bus 2 Initialization
-START_INIT2:
-    if (CAN_OK == CAN2.begin(MCP_ANY, can2Speed, MCP_8MHZ))  // init can bus
-    {
-      Serial.println("CAN2 BUS Shield init ok!");
-    } else {
-      Serial.println("CAN2 BUS Shield init fail");
-      Serial.println("Init CAN2 BUS Shield again");
-      delay(100);
-      goto START_INIT2;
-    }
-    CAN2.setMode(MCP_NORMAL);
+  #if WIFI_ENABLED == 1
+    wifiFunctions.begin(WIFI_CONFIG_PORTAL_ACCESS_POINT_NAME, WIFI_CONFIG_PORTAL_ACCESS_POINT_PASSWORD, WIFI_CONFIG_PORTAL_TIMEOUT);
   #endif
 }
 
 void loop() {
-  // Update the cluster with current state of the game
+  runtimeMetrics.update();
+
+  // Record or replay the game state (replay overrides whatever games have set)
+  telemetryRecorder.update();
+
+  // Hold the gauge that is being calibrated at its setpoint
+  calibrationAssistant.update();
+
+  // Re-publish the state to follower clusters (before the cluster consumes button events)
+  #if WIFI_ENABLED == 1 && WIFI_FANOUT_MODE == 1
+    if (wifiFunctions.isConnected()) fanoutPublisher.update();
+  #endif
+
+  // Retry CAN controllers that are not running yet and read their health
+  bool allCanControllersRunning = true;
+  for (uint8_t i = 0; i < canControllerCount; i++) {
+    canControllers[i]->update();
+    if (!canControllers[i]->isRunning()) allCanControllersRunning = false;
+  }
+  if (canBus.isRunning()) bootTimeline.mark(BootTimeline::Milestone_CanReady);
+  if (allCanControllersRunning) bootTimeline.mark(BootTimeline::Milestone_Ready);
+
+  // Update the cluster with current state of the game. Runs even if a CAN controller is not up (yet), the controller
+  // drops the frames and the outputs that are not on CAN (fuel pots, pulses, K-bus, analog pins) keep working.
+  latencyTracer.update();
   cluster.updateWithGame(game);
+  injectionSequencer.update();
+  signalHistory.sample();
 
   // Serial message handling
+  slcanInterface.update();
   readSerialJson();
 
   // Handle data from connected CAN hardware
   readCanBuffer();
 
-  // Update the web dashboard
+  // Connect wifi in the background and update the web dashboard once connected
   #if WIFI_ENABLED == 1
-    webDashboard.update();
-    #if CLUSTER == 99 || CLUSTER == 8
-      webDashboard.handleDebug(debugState, CAN, &CAN2);
-    #else
-      webDashboard.handleDebug(debugState, CAN);
-    #endif
-    mongoose_poll();
+    if (wifiFunctions.update()) {
+      bootTimeline.mark(BootTimeline::Milestone_WifiConnected);
+      beginNetworkServices();
+      bootTimeline.mark(BootTimeline::Milestone_WebReady);
+    }
+
+    if (wifiFunctions.isConnected()) {
+      webDashboard.update();
+      #if CLUSTER == 99 || CLUSTER == 8
+        webDashboard.handleDebug(debugState, CAN, &CAN2);
+      #else
+        webDashboard.handleDebug(debugState, CAN);
+      #endif
+      #if WIFI_MQTT_ENABLED == 1
+        mqttPublisher.update();
+      #endif
+      mongoose_poll();
+    }
   #endif
+
+  bootTimeline.report();
+}
+
+// Field of an injection program (defaultValue when it is missing), false when it is not a whole number that fits the
+// field: "to":300 must not become 44 in a byte
+template <typename T>
+bool readInjectionNumber(JsonVariantConst json, T defaultValue, T &value) {
+  if (json.isNull()) {
+    value = defaultValue;
+    return true;
+  }
+  if (!json.is<T>()) return false;
+  value = json.as<T>();
+  return true;
+}
+
+// Frame of an injection program: {"id":1571, "extended":false, "data":[0, 0, 0], "period":100, "hold":0}
+bool readInjectionFrame(JsonVariantConst json, InjectionSequencer::Frame &frame) {
+  JsonArrayConst data = json["data"];
+  if (data.size() > 8) return false;
+
+  frame.extended = json["extended"] | false;
+  frame.length = data.size();
+  for (uint8_t i = 0; i < frame.length; i++) {
+    if (!data[i].is<uint8_t>()) return false;
+    frame.data[i] = data[i];
+  }
+  return readInjectionNumber(json["id"], (uint32_t)0, frame.id) &&
+         readInjectionNumber(json["period"], (uint16_t)100, frame.period) &&
+         readInjectionNumber(json["hold"], (uint16_t)0, frame.hold);
+}
+
+void printInjectionFrame(const InjectionSequencer::Frame &frame) {
+  Serial.print("0x");
+  Serial.print(frame.id, HEX);
+  for (uint8_t i = 0; i < frame.length; i++) {
+    Serial.print(frame.data[i] < 0x10 ? " 0" : " ");
+    Serial.print(frame.data[i], HEX);
+  }
 }
 
 void readSerialJson() {
   //Check to see if anything is available in the serial receive buffer
-  while (Serial.available() > 0) {
+  while (Serial.available() > 0 && slcanInterface.acceptsCommands()) {
     //Create a place to hold the incoming message
     static char message[MAX_SERIAL_MESSAGE_LENGTH];
     static unsigned int message_pos = 0;
+    static uint32_t messageArrivalTime = 0;
 
     //Read the next available byte in the serial receive buffer
     char inByte = Serial.read();
 
+    // SLCAN commands start with a letter and end with CR, JSON messages start with {
+    if (message_pos == 0 && slcanInterface.readByte(inByte)) continue;
+    // While the SLCAN channel is open JSON is ignored, its replies would end up in the frame stream
+    if (message_pos == 0 && slcanInterface.isOpen()) continue;
+
+    if (message_pos == 0) messageArrivalTime = micros();
+
     //Message coming in (check not terminating character) and guard for over message size
     if (inByte != '\n' && (message_pos < MAX_SERIAL_MESSAGE_LENGTH - 1)) {
       //Add the incoming byte to our message
@@ -379,6 +680,7 @@ void readSerialJson() {
 
       DeserializationError error = deserializeJson(doc, message);
       if (error) {
+        runtimeMetrics.countSerialParseFailure();
         Serial.print(F("deserializeJson() failed: "));
         Serial.println(error.c_str());
         message_pos = 0;
@@ -406,7 +708,413 @@ void readSerialJson() {
       } else if (action == 10) {
         // Used to decode custom protocol from Simhub in the following format:
         // {"action":10, "spe":54, "gea":"2", "rpm":3590, "mrp":7999, "lft":0, "rit":0, "oit":0, "pau":0, "run":0, "fue":0, "hnb":0, "abs":0, "tra":0}
-        simhubGame.decodeSerialData(doc);
+        simhubGame.decodeSerialData(doc, messageArrivalTime);
+      } else if (action == 20) {
+        // Start recording game state changes: {"action":20}
+        Serial.println(telemetryRecorder.startRecording() ? "Recording started" : "Recording not possible");
+      } else if (action == 21) {
+        // Stop recording: {"action":21}
+        telemetryRecorder.stopRecording();
+        Serial.print("Recording stopped, records: ");
+        Serial.print(telemetryRecorder.recordCount());
+        Serial.print(", duration (ms): ");
+        Serial.println(telemetryRecorder.durationMs());
+      } else if (action == 22) {
+        // Replay the recording. Rate is a multiple of real time, 0 means step by step using action 23: {"action":22, "rate":1}
+        uint8_t rate = doc["rate"] | 1;
+        Serial.println(telemetryRecorder.startReplay(rate) ? "Replay started" : "Replay not possible");
+      } else if (action == 23) {
+        // Step the replay by a number of records: {"action":23, "count":1}
+        uint16_t count = doc["count"] | 1;
+        telemetryRecorder.step(count);
+      } else if (action == 24) {
+        // Stop the replay: {"action":24}
+        telemetryRecorder.stopReplay();
+      } else if (action == 25) {
+        // Dump the recording as hex (same format as the /api/recording download): {"action":25}
+        uint8_t chunk[32];
+        size_t offset = 0;
+        size_t length;
+        while ((length = telemetryRecorder.exportChunk(offset, chunk, sizeof(chunk))) > 0) {
+          for (size_t i = 0; i < length; i++) {
+            if (chunk[i] < 0x10) Serial.print("0");
+            Serial.print(chunk[i], HEX);
+          }
+          Serial.println();
+          offset += length;
+        }
+      } else if (action == 26) {
+        // Print telemetry fan-out statistics: {"action":26}
+        #if WIFI_ENABLED == 1 && WIFI_FANOUT_MODE == 1
+          Serial.print("Fan-out sent: ");
+          Serial.print(fanoutPublisher.sentPackets());
+          Serial.print(", failed: ");
+          Serial.println(fanoutPublisher.failedPackets());
+        #elif WIFI_ENABLED == 1 && WIFI_FANOUT_MODE == 2
+          Serial.print("Fan-out received: ");
+          Serial.print(fanoutGame.receivedPackets());
+          Serial.print(", lost: ");
+          Serial.print(fanoutGame.lostPackets());
+          Serial.print(", out of order: ");
+          Serial.print(fanoutGame.outOfOrderPackets());
+          Serial.print(", invalid: ");
+          Serial.println(fanoutGame.invalidPackets());
+        #else
+          Serial.println("Fan-out disabled");
+        #endif
+      } else if (action == 30) {
+        // Start CAN capture. All parameters are optional. Filters are [id, mask] pairs, trigger IDs start/stop the capture:
+        // {"action":30, "filters":[[1644, 2047]], "startId":1644, "stopId":1645, "postFrames":10, "stopWhenFull":false}
+        canCapture.stop();
+        canCapture.clearFilters();
+        JsonArray filters = doc["filters"];
+        for (JsonArray filter : filters) {
+          canCapture.addFilter(filter[0], filter[1] | 0x1FFFFFFF);
+        }
+        canCapture.setTriggers(doc["startId"] | static_cast<uint32_t>(CanCapture::noTrigger), doc["stopId"] | static_cast<uint32_t>(CanCapture::noTrigger), doc["postFrames"] | 0);
+        canCapture.setStopWhenFull(doc["stopWhenFull"] | false);
+        canCapture.start();
+      } else if (action == 31) {
+        // Stop CAN capture: {"action":31}
+        canCapture.stop();
+      } else if (action == 32) {
+        // Print captured frames in candump log format (can be replayed with canplayer): {"action":32}
+        uint8_t line[CanCapture::maximumExportRecordSize];
+        for (uint32_t sequence = canCapture.oldestSequence(); sequence != canCapture.endSequence(); sequence++) {
+          size_t length = canCapture.exportFrame(CanCapture::ExportFormat_Candump, sequence, line);
+          Serial.write(line, length);
+        }
+      } else if (action == 33) {
+        // Print CAN capture status: {"action":33}
+        Serial.print("CAN capture state: ");
+        Serial.print(canCapture.state());
+        Serial.print(", captured: ");
+        Serial.print(canCapture.capturedFrames());
+        Serial.print(", stored: ");
+        Serial.print(canCapture.storedFrames());
+        Serial.print(", overwritten: ");
+        Serial.print(canCapture.overwrittenFrames());
+        Serial.print(", filtered: ");
+        Serial.print(canCapture.filteredFrames());
+        Serial.print(", cost per frame (us) avg: ");
+        Serial.print(canCapture.averageCostMicros());
+        Serial.print(", max: ");
+        Serial.println(canCapture.maximumCostMicros());
+      } else if (action == 34) {
+        // Press a steering wheel button (values are cluster dependent). Hold is in ms, 0 is a short press: {"action":34, "button":1, "hold":0}
+        game.pushButtonEvent(doc["button"] | 0, doc["hold"] | 0);
+      } else if (action == 35) {
+        // Print the distance the speedometer was driven with (counted speed pulses): {"action":35}
+        #if CLUSTER == 7
+          Serial.print("Speed pulse distance (m): ");
+          Serial.println(cluster.speedPulseDistance());
+        #else
+          Serial.println("Not a pulse driven speedometer");
+        #endif
+      } else if (action == 36) {
+        // Print K-bus statistics and the events received since the last call: {"action":36}
+        #if CLUSTER == 7
+          KBus &kBus = cluster.kBusInterface();
+          Serial.print("K-bus sent: ");
+          Serial.print(kBus.sentMessages());
+          Serial.print(", collisions: ");
+          Serial.print(kBus.collisions());
+          Serial.print(", dropped: ");
+          Serial.print(kBus.droppedMessages());
+          Serial.print(", received: ");
+          Serial.print(kBus.receivedMessages());
+          Serial.print(", checksum errors: ");
+          Serial.println(kBus.checksumErrors());
+
+          KBus::Event event;
+          while (kBus.readEvent(event)) {
+            Serial.print("K-bus event ");
+            Serial.print(event.type);
+            Serial.print(" from ");
+            Serial.print(event.source, HEX);
+            Serial.print(": ");
+            Serial.print(event.value1);
+            Serial.print(", ");
+            Serial.println(event.value2);
+          }
+        #else
+          Serial.println("Cluster has no K-bus");
+        #endif
+      } else if (action == 37) {
+        // Gauge calibration assistant (also available as /api/calibration). Command is start, confirm, cancel, save or clear:
+        // {"action":37, "command":"start", "gauge":"speed"}, then after every setpoint {"action":37, "command":"confirm", "value":84}
+        // Value is what the gauge shows, leave it out if the gauge shows the setpoint. Without a command the status is printed.
+        const char *command = doc["command"] | "";
+        CalibrationAssistant::Gauge gauge;
+        bool accepted = true;
+        if (strcmp(command, "start") == 0) {
+          accepted = CalibrationAssistant::gaugeFromName(doc["gauge"] | "", &gauge) && calibrationAssistant.start(gauge);
+        } else if (strcmp(command, "confirm") == 0) {
+          accepted = doc["value"].is<int>() ? calibrationAssistant.confirm(doc["value"].as<int>()) : calibrationAssistant.confirm();
+        } else if (strcmp(command, "cancel") == 0) {
+          calibrationAssistant.cancel();
+        } else if (strcmp(command, "save") == 0) {
+          accepted = CalibrationAssistant::gaugeFromName(doc["gauge"] | "", &gauge) && calibrationAssistant.save(gauge);
+        } else if (strcmp(command, "clear") == 0) {
+          calibrationAssistant.clearStored();
+        }
+
+        if (!accepted) {
+          Serial.println("Calibration command not possible");
+        } else if (calibrationAssistant.state() == CalibrationAssistant::State_Idle) {
+          Serial.println("Calibration assistant idle");
+        } else {
+          Serial.print("Calibrating ");
+          Serial.print(CalibrationAssistant::gaugeName(calibrationAssistant.gauge()));
+          Serial.print(", step ");
+          Serial.print(calibrationAssistant.step() + 1);
+          Serial.print("/");
+          Serial.print(static_cast<int>(CalibrationAssistant::setpointCount));
+          Serial.print(", setpoint: ");
+          Serial.println((long)calibrationAssistant.setpoint());
+        }
+      } else if (action == 38) {
+        // Print the boot timeline (ms since power on when each milestone was reached): {"action":38}
+        bootTimeline.print();
+      } else if (action == 39) {
+        // Print CAN controller status (running, error passive, bus off...) and error counters: {"action":39}
+        for (uint8_t i = 0; i < canControllerCount; i++) {
+          CanBusController *controller = canControllers[i];
+          Serial.print("CAN bus ");
+          Serial.print(controller->bus());
+          Serial.print(": ");
+          Serial.print(CanBusController::stateName(controller->state()));
+          Serial.print(", attempts: ");
+          Serial.print(controller->attempts());
+          Serial.print(", RX errors: ");
+          Serial.print(controller->receiveErrors());
+          Serial.print(", TX errors: ");
+          Serial.print(controller->transmitErrors());
+          Serial.print(", error flags: 0x");
+          Serial.print(controller->errorFlags(), HEX);
+          Serial.print(", bus off: ");
+          Serial.print(controller->busOffCount());
+          Serial.print(", failed sends: ");
+          Serial.print(controller->failedSends());
+          Serial.print(", dropped frames: ");
+          Serial.println(controller->droppedFrames());
+        }
+      } else if (action == 40) {
+        // Print the bus load and worst case frame response times of the cluster frame schedule: {"action":40}
+        for (uint8_t i = 0; i < busScheduleCount; i++) {
+          const CanBusLoad::Bus &bus = busSchedules[i];
+          uint32_t load = CanBusLoad::utilization(bus);
+          uint8_t worst = CanBusLoad::worstFrame(bus);
+          Serial.print(bus.name);
+          Serial.print(", ");
+          Serial.print(bus.bitrate);
+          Serial.print(" kbit/s, frames: ");
+          Serial.print(bus.frameCount);
+          Serial.print(", load: ");
+          Serial.print(load / 10000.0f, 2);
+          Serial.print("%, worst response: 0x");
+          Serial.print(bus.frames[worst].id, HEX);
+          Serial.print(" in ");
+          Serial.print(CanBusLoad::responseTime(bus, worst));
+          Serial.print(" us (period ");
+          Serial.print(bus.frames[worst].period);
+          Serial.println(" ms)");
+        }
+      } else if (action == 41) {
+        // Print MQTT publisher statistics: {"action":41}
+        #if WIFI_ENABLED == 1 && WIFI_MQTT_ENABLED == 1
+          Serial.print(mqttPublisher.isConnected() ? "MQTT connected" : "MQTT not connected");
+          Serial.print(", published: ");
+          Serial.print(mqttPublisher.publishedMessages());
+          Serial.print(", lost: ");
+          Serial.print(mqttPublisher.lostMessages());
+          Serial.print(", dropped samples: ");
+          Serial.print(mqttPublisher.droppedSamples());
+          Serial.print(", latency (ms): ");
+          Serial.print(mqttPublisher.lastLatency());
+          Serial.print(", max: ");
+          Serial.print(mqttPublisher.maximumLatency());
+          Serial.print(", commands: ");
+          Serial.print(mqttPublisher.receivedCommands());
+          Serial.print(", invalid: ");
+          Serial.println(mqttPublisher.invalidCommands());
+        #else
+          Serial.println("MQTT disabled");
+        #endif
+      } else if (action == 42) {
+        // Print telemetry to CAN latency percentiles (us) per signal: {"action":42}, reset them: {"action":42, "reset":true}
+        if (doc["reset"] | false) {
+          latencyTracer.reset();
+          Serial.println("Latency histograms cleared");
+        } else {
+          for (uint8_t signal = 0; signal < LatencySignal_Count; signal++) {
+            const LatencyHistogram &histogram = latencyTracer.histogram(signal);
+            Serial.print(latencySignalName(signal));
+            if (!latencyTracer.isTraced(signal)) {
+              Serial.println(": not traced on this cluster");
+              continue;
+            }
+            Serial.print(": samples: ");
+            Serial.print(histogram.count());
+            Serial.print(", p50: ");
+            Serial.print(histogram.percentile(50));
+            Serial.print(", p90: ");
+            Serial.print(histogram.percentile(90));
+            Serial.print(", p99: ");
+            Serial.print(histogram.percentile(99));
+            Serial.print(", max: ");
+            Serial.println(histogram.maximum());
+          }
+        }
+      } else if (action == 43) {
+        // Print the frame validator results (checksums, counters, periods, decoded signals): {"action":43},
+        // reset them: {"action":43, "reset":true}, turn the validator on or off: {"action":43, "enabled":true}
+        if (doc.containsKey("enabled")) {
+          frameValidator.setEnabled(doc["enabled"]);
+          Serial.println(frameValidator.isEnabled() ? "Frame validator on" : "Frame validator off");
+        } else if (doc["reset"] | false) {
+          frameValidator.reset();
+          Serial.println("Frame validator cleared");
+        } else {
+          for (uint8_t i = 0; i < frameValidator.frameCount(); i++) {
+            const FrameValidator::FrameStats &stats = frameValidator.frameStats(i);
+            Serial.print("0x");
+            Serial.print(stats.id, HEX);
+            if (stats.bus != 0) {
+              Serial.print(" bus ");
+              Serial.print(stats.bus);
+            }
+            Serial.print(" (");
+            Serial.print(stats.period);
+            Serial.print(" ms): frames: ");
+            Serial.print(stats.frames);
+            Serial.print(", checksum errors: ");
+            Serial.print(stats.checksumErrors);
+            Serial.print(", counter errors: ");
+            Serial.print(stats.counterErrors);
+            Serial.print(", late: ");
+            Serial.print(stats.lateFrames);
+            Serial.print(", early: ");
+            Serial.print(stats.earlyFrames);
+            Serial.print(", max interval: ");
+            Serial.print(stats.maximumInterval);
+            Serial.println(frameValidator.isMissing(i, millis()) ? " ms, MISSING" : " ms");
+          }
+          for (uint8_t signal = 0; signal < LatencySignal_Count; signal++) {
+            const FrameValidator::SignalStats &stats = frameValidator.signalStats(signal);
+            if (stats.matches == 0 && stats.mismatches == 0) continue;
+            Serial.print(latencySignalName(signal));
+            Serial.print(": matched: ");
+            Serial.print(stats.matches);
+            Serial.print(", mismatched: ");
+            Serial.print(stats.mismatches);
+            if (stats.mismatches != 0) {
+              Serial.print(", last in 0x");
+              Serial.print(stats.lastMismatchId, HEX);
+              Serial.print(" decoded ");
+              Serial.print(stats.lastMismatchDecoded);
+              Serial.print(" expected ");
+              Serial.print(stats.lastMismatchExpected);
+            }
+            Serial.println();
+          }
+          if (!frameValidator.hasDecoder()) Serial.println("No decoder for this cluster, signals are not checked");
+          if (!frameValidator.isEnabled()) Serial.println("Frame validator is off, turn it on with {\"action\":43, \"enabled\":true}");
+          Serial.print("Frames not in the schedule: ");
+          Serial.println(frameValidator.unscheduledFrames());
+        }
+      } else if (action == 44) {
+        // SLCAN settings and statistics: {"action":44}. Bus and streaming of the frames the cluster sends can only be
+        // changed while the SLCAN channel is closed: {"action":44, "bus":2, "sent":true}
+        if (doc.containsKey("bus") && !slcanInterface.setBus(doc["bus"])) Serial.println("SLCAN bus not changed");
+        if (doc.containsKey("sent") && !slcanInterface.isOpen()) slcanInterface.setStreamSentFrames(doc["sent"]);
+        Serial.print(slcanInterface.isOpen() ? "SLCAN open" : "SLCAN closed");
+        Serial.print(", bus: ");
+        Serial.print(slcanInterface.bus());
+        Serial.print(slcanInterface.streamsSentFrames() ? " (with sent frames)" : "");
+        Serial.print(", sent: ");
+        Serial.print(slcanInterface.sentFrames());
+        Serial.print(", failed: ");
+        Serial.print(slcanInterface.failedFrames());
+        Serial.print(", streamed: ");
+        Serial.print(slcanInterface.streamedFrames());
+        Serial.print(", dropped: ");
+        Serial.print(slcanInterface.droppedFrames());
+        Serial.print(", invalid commands: ");
+        Serial.println(slcanInterface.invalidCommands());
+      } else if (action == 45) {
+        // Injection sequencer, start a program (bus, hold, loops and period are optional, period is per frame):
+        // {"action":45, "program":"sweep", "bus":1, "id":1571, "data":[0,0,0,0,0,0,0,0], "byte":2, "from":0, "to":255, "increment":1, "hold":500, "period":100, "loops":1}
+        // {"action":45, "program":"bits", "id":1571, "data":[0,0,0,0,0,0,0,0], "first":0, "last":63, "hold":1000}
+        // {"action":45, "program":"cycle", "frames":[{"id":1571, "data":[1, 2], "period":50, "hold":2000}, ...], "loops":0}
+        // Hold 0 only advances on {"action":45, "command":"next"} ("previous" goes back), stop: {"action":45, "command":"stop"}
+        // Status: {"action":45}, with the log of step start times: {"action":45, "log":true}
+        const char *programName = doc["program"];
+        const char *command = doc["command"];
+        if (programName != nullptr) {
+          InjectionSequencer::Program program;
+          program.type = InjectionSequencer::programType(programName);
+          bool valid = readInjectionNumber(doc["bus"], (uint8_t)1, program.bus) &&
+                       readInjectionNumber(doc["hold"], (uint16_t)1000, program.hold) &&
+                       readInjectionNumber(doc["loops"], (uint16_t)1, program.loops) &&
+                       readInjectionFrame(doc.as<JsonVariantConst>(), program.base) &&
+                       readInjectionNumber(doc["byte"], (uint8_t)0, program.byteIndex) &&
+                       readInjectionNumber(doc["from"], (uint8_t)0, program.from) &&
+                       readInjectionNumber(doc["to"], (uint8_t)255, program.to) &&
+                       readInjectionNumber(doc["increment"], (uint8_t)1, program.increment) &&
+                       readInjectionNumber(doc["first"], (uint8_t)0, program.firstBit) &&
+                       readInjectionNumber(doc["last"], (uint8_t)(program.base.length * 8 - 1), program.lastBit);
+          JsonArrayConst frames = doc["frames"];
+          if (frames.size() > InjectionSequencer::maximumCycleFrames) valid = false;
+          for (JsonVariantConst frame : frames) {
+            if (program.frameCount >= InjectionSequencer::maximumCycleFrames) break;
+            if (!readInjectionFrame(frame, program.frames[program.frameCount++])) valid = false;
+          }
+          Serial.println(valid && injectionSequencer.start(program) ? "Injection started" : "Injection program not valid");
+        } else if (command != nullptr && strcmp(command, "stop") == 0) {
+          injectionSequencer.stop();
+        } else if (command != nullptr && (strcmp(command, "next") == 0 || strcmp(command, "previous") == 0)) {
+          if (!injectionSequencer.step(strcmp(command, "next") == 0)) Serial.println("No step to go to");
+        }
+
+        const char *states[] = { "idle", "running", "finished" };
+        Serial.print("Injection ");
+        Serial.print(states[injectionSequencer.state()]);
+        Serial.print(", program: ");
+        Serial.print(InjectionSequencer::programName(injectionSequencer.program().type));
+        Serial.print(", bus: ");
+        Serial.print(injectionSequencer.program().bus);
+        Serial.print(", step: ");
+        Serial.print(injectionSequencer.currentStep());
+        Serial.print("/");
+        Serial.print(injectionSequencer.stepCount());
+        Serial.print(", loop: ");
+        Serial.print(injectionSequencer.currentLoop());
+        Serial.print(", sent: ");
+        Serial.print(injectionSequencer.sentFrames());
+        Serial.print(", failed: ");
+        Serial.print(injectionSequencer.failedFrames());
+        if (injectionSequencer.state() == InjectionSequencer::State_Running) {
+          Serial.print(", frame: ");
+          printInjectionFrame(injectionSequencer.activeStepFrame());
+        }
+        Serial.println();
+
+        if (doc["log"] | false) {
+          for (uint8_t i = 0; i < injectionSequencer.logCount(); i++) {
+            const InjectionSequencer::StepRecord &record = injectionSequencer.logRecord(i);
+            InjectionSequencer::Frame frame;
+            injectionSequencer.frameForStep(record.step, frame);
+            Serial.print(record.time);
+            Serial.print(" ms: step ");
+            Serial.print(record.step);
+            Serial.print(", loop ");
+            Serial.print(record.loop);
+            Serial.print(": ");
+            printInjectionFrame(frame);
+            Serial.println();
+          }
+        }
       }
 
       //Reset for the next message
@@ -416,7 +1124,8 @@ void readSerialJson() {
 }
 
 void readCanBuffer() {
-  if (!digitalRead(CAN_INT)) {                      // If CAN0_INT pin is low, read receive buffer
+  // The controller has two receive buffers, read both if they are full (CAN0_INT pin stays low)
+  for (uint8_t i = 0; i < 2 && canBus.isRunning() && !digitalRead(CAN_INT); i++) {
     CAN.readMsgBuf(&canRxId, &canRxLen, canRxBuf);  // Read data: len = data length, buf = data byte(s)
 
     #if CLUSTER == 99
@@ -424,6 +1133,7 @@ void readCanBuffer() {
     #endif
 
     // Uncomment if you want to see what is being received on the CAN bus
+    // (prefer the CAN capture, see serial actions 30-33 and /api/capture, printing every frame is very slow)
     /*
     if ((canRxId & 0x80000000) == 0x80000000)  // Determine if ID is standard (11 bits) or extended (29 bits)
       sprintf(canRxMsgString, "Extended ID: 0x%.8lX  DLC: %1d  Data:", (canRxId & 0x1FFFFFFF), canRxLen);
@@ -448,11 +1158,19 @@ void readCanBuffer() {
 
   #if CLUSTER == 99
     // From cluster to car
-    if (!digitalRead(CAN2_INT)) {                      // If CAN0_INT pin is low, read receive buffer
+    if (canBus2.isRunning() && !digitalRead(CAN2_INT)) {                      // If CAN0_INT pin is low, read receive buffer
       CAN2.readMsgBuf(&canRxId2, &canRxLen2, canRxBuf2);  // Read data: len = data length, buf = data byte(s)
 
       // Forward anything that we get back to the car
       CAN.sendMsgBuf(canRxId2, canRxLen2, canRxBuf2);
     }
+  #elif CLUSTER == 8
+    // Nothing on CAN2 is used by the cluster, it is only read for the frame hook (capture, SLCAN)
+    if (canBus2.isRunning() && !digitalRead(CAN2_INT)) {
+      long unsigned int id;
+      unsigned char len;
+      unsigned char buf[8];
+      CAN2.readMsgBuf(&id, &len, buf);
+    }
   #endif
 }
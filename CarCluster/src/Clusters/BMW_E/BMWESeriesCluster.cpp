@@ -7,11 +7,7 @@
 #include "BMWESeriesCluster.h"
 
 BMWESeriesCluster::BMWESeriesCluster(MCP_CAN& CAN, int fuelPotIncPin, int fuelPotDirPin, int fuelPot1CsPin, int fuelPot2CsPin, int handbrakeIndicatorPin): CAN(CAN) {
-  fuelPot.begin(fuelPotIncPin, fuelPotDirPin, fuelPot1CsPin);
-  fuelPot.setPosition(100, true); // Force the pot to a known value
-
-  fuelPot2.begin(fuelPotIncPin, fuelPotDirPin, fuelPot2CsPin);
-  fuelPot2.setPosition(100, true); // Force the pot to a known value
+  fuelPots.begin(fuelPotIncPin, fuelPotDirPin, fuelPot1CsPin, fuelPot2CsPin); // Pots are homed to a known value from updateWithGame
 
   this->handbrakeIndicator = handbrakeIndicatorPin;
 
@@ -28,13 +24,13 @@ void BMWESeriesCluster::setFuel(GameState& game) {
     int pot2Percentage = (percentage < 50) ? percentage : 50;
 
     int desiredPositionPot1 = map(pot1Percentage, 0, 50, game.configuration.minimumFuelPotValue, game.configuration.maximumFuelPotValue);
-    fuelPot.setPosition(desiredPositionPot1, false);
+    fuelPots.setTarget(0, desiredPositionPot1);
   
     int desiredPositionPot2 = map(pot2Percentage, 0, 50, game.configuration.minimumFuelPot2Value, game.configuration.maximumFuelPot2Value);
-    fuelPot2.setPosition(desiredPositionPot2, false);
+    fuelPots.setTarget(1, desiredPositionPot2);
   } else {
     int desiredPosition = map(percentage, 0, 100, game.configuration.minimumFuelPotValue, game.configuration.maximumFuelPotValue);
-    fuelPot.setPosition(desiredPosition, false);
+    fuelPots.setTarget(0, desiredPosition);
   }
 }
 
@@ -60,38 +56,20 @@ uint8_t BMWESeriesCluster::mapGenericGearToLocalGear(GearState inputGear) {
   }
 }
 
-int BMWESeriesCluster::mapSpeed(GameState& game) {
-  int scaledSpeed = game.speed * game.configuration.speedCorrectionFactor;
-  if (scaledSpeed > game.configuration.maximumSpeedValue) {
-    return game.configuration.maximumSpeedValue;
-  } else {
-    return scaledSpeed;
-  }
-}
+void BMWESeriesCluster::updateWithGame(GameState& game) {
+  fuelPots.update();
 
-int BMWESeriesCluster::mapRPM(GameState& game) {
-  int scaledRPM = game.rpm * game.configuration.speedCorrectionFactor;
-  if (scaledRPM > game.configuration.maximumRPMValue) {
-    return game.configuration.maximumRPMValue;
-  } else {
-    return scaledRPM;
+  if (buttonEvents.update(game)) {
+    sendSteeringWheelControls(buttonEvents.activeButton());
   }
-}
-
-int BMWESeriesCluster::mapCoolantTemperature(GameState& game) {
-  if (game.coolantTemperature < game.configuration.minimumCoolantTemperature) { return game.configuration.minimumCoolantTemperature; }
-  if (game.coolantTemperature > game.configuration.maximumCoolantTemperature) { return game.configuration.maximumCoolantTemperature; }
-  return game.coolantTemperature;
-}
 
-void BMWESeriesCluster::updateWithGame(GameState& game) {
   if (millis() - lastDashboardUpdateTime >= dashboardUpdateTimeShort) {
     // This should probably be done using a more sophisticated method like a
     // scheduler, but for now this seems to work.
 
     sendIgnition(game.ignition);
     sendRPM(mapRPM(game));
-    sendSpeed(mapSpeed(game), dashboardUpdateTimeShort);
+    sendSpeed(mapSpeed(game));
     sendSteeringWheel();
 
     sendAirbagCounter(); // 200ms
@@ -111,8 +89,7 @@ void BMWESeriesCluster::updateWithGame(GameState& game) {
     sendBacklightBrightness(game.backlightBrightness);
     sendBlinkers(game.leftTurningIndicator, game.rightTurningIndicator);
 
-    sendSteeringWheelControls(game.buttonEventToProcess);
-    game.buttonEventToProcess = 0;
+    sendSteeringWheelControls(buttonEvents.activeButton());
 
     //setFuel(game);
     
@@ -132,11 +109,10 @@ void BMWESeriesCluster::sendRPM(int rpm) {
   CAN.sendMsgBuf(0x0AA, 0, 8, rpmFrame);
 }
 
-void BMWESeriesCluster::sendSpeed(int speed, int deltaTime) {
-  uint16_t speed_value = speed + previousSpeedValue;
-
-  uint16_t counter = (speedFrame[6] | (speedFrame[7] << 8)) & 0x0FFF;
-  counter += (float)deltaTime * M_PI;
+void BMWESeriesCluster::sendSpeed(int speed) {
+  // Cluster calculates speed from the change of both counters, so they are driven by the same measured time
+  uint16_t speed_value = speedCounter.update(speed > 0 ? speed : 0);
+  uint16_t counter = speedTimeCounter.update(1);
 
   speedFrame[0] = speed_value;
   speedFrame[1] = (speed_value >> 8);
@@ -151,7 +127,6 @@ void BMWESeriesCluster::sendSpeed(int speed, int deltaTime) {
   speedFrame[7] = (counter >> 8) | 0xF0;
 
   CAN.sendMsgBuf(0x1A6, 0, 8, speedFrame);
-  previousSpeedValue = speed_value;
 }
 
 void BMWESeriesCluster::sendSteeringWheel() {
@@ -8,8 +8,10 @@
 #define BMW_E_SERIES
 
 #include "../../Libs/MCP_CAN/mcp_can.h" // CAN Bus Shield Compatibility Library ( https://github.com/coryjfowler/MCP_CAN_lib )
-#include "../../Libs/X9C10X/X9C10X.h" // For fuel level simulation ( https://github.com/RobTillaart/X9C10X )
+#include "../../Other/FuelPotDriver.h" // For fuel level simulation using X9C10X digital potentiometers
 
+#include "../../Other/ButtonEventQueue.h"
+#include "../../Other/DistanceIntegrator.h"
 #include "../Cluster.h"
 
 class BMWESeriesCluster: public Cluster {
@@ -34,8 +36,8 @@ class BMWESeriesCluster: public Cluster {
 
   private:
     MCP_CAN &CAN;
-    X9C102 fuelPot = X9C102();
-    X9C102 fuelPot2 = X9C102();
+    FuelPotDriver fuelPots;
+    ButtonEventQueue buttonEvents = ButtonEventQueue(200, 200);
 
     int handbrakeIndicator;
 
@@ -45,20 +47,18 @@ class BMWESeriesCluster: public Cluster {
     unsigned long lastDashboardUpdateTimeLong = 0; // Timer for slow updated variables
 
     uint8_t speedFrame[8] = {0x13, 0x4D, 0x46, 0x4D, 0x33, 0x4D, 0xD0, 0xFF};
-    uint16_t previousSpeedValue = 0;
+    DistanceIntegrator speedCounter = DistanceIntegrator(1, 100, 0x10000); // Speed summed every 100 ms
+    DistanceIntegrator speedTimeCounter = DistanceIntegrator(355, 113, 0x1000); // Time in ms * pi
     uint8_t absFrame[8] = {0x00, 0xE0, 0xB3, 0xFC, 0xF0, 0x43, 0x00, 0x65};
     uint8_t counter = 0;
     uint8_t counterGear = 0x0;
 
     void setFuel(GameState& game);
     uint8_t mapGenericGearToLocalGear(GearState inputGear);
-    int mapSpeed(GameState& game);
-    int mapRPM(GameState& game);
-    int mapCoolantTemperature(GameState& game);
 
     void sendIgnition(bool ignition);
     void sendRPM(int rpm);
-    void sendSpeed(int speed, int deltaTime);
+    void sendSpeed(int speed);
     void sendSteeringWheel();
     void sendAirbagCounter();
     void sendABSCounter();
@@ -7,12 +7,8 @@
 
 #include "BMWE46Cluster.h"
 
-BMWE46Cluster::BMWE46Cluster(MCP_CAN& CAN, int fuelPotIncPin, int fuelPotDirPin, int fuelPot1CsPin, int fuelPot2CsPin, int FhandbrakePin, int FspeedPin, int FabsPin, bool fConsumption): CAN(CAN) {
-  fuelPot.begin(fuelPotIncPin, fuelPotDirPin, fuelPot1CsPin);
-  fuelPot.setPosition(100, true); // Force the pot to a known value
-
-  fuelPot2.begin(fuelPotIncPin, fuelPotDirPin, fuelPot2CsPin);
-  fuelPot2.setPosition(100, true); // Force the pot to a known value
+BMWE46Cluster::BMWE46Cluster(MCP_CAN& CAN, int fuelPotIncPin, int fuelPotDirPin, int fuelPot1CsPin, int fuelPot2CsPin, int FhandbrakePin, int FspeedPin, int FabsPin, bool fConsumption): CAN(CAN), speedPulses(1320), kBus(Serial1) { // Speed ramps at up to 200 km/h per second
+  fuelPots.begin(fuelPotIncPin, fuelPotDirPin, fuelPot1CsPin, fuelPot2CsPin); // Pots are homed to a known value from updateWithGame
 
   this->handbrakePin = FhandbrakePin;
   this->speedPin = FspeedPin;
@@ -22,47 +18,26 @@ BMWE46Cluster::BMWE46Cluster(MCP_CAN& CAN, int fuelPotIncPin, int fuelPotDirPin,
   pinMode(FhandbrakePin, INPUT);
   pinMode(FabsPin, OUTPUT);
   digitalWrite(FabsPin, LOW);
-  pinMode(FspeedPin, OUTPUT);
-  noTone(FspeedPin);
+  speedPulses.begin(FspeedPin);
 
-  Serial1.begin(9600, SERIAL_8E1, 16, 17); //KBUS
+  kBus.begin(16, 17);
   
   // Turns on backlight for 2004+ IKE
   //https://diolum.fr/analyse-lsz-e46 (I use from different forum post, is brighter)
-  byte kbusBacklight[] = {0xD0, 0x07, 0xBF, 0x5C, 0xA8, 0x2A, 0xFF, 0x00, 0x49};
-  Serial1.write(kbusBacklight, sizeof(kbusBacklight));
+  byte kbusBacklight[] = {0x5C, 0xA8, 0x2A, 0xFF, 0x00};
+  kBus.send(KBus::Address_LCM, KBus::Address_Broadcast, kbusBacklight, sizeof(kbusBacklight));
   
   // Sets some time for cluster instead of blank
   //https://web.archive.org/web/20180208213215/http://web.comhem.se/bengt-olof.swing/IBus.htm
-  byte kbusTime[] = {0x3B, 0x06, 0x80, 0x40, 0x01, 0x0C, 0x3B, 0xCB}; //sets time
-  Serial1.write(kbusTime, sizeof(kbusTime));
-}
-
-int BMWE46Cluster::mapSpeed(GameState& game) {
-  int scaledSpeed = game.speed * game.configuration.speedCorrectionFactor;
-  if (scaledSpeed > game.configuration.maximumSpeedValue) {
-    return game.configuration.maximumSpeedValue;
-  } else {
-    return scaledSpeed;
-  }
-}
-
-int BMWE46Cluster::mapRPM(GameState& game) {
-  int scaledRPM = game.rpm * game.configuration.speedCorrectionFactor;
-  if (scaledRPM > game.configuration.maximumRPMValue) {
-    return game.configuration.maximumRPMValue;
-  } else {
-    return scaledRPM;
-  }
-}
-
-int BMWE46Cluster::mapCoolantTemperature(GameState& game) {
-  if (game.coolantTemperature < game.configuration.minimumCoolantTemperature) { return game.configuration.minimumCoolantTemperature; }
-  if (game.coolantTemperature > game.configuration.maximumCoolantTemperature) { return game.configuration.maximumCoolantTemperature; }
-  return game.coolantTemperature;
+  byte kbusTime[] = {0x40, 0x01, 0x0C, 0x3B}; //sets time
+  kBus.send(KBus::Address_GT, KBus::Address_IKE, kbusTime, sizeof(kbusTime));
 }
 
 void BMWE46Cluster::updateWithGame(GameState& game) {
+  fuelPots.update();
+  speedPulses.update();
+  kBus.update();
+
   if (millis() - last10 >= 10) { //every 10ms
     sendDME1(mapRPM(game));
     sendDME2(mapCoolantTemperature(game));
@@ -148,12 +123,7 @@ void BMWE46Cluster::sendDME1(int rpm) {
 
 // Generates pulses from hall effect ABS sensor for speed gauge
 void BMWE46Cluster::sendSpeed(int speed) {
-  if(speed < 1) {
-    noTone(this->speedPin);
-  } else if (this->lastSpeed != speed) {
-    tone(this->speedPin, 6.6 * speed);
-    this->lastSpeed = speed;
-  }
+  speedPulses.setFrequency(speed < 1 ? 0 : speedPulsesPerKm / 3600.0f * speed);
 }
 
 // Moves temperature gauge
@@ -205,29 +175,24 @@ void BMWE46Cluster::sendIO(bool handbrake, bool absLight) {
 //Atm blinkers, fogs, highbeam, car icon
 //Can do doors, faulty lights... no idea how
 void BMWE46Cluster::sendKBus(bool mainLights, bool highBeam, bool frontFogLight, bool rearFogLight, bool leftTurningIndicator, bool rightTurningIndicator, bool doors) {
-  byte kbusmsg[10] = {0xD0, 0x08, 0xBF, 0x5B, 0x00, 0x00, 0x00, 0x00, 0x00, 0xcc}; //last 0xcc is chksum
+  byte kbusmsg[6] = {0x5B, 0x00, 0x00, 0x00, 0x00, 0x00}; // Checksum is added by KBus
 
-  bitWrite(kbusmsg[4],6,rightTurningIndicator);
-  bitWrite(kbusmsg[4],5,leftTurningIndicator);
-  bitWrite(kbusmsg[4],4,rearFogLight);
-  bitWrite(kbusmsg[4],3,frontFogLight);
-  bitWrite(kbusmsg[4],2,highBeam);
+  bitWrite(kbusmsg[1],6,rightTurningIndicator);
+  bitWrite(kbusmsg[1],5,leftTurningIndicator);
+  bitWrite(kbusmsg[1],4,rearFogLight);
+  bitWrite(kbusmsg[1],3,frontFogLight);
+  bitWrite(kbusmsg[1],2,highBeam);
   
   //shows only the car image, I have no idea on how to show the doors:
   //https://github.com/piersholt/wilhelm-docs/blob/master/gm/7a.md
   //https://github.com/tsharp42/E46ClusterDriver/blob/master/E46%20Documentation/Useful%20KBUS%20Codes.txt
   if(doors) {
-    bitWrite(kbusmsg[7],7,true);
+    bitWrite(kbusmsg[4],7,true);
   } else {
-    bitWrite(kbusmsg[7],7,false);
+    bitWrite(kbusmsg[4],7,false);
   }
   
-  uint8_t cs = 0;
-  for (uint8_t i = 0; i < 9; ++i) {
-    cs ^= kbusmsg[i];
-  }
-  kbusmsg[9] = cs;
-  Serial1.write(kbusmsg, sizeof(kbusmsg));
+  kBus.send(KBus::Address_LCM, KBus::Address_Broadcast, kbusmsg, sizeof(kbusmsg));
 }
 
 void BMWE46Cluster::setFuel(GameState& game) {
@@ -236,8 +201,8 @@ void BMWE46Cluster::setFuel(GameState& game) {
   int pot2Percentage = (percentage < 50) ? percentage : 50;
 
   int desiredPositionPot1 = map(pot1Percentage, 0, 50, game.configuration.minimumFuelPotValue, game.configuration.maximumFuelPotValue);
-  fuelPot.setPosition(desiredPositionPot1, false);
+  fuelPots.setTarget(0, desiredPositionPot1);
   
   int desiredPositionPot2 = map(pot2Percentage, 0, 50, game.configuration.minimumFuelPot2Value, game.configuration.maximumFuelPot2Value);
-  fuelPot2.setPosition(desiredPositionPot2, false);
+  fuelPots.setTarget(1, desiredPositionPot2);
 }
\ No newline at end of file
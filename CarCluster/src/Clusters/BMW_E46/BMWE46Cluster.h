@@ -9,7 +9,9 @@
 #define BMW_E_SERIES
 
 #include "../../Libs/MCP_CAN/mcp_can.h" // CAN Bus Shield Compatibility Library ( https://github.com/coryjfowler/MCP_CAN_lib )
-#include "../../Libs/X9C10X/X9C10X.h" // For fuel level simulation ( https://github.com/RobTillaart/X9C10X )
+#include "../../Other/FuelPotDriver.h" // For fuel level simulation using X9C10X digital potentiometers
+#include "../../Other/PulseGenerator.h"
+#include "KBus.h"
 
 #include "../Cluster.h"
 
@@ -32,23 +34,24 @@ class BMWE46Cluster: public Cluster {
 
   BMWE46Cluster(MCP_CAN& CAN, int fuelPotIncPin, int fuelPotDirPin, int fuelPot1CsPin, int fuelPot2CsPin, int FhandbrakePin, int FspeedPin, int FabsPin, bool fConsumption);
   void updateWithGame(GameState& game);
+  KBus& kBusInterface() { return kBus; }
+  unsigned long speedPulseDistance() { return (unsigned long)(speedPulses.pulseCount() * 1000ULL / speedPulsesPerKm); } // Distance in m the speedometer has been driven with
 
   private:
     MCP_CAN &CAN;
-    X9C102 fuelPot = X9C102();
-    X9C102 fuelPot2 = X9C102();
+    FuelPotDriver fuelPots;
+    PulseGenerator speedPulses;
+    KBus kBus;
+    static const uint32_t speedPulsesPerKm = 23760; // 6.6 Hz per km/h
 
     int handbrakePin,speedPin,absPin;
     bool fakeConsumption;
 
     unsigned long last10 = 0, last20 = 0, last100 = 0; // Timer for the message loops
 
-    int mpgloop = 0, lastSpeed = 0, EGScounter = 0; //Looping counters and checks
+    int mpgloop = 0, EGScounter = 0; //Looping counters and checks
 
     void setFuel(GameState& game);
-    int mapSpeed(GameState& game);
-    int mapRPM(GameState& game);
-    int mapCoolantTemperature(GameState& game);
     int gearStateToDisplayCode(GearState state);
 
     void sendEGS1(GearState gear);
@@ -0,0 +1,232 @@
+// ####################################################################################################################
+//
+// Code part of CarCluster project by Andrej Rolih. See .ino file more details
+//
+// ####################################################################################################################
+
+#include "KBus.h"
+
+KBus::KBus(HardwareSerial& serial): serial(serial) {
+}
+
+void KBus::begin(int rxPin, int txPin) {
+  serial.begin(9600, SERIAL_8E1, rxPin, txPin);
+}
+
+bool KBus::send(uint8_t source, uint8_t destination, const uint8_t *data, uint8_t length) {
+  if (length > maximumMessageLength - 4) return false;
+  if (txCount >= queueSize) {
+    dropped++;
+    return false;
+  }
+
+  Message &message = txQueue[(txHead + txCount) % queueSize];
+  uint8_t checksum = 0;
+  uint8_t position = 0;
+
+  message.bytes[position++] = source;
+  message.bytes[position++] = length + 2;  // Destination + data + checksum
+  message.bytes[position++] = destination;
+  for (uint8_t i = 0; i < length; i++) {
+    message.bytes[position++] = data[i];
+  }
+  for (uint8_t i = 0; i < position; i++) {
+    checksum ^= message.bytes[i];
+  }
+  message.bytes[position++] = checksum;
+  message.length = position;
+
+  txCount++;
+  return true;
+}
+
+void KBus::update() {
+  unsigned long currentTime = micros();
+
+  if (serial.available() > 0) {
+    while (serial.available() > 0) {
+      receiveByte(serial.read(), currentTime);
+    }
+  } else if (rxLength > 0 && !resyncing && currentTime - lastRxTime >= idleTime) {
+    // Nothing came in since the partial message was read, so it is probably garbage. It is kept anyway (the loop
+    // timing says nothing about the gaps on the wire), the length and checksum decide: the parser only starts looking
+    // for a complete message further on.
+    resyncing = true;
+  }
+
+  transmit(currentTime);
+}
+
+bool KBus::readEvent(Event &event) {
+  if (eventCount == 0) return false;
+
+  event = events[eventHead];
+  eventHead = (eventHead + 1) % eventQueueSize;
+  eventCount--;
+  return true;
+}
+
+void KBus::receiveByte(uint8_t byte, unsigned long time) {
+  // Compare the echo of our own message
+  if (txState == TxState_Echo) {
+    const Message &message = txQueue[txHead];
+    if (byte == message.bytes[echoIndex]) {
+      echoIndex++;
+      if (echoIndex == message.length) finishMessage(true);
+    } else {
+      collisionCount++;
+      if (++retries > maximumRetries) {
+        finishMessage(false);
+      } else {
+        txState = TxState_Backoff;
+        backoff = random(0, maximumBackoff);
+      }
+    }
+  }
+
+  lastRxTime = time;
+
+  rxBuffer[rxLength++] = byte;
+  rxChecksum ^= byte;
+  checkReceivedMessage();
+}
+
+void KBus::transmit(unsigned long time) {
+  if (txState == TxState_Echo) {
+    const Message &message = txQueue[txHead];
+    if (time - txStartTime < message.length * byteTime + 10000) return;
+
+    // No echo at all means the interface does not loop back, a partial echo means the message got cut off
+    if (echoIndex == 0) {
+      finishMessage(true);
+    } else if (++retries > maximumRetries) {
+      finishMessage(false);
+    } else {
+      txState = TxState_Idle;
+    }
+  }
+
+  if (txState == TxState_Backoff) {
+    if (time - lastRxTime < idleTime + backoff) return;
+    txState = TxState_Idle;
+  }
+
+  if (txState != TxState_Idle || txCount == 0 || time - lastRxTime < idleTime) return;
+
+  const Message &message = txQueue[txHead];
+  serial.write(message.bytes, message.length);
+  txState = TxState_Echo;
+  echoIndex = 0;
+  txStartTime = time;
+}
+
+void KBus::finishMessage(bool success) {
+  if (success) {
+    sent++;
+  } else {
+    dropped++;
+  }
+
+  txHead = (txHead + 1) % queueSize;
+  txCount--;
+  retries = 0;
+  txState = TxState_Idle;
+}
+
+void KBus::dropFirstReceivedByte() {
+  rxChecksum ^= rxBuffer[0];
+  memmove(rxBuffer, rxBuffer + 1, rxLength - 1);
+  rxLength--;
+}
+
+void KBus::checkReceivedMessage() {
+  while (rxLength >= 2) {
+    uint8_t total = rxBuffer[1] + 2;
+    if (rxBuffer[1] < 2 || total > maximumMessageLength) {
+      resyncing = true;
+      dropFirstReceivedByte();
+      continue;
+    }
+    if (rxLength < total) {
+      // Out of sync the length can be any byte, a complete message further on is not held back by it
+      if (resyncing && skipToNextMessage()) continue;
+      return;
+    }
+
+    // rxChecksum covers the whole buffer, take out the bytes after this message
+    uint8_t checksum = rxChecksum;
+    for (uint8_t i = total; i < rxLength; i++) {
+      checksum ^= rxBuffer[i];
+    }
+
+    if (checksum != 0) {
+      // Lost sync (or a collision), try again from the next byte
+      checksumErrorCount++;
+      resyncing = true;
+      dropFirstReceivedByte();
+      continue;
+    }
+
+    received++;
+    resyncing = false;
+    decodeMessage(rxBuffer, total);
+
+    // The removed message XORs to 0, so rxChecksum stays valid for the remaining bytes
+    memmove(rxBuffer, rxBuffer + total, rxLength - total);
+    rxLength -= total;
+  }
+}
+
+bool KBus::skipToNextMessage() {
+  for (uint8_t start = 1; start + 2 <= rxLength; start++) {
+    uint8_t total = rxBuffer[start + 1] + 2;
+    if (rxBuffer[start + 1] < 2 || start + total > rxLength) continue;
+
+    uint8_t checksum = 0;
+    for (uint8_t i = start; i < start + total; i++) {
+      checksum ^= rxBuffer[i];
+    }
+    if (checksum != 0) continue;
+
+    while (start-- > 0) {
+      dropFirstReceivedByte();
+    }
+    return true;
+  }
+  return false;
+}
+
+void KBus::decodeMessage(const uint8_t *message, uint8_t length) {
+  uint8_t source = message[0];
+  uint8_t dataLength = length - 4;         // Without source, length, destination and checksum
+  const uint8_t *data = message + 3;
+
+  if (dataLength < 1) return;
+  uint8_t command = data[0];
+
+  if (source == Address_IKE) {
+    switch (command) {
+      case 0x11: if (dataLength >= 2) addEvent(Event_Ignition, source, data[1], 0); break;
+      case 0x18: if (dataLength >= 3) addEvent(Event_SpeedRpm, source, data[1] * 2, data[2] * 100); break;
+      case 0x19: if (dataLength >= 3) addEvent(Event_Temperatures, source, (int8_t)data[1], data[2]); break;
+      case 0x57: if (dataLength >= 2) addEvent(Event_IkeButton, source, data[1], 0); break;
+    }
+  } else if (source == Address_MFL && (command == 0x32 || command == 0x3B) && dataLength >= 2) {
+    addEvent(Event_MflButton, source, command, data[1]);
+  }
+}
+
+void KBus::addEvent(EventType type, uint8_t source, int16_t value1, int16_t value2) {
+  // Oldest event is dropped if nobody reads them
+  if (eventCount >= eventQueueSize) {
+    eventHead = (eventHead + 1) % eventQueueSize;
+    eventCount--;
+  }
+
+  Event &event = events[(eventHead + eventCount) % eventQueueSize];
+  event.type = type;
+  event.source = source;
+  event.value1 = value1;
+  event.value2 = value2;
+  eventCount++;
+}
@@ -0,0 +1,126 @@
+// ####################################################################################################################
+//
+// Code part of CarCluster project by Andrej Rolih. See .ino file more details
+//
+// ####################################################################################################################
+
+#ifndef KBUS_H
+#define KBUS_H
+
+#include "Arduino.h"
+
+// K-bus (I-bus) transceiver on a hardware UART (9600 baud, 8E1). Message format is:
+// source, length (number of bytes that follow), destination, data..., XOR checksum of all previous bytes.
+//
+// Messages are queued by send() and written from update() once the bus has been idle for idleTime. K-bus is a
+// single wire bus, so everything we send is also received back. The echo is compared to what was sent and a
+// mismatch means another module talked at the same time - the message is then retried after a random backoff.
+// Everything else that is received is parsed and the interesting IKE/MFL messages are turned into events. After a
+// bad checksum the parser moves on byte by byte until it finds a complete message with a good checksum again.
+//
+// update() never waits, it only handles the bytes that are already in the UART buffers. All bytes read in one
+// update() get the same time, so a slow loop can not tell the gaps between them: messages are only split by their
+// length and checksum, never by time. A partial message that sits there while the bus is quiet only lets the parser
+// look for a complete message behind it.
+class KBus {
+  KBus(const KBus &other) = delete;
+  KBus(KBus &&other) = delete;
+  KBus &operator=(const KBus &other) = delete;
+  KBus &operator=(KBus &&other) = delete;
+
+  public:
+    static const uint8_t maximumMessageLength = 36;  // Source + length + destination + 32 data bytes + checksum
+    static const uint8_t queueSize = 8;
+    static const uint8_t eventQueueSize = 8;
+    static const uint8_t maximumRetries = 3;
+    static const unsigned long idleTime = 2000;      // Bus must be quiet this long (us) before we start sending
+    static const unsigned long maximumBackoff = 4000; // Random extra wait (us) after a collision
+    static const unsigned long byteTime = 1146;      // 11 bits at 9600 baud (us)
+
+    static const uint8_t Address_GT = 0x3B;
+    static const uint8_t Address_MFL = 0x50;
+    static const uint8_t Address_IKE = 0x80;
+    static const uint8_t Address_Broadcast = 0xBF;
+    static const uint8_t Address_LCM = 0xD0;
+
+    enum EventType {
+      Event_Ignition = 0,                  // value1 = ignition state (0 = off, 1 = position 1, 3 = position 2, 7 = start)
+      Event_SpeedRpm,                      // value1 = speed in km/h, value2 = RPM
+      Event_Temperatures,                  // value1 = outside temperature, value2 = coolant temperature
+      Event_IkeButton,                     // value1 = button code (0x57 message from the IKE)
+      Event_MflButton                      // value1 = command (0x32 volume, 0x3B buttons), value2 = button code
+    };
+
+    struct Event {
+      EventType type;
+      uint8_t source;
+      int16_t value1;
+      int16_t value2;
+    };
+
+    KBus(HardwareSerial& serial);
+    void begin(int rxPin, int txPin);
+
+    bool send(uint8_t source, uint8_t destination, const uint8_t *data, uint8_t length);  // False if queue is full
+    void update();
+    bool readEvent(Event &event);
+
+    // Statistics
+    uint32_t sentMessages() { return sent; }
+    uint32_t collisions() { return collisionCount; }
+    uint32_t droppedMessages() { return dropped; }
+    uint32_t receivedMessages() { return received; }
+    uint32_t checksumErrors() { return checksumErrorCount; }
+
+    // Normally called from update(), public so byte streams can be fed in directly
+    void receiveByte(uint8_t byte, unsigned long time);
+    void transmit(unsigned long time);
+
+  private:
+    enum TxState {
+      TxState_Idle = 0,
+      TxState_Echo,                        // Message written, comparing the echo
+      TxState_Backoff                      // Collision, waiting before retry
+    };
+
+    struct Message {
+      uint8_t bytes[maximumMessageLength];
+      uint8_t length;
+    };
+
+    HardwareSerial &serial;
+
+    Message txQueue[queueSize];
+    uint8_t txHead = 0;
+    uint8_t txCount = 0;
+    TxState txState = TxState_Idle;
+    uint8_t echoIndex = 0;
+    uint8_t retries = 0;
+    unsigned long txStartTime = 0;
+    unsigned long backoff = 0;
+
+    uint8_t rxBuffer[maximumMessageLength];
+    uint8_t rxLength = 0;
+    uint8_t rxChecksum = 0;                // XOR of everything in rxBuffer
+    bool resyncing = false;                // Bytes were dropped or a partial message went quiet since the last good message
+    unsigned long lastRxTime = 0;
+
+    Event events[eventQueueSize];
+    uint8_t eventHead = 0;
+    uint8_t eventCount = 0;
+
+    uint32_t sent = 0;
+    uint32_t collisionCount = 0;
+    uint32_t dropped = 0;
+    uint32_t received = 0;
+    uint32_t checksumErrorCount = 0;
+
+    void finishMessage(bool success);
+    void dropFirstReceivedByte();
+    bool skipToNextMessage();              // Drops bytes up to the next complete message, false if there is none
+    void checkReceivedMessage();
+    void decodeMessage(const uint8_t *message, uint8_t length);
+    void addEvent(EventType type, uint8_t source, int16_t value1, int16_t value2);
+};
+
+#endif
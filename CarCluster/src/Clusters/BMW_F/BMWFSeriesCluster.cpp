@@ -9,12 +9,13 @@
 BMWFSeriesCluster::BMWFSeriesCluster(MCP_CAN& CAN, bool isCarMini): CAN(CAN) {
   this->isCarMini = isCarMini;
 
+  const int32_t inFuelRange[] = { 0, 50, 100 };
   if (isCarMini) {
-    inFuelRange[0] = 0; inFuelRange[1] = 50; inFuelRange[2] = 100;
-    outFuelRange[0] = 22; outFuelRange[1] = 7; outFuelRange[2] = 3;
+    const int32_t outFuelRange[] = { 22, 7, 3 };
+    fuelCalibration.setPoints(inFuelRange, outFuelRange, 3);
   } else {
-    inFuelRange[0] = 0; inFuelRange[1] = 50; inFuelRange[2] = 100;
-    outFuelRange[0] = 37; outFuelRange[1] = 18; outFuelRange[2] = 4;
+    const int32_t outFuelRange[] = { 37, 18, 4 };
+    fuelCalibration.setPoints(inFuelRange, outFuelRange, 3);
   }
   crc8Calculator.begin();
 }
@@ -41,31 +42,11 @@ uint8_t BMWFSeriesCluster::mapGenericGearToLocalGear(GearState inputGear) {
   }
 }
 
-int BMWFSeriesCluster::mapSpeed(GameState& game) {
-  int scaledSpeed = game.speed * game.configuration.speedCorrectionFactor;
-  if (scaledSpeed > game.configuration.maximumSpeedValue) {
-    return game.configuration.maximumSpeedValue;
-  } else {
-    return scaledSpeed;
+void BMWFSeriesCluster::updateWithGame(GameState& game) {
+  if (buttonEvents.update(game)) {
+    sendSteeringWheelButton(buttonEvents.activeButton());
   }
-}
 
-int BMWFSeriesCluster::mapRPM(GameState& game) {
-  int scaledRPM = game.rpm * game.configuration.speedCorrectionFactor;
-  if (scaledRPM > game.configuration.maximumRPMValue) {
-    return game.configuration.maximumRPMValue;
-  } else {
-    return scaledRPM;
-  }
-}
-
-int BMWFSeriesCluster::mapCoolantTemperature(GameState& game) {
-  if (game.coolantTemperature < game.configuration.minimumCoolantTemperature) { return game.configuration.minimumCoolantTemperature; }
-  if (game.coolantTemperature > game.configuration.maximumCoolantTemperature) { return game.configuration.maximumCoolantTemperature; }
-  return game.coolantTemperature;
-}
-
-void BMWFSeriesCluster::updateWithGame(GameState& game) {
   if (millis() - lastDashboardUpdateTime >= dashboardUpdateTime100) {
     // This should probably be done using a more sophisticated method like a
     // scheduler, but for now this seems to work.
@@ -75,7 +56,7 @@ void BMWFSeriesCluster::updateWithGame(GameState& game) {
     sendRPM(mapRPM(game), mapGenericGearToLocalGear(game.gear));
     sendBasicDriveInfo(mapCoolantTemperature(game));
     sendAutomaticTransmission(mapGenericGearToLocalGear(game.gear));
-    sendFuel(game.fuelQuantity, inFuelRange, outFuelRange, isCarMini);
+    sendFuel(game.fuelQuantity, isCarMini);
     sendParkBrake(game.handbrake);
     sendDistanceTravelled(mapSpeed(game));
     sendAlerts(game.offroadLight, game.doorOpen, game.handbrake, isCarMini);
@@ -96,10 +77,7 @@ void BMWFSeriesCluster::updateWithGame(GameState& game) {
     sendBacklightBrightness(game.backlightBrightness);
     sendDriveMode(game.driveMode);
 
-    sendSteeringWheelButton(game.buttonEventToProcess);
-    if (game.buttonEventToProcess != 0) {
-      game.buttonEventToProcess = 0;
-    }
+    sendSteeringWheelButton(buttonEvents.activeButton());
 
     lastDashboardUpdateTime1000ms = millis();
   }
@@ -128,7 +106,7 @@ void BMWFSeriesCluster::sendRPM(int rpm, int manualGear) {
     case 11: calculatedGear = 2; break; // Reverse
     case 12: calculatedGear = 1; break; // Neutral
   }
-  int rpmValue =  map(rpm, 0, 6900, 0x00, 0x2B);
+  int rpmValue = rpmGaugeCalibration.apply(rpm);
   unsigned char rpmWithoutCRC[] = { 0x60|counter4Bit, rpmValue, 0xC0, 0xF0, calculatedGear, 0xFF, 0xFF };
   unsigned char rpmWithCRC[] = { crc8Calculator.get_crc8(rpmWithoutCRC, 7, 0x7A), rpmWithoutCRC[0], rpmWithoutCRC[1], rpmWithoutCRC[2], rpmWithoutCRC[3], rpmWithoutCRC[4], rpmWithoutCRC[5], rpmWithoutCRC[6] };
   CAN.sendMsgBuf(0x0F3, 0, 8, rpmWithCRC);
@@ -204,9 +182,9 @@ void BMWFSeriesCluster::sendParkBrake(bool handbrakeActive) {
   CAN.sendMsgBuf(0x36F, 0, 5, abs3WithCRC);
 }
 
-void BMWFSeriesCluster::sendFuel(int fuelQuantity, uint8_t inFuelRange[], uint8_t outFuelRange[], bool isCarMini) {
+void BMWFSeriesCluster::sendFuel(int fuelQuantity, bool isCarMini) {
   //Fuel
-  uint8_t fuelQuantityLiters = multiMap<uint8_t>(fuelQuantity, inFuelRange, outFuelRange, 3);
+  uint8_t fuelQuantityLiters = fuelCalibration.apply(fuelQuantity);
   unsigned char fuelWithoutCRC[] = { (isCarMini ? 0 : hi8(fuelQuantityLiters)), (isCarMini ? 0 : lo8(fuelQuantityLiters)), hi8(fuelQuantityLiters), lo8(fuelQuantityLiters), 0x00 };
   CAN.sendMsgBuf(0x349, 0, 5, fuelWithoutCRC);
 }
@@ -219,10 +197,10 @@ void BMWFSeriesCluster::sendDistanceTravelled(int speed) {
 
   // MPG bar 2 (this one actually moves the bar)
   // The distance travelled counter is used to calculate the travelled distance shown in the cluster.
+  uint16_t distanceTravelledCounter = distanceTravelled.update(speed > 0 ? speed : 0);
   unsigned char mpg2WithoutCRC[] = { 0xF0|counter4Bit, lo8(distanceTravelledCounter), hi8(distanceTravelledCounter), 0xF2 };
   unsigned char mpg2WithCRC[] = { crc8Calculator.get_crc8(mpg2WithoutCRC, 4, 0xde), mpg2WithoutCRC[0], mpg2WithoutCRC[1], mpg2WithoutCRC[2], mpg2WithoutCRC[3], mpg2WithoutCRC[4] };
   CAN.sendMsgBuf(0x2BB, 0, 5, mpg2WithCRC);
-  distanceTravelledCounter += speed*2.9;
 }
 
 void BMWFSeriesCluster::sendBlinkers(bool leftTurningIndicator, bool rightTurningIndicator) {
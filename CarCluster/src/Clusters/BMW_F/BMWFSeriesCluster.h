@@ -7,10 +7,12 @@
 #ifndef F_SERIES_DASH
 #define F_SERIES_DASH
 
-#include "../../Libs/MultiMap/MultiMap.h" // For fuel level calculation - supports non linear mapping found on BMW clusters ( https://github.com/RobTillaart/MultiMap )
 #include "../../Libs/MCP_CAN/mcp_can.h" // CAN Bus Shield Compatibility Library ( https://github.com/coryjfowler/MCP_CAN_lib )
 
 #include "CRC8.h"
+#include "../../Other/ButtonEventQueue.h"
+#include "../../Other/DistanceIntegrator.h"
+#include "../../Other/GaugeCalibration.h"
 #include "../Cluster.h"
 
 #define lo8(x) (uint8_t)((x) & 0xFF)
@@ -40,8 +42,7 @@ class BMWFSeriesCluster: public Cluster {
   void updateWithGame(GameState& game);
   void updateLanguageAndUnits();
 
-  uint8_t inFuelRange[3] = {};
-  uint8_t outFuelRange[3] = {};
+  GaugeCalibration fuelCalibration; // Fuel percentage to liters, non linear on BMW clusters
 
   private:
   MCP_CAN &CAN;
@@ -55,8 +56,10 @@ class BMWFSeriesCluster: public Cluster {
   uint8_t counter4Bit = 0;
   uint8_t accCounter = 0;
   uint8_t count = 0;
-  uint16_t distanceTravelledCounter = 0;
+  ButtonEventQueue buttonEvents = ButtonEventQueue(200, 200);
+  DistanceIntegrator distanceTravelled = DistanceIntegrator(104400, DistanceIntegrator::msPerHour, 0x10000); // 104400 units per km
   bool isCarMini = false;
+  GaugeCalibration rpmGaugeCalibration = GaugeCalibration(0, 6900, 0x00, 0x2B);
 
   void sendIgnitionStatus(bool ignition);
   void sendSpeed(int speed);
@@ -64,7 +67,7 @@ class BMWFSeriesCluster: public Cluster {
   void sendAutomaticTransmission(int gear);
   void sendBasicDriveInfo(int engineTemperature);
   void sendParkBrake(bool handbrakeActive);
-  void sendFuel(int fuelQuantity, uint8_t inFuelRange[], uint8_t outFuelRange[], bool isCarMini);
+  void sendFuel(int fuelQuantity, bool isCarMini);
   void sendDistanceTravelled(int speed);
   void sendBlinkers(bool leftTurningIndicator, bool rightTurningIndicator);
   void sendLights(bool mainLights, bool highBeam, bool rearFogLight, bool frontFogLight);
@@ -75,9 +78,6 @@ class BMWFSeriesCluster: public Cluster {
   void sendAcc();
 
   uint8_t mapGenericGearToLocalGear(GearState inputGear);
-  int mapSpeed(GameState& game);
-  int mapRPM(GameState& game);
-  int mapCoolantTemperature(GameState& game);
 };
 
 #endif
\ No newline at end of file
@@ -7,7 +7,7 @@
 #ifndef CRC8_H
 #define CRC8_H
 
-#include "Arduino.h"
+#include <stdint.h>
 
 // CRC is calculated by using CRC8_SAE_J1850, but with a final XOR value specific to each message
 // Use calculator here to determine the correct sequence: http://www.sunshine2k.de/coding/javascript/crc/crc_js.html
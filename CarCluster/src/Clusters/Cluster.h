@@ -10,11 +10,20 @@
 #include "Arduino.h"
 
 #include "../Games/GameSimulation.h"
+#include "../Other/BlinkerGenerator.h"
 
 class Cluster {
   public:
   virtual void updateWithGame(GameState& game) = 0;
   //virtual static ClusterConfiguration clusterConfigForUserConfig(UserConfiguration& userConfig) = 0;
+
+  protected:
+  BlinkerGenerator blinker; // For clusters where the sketch blinks the turn signals (800 ms period, 50 % duty cycle)
+
+  // Game values mapped through the configured gauge calibrations
+  int mapSpeed(GameState& game) { return game.configuration.speedCalibration.apply(game.speed); }
+  int mapRPM(GameState& game) { return game.configuration.rpmCalibration.apply(game.rpm); }
+  int mapCoolantTemperature(GameState& game) { return game.configuration.coolantCalibration.apply(game.coolantTemperature); }
 };
 
 #endif
\ No newline at end of file
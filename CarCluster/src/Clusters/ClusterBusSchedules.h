@@ -0,0 +1,227 @@
+// ####################################################################################################################
+//
+// Code part of CarCluster project by Andrej Rolih. See .ino file more details
+//
+// ####################################################################################################################
+
+#ifndef CLUSTER_BUS_SCHEDULES
+#define CLUSTER_BUS_SCHEDULES
+
+#include "../Other/CanBusLoad.h"
+
+// Periodic CAN frames each cluster sends (ID, DLC, period in ms), per bus. Has to be kept in sync with the
+// updateWithGame() of the clusters. Frames only sent on events (steering wheel buttons, etc.) are not listed.
+//
+// Every bus is checked at compile time: our own frames must stay under CanBusLoad::utilizationBudget and every frame
+// has to make it onto the bus within its period. The same tables are reported on the dashboard (/api/busload)
+// and printed by Tools/busload.cpp.
+
+// BMW F series (CLUSTER 1, 2), 500 kbit/s
+constexpr CanBusLoad::Frame bmwFSeriesFrames[] = {
+  { 0x12F, 8, 100, false },                // Ignition
+  { 0x1A1, 5, 100, false },                // Speed
+  { 0x0F3, 8, 100, false },                // RPM
+  { 0x36E, 5, 100, false },                // ABS
+  { 0x0D7, 2, 100, false },                // Safety alive counter
+  { 0x2A7, 5, 100, false },                // Steering column
+  { 0x289, 8, 100, false },                // Cruise control
+  { 0x19B, 8, 100, false },                // Restraint system
+  { 0x297, 7, 100, false },                // Restraint system 2
+  { 0x369, 5, 100, false },                // TPMS
+  { 0x3F9, 8, 100, false },                // Oil
+  { 0x2C4, 8, 100, false },                // Engine temperature
+  { 0x3FD, 5, 100, false },                // Transmission
+  { 0x349, 5, 100, false },                // Fuel
+  { 0x36F, 5, 100, false },                // Park brake
+  { 0x2C4, 8, 100, false },                // Consumption
+  { 0x2BB, 5, 100, false },                // Consumption 2
+  { 0x5C0, 8, 100, false },                // Alerts (door)
+  { 0x5C0, 8, 100, false },                // Alerts (DSC)
+  { 0x5C0, 8, 100, false },                // Alerts (park brake, Mini only)
+  { 0x33B, 6, 100, false },                // ACC
+  { 0x21A, 3, 500, false },                // Lights
+  { 0x1F6, 2, 500, false },                // Blinkers
+  { 0x202, 2, 500, false },                // Backlight
+  { 0x3A7, 7, 500, false },                // Drive mode
+  { 0x1EE, 2, 500, false }                 // Steering wheel buttons
+};
+constexpr CanBusLoad::Bus bmwFSeriesBuses[] = {
+  { "BMW F", 500, bmwFSeriesFrames, CanBusLoad::frameCount(bmwFSeriesFrames) }
+};
+
+// VW MQB (CLUSTER 3, 99), 500 kbit/s. In passthrough mode some of these come from the car instead and the forwarded
+// traffic is not included.
+constexpr CanBusLoad::Frame vwMQBFrames[] = {
+  { 0x3C0, 4, 50, false },                 // Klemmen status 01
+  { 0x5F0, 8, 50, false },                 // Dimmung 01
+  { 0x65D, 8, 50, false },                 // ESP 20
+  { 0x0FD, 8, 50, false },                 // ESP 21
+  { 0x3BE, 8, 50, false },                 // Motor 14
+  { 0x3DF, 8, 50, false },                 // Gateway 76
+  { 0x31E, 8, 50, false },                 // TSK 07
+  { 0x32A, 8, 50, false },                 // LH EPS 01
+  { 0x641, 8, 50, false },                 // Motor code 01
+  { 0x107, 8, 50, false },                 // Motor 04
+  { 0x647, 8, 50, false },                 // Motor 09
+  { 0x31B, 8, 50, false },                 // ESP 24
+  { 0x394, 8, 50, false },                 // WBA 03
+  { 0x663, 8, 50, false },                 // RKA 01
+  { 0x040, 8, 50, false },                 // Airbag 01
+  { 0x366, 8, 50, false },                 // Blinkmodi 02
+  { 0x30D, 4, 50, false },                 // Park brake
+  { 0x64A, 8, 500, false },                // TPMS
+  { 0x658, 8, 500, false },                // Licht vorne 01
+  { 0x3D5, 8, 500, false },                // Licht anf
+  { 0x3D6, 8, 500, false },                // Licht hinten 01
+  { 0x583, 8, 500, false },                // Door status
+  { 0x5E1, 8, 500, false }                 // Outdoor temperature
+};
+constexpr CanBusLoad::Bus vwMQBBuses[] = {
+  { "VW MQB", 500, vwMQBFrames, CanBusLoad::frameCount(vwMQBFrames) }
+};
+
+// VW PQ25 (CLUSTER 4), 500 kbit/s
+constexpr CanBusLoad::Frame vwPQ25Frames[] = {
+  { 0x3D0, 8, 50, false },                 // Immobilizer
+  { 0x470, 8, 50, false },                 // Indicators
+  { 0x480, 8, 50, false },                 // Diesel engine
+  { 0x280, 8, 50, false },                 // RPM
+  { 0x5A0, 8, 50, false },                 // Speed
+  { 0x1A0, 8, 50, false },                 // ABS
+  { 0x540, 8, 50, false },                 // Gear
+  { 0x050, 8, 50, false }                  // Airbag
+};
+constexpr CanBusLoad::Bus vwPQ25Buses[] = {
+  { "VW PQ25", 500, vwPQ25Frames, CanBusLoad::frameCount(vwPQ25Frames) }
+};
+
+// VW PQ46 (CLUSTER 5), 500 kbit/s
+constexpr CanBusLoad::Frame vwPQ46Frames[] = {
+  { 0x3D0, 8, 50, false },                 // Immobilizer
+  { 0x470, 8, 50, false },                 // Indicators
+  { 0x531, 8, 50, false },                 // Lights
+  { 0x635, 3, 50, false },                 // Backlight
+  { 0x480, 8, 50, false },                 // Diesel engine
+  { 0x280, 8, 50, false },                 // RPM
+  { 0x5A0, 8, 50, false },                 // Speed
+  { 0x1A0, 8, 50, false },                 // ABS
+  { 0x540, 8, 50, false },                 // Gear
+  { 0x050, 8, 50, false }                  // Airbag
+};
+constexpr CanBusLoad::Bus vwPQ46Buses[] = {
+  { "VW PQ46", 500, vwPQ46Frames, CanBusLoad::frameCount(vwPQ46Frames) }
+};
+
+// BMW E60/E90 (CLUSTER 6), 100 kbit/s
+constexpr CanBusLoad::Frame bmwESeriesFrames[] = {
+  { 0x130, 5, 100, false },                // Ignition
+  { 0x0AA, 8, 100, false },                // RPM
+  { 0x1A6, 8, 100, false },                // Speed
+  { 0x0C4, 7, 100, false },                // Steering wheel
+  { 0x0D7, 2, 100, false },                // Airbag counter
+  { 0x0C0, 2, 100, false },                // ABS counter
+  { 0x19E, 8, 100, false },                // ABS
+  { 0x1D2, 6, 100, false },                // Gear
+  { 0x21A, 3, 500, false },                // Lights
+  { 0x1D0, 8, 500, false },                // Engine temperature
+  { 0x34F, 2, 500, false },                // Handbrake
+  { 0x202, 2, 500, false },                // Backlight
+  { 0x1F6, 2, 500, false },                // Blinkers
+  { 0x1EE, 2, 500, false }                 // Steering wheel buttons
+};
+constexpr CanBusLoad::Bus bmwESeriesBuses[] = {
+  { "BMW E", 100, bmwESeriesFrames, CanBusLoad::frameCount(bmwESeriesFrames) }
+};
+
+// BMW E46 (CLUSTER 7), 500 kbit/s. Lights and doors are on K-bus.
+constexpr CanBusLoad::Frame bmwE46Frames[] = {
+  { 0x316, 8, 10, false },                 // DME1
+  { 0x329, 8, 10, false },                 // DME2
+  { 0x545, 8, 10, false },                 // DME4
+  { 0x153, 8, 10, false },                 // ASC1
+  { 0x43F, 8, 10, false },                 // EGS1
+  { 0x1F3, 8, 20, false }                  // ASC3
+};
+constexpr CanBusLoad::Bus bmwE46Buses[] = {
+  { "BMW E46", 500, bmwE46Frames, CanBusLoad::frameCount(bmwE46Frames) }
+};
+
+// Mercedes W204 (CLUSTER 8), 500 kbit/s on CAN, 125 kbit/s on CAN2
+constexpr CanBusLoad::Frame mercedesW204Frames[] = {
+  { 0x001, 8, 100, false },                // Ignition
+  { 0x2F8, 8, 100, false },                // Key
+  { 0x105, 8, 100, false },                // RPM
+  { 0x203, 8, 100, false },                // Speed
+  { 0x0F3, 8, 100, false },                // Transmission
+  { 0x2F5, 8, 100, false },                // Transmission 2
+  { 0x2F3, 8, 100, false },                // Drive mode
+  { 0x30D, 8, 100, false },                // Coolant temperature
+  { 0x247, 8, 100, false },                // ABS
+  { 0x005, 8, 100, false },                // Traction
+  { 0x375, 8, 100, false },                // Airbag
+  { 0x378, 8, 100, false },                // Distronic
+  { 0x33D, 8, 100, false },                // Glow plugs
+  { 0x340, 8, 100, false },                // Power steering
+  { 0x2FF, 8, 100, false },                // TPMS
+  { 0x206, 8, 100, false },                // Errors
+  { 0x208, 8, 100, false },                // Errors 2
+  { 0x045, 8, 100, false }                 // Steering wheel buttons
+};
+constexpr CanBusLoad::Frame mercedesW204Frames2[] = {
+  { 0x069, 8, 100, false },                // Lights
+  { 0x006, 8, 100, false },                // Lights 2
+  { 0x029, 8, 100, false },                // Blinkers
+  { 0x321, 4, 100, false },                // Fuel
+  { 0x002, 8, 100, false },                // Doors
+  { 0x206, 8, 100, false },                // Errors
+  { 0x208, 8, 100, false },                // Errors 2
+  { 0x30E, 8, 100, false }                 // Brake fluid
+};
+constexpr CanBusLoad::Bus mercedesW204Buses[] = {
+  { "Mercedes W204 CAN", 500, mercedesW204Frames, CanBusLoad::frameCount(mercedesW204Frames) },
+  { "Mercedes W204 CAN2", 125, mercedesW204Frames2, CanBusLoad::frameCount(mercedesW204Frames2) }
+};
+
+// Mercedes W221 (CLUSTER 9), 500 kbit/s
+constexpr CanBusLoad::Frame mercedesW221Frames[] = {
+  { 0x001, 8, 100, false },                // Ignition
+  { 0x2F8, 8, 100, false },                // Key
+  { 0x105, 8, 100, false },                // RPM
+  { 0x203, 8, 100, false },                // Speed
+  { 0x0F3, 8, 100, false },                // Transmission
+  { 0x2F5, 8, 100, false },                // Transmission 2
+  { 0x2F3, 8, 100, false },                // Drive mode
+  { 0x30D, 8, 100, false },                // Coolant temperature
+  { 0x029, 8, 100, false },                // Blinkers
+  { 0x247, 8, 100, false },                // ABS
+  { 0x0F8, 8, 100, false },                // Fuel
+  { 0x139, 8, 100, false },                // Status (doors, high beam, outdoor temperature)
+  { 0x17A, 8, 100, false },                // Parking brake
+  { 0x005, 8, 100, false },                // Traction
+  { 0x375, 8, 100, false },                // Airbag
+  { 0x378, 8, 100, false },                // Distronic
+  { 0x33D, 8, 100, false },                // Glow plugs
+  { 0x340, 8, 100, false },                // Power steering
+  { 0x2FF, 8, 100, false },                // TPMS
+  { 0x206, 8, 100, false },                // Errors
+  { 0x208, 8, 100, false },                // Errors 2
+  { 0x30E, 8, 100, false },                // Brake fluid
+  { 0x379, 8, 100, false },                // Airtronic
+  { 0x2FA, 8, 100, false },                // Brake fluid level
+  { 0x045, 8, 100, false }                 // Steering wheel buttons
+};
+constexpr CanBusLoad::Bus mercedesW221Buses[] = {
+  { "Mercedes W221", 500, mercedesW221Frames, CanBusLoad::frameCount(mercedesW221Frames) }
+};
+
+static_assert(CanBusLoad::withinBudget(bmwFSeriesBuses[0]), "BMW F frame schedule does not fit the CAN bus");
+static_assert(CanBusLoad::withinBudget(vwMQBBuses[0]), "VW MQB frame schedule does not fit the CAN bus");
+static_assert(CanBusLoad::withinBudget(vwPQ25Buses[0]), "VW PQ25 frame schedule does not fit the CAN bus");
+static_assert(CanBusLoad::withinBudget(vwPQ46Buses[0]), "VW PQ46 frame schedule does not fit the CAN bus");
+static_assert(CanBusLoad::withinBudget(bmwESeriesBuses[0]), "BMW E frame schedule does not fit the CAN bus");
+static_assert(CanBusLoad::withinBudget(bmwE46Buses[0]), "BMW E46 frame schedule does not fit the CAN bus");
+static_assert(CanBusLoad::withinBudget(mercedesW204Buses[0]), "Mercedes W204 frame schedule does not fit CAN");
+static_assert(CanBusLoad::withinBudget(mercedesW204Buses[1]), "Mercedes W204 frame schedule does not fit CAN2");
+static_assert(CanBusLoad::withinBudget(mercedesW221Buses[0]), "Mercedes W221 frame schedule does not fit the CAN bus");
+
+#endif
@@ -0,0 +1,250 @@
+// ####################################################################################################################
+//
+// Code part of CarCluster project by Andrej Rolih. See .ino file more details
+//
+// ####################################################################################################################
+
+#include "ClusterFrameDecoders.h"
+#include "VW_MQB/MQBCRC.h"
+
+#define SIGNAL_VALUE(frame, signal, value) { (frame).signals |= 1 << (signal); (frame).values[signal] = (value); }
+
+// ####################################################################################################################
+// BMW F series
+
+BMWFSeriesFrameDecoder::BMWFSeriesFrameDecoder() {
+  crc8Calculator.begin();
+}
+
+void BMWFSeriesFrameDecoder::decode(uint32_t id, uint8_t len, const uint8_t *buf, DecodedFrame &frame) {
+  uint8_t finalXor = 0;
+  switch (id) {
+    case 0x12F: finalXor = 0x44; break;    // Ignition
+    case 0x1A1: finalXor = 0xA9; break;    // Speed
+    case 0x0F3: finalXor = 0x7A; break;    // RPM
+    case 0x3FD: finalXor = 0xD6; break;    // Transmission
+    case 0x36E: finalXor = 0xD8; break;    // ABS
+    case 0x2A7: finalXor = 0x9E; break;    // Steering column
+    case 0x289: finalXor = 0x82; break;    // Cruise control
+    case 0x19B: finalXor = 0xFF; break;    // Restraint system
+    case 0x297: finalXor = 0x28; break;    // Restraint system 2
+    case 0x369: finalXor = 0xC5; break;    // TPMS
+    case 0x3F9: finalXor = 0xF1; break;    // Oil
+    case 0x36F: finalXor = 0x17; break;    // Park brake
+    case 0x2BB: finalXor = 0xDE; break;    // Consumption 2
+    case 0x3A7: finalXor = 0x4A; break;    // Drive mode
+    case 0x33B: finalXor = 0x6B; break;    // ACC
+    case 0x2C4:
+      // Engine temperature and consumption share the ID, neither has a 4 bit counter. Consumption always has 0xFF in
+      // byte 2 where engine temperature (0 - 200) is, so each frame is checked against its own final XOR. Accepting
+      // either one lets some flipped bits turn one frame into a valid other one.
+      frame.checksumPresent = true;
+      frame.checksumValid = checksumMatches(len, buf, buf[2] == 0xFF ? 0xC6 : 0xB2);
+      return;
+    case 0x0D7:
+      // Safety alive counter, no checksum
+      frame.counterPresent = true;
+      frame.counter = buf[0];
+      frame.counterModulo = 254;
+      break;
+  }
+
+  if (finalXor != 0) {
+    frame.checksumPresent = true;
+    frame.checksumValid = checksumMatches(len, buf, finalXor);
+    frame.counterPresent = true;
+    frame.counter = buf[1] & 0x0F;
+    frame.counterModulo = 14;
+    if (id == 0x33B) {
+      frame.counterModulo = 15;
+      frame.counterStep = 4;
+    }
+    // Drive mode is sent every 500 ms with the counter of the 100 ms frames
+    if (id == 0x3A7) frame.counterStep = 0;
+  }
+
+  switch (id) {
+    case 0x1A1:
+      // Speed * 64.01, without a float division on every frame
+      SIGNAL_VALUE(frame, LatencySignal_Speed, (buf[2] | buf[3] << 8) * 100L / 6401);
+      break;
+    case 0x0F3:
+      SIGNAL_VALUE(frame, LatencySignal_RPM, buf[2] * 6900 / 43);
+      // Manual gears, reverse and neutral. P and D are both 0, they come from 0x3FD.
+      if (buf[5] >= 5 && buf[5] <= 13) SIGNAL_VALUE(frame, LatencySignal_Gear, GearState_Manual_1 + buf[5] - 5);
+      if (buf[5] == 2) SIGNAL_VALUE(frame, LatencySignal_Gear, GearState_Auto_R);
+      if (buf[5] == 1) SIGNAL_VALUE(frame, LatencySignal_Gear, GearState_Auto_N);
+      break;
+    case 0x3FD:
+      // 0x81 (manual) does not say which gear
+      if (buf[2] == 0x20) SIGNAL_VALUE(frame, LatencySignal_Gear, GearState_Auto_P);
+      if (buf[2] == 0x40) SIGNAL_VALUE(frame, LatencySignal_Gear, GearState_Auto_R);
+      if (buf[2] == 0x60) SIGNAL_VALUE(frame, LatencySignal_Gear, GearState_Auto_N);
+      if (buf[2] == 0x80) SIGNAL_VALUE(frame, LatencySignal_Gear, GearState_Auto_D);
+      break;
+    case 0x1F6:
+      SIGNAL_VALUE(frame, LatencySignal_Indicators, (buf[0] >> 4) & 0x03);
+      break;
+  }
+}
+
+int32_t BMWFSeriesFrameDecoder::expectedValue(uint8_t signal, GameState &game) {
+  int32_t value = ClusterFrameDecoder::expectedValue(signal, game);
+  if (signal == LatencySignal_RPM && value > 6900) value = 6900;  // Full scale of the RPM byte
+  if (signal == LatencySignal_RPM && value < 0) value = 0;
+  return value;
+}
+
+int32_t BMWFSeriesFrameDecoder::tolerance(uint8_t signal) {
+  switch (signal) {
+    case LatencySignal_Speed: return 1;
+    case LatencySignal_RPM: return 6900 / 43 / 2 + 1;  // RPM is sent in steps of 160
+    default: return 0;
+  }
+}
+
+bool BMWFSeriesFrameDecoder::checksumMatches(uint8_t len, const uint8_t *buf, uint8_t finalXor) {
+  return len > 1 && crc8Calculator.get_crc8(buf + 1, len - 1, finalXor) == buf[0];
+}
+
+// ####################################################################################################################
+// VW MQB
+
+void VWMQBFrameDecoder::decode(uint32_t id, uint8_t len, const uint8_t *buf, DecodedFrame &frame) {
+  const unsigned char *kennung = dataId(id);
+  if (kennung != nullptr && len > 2) {
+    uint8_t crc = buf[1] ^ 0xFF;
+    for (uint8_t i = 2; i < len; i++) {
+      crc = P_L_CC_CRC_LUT_APV[crc] ^ buf[i];
+    }
+    crc = P_L_CC_CRC_LUT_APV[crc] ^ kennung[buf[1] & 0x0F];
+    crc = ~P_L_CC_CRC_LUT_APV[crc];
+
+    frame.checksumPresent = true;
+    frame.checksumValid = crc == buf[0];
+  }
+
+  if (kennung != nullptr || id == 0x366) {
+    frame.counterPresent = true;
+    frame.counter = buf[1] & 0x0F;
+    frame.counterModulo = 16;
+    // Sent every 500 ms with the counter of the 50 ms frames
+    if (id == 0x3D5) frame.counterStep = 0;
+  }
+
+  switch (id) {
+    case 0x0FD:
+      // Speed * 98.5
+      SIGNAL_VALUE(frame, LatencySignal_Speed, (buf[4] | buf[5] << 8) * 2L / 197);
+      break;
+    case 0x107:
+      SIGNAL_VALUE(frame, LatencySignal_RPM, (buf[3] | buf[4] << 8) * 3);
+      break;
+    case 0x394:
+      switch (buf[1] & 0xF0) {
+        case 0x60: if (buf[3] >= 1 && buf[3] <= 9) SIGNAL_VALUE(frame, LatencySignal_Gear, GearState_Manual_1 + buf[3] - 1); break;
+        case 0x10: SIGNAL_VALUE(frame, LatencySignal_Gear, GearState_Auto_P); break;
+        case 0x20: SIGNAL_VALUE(frame, LatencySignal_Gear, GearState_Auto_R); break;
+        case 0x30: SIGNAL_VALUE(frame, LatencySignal_Gear, GearState_Auto_N); break;
+        case 0x40: SIGNAL_VALUE(frame, LatencySignal_Gear, GearState_Auto_D); break;
+      }
+      break;
+  }
+  // Blinkmodi 02 only says that a blinker is on, the cluster blinks the lamps itself
+}
+
+int32_t VWMQBFrameDecoder::tolerance(uint8_t signal) {
+  switch (signal) {
+    case LatencySignal_Speed: return 1;
+    case LatencySignal_RPM: return 3;
+    default: return 0;
+  }
+}
+
+const unsigned char* VWMQBFrameDecoder::dataId(uint32_t id) {
+  switch (id) {
+    case 0x3C0: return P_L_CC_KENNUNG_APV_KlemmenStatus01;
+    case 0x65D: return P_L_CC_KENNUNG_APV_ESP20;
+    case 0x0FD: return P_L_CC_KENNUNG_APV_ESP21;
+    case 0x31E: return P_L_CC_KENNUNG_APV_TSK07;
+    case 0x32A: return P_L_CC_KENNUNG_APV_LH_EPS01;
+    case 0x641: return P_L_CC_KENNUNG_APV_MCODE01;
+    case 0x31B: return P_L_CC_KENNUNG_APV_ESP24;
+    case 0x394: return P_L_CC_KENNUNG_APV_WBA03;
+    case 0x040: return P_L_CC_KENNUNG_APV_AIRBAG01;
+    case 0x30F: return P_L_CC_KENNUNG_APV_SWA01;
+    case 0x3D5: return P_L_CC_KENNUNG_APV_LICHT_ANF;
+    default: return nullptr;
+  }
+}
+
+// ####################################################################################################################
+// Mercedes W204 and W221
+
+void MercedesW204FrameDecoder::decode(uint32_t id, uint8_t len, const uint8_t *buf, DecodedFrame &frame) {
+  int32_t indicators;
+
+  switch (id) {
+    case 0x203: {
+      // Only the top bits of speed / 0.0072 are sent, 14.7456 km/h per step. Decodes to the middle of the step.
+      SIGNAL_VALUE(frame, LatencySignal_Speed, ((2 * buf[0] + 1) * 147456L + 10000) / 20000);
+      break;
+    }
+    case 0x105: {
+      // Byte 0 is (high byte of RPM * 3.84) * 0.27, so one step covers 3 or 4 high byte values. Decodes to the middle.
+      int32_t lowest = (buf[0] * 100 + 26) / 27;
+      int32_t highest = ((buf[0] + 1) * 100 + 26) / 27 - 1;
+      SIGNAL_VALUE(frame, LatencySignal_RPM, (lowest + highest + 1) * 100 / 3);
+      break;
+    }
+    case 0x0F3:
+      if (buf[0] >= 1 && buf[0] <= 7) SIGNAL_VALUE(frame, LatencySignal_Gear, GearState_Manual_1 + buf[0] - 1);
+      if (buf[0] == 0x50) SIGNAL_VALUE(frame, LatencySignal_Gear, GearState_Auto_P);
+      if (buf[0] == 0x52) SIGNAL_VALUE(frame, LatencySignal_Gear, GearState_Auto_R);
+      if (buf[0] == 0x4E) SIGNAL_VALUE(frame, LatencySignal_Gear, GearState_Auto_N);
+      if (buf[0] == 0x44) SIGNAL_VALUE(frame, LatencySignal_Gear, GearState_Auto_D);
+      break;
+  }
+
+  if (id == 0x0F3 || id == 0x2F3 || id == 0x2F5) {
+    frame.counterPresent = true;
+    frame.counter = buf[7];
+    frame.counterModulo = 254;
+  }
+
+  if (decodeIndicators(id, buf, indicators)) SIGNAL_VALUE(frame, LatencySignal_Indicators, indicators);
+}
+
+int32_t MercedesW204FrameDecoder::expectedValue(uint8_t signal, GameState &game) {
+  // Manual gears above 7 are shown as D
+  if (signal == LatencySignal_Gear && game.gear >= GearState_Manual_8 && game.gear <= GearState_Manual_9) return GearState_Auto_D;
+  return ClusterFrameDecoder::expectedValue(signal, game);
+}
+
+int32_t MercedesW204FrameDecoder::tolerance(uint8_t signal) {
+  switch (signal) {
+    case LatencySignal_Speed: return 8;
+    case LatencySignal_RPM: return 134;
+    default: return 0;
+  }
+}
+
+bool MercedesW204FrameDecoder::decodeIndicators(uint32_t id, const uint8_t *buf, int32_t &indicators) {
+  if (id != 0x029) return false;
+  indicators = buf[2] & 0x03;
+  return true;
+}
+
+bool MercedesW221FrameDecoder::decodeIndicators(uint32_t id, const uint8_t *buf, int32_t &indicators) {
+  if (id != 0x029) return false;
+
+  switch (buf[0]) {
+    case 0: indicators = 0; return true;
+    case 100: indicators = 1; return true;
+    case 150: indicators = 2; return true;
+    case 250: indicators = 3; return true;
+    default: return false;
+  }
+}
+
+#undef SIGNAL_VALUE
@@ -0,0 +1,59 @@
+// ####################################################################################################################
+//
+// Code part of CarCluster project by Andrej Rolih. See .ino file more details
+//
+// ####################################################################################################################
+
+#ifndef CLUSTER_FRAME_DECODERS
+#define CLUSTER_FRAME_DECODERS
+
+#include <stdint.h>
+
+#include "../Other/FrameValidator.h"
+#include "BMW_F/CRC8.h"
+
+// Decoders for the frame validator, the reverse of what the clusters encode in updateWithGame(). They have to be kept
+// in sync with the clusters. Clusters without a decoder only get the schedule (period) checks.
+
+// BMW F series (CLUSTER 1, 2): CRC8 with a final XOR per ID in byte 0, 4 bit counter (0-13) in byte 1
+class BMWFSeriesFrameDecoder: public ClusterFrameDecoder {
+  public:
+    BMWFSeriesFrameDecoder();
+    void decode(uint32_t id, uint8_t len, const uint8_t *buf, DecodedFrame &frame) override;
+    int32_t expectedValue(uint8_t signal, GameState &game) override;
+    int32_t tolerance(uint8_t signal) override;
+
+  private:
+    CRC8 crc8Calculator;
+
+    bool checksumMatches(uint8_t len, const uint8_t *buf, uint8_t finalXor);
+};
+
+// VW MQB (CLUSTER 3, 99): AUTOSAR E2E profile 2 checksum in byte 0, 4 bit counter in byte 1
+class VWMQBFrameDecoder: public ClusterFrameDecoder {
+  public:
+    void decode(uint32_t id, uint8_t len, const uint8_t *buf, DecodedFrame &frame) override;
+    int32_t tolerance(uint8_t signal) override;
+
+  private:
+    const unsigned char* dataId(uint32_t id);
+};
+
+// Mercedes W204 (CLUSTER 8): no checksums, 8 bit counter (0-253) in byte 7 of the transmission frames
+class MercedesW204FrameDecoder: public ClusterFrameDecoder {
+  public:
+    void decode(uint32_t id, uint8_t len, const uint8_t *buf, DecodedFrame &frame) override;
+    int32_t expectedValue(uint8_t signal, GameState &game) override;
+    int32_t tolerance(uint8_t signal) override;
+
+  protected:
+    virtual bool decodeIndicators(uint32_t id, const uint8_t *buf, int32_t &indicators);
+};
+
+// Mercedes W221 (CLUSTER 9): same as the W204, blinkers are encoded differently
+class MercedesW221FrameDecoder: public MercedesW204FrameDecoder {
+  protected:
+    bool decodeIndicators(uint32_t id, const uint8_t *buf, int32_t &indicators) override;
+};
+
+#endif
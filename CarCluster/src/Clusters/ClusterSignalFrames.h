@@ -0,0 +1,79 @@
+// ####################################################################################################################
+//
+// Code part of CarCluster project by Andrej Rolih. See .ino file more details
+//
+// ####################################################################################################################
+
+#ifndef CLUSTER_SIGNAL_FRAMES
+#define CLUSTER_SIGNAL_FRAMES
+
+#include "../Other/SignalLatency.h"
+
+// CAN frames that carry the traced signals for each cluster, used by LatencyTracer to find the first frame that has a
+// new value and by Tools/latency.cpp. Has to be kept in sync with updateWithGame() of the clusters (and with
+// ClusterBusSchedules.h, which has the periods). A signal can be in more than one frame, the first one sent counts.
+
+#define LATENCY_SPEED (1 << LatencySignal_Speed)
+#define LATENCY_RPM (1 << LatencySignal_RPM)
+#define LATENCY_GEAR (1 << LatencySignal_Gear)
+#define LATENCY_INDICATORS (1 << LatencySignal_Indicators)
+
+// BMW F series (CLUSTER 1, 2). Manual gears are sent with the RPM.
+constexpr SignalFrame bmwFSeriesSignalFrames[] = {
+  { 0x1A1, LATENCY_SPEED },
+  { 0x0F3, LATENCY_RPM | LATENCY_GEAR },
+  { 0x3FD, LATENCY_GEAR },
+  { 0x1F6, LATENCY_INDICATORS }
+};
+
+// VW MQB (CLUSTER 3)
+constexpr SignalFrame vwMQBSignalFrames[] = {
+  { 0x0FD, LATENCY_SPEED },                // ESP 21
+  { 0x107, LATENCY_RPM },                  // Motor 04
+  { 0x394, LATENCY_GEAR },                 // WBA 03
+  { 0x366, LATENCY_INDICATORS }            // Blinkmodi 02
+};
+
+// VW MQB passthrough (CLUSTER 99), blinkers come from the car
+constexpr SignalFrame vwMQBPassthroughSignalFrames[] = {
+  { 0x0FD, LATENCY_SPEED },
+  { 0x107, LATENCY_RPM },
+  { 0x394, LATENCY_GEAR }
+};
+
+// VW PQ25 and PQ46 (CLUSTER 4, 5)
+constexpr SignalFrame vwPQSignalFrames[] = {
+  { 0x5A0, LATENCY_SPEED },
+  { 0x280, LATENCY_RPM },
+  { 0x540, LATENCY_GEAR },
+  { 0x470, LATENCY_INDICATORS }
+};
+
+// BMW E60/E90 (CLUSTER 6)
+constexpr SignalFrame bmwESeriesSignalFrames[] = {
+  { 0x1A6, LATENCY_SPEED },
+  { 0x0AA, LATENCY_RPM },
+  { 0x1D2, LATENCY_GEAR },
+  { 0x1F6, LATENCY_INDICATORS }
+};
+
+// BMW E46 (CLUSTER 7). Speed is a pulse output and the blinkers are on K-bus, neither is traced.
+constexpr SignalFrame bmwE46SignalFrames[] = {
+  { 0x316, LATENCY_RPM },                  // DME1
+  { 0x43F, LATENCY_GEAR }                  // EGS1
+};
+
+// Mercedes W204 and W221 (CLUSTER 8, 9). The W204 has the blinkers on CAN2, IDs do not overlap between the buses.
+constexpr SignalFrame mercedesSignalFrames[] = {
+  { 0x203, LATENCY_SPEED },
+  { 0x105, LATENCY_RPM },
+  { 0x0F3, LATENCY_GEAR },
+  { 0x029, LATENCY_INDICATORS }
+};
+
+#undef LATENCY_SPEED
+#undef LATENCY_RPM
+#undef LATENCY_GEAR
+#undef LATENCY_INDICATORS
+
+#endif
@@ -31,31 +31,11 @@ uint8_t MercedesW204Cluster::mapGenericGearToLocalGear(GearState inputGear) {
   }
 }
 
-int MercedesW204Cluster::mapSpeed(GameState& game) {
-  int scaledSpeed = game.speed * game.configuration.speedCorrectionFactor;
-  if (scaledSpeed > game.configuration.maximumSpeedValue) {
-    return game.configuration.maximumSpeedValue;
-  } else {
-    return scaledSpeed;
-  }
-}
-
-int MercedesW204Cluster::mapRPM(GameState& game) {
-  int scaledRPM = game.rpm * game.configuration.speedCorrectionFactor;
-  if (scaledRPM > game.configuration.maximumRPMValue) {
-    return game.configuration.maximumRPMValue;
-  } else {
-    return scaledRPM;
+void MercedesW204Cluster::updateWithGame(GameState& game) {
+  if (buttonEvents.update(game)) {
+    sendSteeringWheelControls(buttonEvents.activeButton());
   }
-}
-
-int MercedesW204Cluster::mapCoolantTemperature(GameState& game) {
-  if (game.coolantTemperature < game.configuration.minimumCoolantTemperature) { return game.configuration.minimumCoolantTemperature; }
-  if (game.coolantTemperature > game.configuration.maximumCoolantTemperature) { return game.configuration.maximumCoolantTemperature; }
-  return game.coolantTemperature;
-}
 
-void MercedesW204Cluster::updateWithGame(GameState& game) {
   if (millis() - lastDashboardUpdateTime >= dashboardUpdateTime100) {
     // This should probably be done using a more sophisticated method like a
     // scheduler, but for now this seems to work.
@@ -71,12 +51,7 @@ void MercedesW204Cluster::updateWithGame(GameState& game) {
     sendDoorStatus(game.doorOpen);
     sendOthers();
 
-    if (game.buttonEventToProcess != 0) {
-      sendSteeringWheelControls(game.buttonEventToProcess);
-      game.buttonEventToProcess = 0;
-    } else {
-      sendSteeringWheelControls(0);
-    }
+    sendSteeringWheelControls(buttonEvents.activeButton());
 
     count++;
     if (count >= 254) { count = 0; } // Needs to be reset at 254 not 255
@@ -138,7 +113,7 @@ void MercedesW204Cluster::sendGear(int gear) {
 void MercedesW204Cluster::sendCoolantTemperature(int temperature) {
   // Byte 0: water temp
   // Byte 2: oil temp
-  uint8_t coolantTempScaled = map(temperature, 40, 120, 77, 161);
+  uint8_t coolantTempScaled = coolantGaugeCalibration.apply(temperature);
   unsigned char coolantTempBuffer[] = { coolantTempScaled, 0xf0, 0x96, 0x80, 0x48, 0x1A, 0x8F, 0x09 };
   CAN.sendMsgBuf(0x30d, 0, 8, coolantTempBuffer);
 }
@@ -180,7 +155,7 @@ void MercedesW204Cluster::sendAbs(bool absOn, bool tractionOn) {
 
 void MercedesW204Cluster::sendFuel(int fuelPercentage) {
   // Byte 1 and 3: tank f0_x3 low fuel
-  int fuelScaled = map(fuelPercentage, 0, 100, 240, 0); //240 empty 0 full
+  int fuelScaled = fuelGaugeCalibration.apply(fuelPercentage);
   unsigned char fuelBuffer[] = { fuelScaled, fuelScaled, fuelScaled, 0x00 };
   CAN2.sendMsgBuf(0x321, 0, 4, fuelBuffer);
 }
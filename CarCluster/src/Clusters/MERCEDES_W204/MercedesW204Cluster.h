@@ -7,9 +7,10 @@
 #ifndef W204_DASH
 #define W204_DASH
 
-#include "../../Libs/MultiMap/MultiMap.h" // For fuel level calculation - supports non linear mapping found on BMW clusters ( https://github.com/RobTillaart/MultiMap )
 #include "../../Libs/MCP_CAN/mcp_can.h" // CAN Bus Shield Compatibility Library ( https://github.com/coryjfowler/MCP_CAN_lib )
 
+#include "../../Other/ButtonEventQueue.h"
+#include "../../Other/GaugeCalibration.h"
 #include "../Cluster.h"
 
 #define lo8(x) (uint8_t)((x) & 0xFF)
@@ -34,15 +35,16 @@ class MercedesW204Cluster: public Cluster {
   MCP_CAN &CAN;
   MCP_CAN& CAN2;
 
+  ButtonEventQueue buttonEvents = ButtonEventQueue(200, 100);
+  GaugeCalibration coolantGaugeCalibration = GaugeCalibration(40, 120, 77, 161);
+  GaugeCalibration fuelGaugeCalibration = GaugeCalibration(0, 100, 240, 0); // 240 empty, 0 full
+
   unsigned long dashboardUpdateTime100 = 100;
   unsigned long lastDashboardUpdateTime = 0; // Timer for the fast updated variables
 
   uint8_t count = 0;
 
   uint8_t mapGenericGearToLocalGear(GearState inputGear);
-  int mapSpeed(GameState& game);
-  int mapRPM(GameState& game);
-  int mapCoolantTemperature(GameState& game);
 
   void sendIgnition(bool ignition);
   void sendBasicDriveParameters(int speed, int rpm);
@@ -31,31 +31,11 @@ uint8_t MercedesW221Cluster::mapGenericGearToLocalGear(GearState inputGear) {
   }
 }
 
-int MercedesW221Cluster::mapSpeed(GameState& game) {
-  int scaledSpeed = game.speed * game.configuration.speedCorrectionFactor;
-  if (scaledSpeed > game.configuration.maximumSpeedValue) {
-    return game.configuration.maximumSpeedValue;
-  } else {
-    return scaledSpeed;
-  }
-}
-
-int MercedesW221Cluster::mapRPM(GameState& game) {
-  int scaledRPM = game.rpm * game.configuration.speedCorrectionFactor;
-  if (scaledRPM > game.configuration.maximumRPMValue) {
-    return game.configuration.maximumRPMValue;
-  } else {
-    return scaledRPM;
+void MercedesW221Cluster::updateWithGame(GameState& game) {
+  if (buttonEvents.update(game)) {
+    sendSteeringWheelControls(buttonEvents.activeButton());
   }
-}
 
-int MercedesW221Cluster::mapCoolantTemperature(GameState& game) {
-  if (game.coolantTemperature < game.configuration.minimumCoolantTemperature) { return game.configuration.minimumCoolantTemperature; }
-  if (game.coolantTemperature > game.configuration.maximumCoolantTemperature) { return game.configuration.maximumCoolantTemperature; }
-  return game.coolantTemperature;
-}
-
-void MercedesW221Cluster::updateWithGame(GameState& game) {
   if (millis() - lastDashboardUpdateTime >= dashboardUpdateTime100) {
     // This should probably be done using a more sophisticated method like a
     // scheduler, but for now this seems to work.
@@ -71,12 +51,7 @@ void MercedesW221Cluster::updateWithGame(GameState& game) {
     sendParkingBrake(game.handbrake);
     sendOthers();
 
-    if (game.buttonEventToProcess != 0) {
-      sendSteeringWheelControls(game.buttonEventToProcess);
-      game.buttonEventToProcess = 0;
-    } else {
-      sendSteeringWheelControls(0);
-    }
+    sendSteeringWheelControls(buttonEvents.activeButton());
 
     count++;
     if (count >= 254) { count = 0; } // Needs to be reset at 254 not 255
@@ -138,7 +113,7 @@ void MercedesW221Cluster::sendGear(int gear) {
 void MercedesW221Cluster::sendCoolantTemperature(int temperature) {
   // Byte 0: water temp
   // Byte 2: oil temp
-  uint8_t coolantTempScaled = map(temperature, 40, 120, 77, 161);
+  uint8_t coolantTempScaled = coolantGaugeCalibration.apply(temperature);
   unsigned char coolantTempBuffer[] = { coolantTempScaled, 0xf0, 0x96, 0x80, 0x48, 0x1A, 0x8F, 0x09 }; // TODO: Check if 0 should be sent instead
   CAN.sendMsgBuf(0x30d, 0, 8, coolantTempBuffer);
 }
@@ -164,15 +139,8 @@ void MercedesW221Cluster::sendAbs(bool absOn, bool tractionOn) {
 }
 
 void MercedesW221Cluster::sendFuel(int fuelPercentage) {
-  int fuela = 0;
-  int fuelb = 0;
-  if(fuelPercentage > 40) {
-    fuela = 0;
-    fuelb = 210-(fuelPercentage-40)*3.166; 
-  } else {
-    fuelb = 210;
-    fuela = (fuelPercentage-40)*-5.25;
-  }
+  int fuela = fuelGaugeCalibrationA.apply(fuelPercentage);
+  int fuelb = fuelGaugeCalibrationB.apply(fuelPercentage);
   unsigned char fuelBuffer[] = { fuela, fuelb, 0, 0, 0, 0, 0, 0 };
   CAN.sendMsgBuf(0xF8, 0, 8, fuelBuffer);
 }
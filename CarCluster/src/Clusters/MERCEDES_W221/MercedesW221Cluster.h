@@ -7,9 +7,10 @@
 #ifndef W221_DASH
 #define W221_DASH
 
-#include "../../Libs/MultiMap/MultiMap.h" // For fuel level calculation - supports non linear mapping found on BMW clusters ( https://github.com/RobTillaart/MultiMap )
 #include "../../Libs/MCP_CAN/mcp_can.h" // CAN Bus Shield Compatibility Library ( https://github.com/coryjfowler/MCP_CAN_lib )
 
+#include "../../Other/ButtonEventQueue.h"
+#include "../../Other/GaugeCalibration.h"
 #include "../Cluster.h"
 
 #define lo8(x) (uint8_t)((x) & 0xFF)
@@ -33,15 +34,17 @@ class MercedesW221Cluster: public Cluster {
   private:
   MCP_CAN &CAN;
 
+  ButtonEventQueue buttonEvents = ButtonEventQueue(200, 100);
+  GaugeCalibration coolantGaugeCalibration = GaugeCalibration(40, 120, 77, 161);
+  GaugeCalibration fuelGaugeCalibrationA = GaugeCalibration(0, 40, 210, 0); // Lower part of the gauge (0 above 40 %)
+  GaugeCalibration fuelGaugeCalibrationB = GaugeCalibration(40, 100, 210, 20); // Upper part of the gauge (210 below 40 %)
+
   unsigned long dashboardUpdateTime100 = 100;
   unsigned long lastDashboardUpdateTime = 0; // Timer for the fast updated variables
 
   uint8_t count = 0;
 
   uint8_t mapGenericGearToLocalGear(GearState inputGear);
-  int mapSpeed(GameState& game);
-  int mapRPM(GameState& game);
-  int mapCoolantTemperature(GameState& game);
 
   void sendIgnition(bool ignition);
   void sendBasicDriveParameters(int speed, int rpm);
@@ -8,11 +8,7 @@
 #include "MQBCRC.h"
 
 VWMQBCluster::VWMQBCluster(MCP_CAN& CAN, int fuelPotIncPin, int fuelPotDirPin, int fuelPot1CsPin, int fuelPot2CsPin, bool passthroughMode): CAN(CAN) {
-  fuelPot.begin(fuelPotIncPin, fuelPotDirPin, fuelPot1CsPin);
-  fuelPot.setPosition(100, true); // Force the pot to a known value
-
-  fuelPot2.begin(fuelPotIncPin, fuelPotDirPin, fuelPot2CsPin);
-  fuelPot2.setPosition(100, true); // Force the pot to a known value
+  fuelPots.begin(fuelPotIncPin, fuelPotDirPin, fuelPot1CsPin, fuelPot2CsPin); // Pots are homed to a known value from updateWithGame
 
   this->passthroughMode = passthroughMode;
 }
@@ -24,13 +20,13 @@ void VWMQBCluster::setFuel(GameState& game) {
     int pot2Percentage = (percentage < 50) ? percentage : 50;
 
     int desiredPositionPot1 = map(pot1Percentage, 0, 50, game.configuration.minimumFuelPotValue, game.configuration.maximumFuelPotValue);
-    fuelPot.setPosition(desiredPositionPot1, false);
+    fuelPots.setTarget(0, desiredPositionPot1);
   
     int desiredPositionPot2 = map(pot2Percentage, 0, 50, game.configuration.minimumFuelPot2Value, game.configuration.maximumFuelPot2Value);
-    fuelPot2.setPosition(desiredPositionPot2, false);
+    fuelPots.setTarget(1, desiredPositionPot2);
   } else {
     int desiredPosition = map(percentage, 0, 100, game.configuration.minimumFuelPotValue, game.configuration.maximumFuelPotValue);
-    fuelPot.setPosition(desiredPosition, false);
+    fuelPots.setTarget(0, desiredPosition);
   }
 }
 
@@ -56,31 +52,14 @@ uint8_t VWMQBCluster::mapGenericGearToLocalGear(GearState inputGear) {
   }
 }
 
-int VWMQBCluster::mapSpeed(GameState& game) {
-  int scaledSpeed = game.speed * game.configuration.speedCorrectionFactor;
-  if (scaledSpeed > game.configuration.maximumSpeedValue) {
-    return game.configuration.maximumSpeedValue;
-  } else {
-    return scaledSpeed;
-  }
-}
+void VWMQBCluster::updateWithGame(GameState& game) {
+  fuelPots.update();
 
-int VWMQBCluster::mapRPM(GameState& game) {
-  int scaledRPM = game.rpm * game.configuration.speedCorrectionFactor;
-  if (scaledRPM > game.configuration.maximumRPMValue) {
-    return game.configuration.maximumRPMValue;
-  } else {
-    return scaledRPM;
+  if (buttonEvents.update(game)) {
+    int button = buttonEvents.activeButton();
+    sendSteeringWheelControls(button != 0 ? button + 3 : 0);
   }
-}
-
-int VWMQBCluster::mapCoolantTemperature(GameState& game) {
-  if (game.coolantTemperature < game.configuration.minimumCoolantTemperature) { return game.configuration.minimumCoolantTemperature; }
-  if (game.coolantTemperature > game.configuration.maximumCoolantTemperature) { return game.configuration.maximumCoolantTemperature; }
-  return game.coolantTemperature;
-}
 
-void VWMQBCluster::updateWithGame(GameState& game) {
   if (millis() - lastDashboardUpdateTime >= dashboardUpdateTime50) {
     // This should probably be done using a more sophisticated method like a
     // scheduler, but for now this seems to work.
@@ -121,11 +100,6 @@ void VWMQBCluster::updateWithGame(GameState& game) {
     sendDoorStatus(game.doorOpen);
     sendOutdoorTemperature(game.outdoorTemperature);
 
-    if (game.buttonEventToProcess != 0) {
-      sendSteeringWheelControls(game.buttonEventToProcess + 3);
-      game.buttonEventToProcess = 0;
-    }
-
     setFuel(game);
     
     lastDashboardUpdateTime500ms = millis();
@@ -206,6 +180,7 @@ void VWMQBCluster::sendBacklightBrightness(uint8_t brightness) {
 
 void VWMQBCluster::sendSteeringWheelControls(int button) {
   switch (button) {
+    case 0: mfswBuf[0] = 0x00; mfswBuf[2] = 0x00; break; // Released
     case 1: mfswBuf[0] = 0x01; mfswBuf[2] = 0x01; break; // Menu (does nothing)
     case 2: mfswBuf[0] = 0x02; mfswBuf[2] = 0x01; break; // Right (does nothing)
     case 3: mfswBuf[0] = 0x03; mfswBuf[2] = 0x01; break; // Left (does nothing)
@@ -216,10 +191,6 @@ void VWMQBCluster::sendSteeringWheelControls(int button) {
     case 8: mfswBuf[0] = 0x23; mfswBuf[2] = 0x01; break; // View (does nothing)
   }
   CAN.sendMsgBuf(MFSW_ID, 0, 4, mfswBuf);
-  delay(10);
-
-  mfswBuf[0] = 0x00; mfswBuf[2] = 0x00;
-  CAN.sendMsgBuf(MFSW_ID, 0, 4, mfswBuf);
 }
 
 void VWMQBCluster::sendTSK07() {
@@ -291,44 +262,18 @@ void VWMQBCluster::sendMotor(int rpm, int coolantTemperature) {
 
   // CAN.sendMsgBuf(MOTOR_07_ID, 0, 8, motor07Buf); // TODO: REMOVE
 
-  uint8_t mappedVal = map(coolantTemperature, 50, 130, 0x80, 0xED);
+  uint8_t mappedVal = coolantGaugeCalibration.apply(coolantTemperature);
   motor09Buf[0] = mappedVal;
 
   CAN.sendMsgBuf(MOTOR_09_ID, 0, 8, motor09Buf);
 }
 
 void VWMQBCluster::sendESP24() {
-  // Convert vSpeed to mph for calculating distance
-  // this doesn't get sent to the cluster
-  double speed_mph = static_cast<double>(vSpeed) / 100.0 * 0.621371; 
-
-  // Calculate distance increment for 50ms interval in miles
-  // ESP24 is sent every 50ms
-  double time_interval_hours = 0.05 / 3600.0; // Convert 50ms to hours
-  double distance_increment_miles = speed_mph * time_interval_hours;
-
-  // Convert distance increment to the cluster unit
-  // (Approx) 7195 units represents 0.1 miles
-  double distance_increment_units = distance_increment_miles * (7195.0 / 0.1);
-
-  static double accumulated_distance_units = 0;
-  accumulated_distance_units += distance_increment_units;
-
-  // Prepare the distance value for CAN
-  uint16_t distance_for_cluster = static_cast<uint16_t>(accumulated_distance_units); 
+  // Distance counter, wraps at 30000 (if you leave this uncapped, the TCS-off light will come on)
+  uint16_t distance_for_cluster = esp24Distance.update(vSpeed);
   esp24Buf[5] = distance_for_cluster & 0xFF; 
   esp24Buf[6] = (distance_for_cluster >> 8) & 0xFF; 
 
-  // Stop the odometer from counting indefinitely
-  if (vSpeed == 0) {
-    accumulated_distance_units = 0;
-  }
-
-  // If you leave this uncapped, the TCS-off light will come on
-  if (accumulated_distance_units >= 30000) {
-    accumulated_distance_units = 0; 
-  }
-
   // Calculate and update esp24Speed
   unsigned long esp24Speed = vSpeed * 1.35; 
   esp24Buf[2] = esp24Speed % 256; 
@@ -432,14 +377,8 @@ void VWMQBCluster::sendBlinkers(boolean leftTurningIndicator, boolean rightTurni
 
   // TODO: Figure out CRC if present/needed?
   uint8_t temp_turning_lights = 0 | (leftTurningIndicator ? 0xA : 0) | (rightTurningIndicator ? 0x14 : 0);
-  if (turningIndicatorsBlinking == true) {
-    turning_lights_counter = turning_lights_counter + 1;
-    if (turning_lights_counter <= 8) {
-    } else if (turning_lights_counter > 8 && turning_lights_counter < 16) {
-      temp_turning_lights = 0;
-    } else {
-      turning_lights_counter = 0;
-    }
+  if (!blinker.lampOn(leftTurningIndicator, rightTurningIndicator, turningIndicatorsBlinking)) {
+    temp_turning_lights = 0;
   }
 
   blinkerBuff[1] = seq;
@@ -8,8 +8,11 @@
 #define MQB_DASH
 
 #include "../../Libs/MCP_CAN/mcp_can.h" // CAN Bus Shield Compatibility Library ( https://github.com/coryjfowler/MCP_CAN_lib )
-#include "../../Libs/X9C10X/X9C10X.h" // For fuel level simulation ( https://github.com/RobTillaart/X9C10X )
+#include "../../Other/FuelPotDriver.h" // For fuel level simulation using X9C10X digital potentiometers
 
+#include "../../Other/ButtonEventQueue.h"
+#include "../../Other/DistanceIntegrator.h"
+#include "../../Other/GaugeCalibration.h"
 #include "../Cluster.h"
 
 // Known CAN IDs
@@ -78,8 +81,10 @@ class VWMQBCluster: public Cluster {
 
   private:
     MCP_CAN &CAN;
-    X9C102 fuelPot = X9C102();
-    X9C102 fuelPot2 = X9C102();
+    FuelPotDriver fuelPots;
+    DistanceIntegrator esp24Distance = DistanceIntegrator(44708, DistanceIntegrator::msPerHour * 100, 30000); // (Approx) 7195 units per 0.1 mile, speed in 0.01 km/h
+    GaugeCalibration coolantGaugeCalibration = GaugeCalibration(50, 130, 0x80, 0xED);
+    ButtonEventQueue buttonEvents = ButtonEventQueue(100, 100, 300); // MFSW is only sent on changes, so held buttons are auto-repeated
 
     // For passthrough mode
     bool passthroughMode = false;
@@ -89,10 +94,8 @@ class VWMQBCluster: public Cluster {
     unsigned long lastDashboardUpdateTime = 0; // Timer for the fast updated variables - like ABS/speed/RPM
     unsigned long lastDashboardUpdateTime500ms = 0; // Timer for slow updated variables - like TPMS
 
-    int turning_lights_counter = 0;
-
     unsigned char i = 0, seq = 0, crc;
-    unsigned long rpmVal, vSpeed, esp24Speed, esp24Inc, esp24Distance = 0, prevTime = 0;
+    unsigned long rpmVal, vSpeed, esp24Speed, esp24Inc, prevTime = 0;
     unsigned char esp24Overflow = 0;
 
     // Buffers
@@ -149,9 +152,6 @@ class VWMQBCluster: public Cluster {
     
     void setFuel(GameState& game);
     uint8_t mapGenericGearToLocalGear(GearState inputGear);
-    int mapSpeed(GameState& game);
-    int mapRPM(GameState& game);
-    int mapCoolantTemperature(GameState& game);
 };
 
 #endif
\ No newline at end of file
@@ -11,11 +11,7 @@
 #define hi8(x) ((int)(x) >> 8)
 
 VWPQ25Cluster::VWPQ25Cluster(MCP_CAN& CAN, int fuelPotIncPin, int fuelPotDirPin, int fuelPot1CsPin, int fuelPot2CsPin, int sprinklerWaterSensor, int coolantShortageSensor, int oilPressureSwitch, int handbrakeIndicator, int brakeFluidWarning): CAN(CAN) {
-  fuelPot.begin(fuelPotIncPin, fuelPotDirPin, fuelPot1CsPin);
-  fuelPot.setPosition(100, true); // Force the pot to a known value
-
-  fuelPot2.begin(fuelPotIncPin, fuelPotDirPin, fuelPot2CsPin);
-  fuelPot2.setPosition(100, true); // Force the pot to a known value
+  fuelPots.begin(fuelPotIncPin, fuelPotDirPin, fuelPot1CsPin, fuelPot2CsPin); // Pots are homed to a known value from updateWithGame
 
   this->sprinklerWaterSensor = sprinklerWaterSensor;
   this->coolantShortageSensor = coolantShortageSensor;
@@ -43,13 +39,13 @@ void VWPQ25Cluster::setFuel(GameState& game) {
     int pot2Percentage = (percentage < 50) ? percentage : 50;
 
     int desiredPositionPot1 = map(pot1Percentage, 0, 50, game.configuration.minimumFuelPotValue, game.configuration.maximumFuelPotValue);
-    fuelPot.setPosition(desiredPositionPot1, false);
+    fuelPots.setTarget(0, desiredPositionPot1);
   
     int desiredPositionPot2 = map(pot2Percentage, 0, 50, game.configuration.minimumFuelPot2Value, game.configuration.maximumFuelPot2Value);
-    fuelPot2.setPosition(desiredPositionPot2, false);
+    fuelPots.setTarget(1, desiredPositionPot2);
   } else {
     int desiredPosition = map(percentage, 0, 100, game.configuration.minimumFuelPotValue, game.configuration.maximumFuelPotValue);
-    fuelPot.setPosition(desiredPosition, false);
+    fuelPots.setTarget(0, desiredPosition);
   }
 }
 
@@ -75,31 +71,10 @@ uint8_t VWPQ25Cluster::mapGenericGearToLocalGear(GearState inputGear) {
   }
 }
 
-int VWPQ25Cluster::mapSpeed(GameState& game) {
-  int scaledSpeed = game.speed * game.configuration.speedCorrectionFactor;
-  if (scaledSpeed > game.configuration.maximumSpeedValue) {
-    return game.configuration.maximumSpeedValue;
-  } else {
-    return scaledSpeed;
-  }
-}
+void VWPQ25Cluster::updateWithGame(GameState& game) {
+  fuelPots.update();
 
-int VWPQ25Cluster::mapRPM(GameState& game) {
-  int scaledRPM = game.rpm * game.configuration.speedCorrectionFactor;
-  if (scaledRPM > game.configuration.maximumRPMValue) {
-    return game.configuration.maximumRPMValue;
-  } else {
-    return scaledRPM;
-  }
-}
-
-int VWPQ25Cluster::mapCoolantTemperature(GameState& game) {
-  if (game.coolantTemperature < game.configuration.minimumCoolantTemperature) { return game.configuration.minimumCoolantTemperature; }
-  if (game.coolantTemperature > game.configuration.maximumCoolantTemperature) { return game.configuration.maximumCoolantTemperature; }
-  return game.coolantTemperature;
-}
-
-void VWPQ25Cluster::updateWithGame(GameState& game) {  if (millis() - lastDashboardUpdateTime >= dashboardUpdateTime50) {
+  if (millis() - lastDashboardUpdateTime >= dashboardUpdateTime50) {
     // This should probably be done using a more sophisticated method like a
     // scheduler, but for now this seems to work.
 
@@ -137,14 +112,8 @@ void VWPQ25Cluster::sendImmobilizer() {
 
 void VWPQ25Cluster::sendIndicators(boolean leftBlinker, boolean rightBlinker, boolean blinkersBlinking, boolean highBeam, boolean frontFogLight, boolean batteryWarning, boolean trunkOpen, boolean doorOpen, int brightness) {
   uint8_t temp_turning_lights = 0 | leftBlinker | (rightBlinker << 1);
-  if (blinkersBlinking == true) {
-    turning_lights_counter = turning_lights_counter + 1;
-    if (turning_lights_counter <= 8) {
-    } else if (turning_lights_counter > 8 && turning_lights_counter < 16) {
-      temp_turning_lights = 0;
-    } else {
-      turning_lights_counter = 0;
-    }
+  if (!blinker.lampOn(leftBlinker, rightBlinker, blinkersBlinking)) {
+    temp_turning_lights = 0;
   }
 
   int temp_battery_warning = batteryWarning ? B10000000 : 0;
@@ -176,14 +145,13 @@ void VWPQ25Cluster::sendRPM(int rpm) {
 
 void VWPQ25Cluster::sendSpeed(int speed, boolean tpmsLight, boolean espLight, boolean absLight) {
   int wheelSpeed = speed * 146;
-  distanceCounter += speed * dashboardUpdateTime50 / 182;
-  if (distanceCounter > 30000) distanceCounter -= 30000;
+  uint16_t distance = distanceCounter.update(speed > 0 ? speed : 0);
 
   speedBuffer[1] = lo8(wheelSpeed);
   speedBuffer[2] = hi8(wheelSpeed);
   speedBuffer[3] = (tpmsLight << 3) | (espLight << 1) | absLight;
-  speedBuffer[5] = (uint8_t)(distanceCounter & 0x00FF);   // Distance low byte
-  speedBuffer[6] = (uint8_t)(distanceCounter >> 8);       // Distance high byte
+  speedBuffer[5] = lo8(distance);   // Distance low byte
+  speedBuffer[6] = hi8(distance);   // Distance high byte
 
   CAN.sendMsgBuf(SPEED_ID, 0, 8, speedBuffer);
 }
@@ -8,8 +8,9 @@
 #define PQ25DASH
 
 #include "../../Libs/MCP_CAN/mcp_can.h" // CAN Bus Shield Compatibility Library ( https://github.com/coryjfowler/MCP_CAN_lib )
-#include "../../Libs/X9C10X/X9C10X.h" // For fuel level simulation ( https://github.com/RobTillaart/X9C10X )
+#include "../../Other/FuelPotDriver.h" // For fuel level simulation using X9C10X digital potentiometers
 
+#include "../../Other/DistanceIntegrator.h"
 #include "../Cluster.h"
 
 // Known CAN IDs
@@ -45,8 +46,7 @@ class VWPQ25Cluster: public Cluster {
 
   private:
     MCP_CAN &CAN;
-    X9C102 fuelPot = X9C102();
-    X9C102 fuelPot2 = X9C102();
+    FuelPotDriver fuelPots;
 
     int sprinklerWaterSensor;
     int coolantShortageSensor;
@@ -59,9 +59,8 @@ class VWPQ25Cluster: public Cluster {
     unsigned long lastDashboardUpdateTime = 0; // Timer for the fast updated variables - like ABS/speed/RPM
     unsigned long lastDashboardUpdateTime500ms = 0; // Timer for slow updated variables
 
-    int turning_lights_counter = 0;
     unsigned char seq = 0;
-    int distanceCounter = 0;
+    DistanceIntegrator distanceCounter = DistanceIntegrator(1, 182, 30000); // About 19780 units per km
 
     // Buffers
     unsigned char immobilizerBuffer[8] = { 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
@@ -87,9 +86,6 @@ class VWPQ25Cluster: public Cluster {
 
     void setFuel(GameState& game);
     uint8_t mapGenericGearToLocalGear(GearState inputGear);
-    int mapSpeed(GameState& game);
-    int mapRPM(GameState& game);
-    int mapCoolantTemperature(GameState& game);
 };
 
 #endif
\ No newline at end of file
@@ -18,6 +18,8 @@ void BeamNGGame::begin() {
     beamUdp.onPacket([this](AsyncUDPPacket packet) {
       if (packet.length() >= 64) {
         char dataBuff[4];  // four bytes
+        gameState.telemetryArrivalTime = micros();
+        packets.increment();
 
         // GEAR
         memcpy(dataBuff, (packet.data() + 10), 1);
@@ -57,6 +59,8 @@ void BeamNGGame::begin() {
         gameState.absLight = ((lights & 0x0400) != 0);
         gameState.handbrake = ((lights & 0x0004) != 0);
         gameState.offroadLight = ((lights & 0x0010) != 0);
+      } else {
+        decodeErrors.increment();
       }
     });
   }
@@ -0,0 +1,56 @@
+// ####################################################################################################################
+// 
+// Code part of CarCluster project by Andrej Rolih. See .ino file more details
+// 
+// ####################################################################################################################
+
+#include "FanoutGame.h"
+
+FanoutGame::FanoutGame(GameState& game, IPAddress multicastAddress, int port): Game(game) {
+  this->multicastAddress = multicastAddress;
+  this->port = port;
+}
+
+void FanoutGame::begin() {
+  if (fanoutUdp.listenMulticast(multicastAddress, port)) {
+    fanoutUdp.onPacket([this](AsyncUDPPacket packet) {
+      handlePacket(packet.data(), packet.length());
+    });
+  }
+}
+
+void FanoutGame::handlePacket(const uint8_t *data, size_t length) {
+  if (length < headerSize || data[0] != 'C' || data[1] != 'F' || data[2] != protocolVersion) {
+    invalid++;
+    decodeErrors.increment();
+    return;
+  }
+
+  uint32_t sequence = data[4] | (data[5] << 8) | (data[6] << 16) | ((uint32_t)data[7] << 24);
+
+  // Signed difference handles wrap around of the sequence number
+  int32_t difference = (int32_t)(sequence - lastSequence);
+  if (hasSequence && difference <= 0) {
+    // Duplicate or older than what we already applied
+    outOfOrder++;
+    return;
+  }
+
+  // Packets in between are only counted lost once this one is applied, a broken packet does not move the sequence
+  GameStateSnapshot snapshot;
+  if (snapshot.decode(data + headerSize, length - headerSize) == 0) {
+    invalid++;
+    decodeErrors.increment();
+    return;
+  }
+
+  if (hasSequence) lost += difference - 1;
+  hasSequence = true;
+  lastSequence = sequence;
+  received++;
+  gameState.telemetryArrivalTime = micros();
+  packets.increment();
+
+  snapshot.applyTo(gameState);
+  gameState.pushButtonEvent(snapshot.buttonEvent, snapshot.buttonHoldDuration);
+}
@@ -0,0 +1,49 @@
+// ####################################################################################################################
+// 
+// Code part of CarCluster project by Andrej Rolih. See .ino file more details
+// 
+// ####################################################################################################################
+
+#ifndef FANOUT_GAME
+#define FANOUT_GAME
+
+#include "Arduino.h"
+#include "AsyncUDP.h" // For game integration (system library part of ESP core)
+
+#include "GameSimulation.h"
+#include "GameStateSnapshot.h"
+
+// Follower side of the telemetry fan-out. Receives game state re-published by another CarCluster (see FanoutPublisher).
+//
+// Packet format: "CF", protocol version, reserved byte, uint32 sequence number (little endian),
+// followed by a GameStateSnapshot encoded with all the fields.
+class FanoutGame: public Game {
+  public:
+    static const uint8_t protocolVersion = 2;   // 2: button hold duration
+    static const size_t headerSize = 8;
+    static const size_t packetSize = headerSize + GameStateSnapshot::maximumEncodedSize;
+
+    FanoutGame(GameState& game, IPAddress multicastAddress, int port);
+    void begin();
+
+    unsigned long receivedPackets() { return received; }
+    unsigned long lostPackets() { return lost; }
+    unsigned long outOfOrderPackets() { return outOfOrder; }
+    unsigned long invalidPackets() { return invalid; }
+
+  private:
+    IPAddress multicastAddress;
+    int port;
+    AsyncUDP fanoutUdp;
+
+    bool hasSequence = false;
+    uint32_t lastSequence = 0;
+    volatile unsigned long received = 0;
+    volatile unsigned long lost = 0;
+    volatile unsigned long outOfOrder = 0;
+    volatile unsigned long invalid = 0;
+
+    void handlePacket(const uint8_t *data, size_t length);
+};
+
+#endif
@@ -20,6 +20,8 @@ void ForzaHorizonGame::begin() {
       if (packet.length() == 324 || packet.length() == 331) {
         char dataBuff[4];  // four bytes in a float 32
         bool isFM2023Format = packet.length() == 331;
+        gameState.telemetryArrivalTime = micros();
+        packets.increment();
 
         // CURRENT_ENGINE_RPM
         memcpy(dataBuff, (packet.data() + 16), 4);
@@ -71,6 +73,8 @@ void ForzaHorizonGame::begin() {
         memcpy(dataBuff, (packet.data() + 318), 1);
         int handbrake = (int)(dataBuff[0]);
         gameState.handbrake = handbrake > 0 ? true : false;
+      } else {
+        decodeErrors.increment();
       }
     });
   }
@@ -7,7 +7,11 @@
 #ifndef GAME_SIMULATION
 #define GAME_SIMULATION
 
-#include "Arduino.h"
+#include <stdint.h>
+#include <math.h>
+
+#include "../Other/GaugeCalibration.h"
+#include "../Other/MetricCounter.h"
 
 struct ClusterConfiguration {
   float speedCorrectionFactor = 1.00;   // Calibration of speed gauge
@@ -22,6 +26,22 @@ struct ClusterConfiguration {
   int maximumFuelPot2Value = 75;        // Calibration of fuel pot 2 - maximum value
   int isDualFuelPot = false;
 
+  // Gauge curves used by the clusters, built from the values above by updateCalibrations() and editable at runtime
+  GaugeCalibration speedCalibration;
+  GaugeCalibration rpmCalibration;
+  GaugeCalibration coolantCalibration;
+
+  ClusterConfiguration() {
+    updateCalibrations();
+  }
+
+  void updateCalibrations() {
+    // Correction factor scales the gauge, the maximum value is reached at maximum / factor
+    speedCalibration = GaugeCalibration(0, lround(maximumSpeedValue / speedCorrectionFactor), 0, maximumSpeedValue);
+    rpmCalibration = GaugeCalibration(0, lround(maximumRPMValue / rpmCorrectionFactor), 0, maximumRPMValue);
+    coolantCalibration = GaugeCalibration(minimumCoolantTemperature, maximumCoolantTemperature, minimumCoolantTemperature, maximumCoolantTemperature);
+  }
+
   static ClusterConfiguration updatedFromDefaults(ClusterConfiguration current, float speedCorrectionFactor, float rpmCorrectionFactor, int maximumRPMValue, int maximumSpeedValue, int minimumCoolantTemperature, int maximumCoolantTemperature, int minimumFuelPotValue, int maximumFuelPotValue, int minimumFuelPot2Value, int maximumFuelPot2Value) {
     ClusterConfiguration newConfiguration;
 
@@ -77,6 +97,7 @@ struct ClusterConfiguration {
     }
 
     newConfiguration.isDualFuelPot = current.isDualFuelPot;
+    newConfiguration.updateCalibrations();
 
     return newConfiguration;
   }
@@ -100,6 +121,11 @@ enum GearState {
   GearState_Auto_S = 15
 };
 
+struct ButtonEvent {
+  int button;                                        // Cluster dependent, 0 = no button
+  unsigned long holdDuration;                        // How long to hold the button in ms (0 = short press)
+};
+
 class GameState {
   public:
   // Configuration
@@ -130,21 +156,51 @@ class GameState {
   bool absLight = false;                             // Shows ABS Signal on dashboard
   bool batteryLight = false;                         // Show Battery Warning.
 
+  // Steering wheel buttons. Certain clusters have buttons that can perform actions - values are cluster dependent.
+  // Every source pushes its presses and every consumer (the cluster, the fan-out publisher, the recorder) reads all of
+  // them with its own position, so a press that comes before the cluster took the previous one is not lost.
+  static const uint8_t buttonEventCapacity = 8;
+  ButtonEvent buttonEvents[buttonEventCapacity];     // The last presses, see pushButtonEvent()
+  volatile uint32_t buttonEventCount = 0;            // Presses pushed so far
+
   // Other stuff
-  int buttonEventToProcess = 0;                      // Certain clusters have buttons that can perform actions. Set this to activate them - values are cluster dependent
+  uint32_t telemetryArrivalTime = 0;                 // micros() when the last telemetry packet arrived, set before it is applied (used by the latency tracer)
 
   GameState(ClusterConfiguration configuration) {
     this->configuration = configuration;
   }
+
+  void pushButtonEvent(int button, unsigned long holdDuration = 0) {
+    if (button == 0) return;
+    buttonEvents[buttonEventCount % buttonEventCapacity] = { button, holdDuration };
+    buttonEventCount++;
+  }
+
+  // Returns the press at position and moves position on, false if there are no new presses. Start with position 0
+  // (every press since boot) or buttonEventCount (only new ones). Presses that were already overwritten are skipped.
+  bool nextButtonEvent(uint32_t &position, ButtonEvent &event) {
+    uint32_t count = buttonEventCount;
+    if (position == count) return false;
+    if (count - position > buttonEventCapacity) position = count - buttonEventCapacity;
+
+    event = buttonEvents[position % buttonEventCapacity];
+    position++;
+    return true;
+  }
 };
 
 class Game {
   public:
   virtual void begin() = 0;
 
+  uint32_t packetCount() { return packets.value(); }            // Packets applied to the game state
+  uint32_t decodeErrorCount() { return decodeErrors.value(); }  // Packets that were rejected
+
   protected:
   Game(GameState& game): gameState(game) {};
   GameState &gameState;
+  MetricCounter packets;
+  MetricCounter decodeErrors;
 };
 
 #endif
\ No newline at end of file
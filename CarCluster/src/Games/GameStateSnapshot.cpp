@@ -0,0 +1,140 @@
+// ####################################################################################################################
+//
+// Code part of CarCluster project by Andrej Rolih. See .ino file more details
+//
+// ####################################################################################################################
+
+#include "GameStateSnapshot.h"
+
+static const uint8_t fieldSizes[GameStateSnapshot::Field_Count] = { 2, 2, 1, 1, 2, 2, 1, 1, 2, 1, 2 };
+
+GameStateSnapshot GameStateSnapshot::fromGame(GameState& game) {
+  GameStateSnapshot snapshot;
+
+  snapshot.speed = game.speed;
+  snapshot.rpm = game.rpm;
+  snapshot.gear = game.gear;
+  snapshot.backlightBrightness = game.backlightBrightness;
+  snapshot.coolantTemperature = game.coolantTemperature;
+  snapshot.fuelQuantity = game.fuelQuantity;
+  snapshot.outdoorTemperature = game.outdoorTemperature;
+  snapshot.driveMode = game.driveMode;
+  snapshot.flags = (game.ignition << 0) |
+                   (game.leftTurningIndicator << 1) |
+                   (game.rightTurningIndicator << 2) |
+                   (game.turningIndicatorsBlinking << 3) |
+                   (game.mainLights << 4) |
+                   (game.handbrake << 5) |
+                   (game.rearFogLight << 6) |
+                   (game.frontFogLight << 7) |
+                   (game.highBeam << 8) |
+                   (game.doorOpen << 9) |
+                   (game.offroadLight << 10) |
+                   (game.absLight << 11) |
+                   (game.batteryLight << 12);
+
+  return snapshot;
+}
+
+void GameStateSnapshot::setButtonEvent(const ButtonEvent& event) {
+  buttonEvent = event.button;
+  buttonHoldDuration = event.holdDuration < 0xFFFF ? event.holdDuration : 0xFFFF;
+}
+
+void GameStateSnapshot::applyTo(GameState& game) const {
+  game.speed = speed;
+  game.rpm = rpm;
+  game.gear = static_cast<GearState>(gear);
+  game.backlightBrightness = backlightBrightness;
+  game.coolantTemperature = coolantTemperature;
+  game.fuelQuantity = fuelQuantity;
+  game.outdoorTemperature = outdoorTemperature;
+  game.driveMode = driveMode;
+  game.ignition = (flags & (1 << 0)) != 0;
+  game.leftTurningIndicator = (flags & (1 << 1)) != 0;
+  game.rightTurningIndicator = (flags & (1 << 2)) != 0;
+  game.turningIndicatorsBlinking = (flags & (1 << 3)) != 0;
+  game.mainLights = (flags & (1 << 4)) != 0;
+  game.handbrake = (flags & (1 << 5)) != 0;
+  game.rearFogLight = (flags & (1 << 6)) != 0;
+  game.frontFogLight = (flags & (1 << 7)) != 0;
+  game.highBeam = (flags & (1 << 8)) != 0;
+  game.doorOpen = (flags & (1 << 9)) != 0;
+  game.offroadLight = (flags & (1 << 10)) != 0;
+  game.absLight = (flags & (1 << 11)) != 0;
+  game.batteryLight = (flags & (1 << 12)) != 0;
+}
+
+uint16_t GameStateSnapshot::changedFields(const GameStateSnapshot& other) const {
+  uint16_t mask = 0;
+
+  if (speed != other.speed) mask |= 1 << Field_Speed;
+  if (rpm != other.rpm) mask |= 1 << Field_RPM;
+  if (gear != other.gear) mask |= 1 << Field_Gear;
+  if (backlightBrightness != other.backlightBrightness) mask |= 1 << Field_Backlight;
+  if (coolantTemperature != other.coolantTemperature) mask |= 1 << Field_Coolant;
+  if (fuelQuantity != other.fuelQuantity) mask |= 1 << Field_Fuel;
+  if (outdoorTemperature != other.outdoorTemperature) mask |= 1 << Field_OutdoorTemperature;
+  if (driveMode != other.driveMode) mask |= 1 << Field_DriveMode;
+  if (flags != other.flags) mask |= 1 << Field_Flags;
+  if (buttonEvent != other.buttonEvent) mask |= 1 << Field_ButtonEvent;
+  if (buttonHoldDuration != other.buttonHoldDuration) mask |= 1 << Field_ButtonHold;
+
+  return mask;
+}
+
+size_t GameStateSnapshot::encodedSize(uint16_t mask) {
+  size_t size = 2;
+  for (uint8_t i = 0; i < Field_Count; i++) {
+    if (mask & (1 << i)) size += fieldSizes[i];
+  }
+  return size;
+}
+
+size_t GameStateSnapshot::encode(uint16_t mask, uint8_t *out) const {
+  mask &= allFields;
+  uint16_t values[Field_Count] = { (uint16_t)speed, rpm, gear, backlightBrightness, (uint16_t)coolantTemperature, (uint16_t)fuelQuantity, (uint8_t)outdoorTemperature, driveMode, flags, buttonEvent, buttonHoldDuration };
+
+  size_t pos = 0;
+  out[pos++] = mask & 0xFF;
+  out[pos++] = mask >> 8;
+
+  for (uint8_t i = 0; i < Field_Count; i++) {
+    if ((mask & (1 << i)) == 0) continue;
+    out[pos++] = values[i] & 0xFF;
+    if (fieldSizes[i] == 2) out[pos++] = values[i] >> 8;
+  }
+
+  return pos;
+}
+
+size_t GameStateSnapshot::decode(const uint8_t *in, size_t length) {
+  if (length < 2) return 0;
+
+  uint16_t mask = in[0] | (in[1] << 8);
+  if ((mask & ~allFields) != 0 || encodedSize(mask) > length) return 0;
+
+  size_t pos = 2;
+  for (uint8_t i = 0; i < Field_Count; i++) {
+    if ((mask & (1 << i)) == 0) continue;
+
+    uint16_t value = in[pos++];
+    if (fieldSizes[i] == 2) value |= in[pos++] << 8;
+
+    switch (i) {
+      case Field_Speed: speed = (int16_t)value; break;
+      case Field_RPM: rpm = value; break;
+      case Field_Gear: gear = value; break;
+      case Field_Backlight: backlightBrightness = value; break;
+      case Field_Coolant: coolantTemperature = (int16_t)value; break;
+      case Field_Fuel: fuelQuantity = (int16_t)value; break;
+      case Field_OutdoorTemperature: outdoorTemperature = (int8_t)value; break;
+      case Field_DriveMode: driveMode = value; break;
+      case Field_Flags: flags = value; break;
+      case Field_ButtonEvent: buttonEvent = value; break;
+      case Field_ButtonHold: buttonHoldDuration = value; break;
+    }
+  }
+
+  return pos;
+}
@@ -0,0 +1,67 @@
+// ####################################################################################################################
+//
+// Code part of CarCluster project by Andrej Rolih. See .ino file more details
+//
+// ####################################################################################################################
+
+#ifndef GAME_STATE_SNAPSHOT
+#define GAME_STATE_SNAPSHOT
+
+#include "Arduino.h"
+
+#include "GameSimulation.h"
+
+// Compact, fixed size copy of the parts of GameState that games can change.
+// Used for recording/replaying sessions and for sending state to other devices.
+//
+// Encoded form (little endian): uint16 field mask, followed by the fields whose bit is set in the mask (in field order).
+// Field order and sizes: speed (2), rpm (2), gear (1), backlight (1), coolant (2), fuel (2), outdoor temp (1),
+// drive mode (1), indicator flags (2), button event (1), button hold duration (2)
+//
+// Button presses are not part of the game state (see GameState::pushButtonEvent), fromGame() leaves them at 0 and the
+// fan-out publisher and the recorder put one press at a time in the snapshot.
+struct GameStateSnapshot {
+  enum Field {
+    Field_Speed = 0,
+    Field_RPM,
+    Field_Gear,
+    Field_Backlight,
+    Field_Coolant,
+    Field_Fuel,
+    Field_OutdoorTemperature,
+    Field_DriveMode,
+    Field_Flags,
+    Field_ButtonEvent,
+    Field_ButtonHold,
+    Field_Count
+  };
+
+  static const uint16_t allFields = (1 << Field_Count) - 1;
+  static const size_t maximumEncodedSize = 2 + 17;
+
+  int16_t speed = 0;
+  uint16_t rpm = 0;
+  uint8_t gear = GearState_Auto_P;
+  uint8_t backlightBrightness = 0;
+  int16_t coolantTemperature = 0;
+  int16_t fuelQuantity = 0;
+  int8_t outdoorTemperature = 0;
+  uint8_t driveMode = 0;
+  uint16_t flags = 0;                                // Indicators and lights, see flagsFromGame()
+  uint8_t buttonEvent = 0;
+  uint16_t buttonHoldDuration = 0;                   // ms
+
+  static GameStateSnapshot fromGame(GameState& game);
+  void setButtonEvent(const ButtonEvent& event);
+
+  // Copies everything except the button press (that one is a one shot event and must be pushed only once)
+  void applyTo(GameState& game) const;
+
+  uint16_t changedFields(const GameStateSnapshot& other) const;
+  size_t encode(uint16_t mask, uint8_t *out) const;
+  size_t decode(const uint8_t *in, size_t length);   // Returns number of bytes consumed or 0 if data is incomplete
+
+  static size_t encodedSize(uint16_t mask);
+};
+
+#endif
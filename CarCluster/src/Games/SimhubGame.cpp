@@ -12,11 +12,19 @@ SimhubGame::SimhubGame(GameState& game): Game(game) {
 void SimhubGame::begin() {
 }
 
-void SimhubGame::decodeSerialData(JsonDocument& doc) {
+void SimhubGame::decodeSerialData(JsonDocument& doc, uint32_t arrivalTime) {
+  const char* simGear = doc["gea"];
+  if (simGear == nullptr) {
+    // Not the Simhub custom protocol (every packet has the gear)
+    decodeErrors.increment();
+    return;
+  }
+
+  gameState.telemetryArrivalTime = arrivalTime;
+  packets.increment();
   gameState.rpm = doc["rpm"];
   int max_rpm = doc["mrp"];
 
-  const char* simGear = doc["gea"];
   switch(simGear[0]) {
     case '1': gameState.gear = GearState_Manual_1; break;
     case '2': gameState.gear = GearState_Manual_2; break;
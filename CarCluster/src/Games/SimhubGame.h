@@ -16,7 +16,7 @@ class SimhubGame: public Game {
   public:
     SimhubGame(GameState& game);
     void begin();
-    void decodeSerialData(JsonDocument& doc);
+    void decodeSerialData(JsonDocument& doc, uint32_t arrivalTime);  // arrivalTime: micros() when the line started coming in
 };
 
 #endif
\ No newline at end of file
@@ -1147,8 +1147,12 @@ INT8U MCP_CAN::sendMsgBuf(INT32U id, INT8U ext, INT8U len, INT8U *buf)
 {
     INT8U res;
 	
+    if (sendGate != nullptr && !sendGate(sendGateContext))
+        return CAN_FAILTX;
+
     setMsg(id, 0, ext, len, buf);
     res = sendMsg();
+    notifyFrameHook(MCP_FRAME_TX, res);
     
     return res;
 }
@@ -1162,6 +1166,9 @@ INT8U MCP_CAN::sendMsgBuf(INT32U id, INT8U len, INT8U *buf)
     INT8U ext = 0, rtr = 0;
     INT8U res;
     
+    if (sendGate != nullptr && !sendGate(sendGateContext))
+        return CAN_FAILTX;
+
     if((id & 0x80000000) == 0x80000000)
         ext = 1;
  
@@ -1170,6 +1177,7 @@ INT8U MCP_CAN::sendMsgBuf(INT32U id, INT8U len, INT8U *buf)
         
     setMsg(id, rtr, ext, len, buf);
     res = sendMsg();
+    notifyFrameHook(MCP_FRAME_TX, res);
     
     return res;
 }
@@ -1210,6 +1218,8 @@ INT8U MCP_CAN::readMsgBuf(INT32U *id, INT8U *ext, INT8U *len, INT8U buf[])
 {
     if(readMsg() == CAN_NOMSG)
 	return CAN_NOMSG;
+
+    notifyFrameHook(MCP_FRAME_RX, CAN_OK);
 	
     *id  = m_nID;
     *len = m_nDlc;
@@ -1229,6 +1239,8 @@ INT8U MCP_CAN::readMsgBuf(INT32U *id, INT8U *len, INT8U buf[])
     if(readMsg() == CAN_NOMSG)
 	return CAN_NOMSG;
 
+    notifyFrameHook(MCP_FRAME_RX, CAN_OK);
+
     if (m_nExtFlg)
         m_nID |= 0x80000000;
 
@@ -1244,6 +1256,36 @@ INT8U MCP_CAN::readMsgBuf(INT32U *id, INT8U *len, INT8U buf[])
     return CAN_OK;
 }
 
+/*********************************************************************************************************
+** Function name:           setFrameHook
+** Descriptions:            Public function, Sets the hook called for every received and sent frame.
+*********************************************************************************************************/
+void MCP_CAN::setFrameHook(MCP_CAN_FrameHook hook, void *context)
+{
+    frameHook = hook;
+    frameHookContext = context;
+}
+
+/*********************************************************************************************************
+** Function name:           setSendGate
+** Descriptions:            Public function, Sets the gate asked before every frame is sent.
+*********************************************************************************************************/
+void MCP_CAN::setSendGate(MCP_CAN_SendGate gate, void *context)
+{
+    sendGate = gate;
+    sendGateContext = context;
+}
+
+/*********************************************************************************************************
+** Function name:           notifyFrameHook
+** Descriptions:            Calls the frame hook (if set) with the current message.
+*********************************************************************************************************/
+void MCP_CAN::notifyFrameHook(INT8U direction, INT8U result)
+{
+    if (frameHook != nullptr)
+        frameHook(frameHookContext, direction, m_nID & 0x1FFFFFFF, m_nExtFlg, m_nRtr, m_nDlc, m_nDta, result);
+}
+
 /*********************************************************************************************************
 ** Function name:           checkReceive
 ** Descriptions:            Public function, Checks for received data.  (Used if not using the interrupt output)
@@ -1340,6 +1382,29 @@ INT8U MCP_CAN::abortTX(void)
 	    return CAN_OK;
 }
 
+/*********************************************************************************************************
+** Function name:           resumeTX
+** Descriptions:            Public function, Clears the abort request so frames are transmitted again.
+*********************************************************************************************************/
+INT8U MCP_CAN::resumeTX(void)
+{
+    mcp2515_modifyRegister(MCP_CANCTRL, ABORT_TX, 0);
+
+    if((mcp2515_readRegister(MCP_CANCTRL) & ABORT_TX) != 0)
+	    return CAN_FAIL;
+    else
+	    return CAN_OK;
+}
+
+/*********************************************************************************************************
+** Function name:           clearRXOverflow
+** Descriptions:            Public function, Clears RX0OVR and RX1OVR (they stay set until cleared)
+*********************************************************************************************************/
+void MCP_CAN::clearRXOverflow(void)
+{
+    mcp2515_modifyRegister(MCP_EFLG, MCP_EFLG_RX0OVR | MCP_EFLG_RX1OVR, 0);
+}
+
 /*********************************************************************************************************
 ** Function name:           setGPO
 ** Descriptions:            Public function, Checks for r
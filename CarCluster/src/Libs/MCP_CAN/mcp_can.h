@@ -27,6 +27,14 @@
 #include "mcp_can_dfs.h"
 #define MAX_CHAR_IN_MESSAGE 8
 
+// Frame hook (CarCluster addition): called for every frame read and every frame sent (with the send result)
+#define MCP_FRAME_RX 0
+#define MCP_FRAME_TX 1
+typedef void (*MCP_CAN_FrameHook)(void *context, INT8U direction, INT32U id, INT8U ext, INT8U rtr, INT8U len, const INT8U *buf, INT8U result);
+
+// Send gate (CarCluster addition): asked before every frame is sent, the frame is dropped with CAN_FAILTX when it returns false
+typedef bool (*MCP_CAN_SendGate)(void *context);
+
 class MCP_CAN
 {
     private:
@@ -41,6 +49,10 @@ class MCP_CAN
     SPIClass *mcpSPI;                                                       // The SPI-Device used
     INT8U   MCPCS;                                                      // Chip Select pin number
     INT8U   mcpMode;                                                    // Mode to return to after configurations are performed.
+    MCP_CAN_FrameHook frameHook = nullptr;                              // Called for every received and sent frame
+    void    *frameHookContext = nullptr;
+    MCP_CAN_SendGate sendGate = nullptr;                                // Asked before every frame is sent
+    void    *sendGateContext = nullptr;
     
 
 /*********************************************************************************************************
@@ -105,6 +117,7 @@ class MCP_CAN
     INT8U clearMsg();                                                   // Clear all message to zero
     INT8U readMsg();                                                    // Read message
     INT8U sendMsg();                                                    // Send message
+    void notifyFrameHook(INT8U direction, INT8U result);                // Call the frame hook with the current message
 
 public:
     MCP_CAN(INT8U _CS);
@@ -128,8 +141,12 @@ public:
     INT8U enOneShotTX(void);                                            // Enable one-shot transmission
     INT8U disOneShotTX(void);                                           // Disable one-shot transmission
     INT8U abortTX(void);                                                // Abort queued transmission(s)
+    INT8U resumeTX(void);                                               // Clear the abort request set by abortTX
+    void clearRXOverflow(void);                                         // Clear the receive buffer overflow flags
     INT8U setGPO(INT8U data);                                           // Sets GPO
     INT8U getGPI(void);                                                 // Reads GPI
+    void setFrameHook(MCP_CAN_FrameHook hook, void *context);           // Set hook called for every received and sent frame
+    void setSendGate(MCP_CAN_SendGate gate, void *context);             // Set gate asked before every frame is sent
 };
 
 #endif
@@ -0,0 +1,40 @@
+// ####################################################################################################################
+//
+// Code part of CarCluster project by Andrej Rolih. See .ino file more details
+//
+// ####################################################################################################################
+
+#include "BlinkerGenerator.h"
+
+BlinkerGenerator::BlinkerGenerator(unsigned long period, uint8_t dutyCycle) {
+  configure(period, dutyCycle);
+}
+
+void BlinkerGenerator::configure(unsigned long period, uint8_t dutyCycle) {
+  this->period = period > 0 ? period : 1;
+  this->onTime = this->period * (dutyCycle > 100 ? 100 : dutyCycle) / 100;
+}
+
+bool BlinkerGenerator::lampOn(bool leftIndicator, bool rightIndicator, bool blinking) {
+  return lampOnAt(leftIndicator, rightIndicator, blinking, millis());
+}
+
+bool BlinkerGenerator::lampOnAt(bool leftIndicator, bool rightIndicator, bool blinking, unsigned long time) {
+  if (!leftIndicator && !rightIndicator) {
+    running = false;
+    return false;
+  }
+
+  if (!blinking) {
+    running = false;
+    return true;
+  }
+
+  // Start the cycle with the lamp on, like a real flasher relay
+  if (!running) {
+    running = true;
+    startTime = time;
+  }
+
+  return (time - startTime) % period < onTime;
+}
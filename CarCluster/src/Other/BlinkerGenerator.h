@@ -0,0 +1,35 @@
+// ####################################################################################################################
+//
+// Code part of CarCluster project by Andrej Rolih. See .ino file more details
+//
+// ####################################################################################################################
+
+#ifndef BLINKER_GENERATOR
+#define BLINKER_GENERATOR
+
+#include "Arduino.h"
+
+// Turn signal blinking for clusters where the sketch has to switch the indicator lamps on and off.
+//
+// The lamp state is calculated from the time since blinking started (not by counting updates), so the blink
+// rhythm stays the same no matter how often or how irregularly the cluster is updated. Left, right and hazard
+// share the same phase - switching from one to the other while blinking does not restart the cycle.
+class BlinkerGenerator {
+  public:
+    BlinkerGenerator(unsigned long period = 800, uint8_t dutyCycle = 50);
+    void configure(unsigned long period, uint8_t dutyCycle);  // Duty cycle in percent of the period the lamp is on
+
+    // Returns true if the lamps of the active indicators should be lit right now.
+    // If blinking is false the game controls the blinking and active indicators are always lit.
+    bool lampOn(bool leftIndicator, bool rightIndicator, bool blinking);
+    bool lampOnAt(bool leftIndicator, bool rightIndicator, bool blinking, unsigned long time);
+
+  private:
+    unsigned long period;
+    unsigned long onTime;
+
+    bool running = false;
+    unsigned long startTime = 0;
+};
+
+#endif
@@ -0,0 +1,60 @@
+// ####################################################################################################################
+//
+// Code part of CarCluster project by Andrej Rolih. See .ino file more details
+//
+// ####################################################################################################################
+
+#include "BootTimeline.h"
+#include "SerialOutput.h"
+
+void BootTimeline::mark(Milestone milestone) {
+  if (reached(milestone)) return;
+
+  times[milestone] = millis();
+  reachedMask |= (1 << milestone);
+}
+
+void BootTimeline::report() {
+  if (reportedMask == reachedMask) return;
+
+  for (uint8_t i = 0; i < Milestone_Count; i++) {
+    Milestone milestone = static_cast<Milestone>(i);
+    if (reached(milestone) && (reportedMask & (1 << i)) == 0) {
+      printMilestone(milestone);
+      reportedMask |= (1 << i);
+    }
+  }
+}
+
+void BootTimeline::print() {
+  for (uint8_t i = 0; i < Milestone_Count; i++) {
+    Milestone milestone = static_cast<Milestone>(i);
+    if (reached(milestone)) {
+      printMilestone(milestone);
+    } else {
+      serialOutput.print("Boot: ");
+      serialOutput.print(milestoneName(milestone));
+      serialOutput.println(" not reached");
+    }
+  }
+}
+
+const char* BootTimeline::milestoneName(Milestone milestone) {
+  switch (milestone) {
+    case Milestone_Setup: return "setup";
+    case Milestone_CanReady: return "can_ready";
+    case Milestone_FirstFrame: return "first_frame";
+    case Milestone_WifiConnected: return "wifi_connected";
+    case Milestone_WebReady: return "web_ready";
+    case Milestone_Ready: return "ready";
+    default: return "";
+  }
+}
+
+void BootTimeline::printMilestone(Milestone milestone) {
+  serialOutput.print("Boot: ");
+  serialOutput.print(milestoneName(milestone));
+  serialOutput.print(" at ");
+  serialOutput.print(times[milestone]);
+  serialOutput.println(" ms");
+}
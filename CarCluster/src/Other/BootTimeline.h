@@ -0,0 +1,49 @@
+// ####################################################################################################################
+//
+// Code part of CarCluster project by Andrej Rolih. See .ino file more details
+//
+// ####################################################################################################################
+
+#ifndef BOOT_TIMELINE
+#define BOOT_TIMELINE
+
+#include "Arduino.h"
+
+// Records when the boot milestones were first reached (in ms since power on), so startup delays can be measured.
+// mark() is cheap and safe to call repeatedly (only the first call counts), report() prints milestones reached
+// since the last report and should be called from the main loop.
+class BootTimeline {
+  BootTimeline(const BootTimeline &other) = delete;
+  BootTimeline(BootTimeline &&other) = delete;
+  BootTimeline &operator=(const BootTimeline &other) = delete;
+  BootTimeline &operator=(BootTimeline &&other) = delete;
+
+  public:
+    enum Milestone {
+      Milestone_Setup = 0,                 // setup() started
+      Milestone_CanReady,                  // Main CAN controller initialized
+      Milestone_FirstFrame,                // First CAN frame sent to the cluster
+      Milestone_WifiConnected,
+      Milestone_WebReady,                  // Web dashboard and network games started
+      Milestone_Ready,                     // All CAN controllers running
+      Milestone_Count
+    };
+
+    BootTimeline() {}
+    void mark(Milestone milestone);
+    void report();
+    void print();                          // Prints all milestones
+
+    bool reached(Milestone milestone) { return (reachedMask & (1 << milestone)) != 0; }
+    unsigned long time(Milestone milestone) { return times[milestone]; }
+    static const char* milestoneName(Milestone milestone);
+
+  private:
+    unsigned long times[Milestone_Count] = {};
+    volatile uint8_t reachedMask = 0;
+    uint8_t reportedMask = 0;
+
+    void printMilestone(Milestone milestone);
+};
+
+#endif
@@ -0,0 +1,68 @@
+// ####################################################################################################################
+//
+// Code part of CarCluster project by Andrej Rolih. See .ino file more details
+//
+// ####################################################################################################################
+
+#include "ButtonEventQueue.h"
+
+ButtonEventQueue::ButtonEventQueue(unsigned long pressDuration, unsigned long releaseDuration, unsigned long repeatInterval) {
+  this->pressDuration = pressDuration;
+  this->releaseDuration = releaseDuration;
+  this->repeatInterval = repeatInterval > pressDuration ? repeatInterval : 0;
+}
+
+bool ButtonEventQueue::push(int button, unsigned long holdDuration) {
+  if (button == 0) return true;
+  if (count >= capacity) {
+    dropped++;
+    return false;
+  }
+
+  Event &event = events[(head + count) % capacity];
+  event.button = button;
+  event.holdDuration = holdDuration > pressDuration ? holdDuration : pressDuration;
+  count++;
+  return true;
+}
+
+bool ButtonEventQueue::update(GameState& game) {
+  ButtonEvent event;
+  while (game.nextButtonEvent(gamePosition, event)) {
+    push(event.button, event.holdDuration);
+  }
+
+  unsigned long currentTime = millis();
+  int previous = active;
+
+  if (phase == Phase_Pressed) {
+    if (currentTime - phaseStart >= current.holdDuration) {
+      active = 0;
+      phase = Phase_Released;
+      phaseStart = currentTime;
+    } else if (repeatInterval > 0) {
+      // Release after each press and press again on the next repeat
+      if (active != 0 && currentTime - repeatStart >= pressDuration) {
+        active = 0;
+      } else if (active == 0 && currentTime - repeatStart >= repeatInterval) {
+        active = current.button;
+        repeatStart = currentTime;
+      }
+    }
+  } else if (phase == Phase_Released && currentTime - phaseStart >= releaseDuration) {
+    phase = Phase_Idle;
+  }
+
+  if (phase == Phase_Idle && count > 0) {
+    current = events[head];
+    head = (head + 1) % capacity;
+    count--;
+
+    active = current.button;
+    phase = Phase_Pressed;
+    phaseStart = currentTime;
+    repeatStart = currentTime;
+  }
+
+  return active != previous;
+}
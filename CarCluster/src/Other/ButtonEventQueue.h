@@ -0,0 +1,63 @@
+// ####################################################################################################################
+//
+// Code part of CarCluster project by Andrej Rolih. See .ino file more details
+//
+// ####################################################################################################################
+
+#ifndef BUTTON_EVENT_QUEUE
+#define BUTTON_EVENT_QUEUE
+
+#include "Arduino.h"
+
+#include "../Games/GameSimulation.h"
+
+// Per cluster queue of steering wheel button events. Each event goes through timed phases:
+// pressed (at least pressDuration, longer for a long press), optionally auto-repeated while held, and released
+// (releaseDuration before the next event starts). Timing is driven by update(), so the cluster never has to wait.
+//
+// update() takes the new presses from the game state (GameState::pushButtonEvent) and returns true whenever the
+// active button changes, so the cluster can send the frame right away.
+class ButtonEventQueue {
+  public:
+    static const uint8_t capacity = 8;
+
+    // repeatInterval > 0 emulates a held button as repeated presses (for clusters that only react to edges)
+    ButtonEventQueue(unsigned long pressDuration, unsigned long releaseDuration, unsigned long repeatInterval = 0);
+
+    bool push(int button, unsigned long holdDuration = 0);  // Returns false if the queue is full
+    bool update(GameState& game);
+
+    int activeButton() { return active; }  // 0 = no button pressed
+    uint8_t pendingEvents() { return count; }
+    uint32_t droppedEvents() { return dropped; }
+
+  private:
+    enum Phase {
+      Phase_Idle = 0,
+      Phase_Pressed,
+      Phase_Released
+    };
+
+    struct Event {
+      int button;
+      unsigned long holdDuration;
+    };
+
+    unsigned long pressDuration;
+    unsigned long releaseDuration;
+    unsigned long repeatInterval;
+
+    Event events[capacity];
+    uint8_t head = 0;
+    uint8_t count = 0;
+    uint32_t dropped = 0;
+    uint32_t gamePosition = 0;             // Next press to take from the game state
+
+    Phase phase = Phase_Idle;
+    Event current;
+    int active = 0;
+    unsigned long phaseStart = 0;
+    unsigned long repeatStart = 0;
+};
+
+#endif
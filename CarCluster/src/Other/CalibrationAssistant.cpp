@@ -0,0 +1,214 @@
+// ####################################################################################################################
+//
+// Code part of CarCluster project by Andrej Rolih. See .ino file more details
+//
+// ####################################################################################################################
+
+#include "CalibrationAssistant.h"
+#include "SerialOutput.h"
+
+// NVS namespace, one key per gauge (named as the gauge). Value is the point count followed by
+// 16 bit little endian input, output pairs.
+static const char *preferencesNamespace = "gauges";
+
+CalibrationAssistant::CalibrationAssistant(GameState& game): gameState(game) {
+}
+
+void CalibrationAssistant::begin() {
+  Preferences preferences;
+  if (!preferences.begin(preferencesNamespace, true)) return;  // Nothing stored yet
+
+  for (uint8_t i = 0; i < Gauge_Count; i++) {
+    Gauge gauge = static_cast<Gauge>(i);
+    uint8_t data[1 + GaugeCalibration::maximumPoints * 4];
+    size_t length = preferences.getBytesLength(gaugeName(gauge));
+    if (length < 1 || length > sizeof(data)) continue;
+
+    preferences.getBytes(gaugeName(gauge), data, length);
+    uint8_t count = data[0];
+    if (length != 1 + count * 4u) continue;
+
+    int32_t inputs[GaugeCalibration::maximumPoints];
+    int32_t outputs[GaugeCalibration::maximumPoints];
+    for (uint8_t point = 0; point < count; point++) {
+      const uint8_t *pointData = data + 1 + point * 4;
+      inputs[point] = (int16_t)(pointData[0] | (pointData[1] << 8));
+      outputs[point] = (int16_t)(pointData[2] | (pointData[3] << 8));
+    }
+
+    if (calibration(gauge).setPoints(inputs, outputs, count)) {
+      serialOutput.print("Loaded stored calibration for ");
+      serialOutput.println(gaugeName(gauge));
+    }
+  }
+
+  preferences.end();
+}
+
+void CalibrationAssistant::update() {
+  if (assistantState == State_Idle) return;
+
+  // Override whatever the game sends, so the gauge stays at the setpoint
+  gameValueFor(activeGauge) = rawValues[currentStep];
+
+  if (assistantState == State_Settling && millis() - stepStartTime >= settleTime) {
+    assistantState = State_WaitingForValue;
+  }
+}
+
+bool CalibrationAssistant::start(Gauge gauge) {
+  if (assistantState != State_Idle || gauge >= Gauge_Count) return false;
+
+  ClusterConfiguration &configuration = gameState.configuration;
+  int32_t minimum = 0;
+  int32_t maximum = 0;
+  switch (gauge) {
+    case Gauge_Speed: maximum = configuration.maximumSpeedValue; break;
+    case Gauge_RPM: maximum = configuration.maximumRPMValue; break;
+    default:
+      minimum = configuration.minimumCoolantTemperature;
+      maximum = configuration.maximumCoolantTemperature;
+      break;
+  }
+  if (maximum <= minimum) return false;
+
+  for (uint8_t i = 0; i < setpointCount; i++) {
+    rawValues[i] = minimum + ((maximum - minimum) * i) / (setpointCount - 1);
+  }
+
+  // Setpoints are sent to the cluster without any correction
+  activeGauge = gauge;
+  previousCalibration = calibration(gauge);
+  calibration(gauge) = GaugeCalibration(minimum, maximum, minimum, maximum);
+  startStep(0);
+  return true;
+}
+
+bool CalibrationAssistant::confirm() {
+  return confirm(rawValues[currentStep]);
+}
+
+bool CalibrationAssistant::confirm(int32_t displayedValue) {
+  if (assistantState != State_WaitingForValue) return false;
+
+  displayedValues[currentStep] = displayedValue;
+  if (currentStep + 1 < setpointCount) {
+    startStep(currentStep + 1);
+    return true;
+  }
+
+  assistantState = State_Idle;
+  if (!fitCurve()) {
+    calibration(activeGauge) = previousCalibration;
+    serialOutput.println("Calibration failed, gauge readings have to increase");
+    return false;
+  }
+
+  if (!save(activeGauge)) {
+    serialOutput.println("Calibration could not be stored");
+  }
+  return true;
+}
+
+void CalibrationAssistant::cancel() {
+  if (assistantState == State_Idle) return;
+
+  calibration(activeGauge) = previousCalibration;
+  assistantState = State_Idle;
+}
+
+bool CalibrationAssistant::save(Gauge gauge) {
+  const GaugeCalibration &curve = calibration(gauge);
+  uint8_t data[1 + GaugeCalibration::maximumPoints * 4];
+
+  data[0] = curve.pointCount();
+  for (uint8_t point = 0; point < curve.pointCount(); point++) {
+    int32_t input = curve.pointInput(point);
+    int32_t output = curve.pointOutput(point);
+    if (input < INT16_MIN || input > INT16_MAX || output < INT16_MIN || output > INT16_MAX) return false;
+
+    uint8_t *pointData = data + 1 + point * 4;
+    pointData[0] = input & 0xFF;
+    pointData[1] = (input >> 8) & 0xFF;
+    pointData[2] = output & 0xFF;
+    pointData[3] = (output >> 8) & 0xFF;
+  }
+
+  Preferences preferences;
+  if (!preferences.begin(preferencesNamespace, false)) return false;
+  size_t length = 1 + curve.pointCount() * 4;
+  bool saved = preferences.putBytes(gaugeName(gauge), data, length) == length;
+  preferences.end();
+  return saved;
+}
+
+void CalibrationAssistant::clearStored() {
+  cancel();
+
+  Preferences preferences;
+  if (preferences.begin(preferencesNamespace, false)) {
+    preferences.clear();
+    preferences.end();
+  }
+
+  gameState.configuration.updateCalibrations();
+}
+
+const char* CalibrationAssistant::gaugeName(Gauge gauge) {
+  switch (gauge) {
+    case Gauge_Speed: return "speed";
+    case Gauge_RPM: return "rpm";
+    case Gauge_Coolant: return "coolant";
+    default: return "";
+  }
+}
+
+bool CalibrationAssistant::gaugeFromName(const char *name, Gauge *gauge) {
+  for (uint8_t i = 0; i < Gauge_Count; i++) {
+    if (name != NULL && strcmp(name, gaugeName(static_cast<Gauge>(i))) == 0) {
+      *gauge = static_cast<Gauge>(i);
+      return true;
+    }
+  }
+  return false;
+}
+
+GaugeCalibration& CalibrationAssistant::calibration(Gauge gauge) {
+  switch (gauge) {
+    case Gauge_Speed: return gameState.configuration.speedCalibration;
+    case Gauge_RPM: return gameState.configuration.rpmCalibration;
+    default: return gameState.configuration.coolantCalibration;
+  }
+}
+
+int& CalibrationAssistant::gameValueFor(Gauge gauge) {
+  switch (gauge) {
+    case Gauge_Speed: return gameState.speed;
+    case Gauge_RPM: return gameState.rpm;
+    default: return gameState.coolantTemperature;
+  }
+}
+
+void CalibrationAssistant::startStep(uint8_t step) {
+  currentStep = step;
+  stepStartTime = millis();
+  assistantState = State_Settling;
+}
+
+bool CalibrationAssistant::fitCurve() {
+  // The correction curve maps the value that should be shown to the raw value that shows it. Readings that do not
+  // increase (needle not moving yet at the bottom of the scale, end stop) would make the curve ambiguous, so only
+  // the first raw value for each reading is kept.
+  int32_t inputs[setpointCount];
+  int32_t outputs[setpointCount];
+  uint8_t count = 0;
+
+  for (uint8_t i = 0; i < setpointCount; i++) {
+    if (count > 0 && displayedValues[i] <= inputs[count - 1]) continue;
+    inputs[count] = displayedValues[i];
+    outputs[count] = rawValues[i];
+    count++;
+  }
+
+  return calibration(activeGauge).setPoints(inputs, outputs, count);
+}
@@ -0,0 +1,86 @@
+// ####################################################################################################################
+//
+// Code part of CarCluster project by Andrej Rolih. See .ino file more details
+//
+// ####################################################################################################################
+
+#ifndef CALIBRATION_ASSISTANT
+#define CALIBRATION_ASSISTANT
+
+#include "Arduino.h"
+#include <Preferences.h>
+
+#include "../Games/GameSimulation.h"
+#include "GaugeCalibration.h"
+
+// Guides the user through calibrating the speed, RPM or coolant gauge of the cluster.
+//
+// The gauge is stepped through evenly spaced raw values (sent to the cluster without any correction). At each step
+// the needle is given time to settle, then the user enters the value the gauge actually shows (or confirms that it
+// shows the requested value). After the last step the raw values and readings are turned into a piecewise linear
+// correction curve (shown value -> raw value), applied to the gauge calibration and stored in NVS.
+//
+// Stored curves are loaded on begin() and replace the curves built from the correction factors in the .ino, until
+// they are cleared.
+class CalibrationAssistant {
+  CalibrationAssistant(const CalibrationAssistant &other) = delete;
+  CalibrationAssistant(CalibrationAssistant &&other) = delete;
+  CalibrationAssistant &operator=(const CalibrationAssistant &other) = delete;
+  CalibrationAssistant &operator=(CalibrationAssistant &&other) = delete;
+
+  public:
+    enum Gauge {
+      Gauge_Speed = 0,
+      Gauge_RPM,
+      Gauge_Coolant,
+      Gauge_Count
+    };
+
+    enum State {
+      State_Idle = 0,
+      State_Settling,                      // Needle is moving to the current setpoint
+      State_WaitingForValue                // Waiting for the user to read the gauge
+    };
+
+    static const uint8_t setpointCount = 7;
+    static const unsigned long settleTime = 2000;
+
+    CalibrationAssistant(GameState& game);
+    void begin();                          // Loads the stored curves
+    void update();                         // Call every loop, before the cluster is updated
+
+    bool start(Gauge gauge);
+    bool confirm();                        // Gauge shows the requested setpoint
+    bool confirm(int32_t displayedValue);
+    void cancel();                         // Restores the curve that was used before the calibration
+
+    bool save(Gauge gauge);                // Stores the current curve of the gauge (done automatically after calibration)
+    void clearStored();                    // Removes stored curves and goes back to the .ino configuration
+
+    State state() { return assistantState; }
+    Gauge gauge() { return activeGauge; }
+    uint8_t step() { return currentStep; }
+    int32_t setpoint() { return rawValues[currentStep]; }
+    GaugeCalibration& calibration(Gauge gauge);
+
+    static const char* gaugeName(Gauge gauge);
+    static bool gaugeFromName(const char *name, Gauge *gauge);
+
+  private:
+    GameState &gameState;
+
+    State assistantState = State_Idle;
+    Gauge activeGauge = Gauge_Speed;
+    uint8_t currentStep = 0;
+    unsigned long stepStartTime = 0;
+    GaugeCalibration previousCalibration;
+
+    int32_t rawValues[setpointCount] = {};
+    int32_t displayedValues[setpointCount] = {};
+
+    int& gameValueFor(Gauge gauge);
+    void startStep(uint8_t step);
+    bool fitCurve();
+};
+
+#endif
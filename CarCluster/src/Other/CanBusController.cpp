@@ -0,0 +1,201 @@
+// ####################################################################################################################
+//
+// Code part of CarCluster project by Andrej Rolih. See .ino file more details
+//
+// ####################################################################################################################
+
+#include "CanBusController.h"
+#include "SerialOutput.h"
+
+CanBusController::CanBusController(MCP_CAN& can, uint8_t busNumber): can(can) {
+  this->busNumber = busNumber;
+}
+
+void CanBusController::begin(INT8U canSpeed, MCP_CAN_FrameHook frameHook) {
+  this->canSpeed = canSpeed;
+  this->frameHook = frameHook;
+  currentBackoff = initialBackoff;
+
+  // The gate is set before the first attempt, so frames sent before the controller is up are dropped instead of
+  // being written to a controller that is not initialized
+  can.setSendGate(allowSend, this);
+  attempt();
+}
+
+bool CanBusController::update() {
+  unsigned long currentTime = millis();
+
+  if (controllerState == State_Backoff && currentTime - lastAttemptTime >= currentBackoff) {
+    return attempt();
+  }
+
+  if (controllerState == State_BusOff && !probing && currentTime - lastAttemptTime >= currentBackoff) {
+    probe();
+  }
+
+  if (isRunning() && currentTime - lastHealthUpdateTime >= healthUpdateInterval) {
+    readHealth();
+  }
+
+  return false;
+}
+
+const char* CanBusController::stateName(State state) {
+  switch (state) {
+    case State_Stopped: return "stopped";
+    case State_Backoff: return "backoff";
+    case State_Running: return "running";
+    case State_ErrorPassive: return "error_passive";
+    case State_BusOff: return "bus_off";
+    default: return "";
+  }
+}
+
+bool CanBusController::attempt() {
+  initAttempts++;
+  lastAttemptTime = millis();
+
+  if (can.begin(MCP_ANY, canSpeed, MCP_8MHZ) == CAN_OK) {
+    can.setMode(MCP_NORMAL);
+    can.setFrameHook(handleFrame, this);
+    controllerState = State_Running;
+    readyAt = millis();
+    currentBackoff = initialBackoff;
+
+    serialOutput.print("CAN");
+    if (busNumber > 1) serialOutput.print(busNumber);
+    serialOutput.println(" BUS Shield init ok!");
+    return true;
+  }
+
+  if (controllerState == State_Backoff) increaseBackoff();
+  controllerState = State_Backoff;
+
+  serialOutput.print("CAN");
+  if (busNumber > 1) serialOutput.print(busNumber);
+  serialOutput.print(" BUS Shield init fail, retrying in ");
+  serialOutput.print(currentBackoff);
+  serialOutput.println(" ms");
+  return false;
+}
+
+bool CanBusController::setListenOnly(bool listenOnly) {
+  if (!isRunning()) return false;
+  if (can.setMode(listenOnly ? MCP_LISTENONLY : MCP_NORMAL) != MCP2515_OK) return false;
+  this->listenOnly = listenOnly;
+  return true;
+}
+
+void CanBusController::readHealth() {
+  rxErrors = can.errorCountRX();
+  txErrors = can.errorCountTX();
+  flags = can.getError();
+  lastHealthUpdateTime = millis();
+
+  // Overflow flags stay set until cleared, so each one counts once per health read
+  if (flags & (MCP_EFLG_RX0OVR | MCP_EFLG_RX1OVR)) {
+    if (flags & MCP_EFLG_RX0OVR) rxOverflows++;
+    if (flags & MCP_EFLG_RX1OVR) rxOverflows++;
+    can.clearRXOverflow();
+  }
+
+  if (controllerState == State_BusOff) return;  // Left only through a successful probe
+
+  if (flags & MCP_EFLG_TXBO) {
+    enterBusOff("reported by controller");
+  } else if (flags & (MCP_EFLG_TXEP | MCP_EFLG_RXEP)) {
+    if (controllerState != State_ErrorPassive) printStatus("error passive");
+    controllerState = State_ErrorPassive;
+  } else {
+    controllerState = State_Running;
+  }
+}
+
+void CanBusController::enterBusOff(const char *reason) {
+  controllerState = State_BusOff;
+  busOffs++;
+  probing = false;
+  lastAttemptTime = millis();
+  currentBackoff = initialBackoff;
+
+  // Frames waiting for an acknowledge would keep all transmit buffers busy
+  can.abortTX();
+
+  printStatus("off, sending stopped", reason);
+}
+
+void CanBusController::probe() {
+  lastAttemptTime = millis();
+  flags = can.getError();
+
+  // After a real bus off the controller has to see 128 x 11 recessive bits before it rejoins the bus
+  if (flags & MCP_EFLG_TXBO) {
+    increaseBackoff();
+    return;
+  }
+
+  can.resumeTX();
+  probing = true;
+}
+
+void CanBusController::frameSent(INT8U result) {
+  if (result == CAN_OK) {
+    consecutiveSendFailures = 0;
+    if (controllerState == State_BusOff) {
+      probing = false;
+      controllerState = State_Running;
+      currentBackoff = initialBackoff;
+      printStatus("recovered");
+      readHealth();
+    }
+    return;
+  }
+
+  sendFailures++;
+  if (probing) {
+    probing = false;
+    can.abortTX();
+    increaseBackoff();
+    return;
+  }
+
+  if (consecutiveSendFailures < sendFailureLimit) consecutiveSendFailures++;
+  if (isSending() && consecutiveSendFailures >= sendFailureLimit) {
+    enterBusOff("frames not acknowledged");
+  }
+}
+
+void CanBusController::increaseBackoff() {
+  currentBackoff = currentBackoff * 2 > maximumBackoff ? maximumBackoff : currentBackoff * 2;
+}
+
+void CanBusController::printStatus(const char *status, const char *reason) {
+  serialOutput.print("CAN");
+  if (busNumber > 1) serialOutput.print(busNumber);
+  serialOutput.print(" BUS ");
+  serialOutput.print(status);
+  if (reason != nullptr) {
+    serialOutput.print(" (");
+    serialOutput.print(reason);
+    serialOutput.print(")");
+  }
+  serialOutput.println();
+}
+
+void CanBusController::handleFrame(void *context, INT8U direction, INT32U id, INT8U ext, INT8U rtr, INT8U len, const INT8U *buf, INT8U result) {
+  CanBusController *controller = static_cast<CanBusController *>(context);
+  if (direction == MCP_FRAME_TX) controller->frameSent(result);
+
+  if (controller->frameHook != nullptr) {
+    controller->frameHook((void *)(uintptr_t)controller->busNumber, direction, id, ext, rtr, len, buf, result);
+  }
+}
+
+bool CanBusController::allowSend(void *context) {
+  CanBusController *controller = static_cast<CanBusController *>(context);
+  if (!controller->isRunning() || controller->listenOnly || (controller->controllerState == State_BusOff && !controller->probing)) {
+    controller->framesDropped++;
+    return false;
+  }
+  return true;
+}
@@ -0,0 +1,108 @@
+// ####################################################################################################################
+//
+// Code part of CarCluster project by Andrej Rolih. See .ino file more details
+//
+// ####################################################################################################################
+
+#ifndef CAN_BUS_CONTROLLER
+#define CAN_BUS_CONTROLLER
+
+#include "Arduino.h"
+
+#include "../Libs/MCP_CAN/mcp_can.h" // CAN Bus Shield Compatibility Library ( https://github.com/coryjfowler/MCP_CAN_lib )
+
+// Brings up one MCP2515 controller without blocking the rest of the sketch.
+//
+// Failed initialization is retried from update() with exponential backoff (100 ms doubling up to 10 s), so a missing
+// or broken transceiver does not hang the device and the web dashboard can still report what is wrong. Until the
+// controller is up the send gate drops every frame, so the cluster can be updated without checking the controller.
+//
+// While running, the error counters (TEC/REC) and flags are read periodically and every send result is tracked.
+// Error passive is only reported. Bus off (reported by the controller, or a run of failed sends, which is what an
+// unplugged cluster or a missing terminator looks like) stops all sending through the send gate, so the sketch does
+// not wait for a send timeout on every frame. Recovery is probed with a single frame, with the same backoff.
+class CanBusController {
+  CanBusController(const CanBusController &other) = delete;
+  CanBusController(CanBusController &&other) = delete;
+  CanBusController &operator=(const CanBusController &other) = delete;
+  CanBusController &operator=(CanBusController &&other) = delete;
+
+  public:
+    enum State {
+      State_Stopped = 0,                   // begin() not called
+      State_Backoff,                       // Initialization failed, waiting for the next attempt
+      State_Running,                       // Error active
+      State_ErrorPassive,                  // TEC or REC reached 128, still sending
+      State_BusOff                         // Not sending, waiting to probe for recovery
+    };
+
+    static const unsigned long initialBackoff = 100;
+    static const unsigned long maximumBackoff = 10000;
+    static const unsigned long healthUpdateInterval = 1000;
+    static const uint8_t sendFailureLimit = 8;  // Failed sends in a row that count as bus off
+
+    CanBusController(MCP_CAN& can, uint8_t busNumber);
+    void begin(INT8U canSpeed, MCP_CAN_FrameHook frameHook);  // Makes the first attempt right away
+    bool update();                         // Call every loop, returns true once when the controller comes up
+
+    State state() { return controllerState; }
+    bool isRunning() { return controllerState >= State_Running; }  // Initialized, even if bus off
+    bool isSending() { return !listenOnly && (controllerState == State_Running || controllerState == State_ErrorPassive); }
+    bool isListenOnly() { return listenOnly; }
+    uint8_t bus() { return busNumber; }
+    MCP_CAN& canInterface() { return can; }
+    INT8U speed() { return canSpeed; }   // CAN_xxxKBPS passed to begin()
+    uint16_t attempts() { return initAttempts; }
+    unsigned long readyTime() { return readyAt; }  // ms since boot, 0 if not running yet
+    unsigned long backoff() { return currentBackoff; }
+    uint8_t receiveErrors() { return rxErrors; }
+    uint8_t transmitErrors() { return txErrors; }
+    uint8_t errorFlags() { return flags; } // MCP2515 EFLG register
+    uint16_t busOffCount() { return busOffs; }
+    uint32_t failedSends() { return sendFailures; }
+    uint32_t droppedFrames() { return framesDropped; }  // Not sent while not running, bus off or listen only
+    uint32_t receiveOverflows() { return rxOverflows; }   // Receive buffer overflows found by the health reads
+
+    // Listen only: the controller does not acknowledge frames and nothing is sent (frames count as dropped)
+    bool setListenOnly(bool listenOnly);
+
+    static const char* stateName(State state);
+
+  private:
+    MCP_CAN &can;
+    uint8_t busNumber;
+    INT8U canSpeed = CAN_500KBPS;
+    MCP_CAN_FrameHook frameHook = nullptr;
+
+    State controllerState = State_Stopped;
+    uint16_t initAttempts = 0;
+    unsigned long lastAttemptTime = 0;
+    unsigned long currentBackoff = 0;
+    unsigned long readyAt = 0;
+
+    unsigned long lastHealthUpdateTime = 0;
+    uint8_t rxErrors = 0;
+    uint8_t txErrors = 0;
+    uint8_t flags = 0;
+
+    uint8_t consecutiveSendFailures = 0;
+    uint32_t sendFailures = 0;
+    uint32_t framesDropped = 0;
+    uint16_t busOffs = 0;
+    uint32_t rxOverflows = 0;
+    bool probing = false;                  // Next frame is let through to check if the bus is back
+    bool listenOnly = false;
+
+    bool attempt();
+    void readHealth();
+    void enterBusOff(const char *reason);
+    void probe();
+    void frameSent(INT8U result);
+    void increaseBackoff();
+    void printStatus(const char *status, const char *reason = nullptr);
+
+    static void handleFrame(void *context, INT8U direction, INT32U id, INT8U ext, INT8U rtr, INT8U len, const INT8U *buf, INT8U result);
+    static bool allowSend(void *context);
+};
+
+#endif
@@ -0,0 +1,124 @@
+// ####################################################################################################################
+//
+// Code part of CarCluster project by Andrej Rolih. See .ino file more details
+//
+// ####################################################################################################################
+
+#ifndef CAN_BUS_LOAD
+#define CAN_BUS_LOAD
+
+#include <stddef.h>
+#include <stdint.h>
+
+// Bus load and worst case response time analysis of a periodic CAN frame schedule.
+//
+// Everything is constexpr (C++11), so a schedule can be checked with static_assert when the sketch is compiled, printed
+// on the host (see Tools/busload.cpp) and reported by the device, all from the same frame tables.
+//
+// Frame length is the worst case including stuff bits and the interframe space. Response times use the usual CAN
+// schedulability analysis (Davis, Burns, Bril, Lukkien 2007): a frame waits for at most one lower priority frame that
+// is already on the bus plus every higher priority frame queued in the meantime. All frames of a schedule are assumed
+// to be queued at the same time (which is what the cluster update loops do), deadline is the period. Times are in us.
+class CanBusLoad {
+  public:
+    struct Frame {
+      uint32_t id;
+      uint8_t dlc;
+      uint16_t period;                     // ms
+      bool extended;
+    };
+
+    struct Bus {
+      const char *name;
+      uint16_t bitrate;                    // kbit/s
+      const Frame *frames;
+      uint8_t frameCount;
+    };
+
+    static constexpr uint32_t utilizationBudget = 500000;  // ppm, frames sent by us should leave room for everyone else
+    static constexpr uint8_t maximumIterations = 64;
+
+    template <size_t N>
+    static constexpr uint8_t frameCount(const Frame (&)[N]) { return N; }
+
+    // Worst case number of bits on the wire, including stuff bits and the 3 bit interframe space
+    static constexpr uint32_t frameBits(const Frame &frame) {
+      return frame.extended ? 54 + 8 * frame.dlc + 13 + (54 + 8 * frame.dlc - 1) / 4
+                            : 34 + 8 * frame.dlc + 13 + (34 + 8 * frame.dlc - 1) / 4;
+    }
+
+    static constexpr uint32_t bitTime(const Bus &bus) {
+      return (1000 + bus.bitrate - 1) / bus.bitrate;
+    }
+
+    static constexpr uint32_t transmissionTime(const Bus &bus, uint8_t frame) {
+      return (frameBits(bus.frames[frame]) * 1000 + bus.bitrate - 1) / bus.bitrate;
+    }
+
+    static constexpr uint32_t deadline(const Bus &bus, uint8_t frame) {
+      return bus.frames[frame].period * 1000UL;
+    }
+
+    // Sum of transmission time / period of all frames, in ppm
+    static constexpr uint32_t utilization(const Bus &bus, uint8_t frame = 0) {
+      return frame >= bus.frameCount ? 0 : transmissionTime(bus, frame) * 1000 / bus.frames[frame].period + utilization(bus, frame + 1);
+    }
+
+    // Queuing delay plus transmission time. Larger than the deadline if the frame can miss it.
+    static constexpr uint32_t responseTime(const Bus &bus, uint8_t frame) {
+      return queuingDelay(bus, frame, blocking(bus, frame), maximumIterations) + transmissionTime(bus, frame);
+    }
+
+    static constexpr bool meetsDeadlines(const Bus &bus, uint8_t frame = 0) {
+      return frame >= bus.frameCount || (responseTime(bus, frame) <= deadline(bus, frame) && meetsDeadlines(bus, frame + 1));
+    }
+
+    static constexpr bool withinBudget(const Bus &bus) {
+      return utilization(bus) <= utilizationBudget && meetsDeadlines(bus);
+    }
+
+    // Index of the frame with the longest response time relative to its deadline
+    static constexpr uint8_t worstFrame(const Bus &bus, uint8_t frame = 0, uint8_t worst = 0) {
+      return frame >= bus.frameCount ? worst
+           : worstFrame(bus, frame + 1, (uint64_t)responseTime(bus, frame) * deadline(bus, worst) > (uint64_t)responseTime(bus, worst) * deadline(bus, frame) ? frame : worst);
+    }
+
+  private:
+    // Standard frames win arbitration against extended frames with the same base ID (RTR vs SRR bit)
+    static constexpr uint32_t arbitrationKey(const Frame &frame) {
+      return frame.extended ? ((frame.id >> 18) << 19) | (1UL << 18) | (frame.id & 0x3FFFF) : frame.id << 19;
+    }
+
+    // Frames with the same ID (sent several times per period) are queued in table order
+    static constexpr bool isHigherPriority(const Bus &bus, uint8_t other, uint8_t frame) {
+      return other != frame && (arbitrationKey(bus.frames[other]) < arbitrationKey(bus.frames[frame]) ||
+                                (arbitrationKey(bus.frames[other]) == arbitrationKey(bus.frames[frame]) && other < frame));
+    }
+
+    // Longest lower priority frame that might have just started transmitting
+    static constexpr uint32_t blocking(const Bus &bus, uint8_t frame, uint8_t other = 0) {
+      return other >= bus.frameCount ? 0
+           : larger(other != frame && !isHigherPriority(bus, other, frame) ? transmissionTime(bus, other) : 0, blocking(bus, frame, other + 1));
+    }
+
+    static constexpr uint32_t interference(const Bus &bus, uint8_t frame, uint32_t delay, uint8_t other = 0) {
+      return other >= bus.frameCount ? 0
+           : (isHigherPriority(bus, other, frame) ? (delay + bitTime(bus) + deadline(bus, other) - 1) / deadline(bus, other) * transmissionTime(bus, other) : 0)
+             + interference(bus, frame, delay, other + 1);
+    }
+
+    // Fixed point iteration of the queuing delay, gives up (returns the deadline) once the deadline is exceeded
+    static constexpr uint32_t queuingDelay(const Bus &bus, uint8_t frame, uint32_t delay, uint8_t iterations) {
+      return settle(bus, frame, delay, blocking(bus, frame) + interference(bus, frame, delay), iterations);
+    }
+
+    static constexpr uint32_t settle(const Bus &bus, uint8_t frame, uint32_t delay, uint32_t next, uint8_t iterations) {
+      return next == delay ? next
+           : (iterations == 0 || next + transmissionTime(bus, frame) > deadline(bus, frame)) ? deadline(bus, frame)
+           : queuingDelay(bus, frame, next, iterations - 1);
+    }
+
+    static constexpr uint32_t larger(uint32_t a, uint32_t b) { return a > b ? a : b; }
+};
+
+#endif
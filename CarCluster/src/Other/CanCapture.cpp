@@ -0,0 +1,208 @@
+// ####################################################################################################################
+//
+// Code part of CarCluster project by Andrej Rolih. See .ino file more details
+//
+// ####################################################################################################################
+
+#include "CanCapture.h"
+#include "SerialOutput.h"
+
+CanCapture::CanCapture(size_t frameCapacity) {
+  this->capacity = frameCapacity;
+}
+
+void CanCapture::begin() {
+  // Prefer PSRAM for the buffer, so we do not take away heap from wifi and the web server
+  if (psramFound()) {
+    frames = (Frame *)ps_malloc(capacity * sizeof(Frame));
+  }
+  if (frames == nullptr) {
+    frames = (Frame *)malloc(capacity * sizeof(Frame));
+  }
+  if (frames == nullptr) {
+    serialOutput.println("CAN capture buffer allocation failed");
+    capacity = 0;
+  }
+}
+
+void CanCapture::captureFrame(uint8_t bus, bool transmitted, uint32_t id, bool extended, bool remote, uint8_t length, const uint8_t *data, bool failed) {
+  if (captureState == State_Stopped || capacity == 0) {
+    return;
+  }
+
+  uint32_t startTime = micros();
+
+  if (captureState == State_Armed) {
+    if (id != startTriggerId) {
+      return;
+    }
+    captureState = State_Capturing;
+  }
+
+  bool store = matchesFilters(id);
+  if (!store) {
+    filtered++;
+  } else if (stopWhenFull && nextSequence - firstSequence >= capacity) {
+    stop();
+    store = false;
+  }
+
+  if (store) {
+    if (nextSequence - firstSequence >= capacity) {
+      overwritten++;
+    }
+
+    Frame &frame = frames[nextSequence % capacity];
+    frame.timestamp = timestampMicros();
+    frame.id = id;
+    frame.length = length > 8 ? 8 : length;
+    frame.flags = (transmitted ? Flag_Transmitted : 0) | (bus == 2 ? Flag_Bus2 : 0) | (extended ? Flag_Extended : 0) | (remote ? Flag_Remote : 0) | (failed ? Flag_Failed : 0);
+    memcpy(frame.data, data, frame.length);
+    nextSequence++;
+
+    if (remainingPostTriggerFrames > 0) {
+      remainingPostTriggerFrames--;
+      if (remainingPostTriggerFrames == 0) stop();
+    }
+  }
+
+  // Stop trigger is checked for all frames, even the ones that are filtered out
+  if (captureState == State_Capturing && remainingPostTriggerFrames < 0 && id == stopTriggerId) {
+    remainingPostTriggerFrames = postTriggerFrames;
+    if (postTriggerFrames == 0) stop();
+  }
+
+  uint32_t cost = micros() - startTime;
+  totalCostMicros += cost;
+  hookCalls++;
+  if (cost > maximumCost) maximumCost = cost;
+}
+
+void CanCapture::clearFilters() {
+  filterCount = 0;
+}
+
+bool CanCapture::addFilter(uint32_t id, uint32_t mask) {
+  if (filterCount >= maximumFilters) return false;
+
+  filterIds[filterCount] = id & mask;
+  filterMasks[filterCount] = mask;
+  filterCount++;
+  return true;
+}
+
+void CanCapture::setTriggers(uint32_t startId, uint32_t stopId, uint16_t postTriggerFrames) {
+  this->startTriggerId = startId;
+  this->stopTriggerId = stopId;
+  this->postTriggerFrames = postTriggerFrames;
+}
+
+void CanCapture::start() {
+  firstSequence = nextSequence;
+  overwritten = 0;
+  filtered = 0;
+  totalCostMicros = 0;
+  hookCalls = 0;
+  maximumCost = 0;
+  remainingPostTriggerFrames = -1;
+
+  captureState = (startTriggerId == noTrigger) ? State_Capturing : State_Armed;
+}
+
+void CanCapture::stop() {
+  captureState = State_Stopped;
+  remainingPostTriggerFrames = -1;
+}
+
+uint32_t CanCapture::storedFrames() {
+  uint32_t count = nextSequence - firstSequence;
+  return count > capacity ? capacity : count;
+}
+
+uint32_t CanCapture::oldestSequence() {
+  return nextSequence - storedFrames();
+}
+
+size_t CanCapture::exportHeader(ExportFormat format, uint8_t *out) {
+  if (format != ExportFormat_Pcap) {
+    return 0;
+  }
+
+  // pcap global header (little endian): magic, version 2.4, timezone, sigfigs, snaplen, LINKTYPE_CAN_SOCKETCAN
+  const uint8_t header[24] = {
+    0xD4, 0xC3, 0xB2, 0xA1, 0x02, 0x00, 0x04, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x10, 0x00, 0x00, 0x00, 0xE3, 0x00, 0x00, 0x00
+  };
+  memcpy(out, header, sizeof(header));
+  return sizeof(header);
+}
+
+size_t CanCapture::exportFrame(ExportFormat format, uint32_t sequence, uint8_t *out) {
+  if (capacity == 0 || (int32_t)(sequence - oldestSequence()) < 0 || (int32_t)(sequence - nextSequence) >= 0) {
+    return 0;
+  }
+
+  const Frame &frame = frames[sequence % capacity];
+
+  // Frames that failed to send never made it to the bus
+  if (frame.flags & Flag_Failed) {
+    return 0;
+  }
+
+  uint32_t seconds = frame.timestamp / 1000000;
+  uint32_t microseconds = frame.timestamp % 1000000;
+
+  if (format == ExportFormat_Pcap) {
+    // Record header followed by struct can_frame (ID in network byte order)
+    uint32_t canId = frame.id | ((frame.flags & Flag_Extended) ? 0x80000000 : 0) | ((frame.flags & Flag_Remote) ? 0x40000000 : 0);
+    uint32_t recordHeader[4] = { seconds, microseconds, 16, 16 };
+    memcpy(out, recordHeader, sizeof(recordHeader));
+    out[16] = canId >> 24;
+    out[17] = canId >> 16;
+    out[18] = canId >> 8;
+    out[19] = canId;
+    out[20] = frame.length;
+    out[21] = 0;
+    out[22] = 0;
+    out[23] = 0;
+    memset(out + 24, 0, 8);
+    memcpy(out + 24, frame.data, frame.length);
+    return 32;
+  }
+
+  // candump log format: (seconds.microseconds) can0 123#0011223344556677
+  int length = snprintf((char *)out, maximumExportRecordSize, (frame.flags & Flag_Extended) ? "(%lu.%06lu) can%d %08lX#" : "(%lu.%06lu) can%d %03lX#",
+                        (unsigned long)seconds, (unsigned long)microseconds, (frame.flags & Flag_Bus2) ? 1 : 0, (unsigned long)frame.id);
+  if (frame.flags & Flag_Remote) {
+    out[length++] = 'R';
+  } else {
+    for (uint8_t i = 0; i < frame.length; i++) {
+      const char hex[] = "0123456789ABCDEF";
+      out[length++] = hex[frame.data[i] >> 4];
+      out[length++] = hex[frame.data[i] & 0x0F];
+    }
+  }
+  out[length++] = '\n';
+
+  return length;
+}
+
+uint64_t CanCapture::timestampMicros() {
+  // Extend micros() to 64 bits, so long captures do not wrap after 71 minutes
+  uint32_t currentMicros = micros();
+  if (currentMicros < lastMicros) {
+    microsHigh += 0x100000000ULL;
+  }
+  lastMicros = currentMicros;
+  return microsHigh + currentMicros;
+}
+
+bool CanCapture::matchesFilters(uint32_t id) {
+  if (filterCount == 0) return true;
+
+  for (uint8_t i = 0; i < filterCount; i++) {
+    if ((id & filterMasks[i]) == filterIds[i]) return true;
+  }
+  return false;
+}
@@ -0,0 +1,115 @@
+// ####################################################################################################################
+//
+// Code part of CarCluster project by Andrej Rolih. See .ino file more details
+//
+// ####################################################################################################################
+
+#ifndef CAN_CAPTURE
+#define CAN_CAPTURE
+
+#include "Arduino.h"
+
+// Captures received and sent CAN frames into a ring buffer of fixed size records (PSRAM if available).
+// Frames are fed from the MCP_CAN frame hook, cost per frame is bounded (filters + one record copy) and measured.
+//
+// Capture can be started manually or armed to start when a frame with the start trigger ID is seen.
+// It stops manually, when the stop trigger ID is seen (after a number of post trigger frames) or when the buffer
+// is full (if stopWhenFull is set, otherwise oldest frames are overwritten).
+//
+// Captured frames can be exported as candump log text or as pcap (LINKTYPE_CAN_SOCKETCAN).
+class CanCapture {
+  CanCapture(const CanCapture &other) = delete;
+  CanCapture(CanCapture &&other) = delete;
+  CanCapture &operator=(const CanCapture &other) = delete;
+  CanCapture &operator=(CanCapture &&other) = delete;
+
+  public:
+    enum State {
+      State_Stopped = 0,
+      State_Armed,                         // Waiting for the start trigger
+      State_Capturing
+    };
+
+    enum ExportFormat {
+      ExportFormat_Candump = 0,
+      ExportFormat_Pcap
+    };
+
+    static const uint8_t maximumFilters = 8;
+    static const uint32_t noTrigger = 0xFFFFFFFF;
+    static const size_t maximumExportRecordSize = 64;  // Enough for one frame in any of the formats
+
+    CanCapture(size_t frameCapacity);
+    void begin();
+
+    // Called from the MCP_CAN frame hook
+    void captureFrame(uint8_t bus, bool transmitted, uint32_t id, bool extended, bool remote, uint8_t length, const uint8_t *data, bool failed);
+
+    // Configuration (only while stopped)
+    void clearFilters();
+    bool addFilter(uint32_t id, uint32_t mask);
+    void setTriggers(uint32_t startId, uint32_t stopId, uint16_t postTriggerFrames);
+    void setStopWhenFull(bool stopWhenFull) { this->stopWhenFull = stopWhenFull; }
+
+    void start();                          // Starts immediately or arms the start trigger if set
+    void stop();
+
+    State state() { return captureState; }
+    uint32_t capturedFrames() { return nextSequence - firstSequence; }
+    uint32_t storedFrames();
+    uint32_t overwrittenFrames() { return overwritten; }
+    uint32_t filteredFrames() { return filtered; }
+    uint32_t averageCostMicros() { return hookCalls > 0 ? (uint32_t)(totalCostMicros / hookCalls) : 0; }
+    uint32_t maximumCostMicros() { return maximumCost; }
+
+    // Export works with sequence numbers, so the ring can keep changing during a (slow) export.
+    // Frames that got overwritten in the meantime are skipped.
+    uint32_t oldestSequence();
+    uint32_t endSequence() { return nextSequence; }
+    size_t exportHeader(ExportFormat format, uint8_t *out);
+    size_t exportFrame(ExportFormat format, uint32_t sequence, uint8_t *out);  // Returns 0 if frame is not available
+
+  private:
+    struct Frame {
+      uint64_t timestamp;                  // Microseconds since boot
+      uint32_t id;
+      uint8_t length;
+      uint8_t flags;
+      uint8_t data[8];
+    };
+
+    static const uint8_t Flag_Transmitted = 0x01;
+    static const uint8_t Flag_Bus2 = 0x02;
+    static const uint8_t Flag_Extended = 0x04;
+    static const uint8_t Flag_Remote = 0x08;
+    static const uint8_t Flag_Failed = 0x10;
+
+    Frame *frames = nullptr;
+    size_t capacity;
+    uint32_t firstSequence = 0;            // Sequence number of the first frame of the current capture
+    uint32_t nextSequence = 0;
+
+    State captureState = State_Stopped;
+    bool stopWhenFull = false;
+    uint32_t filterIds[maximumFilters];
+    uint32_t filterMasks[maximumFilters];
+    uint8_t filterCount = 0;
+    uint32_t startTriggerId = noTrigger;
+    uint32_t stopTriggerId = noTrigger;
+    uint16_t postTriggerFrames = 0;
+    int32_t remainingPostTriggerFrames = -1;
+
+    uint32_t overwritten = 0;
+    uint32_t filtered = 0;
+    uint64_t totalCostMicros = 0;
+    uint32_t hookCalls = 0;
+    uint32_t maximumCost = 0;
+
+    uint32_t lastMicros = 0;
+    uint64_t microsHigh = 0;
+
+    uint64_t timestampMicros();
+    bool matchesFilters(uint32_t id);
+};
+
+#endif
@@ -0,0 +1,41 @@
+// ####################################################################################################################
+//
+// Code part of CarCluster project by Andrej Rolih. See .ino file more details
+//
+// ####################################################################################################################
+
+#include "DistanceIntegrator.h"
+
+DistanceIntegrator::DistanceIntegrator(uint32_t numerator, uint32_t denominator, uint32_t wrap) {
+  this->numerator = numerator;
+  this->denominator = denominator > 0 ? denominator : 1;
+  this->wrap = wrap;
+}
+
+uint32_t DistanceIntegrator::update(uint32_t rate) {
+  unsigned long currentTime = millis();
+  unsigned long elapsed = started ? currentTime - lastUpdateTime : 0;
+  lastUpdateTime = currentTime;
+  started = true;
+
+  return advance(rate, elapsed);
+}
+
+uint32_t DistanceIntegrator::advance(uint32_t rate, unsigned long elapsedMs) {
+  remainder += (uint64_t)rate * elapsedMs * numerator;
+  uint32_t units = remainder / denominator;
+  remainder -= (uint64_t)units * denominator;
+
+  if (wrap > 0) {
+    counter = (counter + units % wrap) % wrap;
+  } else {
+    counter += units;
+  }
+  return counter;
+}
+
+void DistanceIntegrator::reset() {
+  counter = 0;
+  remainder = 0;
+  started = false;
+}
@@ -0,0 +1,42 @@
+// ####################################################################################################################
+//
+// Code part of CarCluster project by Andrej Rolih. See .ino file more details
+//
+// ####################################################################################################################
+
+#ifndef DISTANCE_INTEGRATOR
+#define DISTANCE_INTEGRATOR
+
+#include "Arduino.h"
+
+// Integer distance (odometer) counter for clusters that derive distance from a counter in a CAN message.
+//
+// Every update adds rate * elapsed ms * numerator / denominator units, where elapsed is the actually measured time
+// since the previous update. The remainder of the division is carried over, so no distance is lost to rounding no
+// matter how often (or how irregularly) it is called. Only integer math is used.
+//
+// For a counter with N units per km and rate in km/h use numerator = N and denominator = 3600000.
+// The counter wraps to 0 when it reaches wrap (0 = wrap at 2^32).
+class DistanceIntegrator {
+  public:
+    static const uint32_t msPerHour = 3600000;
+
+    DistanceIntegrator(uint32_t numerator, uint32_t denominator, uint32_t wrap = 0);
+
+    uint32_t update(uint32_t rate);                      // Uses millis() to measure the elapsed time
+    uint32_t advance(uint32_t rate, unsigned long elapsedMs);
+    uint32_t value() { return counter; }
+    void reset();
+
+  private:
+    uint32_t numerator;
+    uint32_t denominator;
+    uint32_t wrap;
+
+    uint32_t counter = 0;
+    uint64_t remainder = 0;                              // Fraction of a unit, in 1 / denominator
+    unsigned long lastUpdateTime = 0;
+    bool started = false;
+};
+
+#endif
@@ -0,0 +1,55 @@
+// ####################################################################################################################
+//
+// Code part of CarCluster project by Andrej Rolih. See .ino file more details
+//
+// ####################################################################################################################
+
+#include "FanoutPublisher.h"
+
+FanoutPublisher::FanoutPublisher(GameState& game, IPAddress multicastAddress, int port, unsigned long minimumInterval, unsigned long heartbeatInterval): gameState(game) {
+  this->multicastAddress = multicastAddress;
+  this->port = port;
+  this->minimumInterval = minimumInterval;
+  this->heartbeatInterval = heartbeatInterval;
+}
+
+void FanoutPublisher::update() {
+  unsigned long currentTime = millis();
+  unsigned long sinceLastPublish = currentTime - lastPublishTime;
+  GameStateSnapshot snapshot = GameStateSnapshot::fromGame(gameState);
+
+  // Button presses do not wait for the next interval. One press per packet, the others go out on the next updates
+  ButtonEvent buttonEvent;
+  bool hasButtonEvent = gameState.nextButtonEvent(buttonEventPosition, buttonEvent);
+  if (hasButtonEvent) {
+    snapshot.setButtonEvent(buttonEvent);
+  } else if (sinceLastPublish < minimumInterval) {
+    return;
+  }
+
+  if (!hasButtonEvent && snapshot.changedFields(lastPublished) == 0 && sinceLastPublish < heartbeatInterval) {
+    return;
+  }
+
+  uint8_t packet[FanoutGame::packetSize];
+  sequence++;
+  packet[0] = 'C';
+  packet[1] = 'F';
+  packet[2] = FanoutGame::protocolVersion;
+  packet[3] = 0;
+  packet[4] = sequence & 0xFF;
+  packet[5] = (sequence >> 8) & 0xFF;
+  packet[6] = (sequence >> 16) & 0xFF;
+  packet[7] = (sequence >> 24) & 0xFF;
+  size_t length = FanoutGame::headerSize + snapshot.encode(GameStateSnapshot::allFields, packet + FanoutGame::headerSize);
+
+  if (fanoutUdp.writeTo(packet, length, multicastAddress, port) == length) {
+    sent++;
+  } else {
+    failed++;
+  }
+
+  lastPublished = snapshot;
+  lastPublished.setButtonEvent({ 0, 0 });
+  lastPublishTime = currentTime;
+}
@@ -0,0 +1,43 @@
+// ####################################################################################################################
+//
+// Code part of CarCluster project by Andrej Rolih. See .ino file more details
+//
+// ####################################################################################################################
+
+#ifndef FANOUT_PUBLISHER
+#define FANOUT_PUBLISHER
+
+#include "Arduino.h"
+#include "AsyncUDP.h" // For UDP multicast (system library part of ESP core)
+
+#include "../Games/GameSimulation.h"
+#include "../Games/GameStateSnapshot.h"
+#include "../Games/FanoutGame.h"
+
+// Leader side of the telemetry fan-out. Re-publishes the decoded game state to follower clusters using UDP multicast.
+// A packet is sent whenever the state changes (but not more often than minimumInterval) and at least every heartbeatInterval.
+class FanoutPublisher {
+  public:
+    FanoutPublisher(GameState& game, IPAddress multicastAddress, int port, unsigned long minimumInterval, unsigned long heartbeatInterval);
+    void update();
+
+    unsigned long sentPackets() { return sent; }
+    unsigned long failedPackets() { return failed; }
+
+  private:
+    GameState &gameState;
+    IPAddress multicastAddress;
+    int port;
+    unsigned long minimumInterval;
+    unsigned long heartbeatInterval;
+    AsyncUDP fanoutUdp;
+
+    GameStateSnapshot lastPublished;
+    unsigned long lastPublishTime = 0;
+    uint32_t sequence = 0;
+    uint32_t buttonEventPosition = 0;
+    unsigned long sent = 0;
+    unsigned long failed = 0;
+};
+
+#endif
@@ -0,0 +1,157 @@
+// ####################################################################################################################
+//
+// Code part of CarCluster project by Andrej Rolih. See .ino file more details
+//
+// ####################################################################################################################
+
+#include "FrameValidator.h"
+
+int32_t ClusterFrameDecoder::expectedValue(uint8_t signal, GameState &game) {
+  switch (signal) {
+    case LatencySignal_Speed: return game.configuration.speedCalibration.apply(game.speed);
+    case LatencySignal_RPM: return game.configuration.rpmCalibration.apply(game.rpm);
+    case LatencySignal_Gear:
+      // Clusters show the 10th manual gear and S as D
+      if (game.gear == GearState_Manual_10 || game.gear == GearState_Auto_S) return GearState_Auto_D;
+      return game.gear;
+    case LatencySignal_Indicators: return game.leftTurningIndicator | game.rightTurningIndicator << 1;
+    default: return 0;
+  }
+}
+
+FrameValidator::FrameValidator(GameState& game, const CanBusLoad::Bus *buses, uint8_t busCount, ClusterFrameDecoder *decoder, bool enabled): gameState(game) {
+  this->decoder = decoder;
+  this->enabled = enabled;
+
+  for (uint8_t b = 0; b < busCount; b++) {
+    for (uint8_t i = 0; i < buses[b].frameCount; i++) {
+      uint8_t bus = busCount > 1 ? b + 1 : 0;
+      uint32_t id = buses[b].frames[i].id;
+      if (findFrame(bus, id) != nullptr || scheduledFrameCount >= maximumFrames) continue;
+
+      // Insertion sort by ID and bus, so findFrame() can do a binary search
+      uint8_t position = scheduledFrameCount++;
+      while (position > 0 && (frames[position - 1].id > id || (frames[position - 1].id == id && frames[position - 1].bus > bus))) {
+        frames[position] = frames[position - 1];
+        position--;
+      }
+
+      FrameStats &stats = frames[position];
+      stats.id = id;
+      stats.bus = bus;
+      stats.period = buses[b].frames[i].period;
+    }
+  }
+  reset();
+}
+
+void FrameValidator::setEnabled(bool enabled) {
+  if (enabled && !this->enabled) {
+    // The gap while disabled is not a late frame
+    for (uint8_t i = 0; i < scheduledFrameCount; i++) {
+      frames[i].counterSeen = false;
+      frames[i].restart = true;
+    }
+  }
+  this->enabled = enabled;
+}
+
+void FrameValidator::frameSent(uint8_t bus, uint32_t id, uint8_t len, const uint8_t *buf, uint32_t time) {
+  if (!enabled) return;
+
+  FrameStats *stats = findFrame(bus, id);
+  if (stats == nullptr) {
+    unscheduled++;
+    return;
+  }
+
+  DecodedFrame decoded;
+  if (decoder != nullptr) decoder->decode(id, len, buf, decoded);
+  if (decoded.checksumPresent && !decoded.checksumValid) stats->checksumErrors++;
+
+  uint32_t interval = time - stats->lastTime;
+  bool firstOfBurst = stats->frames == 0 || stats->restart || interval >= stats->period / 4;
+  stats->frames++;
+
+  if (firstOfBurst) {
+    if (stats->frames > 1 && !stats->restart) {
+      if (interval > stats->period * 5UL / 4) stats->lateFrames++;
+      if (interval < stats->period * 3UL / 4) stats->earlyFrames++;
+      if (interval > stats->maximumInterval) stats->maximumInterval = interval;
+    }
+    stats->lastTime = time;
+    stats->restart = false;
+
+    if (decoded.counterPresent) {
+      bool inSequence = decoded.counterStep == 0 ? decoded.counter != stats->lastCounter
+                                                 : decoded.counter == (stats->lastCounter + decoded.counterStep) % decoded.counterModulo;
+      if (stats->counterSeen && !inSequence) {
+        stats->counterErrors++;
+      }
+      stats->lastCounter = decoded.counter;
+      stats->counterSeen = true;
+    }
+  }
+
+  if (decoded.signals != 0) checkSignals(id, decoded);
+}
+
+void FrameValidator::reset() {
+  for (uint8_t i = 0; i < scheduledFrameCount; i++) {
+    FrameStats &stats = frames[i];
+    stats.frames = 0;
+    stats.checksumErrors = 0;
+    stats.counterErrors = 0;
+    stats.lateFrames = 0;
+    stats.earlyFrames = 0;
+    stats.maximumInterval = 0;
+    stats.lastTime = 0;
+    stats.counterSeen = false;
+    stats.restart = false;
+  }
+  memset(signals, 0, sizeof(signals));
+  unscheduled = 0;
+}
+
+bool FrameValidator::isMissing(uint8_t frame, uint32_t time) {
+  const FrameStats &stats = frames[frame];
+  return stats.frames == 0 || time - stats.lastTime > stats.period * 2UL;
+}
+
+FrameValidator::FrameStats* FrameValidator::findFrame(uint8_t bus, uint32_t id) {
+  // First entry with this ID, the same ID is in the schedule at most once per bus
+  uint8_t low = 0;
+  uint8_t high = scheduledFrameCount;
+  while (low < high) {
+    uint8_t middle = (low + high) / 2;
+    if (frames[middle].id < id) {
+      low = middle + 1;
+    } else {
+      high = middle;
+    }
+  }
+
+  for (uint8_t i = low; i < scheduledFrameCount && frames[i].id == id; i++) {
+    if (frames[i].bus == 0 || frames[i].bus == bus) return &frames[i];
+  }
+  return nullptr;
+}
+
+void FrameValidator::checkSignals(uint32_t id, const DecodedFrame &decoded) {
+  for (uint8_t signal = 0; signal < LatencySignal_Count; signal++) {
+    if ((decoded.signals & (1 << signal)) == 0) continue;
+
+    int32_t expected = decoder->expectedValue(signal, gameState);
+    int32_t difference = decoded.values[signal] - expected;
+    SignalStats &stats = signals[signal];
+
+    if (abs(difference) <= decoder->tolerance(signal)) {
+      stats.matches++;
+    } else {
+      stats.mismatches++;
+      stats.lastMismatchId = id;
+      stats.lastMismatchDecoded = decoded.values[signal];
+      stats.lastMismatchExpected = expected;
+    }
+  }
+}
@@ -0,0 +1,122 @@
+// ####################################################################################################################
+//
+// Code part of CarCluster project by Andrej Rolih. See .ino file more details
+//
+// ####################################################################################################################
+
+#ifndef FRAME_VALIDATOR
+#define FRAME_VALIDATOR
+
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "CanBusLoad.h"
+#include "SignalLatency.h"
+#include "../Games/GameSimulation.h"
+
+// What a cluster decoder found in one frame
+struct DecodedFrame {
+  bool checksumPresent = false;
+  bool checksumValid = false;
+  bool counterPresent = false;
+  uint8_t counter = 0;
+  uint8_t counterModulo = 16;
+  uint8_t counterStep = 1;                 // How much the counter advances from one cluster update to the next, 0 if the
+                                           // frame reuses the counter of faster frames and it only has to change
+  uint8_t signals = 0;                     // Bit mask of 1 << LatencySignal that have a value below
+  int32_t values[LatencySignal_Count] = {};
+};
+
+// Decodes the frames of one cluster back into signals (speed in km/h, RPM, gear as GearState, indicators as
+// left | right << 1) and checks their checksums and counters. See ClusterFrameDecoders.h.
+class ClusterFrameDecoder {
+  public:
+    virtual ~ClusterFrameDecoder() {}
+
+    virtual void decode(uint32_t id, uint8_t len, const uint8_t *buf, DecodedFrame &frame) = 0;
+
+    // Value the cluster should send for the current game state, in the same units as decode()
+    virtual int32_t expectedValue(uint8_t signal, GameState &game);
+
+    // Largest difference between the decoded and the expected value that still matches (resolution of the encoding)
+    virtual int32_t tolerance(uint8_t signal) { return 0; }
+};
+
+// Checks every frame the cluster sends against its schedule (ClusterBusSchedules.h) and, with a decoder, against the
+// game state: checksum, alive counter, period and the decoded signal values.
+//
+// Runs from the CAN frame hook for every successfully sent frame while enabled, so it sees exactly what went out on
+// the bus. It is off by default (FRAME_VALIDATOR_ENABLED in the .ino, serial action 43, /api/validation), each frame
+// costs a decode and a binary search over the scheduled IDs. Frames the cluster sends more than once per update (same
+// ID with different content) are one burst, only the first one counts for the period and counter checks. A frame is
+// late if it came more than 25% after its period, early if more than 25% before and missing if it was never sent or
+// not sent for two periods. Signals are compared with the game state at the time the frame is sent, which is what the
+// cluster encoded, so frames that were not made by the cluster (serial action 0, passthrough) can show up as
+// mismatches. Frames that are not in the schedule are only counted.
+//
+// Time is passed in (ms) and nothing here uses Arduino, so the validator and the decoders also run in the host
+// program that drives the clusters with random game states (Tools/validate.cpp).
+class FrameValidator {
+  FrameValidator(const FrameValidator &other) = delete;
+  FrameValidator(FrameValidator &&other) = delete;
+  FrameValidator &operator=(const FrameValidator &other) = delete;
+  FrameValidator &operator=(FrameValidator &&other) = delete;
+
+  public:
+    static const uint8_t maximumFrames = 48;
+
+    struct FrameStats {
+      uint32_t id;
+      uint8_t bus;                         // 1 or 2, 0 if the schedule has a single bus (any bus matches)
+      uint16_t period;                     // ms
+      uint32_t frames;
+      uint32_t checksumErrors;
+      uint32_t counterErrors;
+      uint32_t lateFrames;
+      uint32_t earlyFrames;
+      uint32_t maximumInterval;            // ms
+      uint32_t lastTime;                   // Time of the last burst (ms)
+      uint8_t lastCounter;
+      bool counterSeen;
+      bool restart;                        // No period check for the next frame (validator was disabled)
+    };
+
+    struct SignalStats {
+      uint32_t matches;
+      uint32_t mismatches;
+      uint32_t lastMismatchId;
+      int32_t lastMismatchDecoded;
+      int32_t lastMismatchExpected;
+    };
+
+    FrameValidator(GameState& game, const CanBusLoad::Bus *buses, uint8_t busCount, ClusterFrameDecoder *decoder, bool enabled = true);
+    void frameSent(uint8_t bus, uint32_t id, uint8_t len, const uint8_t *buf, uint32_t time);  // From the CAN frame hook
+    void reset();
+
+    // Counters are kept while disabled, periods restart from the next frame once enabled again
+    void setEnabled(bool enabled);
+    bool isEnabled() { return enabled; }
+
+    bool hasDecoder() { return decoder != nullptr; }
+    uint8_t frameCount() { return scheduledFrameCount; }   // Frames are sorted by ID and bus
+    const FrameStats& frameStats(uint8_t frame) { return frames[frame]; }
+    bool isMissing(uint8_t frame, uint32_t time);
+    const SignalStats& signalStats(uint8_t signal) { return signals[signal]; }
+    uint32_t unscheduledFrames() { return unscheduled; }
+
+  private:
+    GameState &gameState;
+    ClusterFrameDecoder *decoder;
+    bool enabled;
+
+    FrameStats frames[maximumFrames];
+    uint8_t scheduledFrameCount = 0;
+    SignalStats signals[LatencySignal_Count];
+    uint32_t unscheduled = 0;
+
+    FrameStats* findFrame(uint8_t bus, uint32_t id);
+    void checkSignals(uint32_t id, const DecodedFrame &decoded);
+};
+
+#endif
@@ -0,0 +1,95 @@
+// ####################################################################################################################
+//
+// Code part of CarCluster project by Andrej Rolih. See .ino file more details
+//
+// ####################################################################################################################
+
+#include "FuelPotDriver.h"
+
+FuelPotDriver::FuelPotDriver(uint8_t maximumStepsPerUpdate) {
+  this->maximumStepsPerUpdate = maximumStepsPerUpdate > 0 ? maximumStepsPerUpdate : 1;
+}
+
+void FuelPotDriver::begin(int incPin, int dirPin, int pot1CsPin, int pot2CsPin) {
+  this->incPin = incPin;
+  this->dirPin = dirPin;
+  csPins[0] = pot1CsPin;
+  csPins[1] = pot2CsPin;
+
+  // Order matters, CS going high while INC is high would store the wiper position
+  for (uint8_t pot = 0; pot < potCount; pot++) {
+    digitalWrite(csPins[pot], HIGH);
+  }
+  digitalWrite(incPin, HIGH);
+  digitalWrite(dirPin, HIGH);
+
+  for (uint8_t pot = 0; pot < potCount; pot++) {
+    pinMode(csPins[pot], OUTPUT);
+  }
+  pinMode(incPin, OUTPUT);
+  pinMode(dirPin, OUTPUT);
+
+  started = true;
+}
+
+void FuelPotDriver::setTarget(uint8_t pot, uint8_t position) {
+  if (pot >= potCount) return;
+  target[pot] = position > maximumPosition ? maximumPosition : position;
+}
+
+bool FuelPotDriver::isSettled() {
+  for (uint8_t pot = 0; pot < potCount; pot++) {
+    if (stepsNeeded(pot) > 0) return false;
+  }
+  return true;
+}
+
+void FuelPotDriver::update() {
+  if (!started) return;
+
+  uint8_t budget = maximumStepsPerUpdate;
+
+  for (uint8_t i = 0; i < potCount && budget > 0; i++) {
+    uint8_t pot = (nextPot + i) % potCount;
+    uint8_t steps = stepsNeeded(pot);
+    if (steps == 0) continue;
+    if (steps > budget) steps = budget;
+
+    if (homingSteps[pot] > 0) {
+      move(pot, true, steps);
+      homingSteps[pot] -= steps;
+    } else if (target[pot] > position[pot]) {
+      move(pot, true, steps);
+      position[pot] += steps;
+    } else {
+      move(pot, false, steps);
+      position[pot] -= steps;
+    }
+    budget -= steps;
+  }
+
+  nextPot = (nextPot + 1) % potCount;
+}
+
+uint8_t FuelPotDriver::stepsNeeded(uint8_t pot) {
+  if (homingSteps[pot] > 0) return homingSteps[pot];
+  return target[pot] > position[pot] ? target[pot] - position[pot] : position[pot] - target[pot];
+}
+
+void FuelPotDriver::move(uint8_t pot, bool up, uint8_t steps) {
+  // Same pulse sequence as the X9C10X library, timing from the X9C102 datasheet (page 5)
+  digitalWrite(dirPin, up ? HIGH : LOW);
+  delayMicroseconds(3);                    // tDI
+
+  digitalWrite(csPins[pot], LOW);
+  while (steps--) {
+    digitalWrite(incPin, HIGH);
+    delayMicroseconds(1);
+    digitalWrite(incPin, LOW);             // Wiper moves on the falling edge
+    delayMicroseconds(1);
+  }
+
+  // INC is low, so deselecting does not store the position
+  digitalWrite(csPins[pot], HIGH);
+  digitalWrite(incPin, HIGH);
+}
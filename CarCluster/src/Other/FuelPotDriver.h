@@ -0,0 +1,59 @@
+// ####################################################################################################################
+//
+// Code part of CarCluster project by Andrej Rolih. See .ino file more details
+//
+// ####################################################################################################################
+
+#ifndef FUEL_POT_DRIVER
+#define FUEL_POT_DRIVER
+
+#include "Arduino.h"
+
+// Non blocking driver for up to two X9C10X digital potentiometers that share the INC and DIR pins
+// (each pot has its own CS pin).
+//
+// setTarget() only records the wanted wiper position. The wipers are moved by update(), which does at most
+// maximumStepsPerUpdate steps per call (a few microseconds each), so a large fuel change is spread over several
+// loop iterations instead of blocking CAN traffic. Only one CS is ever low at a time and the pots take turns,
+// so both pots keep moving even when one of them has a long way to go.
+//
+// The wiper position cannot be read from the chip, so each pot is first homed by driving it to the top end.
+// Position is never stored to the pot's non volatile memory.
+class FuelPotDriver {
+  FuelPotDriver(const FuelPotDriver &other) = delete;
+  FuelPotDriver(FuelPotDriver &&other) = delete;
+  FuelPotDriver &operator=(const FuelPotDriver &other) = delete;
+  FuelPotDriver &operator=(FuelPotDriver &&other) = delete;
+
+  public:
+    static const uint8_t potCount = 2;
+    static const uint8_t maximumPosition = 99;
+
+    FuelPotDriver(uint8_t maximumStepsPerUpdate = 8);
+    void begin(int incPin, int dirPin, int pot1CsPin, int pot2CsPin);
+
+    void setTarget(uint8_t pot, uint8_t position);
+    void update();
+
+    uint8_t targetPosition(uint8_t pot) { return pot < potCount ? target[pot] : 0; }
+    uint8_t currentPosition(uint8_t pot) { return pot < potCount ? position[pot] : 0; }  // Only valid once homed
+    bool isHomed(uint8_t pot) { return pot < potCount && homingSteps[pot] == 0; }
+    bool isSettled();
+
+  private:
+    uint8_t incPin;
+    uint8_t dirPin;
+    uint8_t csPins[potCount];
+    bool started = false;
+    uint8_t maximumStepsPerUpdate;
+
+    uint8_t target[potCount] = { maximumPosition, maximumPosition };
+    uint8_t position[potCount] = { maximumPosition, maximumPosition };
+    uint8_t homingSteps[potCount] = { maximumPosition, maximumPosition };  // Remaining steps up until the position is known
+    uint8_t nextPot = 0;                   // Pot that gets the step budget first on the next update
+
+    uint8_t stepsNeeded(uint8_t pot);
+    void move(uint8_t pot, bool up, uint8_t steps);
+};
+
+#endif
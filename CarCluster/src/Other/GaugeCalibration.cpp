@@ -0,0 +1,52 @@
+// ####################################################################################################################
+//
+// Code part of CarCluster project by Andrej Rolih. See .ino file more details
+//
+// ####################################################################################################################
+
+#include "GaugeCalibration.h"
+
+#include <string.h>
+
+GaugeCalibration::GaugeCalibration(): GaugeCalibration(0, 255, 0, 255) {
+}
+
+GaugeCalibration::GaugeCalibration(int32_t inputMinimum, int32_t inputMaximum, int32_t outputMinimum, int32_t outputMaximum) {
+  int32_t pointInputs[2] = { inputMinimum, inputMaximum };
+  int32_t pointOutputs[2] = { outputMinimum, outputMaximum };
+  if (!setPoints(pointInputs, pointOutputs, 2)) {
+    // Degenerate range, output is constant
+    pointInputs[1] = inputMinimum + 1;
+    pointOutputs[1] = outputMinimum;
+    setPoints(pointInputs, pointOutputs, 2);
+  }
+}
+
+bool GaugeCalibration::setPoints(const int32_t *inputs, const int32_t *outputs, uint8_t count) {
+  if (count < 2 || count > maximumPoints) return false;
+  for (uint8_t i = 1; i < count; i++) {
+    if (inputs[i] <= inputs[i - 1]) return false;
+    // Keeps the interpolation product in apply() within 62 bits
+    if ((int64_t)inputs[i] - inputs[i - 1] > maximumSpan) return false;
+    if ((int64_t)outputs[i] - outputs[i - 1] > maximumSpan || (int64_t)outputs[i - 1] - outputs[i] > maximumSpan) return false;
+  }
+
+  memcpy(this->inputs, inputs, count * sizeof(int32_t));
+  memcpy(this->outputs, outputs, count * sizeof(int32_t));
+  this->count = count;
+  return true;
+}
+
+int32_t GaugeCalibration::apply(int32_t input) const {
+  if (input <= inputs[0]) return outputs[0];
+  if (input >= inputs[count - 1]) return outputs[count - 1];
+
+  uint8_t segment = 0;
+  while (input >= inputs[segment + 1]) segment++;
+
+  // Rounded to the nearest output, halves away from the start of the segment
+  int64_t inputLength = (int64_t)inputs[segment + 1] - inputs[segment];
+  int64_t product = ((int64_t)outputs[segment + 1] - outputs[segment]) * ((int64_t)input - inputs[segment]);
+  int64_t rounding = product >= 0 ? inputLength / 2 : -(inputLength / 2);
+  return (int32_t)(outputs[segment] + (product + rounding) / inputLength);
+}
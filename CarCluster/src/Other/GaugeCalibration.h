@@ -0,0 +1,42 @@
+// ####################################################################################################################
+//
+// Code part of CarCluster project by Andrej Rolih. See .ino file more details
+//
+// ####################################################################################################################
+
+#ifndef GAUGE_CALIBRATION
+#define GAUGE_CALIBRATION
+
+#include <stdint.h>
+
+// Maps a game value (speed, RPM, temperature, fuel, ...) to the value a gauge needs, through a piecewise linear
+// curve of up to 8 calibration points. Inputs outside the first and last point are clamped.
+//
+// apply() finds the segment with at most 7 integer comparisons and interpolates it with one division, rounded to the
+// nearest output. Every calibration point is hit exactly and the curve keeps its corners, a monotonic set of points
+// gives a monotonic curve.
+class GaugeCalibration {
+  public:
+    static const uint8_t maximumPoints = 8;
+    static const int64_t maximumSpan = 0x7FFFFFFF;  // Input and output span of a segment
+
+    GaugeCalibration();                    // Identity over 0-255
+    GaugeCalibration(int32_t inputMinimum, int32_t inputMaximum, int32_t outputMinimum, int32_t outputMaximum);
+
+    // Inputs must be strictly increasing and no segment may span more than maximumSpan, in the input or the output.
+    // Returns false (and keeps the current curve) if points are not valid.
+    bool setPoints(const int32_t *inputs, const int32_t *outputs, uint8_t count);
+
+    int32_t apply(int32_t input) const;
+
+    uint8_t pointCount() const { return count; }
+    int32_t pointInput(uint8_t index) const { return inputs[index]; }
+    int32_t pointOutput(uint8_t index) const { return outputs[index]; }
+
+  private:
+    int32_t inputs[maximumPoints];
+    int32_t outputs[maximumPoints];
+    uint8_t count = 0;
+};
+
+#endif
@@ -0,0 +1,189 @@
+// ####################################################################################################################
+//
+// Code part of CarCluster project by Andrej Rolih. See .ino file more details
+//
+// ####################################################################################################################
+
+#include "InjectionSequencer.h"
+
+InjectionSequencer::InjectionSequencer(CanBusController **controllers, uint8_t controllerCount) {
+  this->controllers = controllers;
+  this->controllerCount = controllerCount;
+}
+
+void InjectionSequencer::update() {
+  if (sequencerState != State_Running) return;
+
+  uint16_t hold = stepHold();
+  if (hold > 0 && millis() - stepStartTime >= hold && !step(true)) return;
+
+  if ((long)(millis() - nextSendTime) >= 0) sendActiveFrame();
+}
+
+bool InjectionSequencer::start(const Program &program) {
+  if (!isValid(program)) return false;
+
+  currentProgram = program;
+  activeLoop = 0;
+  logStart = 0;
+  logLength = 0;
+  framesSent = 0;
+  framesFailed = 0;
+  sequencerState = State_Running;
+  activateStep(0);
+  return true;
+}
+
+void InjectionSequencer::stop() {
+  if (sequencerState == State_Running) sequencerState = State_Idle;
+}
+
+bool InjectionSequencer::step(bool forward) {
+  if (sequencerState != State_Running) return false;
+
+  if (!forward) {
+    if (activeStep == 0) return false;
+    activateStep(activeStep - 1);
+    return true;
+  }
+
+  if (activeStep + 1 < stepCount()) {
+    activateStep(activeStep + 1);
+    return true;
+  }
+
+  activeLoop++;
+  if (currentProgram.loops != 0 && activeLoop >= currentProgram.loops) {
+    sequencerState = State_Finished;
+    return false;
+  }
+  activateStep(0);
+  return true;
+}
+
+uint16_t InjectionSequencer::stepCount() {
+  switch (currentProgram.type) {
+    case Program_Sweep: return (currentProgram.to - currentProgram.from) / currentProgram.increment + 1;
+    case Program_BitWalk: return currentProgram.lastBit - currentProgram.firstBit + 1;
+    case Program_Cycle: return currentProgram.frameCount;
+    default: return 0;
+  }
+}
+
+bool InjectionSequencer::frameForStep(uint16_t step, Frame &frame) {
+  if (step >= stepCount()) return false;
+
+  switch (currentProgram.type) {
+    case Program_Sweep:
+      frame = currentProgram.base;
+      frame.data[currentProgram.byteIndex] = currentProgram.from + step * currentProgram.increment;
+      break;
+    case Program_BitWalk: {
+      uint8_t bit = currentProgram.firstBit + step;
+      frame = currentProgram.base;
+      frame.data[bit / 8] ^= 1 << (bit % 8);
+      break;
+    }
+    case Program_Cycle:
+      frame = currentProgram.frames[step];
+      break;
+    default:
+      return false;
+  }
+  return true;
+}
+
+const char* InjectionSequencer::programName(ProgramType type) {
+  switch (type) {
+    case Program_Sweep: return "sweep";
+    case Program_BitWalk: return "bits";
+    case Program_Cycle: return "cycle";
+    default: return "none";
+  }
+}
+
+InjectionSequencer::ProgramType InjectionSequencer::programType(const char *name) {
+  if (name == nullptr) return Program_None;
+  if (strcmp(name, "sweep") == 0) return Program_Sweep;
+  if (strcmp(name, "bits") == 0) return Program_BitWalk;
+  if (strcmp(name, "cycle") == 0) return Program_Cycle;
+  return Program_None;
+}
+
+CanBusController* InjectionSequencer::controller() {
+  for (uint8_t i = 0; i < controllerCount; i++) {
+    if (controllers[i]->bus() == currentProgram.bus) return controllers[i];
+  }
+  return controllers[0];
+}
+
+bool InjectionSequencer::isValid(const Program &program) {
+  bool busFound = false;
+  for (uint8_t i = 0; i < controllerCount; i++) {
+    if (controllers[i]->bus() == program.bus) busFound = true;
+  }
+  if (!busFound || !isValidHold(program.hold)) return false;
+
+  switch (program.type) {
+    case Program_Sweep:
+      return isValid(program.base) && program.byteIndex < program.base.length && program.from <= program.to && program.increment > 0;
+    case Program_BitWalk:
+      return isValid(program.base) && program.firstBit <= program.lastBit && program.lastBit < program.base.length * 8;
+    case Program_Cycle:
+      if (program.frameCount == 0 || program.frameCount > maximumCycleFrames) return false;
+      for (uint8_t i = 0; i < program.frameCount; i++) {
+        if (!isValid(program.frames[i]) || !isValidHold(program.frames[i].hold)) return false;
+      }
+      return true;
+    default:
+      return false;
+  }
+}
+
+bool InjectionSequencer::isValid(const Frame &frame) {
+  return frame.length <= 8 && frame.id <= (frame.extended ? 0x1FFFFFFFUL : 0x7FFUL);
+}
+
+bool InjectionSequencer::isValidHold(uint16_t hold) {
+  // A step shorter than the minimum period would send a frame on every update
+  return hold == 0 || hold >= minimumPeriod;
+}
+
+void InjectionSequencer::activateStep(uint16_t step) {
+  activeStep = step;
+  frameForStep(step, activeFrame);
+  stepStartTime = millis();
+  // Sent right away, unless the last frame went out less than minimumPeriod ago (stepping by hand)
+  nextSendTime = (long)(stepStartTime - earliestSendTime) >= 0 ? stepStartTime : earliestSendTime;
+
+  StepRecord &record = stepLog[(logStart + logLength) % logSize];
+  record.time = stepStartTime;
+  record.step = step;
+  record.loop = activeLoop;
+  if (logLength < logSize) {
+    logLength++;
+  } else {
+    logStart = (logStart + 1) % logSize;
+  }
+}
+
+uint16_t InjectionSequencer::stepHold() {
+  if (currentProgram.type == Program_Cycle && activeFrame.hold > 0) return activeFrame.hold;
+  return currentProgram.hold;
+}
+
+void InjectionSequencer::sendActiveFrame() {
+  nextSendTime = millis() + (activeFrame.period > minimumPeriod ? activeFrame.period : minimumPeriod);
+  earliestSendTime = millis() + minimumPeriod;
+
+  // Skipped while the bus is off or the controller is not up yet, the step keeps its time
+  CanBusController *canController = controller();
+  if (!canController->isSending()) return;
+
+  uint32_t id = activeFrame.id | (activeFrame.extended ? CAN_IS_EXTENDED : 0);
+  if (canController->canInterface().sendMsgBuf(id, activeFrame.length, activeFrame.data) == CAN_OK) {
+    framesSent++;
+  } else {
+    framesFailed++;
+  }
+}
@@ -0,0 +1,135 @@
+// ####################################################################################################################
+//
+// Code part of CarCluster project by Andrej Rolih. See .ino file more details
+//
+// ####################################################################################################################
+
+#ifndef INJECTION_SEQUENCER
+#define INJECTION_SEQUENCER
+
+#include "Arduino.h"
+
+#include "CanBusController.h"
+
+// Runs frame injection programs for finding out what the frames of a new cluster do. A program is a list of steps,
+// each step is one frame that is sent every period ms while the step is active (hold ms, or until step() is called
+// when hold is 0):
+// - Sweep: byte N of a frame goes from one value to another in increments
+// - Bit walk: one bit of a frame is flipped per step (bit 0 is the lowest bit of byte 0, bit 63 the highest of byte 7)
+// - Cycle: a list of frames, each with its own period and hold
+// The program repeats a number of loops (0 = until stopped).
+//
+// At most one frame is sent per update() and never more often than minimumPeriod, so the cluster frames sent from the
+// same loop are not starved. A late frame is not caught up, the next one is scheduled a full period later.
+// The start of every step is logged, so what the cluster did (CAN capture, camera) can be matched to the step.
+class InjectionSequencer {
+  InjectionSequencer(const InjectionSequencer &other) = delete;
+  InjectionSequencer(InjectionSequencer &&other) = delete;
+  InjectionSequencer &operator=(const InjectionSequencer &other) = delete;
+  InjectionSequencer &operator=(InjectionSequencer &&other) = delete;
+
+  public:
+    enum ProgramType {
+      Program_None = 0,
+      Program_Sweep,
+      Program_BitWalk,
+      Program_Cycle
+    };
+
+    enum State {
+      State_Idle = 0,
+      State_Running,
+      State_Finished                       // All loops done, the log is kept until the next start
+    };
+
+    static const uint8_t maximumCycleFrames = 16;
+    static const uint8_t logSize = 64;
+    static const uint16_t minimumPeriod = 5;
+
+    struct Frame {
+      uint32_t id = 0;
+      bool extended = false;
+      uint8_t length = 8;
+      uint8_t data[8] = {};
+      uint16_t period = 100;               // ms between two sends of the frame while its step is active
+      uint16_t hold = 0;                   // Cycle only, ms the step is active (0 = hold of the program)
+    };
+
+    struct Program {
+      ProgramType type = Program_None;
+      uint8_t bus = 1;
+      uint16_t hold = 1000;                // ms each step is active (at least minimumPeriod), 0 = advance with step()
+      uint16_t loops = 1;                  // 0 = until stopped
+
+      Frame base;                          // Sweep and bit walk: the frame that is modified
+      uint8_t byteIndex = 0;               // Sweep
+      uint8_t from = 0;
+      uint8_t to = 255;
+      uint8_t increment = 1;
+      uint8_t firstBit = 0;                // Bit walk
+      uint8_t lastBit = 63;
+
+      uint8_t frameCount = 0;              // Cycle
+      Frame frames[maximumCycleFrames];
+    };
+
+    struct StepRecord {
+      uint32_t time;                       // ms since boot
+      uint16_t step;
+      uint16_t loop;
+    };
+
+    InjectionSequencer(CanBusController **controllers, uint8_t controllerCount);
+    void update();                         // Call every loop
+
+    bool start(const Program &program);    // False if the program is not valid, a running program is replaced
+    void stop();
+    bool step(bool forward);               // Next or previous step, also while steps advance on their own
+
+    State state() { return sequencerState; }
+    const Program& program() { return currentProgram; }
+    uint16_t stepCount();
+    uint16_t currentStep() { return activeStep; }
+    uint16_t currentLoop() { return activeLoop; }
+    bool frameForStep(uint16_t step, Frame &frame);
+    const Frame& activeStepFrame() { return activeFrame; }
+    uint32_t sentFrames() { return framesSent; }
+    uint32_t failedFrames() { return framesFailed; }
+
+    // Step log, oldest first
+    uint8_t logCount() { return logLength; }
+    const StepRecord& logRecord(uint8_t index) { return stepLog[(logStart + index) % logSize]; }
+
+    // "sweep", "bits" and "cycle", as used by the serial action and the web API
+    static const char* programName(ProgramType type);
+    static ProgramType programType(const char *name);
+
+  private:
+    CanBusController **controllers;
+    uint8_t controllerCount;
+
+    Program currentProgram;
+    State sequencerState = State_Idle;
+    uint16_t activeStep = 0;
+    uint16_t activeLoop = 0;
+    Frame activeFrame;
+    unsigned long stepStartTime = 0;
+    unsigned long nextSendTime = 0;
+    unsigned long earliestSendTime = 0;   // Last send + minimumPeriod, also across steps and programs
+    uint32_t framesSent = 0;
+    uint32_t framesFailed = 0;
+
+    StepRecord stepLog[logSize];
+    uint8_t logStart = 0;
+    uint8_t logLength = 0;
+
+    CanBusController* controller();
+    bool isValid(const Program &program);
+    bool isValid(const Frame &frame);
+    bool isValidHold(uint16_t hold);
+    void activateStep(uint16_t step);
+    uint16_t stepHold();
+    void sendActiveFrame();
+};
+
+#endif
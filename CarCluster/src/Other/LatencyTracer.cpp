@@ -0,0 +1,70 @@
+// ####################################################################################################################
+//
+// Code part of CarCluster project by Andrej Rolih. See .ino file more details
+//
+// ####################################################################################################################
+
+#include "LatencyTracer.h"
+
+LatencyTracer::LatencyTracer(GameState& game, const SignalFrame *frames, uint8_t frameCount): gameState(game) {
+  this->frames = frames;
+  this->frameCount = frameCount;
+
+  for (uint8_t i = 0; i < frameCount; i++) {
+    tracedSignals |= frames[i].signals;
+  }
+}
+
+void LatencyTracer::update() {
+  uint32_t arrivalTime = gameState.telemetryArrivalTime;
+  bool newPacket = arrivalTime != lastArrivalTime;
+  lastArrivalTime = arrivalTime;
+
+  for (uint8_t signal = 0; signal < LatencySignal_Count; signal++) {
+    int value = signalValue(signal);
+    if (value == lastValues[signal]) continue;
+    lastValues[signal] = value;
+
+    uint8_t mask = 1 << signal;
+    if (!newPacket || (tracedSignals & mask) == 0 || (pendingSignals & mask) != 0) continue;
+
+    pendingSignals |= mask;
+    pendingArrivalTimes[signal] = arrivalTime;
+  }
+}
+
+void LatencyTracer::frameSent(uint32_t id) {
+  if (pendingSignals == 0) return;
+
+  for (uint8_t i = 0; i < frameCount; i++) {
+    if (frames[i].id != id) continue;
+
+    uint8_t signals = frames[i].signals & pendingSignals;
+    if (signals == 0) return;
+
+    uint32_t currentTime = micros();
+    for (uint8_t signal = 0; signal < LatencySignal_Count; signal++) {
+      if ((signals & (1 << signal)) == 0) continue;
+      histograms[signal].record(currentTime - pendingArrivalTimes[signal]);
+    }
+    pendingSignals &= ~signals;
+    return;
+  }
+}
+
+void LatencyTracer::reset() {
+  for (uint8_t signal = 0; signal < LatencySignal_Count; signal++) {
+    histograms[signal].reset();
+  }
+  pendingSignals = 0;
+}
+
+int LatencyTracer::signalValue(uint8_t signal) {
+  switch (signal) {
+    case LatencySignal_Speed: return gameState.speed;
+    case LatencySignal_RPM: return gameState.rpm;
+    case LatencySignal_Gear: return gameState.gear;
+    case LatencySignal_Indicators: return gameState.leftTurningIndicator | gameState.rightTurningIndicator << 1;
+    default: return 0;
+  }
+}
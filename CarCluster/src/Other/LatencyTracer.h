@@ -0,0 +1,53 @@
+// ####################################################################################################################
+//
+// Code part of CarCluster project by Andrej Rolih. See .ino file more details
+//
+// ####################################################################################################################
+
+#ifndef LATENCY_TRACER
+#define LATENCY_TRACER
+
+#include "Arduino.h"
+
+#include "SignalLatency.h"
+#include "../Games/GameSimulation.h"
+
+// Measures how long it takes from a telemetry packet arriving (Forza/BeamNG/fan-out UDP packet, Simhub serial line)
+// to the first CAN frame that carries the new value of a signal (speed, RPM, gear, indicators).
+//
+// Games stamp GameState::telemetryArrivalTime (micros()) before they apply a packet. update() runs right before the
+// cluster update: every signal that changed since the last call, while a new packet came in, is marked pending with
+// that arrival time. The first successfully sent frame that carries the signal (see ClusterSignalFrames.h) closes it
+// and the latency goes into the signal histogram. A signal that changes again while pending keeps the older arrival
+// time. Changes that did not come from a game (replay, dashboard, calibration) are not traced.
+class LatencyTracer {
+  LatencyTracer(const LatencyTracer &other) = delete;
+  LatencyTracer(LatencyTracer &&other) = delete;
+  LatencyTracer &operator=(const LatencyTracer &other) = delete;
+  LatencyTracer &operator=(LatencyTracer &&other) = delete;
+
+  public:
+    LatencyTracer(GameState& game, const SignalFrame *frames, uint8_t frameCount);
+    void update();                         // Call every loop, before the cluster is updated
+    void frameSent(uint32_t id);           // From the CAN frame hook, for frames that were sent
+    void reset();
+
+    const LatencyHistogram& histogram(uint8_t signal) { return histograms[signal]; }
+    bool isTraced(uint8_t signal) { return (tracedSignals & (1 << signal)) != 0; }  // Some frame carries it
+
+  private:
+    GameState &gameState;
+    const SignalFrame *frames;
+    uint8_t frameCount;
+    uint8_t tracedSignals = 0;
+
+    LatencyHistogram histograms[LatencySignal_Count];
+    int lastValues[LatencySignal_Count] = {};
+    uint32_t lastArrivalTime = 0;
+    uint8_t pendingSignals = 0;
+    uint32_t pendingArrivalTimes[LatencySignal_Count] = {};
+
+    int signalValue(uint8_t signal);
+};
+
+#endif
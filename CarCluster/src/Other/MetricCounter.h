@@ -0,0 +1,31 @@
+// ####################################################################################################################
+//
+// Code part of CarCluster project by Andrej Rolih. See .ino file more details
+//
+// ####################################################################################################################
+
+#ifndef METRIC_COUNTER
+#define METRIC_COUNTER
+
+#include <stdint.h>
+#include <atomic>
+
+// Monotonic 32 bit counter that can be incremented from any task (UDP games run in the network task) and read from
+// the loop. Increments are relaxed atomic adds, a counter does not guard any other data. Wraps around, which
+// Prometheus rate() handles like a counter reset.
+class MetricCounter {
+  MetricCounter(const MetricCounter &other) = delete;
+  MetricCounter(MetricCounter &&other) = delete;
+  MetricCounter &operator=(const MetricCounter &other) = delete;
+  MetricCounter &operator=(MetricCounter &&other) = delete;
+
+  public:
+    MetricCounter() {}
+    void increment(uint32_t count = 1) { counter.fetch_add(count, std::memory_order_relaxed); }
+    uint32_t value() const { return counter.load(std::memory_order_relaxed); }
+
+  private:
+    std::atomic<uint32_t> counter{0};
+};
+
+#endif
@@ -0,0 +1,195 @@
+// ####################################################################################################################
+//
+// Code part of CarCluster project by Andrej Rolih. See .ino file more details
+//
+// ####################################################################################################################
+
+#include "MqttPublisher.h"
+#include "SerialOutput.h"
+
+MqttPublisher::MqttPublisher(GameState& game, RuntimeMetrics& metrics, CanBusController **controllers, uint8_t controllerCount,
+                             const char *url, const char *topic, unsigned long sampleInterval, unsigned long publishInterval): gameState(game), metrics(metrics) {
+  this->controllers = controllers;
+  this->controllerCount = controllerCount;
+  this->url = url;
+  this->sampleInterval = sampleInterval;
+  this->publishInterval = publishInterval;
+  snprintf(telemetryTopic, sizeof(telemetryTopic), "%s/telemetry", topic);
+  snprintf(commandTopic, sizeof(commandTopic), "%s/cmd", topic);
+}
+
+void MqttPublisher::update() {
+  unsigned long currentTime = millis();
+
+  if (connection == nullptr) {
+    if (lastConnectTime == 0 || currentTime - lastConnectTime >= reconnectInterval) connect();
+    return;
+  }
+  if (!connected) {
+    // Waiting for CONNACK, the close goes through MG_EV_CLOSE and the reconnect above
+    if (currentTime - lastConnectTime >= connackTimeout && !connection->is_closing) {
+      serialOutput.println("MQTT connection timed out");
+      connection->is_closing = 1;
+    }
+    return;
+  }
+
+  if (currentTime - lastPingTime >= keepAlive * 1000UL / 2) {
+    mg_mqtt_ping(connection);
+    lastPingTime = currentTime;
+  }
+
+  if (inFlightId != 0 && currentTime - inFlightTime >= ackTimeout) {
+    lost++;
+    inFlightId = 0;
+  }
+
+  if (currentTime - lastSampleTime >= sampleInterval) sample(currentTime);
+  if (batchSamples > 0 && inFlightId == 0 && currentTime - lastPublishTime >= publishInterval) publish(currentTime);
+}
+
+void MqttPublisher::connect() {
+  struct mg_mqtt_opts opts;
+  memset(&opts, 0, sizeof(opts));
+  opts.clean = true;
+  opts.keepalive = keepAlive;
+
+  lastConnectTime = millis();
+  connection = mg_mqtt_connect(&g_mgr, url, &opts, handleEvent, this);
+}
+
+void MqttPublisher::sample(unsigned long currentTime) {
+  GameStateSnapshot snapshot = GameStateSnapshot::fromGame(gameState);
+  lastSampleTime = currentTime;
+
+  // First sample of a batch is always taken, so health is published even if the state does not change
+  if (batchSamples > 0 && snapshot.changedFields(lastSampled) == 0) return;
+  lastSampled = snapshot;
+
+  uint8_t index = batchSamples;
+  if (batchSamples == 0) {
+    batchStartTime = currentTime;
+  }
+  if (batchSamples == maximumBatchSamples) {
+    index = maximumBatchSamples - 1;
+    dropped++;
+  } else {
+    batchSamples++;
+  }
+
+  unsigned long offset = currentTime - batchStartTime;
+  batch[index].offset = offset > 0xFFFF ? 0xFFFF : offset;
+  batch[index].state = snapshot;
+}
+
+void MqttPublisher::publish(unsigned long currentTime) {
+  char message[1280];
+  size_t length = mg_snprintf(message, sizeof(message),
+                              "{%m:%lu,%m:%lu,%m:[%M],%m:{%m:%lu,%m:%lu,%m:%lu,%m:[%M],%m:%lu,%m:%lu}}",
+                              MG_ESC("seq"), (unsigned long)sequence,
+                              MG_ESC("t"), batchStartTime,
+                              MG_ESC("s"), printSamples, this,
+                              MG_ESC("h"),
+                              MG_ESC("heap"), (unsigned long)ESP.getFreeHeap(),
+                              MG_ESC("heap_min"), (unsigned long)ESP.getMinFreeHeap(),
+                              MG_ESC("loop_hz"), (unsigned long)metrics.loopRate(),
+                              MG_ESC("can"), printControllers, this,
+                              MG_ESC("dropped"), (unsigned long)dropped,
+                              MG_ESC("latency_ms"), latency);
+  batchSamples = 0;
+  lastPublishTime = currentTime;
+  sequence++;
+  if (length >= sizeof(message)) return;  // Can not happen with maximumBatchSamples, but never send a cut message
+
+  struct mg_mqtt_opts opts;
+  memset(&opts, 0, sizeof(opts));
+  opts.topic = mg_str(telemetryTopic);
+  opts.message = mg_str_n(message, length);
+  opts.qos = 1;
+
+  inFlightId = mg_mqtt_pub(connection, &opts);
+  inFlightTime = currentTime;
+  published++;
+}
+
+void MqttPublisher::handleCommand(struct mg_str message) {
+  JsonDocument doc;
+  if (deserializeJson(doc, message.buf, message.len)) {
+    invalid++;
+    return;
+  }
+
+  commands++;
+  if (doc["gear"].is<int>()) {
+    int gear = doc["gear"];
+    if (gear >= GearState_Manual_1 && gear <= GearState_Auto_S) gameState.gear = static_cast<GearState>(gear);
+  }
+  if (doc["high_beam"].is<bool>()) gameState.highBeam = doc["high_beam"];
+  if (doc["main_lights"].is<bool>()) gameState.mainLights = doc["main_lights"];
+  if (doc["fog_front"].is<bool>()) gameState.frontFogLight = doc["fog_front"];
+  if (doc["fog_rear"].is<bool>()) gameState.rearFogLight = doc["fog_rear"];
+  if (doc["left_indicator"].is<bool>()) gameState.leftTurningIndicator = doc["left_indicator"];
+  if (doc["right_indicator"].is<bool>()) gameState.rightTurningIndicator = doc["right_indicator"];
+  if (doc["handbrake"].is<bool>()) gameState.handbrake = doc["handbrake"];
+  if (doc["button"].is<int>()) {
+    gameState.pushButtonEvent(doc["button"], doc["hold"] | 0);
+  }
+}
+
+void MqttPublisher::handleEvent(struct mg_connection *c, int ev, void *ev_data) {
+  MqttPublisher *publisher = (MqttPublisher *)c->fn_data;
+
+  if (ev == MG_EV_MQTT_OPEN) {
+    if (*(uint8_t *)ev_data != 0) {
+      serialOutput.print("MQTT connection refused: ");
+      serialOutput.println(*(uint8_t *)ev_data);
+      c->is_closing = 1;
+      return;
+    }
+
+    struct mg_mqtt_opts opts;
+    memset(&opts, 0, sizeof(opts));
+    opts.topic = mg_str(publisher->commandTopic);
+    mg_mqtt_sub(c, &opts);
+
+    publisher->connected = true;
+    publisher->lastPingTime = millis();
+    serialOutput.println("MQTT connected");
+  } else if (ev == MG_EV_MQTT_CMD) {
+    struct mg_mqtt_message *mm = (struct mg_mqtt_message *)ev_data;
+    if (mm->cmd == MQTT_CMD_PUBACK && publisher->inFlightId != 0 && mm->id == publisher->inFlightId) {
+      publisher->latency = millis() - publisher->inFlightTime;
+      if (publisher->latency > publisher->maxLatency) publisher->maxLatency = publisher->latency;
+      publisher->inFlightId = 0;
+    }
+  } else if (ev == MG_EV_MQTT_MSG) {
+    struct mg_mqtt_message *mm = (struct mg_mqtt_message *)ev_data;
+    if (mg_strcmp(mm->topic, mg_str(publisher->commandTopic)) == 0) publisher->handleCommand(mm->data);
+  } else if (ev == MG_EV_CLOSE) {
+    if (publisher->connected) serialOutput.println("MQTT disconnected");
+    if (publisher->inFlightId != 0) publisher->lost++;
+    publisher->inFlightId = 0;
+    publisher->connected = false;
+    publisher->connection = nullptr;
+  }
+}
+
+size_t MqttPublisher::printSamples(void (*out)(char, void *), void *ptr, va_list *ap) {
+  MqttPublisher *publisher = va_arg(*ap, MqttPublisher *);
+  size_t len = 0;
+  for (uint8_t i = 0; i < publisher->batchSamples; i++) {
+    const Sample &sample = publisher->batch[i];
+    len += mg_xprintf(out, ptr, "%s[%u,%d,%u,%u,%d,%d,%u]", i == 0 ? "" : ",", sample.offset, sample.state.speed, sample.state.rpm,
+                      sample.state.gear, sample.state.coolantTemperature, sample.state.fuelQuantity, sample.state.flags);
+  }
+  return len;
+}
+
+size_t MqttPublisher::printControllers(void (*out)(char, void *), void *ptr, va_list *ap) {
+  MqttPublisher *publisher = va_arg(*ap, MqttPublisher *);
+  size_t len = 0;
+  for (uint8_t i = 0; i < publisher->controllerCount; i++) {
+    len += mg_xprintf(out, ptr, "%s%m", i == 0 ? "" : ",", MG_ESC(CanBusController::stateName(publisher->controllers[i]->state())));
+  }
+  return len;
+}
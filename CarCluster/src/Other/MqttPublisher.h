@@ -0,0 +1,117 @@
+// ####################################################################################################################
+//
+// Code part of CarCluster project by Andrej Rolih. See .ino file more details
+//
+// ####################################################################################################################
+
+#ifndef MQTT_PUBLISHER
+#define MQTT_PUBLISHER
+
+#include "Arduino.h"
+
+#include "mongoose/mongoose.h"
+#include "mongoose/mongoose_glue.h"
+#include "../Libs/ArduinoJson/ArduinoJson.h"
+#include "../Games/GameSimulation.h"
+#include "../Games/GameStateSnapshot.h"
+#include "RuntimeMetrics.h"
+#include "CanBusController.h"
+
+// Publishes the game state and device health to an MQTT broker and takes commands from it. Uses the mongoose
+// event manager, so update() has to be called only after mongoose_init().
+//
+// The state is sampled every sampleInterval (only if something changed) and the samples are sent in one message
+// every publishInterval, on <topic>/telemetry:
+//   {"seq":12,"t":53000,"s":[[0,54,3590,2,90,50,17],[50,55,3610,2,90,50,17]],
+//    "h":{"heap":123456,"heap_min":100000,"loop_hz":2500,"can":["running"],"dropped":0,"latency_ms":12}}
+// t is the time of the first sample (ms since boot), every sample is [ms after t, speed, rpm, gear, coolant, fuel,
+// flags] with gear and flags as in GameStateSnapshot.
+//
+// A broker that takes the TCP connection but does not answer CONNECT within connackTimeout is disconnected, the
+// connection is tried again after reconnectInterval like after any other close.
+//
+// Messages are sent with QoS 1 and only one is in flight at a time. Until it is acknowledged (or ackTimeout passes)
+// new samples keep going into the batch. A full batch keeps its first samples and replaces the last one with the
+// newest, so memory use is fixed and a slow broker or link costs resolution instead of growing a queue.
+//
+// Commands are JSON on <topic>/cmd, every field is optional:
+//   {"gear":14, "high_beam":true, "main_lights":true, "fog_front":false, "fog_rear":false, "left_indicator":false,
+//    "right_indicator":false, "handbrake":false, "button":1, "hold":0}
+class MqttPublisher {
+  MqttPublisher(const MqttPublisher &other) = delete;
+  MqttPublisher(MqttPublisher &&other) = delete;
+  MqttPublisher &operator=(const MqttPublisher &other) = delete;
+  MqttPublisher &operator=(MqttPublisher &&other) = delete;
+
+  public:
+    static const uint8_t maximumBatchSamples = 16;
+    static const unsigned long reconnectInterval = 5000;
+    static const unsigned long connackTimeout = 5000;  // Connection is closed if the broker does not answer CONNECT
+    static const unsigned long ackTimeout = 5000;
+    static const uint16_t keepAlive = 30;      // s
+    static const size_t maximumTopicLength = 64;
+
+    MqttPublisher(GameState& game, RuntimeMetrics& metrics, CanBusController **controllers, uint8_t controllerCount,
+                  const char *url, const char *topic, unsigned long sampleInterval, unsigned long publishInterval);
+    void update();
+
+    bool isConnected() { return connected; }
+    uint32_t publishedMessages() { return published; }
+    uint32_t droppedSamples() { return dropped; }  // Replaced in a full batch
+    uint32_t lostMessages() { return lost; }        // Not acknowledged in time, or connection closed before the ack
+    uint32_t receivedCommands() { return commands; }
+    uint32_t invalidCommands() { return invalid; }
+    unsigned long lastLatency() { return latency; } // ms from publish to PUBACK
+    unsigned long maximumLatency() { return maxLatency; }
+
+  private:
+    struct Sample {
+      uint16_t offset;                       // ms after the first sample of the batch
+      GameStateSnapshot state;
+    };
+
+    GameState &gameState;
+    RuntimeMetrics &metrics;
+    CanBusController **controllers;
+    uint8_t controllerCount;
+    const char *url;
+    char telemetryTopic[maximumTopicLength];
+    char commandTopic[maximumTopicLength];
+    unsigned long sampleInterval;
+    unsigned long publishInterval;
+
+    struct mg_connection *connection = nullptr;
+    bool connected = false;
+    unsigned long lastConnectTime = 0;
+    unsigned long lastPingTime = 0;
+
+    Sample batch[maximumBatchSamples];
+    uint8_t batchSamples = 0;
+    unsigned long batchStartTime = 0;
+    GameStateSnapshot lastSampled;
+    unsigned long lastSampleTime = 0;
+    unsigned long lastPublishTime = 0;
+
+    uint16_t inFlightId = 0;                 // Packet ID of the message waiting for PUBACK, 0 if none
+    unsigned long inFlightTime = 0;
+    uint32_t sequence = 0;
+
+    uint32_t published = 0;
+    uint32_t dropped = 0;
+    uint32_t lost = 0;
+    uint32_t commands = 0;
+    uint32_t invalid = 0;
+    unsigned long latency = 0;
+    unsigned long maxLatency = 0;
+
+    void connect();
+    void sample(unsigned long currentTime);
+    void publish(unsigned long currentTime);
+    void handleCommand(struct mg_str message);
+
+    static void handleEvent(struct mg_connection *c, int ev, void *ev_data);
+    static size_t printSamples(void (*out)(char, void *), void *ptr, va_list *ap);
+    static size_t printControllers(void (*out)(char, void *), void *ptr, va_list *ap);
+};
+
+#endif
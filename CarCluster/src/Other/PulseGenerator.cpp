@@ -0,0 +1,140 @@
+// ####################################################################################################################
+//
+// Code part of CarCluster project by Andrej Rolih. See .ino file more details
+//
+// ####################################################################################################################
+
+#include "PulseGenerator.h"
+
+PulseGenerator::PulseGenerator(float rampRate) {
+  this->rampRate = rampRate;
+}
+
+bool PulseGenerator::begin(int pin, ledc_channel_t channel, ledc_timer_t timer) {
+  // 2000 Hz is a whole divider (625), so the timer runs exactly what is tracked below until the first ledc_timer_set()
+  ledc_timer_config_t timerConfig = {};
+  timerConfig.speed_mode = LEDC_LOW_SPEED_MODE;
+  timerConfig.duty_resolution = (ledc_timer_bit_t)resolution;
+  timerConfig.timer_num = timer;
+  timerConfig.freq_hz = 2000;
+  timerConfig.clk_cfg = LEDC_USE_APB_CLK;
+  if (ledc_timer_config(&timerConfig) != ESP_OK) return false;
+
+  ledc_channel_config_t channelConfig = {};
+  channelConfig.gpio_num = pin;
+  channelConfig.speed_mode = LEDC_LOW_SPEED_MODE;
+  channelConfig.channel = channel;
+  channelConfig.intr_type = LEDC_INTR_DISABLE;
+  channelConfig.timer_sel = timer;
+  channelConfig.duty = 0;
+  channelConfig.hpoint = 0;
+  if (ledc_channel_config(&channelConfig) != ESP_OK) return false;
+
+  this->channel = channel;
+  this->timer = timer;
+  ledcDivider = timerDivider = 625;
+  timerPhase = 0;
+  started = true;
+  lastUpdateTime = micros();
+
+  return true;
+}
+
+void PulseGenerator::setFrequency(float frequency) {
+  update();                                // Time so far still ran at the old frequency
+
+  if (frequency < 0) frequency = 0;
+  if (frequency > maximumFrequency) frequency = maximumFrequency;
+  target = frequency;
+
+  if (rampRate <= 0) {
+    current = target;
+    selectOutput();
+  }
+}
+
+void PulseGenerator::update() {
+  unsigned long currentTime = micros();
+  unsigned long elapsed = currentTime - lastUpdateTime;
+  lastUpdateTime = currentTime;
+
+  advance(elapsed);
+  if (output != 0) phaseError += current * elapsed / 1000000.0;
+  phaseError = constrain(phaseError, -1.0, 1.0);
+
+  if (current != target && rampRate > 0) {
+    float maximumChange = rampRate * elapsed / 1000000.0f;
+    if (target > current) {
+      current = (target - current > maximumChange) ? current + maximumChange : target;
+    } else {
+      current = (current - target > maximumChange) ? current - maximumChange : target;
+    }
+  }
+
+  selectOutput();
+}
+
+void PulseGenerator::advance(unsigned long elapsed) {
+  uint64_t step = (uint64_t)elapsed * 1000;
+  uint64_t period = (uint64_t)timerDivider * dividerStep;
+
+  if (changePending && step >= period - timerPhase) {
+    // The running period ends, the next one starts with the new settings and gets the rest of the time
+    uint64_t left = period - timerPhase;
+    if (timerOn) phaseError -= (double)left / period;
+    step -= left;
+    timerDivider = ledcDivider;
+    timerOn = ledcOn;
+    changePending = false;
+    if (timerOn) pulses++;
+    timerPhase = 0;
+    period = (uint64_t)timerDivider * dividerStep;
+  }
+
+  timerPhase += step;
+  if (timerOn) {
+    pulses += timerPhase / period;
+    phaseError -= (double)step / period;
+  }
+  timerPhase %= period;
+}
+
+void PulseGenerator::selectOutput() {
+  if (current < minimumFrequency) {
+    phaseError = 0;
+    setOutput(0);
+    return;
+  }
+
+  // A smaller divider is a higher frequency
+  double divider = 1000000000.0 / dividerStep / current;
+  uint32_t fast = constrain((uint32_t)divider, minimumDivider, maximumDivider);
+  uint32_t slow = (divider > fast && fast < maximumDivider) ? fast + 1 : fast;
+  if (output != fast && output != slow) {
+    setOutput(phaseError > 0 ? fast : slow);
+  } else if (phaseError > ditherThreshold) {
+    setOutput(fast);
+  } else if (phaseError < -ditherThreshold) {
+    setOutput(slow);
+  }
+}
+
+void PulseGenerator::setOutput(uint32_t divider) {
+  if (divider == output || !started) return;
+
+  if (divider == 0) {
+    ledc_set_duty(LEDC_LOW_SPEED_MODE, channel, 0);
+    ledc_update_duty(LEDC_LOW_SPEED_MODE, channel);
+    ledcOn = false;
+  } else {
+    ledc_timer_set(LEDC_LOW_SPEED_MODE, timer, divider, resolution, LEDC_APB_CLK);
+    ledcDivider = divider;
+    if (!ledcOn) {
+      ledc_set_duty(LEDC_LOW_SPEED_MODE, channel, 1 << (resolution - 1));
+      ledc_update_duty(LEDC_LOW_SPEED_MODE, channel);
+      ledcOn = true;
+    }
+  }
+  output = divider;
+  changePending = true;
+}
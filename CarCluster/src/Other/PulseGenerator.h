@@ -0,0 +1,79 @@
+// ####################################################################################################################
+//
+// Code part of CarCluster project by Andrej Rolih. See .ino file more details
+//
+// ####################################################################################################################
+
+#ifndef PULSE_GENERATOR
+#define PULSE_GENERATOR
+
+#include "Arduino.h"
+#include "driver/ledc.h"
+
+// Square wave generator for pulse driven gauges (like the E46 speedometer that expects ABS sensor pulses).
+//
+// The pulses come from a low speed LEDC channel, so every edge is timed by the hardware clock (no interrupt, no
+// jitter). The timer is configured once in begin(), after that only its divider is written with ledc_timer_set().
+// The low speed LEDC takes a new divider over when the running period ends, so the phase carries on and no pulse is
+// shortened (ledcChangeFrequency() and ledc_timer_config() reset the timer and cut the running pulse short). The
+// divider is in 1/256 steps, with the duty resolution at 14 bits one step is 800 ns of period. The exact divider is
+// dithered: update() keeps track of the pulses the fractional frequency would have sent and switches between the two
+// neighbouring dividers when the output is ahead or behind by ditherThreshold. The LEDC has no counter, so update()
+// also follows the timer phase (taking new settings over at the end of the period like the LEDC does) and counts the
+// periods that started with the output on, so the distance the gauge has actually seen can be reported back.
+// Frequency changes are ramped from update() with a configurable rate.
+class PulseGenerator {
+  PulseGenerator(const PulseGenerator &other) = delete;
+  PulseGenerator(PulseGenerator &&other) = delete;
+  PulseGenerator &operator=(const PulseGenerator &other) = delete;
+  PulseGenerator &operator=(PulseGenerator &&other) = delete;
+
+  public:
+    static const uint8_t resolution = 14;            // LEDC duty resolution in bits, the duty is always half
+    static const uint32_t dividerStep = 800;         // ns of period per divider step (80 MHz, 1/256 steps, 14 bits)
+    static const uint32_t minimumDivider = 256;      // The LEDC divides by at least 1
+    static const uint32_t maximumDivider = 0x3FFFF;  // 18 bit divider
+    static const uint32_t minimumFrequency = 5;      // Hz, the output is off below this
+    static const uint32_t maximumFrequency = 4800;   // Hz
+    static constexpr double ditherThreshold = 1.0 / 16;  // Pulses
+
+    // rampRate is in Hz per second, 0 jumps to the new frequency immediately
+    PulseGenerator(float rampRate = 0);
+    bool begin(int pin, ledc_channel_t channel = LEDC_CHANNEL_4, ledc_timer_t timer = LEDC_TIMER_2);
+
+    void setFrequency(float frequency);    // Clamped to maximumFrequency
+    void update();                         // Call from the loop, applies the ramp, dithers and counts
+
+    float targetFrequency() { return target; }
+    float currentFrequency() { return current; }
+    uint32_t outputDivider() { return output; }      // Divider the LEDC timer was last set to, 0 when off
+    float outputFrequency() { return output == 0 ? 0 : 1000000000.0f / ((float)output * dividerStep); }
+    uint32_t pulseCount() { return pulses; }
+
+  private:
+    void advance(unsigned long elapsed);
+    void selectOutput();
+    void setOutput(uint32_t divider);
+
+    bool started = false;
+    ledc_channel_t channel = LEDC_CHANNEL_4;
+    ledc_timer_t timer = LEDC_TIMER_2;
+    float rampRate;
+    float target = 0;
+    float current = 0;
+    uint32_t output = 0;
+    unsigned long lastUpdateTime = 0;      // us
+
+    // The LEDC timer as the hardware runs it, what was written last is taken over when the running period ends
+    uint32_t ledcDivider = 0;
+    bool ledcOn = false;
+    uint32_t timerDivider = 0;
+    bool timerOn = false;
+    bool changePending = false;
+    uint64_t timerPhase = 0;               // ns into the running period
+    uint32_t pulses = 0;
+
+    double phaseError = 0;                 // Pulses current would have sent minus pulses sent
+};
+
+#endif
@@ -0,0 +1,95 @@
+// ####################################################################################################################
+//
+// Code part of CarCluster project by Andrej Rolih. See .ino file more details
+//
+// ####################################################################################################################
+
+#include "RuntimeMetrics.h"
+
+#include "../Libs/MCP_CAN/mcp_can_dfs.h"
+
+void RuntimeMetrics::addGame(const char *name, Game &game) {
+  if (games >= maximumGames) return;
+
+  gameNames[games] = name;
+  gameSources[games] = &game;
+  lastGamePackets[games] = game.packetCount();
+  games++;
+}
+
+void RuntimeMetrics::update() {
+  loopCount.increment();
+
+  unsigned long currentTime = millis();
+  unsigned long elapsed = currentTime - lastRateTime;
+  if (elapsed < rateInterval) return;
+
+  uint32_t loops = loopCount.value();
+  loopsPerSecond = (uint64_t)(loops - lastLoopCount) * 1000 / elapsed;
+  lastLoopCount = loops;
+
+  for (uint8_t i = 0; i < games; i++) {
+    uint32_t packets = gameSources[i]->packetCount();
+    gamePacketRates[i] = (uint64_t)(packets - lastGamePackets[i]) * 1000 / elapsed;
+    lastGamePackets[i] = packets;
+  }
+
+  lastRateTime = currentTime;
+}
+
+uint32_t RuntimeMetrics::packetCount() {
+  uint32_t packets = 0;
+  for (uint8_t i = 0; i < games; i++) {
+    packets += gameSources[i]->packetCount();
+  }
+  return packets;
+}
+
+void RuntimeMetrics::countFrame(uint8_t bus, bool transmit, uint32_t id, bool extended, uint8_t result) {
+  FrameCounters &counters = countersFor(frameKey(bus, id, extended));
+
+  if (!transmit) {
+    counters.received.increment();
+    return;
+  }
+
+  counters.transmitted.increment();
+  if (result != CAN_OK) counters.transmitFailures.increment();
+  if (bus >= 1 && bus <= maximumBuses) {
+    sendResultCounts[bus - 1][result < sendResultCount - 1 ? result : sendResultCount - 1].increment();
+  }
+}
+
+const char* RuntimeMetrics::sendResultName(uint8_t result) {
+  switch (result) {
+    case CAN_OK: return "ok";
+    case CAN_FAILINIT: return "fail_init";
+    case CAN_FAILTX: return "fail_tx";
+    case CAN_MSGAVAIL: return "msg_avail";
+    case CAN_NOMSG: return "no_msg";
+    case CAN_CTRLERROR: return "ctrl_error";
+    case CAN_GETTXBFTIMEOUT: return "tx_buffer_timeout";
+    case CAN_SENDMSGTIMEOUT: return "send_timeout";
+    default: return "fail";
+  }
+}
+
+RuntimeMetrics::FrameCounters& RuntimeMetrics::countersFor(uint32_t key) {
+  // Fibonacci hashing, cluster IDs are often close together
+  uint8_t slot = ((uint32_t)(key * 2654435761UL) >> 24) & (maximumFrameIds - 1);
+
+  for (uint8_t probe = 0; probe < maximumFrameIds; probe++) {
+    FrameCounters &counters = frames[(slot + probe) & (maximumFrameIds - 1)];
+    if (counters.key == key) return counters;
+    if (counters.key == emptyKey) {
+      counters.key = key;
+      return counters;
+    }
+  }
+
+  return otherFrames;
+}
+
+uint32_t RuntimeMetrics::frameKey(uint8_t bus, uint32_t id, bool extended) {
+  return ((uint32_t)(bus & 0x03) << 30) | (extended ? 1UL << 29 : 0) | (id & 0x1FFFFFFF);
+}
@@ -0,0 +1,91 @@
+// ####################################################################################################################
+//
+// Code part of CarCluster project by Andrej Rolih. See .ino file more details
+//
+// ####################################################################################################################
+
+#ifndef RUNTIME_METRICS
+#define RUNTIME_METRICS
+
+#include "Arduino.h"
+
+#include "MetricCounter.h"
+#include "../Games/GameSimulation.h"
+
+// Counters exported on /metrics (OpenMetrics text, see WebDashboard::handleMetrics), so a bench of rigs can be
+// scraped and a degrading one noticed before the needles start twitching.
+//
+// Everything on the hot paths is a relaxed atomic increment. Per CAN ID counters live in a fixed open addressing
+// table that is filled by the frame hook. IDs are only added from the loop (CAN is only used from there), IDs that
+// do not fit anymore are counted in the "other" entry. Game packet counters are kept by the games themselves,
+// CAN controller health by CanBusController.
+class RuntimeMetrics {
+  RuntimeMetrics(const RuntimeMetrics &other) = delete;
+  RuntimeMetrics(RuntimeMetrics &&other) = delete;
+  RuntimeMetrics &operator=(const RuntimeMetrics &other) = delete;
+  RuntimeMetrics &operator=(RuntimeMetrics &&other) = delete;
+
+  public:
+    static const uint8_t maximumFrameIds = 64;   // Power of two
+    static const uint8_t maximumBuses = 2;
+    static const uint8_t maximumGames = 4;
+    static const uint8_t sendResultCount = 9;    // CAN_OK to CAN_SENDMSGTIMEOUT, everything else (CAN_FAIL)
+    static const unsigned long rateInterval = 1000;
+    static const uint32_t emptyKey = 0xFFFFFFFF;
+
+    struct FrameCounters {
+      uint32_t key = emptyKey;               // Bus, extended flag and ID, see frameKey()
+      MetricCounter transmitted;             // Send attempts that reached the controller
+      MetricCounter transmitFailures;
+      MetricCounter received;
+    };
+
+    RuntimeMetrics() {}
+    void addGame(const char *name, Game &game);
+    void update();                         // Call every loop, counts iterations and samples the rates
+
+    // From the CAN frame hook
+    void countFrame(uint8_t bus, bool transmit, uint32_t id, bool extended, uint8_t result);
+    void countSerialParseFailure() { serialParseFailures.increment(); }
+
+    const FrameCounters& frameCounters(uint8_t slot) { return frames[slot]; }  // Unused slots have emptyKey
+    const FrameCounters& otherFrameCounters() { return otherFrames; }
+    static uint8_t frameBus(uint32_t key) { return key >> 30; }
+    static bool frameExtended(uint32_t key) { return (key & (1UL << 29)) != 0; }
+    static uint32_t frameId(uint32_t key) { return key & 0x1FFFFFFF; }
+
+    uint32_t sendResults(uint8_t bus, uint8_t result) { return bus >= 1 && bus <= maximumBuses ? sendResultCounts[bus - 1][result].value() : 0; }
+    static const char* sendResultName(uint8_t result);
+
+    uint8_t gameCount() { return games; }
+    const char* gameName(uint8_t game) { return gameNames[game]; }
+    Game& game(uint8_t game) { return *gameSources[game]; }
+    uint32_t gamePacketRate(uint8_t game) { return gamePacketRates[game]; }  // Packets/s over the last interval
+    uint32_t packetCount();                // Packets of all games applied to the game state
+
+    uint32_t serialParseFailureCount() { return serialParseFailures.value(); }
+    uint32_t loopIterations() { return loopCount.value(); }
+    uint32_t loopRate() { return loopsPerSecond; }  // Iterations/s over the last interval
+
+  private:
+    FrameCounters frames[maximumFrameIds];
+    FrameCounters otherFrames;
+    MetricCounter sendResultCounts[maximumBuses][sendResultCount];
+
+    const char *gameNames[maximumGames] = {};
+    Game *gameSources[maximumGames] = {};
+    uint8_t games = 0;
+    uint32_t lastGamePackets[maximumGames] = {};
+    uint32_t gamePacketRates[maximumGames] = {};
+
+    MetricCounter serialParseFailures;
+    MetricCounter loopCount;
+    uint32_t lastLoopCount = 0;
+    uint32_t loopsPerSecond = 0;
+    unsigned long lastRateTime = 0;
+
+    FrameCounters& countersFor(uint32_t key);
+    static uint32_t frameKey(uint8_t bus, uint32_t id, bool extended);
+};
+
+#endif
@@ -0,0 +1,21 @@
+// ####################################################################################################################
+//
+// Code part of CarCluster project by Andrej Rolih. See .ino file more details
+//
+// ####################################################################################################################
+
+#include "SerialOutput.h"
+
+SerialOutput serialOutput;
+
+size_t SerialOutput::write(uint8_t c) {
+  return muted ? 1 : Serial.write(c);
+}
+
+size_t SerialOutput::write(const uint8_t *buffer, size_t size) {
+  return muted ? size : Serial.write(buffer, size);
+}
+
+void SerialOutput::writeCharacter(char c, void *context) {
+  serialOutput.write((uint8_t)c);
+}
@@ -0,0 +1,38 @@
+// ####################################################################################################################
+//
+// Code part of CarCluster project by Andrej Rolih. See .ino file more details
+//
+// ####################################################################################################################
+
+#ifndef SERIAL_OUTPUT
+#define SERIAL_OUTPUT
+
+#include "Arduino.h"
+
+// Status and log messages go through serialOutput instead of Serial, so they can be muted while the serial port is
+// used by the SLCAN interface. SLCAN hosts take every byte on the port as part of a frame (the Linux driver only
+// splits lines on CR), so a message ending in LF would cost the next received frame.
+class SerialOutput: public Print {
+  SerialOutput(const SerialOutput &other) = delete;
+  SerialOutput(SerialOutput &&other) = delete;
+  SerialOutput &operator=(const SerialOutput &other) = delete;
+  SerialOutput &operator=(SerialOutput &&other) = delete;
+
+  public:
+    SerialOutput() {}
+
+    size_t write(uint8_t c) override;
+    size_t write(const uint8_t *buffer, size_t size) override;
+
+    void setMuted(bool muted) { this->muted = muted; }
+    bool isMuted() { return muted; }
+
+    static void writeCharacter(char c, void *context);  // For mg_log_set_fn()
+
+  private:
+    bool muted = false;
+};
+
+extern SerialOutput serialOutput;
+
+#endif
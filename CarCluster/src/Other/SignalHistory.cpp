@@ -0,0 +1,69 @@
+// ####################################################################################################################
+//
+// Code part of CarCluster project by Andrej Rolih. See .ino file more details
+//
+// ####################################################################################################################
+
+#include "SignalHistory.h"
+
+SignalHistory::SignalHistory(GameState& game, RuntimeMetrics& metrics, unsigned long bucketDuration): gameState(game), metrics(metrics) {
+  this->bucketDuration = bucketDuration;
+}
+
+void SignalHistory::sample() {
+  unsigned long currentTime = millis();
+  uint32_t bucketStart = currentTime - (currentTime % bucketDuration);
+
+  // Start a new bucket. If the loop stalled for longer than a bucket the gap is visible from the timestamps
+  if (filled == 0 || buckets[newest].start != bucketStart) {
+    newest = (newest + 1) % bucketCount;
+    if (filled < bucketCount) filled++;
+
+    Bucket &bucket = buckets[newest];
+    bucket.start = bucketStart;
+    for (uint8_t i = 0; i < Signal_Count; i++) {
+      bucket.minimum[i] = INT32_MAX;
+      bucket.maximum[i] = INT32_MIN;
+    }
+    bucketPacketCount = metrics.packetCount();
+  }
+
+  Bucket &bucket = buckets[newest];
+  int32_t values[Signal_Count];
+  values[Signal_RPM] = gameState.rpm;
+  values[Signal_Speed] = gameState.speed;
+  values[Signal_Coolant] = gameState.coolantTemperature;
+  values[Signal_Fuel] = gameState.fuelQuantity;
+
+  for (uint8_t i = 0; i < Signal_PacketRate; i++) {
+    if (values[i] < bucket.minimum[i]) bucket.minimum[i] = values[i];
+    if (values[i] > bucket.maximum[i]) bucket.maximum[i] = values[i];
+  }
+
+  // Packet rate is the number of packets received during the bucket (so far)
+  int32_t packetRate = (uint64_t)(metrics.packetCount() - bucketPacketCount) * 1000 / bucketDuration;
+  bucket.minimum[Signal_PacketRate] = packetRate;
+  bucket.maximum[Signal_PacketRate] = packetRate;
+}
+
+size_t SignalHistory::series(Signal signal, uint32_t *timestamps, double *minimums, double *maximums) {
+  for (uint8_t i = 0; i < filled; i++) {
+    const Bucket &bucket = buckets[(newest + bucketCount - filled + 1 + i) % bucketCount];
+    timestamps[i] = bucket.start;
+    minimums[i] = bucket.minimum[signal];
+    maximums[i] = bucket.maximum[signal];
+  }
+
+  return filled;
+}
+
+const char* SignalHistory::signalName(Signal signal) {
+  switch (signal) {
+    case Signal_RPM: return "rpm";
+    case Signal_Speed: return "speed";
+    case Signal_Coolant: return "coolant_temp";
+    case Signal_Fuel: return "fuel";
+    case Signal_PacketRate: return "packet_rate";
+    default: return "";
+  }
+}
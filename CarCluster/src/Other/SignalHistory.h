@@ -0,0 +1,54 @@
+// ####################################################################################################################
+//
+// Code part of CarCluster project by Andrej Rolih. See .ino file more details
+//
+// ####################################################################################################################
+
+#ifndef SIGNAL_HISTORY
+#define SIGNAL_HISTORY
+
+#include "Arduino.h"
+
+#include "../Games/GameSimulation.h"
+#include "RuntimeMetrics.h"
+
+// Keeps minimum and maximum of the main cluster signals for the last bucketCount buckets (60 s with 1 s buckets).
+// Memory use is fixed and sampling is O(1), so it can be called on every cluster update.
+class SignalHistory {
+  public:
+    enum Signal {
+      Signal_RPM = 0,
+      Signal_Speed,
+      Signal_Coolant,
+      Signal_Fuel,
+      Signal_PacketRate,                   // Telemetry packets per second received from the game
+      Signal_Count
+    };
+
+    static const uint8_t bucketCount = 60;
+
+    SignalHistory(GameState& game, RuntimeMetrics& metrics, unsigned long bucketDuration);
+    void sample();
+
+    // Copies the buckets (oldest first) into the supplied arrays, returns number of buckets
+    size_t series(Signal signal, uint32_t *timestamps, double *minimums, double *maximums);
+    static const char* signalName(Signal signal);
+    unsigned long bucketDurationMs() { return bucketDuration; }
+
+  private:
+    struct Bucket {
+      uint32_t start;
+      int32_t minimum[Signal_Count];
+      int32_t maximum[Signal_Count];
+    };
+
+    GameState &gameState;
+    RuntimeMetrics &metrics;               // Packet counters of the games
+    unsigned long bucketDuration;
+    Bucket buckets[bucketCount];
+    uint8_t newest = 0;
+    uint8_t filled = 0;
+    uint32_t bucketPacketCount = 0;        // Packet count at the start of the newest bucket
+};
+
+#endif
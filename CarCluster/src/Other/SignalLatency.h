@@ -0,0 +1,101 @@
+// ####################################################################################################################
+//
+// Code part of CarCluster project by Andrej Rolih. See .ino file more details
+//
+// ####################################################################################################################
+
+#ifndef SIGNAL_LATENCY
+#define SIGNAL_LATENCY
+
+#include <stddef.h>
+#include <stdint.h>
+
+// Plain C++ (no Arduino), shared by LatencyTracer on the device and Tools/latency.cpp on the computer.
+
+// Signals whose telemetry to CAN latency is traced
+enum LatencySignal {
+  LatencySignal_Speed = 0,
+  LatencySignal_RPM = 1,
+  LatencySignal_Gear = 2,
+  LatencySignal_Indicators = 3,
+  LatencySignal_Count = 4
+};
+
+// A CAN frame that carries one or more of the traced signals (see ClusterSignalFrames.h)
+struct SignalFrame {
+  uint32_t id;
+  uint8_t signals;                         // Bit mask of 1 << LatencySignal
+};
+
+static inline const char* latencySignalName(uint8_t signal) {
+  switch (signal) {
+    case LatencySignal_Speed: return "speed";
+    case LatencySignal_RPM: return "rpm";
+    case LatencySignal_Gear: return "gear";
+    case LatencySignal_Indicators: return "indicators";
+    default: return "unknown";
+  }
+}
+
+// Latency histogram with power of two buckets: bucket 0 is 0 us, bucket n holds 2^(n-1) to 2^n - 1 us, the last bucket
+// everything from 2^(bucketCount - 2) us (about 8 s) up. Fixed size, recording is a count leading zeros and two adds.
+// Percentiles are interpolated inside the bucket, so they are accurate to the bucket width at worst.
+class LatencyHistogram {
+  public:
+    static const uint8_t bucketCount = 25;
+
+    void record(uint32_t latency) {
+      uint8_t bucket = latency == 0 ? 0 : 32 - __builtin_clz(latency);
+      if (bucket >= bucketCount) bucket = bucketCount - 1;
+
+      buckets[bucket]++;
+      samples++;
+      sum += latency;
+      if (latency > maximumLatency) maximumLatency = latency;
+    }
+
+    void reset() {
+      for (uint8_t i = 0; i < bucketCount; i++) buckets[i] = 0;
+      samples = 0;
+      sum = 0;
+      maximumLatency = 0;
+    }
+
+    uint32_t count() const { return samples; }
+    uint32_t maximum() const { return maximumLatency; }
+    uint32_t mean() const { return samples == 0 ? 0 : sum / samples; }
+    uint32_t bucketSamples(uint8_t bucket) const { return buckets[bucket]; }
+
+    static uint32_t bucketLowerBound(uint8_t bucket) { return bucket == 0 ? 0 : 1UL << (bucket - 1); }
+
+    // Latency that percent % of the samples are at or below, 0 without samples
+    uint32_t percentile(uint8_t percent) const {
+      if (samples == 0) return 0;
+
+      uint32_t rank = ((uint64_t)samples * percent + 99) / 100;
+      if (rank == 0) rank = 1;
+
+      uint32_t below = 0;
+      for (uint8_t i = 0; i < bucketCount; i++) {
+        if (below + buckets[i] < rank) {
+          below += buckets[i];
+          continue;
+        }
+
+        uint32_t low = bucketLowerBound(i);
+        uint32_t high = i == bucketCount - 1 ? maximumLatency : (1UL << i) - 1;
+        if (high > maximumLatency) high = maximumLatency;
+        if (low > high) low = high;
+        return low + (uint64_t)(high - low) * (rank - below) / buckets[i];
+      }
+      return maximumLatency;
+    }
+
+  private:
+    uint32_t buckets[bucketCount] = {};
+    uint32_t samples = 0;
+    uint64_t sum = 0;
+    uint32_t maximumLatency = 0;
+};
+
+#endif
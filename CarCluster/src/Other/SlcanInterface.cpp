@@ -0,0 +1,261 @@
+// ####################################################################################################################
+//
+// Code part of CarCluster project by Andrej Rolih. See .ino file more details
+//
+// ####################################################################################################################
+
+#include "SlcanInterface.h"
+#include "SerialOutput.h"
+
+#define SLCAN_OK "\r"
+#define SLCAN_ERROR "\a"
+
+#define FRAME_EXTENDED 0x01
+#define FRAME_REMOTE 0x02
+
+static const char hexDigits[] = "0123456789ABCDEF";
+
+SlcanInterface::SlcanInterface(CanBusController **controllers, uint8_t controllerCount) {
+  this->controllers = controllers;
+  this->controllerCount = controllerCount;
+}
+
+void SlcanInterface::update() {
+  commandsThisUpdate = 0;
+
+  // Only write what fits, so a slow host never blocks the loop
+  char encoded[maximumLineLength + 8];
+  while (queueCount > 0) {
+    const Frame &frame = queue[queueHead];
+    size_t length = encodeFrame(frame, encoded);
+    if (Serial.availableForWrite() < (int)length) break;
+
+    Serial.write((const uint8_t *)encoded, length);
+    queueHead = (queueHead + 1) % queueSize;
+    queueCount--;
+    framesStreamed++;
+  }
+}
+
+bool SlcanInterface::readByte(char inByte) {
+  if (lineLength == 0 && !lineOverflow) {
+    // hosts send a few CRs to flush the line and some end commands with CR LF
+    if (inByte == '\r' || (inByte == '\n' && lastByteEndedCommand)) {
+      lastByteEndedCommand = inByte == '\r';
+      return true;
+    }
+    lastByteEndedCommand = false;
+    if (!isAlpha(inByte)) return false;
+  }
+
+  if (inByte == '\r') {
+    if (lineOverflow) {
+      commandsInvalid++;
+      reply(SLCAN_ERROR);
+    } else {
+      line[lineLength] = '\0';
+      executeCommand();
+    }
+    lineLength = 0;
+    lineOverflow = false;
+    lastByteEndedCommand = true;
+    commandsThisUpdate++;
+  } else if (lineLength < maximumLineLength) {
+    line[lineLength++] = inByte;
+  } else {
+    lineOverflow = true;
+  }
+  return true;
+}
+
+void SlcanInterface::frameSeen(uint8_t bus, bool transmitted, uint32_t id, bool extended, bool remote, uint8_t length, const uint8_t *data) {
+  if (!channelOpen || bus != busNumber || (transmitted && !streamSentFrames)) return;
+
+  if (queueCount >= queueSize) {
+    framesDropped++;
+    overrun = true;
+    return;
+  }
+
+  Frame &frame = queue[(queueHead + queueCount) % queueSize];
+  frame.id = id;
+  frame.length = length > 8 ? 8 : length;
+  frame.flags = (extended ? FRAME_EXTENDED : 0) | (remote ? FRAME_REMOTE : 0);
+  memcpy(frame.data, data, frame.length);
+  frame.timestamp = millis() % 60000;
+  queueCount++;
+}
+
+bool SlcanInterface::setBus(uint8_t bus) {
+  if (channelOpen) return false;
+
+  for (uint8_t i = 0; i < controllerCount; i++) {
+    if (controllers[i]->bus() == bus) {
+      busNumber = bus;
+      return true;
+    }
+  }
+  return false;
+}
+
+CanBusController* SlcanInterface::controller() {
+  for (uint8_t i = 0; i < controllerCount; i++) {
+    if (controllers[i]->bus() == busNumber) return controllers[i];
+  }
+  return controllers[0];
+}
+
+void SlcanInterface::executeCommand() {
+  bool accepted = false;
+
+  switch (line[0]) {
+    case 'S':
+      accepted = !channelOpen && lineLength == 2 && bitrateMatches(line[1]);
+      break;
+    case 'O':
+    case 'L':
+      // Listen only puts the controller in listen only mode, so it stops acknowledging frames (and the cluster stops
+      // sending on that bus until the channel is closed)
+      if (!channelOpen && controller()->isRunning() && (line[0] == 'O' || controller()->setListenOnly(true))) {
+        channelOpen = true;
+        listenOnly = line[0] == 'L';
+        overrun = false;
+        queueCount = 0;
+        serialOutput.setMuted(true);
+        accepted = true;
+      }
+      break;
+    case 'C':
+      if (listenOnly) controller()->setListenOnly(false);
+      channelOpen = false;
+      listenOnly = false;
+      queueCount = 0;
+      serialOutput.setMuted(false);
+      accepted = true;
+      break;
+    case 't':
+    case 'T':
+    case 'r':
+    case 'R':
+      if (channelOpen && !listenOnly && sendFrame(line[0] == 'T' || line[0] == 'R', line[0] == 'r' || line[0] == 'R')) {
+        reply(line[0] == 't' || line[0] == 'r' ? "z\r" : "Z\r");
+        return;
+      }
+      break;
+    case 'F': {
+      uint8_t flags = statusFlags();
+      char status[] = { 'F', hexDigits[flags >> 4], hexDigits[flags & 0x0F], '\r', '\0' };
+      reply(status);
+      overrun = false;
+      return;
+    }
+    case 'V':
+      reply("V0101\r");
+      return;
+    case 'v':
+      reply("v0101\r");
+      return;
+    case 'N':
+      reply("NCC01\r");
+      return;
+    case 'Z':
+      accepted = lineLength == 2 && (line[1] == '0' || line[1] == '1');
+      if (accepted) timestamps = line[1] == '1';
+      break;
+    case 'M':
+    case 'm':
+      // Acceptance filters are not supported, everything is passed
+      accepted = lineLength == 9;
+      break;
+  }
+
+  if (!accepted) commandsInvalid++;
+  reply(accepted ? SLCAN_OK : SLCAN_ERROR);
+}
+
+bool SlcanInterface::sendFrame(bool extended, bool remote) {
+  uint8_t idDigits = extended ? 8 : 3;
+  uint32_t id, length;
+  if (lineLength < 1 + idDigits + 1 || !parseHex(line + 1, idDigits, id) || !parseHex(line + 1 + idDigits, 1, length)) return false;
+  if (length > 8 || id > (extended ? 0x1FFFFFFFUL : 0x7FFUL)) return false;
+
+  uint8_t data[8] = {};
+  uint8_t expectedLength = 1 + idDigits + 1 + (remote ? 0 : length * 2);
+  if (lineLength != expectedLength) return false;
+
+  for (uint8_t i = 0; i < length && !remote; i++) {
+    uint32_t value;
+    if (!parseHex(line + 2 + idDigits + i * 2, 2, value)) return false;
+    data[i] = value;
+  }
+
+  uint32_t flaggedId = id | (extended ? CAN_IS_EXTENDED : 0) | (remote ? CAN_IS_REMOTE_REQUEST : 0);
+  if (controller()->canInterface().sendMsgBuf(flaggedId, length, data) != CAN_OK) {
+    framesFailed++;
+    return false;
+  }
+  framesSent++;
+  return true;
+}
+
+bool SlcanInterface::bitrateMatches(char code) {
+  // S0-S8: 10, 20, 50, 100, 125, 250, 500, 800 and 1000 kbit/s
+  static const INT8U speeds[] = { CAN_10KBPS, CAN_20KBPS, CAN_50KBPS, CAN_100KBPS, CAN_125KBPS, CAN_250KBPS, CAN_500KBPS, 0, CAN_1000KBPS };
+  if (code < '0' || code > '8') return false;
+  return speeds[code - '0'] != 0 && speeds[code - '0'] == controller()->speed();
+}
+
+uint8_t SlcanInterface::statusFlags() {
+  // Bit 3: data overrun, bit 5: error passive, bit 7: bus error (bus off)
+  uint8_t flags = overrun ? 0x08 : 0;
+  switch (controller()->state()) {
+    case CanBusController::State_ErrorPassive: flags |= 0x20; break;
+    case CanBusController::State_BusOff: flags |= 0x80; break;
+    default: break;
+  }
+  return flags;
+}
+
+void SlcanInterface::reply(const char *text) {
+  Serial.print(text);
+}
+
+size_t SlcanInterface::encodeFrame(const Frame &frame, char *out) {
+  bool extended = (frame.flags & FRAME_EXTENDED) != 0;
+  bool remote = (frame.flags & FRAME_REMOTE) != 0;
+  size_t length = 0;
+
+  out[length++] = remote ? (extended ? 'R' : 'r') : (extended ? 'T' : 't');
+  for (int8_t shift = extended ? 28 : 8; shift >= 0; shift -= 4) {
+    out[length++] = hexDigits[(frame.id >> shift) & 0x0F];
+  }
+  out[length++] = hexDigits[frame.length];
+  for (uint8_t i = 0; i < frame.length && !remote; i++) {
+    out[length++] = hexDigits[frame.data[i] >> 4];
+    out[length++] = hexDigits[frame.data[i] & 0x0F];
+  }
+  if (timestamps) {
+    for (int8_t shift = 12; shift >= 0; shift -= 4) {
+      out[length++] = hexDigits[(frame.timestamp >> shift) & 0x0F];
+    }
+  }
+  out[length++] = '\r';
+  return length;
+}
+
+int8_t SlcanInterface::hexValue(char c) {
+  if (c >= '0' && c <= '9') return c - '0';
+  if (c >= 'A' && c <= 'F') return c - 'A' + 10;
+  if (c >= 'a' && c <= 'f') return c - 'a' + 10;
+  return -1;
+}
+
+bool SlcanInterface::parseHex(const char *text, uint8_t digits, uint32_t &value) {
+  value = 0;
+  for (uint8_t i = 0; i < digits; i++) {
+    int8_t digit = hexValue(text[i]);
+    if (digit < 0) return false;
+    value = value << 4 | digit;
+  }
+  return true;
+}
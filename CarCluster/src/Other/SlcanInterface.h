@@ -0,0 +1,115 @@
+// ####################################################################################################################
+//
+// Code part of CarCluster project by Andrej Rolih. See .ino file more details
+//
+// ####################################################################################################################
+
+#ifndef SLCAN_INTERFACE
+#define SLCAN_INTERFACE
+
+#include "Arduino.h"
+
+#include "CanBusController.h"
+
+// Lawicel SLCAN on the serial port, so the device can be used as a CAN interface by the Linux slcan driver
+// (slcand -s6 -S921600 /dev/ttyUSB0), SavvyCAN (LAWICEL connection), python-can and similar tools.
+//
+// SLCAN commands start with a letter and end with CR, JSON messages start with {, so both share the serial port and
+// the sketch keeps working normally while the channel is closed. While it is open JSON is ignored and status messages
+// (serialOutput) are muted, SLCAN hosts would take them as part of the next frame. Supported: O, L (listen only, the
+// controller stops acknowledging and sending), C, Sn (must match the bitrate of the cluster bus, it can not be
+// changed), t/T/r/R, F, V, N, Zn (timestamps). M/m are accepted, but every frame is passed. The channel can only be
+// opened while the controller is running. Frames to send are queued in the serial receive buffer and sent a limited number per loop
+// so a host that sends as fast as it can does not starve the cluster.
+//
+// While the channel is open received frames (and optionally the frames the cluster sends) are queued from the frame
+// hook and written to serial from update(), as much as fits in the serial transmit buffer. Frames that do not fit in
+// the queue are dropped and reported by the F command (data overrun). Other serial output (replies to JSON actions,
+// status messages) still goes out and is ignored by SLCAN hosts.
+//
+// Over 921600 baud with a 500 kbit/s bus (Tools/slcan.cpp): frames to CAN are limited by the bus (the send waits for
+// the transmission), about 3250 frames/s with a 100 us loop. Frames from CAN reach the full bus rate (3700 frames/s of
+// 8 bytes) without timestamps as long as the loop takes less than about 500 us, with Z1 the serial link is the limit
+// (3545 frames/s). Reading two frames per loop limits the stream to 2 frames per loop pass.
+class SlcanInterface {
+  SlcanInterface(const SlcanInterface &other) = delete;
+  SlcanInterface(SlcanInterface &&other) = delete;
+  SlcanInterface &operator=(const SlcanInterface &other) = delete;
+  SlcanInterface &operator=(SlcanInterface &&other) = delete;
+
+  public:
+    static const uint8_t maximumCommandsPerUpdate = 16;
+    static const uint8_t queueSize = 64;              // Frames waiting to be written to serial
+    static const uint8_t maximumLineLength = 30;      // Longest command: T + 8 ID + DLC + 16 data
+
+    SlcanInterface(CanBusController **controllers, uint8_t controllerCount);
+    void update();                                    // Call every loop, writes queued frames to serial
+
+    // From the serial reader for bytes at the start of a line and after. False if the byte is not SLCAN (JSON).
+    bool readByte(char inByte);
+    bool acceptsCommands() { return commandsThisUpdate < maximumCommandsPerUpdate; }
+
+    // Called from the MCP_CAN frame hook
+    void frameSeen(uint8_t bus, bool transmitted, uint32_t id, bool extended, bool remote, uint8_t length, const uint8_t *data);
+
+    // Configuration (only while the channel is closed)
+    bool setBus(uint8_t bus);
+    void setStreamSentFrames(bool streamSentFrames) { this->streamSentFrames = streamSentFrames; }
+
+    bool isOpen() { return channelOpen; }
+    uint8_t bus() { return busNumber; }
+    bool streamsSentFrames() { return streamSentFrames; }
+    uint32_t sentFrames() { return framesSent; }
+    uint32_t failedFrames() { return framesFailed; }
+    uint32_t streamedFrames() { return framesStreamed; }
+    uint32_t droppedFrames() { return framesDropped; }
+    uint32_t invalidCommands() { return commandsInvalid; }
+
+  private:
+    struct Frame {
+      uint32_t id;
+      uint8_t length;
+      uint8_t flags;
+      uint8_t data[8];
+      uint16_t timestamp;                             // ms, wraps at 60000 like the Lawicel timestamp
+    };
+
+    CanBusController **controllers;
+    uint8_t controllerCount;
+    uint8_t busNumber = 1;
+    bool streamSentFrames = false;
+
+    bool channelOpen = false;
+    bool listenOnly = false;
+    bool timestamps = false;
+    bool overrun = false;                             // Frame dropped since the last F command
+
+    char line[maximumLineLength + 1];
+    uint8_t lineLength = 0;
+    bool lineOverflow = false;
+    bool lastByteEndedCommand = false;
+    uint8_t commandsThisUpdate = 0;
+
+    Frame queue[queueSize];
+    uint8_t queueHead = 0;
+    uint8_t queueCount = 0;
+
+    uint32_t framesSent = 0;
+    uint32_t framesFailed = 0;
+    uint32_t framesStreamed = 0;
+    uint32_t framesDropped = 0;
+    uint32_t commandsInvalid = 0;
+
+    CanBusController* controller();
+    void executeCommand();
+    bool sendFrame(bool extended, bool remote);
+    bool bitrateMatches(char code);
+    uint8_t statusFlags();
+    void reply(const char *text);
+    size_t encodeFrame(const Frame &frame, char *out);
+
+    static int8_t hexValue(char c);
+    static bool parseHex(const char *text, uint8_t digits, uint32_t &value);
+};
+
+#endif
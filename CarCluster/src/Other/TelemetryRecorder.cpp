@@ -0,0 +1,296 @@
+// ####################################################################################################################
+//
+// Code part of CarCluster project by Andrej Rolih. See .ino file more details
+//
+// ####################################################################################################################
+
+#include "TelemetryRecorder.h"
+#include "SerialOutput.h"
+
+TelemetryRecorder::TelemetryRecorder(GameState& game, size_t bufferSize): gameState(game) {
+  this->capacity = bufferSize;
+}
+
+void TelemetryRecorder::begin() {
+  // Prefer PSRAM for the buffer, so we do not take away heap from wifi and the web server
+  if (psramFound()) {
+    buffer = (uint8_t *)ps_malloc(capacity);
+  }
+  if (buffer == nullptr) {
+    buffer = (uint8_t *)malloc(capacity);
+  }
+  if (buffer == nullptr) {
+    serialOutput.println("Telemetry recorder buffer allocation failed");
+    capacity = 0;
+  }
+}
+
+void TelemetryRecorder::update() {
+  unsigned long currentTime = millis();
+
+  if (recording) {
+    GameStateSnapshot snapshot = GameStateSnapshot::fromGame(gameState);
+    uint16_t mask = snapshot.changedFields(lastRecorded);
+
+    // One button press per record, it is always written (the same button can be pressed twice in a row)
+    ButtonEvent buttonEvent;
+    if (gameState.nextButtonEvent(buttonEventPosition, buttonEvent)) {
+      snapshot.setButtonEvent(buttonEvent);
+      mask |= (1 << GameStateSnapshot::Field_ButtonEvent) | (1 << GameStateSnapshot::Field_ButtonHold);
+    }
+
+    if (mask != 0) {
+      if (recordsSinceKeyframe >= keyframeInterval) {
+        mask = GameStateSnapshot::allFields;
+      }
+
+      appendRecord(currentTime - lastRecordTime, mask, snapshot);
+      lastRecorded = snapshot;
+      lastRecorded.setButtonEvent({ 0, 0 });
+      lastRecordTime = currentTime;
+    }
+  } else if (replaying) {
+    if (replayRate > 0) {
+      replayElapsed += (currentTime - lastReplayUpdateTime) * replayRate;
+
+      while (replaying) {
+        uint32_t deltaTime;
+        uint16_t mask;
+        GameStateSnapshot nextState = replayState;
+        if (readRecord(replayOffset, &deltaTime, &mask, &nextState) == 0) {
+          stopReplay();
+          serialOutput.println("Telemetry replay finished");
+          break;
+        }
+
+        if (replayElapsed < deltaTime) break;
+        replayElapsed -= deltaTime;
+        applyNextReplayRecord();
+      }
+    }
+    lastReplayUpdateTime = currentTime;
+
+    // Apply the replayed state every time, so that any connected game does not interfere with the replay
+    replayState.applyTo(gameState);
+  }
+}
+
+bool TelemetryRecorder::startRecording() {
+  if (capacity == 0 || replaying) return false;
+
+  tail = 0;
+  used = 0;
+  records = 0;
+  recordedDuration = 0;
+
+  lastRecorded = GameStateSnapshot::fromGame(gameState);
+  lastRecordTime = millis();
+  buttonEventPosition = gameState.buttonEventCount;
+  appendRecord(0, GameStateSnapshot::allFields, lastRecorded);
+
+  recording = true;
+  return true;
+}
+
+void TelemetryRecorder::stopRecording() {
+  recording = false;
+}
+
+bool TelemetryRecorder::startReplay(uint8_t rate) {
+  if (recording || records == 0) return false;
+
+  replaying = true;
+  replayRate = rate;
+  replayOffset = 0;
+  replayElapsed = 0;
+  replayState = GameStateSnapshot();
+  lastReplayUpdateTime = millis();
+
+  // First record is always a keyframe and is applied immediately
+  applyNextReplayRecord();
+  return true;
+}
+
+void TelemetryRecorder::step(uint16_t count) {
+  if (!replaying || replayRate != 0) return;
+
+  for (uint16_t i = 0; i < count; i++) {
+    if (!applyNextReplayRecord()) {
+      stopReplay();
+      serialOutput.println("Telemetry replay finished");
+      break;
+    }
+  }
+}
+
+void TelemetryRecorder::stopReplay() {
+  replaying = false;
+}
+
+size_t TelemetryRecorder::exportSize() {
+  return headerSize + used;
+}
+
+size_t TelemetryRecorder::exportChunk(size_t offset, uint8_t *out, size_t length) {
+  const uint8_t header[headerSize] = { 'C', 'C', 'T', 'R', formatVersion, GameStateSnapshot::Field_Count, 0, 0 };
+  size_t total = exportSize();
+  size_t written = 0;
+
+  while (written < length && offset < total) {
+    if (offset < headerSize) {
+      out[written] = header[offset];
+    } else {
+      out[written] = buffer[(tail + offset - headerSize) % capacity];
+    }
+    written++;
+    offset++;
+  }
+
+  return written;
+}
+
+bool TelemetryRecorder::importRecording(const uint8_t *data, size_t length) {
+  if (recording || replaying || length < headerSize || length - headerSize > capacity) return false;
+  if (memcmp(data, "CCTR", 4) != 0 || data[4] != formatVersion || data[5] != GameStateSnapshot::Field_Count) return false;
+
+  memcpy(buffer, data + headerSize, length - headerSize);
+  tail = 0;
+  used = length - headerSize;
+  records = 0;
+  recordedDuration = 0;
+
+  // Validate all the records, so that replay does not have to deal with garbage
+  size_t offset = 0;
+  GameStateSnapshot snapshot;
+  while (offset < used) {
+    uint32_t deltaTime;
+    uint16_t mask;
+    size_t recordLength = readRecord(offset, &deltaTime, &mask, &snapshot);
+    if (recordLength == 0 || (offset == 0 && mask != GameStateSnapshot::allFields)) {
+      used = 0;
+      records = 0;
+      recordedDuration = 0;
+      return false;
+    }
+
+    if (offset > 0) recordedDuration += deltaTime;
+    offset += recordLength;
+    records++;
+  }
+
+  return true;
+}
+
+void TelemetryRecorder::appendRecord(uint32_t deltaTime, uint16_t mask, const GameStateSnapshot& snapshot) {
+  // Make space for the worst case record. Oldest records are dropped until the oldest one is a keyframe again
+  if (capacity < maximumRecordSize) return;
+  while (records > 0 && capacity - used < maximumRecordSize) {
+    dropOldestRecord();
+  }
+
+  while (records > 0) {
+    uint32_t oldestDeltaTime;
+    uint16_t oldestMask;
+    GameStateSnapshot oldest;
+    readRecord(0, &oldestDeltaTime, &oldestMask, &oldest);
+    if (oldestMask == GameStateSnapshot::allFields) break;
+    dropOldestRecord();
+  }
+
+  if (records == 0) {
+    mask = GameStateSnapshot::allFields;
+    deltaTime = 0;
+  }
+
+  uint8_t record[maximumRecordSize];
+  size_t length = 0;
+
+  // Delta time as LEB128 varint
+  uint32_t remainingTime = deltaTime;
+  do {
+    uint8_t byte = remainingTime & 0x7F;
+    remainingTime >>= 7;
+    if (remainingTime != 0) byte |= 0x80;
+    record[length++] = byte;
+  } while (remainingTime != 0);
+
+  length += snapshot.encode(mask, record + length);
+
+  for (size_t i = 0; i < length; i++) {
+    buffer[(tail + used + i) % capacity] = record[i];
+  }
+
+  if (records > 0) recordedDuration += deltaTime;
+  used += length;
+  records++;
+  recordsSinceKeyframe = (mask == GameStateSnapshot::allFields) ? 0 : recordsSinceKeyframe + 1;
+}
+
+size_t TelemetryRecorder::readRecord(size_t offset, uint32_t *deltaTime, uint16_t *mask, GameStateSnapshot *snapshot) {
+  if (offset >= used) return 0;
+
+  // Records can wrap around the end of the buffer, so copy them to a linear buffer first
+  uint8_t record[maximumRecordSize];
+  size_t available = used - offset;
+  if (available > maximumRecordSize) available = maximumRecordSize;
+  for (size_t i = 0; i < available; i++) {
+    record[i] = buffer[(tail + offset + i) % capacity];
+  }
+
+  size_t length = 0;
+  *deltaTime = 0;
+  while (true) {
+    if (length >= available || length >= 5) return 0;
+    uint8_t byte = record[length];
+    *deltaTime |= (uint32_t)(byte & 0x7F) << (7 * length);
+    length++;
+    if ((byte & 0x80) == 0) break;
+  }
+
+  if (available - length < 2) return 0;
+  *mask = record[length] | (record[length + 1] << 8);
+
+  size_t snapshotLength = snapshot->decode(record + length, available - length);
+  if (snapshotLength == 0) return 0;
+
+  return length + snapshotLength;
+}
+
+void TelemetryRecorder::dropOldestRecord() {
+  uint32_t deltaTime;
+  uint16_t mask;
+  GameStateSnapshot oldest;
+  size_t length = readRecord(0, &deltaTime, &mask, &oldest);
+  if (length == 0) {
+    used = 0;
+    records = 0;
+    recordedDuration = 0;
+    return;
+  }
+
+  tail = (tail + length) % capacity;
+  used -= length;
+  records--;
+
+  // Time between the dropped record and the new oldest one is no longer part of the recording
+  if (records > 0 && readRecord(0, &deltaTime, &mask, &oldest) > 0) {
+    recordedDuration -= deltaTime;
+  }
+}
+
+bool TelemetryRecorder::applyNextReplayRecord() {
+  uint32_t deltaTime;
+  uint16_t mask;
+  size_t length = readRecord(replayOffset, &deltaTime, &mask, &replayState);
+  if (length == 0) return false;
+
+  replayOffset += length;
+
+  // Button presses are one shot, only push them on the record where they were pressed
+  if (mask & (1 << GameStateSnapshot::Field_ButtonEvent)) {
+    gameState.pushButtonEvent(replayState.buttonEvent, replayState.buttonHoldDuration);
+  }
+  replayState.applyTo(gameState);
+
+  return true;
+}
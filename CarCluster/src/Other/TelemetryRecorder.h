@@ -0,0 +1,82 @@
+// ####################################################################################################################
+//
+// Code part of CarCluster project by Andrej Rolih. See .ino file more details
+//
+// ####################################################################################################################
+
+#ifndef TELEMETRY_RECORDER
+#define TELEMETRY_RECORDER
+
+#include "Arduino.h"
+
+#include "../Games/GameSimulation.h"
+#include "../Games/GameStateSnapshot.h"
+
+// Records changes of the game state into a ring buffer (PSRAM if available) and replays them back.
+//
+// Every record is: time since previous record in ms (LEB128 varint) followed by an encoded GameStateSnapshot
+// that only contains the fields that changed. Every keyframeInterval records all fields are written so that
+// the oldest records can be dropped when the buffer is full.
+//
+// Exported recordings start with an 8 byte header: "CCTR", format version, field count, 2 reserved bytes.
+class TelemetryRecorder {
+  TelemetryRecorder(const TelemetryRecorder &other) = delete;
+  TelemetryRecorder(TelemetryRecorder &&other) = delete;
+  TelemetryRecorder &operator=(const TelemetryRecorder &other) = delete;
+  TelemetryRecorder &operator=(TelemetryRecorder &&other) = delete;
+
+  public:
+    static const size_t headerSize = 8;
+
+    TelemetryRecorder(GameState& game, size_t bufferSize);
+    void begin();
+    void update();
+
+    bool startRecording();
+    void stopRecording();
+    bool startReplay(uint8_t rate);        // Rate is a multiple of real time, 0 means stepping with step()
+    void step(uint16_t count = 1);
+    void stopReplay();
+
+    bool isRecording() { return recording; }
+    bool isReplaying() { return replaying; }
+    size_t recordCount() { return records; }
+    unsigned long durationMs() { return recordedDuration; }
+
+    size_t exportSize();
+    size_t exportChunk(size_t offset, uint8_t *out, size_t length);
+    bool importRecording(const uint8_t *data, size_t length);
+
+  private:
+    static const uint8_t formatVersion = 2;     // 2: button hold duration
+    static const uint8_t keyframeInterval = 64;
+    static const size_t maximumRecordSize = 5 + GameStateSnapshot::maximumEncodedSize;
+
+    GameState &gameState;
+    uint8_t *buffer = nullptr;
+    size_t capacity;
+    size_t tail = 0;                       // Position of the oldest record
+    size_t used = 0;
+    size_t records = 0;
+    unsigned long recordedDuration = 0;
+
+    bool recording = false;
+    GameStateSnapshot lastRecorded;
+    unsigned long lastRecordTime = 0;
+    uint8_t recordsSinceKeyframe = 0;
+    uint32_t buttonEventPosition = 0;
+
+    bool replaying = false;
+    uint8_t replayRate = 1;
+    size_t replayOffset = 0;               // Offset of the next record relative to tail
+    GameStateSnapshot replayState;
+    unsigned long replayElapsed = 0;       // Replay time passed since the last applied record (in ms * rate)
+    unsigned long lastReplayUpdateTime = 0;
+
+    void appendRecord(uint32_t deltaTime, uint16_t mask, const GameStateSnapshot& snapshot);
+    size_t readRecord(size_t offset, uint32_t *deltaTime, uint16_t *mask, GameStateSnapshot *snapshot);
+    void dropOldestRecord();
+    bool applyNextReplayRecord();
+};
+
+#endif
@@ -6,8 +6,9 @@
 
 #include "WebDashboard.h"
 
-WebDashboard::WebDashboard(GameState &game, unsigned long webDashboardUpdateInterval): gameState(game) {
+WebDashboard::WebDashboard(GameState &game, unsigned long webDashboardUpdateInterval, unsigned long webDashboardStreamInterval): gameState(game) {
   this->webDashboardUpdateInterval = webDashboardUpdateInterval;
+  this->webDashboardStreamInterval = webDashboardStreamInterval;
 }
 
 void WebDashboard::getState(struct state *data) {
@@ -61,8 +62,9 @@ void WebDashboard::setState(struct state *data) {
 }
 
 void WebDashboard::steeringWheelAction(struct mg_str params) {
+  // Button number, optionally followed by L for a long press (for example "2L")
   if (params.len >= 1) {
-    gameState.buttonEventToProcess = params.buf[0] - '0';
+    gameState.pushButtonEvent(params.buf[0] - '0', (params.len >= 2 && params.buf[1] == 'L') ? longPressDuration : 0);
   }
 }
 
@@ -84,6 +86,8 @@ const char* WebDashboard::mapGenericGearToLocalGear(GearState inputGear) {
     case GearState_Auto_D: return "D"; break;
     case GearState_Auto_S: return "S"; break;
   }
+
+  return "P";
 }
 
 GearState WebDashboard::mapLocalGearToGenericGear(const char *gear) {
@@ -125,6 +129,8 @@ const char* WebDashboard::mapGenericDriveModeToLocalDriveMode(uint8_t driveMode)
     case 6: return "DSC off"; break;
     case 7: return "Eco pro"; break;
   }
+
+  return "Comfort";
 }
 
 uint8_t WebDashboard::mapLocalDriveModeToGenericDriveMode(const char *driveMode) {
@@ -150,11 +156,86 @@ uint8_t WebDashboard::mapLocalDriveModeToGenericDriveMode(const char *driveMode)
 }
 
 void WebDashboard::update() {
-  // Prevent too frequent updates of the web dashboard
+  // Prevent too frequent updates of the web dashboard. The state version only changes when the state does, so the UI
+  // is told about real changes only. GET /api/state does not depend on this, it compares the live state with the one
+  // its cached response was rendered from.
   if (millis() - lastWebDashboardUpdateTime >= webDashboardUpdateInterval) {
-    glue_update_state();
+    struct state currentState;
+    memset(&currentState, 0, sizeof(currentState));
+    getState(&currentState);
+    if (memcmp(&currentState, &publishedState, sizeof(currentState)) != 0) {
+      publishedState = currentState;
+      glue_update_state();
+    }
     lastWebDashboardUpdateTime = millis();
   }
+
+  updateStream();
+}
+
+void WebDashboard::updateStream() {
+  // State is pushed to the /api/stream websocket clients at most every webDashboardStreamInterval. The dashboard page
+  // (mongoose_fs.c, built by Tools/webpage.cpp) subscribes to it and only fetches /api/state on heartbeat changes
+  // while it is not connected.
+  if (millis() - lastStreamTime < webDashboardStreamInterval) {
+    return;
+  }
+  lastStreamTime = millis();
+
+  streamState = GameStateSnapshot::fromGame(gameState);
+  streamChangedFields = streamState.changedFields(lastStreamedState) & ~(1 << GameStateSnapshot::Field_ButtonEvent);
+  streamChangedFlags = streamState.flags ^ lastStreamedState.flags;
+
+  // Allow some jitter in the per client limit, slow clients are mostly held back by the backlog limit
+  streamClients = mongoose_ws_stream("stream", webDashboardStreamInterval / 2, 2048, streamChangedFields != 0, printStreamFrame, this);
+  lastStreamedState = streamState;
+}
+
+static void appendFormat(char *buf, size_t len, size_t &pos, const char *format, ...) {
+  if (pos >= len - 1) return;
+
+  va_list args;
+  va_start(args, format);
+  int written = vsnprintf(buf + pos, len - pos, format, args);
+  va_end(args);
+
+  if (written > 0) pos += written;
+  if (pos > len - 1) pos = len - 1;
+}
+
+size_t WebDashboard::printStreamFrame(void *userdata, char *buf, size_t len, bool full) {
+  // Frames look like: {"type":"delta","state":{"speed":54,"left_indicator":true}}
+  // Field names are the same as in the state API. Delta frames only contain the changed fields.
+  WebDashboard *dashboard = (WebDashboard *)userdata;
+  const GameStateSnapshot &state = dashboard->streamState;
+  uint16_t fields = full ? GameStateSnapshot::allFields : dashboard->streamChangedFields;
+  uint16_t flags = full ? 0xFFFF : dashboard->streamChangedFlags;
+
+  static const char *flagNames[] = { "ignition", "left_indicator", "right_indicator", "indicators_blink", "main_lights", "handbrake", "fog_rear", "fog_front", "high_beam", "door_open", "dsc", "abs", "battery" };
+
+  size_t pos = 0;
+  appendFormat(buf, len, pos, "{\"type\":\"%s\",\"state\":{", full ? "full" : "delta");
+  size_t fieldsStart = pos;
+
+  if (fields & (1 << GameStateSnapshot::Field_Speed)) appendFormat(buf, len, pos, "\"speed\":%d,", state.speed);
+  if (fields & (1 << GameStateSnapshot::Field_RPM)) appendFormat(buf, len, pos, "\"rpm\":%u,", state.rpm);
+  if (fields & (1 << GameStateSnapshot::Field_Gear)) appendFormat(buf, len, pos, "\"gear\":\"%s\",", dashboard->mapGenericGearToLocalGear(static_cast<GearState>(state.gear)));
+  if (fields & (1 << GameStateSnapshot::Field_Backlight)) appendFormat(buf, len, pos, "\"backlight\":%u,", state.backlightBrightness);
+  if (fields & (1 << GameStateSnapshot::Field_Coolant)) appendFormat(buf, len, pos, "\"coolant_temp\":%d,", state.coolantTemperature);
+  if (fields & (1 << GameStateSnapshot::Field_Fuel)) appendFormat(buf, len, pos, "\"fuel\":%d,", state.fuelQuantity);
+  if (fields & (1 << GameStateSnapshot::Field_OutdoorTemperature)) appendFormat(buf, len, pos, "\"outdoor_temp\":%d,", state.outdoorTemperature);
+  if (fields & (1 << GameStateSnapshot::Field_DriveMode)) appendFormat(buf, len, pos, "\"drive_mode\":\"%s\",", dashboard->mapGenericDriveModeToLocalDriveMode(state.driveMode));
+  if (fields & (1 << GameStateSnapshot::Field_Flags)) {
+    for (uint8_t i = 0; i < sizeof(flagNames) / sizeof(flagNames[0]); i++) {
+      if (flags & (1 << i)) appendFormat(buf, len, pos, "\"%s\":%s,", flagNames[i], (state.flags & (1 << i)) ? "true" : "false");
+    }
+  }
+
+  // Remove the trailing comma
+  if (pos > fieldsStart && buf[pos - 1] == ',') pos--;
+  appendFormat(buf, len, pos, "}}");
+
+  return pos;
 }
 
 void WebDashboard::handleDebug(struct debug &data, MCP_CAN& CAN1, MCP_CAN* CAN2) {
@@ -174,3 +255,718 @@ void WebDashboard::handleDebug(struct debug &data, MCP_CAN& CAN1, MCP_CAN* CAN2)
     }
   }
 }
+
+void WebDashboard::handleTelemetryRecording(struct mg_connection *c, int ev, void *ev_data, TelemetryRecorder& recorder) {
+  // Download is streamed in chunks, so that large (PSRAM) recordings do not need to be copied to the heap.
+  // Connection data holds the current offset and the total size of the download.
+  size_t *download = (size_t *)c->data;
+
+  if (ev == MG_EV_HTTP_MSG) {
+    struct mg_http_message *hm = (struct mg_http_message *)ev_data;
+
+    if (mg_strcmp(hm->method, mg_str("POST")) == 0) {
+      bool loaded = recorder.importRecording((const uint8_t *)hm->body.buf, hm->body.len);
+      mg_http_reply(c, loaded ? 200 : 400, "Content-Type: application/json\r\n", "{%m:%s,%m:%lu}\n", MG_ESC("loaded"), loaded ? "true" : "false", MG_ESC("records"), (unsigned long)recorder.recordCount());
+      c->is_draining = 1;
+    } else if (recorder.isRecording()) {
+      mg_http_reply(c, 409, "Content-Type: application/json\r\n", "{%m:%m}\n", MG_ESC("error"), MG_ESC("Stop recording first"));
+      c->is_draining = 1;
+    } else {
+      download[0] = 0;
+      download[1] = recorder.exportSize();
+      mg_printf(c, "HTTP/1.1 200 OK\r\nContent-Type: application/octet-stream\r\nContent-Disposition: attachment; filename=\"recording.cctr\"\r\nContent-Length: %lu\r\n\r\n", (unsigned long)download[1]);
+    }
+  }
+
+  if ((ev == MG_EV_HTTP_MSG || ev == MG_EV_POLL || ev == MG_EV_WRITE) && download[1] > 0) {
+    uint8_t chunk[512];
+    while (c->send.len < 2048 && download[0] < download[1]) {
+      size_t length = recorder.exportChunk(download[0], chunk, sizeof(chunk));
+      if (length == 0) break;
+      mg_send(c, chunk, length);
+      download[0] += length;
+    }
+
+    if (download[0] >= download[1]) {
+      download[1] = 0;
+      c->is_draining = 1;
+    }
+  }
+}
+
+void WebDashboard::handleTimeseries(struct mg_connection *c, struct mg_http_message *hm, SignalHistory& history) {
+  // Response: {"bucket_ms":1000, "rpm":{"min":[[timestamp,value],...],"max":[...]}, "speed":{...}, ...}
+  uint32_t timestamps[SignalHistory::bucketCount];
+  double minimums[SignalHistory::bucketCount];
+  double maximums[SignalHistory::bucketCount];
+
+  mg_printf(c, "HTTP/1.1 200 OK\r\nContent-Type: application/json\r\nCache-Control: no-cache\r\nTransfer-Encoding: chunked\r\n\r\n");
+  mg_http_printf_chunk(c, "{%m:%lu", MG_ESC("bucket_ms"), history.bucketDurationMs());
+
+  for (uint8_t i = 0; i < SignalHistory::Signal_Count; i++) {
+    SignalHistory::Signal signal = static_cast<SignalHistory::Signal>(i);
+    size_t count = history.series(signal, timestamps, minimums, maximums);
+    mg_http_printf_chunk(c, ",%m:{%m:[%M],%m:[%M]}", MG_ESC(SignalHistory::signalName(signal)), MG_ESC("min"), print_timeseries, timestamps, minimums, count, MG_ESC("max"), print_timeseries, timestamps, maximums, count);
+  }
+
+  mg_http_printf_chunk(c, "}\n");
+  mg_http_printf_chunk(c, "");
+}
+
+void WebDashboard::handleCanCapture(struct mg_connection *c, int ev, void *ev_data, CanCapture& capture) {
+  // GET /api/capture - capture status
+  // GET /api/capture/candump or /api/capture/pcap - stream captured frames (chunked)
+  // POST /api/capture - control: {"action":"start", "filters":[[id, mask], ...], "start_id":id, "stop_id":id, "post_frames":n, "stop_when_full":false}
+  //                              {"action":"stop"}
+  struct CaptureExport {
+    bool active;
+    uint8_t format;
+    uint32_t sequence;
+    uint32_t end;
+  };
+  CaptureExport *captureExport = (CaptureExport *)c->data;
+
+  if (ev == MG_EV_HTTP_MSG) {
+    struct mg_http_message *hm = (struct mg_http_message *)ev_data;
+
+    if (mg_strcmp(hm->method, mg_str("POST")) == 0) {
+      char *action = mg_json_get_str(hm->body, "$.action");
+      if (action != NULL && strcmp(action, "start") == 0) {
+        capture.stop();
+        capture.clearFilters();
+        for (int i = 0; i < CanCapture::maximumFilters; i++) {
+          char path[32];
+          long id, mask;
+          snprintf(path, sizeof(path), "$.filters[%d][0]", i);
+          id = mg_json_get_long(hm->body, path, -1);
+          snprintf(path, sizeof(path), "$.filters[%d][1]", i);
+          mask = mg_json_get_long(hm->body, path, 0x1FFFFFFF);
+          if (id < 0) break;
+          capture.addFilter(id, mask);
+        }
+        capture.setTriggers(mg_json_get_long(hm->body, "$.start_id", static_cast<long>(CanCapture::noTrigger)), mg_json_get_long(hm->body, "$.stop_id", static_cast<long>(CanCapture::noTrigger)), mg_json_get_long(hm->body, "$.post_frames", 0));
+        bool stopWhenFull = false;
+        mg_json_get_bool(hm->body, "$.stop_when_full", &stopWhenFull);
+        capture.setStopWhenFull(stopWhenFull);
+        capture.start();
+      } else if (action != NULL && strcmp(action, "stop") == 0) {
+        capture.stop();
+      }
+      mg_free(action);
+    }
+
+    bool isCandump = mg_match(hm->uri, mg_str("/api/capture/candump"), NULL);
+    bool isPcap = mg_match(hm->uri, mg_str("/api/capture/pcap"), NULL);
+
+    if (isCandump || isPcap) {
+      captureExport->active = true;
+      captureExport->format = isPcap ? CanCapture::ExportFormat_Pcap : CanCapture::ExportFormat_Candump;
+      captureExport->sequence = capture.oldestSequence();
+      captureExport->end = capture.endSequence();
+
+      mg_printf(c, "HTTP/1.1 200 OK\r\nContent-Type: %s\r\nContent-Disposition: attachment; filename=\"%s\"\r\nTransfer-Encoding: chunked\r\n\r\n", isPcap ? "application/vnd.tcpdump.pcap" : "text/plain", isPcap ? "capture.pcap" : "capture.log");
+
+      uint8_t header[CanCapture::maximumExportRecordSize];
+      size_t headerLength = capture.exportHeader(static_cast<CanCapture::ExportFormat>(captureExport->format), header);
+      if (headerLength > 0) {
+        mg_http_write_chunk(c, (const char *)header, headerLength);
+      }
+    } else {
+      const char *states[] = { "stopped", "armed", "capturing" };
+      mg_http_reply(c, 200, "Content-Type: application/json\r\nCache-Control: no-cache\r\n", "{%m:%m,%m:%lu,%m:%lu,%m:%lu,%m:%lu,%m:%lu,%m:%lu}\n",
+                    MG_ESC("state"), MG_ESC(states[capture.state()]),
+                    MG_ESC("captured"), (unsigned long)capture.capturedFrames(),
+                    MG_ESC("stored"), (unsigned long)capture.storedFrames(),
+                    MG_ESC("overwritten"), (unsigned long)capture.overwrittenFrames(),
+                    MG_ESC("filtered"), (unsigned long)capture.filteredFrames(),
+                    MG_ESC("average_cost_us"), (unsigned long)capture.averageCostMicros(),
+                    MG_ESC("maximum_cost_us"), (unsigned long)capture.maximumCostMicros());
+      c->is_draining = 1;
+    }
+  }
+
+  if ((ev == MG_EV_HTTP_MSG || ev == MG_EV_POLL || ev == MG_EV_WRITE) && captureExport->active) {
+    // Frames overwritten during the export are skipped
+    if ((int32_t)(captureExport->sequence - capture.oldestSequence()) < 0) {
+      captureExport->sequence = capture.oldestSequence();
+    }
+
+    while (c->send.len < 2048 && captureExport->sequence != captureExport->end) {
+      uint8_t chunk[512];
+      size_t length = 0;
+      while (length + CanCapture::maximumExportRecordSize <= sizeof(chunk) && captureExport->sequence != captureExport->end) {
+        length += capture.exportFrame(static_cast<CanCapture::ExportFormat>(captureExport->format), captureExport->sequence, chunk + length);
+        captureExport->sequence++;
+      }
+      if (length > 0) {
+        mg_http_write_chunk(c, (const char *)chunk, length);
+      }
+    }
+
+    if (captureExport->sequence == captureExport->end) {
+      mg_http_write_chunk(c, "", 0);
+      captureExport->active = false;
+      c->is_draining = 1;
+    }
+  }
+}
+
+static size_t printCalibrationPoints(void (*out)(char, void *), void *ptr, va_list *ap) {
+  const GaugeCalibration *calibration = va_arg(*ap, const GaugeCalibration *);
+  size_t len = 0;
+  for (uint8_t i = 0; i < calibration->pointCount(); i++) {
+    len += mg_xprintf(out, ptr, "%s[%ld,%ld]", i == 0 ? "" : ",", (long)calibration->pointInput(i), (long)calibration->pointOutput(i));
+  }
+  return len;
+}
+
+void WebDashboard::handleCalibration(struct mg_connection *c, int ev, void *ev_data, CalibrationAssistant& assistant) {
+  // GET /api/calibration - gauge curves and assistant status:
+  //                        {"speed":[[input, output], ...], "rpm":[...], "coolant":[...],
+  //                         "assistant":{"state":"waiting", "gauge":"speed", "step":2, "steps":7, "setpoint":86}}
+  // POST /api/calibration - replace one curve: {"gauge":"speed", "points":[[0, 0], [100, 104], [260, 260]]}
+  //                         2-8 points with increasing inputs, takes effect on the next cluster update
+  //                       - assistant: {"action":"start", "gauge":"speed"}, {"action":"confirm", "value":84} (omit value
+  //                         if the gauge shows the setpoint), {"action":"cancel"}
+  //                       - stored curves: {"action":"save", "gauge":"speed"}, {"action":"clear"} (all gauges)
+  if (ev != MG_EV_HTTP_MSG) return;
+
+  struct mg_http_message *hm = (struct mg_http_message *)ev_data;
+
+  if (mg_strcmp(hm->method, mg_str("POST")) == 0) {
+    char *action = mg_json_get_str(hm->body, "$.action");
+    char *gaugeName = mg_json_get_str(hm->body, "$.gauge");
+    CalibrationAssistant::Gauge gauge;
+    bool hasGauge = CalibrationAssistant::gaugeFromName(gaugeName, &gauge);
+    bool accepted = false;
+    double value;
+
+    if (action == NULL) {
+      int32_t inputs[GaugeCalibration::maximumPoints];
+      int32_t outputs[GaugeCalibration::maximumPoints];
+      uint8_t count = 0;
+      while (count < GaugeCalibration::maximumPoints) {
+        char path[32];
+        double input, output;
+        snprintf(path, sizeof(path), "$.points[%d][0]", count);
+        if (!mg_json_get_num(hm->body, path, &input)) break;
+        snprintf(path, sizeof(path), "$.points[%d][1]", count);
+        if (!mg_json_get_num(hm->body, path, &output)) break;
+        inputs[count] = lround(input);
+        outputs[count] = lround(output);
+        count++;
+      }
+
+      // Curves can not be edited while the assistant is driving the gauges
+      accepted = hasGauge && assistant.state() == CalibrationAssistant::State_Idle && assistant.calibration(gauge).setPoints(inputs, outputs, count);
+    } else if (strcmp(action, "start") == 0) {
+      accepted = hasGauge && assistant.start(gauge);
+    } else if (strcmp(action, "confirm") == 0) {
+      accepted = mg_json_get_num(hm->body, "$.value", &value) ? assistant.confirm(lround(value)) : assistant.confirm();
+    } else if (strcmp(action, "cancel") == 0) {
+      assistant.cancel();
+      accepted = true;
+    } else if (strcmp(action, "save") == 0) {
+      accepted = hasGauge && assistant.save(gauge);
+    } else if (strcmp(action, "clear") == 0) {
+      assistant.clearStored();
+      accepted = true;
+    }
+
+    mg_free(gaugeName);
+    mg_free(action);
+
+    if (!accepted) {
+      mg_http_reply(c, 400, "Content-Type: application/json\r\n", "{%m:%m}\n", MG_ESC("error"), MG_ESC("Calibration request not possible"));
+      c->is_draining = 1;
+      return;
+    }
+  }
+
+  const char *states[] = { "idle", "settling", "waiting" };
+  mg_http_reply(c, 200, "Content-Type: application/json\r\nCache-Control: no-cache\r\n", "{%m:[%M],%m:[%M],%m:[%M],%m:{%m:%m,%m:%m,%m:%d,%m:%d,%m:%ld}}\n",
+                MG_ESC("speed"), printCalibrationPoints, &assistant.calibration(CalibrationAssistant::Gauge_Speed),
+                MG_ESC("rpm"), printCalibrationPoints, &assistant.calibration(CalibrationAssistant::Gauge_RPM),
+                MG_ESC("coolant"), printCalibrationPoints, &assistant.calibration(CalibrationAssistant::Gauge_Coolant),
+                MG_ESC("assistant"), MG_ESC("state"), MG_ESC(states[assistant.state()]),
+                MG_ESC("gauge"), MG_ESC(CalibrationAssistant::gaugeName(assistant.gauge())),
+                MG_ESC("step"), static_cast<int>(assistant.step()), MG_ESC("steps"), static_cast<int>(CalibrationAssistant::setpointCount),
+                MG_ESC("setpoint"), (long)assistant.setpoint());
+  c->is_draining = 1;
+}
+
+static size_t printCanControllers(void (*out)(char, void *), void *ptr, va_list *ap) {
+  CanBusController **controllers = va_arg(*ap, CanBusController **);
+  int count = va_arg(*ap, int);
+  size_t len = 0;
+  for (int i = 0; i < count; i++) {
+    CanBusController *controller = controllers[i];
+    len += mg_xprintf(out, ptr, "%s{%m:%d,%m:%m,%m:%u,%m:%lu,%m:%lu,%m:%u,%m:%u,%m:%u,%m:%u,%m:%lu,%m:%lu}", i == 0 ? "" : ",",
+                      MG_ESC("bus"), controller->bus(),
+                      MG_ESC("state"), MG_ESC(CanBusController::stateName(controller->state())),
+                      MG_ESC("attempts"), controller->attempts(),
+                      MG_ESC("ready_ms"), controller->readyTime(),
+                      MG_ESC("backoff_ms"), controller->isRunning() ? 0UL : controller->backoff(),
+                      MG_ESC("rx_errors"), controller->receiveErrors(),
+                      MG_ESC("tx_errors"), controller->transmitErrors(),
+                      MG_ESC("error_flags"), controller->errorFlags(),
+                      MG_ESC("bus_off_count"), controller->busOffCount(),
+                      MG_ESC("failed_sends"), (unsigned long)controller->failedSends(),
+                      MG_ESC("dropped_frames"), (unsigned long)controller->droppedFrames());
+  }
+  return len;
+}
+
+static size_t printBootTimeline(void (*out)(char, void *), void *ptr, va_list *ap) {
+  BootTimeline *timeline = va_arg(*ap, BootTimeline *);
+  size_t len = 0;
+  for (uint8_t i = 0; i < BootTimeline::Milestone_Count; i++) {
+    BootTimeline::Milestone milestone = static_cast<BootTimeline::Milestone>(i);
+    if (!timeline->reached(milestone)) continue;
+    len += mg_xprintf(out, ptr, "%s%m:%lu", len == 0 ? "" : ",", MG_ESC(BootTimeline::milestoneName(milestone)), timeline->time(milestone));
+  }
+  return len;
+}
+
+void WebDashboard::handleStatus(struct mg_connection *c, int ev, void *ev_data, CanBusController **controllers, uint8_t controllerCount, BootTimeline& timeline) {
+  // GET /api/status - {"uptime_ms":12345, "boot":{"setup":1,"can_ready":30,...}, "can":[{"bus":1,"state":"running",...}],
+  // "state_cache":{"rendered":12,"served":340,"not_modified":2210}}
+  // Boot milestones are in ms since power on and only listed once reached
+  if (ev != MG_EV_HTTP_MSG) return;
+
+  struct mongoose_http_cache_stats stateCache;
+  memset(&stateCache, 0, sizeof(stateCache));
+  mongoose_http_cache_stats("state", &stateCache);
+
+  mg_http_reply(c, 200, "Content-Type: application/json\r\nCache-Control: no-cache\r\n", "{%m:%lu,%m:{%M},%m:[%M],%m:{%m:%lu,%m:%lu,%m:%lu}}\n",
+                MG_ESC("uptime_ms"), millis(),
+                MG_ESC("boot"), printBootTimeline, &timeline,
+                MG_ESC("can"), printCanControllers, controllers, static_cast<int>(controllerCount),
+                MG_ESC("state_cache"),
+                MG_ESC("rendered"), stateCache.rendered,
+                MG_ESC("served"), stateCache.served,
+                MG_ESC("not_modified"), stateCache.not_modified);
+  c->is_draining = 1;
+}
+
+static size_t printBusFrames(void (*out)(char, void *), void *ptr, va_list *ap) {
+  const CanBusLoad::Bus *bus = va_arg(*ap, const CanBusLoad::Bus *);
+  size_t len = 0;
+  for (uint8_t i = 0; i < bus->frameCount; i++) {
+    const CanBusLoad::Frame &frame = bus->frames[i];
+    len += mg_xprintf(out, ptr, "%s{%m:%lu,%m:%u,%m:%u,%m:%lu,%m:%lu}", i == 0 ? "" : ",",
+                      MG_ESC("id"), (unsigned long)frame.id,
+                      MG_ESC("dlc"), frame.dlc,
+                      MG_ESC("period_ms"), frame.period,
+                      MG_ESC("bits"), (unsigned long)CanBusLoad::frameBits(frame),
+                      MG_ESC("response_us"), (unsigned long)CanBusLoad::responseTime(*bus, i));
+  }
+  return len;
+}
+
+static size_t printBuses(void (*out)(char, void *), void *ptr, va_list *ap) {
+  const CanBusLoad::Bus *buses = va_arg(*ap, const CanBusLoad::Bus *);
+  int count = va_arg(*ap, int);
+  size_t len = 0;
+  for (int i = 0; i < count; i++) {
+    const CanBusLoad::Bus &bus = buses[i];
+    len += mg_xprintf(out, ptr, "%s{%m:%m,%m:%u,%m:%g,%m:%s,%m:[%M]}", i == 0 ? "" : ",",
+                      MG_ESC("name"), MG_ESC(bus.name),
+                      MG_ESC("bitrate_kbps"), bus.bitrate,
+                      MG_ESC("load_percent"), CanBusLoad::utilization(bus) / 10000.0,
+                      MG_ESC("meets_deadlines"), CanBusLoad::meetsDeadlines(bus) ? "true" : "false",
+                      MG_ESC("frames"), printBusFrames, &bus);
+  }
+  return len;
+}
+
+void WebDashboard::handleBusLoad(struct mg_connection *c, int ev, void *ev_data, const CanBusLoad::Bus *buses, uint8_t busCount) {
+  // GET /api/busload - {"budget_percent":50, "buses":[{"name":"BMW F","bitrate_kbps":500,"load_percent":5.18,...,
+  // "frames":[{"id":303,"dlc":8,"period_ms":100,"bits":135,"response_us":960},...]}]}
+  // Worst case values for the frames the cluster sends (see CanBusLoad.h), traffic of other devices is not included
+  if (ev != MG_EV_HTTP_MSG) return;
+
+  mg_http_reply(c, 200, "Content-Type: application/json\r\nCache-Control: no-cache\r\n", "{%m:%d,%m:[%M]}\n",
+                MG_ESC("budget_percent"), static_cast<int>(CanBusLoad::utilizationBudget / 10000),
+                MG_ESC("buses"), printBuses, buses, static_cast<int>(busCount));
+  c->is_draining = 1;
+}
+
+static size_t printMetricFamily(void (*out)(char, void *), void *ptr, const char *name, const char *type, const char *help) {
+  return mg_xprintf(out, ptr, "# TYPE carcluster_%s %s\n# HELP carcluster_%s %s\n", name, type, name, help);
+}
+
+static size_t printFrameMetric(void (*out)(char, void *), void *ptr, const char *name, const RuntimeMetrics::FrameCounters &counters, uint32_t value, bool other) {
+  if (other) return mg_xprintf(out, ptr, "carcluster_%s_total{id=\"other\"} %lu\n", name, (unsigned long)value);
+  return mg_xprintf(out, ptr, RuntimeMetrics::frameExtended(counters.key) ? "carcluster_%s_total{bus=\"%u\",id=\"0x%08lx\"} %lu\n"
+                                                                            : "carcluster_%s_total{bus=\"%u\",id=\"0x%03lx\"} %lu\n",
+                    name, RuntimeMetrics::frameBus(counters.key), (unsigned long)RuntimeMetrics::frameId(counters.key), (unsigned long)value);
+}
+
+static size_t printFrameMetrics(void (*out)(char, void *), void *ptr, va_list *ap) {
+  RuntimeMetrics *metrics = va_arg(*ap, RuntimeMetrics *);
+  size_t len = 0;
+  static const char *names[] = { "can_tx_attempts", "can_tx_failures", "can_rx_frames" };
+  static const char *helps[] = { "Frames handed to the CAN controller.", "Frames the CAN controller did not send.", "Frames read from the CAN controller." };
+
+  for (uint8_t metric = 0; metric < 3; metric++) {
+    len += printMetricFamily(out, ptr, names[metric], "counter", helps[metric]);
+    for (int slot = 0; slot <= RuntimeMetrics::maximumFrameIds; slot++) {
+      bool other = slot == RuntimeMetrics::maximumFrameIds;
+      const RuntimeMetrics::FrameCounters &counters = other ? metrics->otherFrameCounters() : metrics->frameCounters(slot);
+      if (!other && counters.key == RuntimeMetrics::emptyKey) continue;
+
+      // IDs are usually only sent or only received, leave out the half that is always 0
+      bool sent = counters.transmitted.value() > 0;
+      if (metric == 2 ? counters.received.value() == 0 : !sent) continue;
+
+      const MetricCounter &counter = metric == 0 ? counters.transmitted : metric == 1 ? counters.transmitFailures : counters.received;
+      len += printFrameMetric(out, ptr, names[metric], counters, counter.value(), other);
+    }
+  }
+  return len;
+}
+
+static size_t printBusMetrics(void (*out)(char, void *), void *ptr, va_list *ap) {
+  RuntimeMetrics *metrics = va_arg(*ap, RuntimeMetrics *);
+  CanBusController **controllers = va_arg(*ap, CanBusController **);
+  int count = va_arg(*ap, int);
+  size_t len = printMetricFamily(out, ptr, "can_tx_results", "counter", "Frames sent, by sendMsgBuf return code.");
+  for (int i = 0; i < count; i++) {
+    for (uint8_t result = 0; result < RuntimeMetrics::sendResultCount; result++) {
+      len += mg_xprintf(out, ptr, "carcluster_can_tx_results_total{bus=\"%u\",result=\"%s\"} %lu\n", controllers[i]->bus(),
+                        RuntimeMetrics::sendResultName(result), (unsigned long)metrics->sendResults(controllers[i]->bus(), result));
+    }
+  }
+
+  len += printMetricFamily(out, ptr, "can_rx_overflows", "counter", "Receive buffer overflows.");
+  for (int i = 0; i < count; i++) {
+    len += mg_xprintf(out, ptr, "carcluster_can_rx_overflows_total{bus=\"%u\"} %lu\n", controllers[i]->bus(), (unsigned long)controllers[i]->receiveOverflows());
+  }
+  len += printMetricFamily(out, ptr, "can_dropped_frames", "counter", "Frames not sent while the bus was off.");
+  for (int i = 0; i < count; i++) {
+    len += mg_xprintf(out, ptr, "carcluster_can_dropped_frames_total{bus=\"%u\"} %lu\n", controllers[i]->bus(), (unsigned long)controllers[i]->droppedFrames());
+  }
+  len += printMetricFamily(out, ptr, "can_bus_off", "counter", "Times the bus went off.");
+  for (int i = 0; i < count; i++) {
+    len += mg_xprintf(out, ptr, "carcluster_can_bus_off_total{bus=\"%u\"} %lu\n", controllers[i]->bus(), (unsigned long)controllers[i]->busOffCount());
+  }
+  return len;
+}
+
+static size_t printGameMetrics(void (*out)(char, void *), void *ptr, va_list *ap) {
+  RuntimeMetrics *metrics = va_arg(*ap, RuntimeMetrics *);
+  size_t len = printMetricFamily(out, ptr, "game_packets", "counter", "Game packets applied to the game state.");
+  for (uint8_t i = 0; i < metrics->gameCount(); i++) {
+    len += mg_xprintf(out, ptr, "carcluster_game_packets_total{source=\"%s\"} %lu\n", metrics->gameName(i), (unsigned long)metrics->game(i).packetCount());
+  }
+  len += printMetricFamily(out, ptr, "game_decode_errors", "counter", "Game packets that could not be decoded.");
+  for (uint8_t i = 0; i < metrics->gameCount(); i++) {
+    len += mg_xprintf(out, ptr, "carcluster_game_decode_errors_total{source=\"%s\"} %lu\n", metrics->gameName(i), (unsigned long)metrics->game(i).decodeErrorCount());
+  }
+  len += printMetricFamily(out, ptr, "game_packet_rate", "gauge", "Game packets per second over the last second.");
+  for (uint8_t i = 0; i < metrics->gameCount(); i++) {
+    len += mg_xprintf(out, ptr, "carcluster_game_packet_rate{source=\"%s\"} %lu\n", metrics->gameName(i), (unsigned long)metrics->gamePacketRate(i));
+  }
+  return len;
+}
+
+void WebDashboard::handleMetrics(struct mg_connection *c, int ev, void *ev_data, RuntimeMetrics& metrics, CanBusController **controllers, uint8_t controllerCount) {
+  // GET /metrics - OpenMetrics text for Prometheus. Counters only ever increase (until a reboot or a 32 bit wrap),
+  // use rate() on them. Per CAN ID series only exist for IDs that were seen.
+  if (ev != MG_EV_HTTP_MSG) return;
+
+  mg_http_reply(c, 200, "Content-Type: application/openmetrics-text; version=1.0.0; charset=utf-8\r\nCache-Control: no-cache\r\n",
+                "%M%M%M"
+                "# TYPE carcluster_serial_parse_failures counter\ncarcluster_serial_parse_failures_total %lu\n"
+                "# TYPE carcluster_loop_iterations counter\ncarcluster_loop_iterations_total %lu\n"
+                "# TYPE carcluster_loop_rate gauge\ncarcluster_loop_rate %lu\n"
+                "# TYPE carcluster_heap_free_bytes gauge\ncarcluster_heap_free_bytes %lu\n"
+                "# TYPE carcluster_heap_minimum_free_bytes gauge\ncarcluster_heap_minimum_free_bytes %lu\n"
+                "# TYPE carcluster_uptime_seconds gauge\ncarcluster_uptime_seconds %lu\n"
+                "# EOF\n",
+                printFrameMetrics, &metrics,
+                printBusMetrics, &metrics, controllers, static_cast<int>(controllerCount),
+                printGameMetrics, &metrics,
+                (unsigned long)metrics.serialParseFailureCount(),
+                (unsigned long)metrics.loopIterations(),
+                (unsigned long)metrics.loopRate(),
+                (unsigned long)ESP.getFreeHeap(),
+                (unsigned long)ESP.getMinFreeHeap(),
+                millis() / 1000);
+  c->is_draining = 1;
+}
+
+static size_t printLatencyBuckets(void (*out)(char, void *), void *ptr, va_list *ap) {
+  const LatencyHistogram *histogram = va_arg(*ap, const LatencyHistogram *);
+  size_t len = 0;
+  uint8_t last = 0;
+  for (uint8_t i = 0; i < LatencyHistogram::bucketCount; i++) {
+    if (histogram->bucketSamples(i) > 0) last = i;
+  }
+  for (uint8_t i = 0; i <= last && histogram->count() > 0; i++) {
+    len += mg_xprintf(out, ptr, "%s%lu", i == 0 ? "" : ",", (unsigned long)histogram->bucketSamples(i));
+  }
+  return len;
+}
+
+static size_t printLatencySignals(void (*out)(char, void *), void *ptr, va_list *ap) {
+  LatencyTracer *tracer = va_arg(*ap, LatencyTracer *);
+  size_t len = 0;
+  bool first = true;
+  for (uint8_t signal = 0; signal < LatencySignal_Count; signal++) {
+    if (!tracer->isTraced(signal)) continue;
+
+    const LatencyHistogram &histogram = tracer->histogram(signal);
+    len += mg_xprintf(out, ptr, "%s{%m:%m,%m:%lu,%m:%lu,%m:%lu,%m:%lu,%m:%lu,%m:%lu,%m:[%M]}", first ? "" : ",",
+                      MG_ESC("name"), MG_ESC(latencySignalName(signal)),
+                      MG_ESC("count"), (unsigned long)histogram.count(),
+                      MG_ESC("mean_us"), (unsigned long)histogram.mean(),
+                      MG_ESC("p50_us"), (unsigned long)histogram.percentile(50),
+                      MG_ESC("p90_us"), (unsigned long)histogram.percentile(90),
+                      MG_ESC("p99_us"), (unsigned long)histogram.percentile(99),
+                      MG_ESC("max_us"), (unsigned long)histogram.maximum(),
+                      MG_ESC("buckets"), printLatencyBuckets, &histogram);
+    first = false;
+  }
+  return len;
+}
+
+void WebDashboard::handleLatency(struct mg_connection *c, int ev, void *ev_data, LatencyTracer& tracer) {
+  // GET /api/latency - time from a telemetry packet arriving to the first CAN frame with the new value, per signal:
+  // {"signals":[{"name":"speed","count":1200,"mean_us":31000,"p50_us":28000,...,"buckets":[0,0,1,...]}]}
+  // Bucket 0 is 0 us, bucket n counts 2^(n-1) to 2^n - 1 us. Signals the cluster does not send on CAN are left out.
+  // POST /api/latency - {"action":"reset"} clears the histograms
+  if (ev != MG_EV_HTTP_MSG) return;
+  struct mg_http_message *hm = (struct mg_http_message *)ev_data;
+
+  if (mg_strcmp(hm->method, mg_str("POST")) == 0) {
+    char *action = mg_json_get_str(hm->body, "$.action");
+    if (action != NULL && strcmp(action, "reset") == 0) {
+      tracer.reset();
+      mg_http_reply(c, 200, "Content-Type: application/json\r\n", "{%m:%s}\n", MG_ESC("reset"), "true");
+    } else {
+      mg_http_reply(c, 400, "Content-Type: application/json\r\n", "{%m:%m}\n", MG_ESC("error"), MG_ESC("unknown action"));
+    }
+    mg_free(action);
+    c->is_draining = 1;
+    return;
+  }
+
+  mg_http_reply(c, 200, "Content-Type: application/json\r\nCache-Control: no-cache\r\n", "{%m:[%M]}\n",
+                MG_ESC("signals"), printLatencySignals, &tracer);
+  c->is_draining = 1;
+}
+
+static size_t printValidatedFrames(void (*out)(char, void *), void *ptr, va_list *ap) {
+  FrameValidator *validator = va_arg(*ap, FrameValidator *);
+  size_t len = 0;
+  for (uint8_t i = 0; i < validator->frameCount(); i++) {
+    const FrameValidator::FrameStats &stats = validator->frameStats(i);
+    len += mg_xprintf(out, ptr, "%s{%m:%lu,%m:%u,%m:%u,%m:%lu,%m:%lu,%m:%lu,%m:%lu,%m:%lu,%m:%lu,%m:%s}", i == 0 ? "" : ",",
+                      MG_ESC("id"), (unsigned long)stats.id,
+                      MG_ESC("bus"), stats.bus,
+                      MG_ESC("period_ms"), stats.period,
+                      MG_ESC("frames"), (unsigned long)stats.frames,
+                      MG_ESC("checksum_errors"), (unsigned long)stats.checksumErrors,
+                      MG_ESC("counter_errors"), (unsigned long)stats.counterErrors,
+                      MG_ESC("late"), (unsigned long)stats.lateFrames,
+                      MG_ESC("early"), (unsigned long)stats.earlyFrames,
+                      MG_ESC("max_interval_ms"), (unsigned long)stats.maximumInterval,
+                      MG_ESC("missing"), validator->isMissing(i, millis()) ? "true" : "false");
+  }
+  return len;
+}
+
+static size_t printValidatedSignals(void (*out)(char, void *), void *ptr, va_list *ap) {
+  FrameValidator *validator = va_arg(*ap, FrameValidator *);
+  size_t len = 0;
+  bool first = true;
+  for (uint8_t signal = 0; signal < LatencySignal_Count; signal++) {
+    const FrameValidator::SignalStats &stats = validator->signalStats(signal);
+    if (stats.matches == 0 && stats.mismatches == 0) continue;
+
+    len += mg_xprintf(out, ptr, "%s{%m:%m,%m:%lu,%m:%lu", first ? "" : ",",
+                      MG_ESC("name"), MG_ESC(latencySignalName(signal)),
+                      MG_ESC("matched"), (unsigned long)stats.matches,
+                      MG_ESC("mismatched"), (unsigned long)stats.mismatches);
+    if (stats.mismatches != 0) {
+      len += mg_xprintf(out, ptr, ",%m:{%m:%lu,%m:%ld,%m:%ld}",
+                        MG_ESC("last_mismatch"),
+                        MG_ESC("id"), (unsigned long)stats.lastMismatchId,
+                        MG_ESC("decoded"), (long)stats.lastMismatchDecoded,
+                        MG_ESC("expected"), (long)stats.lastMismatchExpected);
+    }
+    len += mg_xprintf(out, ptr, "}");
+    first = false;
+  }
+  return len;
+}
+
+void WebDashboard::handleValidation(struct mg_connection *c, int ev, void *ev_data, FrameValidator& validator) {
+  // GET /api/validation - checks of the frames the cluster sent against its schedule and the game state:
+  // {"enabled":true,"decoder":true,"unscheduled":0,"frames":[{"id":417,"bus":0,"period_ms":100,"frames":310,"checksum_errors":0,
+  // "counter_errors":0,"late":1,"early":0,"max_interval_ms":131,"missing":false},...],
+  // "signals":[{"name":"speed","matched":310,"mismatched":0},...]}
+  // Bus is 0 when the cluster uses a single bus. Signals are only listed once a decoded frame carried them.
+  // POST /api/validation - {"action":"reset"} clears the counters, {"action":"enable"} and {"action":"disable"} turn the
+  // validator on and off (it is off unless FRAME_VALIDATOR_ENABLED is set)
+  if (ev != MG_EV_HTTP_MSG) return;
+  struct mg_http_message *hm = (struct mg_http_message *)ev_data;
+
+  if (mg_strcmp(hm->method, mg_str("POST")) == 0) {
+    char *action = mg_json_get_str(hm->body, "$.action");
+    if (action != NULL && strcmp(action, "reset") == 0) {
+      validator.reset();
+      mg_http_reply(c, 200, "Content-Type: application/json\r\n", "{%m:%s}\n", MG_ESC("reset"), "true");
+    } else if (action != NULL && (strcmp(action, "enable") == 0 || strcmp(action, "disable") == 0)) {
+      validator.setEnabled(strcmp(action, "enable") == 0);
+      mg_http_reply(c, 200, "Content-Type: application/json\r\n", "{%m:%s}\n", MG_ESC("enabled"), validator.isEnabled() ? "true" : "false");
+    } else {
+      mg_http_reply(c, 400, "Content-Type: application/json\r\n", "{%m:%m}\n", MG_ESC("error"), MG_ESC("unknown action"));
+    }
+    mg_free(action);
+    c->is_draining = 1;
+    return;
+  }
+
+  mg_http_reply(c, 200, "Content-Type: application/json\r\nCache-Control: no-cache\r\n", "{%m:%s,%m:%s,%m:%lu,%m:[%M],%m:[%M]}\n",
+                MG_ESC("enabled"), validator.isEnabled() ? "true" : "false",
+                MG_ESC("decoder"), validator.hasDecoder() ? "true" : "false",
+                MG_ESC("unscheduled"), (unsigned long)validator.unscheduledFrames(),
+                MG_ESC("frames"), printValidatedFrames, &validator,
+                MG_ESC("signals"), printValidatedSignals, &validator);
+  c->is_draining = 1;
+}
+
+// Whole number at path (defaultValue when it is missing), false when it is not a number or does not fit the field:
+// "to":300 must not become 44 in a byte
+template <typename T>
+static bool readJsonNumber(struct mg_str json, const char *path, T defaultValue, T &value) {
+  if (mg_json_get(json, path, NULL) < 0) {
+    value = defaultValue;
+    return true;
+  }
+  double number;
+  if (!mg_json_get_num(json, path, &number) || number < 0 || number > (T)~(T)0 || number != (double)(uint32_t)number) return false;
+  value = (T)number;
+  return true;
+}
+
+static bool readInjectionFrame(struct mg_str json, const char *prefix, InjectionSequencer::Frame &frame) {
+  char path[48];
+  uint8_t length = 0;
+  for (; length <= 8; length++) {
+    snprintf(path, sizeof(path), "%s.data[%u]", prefix, length);
+    if (mg_json_get(json, path, NULL) < 0) break;
+    if (length == 8 || !readJsonNumber(json, path, (uint8_t)0, frame.data[length])) return false;
+  }
+  frame.length = length;
+
+  bool extended = false;
+  snprintf(path, sizeof(path), "%s.extended", prefix);
+  mg_json_get_bool(json, path, &extended);
+  frame.extended = extended;
+  bool valid = true;
+  snprintf(path, sizeof(path), "%s.id", prefix);
+  valid = readJsonNumber(json, path, (uint32_t)0, frame.id) && valid;
+  snprintf(path, sizeof(path), "%s.period", prefix);
+  valid = readJsonNumber(json, path, (uint16_t)100, frame.period) && valid;
+  snprintf(path, sizeof(path), "%s.hold", prefix);
+  valid = readJsonNumber(json, path, (uint16_t)0, frame.hold) && valid;
+  return valid;
+}
+
+static size_t printInjectionFrame(void (*out)(char, void *), void *ptr, va_list *ap) {
+  const InjectionSequencer::Frame *frame = va_arg(*ap, const InjectionSequencer::Frame *);
+  size_t len = mg_xprintf(out, ptr, "{%m:%lu,%m:%s,%m:[", MG_ESC("id"), (unsigned long)frame->id, MG_ESC("extended"), frame->extended ? "true" : "false", MG_ESC("data"));
+  for (uint8_t i = 0; i < frame->length; i++) {
+    len += mg_xprintf(out, ptr, "%s%u", i == 0 ? "" : ",", frame->data[i]);
+  }
+  len += mg_xprintf(out, ptr, "]}");
+  return len;
+}
+
+static size_t printInjectionLog(void (*out)(char, void *), void *ptr, va_list *ap) {
+  InjectionSequencer *sequencer = va_arg(*ap, InjectionSequencer *);
+  size_t len = 0;
+  for (uint8_t i = 0; i < sequencer->logCount(); i++) {
+    const InjectionSequencer::StepRecord &record = sequencer->logRecord(i);
+    len += mg_xprintf(out, ptr, "%s{%m:%lu,%m:%u,%m:%u}", i == 0 ? "" : ",",
+                      MG_ESC("time_ms"), (unsigned long)record.time,
+                      MG_ESC("step"), record.step,
+                      MG_ESC("loop"), record.loop);
+  }
+  return len;
+}
+
+void WebDashboard::handleSequencer(struct mg_connection *c, int ev, void *ev_data, InjectionSequencer& sequencer) {
+  // GET /api/sequencer - injection program status and the start time of the last steps:
+  // {"state":"running","program":"sweep","bus":1,"step":3,"steps":256,"loop":0,"sent":42,"failed":0,
+  // "frame":{"id":1571,"extended":false,"data":[0,0,3,0]},"log":[{"time_ms":52310,"step":0,"loop":0},...]}
+  // The frame of a logged step is the one of the program, it can be calculated from the step.
+  // POST /api/sequencer - start a program (bus, hold, loops and period are optional, period is per frame):
+  //                       {"action":"start", "program":"sweep", "bus":1, "id":1571, "data":[0,0,0,0], "byte":2,
+  //                        "from":0, "to":255, "increment":1, "hold":500, "period":100, "loops":1}
+  //                       {"action":"start", "program":"bits", "id":1571, "data":[0,0,0,0], "first":0, "last":31}
+  //                       {"action":"start", "program":"cycle", "frames":[{"id":1571, "data":[1,2], "period":50,
+  //                        "hold":2000}, ...], "loops":0}
+  //                     - {"action":"stop"}, {"action":"next"}, {"action":"previous"} (hold 0 only advances on next)
+  if (ev != MG_EV_HTTP_MSG) return;
+  struct mg_http_message *hm = (struct mg_http_message *)ev_data;
+
+  if (mg_strcmp(hm->method, mg_str("POST")) == 0) {
+    char *action = mg_json_get_str(hm->body, "$.action");
+    bool accepted = false;
+
+    if (action != NULL && strcmp(action, "start") == 0) {
+      char *programName = mg_json_get_str(hm->body, "$.program");
+      InjectionSequencer::Program program;
+      program.type = InjectionSequencer::programType(programName);
+      bool valid = readJsonNumber(hm->body, "$.bus", (uint8_t)1, program.bus) &&
+                   readJsonNumber(hm->body, "$.hold", (uint16_t)1000, program.hold) &&
+                   readJsonNumber(hm->body, "$.loops", (uint16_t)1, program.loops) &&
+                   readInjectionFrame(hm->body, "$", program.base) &&
+                   readJsonNumber(hm->body, "$.byte", (uint8_t)0, program.byteIndex) &&
+                   readJsonNumber(hm->body, "$.from", (uint8_t)0, program.from) &&
+                   readJsonNumber(hm->body, "$.to", (uint8_t)255, program.to) &&
+                   readJsonNumber(hm->body, "$.increment", (uint8_t)1, program.increment) &&
+                   readJsonNumber(hm->body, "$.first", (uint8_t)0, program.firstBit) &&
+                   readJsonNumber(hm->body, "$.last", (uint8_t)(program.base.length * 8 - 1), program.lastBit);
+      for (int i = 0; i <= InjectionSequencer::maximumCycleFrames; i++) {
+        char path[32];
+        snprintf(path, sizeof(path), "$.frames[%d]", i);
+        if (mg_json_get(hm->body, path, NULL) < 0) break;
+        if (i == InjectionSequencer::maximumCycleFrames || !readInjectionFrame(hm->body, path, program.frames[i])) valid = false;
+        program.frameCount = i + 1;
+      }
+      accepted = valid && sequencer.start(program);
+      mg_free(programName);
+    } else if (action != NULL && strcmp(action, "stop") == 0) {
+      sequencer.stop();
+      accepted = true;
+    } else if (action != NULL && (strcmp(action, "next") == 0 || strcmp(action, "previous") == 0)) {
+      accepted = sequencer.step(strcmp(action, "next") == 0);
+    }
+
+    mg_http_reply(c, accepted ? 200 : 400, "Content-Type: application/json\r\n", "{%m:%s}\n", MG_ESC("accepted"), accepted ? "true" : "false");
+    mg_free(action);
+    c->is_draining = 1;
+    return;
+  }
+
+  const char *states[] = { "idle", "running", "finished" };
+  const InjectionSequencer::Program &program = sequencer.program();
+  mg_http_reply(c, 200, "Content-Type: application/json\r\nCache-Control: no-cache\r\n", "{%m:%m,%m:%m,%m:%u,%m:%u,%m:%u,%m:%u,%m:%lu,%m:%lu,%m:%M,%m:[%M]}\n",
+                MG_ESC("state"), MG_ESC(states[sequencer.state()]),
+                MG_ESC("program"), MG_ESC(InjectionSequencer::programName(program.type)),
+                MG_ESC("bus"), program.bus,
+                MG_ESC("step"), sequencer.currentStep(),
+                MG_ESC("steps"), sequencer.stepCount(),
+                MG_ESC("loop"), sequencer.currentLoop(),
+                MG_ESC("sent"), (unsigned long)sequencer.sentFrames(),
+                MG_ESC("failed"), (unsigned long)sequencer.failedFrames(),
+                MG_ESC("frame"), printInjectionFrame, &sequencer.activeStepFrame(),
+                MG_ESC("log"), printInjectionLog, &sequencer);
+  c->is_draining = 1;
+}
@@ -12,6 +12,18 @@
 #include "mongoose/mongoose.h"
 #include "mongoose/mongoose_glue.h"
 #include "../Games/GameSimulation.h"
+#include "../Games/GameStateSnapshot.h"
+#include "TelemetryRecorder.h"
+#include "SignalHistory.h"
+#include "CanCapture.h"
+#include "CalibrationAssistant.h"
+#include "CanBusController.h"
+#include "BootTimeline.h"
+#include "CanBusLoad.h"
+#include "RuntimeMetrics.h"
+#include "LatencyTracer.h"
+#include "FrameValidator.h"
+#include "InjectionSequencer.h"
 
 #include "../Libs/MCP_CAN/mcp_can.h" // CAN Bus Shield Compatibility Library ( https://github.com/coryjfowler/MCP_CAN_lib )
 
@@ -23,20 +35,44 @@ class WebDashboard {
   WebDashboard &operator=(WebDashboard &&other) = delete;
 
   public:
-    WebDashboard(GameState& game, unsigned long webDashboardUpdateInterval);
+    static const unsigned long longPressDuration = 1000;
+
+    WebDashboard(GameState& game, unsigned long webDashboardUpdateInterval, unsigned long webDashboardStreamInterval);
     void update();
     void getState(struct state *data);
     void setState(struct state *data);
     void steeringWheelAction(struct mg_str params);
     void handleDebug(struct debug &data, MCP_CAN& CAN1, MCP_CAN* CAN2 = nullptr);
+    void handleTimeseries(struct mg_connection *c, struct mg_http_message *hm, SignalHistory& history);
+    void handleCanCapture(struct mg_connection *c, int ev, void *ev_data, CanCapture& capture);
+    void handleTelemetryRecording(struct mg_connection *c, int ev, void *ev_data, TelemetryRecorder& recorder);
+    void handleCalibration(struct mg_connection *c, int ev, void *ev_data, CalibrationAssistant& assistant);
+    void handleStatus(struct mg_connection *c, int ev, void *ev_data, CanBusController **controllers, uint8_t controllerCount, BootTimeline& timeline);
+    void handleBusLoad(struct mg_connection *c, int ev, void *ev_data, const CanBusLoad::Bus *buses, uint8_t busCount);
+    void handleMetrics(struct mg_connection *c, int ev, void *ev_data, RuntimeMetrics& metrics, CanBusController **controllers, uint8_t controllerCount);
+    void handleLatency(struct mg_connection *c, int ev, void *ev_data, LatencyTracer& tracer);
+    void handleValidation(struct mg_connection *c, int ev, void *ev_data, FrameValidator& validator);
+    void handleSequencer(struct mg_connection *c, int ev, void *ev_data, InjectionSequencer& sequencer);
 
   private:
     GameState &gameState;
     unsigned long webDashboardUpdateInterval;
     unsigned long lastWebDashboardUpdateTime = 0;
+    struct state publishedState = {};      // Last state the version was bumped for
 
     unsigned long lastDebugUpdateInterval = 0;
 
+    unsigned long webDashboardStreamInterval;
+    unsigned long lastStreamTime = 0;
+    GameStateSnapshot lastStreamedState;
+    GameStateSnapshot streamState;
+    uint16_t streamChangedFields = 0;
+    uint16_t streamChangedFlags = 0;
+    unsigned long streamClients = 0;
+
+    void updateStream();
+    static size_t printStreamFrame(void *userdata, char *buf, size_t len, bool full);
+
     const char* mapGenericGearToLocalGear(GearState inputGear);
     GearState mapLocalGearToGenericGear(const char *gear);
     const char* mapGenericDriveModeToLocalDriveMode(uint8_t driveMode);
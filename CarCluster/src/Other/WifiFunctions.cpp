@@ -7,19 +7,71 @@
 #include "WifiFunctions.h"
 
 void WifiFunctions::begin(char const *apName, char const *apPassword, int apTimeout) {
-  // Connect to wifi
-  // WiFiManager, Local intialization. Once its business is done, there is no need to keep it around
+  this->apName = apName;
+  this->apPassword = apPassword;
+
   WiFi.mode(WIFI_STA);
-  WiFiManager wm;
+  wm.setConfigPortalBlocking(false);
   wm.setConfigPortalTimeout(apTimeout);
-  bool res = wm.autoConnect(apName, apPassword);
-  if(!res) {
-      Serial.println("Wifi Failed to connect");
+
+  if (wm.getWiFiIsSaved()) {
+    // Connect in the background with the credentials saved by the ESP
+    WiFi.begin();
+    connectStartTime = millis();
+    wifiState = State_Connecting;
   } else {
-      Serial.println("Wifi connected...yeey :)");
+    startConfigPortal();
   }
+}
+
+bool WifiFunctions::update() {
+  switch (wifiState) {
+    case State_Connecting:
+      if (WiFi.status() == WL_CONNECTED) {
+        connected();
+        return true;
+      }
+      if (millis() - connectStartTime >= connectTimeout) {
+        startConfigPortal();
+      }
+      break;
+
+    case State_ConfigPortal:
+      if (wm.process()) {
+        connected();
+        return true;
+      }
+      if (!wm.getConfigPortalActive()) {
+        serialOutput.println("Wifi Failed to connect");
+        wifiState = State_Offline;
+      }
+      break;
+
+    case State_Offline:
+      // Access point might come back, the ESP keeps reconnecting with the saved credentials
+      if (WiFi.status() == WL_CONNECTED) {
+        connected();
+        return true;
+      }
+      break;
+
+    default:
+      break;
+  }
+
+  return false;
+}
+
+void WifiFunctions::startConfigPortal() {
+  serialOutput.println("Wifi starting config portal");
+  wm.startConfigPortal(apName, apPassword);
+  wifiState = State_ConfigPortal;
+}
 
-  Serial.println();
-  Serial.print("IP Address: ");
-  Serial.println(WiFi.localIP());
-}
\ No newline at end of file
+void WifiFunctions::connected() {
+  wifiState = State_Connected;
+  serialOutput.println("Wifi connected...yeey :)");
+  serialOutput.println();
+  serialOutput.print("IP Address: ");
+  serialOutput.println(WiFi.localIP());
+}
@@ -11,9 +11,43 @@
 #include "WiFi.h" // Arduino system library (part of ESP core)
 #include "../Libs/WiFiManager/WiFiManager.h" // For easier wifi management ( https://github.com/tzapu/WiFiManager )
 
+#include "SerialOutput.h"
+
+// Connects to wifi without blocking the rest of the sketch. Saved credentials are tried first, if that does not
+// work (or there are none) the config portal is started. Portal runs in the background until it is used or it
+// times out, after which the sketch continues without wifi.
 class WifiFunctions {
+  WifiFunctions(const WifiFunctions &other) = delete;
+  WifiFunctions(WifiFunctions &&other) = delete;
+  WifiFunctions &operator=(const WifiFunctions &other) = delete;
+  WifiFunctions &operator=(WifiFunctions &&other) = delete;
+
   public:
-    void begin(char const *apName, char const *apPassword, int apTimeout);
+    enum State {
+      State_Connecting = 0,                // Trying saved credentials
+      State_ConfigPortal,
+      State_Connected,
+      State_Offline                        // Portal timed out
+    };
+
+    static const unsigned long connectTimeout = 10000;
+
+    WifiFunctions(): wm(serialOutput) {}  // WiFiManager debug output is muted with the rest (SLCAN)
+    void begin(char const *apName, char const *apPassword, int apTimeout);  // Returns immediately
+    bool update();                         // Call every loop, returns true once when wifi gets connected
+
+    State state() { return wifiState; }
+    bool isConnected() { return wifiState == State_Connected; }
+
+  private:
+    WiFiManager wm;
+    char const *apName = nullptr;
+    char const *apPassword = nullptr;
+    State wifiState = State_Offline;
+    unsigned long connectStartTime = 0;
+
+    void startConfigPortal();
+    void connected();
 };
 
 #endif
\ No newline at end of file
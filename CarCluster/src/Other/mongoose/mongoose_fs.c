@@ -1,4317 +1,4324 @@
 #include "mongoose.h"
 
 static const unsigned char v1[] = {
-  31, 139,   8,   0,   0,   0,   0,   0,   0,   3, 172, 125, // ...........}
- 123, 119, 218, 198, 246, 232, 223, 247, 126,  10, 208, 201, // {w......~...
- 165,  82,  25,  48, 224,  71,  28, 225,   9,  43,  77, 210, // .R.0.G...+M.
-  58, 109, 156, 180, 113, 146, 182, 241, 241, 241,  18,  48, // :m..q......0
- 128,  98,  33,  81,  73, 248,  81, 195, 253, 236, 119,  63, // .b!QI.Q...w?
- 102,  70,  18, 224, 158, 246, 183, 110,  87,  42,  70, 243, // fF.....nW*F.
- 220, 179,  95, 179, 247, 158,  25, 249, 164, 254, 234, 253, // .._.........
- 203, 143, 191, 255, 252, 186,  54, 203, 231, 209, 243, 147, // ......6.....
- 185, 202, 131, 218, 104,  22, 164, 153, 202, 229,  50, 159, // ....h.....2.
- 180, 142, 117,  94,  28, 204, 149, 188,   9, 213, 237,  34, // ..u^......."
-  73, 243, 218,  40, 137, 115,  21, 231, 210, 185,  13, 199, // I..(.s......
- 249,  76, 142, 213,  77,  56,  82,  45, 122,  17, 181,  48, // .L..M8R-z..0
-  14, 243,  48, 136,  90, 217,  40, 136, 148, 236, 182,  59, // ..0.Z.(....;
- 206, 243, 147,  40, 140, 175, 107, 169, 138, 100,   8,  77, // ...(..k..d.M
- 107, 179,  84,  77, 100, 148,  76, 147, 118, 118,  51, 173, // k.TMd.L.vv3.
- 229, 247,  11,  37, 195, 121,  48,  85, 123, 240, 218, 188, // ...%.y0U{...
-  67,  56, 178, 252,  62,  82, 207, 219, 203,  69, 148, 228, // C8..>R...E..
- 130, 127, 106, 223, 154, 132,  63,  84, 147,  36,  85, 246, // ..j...?T.$U.
-  53, 152, 228,  42, 125,  24,  38, 119, 173,  44, 252,  51, // 5..*}.&w.,.3
- 140, 167, 254,  48,  73, 199,  42, 109,  65, 206, 154, 235, // ...0I.*mA...
-  60,  16, 104, 254,  60, 140,  91,  26, 244, 254,   4, 126, // <.h.<.[....~
-  91, 147,  96,  30,  70, 247, 126, 118, 159, 229, 106, 222, // [.`.F.~v..j.
-  90, 134, 162,  21,  44,  22, 145, 106, 113, 134,  56,  87, // Z...,..jq.8W
- 211,  68, 213,  62, 189,  17,  31, 146,  97, 146,  39, 226, // .D.>....a.'.
-  84,  69,  55,  42,  15,  71,  65, 237, 157,  90,  42, 241, // TE7*.GA..Z*.
-  34, 133, 105, 138, 119,  80,  82,  59,  15, 226,  76, 100, // ".i.wPR;..Ld
- 240, 104, 101,  42,  13,  39, 226,   5, 118,  83, 123, 153, // .he*.'..vS{.
-  68,  73,  90, 123,  61,  79, 190, 134, 182, 175, 205, 215, // DIZ{=O......
- 243, 251, 249,  48, 209, 189, 148, 234, 247,   1,  99, 170, // ...0......c.
-  53,  83, 225, 116, 150, 251, 221, 246,  33,  76, 164, 149, // 5S.t....!L..
- 135, 121, 164,  30, 114, 117, 151, 183, 130,  40, 156, 198, // .y..ru...(..
- 254,   8,  38, 162,  82, 158,  10,  76,  93, 249, 221, 227, // ..&.R..L]...
- 197,  29, 191, 222, 114, 203, 167, 157,  14, 182, 188,  77, // ....r......M
- 131, 197, 195,  18,  64,   3, 240,  34,  53, 202, 253,  56, // ....@.."5..8
- 137,  85, 127, 145, 100,  64, 169,  36, 246, 129,  48,  65, // .U..d@.$..0A
-  30, 222,  40, 172, 154, 220, 168,  20,  48, 219,  90, 198, // ..(.....0.Z.
- 128, 194,   7,  91,  37,  24, 102,  73, 180, 204, 169,  10, // ...[%.fI....
-  23,  97, 197,  73, 148, 220, 250, 179, 112,  60,  86, 177, // .a.I....p<V.
- 198, 116, 109,  20, 196,  55,  65, 166,  17, 222, 237, 116, // .tm..7A....t
- 254,  79, 223,  76,   2, 211, 227,  48,  91,  68, 193, 189, // .O.L...0[D..
-  63, 140, 146, 209, 245, 110,   0, 130, 187,  48, 219,  61, // ?....n...0.=
- 110, 164, 166,  42,  30, 239,  64, 192,  60,  72, 167,  33, // n..*..@.<H.!
- 212,  93, 230,  73,  25,  25,   7,  11, 164, 127,  43, 140, // .].I......+.
-  17, 151,  15, 149, 161, 139, 252, 218, 183, 182, 132,  51, // ...........3
-  90, 155,  21, 242, 244, 129,   7, 104, 165,  60, 145,  35, // Z......h.<.#
- 238, 151, 193, 169, 229, 179, 135,  50, 198, 143,  24, 227, // .......2....
- 182, 240, 249, 183,  15, 128,  40, 100, 154,  72,   3,  61, // ......(d.H.=
-   7, 124,  69, 170, 255, 216, 168, 186,  37, 164,  96, 212, // .|E.....%.`.
- 107,  64, 180,  70, 165, 154,  91,  76,  66, 178,   2,  17, // k@.F..[LB...
-  76, 180,  63,  12,  70, 215, 211,  52,   1, 218, 180,  70, // L.?.F..4...F
-  81, 184, 240,  23, 193, 120,  12, 178, 128,  66,  80,  15, // Q....x...BP.
- 231,  40, 181,  65, 156,  23, 179, 194, 129,   0, 225,   0, // .(.A........
- 160,  22,  31,  45,  23, 190, 227,  59, 253, 157,   0,  23, // ...-...;....
- 109, 129, 123, 114,  87, 119, 224,  33, 160,  55,  65, 180, // m.{rWw.!.7A.
-  44,  16, 140, 188, 133, 149,  81,  18,  84,   6, 243, 215, // ,.....Q.T...
- 160, 248, 154,  30, 156, 143, 120,  27,  45, 211,  44,  73, // ......x.-.,I
- 253,  69,  18,  34,  25, 171, 147,  79,  38,  19, 104, 154, // .E."...O&.h.
-  44, 130,  81, 152, 223, 251, 237, 125, 110, 137, 204, 251, // ,.Q....}n...
- 160, 235, 183, 212,  13,   0, 156,  49,  47,  23, 211, 247, // .......1/...
- 255, 213, 161, 255, 186, 189, 254,  78,  46, 226,  65,  91, // .......N..A[
- 119, 162,  72, 223, 239, 236, 242,  54, 140, 162,  22, 232, // w.H....6....
- 194, 120, 170, 252,  60,   5, 217,   6, 165,  51, 223, 238, // .x..<....3..
- 179, 159,  39,  11, 191, 211, 143, 212,  36, 247, 137, 244, // ..'.....$...
- 179,  63, 107,  27, 195, 220, 228, 181, 242,  96,  90,  61, // .?k......`Z=
- 105, 110,  90, 220, 213, 198,  65,  54,  83, 227, 218, 191, // inZ...A6S...
- 142,  58,  79, 199, 199, 195, 178, 192, 108, 245, 119, 191, // .:O.....l.w.
- 213, 223, 221, 131,  85, 119, 121, 158, 204, 119, 117,  88, // ....Uwy..wuX
-   8,  99,   9,   1, 139, 221, 136, 220,  61, 107,  30, 194, // .c......=k..
- 239, 212,  96, 206, 225, 184, 111, 102,  16, 140, 195, 101, // ..`...of...e
- 230,  31, 130,  96, 255,  53,  90, 254,  62, 119, 162, 244, // ...`.5Z.>w..
-  51, 245, 133,  37, 120, 241, 110, 166, 188, 149, 115, 191, // 3..%x.n...s.
- 149, 179, 208, 205, 170, 108, 121, 178, 199,  43, 203, 201, // .....ly..+..
-  48,  25, 223,  63, 255, 223,  39, 217,  40,  13,  23,  57, // 0..?..'.(..9
-  47,  65, 243, 100, 188, 132, 162, 201,  50,  30, 225,  76, // /A.d....2..L
- 106, 202,  85,  34,  23, 145, 136, 189, 135, 247, 195, 175, // j.U"........
-   8, 199,  88,  77, 128, 253, 127,  78, 147,   5,   8, 200, // ..XM...N....
-  61,  21,  63,  76,  85, 238,  71,   2, 150,  75,  63,  22, // =.?LU.G..K?.
-  42,  94, 206,  85,  26,  12,  35, 229, 215,  59,   2,  36, // *^.U..#..;.$
- 106,  18,  78, 151, 230, 125, 237, 173, 111, 130, 180,  70, // j.N..}..o..F
-  61, 202, 105, 148,  12, 131, 232, 227,  44, 204,  68,  34, // =.i.....,.D"
-  31, 214,  34, 197,  71,  40, 227, 246,  34,  72,  71,  42, // ..".G(.."HG*
- 250, 160, 254,  88, 134, 169, 122, 118,  48, 234, 245, 227, // ...X..zv0...
- 101,  20,  73,  25,  54,  26, 174,  27,  74,   3, 156, 171, // e.I.6...J...
- 188, 135, 112, 226,  42,  88, 108, 107, 137, 151, 170, 124, // ..p.*Xlk...|
- 153,  66, 226,  66,  93, 182, 213,  29,  98,  51, 235, 155, // .B.B]...b3..
- 210, 212, 123, 160,  97, 101,  10, 165, 253,  49,  32,  52, // ..{.ae...1 4
-  87,  53,  74,  99, 118,  36,  31, 194, 177, 175, 132, 110, // W5Jcv$.....n
- 229,  63, 172, 215, 253,  82, 111,  50,  18, 121,  27,  20, // .?...Ro2.y..
-  65, 228,  70, 166,  99,   0, 223, 166, 189,  34,  73, 115, // A.F.c...."Is
- 139, 229, 235,  52,  77,  82, 215, 121,  25, 196, 160,  35, // ...4MR.y...#
- 106, 128, 173, 113, 141, 209,  90, 251, 198, 105, 170, 166, // j..q..Z..i..
- 243, 141, 227, 245, 243,  89, 154, 220, 214, 226, 246,  40, // .....Y.....(
-  25,  43, 233, 156, 189, 127, 245, 233, 237, 235, 171, 119, // .+.........w
- 239,  63,  94, 125, 255, 254, 211, 187,  87, 142, 136, 215, // .?^}....W...
-  94,  59,  85, 211,  16, 150, 224, 180,  52,  97, 145, 123, // ^;U.....4a.{
-  15,   8, 183, 204, 215,  98,   7, 158, 100, 232,   9, 183, // .....b..d...
-  35,  66, 219, 212, 115, 157, 167, 159, 126,  10, 126, 112, // #B..s...~.~p
- 132, 237,   3, 112, 239,  61,   0,   2, 106, 177,  72, 250, // ...p.=..j.H.
- 202, 205, 237, 156, 156,  84, 225, 154, 230,   8, 215, 147, // .....T......
- 207, 223, 120, 162,  82,  54,  74,  85, 144, 171, 151, 168, // ..x.R6JU....
-  31, 239, 114, 174, 242, 235,  70,  21,  52, 158, 184, 228, // ..r...F.4...
- 135, 141,  18,  88, 116,  95,  79,  38, 192,  60,  92, 172, // ...Xt_O&.<..
- 146, 237, 242,  15, 106, 162,  11, 211, 237, 194,  51,  53, // ....j.....35
-  79, 116, 105, 184,  93,  90,   1,  74,   5,  27,  21, 134, // Oti.]Z.J....
-  65,  62, 154, 233, 178, 215,  27, 101,  25,  40, 246,  64, // A>.....e.(.@
- 195, 172,  78, 183, 123,  62,  47, 151, 255, 178,  57,  93, // ..N.{>/...9]
- 206,  63, 243, 136, 135,  82,  17, 138,  64, 100,  98,  41, // .?...R..@db)
-  70,  98,  34,  22,  98,  44, 102,  98,  42, 230, 226,   6, // Fb".b,fb*...
- 121, 250,  74,  94,  92, 138, 123, 185, 135, 106, 124, 165, // y.J^..{..j|.
- 238, 220, 129, 159, 173, 166, 171, 120, 181,  88,  61, 241, // .......x.X=.
-  86, 233,  98, 182, 154, 166, 225, 120, 149, 220, 102, 171, // V.b....x..f.
- 121,  60,  90, 197, 249, 237,  10,  36, 236,  98,  52, 187, // y<Z....$.b4.
-  92, 253, 153,  36, 171, 255, 128, 158,  89, 133,  64, 204, // ...$....Y.@.
-  96,  47,  20, 119, 242,  69, 154,   6, 247, 237,  48, 163, // `/.w.E....0.
- 223, 190,  21, 212,  33,  51,   7,  40,  42, 151, 120,  26, // ....!3.(*.x.
- 217,  62, 247, 212,  69,   4, 188,   2,  15, 195, 208, 106, // .>..E......j
- 109,  91, 220, 162, 252, 168,  70,  67,  33,  31, 129, 238, // m[....FC!...
- 123,   7, 172,  88, 125,   3,  54, 154, 131, 133, 243, 114, // {..X}.6....r
-  22,  70,  99, 168,  92,  52,  61,  99, 173, 192,  82,   5, // .Fc..4=c..R.
- 124, 132, 147, 135, 137, 246, 113, 244, 144,  71, 118, 174, // |.....q..Gv.
- 213, 189,   3,  34,  59, 136,  97, 252, 240, 210,   7, 238, // ...";.a.....
- 154, 208, 123, 194, 239,   1,  60,  40, 133,  66,  10, 235, // ..{...<(.B..
-  56,  40,  13,  80, 191, 237,  72, 197,  83, 176,  23, 122, // 8(.P..H.S..z
-  32, 233,  65, 123, 132,   3,   3,  48, 114, 171, 124, 127, //  .A{...0r.|.
- 144, 178,  72, 218,  18, 209, 243, 252, 200,  19, 142, 129, // ..H.........
-  17, 198,  66, 133, 150,  76, 106,  48,  41,  84,  31, 117, // ..B..Lj0)T.u
- 169,  80, 119,   5, 203,  40,  71, 229, 149, 121,  22, 216, // .Pw..(G..y..
- 141, 252, 155,  36,  28, 215,  58,  82,  74,   4,  17, 225, // ...$..:RJ...
-  64,  72, 171, 117,  32, 199,  51,  24, 189,   6,  92,   4, // @H.u .3.....
-   2, 145, 128, 163, 148, 144, 116, 109,  84, 167,  72,  24, // ......tmT.H.
-  81, 160, 223,  16,  36, 208,  52,  11, 236, 196, 207,   5, // Q...$.4.....
- 224,   8, 244,  38,  96,   6, 244, 230, 213, 213, 181, 143, // ...&`.......
-  61,  64, 194, 252,  14, 253,  14,  60, 149, 121,  29, 113, // =@.....<.y.q
-   2,  84, 106, 150, 167, 203,  81,  14,  86,   3, 195,  10, // .Tj...Q.V...
- 101,  55,  62, 171, 200, 100, 208, 108,   6, 126,   2,  57, // e7>..d.l.~.9
- 161, 223, 234, 194, 207,  18, 214,  99,   3, 170, 174,  98, // .......c...b
- 240,  17, 182, 111,  98, 162, 185,  78, 184,  32, 122, 105, // ...ob..N. zi
-   1, 255,  91, 228,  15, 195,  54, 150,  22,  69, 249,  75, // ..[...6..E.K
- 230, 184,  28, 244, 119, 155,  38,  36, 225,  29,  95,  70, // ....w.&$.._F
-  44, 144, 160, 163, 108, 221,  39,  92,  23,  72, 205,  48, // ,...l.'..H.0
- 228, 158, 237, 248, 234, 106,   0, 165, 240,  35, 240,  17, // .....j...#..
-  54, 187,  30,  77, 165, 111,  57, 185, 159, 159,  96, 201, // 6..M.o9...`.
- 181, 166, 125,  63, 111,  54,  61, 221,  81,  93, 186, 145, // ..}?o6=.Q]..
- 164, 194, 139, 252, 210,  51, 243, 138,  32,  67, 153,   1, // .....3.. C..
- 232,  69,  35,  96,  23, 115, 180,  49, 129,  16, 240, 176, // .E#`.s.1....
-   5, 200, 231,  56, 125, 183, 142, 189, 143, 129,  11, 232, // ...8}.......
-  87, 214,  59,  48,  10,  76, 119, 153, 205, 160, 184, 209, // W.;0.Lw.....
- 168, 127, 132, 236, 180, 217,  92, 173, 150, 117,  96, 110, // .........u`n
-  96, 146,  33, 172, 239,  35,  80, 103, 168,  74,  97, 113, // `.!..#Pg.Jaq
- 247, 112, 201,  90, 238,  44,  89, 173,  70, 158, 251, 177, // .p.Z.,Y.F...
- 196,  48,  31,  93, 230,  19, 203,  54,  34,   5, 206,  90, // .0.]...6"..Z
-  18,  38, 178,  54, 172, 231, 185,  59, 241, 250,  74,  66, // .&.6...;..JB
- 122,  22,  78, 114, 215, 235, 123,   6, 186,  92,  26, 209, // z.Nr..{.....
- 128, 117,  85,  51,  69,  42, 221, 132, 240, 227,  65, 165, // .uU3E*....A.
-  27, 124,   0, 163, 162,  38,  90, 226,   3, 241, 242,  51, // .|...&Z....3
-   2,  23, 203, 161,  11,  58,  42, 241, 168, 154,  76, 240, // .....:*...L.
- 217, 236, 138,  45, 230, 136,  61, 241, 202, 165,  86,   4, // ...-..=...V.
-  26, 166,  98, 238, 165, 141, 126, 113,   6,  70, 170, 250, // ..b...~q.F..
- 244, 225, 141, 216, 239,  53, 176, 143, 229, 224,  34, 189, // .....5....".
- 100, 134,  13,   4,  19,  61,   5,  52,  39, 158, 159, 138, // d....=.4'...
- 122, 221,  53, 181,  60,   1, 255, 226,  98, 100,  74,  19, // z.5.<...bdJ.
-  65,  49,   1, 130,  23, 139,  15,  46, 138, 151, 174, 166, // A1..........
- 234,  50, 109,  52,  74, 230,  73, 206,  56,   3, 124, 245, // .2m4J.I.8.|.
-  11, 166,   0, 222, 131, 186, 150,  33, 240, 101, 196, 186, // .......!.e..
-  17, 147, 138,  51, 218, 195,  32,  83, 146,  32, 140,  36, // ...3.. S. .$
-  24, 105,  39, 121, 153, 203, 162,  10, 151, 197, 212, 228, // .i'y........
-  26,  20, 169, 237, 148, 160,   1, 246, 223, 234, 144,  24, // ............
- 110,   8, 235, 229, 245, 218,  48,  57,  64, 185,  94,   3, // n.....09@.^.
-   6,  61,  97,  53,  88, 142, 124, 164, 105, 234, 245, 137, // .=a5X.|.i...
- 141, 100, 167, 224, 133,  63, 221,  42,  23, 232, 149, 133, // .d...?.*....
-  39,  91,  44,  47, 247,  98,  40,  99, 128,   8, 129,  91, // '[,/.b(c...[
- 173, 174, 196,  25,  64, 162,  39, 128, 179,  93,  86,  76, // ....@.'..]VL
- 135, 138,  46,  42, 250,   4, 121, 209, 172, 179, 144,  19, // ...*..y.....
-  49,   6,  84,  96,  83, 146,  42,  94, 108, 128, 104, 192, // 1.T`S.*^l.h.
-  76, 157, 126, 122, 146, 244, 129, 215,  61, 141, 147,   0, // L.~z....=...
- 212, 119, 138, 248, 112, 134,  73,  18, 169,  32, 118, 234, // .w..p.I.. v.
-  70, 170,   2, 200, 180, 178,  86, 228,  14,   0, 160, 180, // F.....V.....
-  57,  22, 208, 148, 133,  54, 189, 148,  14, 232,  50, 144, // 9....6....2.
- 134,  66,  34, 131, 213, 202,   1,  19, 114,   8, 150,  72, // .B".....r..H
-  37, 111,  24, 130, 175, 151,  87, 242, 130, 118,  73,  23, // %o....W..vI.
-  74, 121,  78,  61,  13, 174, 221,  18, 215,  21,  15, 207, // JyN=........
- 191, 115,   3,  15,  74, 223, 138,   7, 163, 204, 252,  96, // .s..J......`
- 189,  85, 171,  80, 255, 229, 222,  27, 141,   0,  32,  30, // .U.P...... .
-  62, 239,  64,   7,   1, 233,  12,  17, 176, 214, 131,  95, // >.@........_
-  80, 227, 240,   4,  53,  62, 160, 167, 230, 122, 146,  58, // P...5>...z.:
-  63,  64, 177, 146, 138,  94, 135,  52, 237,  33,  72,  87, // ?@...^.4.!HW
- 198, 124, 215, 234, 130, 214, 112,  71,  18,  11, 195,  45, // .|....pG...-
-  90,  49, 165, 144, 254,  33,  52, 164,  65,  36, 235,  43, // Z1...!4.A$.+
- 104,  79, 139, 186, 213, 167,  50,  91, 173,  50, 144,  85, // hO....2[.2.U
-  72,  96,  69, 128,  22, 243, 168, 110, 163,   1, 147, 113, // H`E....n...q
- 123, 192, 109,  40, 110,  86,  45,  82, 219, 231,  77, 205, // {.m(nV-R..M.
- 224, 217,  70,  45,  90,  28,  19,  25, 193,  18, 146, 202, // ..F-Z.......
- 168, 217, 237,  39, 207, 101, 103, 181,  74,  79,  44, 123, // ...'.eg.JO,{
- 145,  50, 199,  92,  74, 184,   8,  80, 130, 204,  80, 238, // .2..J..P..P.
- 102,  55,  64, 214,  82, 239,  39, 173, 214,  26,  26,  23, // f7@.R.'.....
- 189,  22, 125, 165, 255, 172, 175,  20,  25, 115, 109, 228, // ..}......sm.
- 173, 213,  93, 131, 206, 136, 128, 189,  23,  30,  42, 224, // ..].......*.
-  69, 171,  37, 160, 215, 232,  98, 132, 189, 186, 212, 225, // E.%...b.....
-  74, 246,  64,  28,  25, 123, 128,  60, 131,  70,  36, 218, // J.@..{.<.F$.
- 192, 109, 117, 165,  28,  53,  26,  99, 104, 183, 139, 143, // .mu..5.ch...
-  53,  94, 221, 128,  59,  58, 240,  60, 127,  84, 151,  75, // 5^..;:.<.T.K
- 200,  25,  73, 185, 108, 117,   7, 208, 208, 199, 100,  19, // ..I.lu....d.
- 146, 205, 166, 239, 142, 158,  47,  41,  15,  94,  68, 209, // ....../).^D.
- 200, 243, 173,  20, 208, 138,   7, 115,  95,  16, 226,  89, // .......s_..Y
- 216,  38, 101,  97,  67, 232, 119, 224, 132, 230, 162,  36, // .&eaC.w....$
- 234,   0, 208,  81,  79, 220,  12, 230,  84,  86, 142,  21, // ...QO...TV..
-  54, 194,   1, 194, 246,  50, 158, 195,  66, 148, 163,  98, // 6....2..B..b
- 215,  73, 208,  78,   2, 136, 157,  35, 239,  98, 159,  73, // .I.N...#.b.I
-  27, 220,  71, 180,   1,  27,  13, 155,   4,  62,  37,  77, // ..G......>%M
- 183,  90, 157, 186, 108, 233, 128, 249, 199, 248, 171,  75, // .Z..l......K
- 106, 140,  42, 150, 153,   2, 228,   6, 188, 217,  24,  90, // j.*........Z
- 253,  10, 126, 244,  39,  30, 196, 203, 211, 251, 135, 221, // ..~.'.......
-  69, 174, 183,  30, 161, 149,  78, 254,  28,  14,   2,   2, // E.....N.....
-   0, 134,  84, 194, 250,  20, 151, 133, 159,   9,  65, 200, // ..T.......A.
-  43,  60, 210, 117,   9,  77, 137, 225,  72, 196,  86,   2, // +<.u.M..H.V.
-  72,   2,  27, 214, 197,  95, 156,  59, 232, 141, 109, 250, // H...._.;..m.
- 229, 204,  58, 125,  40, 189, 229,   5, 193,  19,   4,  63, // ..:}(......?
- 245, 205, 243, 212, 139, 232, 218, 205,   4, 224, 212,  26, // ............
-  80, 107,  23, 156,  65,  49,   4, 206,  58, 243,  64,  93, // Pk..A1..:.@]
- 118, 250, 139, 147, 179, 254, 162,  32, 211, 140, 140, 143, // v...... ....
- 235, 139,   5,  49, 218,  88,  34,  35, 201,  25,  74, 247, // ...1.X"#..J.
- 224, 198,  31,  94,  80, 234, 114, 181, 186,  17, 148, 146, // ...^P.r.....
-  11, 240,  10,  94, 193, 108, 103, 160, 208, 171, 122,  94, // ...^.lg...z^
-  76, 169,  25,  20,  33,  85, 128,  21, 241, 167,  46, 245, // L...!U......
- 155,  59, 230, 223,  83,  78,  48,  61, 102,  64, 122, 182, // .;..SN0=f@z.
-  76, 168,  22,  13,  49,  90, 173, 166,  80,  96,  24, 125, // L...1Z..P`.}
- 110,  22, 175,  41, 244,  49, 151,  83,  79,  28,  52, 102, // n..).1.SO.4f
- 196, 143, 171,  49, 233, 123,   6, 246, 122,  80,  44,  28, // ...1.{..zP,.
-  59, 185, 104, 135,  33, 165, 145, 250, 192, 138, 131, 136, // ;.h.!.......
-  68, 139,   6,  88, 155,  59, 105,  68,  36,  34, 116, 195, // D..X.;iD$"t.
- 234,  91,  16, 172, 192, 117, 180, 206, 121, 189, 143, 160, // .[...u..y...
-  50, 252, 159, 107, 169, 171, 199, 100,  96,   6,  97, 156, // 2..k...d`.a.
- 185,  17,  98,  57,   2, 190, 207, 113, 138, 109, 200,  82, // ..b9...q.m.R
- 105, 254,  29,   5, 198, 153, 176,  34,  98, 209,   6,  39, // i......"b..'
- 157, 233, 234, 245, 199,   9,  56, 252, 208,  95, 212, 142, // ......8.._..
- 193,  72,  61,  15, 135,  17,  44,  26, 253,  91,  88,  17, // .H=...,..[X.
- 148,  86, 134,  80, 120,  44, 129, 144, 104, 246, 124,  44, // .V.Px,..h.|,
-  41, 153, 104, 237, 206, 128,  60,  96,  41, 238, 152, 255, // ).h...<`)...
-  76, 131, 199, 124,   3, 226, 114,  15,  72, 188, 247,  17, // L..|..r.H...
- 209,  75,  57,  45, 143, 229,  17, 101, 150,  13, 217, 122, // .K9-...e...z
-  90,  76, 150, 120, 110,  46, 150, 133,   5, 240,  90, 123, // ZL.xn.....Z{
- 251,  92,   1,  44, 154, 213,  10, 204,  54, 166, 163, 194, // ...,....6...
- 245,  80,  47, 186, 133,  41, 187,  90, 185, 119,  32,  67, // .P/..).Z.w C
-   3,   5, 118, 197,  92, 185, 229,  48,   9, 119, 182, 246, // ..v....0.w..
- 252, 220, 216, 174, 192, 242, 197,  88,  47, 140,  63, 231, // .......X/.?.
- 180, 176, 191, 139, 206,  37, 118, 162, 114,  27, 229, 201, // .....%v.r...
- 245, 192, 209, 192, 113, 192, 205, 242,  21, 216, 219, 178, // ....q.......
- 148, 101,  86, 108,  43,  99, 128, 247, 251, 118, 174,  50, // .eVl+c...v.2
-  84,  46, 131, 200, 143, 154, 206, 226, 206,  41,   6, 252, // T........)..
- 121, 203,  30, 233,  43,  31,  25, 139,  34,  83,   8, 131, // y...+..."S..
- 199, 111,  85, 219,  32,   2, 131, 151, 106, 180,  71,  89, // .oU. ...j.GY
- 246,  17, 125, 140, 168, 175, 162,  76,  61, 236, 170,  28, // ..}....L=...
- 147, 213,  94, 173,  30,  75, 199,   1,  78,  33, 245, 145, // ..^..K..N!..
- 163, 239,  23, 123, 200,  90, 152,   2, 136,  95, 152, 250, // ...{.Z..._..
-   0,  27, 212,  67,  78, 143, 138, 170, 145,   7,  61,  70, // ...CN.....=F
-  56, 113, 208, 183, 240,  83, 173, 143,   5, 222,  26, 129, // 8q...S......
- 169,  33,  48, 137, 198,  35,  24,  66,  68, 162, 139, 238, // .!0..#.BD...
- 165, 151, 202,  92, 219, 166, 169,  90,  68,  96,  46, 187, // .......ZD`..
-  11, 225,  60, 233,  58,  72,  11, 200, 204, 147, 183, 201, // ..<.:H......
- 173,  74,  95, 130, 210, 115,  61, 116,  75, 129, 200,  73, // .J_..s=tK..I
- 252, 125,  50,  90, 102, 239, 151, 100, 248,  20,  25, 111, // .}2Zf..d...o
- 168, 211, 193,  70, 163, 118,  22, 133, 208, 107,  15, 201, // ...F.v...k..
- 108, 146, 224,  85, 193, 204,   0, 208,   8,  28, 116, 122, // l..U......tz
- 187, 200, 155,  41,   6, 181, 162,  65,  60, 136, 218,  75, // ...)...A<..K
-  48,  88, 151, 190, 139, 137,  49, 148,   6, 227, 241, 107, // 0X....1....k
-  12, 132, 190, 197, 240,  81, 172,  96, 234,  34,  29,  76, // .....Q.`.".L
- 253, 153,  72, 105, 185, 226, 128, 192,  99,  53,  10,  90, // ..Hi....c5.Z
- 204, 242, 124, 225, 239, 237, 221, 222, 222, 182, 111, 247, // ..|.......o.
- 219,  73,  58, 221, 235, 117,  58,  29, 220, 218,   2, 184, // .I:..u:.....
-  19, 175, 140, 131, 189,  59, 220,  23, 115,  79,  87, 254, // .....;..sOW.
- 204, 219, 195, 176, 138,  87,  20, 101, 239, 192, 179, 120, // .....W.e...x
-   2, 185, 153, 195, 157,  19, 110,  41, 146, 139, 172,   6, // ......n)....
- 200, 229,  48, 177, 121, 193,  24,   3,  39,  35, 128,  78, // ..0.y...'#.N
-  39,  49, 118, 171, 147, 121,  48, 124,   3, 238, 215, 157, // '1v..y0|....
- 126,  29,  39, 183, 113, 148,   4,  99, 253, 154,  38, 183, // ~.'.q..c..&.
- 231,  11,  54,  99, 225, 109, 148,  68, 165, 183,  20, 132, // ..6c.m.D....
-  77,  39,  23, 201,   2, 183, 125, 248, 141,  56,  67, 209, // M'....}..8C.
- 226, 182,  41,  19,  17,  59,   1,  53,  85, 172, 110, 235, // ..)..;.5U.n.
-  29, 138,   3, 169, 163,  91, 173,  86, 117,  92,  47, 128, // .....[.Vu./.
-  35,  65,  14, 161, 251, 139,   3, 148,  67, 198, 249, 139, // #A......C...
-  28, 216, 123, 184, 204, 209, 151, 240,  73,  56,  75,  57, // ..{.....I8K9
- 194,   2,  37,  17, 168, 174,  21,  84, 112,  59, 172, 204, // ..%....Tp;..
- 125,  87, 242, 231, 139, 104,  32,  45, 217, 228, 182, 235, // }W...h -....
- 112,  14,  40,  74, 122, 187,  96, 133, 219,  84,  37,  51, // p.(Jz.`..T%3
-  19, 178,  60, 248,  95, 130,  29,  99, 201,   1, 239,  39, // ..<._..c...'
- 192,  61,  90,  73,  90, 133,   6, 150,   6,  69, 212,   7, // .=ZIZ....E..
- 250,  23, 193,  70,  47, 168, 128, 231,  85, 201, 197, 121, // ...F/...U..y
- 212, 193, 185,   2,  23, 231,  76,  92, 139, 115, 241,  81, // ......L..s.Q
- 188,  22,  47, 196, 119, 226, 149, 248,  32,  78, 197,  27, // ../.w... N..
- 201, 224,  33, 108,  86, 229, 230, 101, 139, 221,  43,   5, // ..!lV..e..+.
-  61, 250, 221, 222, 113,  35,  34, 173, 139,  54,  26, 251, // =...q#"..6..
- 159,  17, 251, 159, 224,  18,  47, 245, 154,  79,  90, 248, // ....../..OZ.
-  18, 140, 161, 133,  68,  59, 100,   8, 171, 203,   2, 224, // ....D;d.....
- 214, 170, 105, 155, 116, 111, 136, 238,  80, 134, 110,  23, // ..i.to..P.n.
-  59,   3, 215, 210, 129,  68, 158,  96,  13,   7,  88, 227, // ;....D.`..X.
-  77, 163, 241, 166, 109, 115, 218,  28,  98,  21, 231,  18, // M...ms..b...
- 134, 120,  99,   2,  37, 180, 198, 192, 202, 124, 177, 192, // .xc.%....|..
-  21, 251,  82, 124, 148, 139, 193, 249, 224, 156, 123, 108, // ..R|......{l
- 211, 190, 146, 143,  69,  62, 251, 219, 163, 193, 189,   4, // ....E>......
- 211, 130,  45,  22, 202,  32,  23,   3,  23, 240, 215, 190, // ..-.. ......
- 123,  61, 224, 130, 177, 140, 213, 109, 237, 141, 123,  38, // {=.....m..{&
-  62, 122, 190,  91, 206, 123,  73, 121,  98,  92, 113, 158, // >z.[.{Iyb.q.
- 222, 136, 177,   6,  78, 126, 241, 196, 121, 163, 113, 222, // ....N~..y.q.
- 206, 150,  67, 119, 140, 245,  56, 184, 115,   6, 169,  44, // ..Cw..8.s..,
-  15, 114,  92, 102, 116, 138,  52, 202, 216, 198, 123,  62, // .r.ft.4...{>
-  10, 132,  33,   6, 151, 125,  70, 208,  96, 184, 132, 178, // ..!..}F.`...
- 102,  24, 112, 128,  68,  54, 132, 132,  39, 174, 217,  10, // f.p.D6..'...
- 145,  84,  41,  35, 107,   6, 126, 165, 238, 212, 150, 215, // .T)#k.~.....
-   1,  67,  83, 149, 191,  82, 105, 120, 163, 198, 231,  88, // .CS..Rix...X
- 246, 125, 154, 204,  41,   0, 103,  27, 153,  86,  54, 131, // .}..).g..V6.
- 130,  25, 148,   4, 181,  58, 228,  76, 241, 120,  71, 238, // .....:.L.xG.
- 153, 169, 140,  38, 151, 158, 171, 152, 155, 110, 169, 240, // ...&.....n..
-   6, 108, 148, 153, 103, 161, 254,  43, 168,  24, 238, 113, // .l..g..+...q
- 213, 204,  61,  99, 123, 123,  87, 174,  91, 154, 109, 169, // ..=c{{W.[.m.
- 252,  85,  56, 182, 141,   0, 125, 188, 102, 239,  40,  47, // .U8...}.f.(/
-  52, 238, 223, 130, 238,  12, 100, 100, 250,   8, 144,  31, // 4.....dd....
- 212,  72,  65,  27,  93, 243,  47,  10, 153, 123, 234,   8, // .HA.]./..{..
-  24,  98, 221, 116, 150, 205, 146, 101,  52, 126, 105,  90, // .b.t...e4~iZ
- 125,  90, 140, 137,  42, 164, 208,  30,  41,  53, 184, 135, // }Z..*...)5..
- 254,  86, 171, 156,  16,  77, 252, 124, 227,  21, 177, 154, // .V...M.|....
-  27,  14, 231, 221,  16, 125,  55,  24, 145, 249,  71, 104, // .....}7...Gh
-  86, 235, 178,  17, 175, 165, 152, 210, 215, 108, 141, 115, // V........l.s
- 122, 219,  40,  82,  58, 172,  39, 209,  50,  18, 175, 193, // z.(R:.'.2...
-  88, 125, 125,  66,  92, 106, 172, 213, 215,  96, 173,  86, // X}}B.j...`.V
-   8,   0, 101,  23, 175,  47, 193, 134, 212, 188, 204, 220, // ..e../......
- 173, 171, 219, 192, 224, 216, 179, 154, 127,  39, 170,  13, // .........'..
- 110, 118, 102, 151, 144, 242,  24, 107,  20, 237,  45, 104, // nvf....k..-h
- 118,  90, 222, 195, 174, 186,  46, 169,  82, 152,  37, 186, // vZ......R.%.
-  80,  85, 129,  45, 112, 138, 110,  22,  51, 188,   2, 108, // PU.-p.n.3..l
- 138,  23, 164,   3,  83, 241, 157, 236, 136, 107,  38, 200, // ....S....k&.
- 110, 188, 139,  23, 141, 198,  11, 244,  33,  23, 210, 232, // n.......!...
-  16,  67,  43,  81, 136, 145,  30, 211,  19, 175,   0, 207, // .C+Q........
- 175, 170, 120, 126, 181,  11, 207, 175,  74, 120, 102, 187, // ..x~....Jxf.
-  10,  44, 247, 255, 225, 152,  21, 192, 181, 173,  63, 230, // .,........?.
- 208, 105, 179, 249, 221,  73, 239, 208, 171,  78, 205,  96, // .i...I...N.`
-  29,  68, 137,  54,  63, 244,  22,  19,  57, 217,  67, 151, // .D.6?...9.C.
-  84,  76, 140, 189, 110, 148, 187, 168,  69, 128, 104, 245, // TL..n...E.h.
-  89,  65,  56, 168, 114,  30,   7,  11,  16,   0, 237, 152, // YA8.r.......
-  24, 234, 185,  87, 143, 151,  34, 189, 160, 171, 165, 196, // ...W..".....
-  48, 224, 157, 251,  65, 114, 111,  11,  88, 143, 104, 213, // 0...Aro.X.h.
-   3, 153, 122, 107,   4, 126, 129,  49, 145, 193,  66, 175, // ..zk.~.1..B.
-  22,  54, 178, 181, 240,   6,  31, 252, 139,  15, 151,  59, // .6.........;
- 150,  88,   0, 156,  60, 235, 220,  10,  10,  58,  35, 221, // .X..<....:#.
- 163, 238,  99, 236,  44, 238, 181, 122, 125,  77, 248, 145, // ..c.,..z}M..
- 188, 209,  81, 248, 236,  19,  22,  85, 142, 105, 141, 216, // ..Q....U.i..
- 227, 170, 203,   0,  77, 120, 213, 206, 103,  42,  46, 228, // ....Mx..g*..
- 121, 185, 146, 163,  65, 247, 168, 227, 195, 138, 220,  95, // y...A......_
- 146, 163, 181, 180, 142,  86, 163, 177, 172,  56, 101, 222, // .....V...8e.
-  82,  86,  51, 130, 139,   0, 156,  60,  48, 224, 222,  79, // RV3....<0..O
- 220, 165, 199, 214, 150, 150, 250,  37, 243,   8, 142, 115, // .......%...s
-  42,   3, 195,  89, 167, 173,  86, 223, 187, 117, 131, 139, // *..Y..V..u..
- 211,  75, 109,  64,  62, 162,  35, 250,  38, 240, 128, 110, // .Km@>.#.&..n
-  16, 119, 197, 232,  13, 208, 243,  44,  84, 211, 192, 221, // .w.....,T...
-  84,  44, 186,  51, 207,  55,  86, 196, 118, 200, 213, 224, // T,.3.7V.v...
- 158, 141, 155, 242, 246,  32, 152,  55, 208, 156, 249, 118, // ..... .7...v
- 104, 141, 136, 179, 146, 113, 227, 176, 205, 124,  54,  72, // h....q...|6H
- 228,  95,  89, 213, 190,  51,  15, 192,  40, 126, 180,  98, // ._Y..3..(~.b
- 247, 217, 179, 227, 189,  51, 168,  66, 143, 179, 183, 142, // .....3.B....
- 159, 192,  58, 254,  88, 213, 103, 123, 119, 180, 155, 107, // ..:.X.g{w..k
-   2,  60,   1,  19, 112, 130, 177, 225,  19, 139, 220,   9, // .<..p.......
- 135, 200, 221, 169,  12,  46,  38,  20,   8,  46,  91, 165, // ......&...[.
- 104, 253,  76,  37, 216,  90, 103, 192,  60, 103, 131, 105, // h.L%.Zg.<g.i
-  59,  74,  70,  65, 132,   6,  61,   0, 233, 239,  75, 116, // ;JFA..=...Kt
- 138, 141, 131,  13, 186,  88,  78,   5, 246, 194, 145,  48, // .....XN....0
- 142, 158, 175, 173, 221, 169,  74,  91,  71, 103, 198, 176, // ......J[Gg..
-  27, 131,  35, 132,  91, 127, 109, 222, 155,  70, 255,  14, // ..#.[.m..F..
-  55,  45, 221,  33, 238, 145, 108,  20, 190, 142,  20, 190, // 7-.!..l.....
- 189,  59, 119,  19,  48,  39, 135, 237,  16, 214, 184,  33, // .;w.0'.....!
-   8,  24, 128, 134, 132, 159,  99,  52,  12, 126, 192, 146, // ......c4.~..
-  14,  80, 236, 112,  49,   9, 108, 204,  73, 199,   6, 207, // .P.p1.l.I...
- 188, 123, 120,  14,  87, 171,  37, 238, 146, 130, 152,   6, // .{x.W.%.....
- 252, 234, 234, 151,  97, 177,  26,   7, 200,  54, 122, 135, // ....a....6z.
-  82, 111, 157,  33, 104, 153,  87, 144,  27, 131,  64, 245, // Ro.!h.W...@.
- 165, 209,  19,   1, 185, 153, 247, 184,  89, 204,  72,   6, // ........Y.H.
-  79, 204,  32,  50,  43, 227, 251, 254,   2, 208,  93,  46, // O. 2+.....].
-  68, 204, 211,   6, 204,  37,  32, 148, 108,  69,  10, 223, // D....% .lE..
-  79, 208,  47, 185,  71, 242,  76, 229,  61, 212,  17, 142, // O./.G.L.=...
- 209,  12, 192,  35, 147, 146,  51,  53, 198,  67,  46, 105, // ...#..35.C.i
- 178, 204, 162, 251, 115, 149, 191, 137, 193, 163,  59, 253, // ....s.....;.
-   8, 252, 129, 181, 198, 114, 106,  43, 214, 185, 203,  33, // .....rj+...!
- 199, 248,  28,  26,   9,  43, 161,  27, 197,  59, 163, 159, // .....+...;..
-  41,  11, 235, 128, 159,  58, 154, 169, 209, 181,  26,  87, // )....:.....W
- 107, 188, 212, 153, 212,  15,  42, 231,  48,   6, 112,  49, // k.....*.0.p1
-  22, 160,  67,  88,  83, 145, 120, 107,  11, 254, 208, 155, // ..CXS.xk....
- 202, 225,  22, 236, 131, 153, 156, 250, 127,   5, 246,  96, // ...........`
- 129,  21,  44, 128, 131,  57, 190, 150, 224,  25,  92,  65, // ..,..9.....A
- 198, 114, 231,  14, 197, 116, 181,  66, 100,   1,  93,  33, // .r...t.Bd.]!
- 197, 112,  77,   5, 161,  47, 241,  56,  60, 139, 145,  50, // .pM../.8<..2
- 140,  40, 163, 162,   4,   9, 145, 108, 196,  98, 114, 181, // .(.....l.br.
-  42, 101,  42,  80,  83,  26,  36, 143,  56, 196, 190,  74, // *e*PS.$.8..J
-  83, 203, 211, 234, 231, 226, 210, 226, 152, 247,  25, 139, // S...........
- 170,  24, 171, 224,  21,  96, 230,  13, 102, 254, 197, 204, // .....`..f...
- 104, 115, 244, 105, 193, 241, 141, 249,  72,  14,  73, 253, // hs.i....H.I.
-  95,  11, 178, 207,  58,  40,  24,   4,  23, 157,  75, 159, // _...:(....K.
- 148,  87, 163, 241, 196, 141,  68, 199,  35, 197,  36, 202, // .W....D.#.$.
- 108,  56,  41, 244, 231, 196, 232,  79, 224, 178,  62, 204, // l8)....O..>.
-  29, 202,  52, 102,   5, 250,  57, 211,  84, 101,  25,  14, // ..4f..9.Te..
- 111,  22, 163, 249,  14, 127,  85,  55,  40, 237, 172, 204, // o.....U7(...
-  87, 171,  57,  34,   9, 122, 133,  25,  23,  29, 213, 229, // W.9".z......
-  25, 148,  96,  76, 207,  73,  22, 154,  50, 103,  92,  23, // ..`L.I..2g..
- 137, 224,  25, 154, 204,  13,  77,  64,  88,  44, 101, 133, // ......M@X,e.
- 117,   3, 175,  26, 141, 171, 186, 233, 158,  91,  92, 153, // u........[..
-  22, 158, 221, 147,  91, 187, 122,  17,  40, 233, 104,  92, // ....[.z.(.h.
-  29, 181,   7,  75,  62, 224,  56, 156,  76, 212,  88, 187, // ...K>.8.L.X.
- 129,   2, 157,  72,  90, 195,   6,  60, 148,  95, 138, 214, // ...HZ..<._..
- 125,  48,  17,  52, 179, 109,  29, 131,  24, 199,  39, 102, // }0.4.m....'f
- 107, 173,  31, 131, 236, 158, 186, 209,  69, 124,  41, 162, // k.......E|).
- 139, 102, 211, 254, 120, 180, 240, 140,  88, 255, 140,  64, // .f..x...X..@
- 255,  40, 140, 209,  84,  77,  85, 220, 100, 199, 248,   2, // .(..TMU.d...
- 173,  47,  51,  98,  27, 242, 168, 118, 196, 249,  20, 235, // ./3b...v....
-  28,  52, 104, 183,  99, 234, 180, 142, 129,  11,  94, 218, // .4h.c.....^.
- 114,  62,  53,  96, 107,  71, 118, 215,  14, 185,  62, 229, // r>5`kGv...>.
-  33, 119, 238, 158,   3,  54, 250,  49, 234,  67,  72, 128, // !w...6.1.CH.
-  51,  19,  27,  70, 200, 137, 235,  33,  83,  98, 192,  66, // 3..F...!Sb.B
- 175, 168, 202, 236,  38, 200, 124, 103, 196, 191, 128, 235, // ....&.|g....
- 139, 129, 203, 132,  63, 245, 185,   2, 227, 175, 114, 125, // ....?.....r}
-  91, 253, 205, 230, 121,  20,  32, 102,  63, 151, 118,  21, // [...y. f?.v.
- 160,  29, 114, 187,  36, 152, 132,  94,  20,  60, 129,  32, // ..r.$..^.<. 
-  48,   5,  40,  76,  42,  18, 220, 240, 221,  21, 170, 241, // 0.(L*.......
-   6,  56,  59, 159, 162, 199, 180, 227, 202, 113, 110, 218, // .8;......qn.
-  85, 207, 240, 241,  10,  41,  40, 221,  58,  70,  10, 161, // U....)(.:F..
- 212,  35,   9,  63, 115, 223, 178, 122, 187, 192, 224,  66, // .#.?s..z...B
- 130, 154, 255,   6, 136,  81, 217,  53, 167,  22, 131, 139, // .....Q.5....
- 232, 210,  79, 120, 140, 188,  61,   9, 211, 140, 205,  75, // ..Ox..=....K
- 115, 216,  37,  47,  47,  37, 102, 111, 157,  91,  70, 208, // s.%//%fo.[F.
-  14, 119,  74,  84, 165,  33,  48,  54, 172,  57, 184, 129, // .wJT.!06.9..
- 174,  32,  81, 224, 235,  87, 142,  45, 235, 195, 111, 120, // . Q..W.-..ox
- 178,  36, 151,  14, 252, 188, 116, 154, 243, 102,  19,  79, // .$....t..f.O
- 160,  40,   1,  54, 109, 134,  39, 249, 252, 141, 211, 103, // .(.6m.'....g
- 155,   7,  66, 144, 217,   4, 120, 134,  55, 225, 184,  82, // ..B...x.7..R
- 185, 216, 151,  47, 211, 112, 195,  98,   6,  46, 137,  40, // .../.p.b...(
-  40,   1,  74,  92,   0, 210,  31, 214,  30,  70, 209, 176, // (.J......F..
- 170, 216,  85,  95, 150,  28,  29, 187,  39,  99,  78, 157, // ..U_....'cN.
- 108, 239,  44, 149, 171,  71, 188, 158, 115, 229, 157, 254, // l.,..G..s...
- 104, 229,  96,  97, 113, 172, 133,  87,  85,  84,  40, 156, // h.`aq..WUT(.
-  66, 226, 131, 148, 191,  14,  70, 179,  13, 217,  35, 207, // B.....F...#.
- 169,  35, 240, 228,   8,   8, 153,  30, 105,  57, 172, 244, // .#......i9..
-  27,  97, 136,  21,  18, 125,  62, 144, 168, 118, 194, 221, // .a...}>..v..
- 223, 157,  93, 153,  14, 130, 193,  39,  25,  93, 220, 191, // ..]....'.]..
-  66,  51, 149, 237,  13, 148, 112,  81,  58, 176, 179,  46, // B3....pQ:...
-  54,  25,  12, 153, 208, 136, 143, 218, 134, 194, 229,  56, // 6..........8
- 148, 140, 214, 169, 188, 226, 232, 177,   8, 145,  55, 148, // ..........7.
- 191, 105, 208,  22,  74, 142, 246, 166, 251, 124, 218, 162, // .i..J....|..
-  79, 182, 160, 217,   9,   4,  39,   8, 217, 209,   4, 200, // O.....'.....
- 220,  84,  38, 149, 224, 156,  49, 124, 210,  93, 225,  10, // .T&...1|.]..
-  58,  64,  73,  27, 145,  96,  80,  82, 174, 251, 120,  61, // :@I..`PR..x=
- 218, 203,   8, 105, 155, 112, 108, 214, 177, 164, 226,   3, // ...i.pl.....
- 191,  68,  85, 195, 251, 154, 155, 185,  48, 165, 120, 181, // .DU.....0.x.
- 194,  48, 150, 237,  33, 180, 251, 211, 228, 240,  36,  90, // .0..!.....$Z
-  83, 229, 104, 163, 230, 107,  62, 183, 169, 214, 107,  16, // S.h..k>...k.
- 250, 142, 120,  89,  10, 237,  25,  80,  55,  78, 107, 242, // ..xY...P7Nk.
-  17, 166,  72, 123, 112, 196,  18,  20, 244,  50,  41,  12, // ..H{p....2).
-  91,  18, 159,  96, 219, 129, 201, 245,  77, 130, 227,  89, // [..`....M..Y
-  69, 141, 199,  78, 184, 185,  10,  20,  45, 213,  69, 195, // E..N....-.E.
- 194, 242,  46, 160,   6,  10, 135, 176, 208,  43, 131,  27, // .........+..
- 101, 199, 198, 160,  74, 110, 222, 192,  27,  39, 111,  15, // e...Jn...'o.
- 212, 223,  57, 197, 131,  65, 105,  87, 230,   7,  52,  31, // ..9..AiW..4.
- 169, 199,   4,  69, 119, 198,  73,  18, 130,  98, 152, 153, // ...Ew.I..b..
- 217, 114, 122, 164,  99,  29, 118, 124, 203,  26, 116, 180, // .rz.c.v|..t.
-  75, 241,   2, 223, 206, 195,  76,  13, 244, 111, 169,  49, // K.....L..o.1
- 122, 151, 237,  33, 248, 132, 174,  41,   3,  75,  34, 137, // z..!...).K".
- 110,  20, 248, 226,  62, 144, 228,  99,  56,  87, 201,  50, // n...>..c8W.2
-   7,  67, 225,  17,  53,   6, 144,  99, 168, 183, 149, 155, // .C..5..c....
- 212,  90, 232, 195,  56,  98,  33, 247, 220, 159, 249, 116, // .Z..8b!....t
- 248, 203,  96,   1, 245, 149, 247, 100, 165,  83,  79, 246, // ..`....d.SO.
-  66,  60,  42,  35, 102, 242,  59,  23, 189, 133,  41, 254, // B<*#f.;...).
- 130,  49,  53, 135, 101,  31,  73, 254,  73, 124,  21, 223, // .15.e.I.I|..
- 139, 119, 226, 253,  99, 167,  58, 250, 184,  59, 164, 207, // .w..c.:..;..
- 218, 240, 225, 192, 110, 191, 116, 188,   2,  55,  74, 169, // ....n.t..7J.
-  98, 136, 135,  33, 154, 205,  75, 193, 199, 109, 192, 255, // b..!..K..m..
- 132, 118,  43,  25,  14, 186, 126,  15,  55, 157, 168, 240, // .v+...~.7...
- 210, 243, 115,  48,  39, 210, 203,  62, 248,  85, 120, 230, // ..s0'..>.Ux.
-  18, 251,  14, 252,   3, 253, 210, 189, 148, 250, 240, 118, // ...........v
- 144, 225, 153,  87,  23, 179, 144, 237, 193, 219, 241,  15, // ...W........
- 169,  18, 101,  73, 147,  15,  74, 152, 186, 195,  78, 142, // ..eI..J...N.
- 108,  39,  38, 179,  41, 131, 166, 227, 248, 208,  40,  65, // l'&.).....(A
-  87, 100, 177, 136, 238,  97, 133, 121,  79, 231,  32,  97, // Wd...a.yO. a
- 145, 115,  28, 226, 180,  75, 218, 146,  37, 210, 131, 161, // .s...K..%...
- 134, 118, 231, 128,  65, 239, 249,  48, 135, 180, 213, 131, // .v..A..0....
- 217,  11, 156, 146,   4, 171, 204, 215,  53,   3, 107, 159, // ........5.k.
- 129,  90, 255, 157,  86, 134, 179,  96,  33, 126, 144, 238, // .Z..V..`!~..
- 230, 194, 146, 203, 223,  81,  37,  48,  71, 217,  37,   6, // .....Q%0G.%.
- 214, 147, 220, 182, 250,  29, 101, 210, 229, 181,   4, 128, // ......e.....
- 129, 146, 247, 250, 141,  90,  42, 180, 204, 115, 170,   3, // .....Z*..s..
- 164, 169, 240, 180,  33,  10, 159,  83, 239, 130,  65,   0, // ....!..S..A.
- 147,  74, 241,  17,  74, 152,   3, 208, 162,  92,  27,  67, // .J..J......C
- 156, 180, 217,  72,  30, 117,  82, 108,  95, 253, 231, 223, // ...H.uRl_...
- 217, 183, 255, 142, 225, 177,  50, 137,  39, 123,  83, 220, // ......2.'{S.
-  89, 244, 188,  65, 200,  19,   6,  65,   1, 171,  20, 221, // Y..A...A....
-  97, 211,  69, 226,  13,  92,  93, 184,  79, 133,   0,  65, // a.E...].O..A
- 207, 243, 123,  92, 195, 105, 183, 219,  32,  23, 120, 136, // ..{..i.. .x.
-  83, 153,  62,  14, 160,  90, 199, 214, 128, 146, 186,  45, // S.>..Z.....-
-  58,  20,  29,   1, 194,   8,  35, 196, 207, 229,  33,  30, // :.....#...!.
- 247,   3, 243, 163,  14, 178, 137,  84, 143,  61, 114, 127, // .......T.=r.
- 169,  98,  12,  21,  19, 212,  29, 177,  60,  34, 157,  81, // .b......<".Q
-  20,  64, 231, 166, 192,  35,  76, 172,  65,  82,  59, 253, // .@...#L.AR;.
-  12, 124,  84, 205, 172,  25,  50,  43, 198, 228,  53,  38, // .|T...2+..5&
-   2, 176,   4,   3,  60, 139,  98, 185, 123,   9,  13, 150, // ....<.b.{...
-  39, 234,  34, 187,  52, 109, 150, 208,   6, 150,  63, 200, // '.".4m....?.
- 185,  88,  94,  10, 106,  56, 112,  78, 112, 106, 249, 192, // .X^.j8pNpj..
- 197,  14,   0, 211, 225,  37, 140, 186, 239, 249,  73,  83, // .....%....IS
- 230, 196, 204,  80, 165, 213, 210, 211, 119, 158, 235, 202, // ...P....w...
- 134,  64,  80,  79, 230, 205,   4,  29, 156, 116,   0, 198, // .@PO.....t..
- 159,  76,   7,  72,  50, 110, 253, 141, 243, 141, 228,  29, // .L.H2n......
- 212, 111, 184,  89,  10, 153, 182,  11,  28,  15, 186,   1, // .o.Y........
-  44, 161, 239,  33, 109, 199, 135,  34, 146, 137, 238, 220, // ,..!m.."....
- 217, 163, 108, 140,   1, 158,  28,  66,  63, 212, 150, 225, // ..l....B?...
- 111, 118,  47,  61, 238, 196, 208,  49, 148,  33, 192, 129, // ov/=...1.!..
- 157, 134, 194, 188,  48,  62, 123, 128, 205,  24,  11, 128, // ....0>{.....
-  98,  78, 205, 209,  64, 253,  47, 147, 248, 119, 108,  83, // bN..@./..wlS
- 105,   5, 184,  30, 163, 193,  14, 225, 212,  45,  38,   0, // i........-&.
- 208,   3, 161,   7,  49, 226,  67,  24,  92, 243,  62,  63, // ....1.C...>?
-  16, 195, 158, 146, 190,   0, 177,  52,  71,  16, 187, 131, // .......4G...
- 220,  71, 145,  92, 123, 172,  65, 207,  60, 241,  25, 100, // .G..{.A.<..d
- 242,  39,  84, 195,  63,   2, 224, 127, 200,  31,  81,  33, // .'T.?.....Q!
- 138, 223, 232,  55,  21, 191, 192,  47, 123,  68,  66,  41, // ...7.../{DB)
- 202,  27,   9, 149,  67,  66, 159,  35,  18,  42, 162, 220, // ....CB.#.*..
- 226,  80, 186, 210, 218,  22, 115,  97,   5, 166,  31, 247, // .P....sa....
-  43, 112, 212, 103,  52, 142, 113,  52, 125,   1, 227,  43, // +p.g4.q4}..+
- 148, 156, 130, 248, 208,  47,  90,  29,  62, 192,   0, 149, // ...../Z.>...
- 225, 103, 109, 165,  91,  61, 167,  80, 155, 141,  79, 210, // .gm.[=.P..O.
-  11,  33,  21,  23, 112, 124,   3,   3, 187,  48, 114,  85, // .!..p|...0rU
-  82, 182, 114,   1, 148,  79,  96, 218, 238, 123, 253, 250, // R.r..O`..{..
- 143, 188,   2, 171,   5, 121, 128, 167,  80,   7,  79, 145, // .....y..P.O.
- 180, 233, 152,  94, 212,   6, 133,  43,   8, 140,  98, 233, // ...^...+..b.
- 194, 125, 212, 162, 219, 180, 180, 143, 250,  25,  88,  68, // .}........XD
- 133, 238, 150,  85, 250, 160,  29,  29,  31,  45,   5, 192, // ...U.....-..
- 121, 169, 121, 184,   3, 170, 226,  32, 200,  46, 160,  92, // y.y.... ....
- 158, 220,  41,  30, 149,  33, 223,  79, 113,  70, 169, 211, // ..)..!.OqF..
- 160,  80, 139,  95, 141,  57, 119, 129, 139, 219, 232,  82, // .P._.9w....R
- 216,  81, 158, 149, 142, 155, 140, 240, 176, 246, 192, 108, // .Q.........l
-  60, 147, 255, 195, 163, 129, 182, 200, 105, 235, 239,  43, // <.......i..+
- 178,  78, 217,   2, 230, 227, 106, 165,  65,  51, 183, 208, // .N....j.A3..
- 148, 170, 175, 228,  79, 197, 185, 100, 138, 252, 210,   1, // ....O..d....
-  99, 252,  57, 229, 253, 113, 139,  84,  99,  61, 171, 145, // c.9..q.Tc=..
-  39, 118, 228,  78,  74, 185,  24, 252,  47,  12, 176,  82, // 'v.NJ.../..R
- 174, 248, 145, 252, 198, 156, 170, 162,  87,  75, 188,  90, // ........WK.Z
- 209, 203,  95,  57,  62, 252,  71, 163, 241,   7,  90, 197, // .._9>.G...Z.
- 212,  98, 195,  12,  80,  28, 221, 189, 214,  63,  28,  10, // .b..P....?..
-  36, 208, 231, 210, 230,   0,  56,  96, 109, 171, 136, 207, // $.....8`m...
- 208,  80,  55, 105, 101, 160, 223,  26, 141, 223, 208, 190, // .P7ie.......
- 249, 164, 249,  57, 151, 238,  87,  58, 234,  73,  59, 179, // ...9..W:.I;.
- 167, 125,  84,  26, 223, 131, 172, 126, 229, 232,  49, 129, // .}T....~..1.
- 255, 213,  36,  48, 231,  81, 127, 226, 157, 217, 162, 162, // ..$0.Q......
-  23, 196,  75, 200,  73, 115,  62, 205, 211, 155, 187,  85, // ..K.Is>....U
- 164, 230,  91,   8, 181, 227,   2, 140,  64, 216, 239, 229, // ..[.....@...
-  87, 156,   8,  75, 115, 101,  46, 191,  52,  26, 191, 148, // W..Kse..4...
- 221,  19, 152,  68,  63, 103, 244, 156, 162, 137, 103, 201, // ...D?g....g.
- 101, 164, 208, 197,  51, 172,  63,  25, 227, 177, 209, 120, // e...3.?....x
-   7,  19, 253,  17, 214, 192,  63, 150,  42, 203,  95, 196, // ......?.*._.
- 225,  60, 192, 174, 191,  79, 193, 219,   5,   1, 119, 223, // .<...O....w.
-  61,  86,   8, 171, 241, 214,  26,  15, 188,  91,  18, 173, // =V.......[..
-  81, 164, 130,  84,  27, 116, 120,  28,  93,  45,  27, 141, // Q..T.tx.]-..
-  81,  16, 143,  84,  84, 237,   9, 109, 216, 194, 244,  35, // Q..TT..m...#
- 210, 199, 178, 148,  17, 137, 110, 167, 227, 245, 177,  57, // ......n....9
- 216,   4,  59, 129,  33, 145, 247,  92, 149, 121, 140, 186, // ..;.!....y..
- 211, 199, 137,  20, 106,  18, 157,  98, 208, 143,  41, 100, // ....j..b..)d
- 105, 131, 120, 214, 110,  39, 169, 203,  13, 238, 203, 183, // i.x.n'......
-   3,  56,  70,  80, 182, 133, 100,  38, 117, 126,  24, 129, // .8FP..d&u~..
-  65,  90, 105, 196,  82,  77,  87,  21,  86,  43,  53,  97, // AZi.RMW.V+5a
- 247, 147, 165,  38, 218,  57, 138,  98, 125, 236,  42, 205, // ...&.9.b}.*.
-  21, 184, 255, 153,  23,  66,  21,  89, 161, 130, 161, 241, // .....B.Y....
-  78, 144, 178, 172, 191, 220, 244,  68, 177,  55, 224,  15, // N......D.7..
- 178, 167, 250, 134, 104, 204,  54,  58,  76, 114, 170,  85, // ....h.6:Lr.U
- 203, 163,  56, 164,  57, 143,  16, 106,  27,  20,   2, 206, // ..8.9..j....
-  91, 175, 141, 218, 211, 247,  25, 114,  94,  64, 232,  60, // [......r^@.<
-  34, 129, 231, 173, 105,  64, 181, 220, 229,  50, 236,  36, // "...i@...2.$
- 107, 105, 101,  26, 149,  52, 166, 133, 120,  87, 204,  71, // kie..4..xW.G
- 163, 105, 100, 192, 136, 192, 179,  16,  95, 203, 151,  91, // .id....._..[
-   8, 227, 166, 175,  62,  87, 198, 167, 187,  89, 111,  81, // ....>W...YoQ
- 246,  61, 234,  32,  14, 198, 130, 162, 179,  43, 156, 196, // .=. .....+..
- 152, 210,  70, 248, 175,  28,   7, 163, 184, 102, 116, 169, // ..F......ft.
- 239,  81, 130, 236, 226, 173,  43,  59, 192, 236,  31,  95, // .Q....+;..._
-   2,  83, 211,  13, 127,  40,  13, 226, 107, 112,  67, 240, // .S...(..kpC.
-   7,  92,  12, 126, 127, 174, 223,  91, 152,  65, 251, 111, // ...~...[.A.o
- 224,  46, 209, 111, 169, 163, 249,  70,  71,  84,  46,  81, // ...o...FGT.Q
-  63,  99,  91, 169, 244,  82, 162, 183,   2,   6,  29,  95, // ?c[..R....._
- 221, 184,  38, 115,  17, 228,  51, 175,  61,  15,   0,  65, // ..&s..3.=..A
-  87,  94, 251,  43, 248,  92,  46, 198, 190, 117, 113, 105, // W^.+.....uqi
- 144, 155, 202, 157,  36, 107, 104, 187, 255, 249, 247,  94, // ....$kh....^
- 115,   5, 255,  63, 241, 216, 192, 110, 103, 139,  40, 204, // s..?...ng.(.
-  93, 176, 217, 202,  75, 239,  85, 209, 218, 241,  29,  12, // ]...K.U.....
- 232, 224,  87,  30,  94, 228, 110, 199,  27, 116, 155, 206, // ..W.^.n..t..
- 183, 205, 129,  99, 183,  23, 109, 153, 161,  81, 171, 235, // ...c..m..Q..
- 129, 138,  58, 240,  15,  25, 243, 180,  87,   3,  19, 196, // ..:.....W...
-  56,  44,  29,   5,  80, 183, 188, 220, 168,  51, 249, 176, // 8,..P....3..
-  76,  35,  95, 189, 117,  65,  98, 212, 181, 252, 213,  85, // L#_.uAb....U
- 103,  94, 137,  72, 111, 205,  53,  31, 115,  43, 201, 105, // g^.Ho.5.s+.i
- 186, 232, 190, 223, 130,  20, 221, 210,  46,  25, 214,  27, // ............
- 148, 210, 190,  46, 195,  96,  24, 219,  21, 111,  75, 181, // .....`...oK.
- 182, 115,  93,  48,  45, 151, 206, 115, 195, 193, 166, 110, // .s]0-..s...n
- 209, 221, 189,  71,  40, 143,  73,  39,   3, 186, 154, 120, // ...G(.I'...x
- 144,  17, 148, 235, 104,  70, 175,  37, 148, 189, 172, 184, // ....hF.%....
-  67, 184, 243, 206, 119, 101, 212,  93, 249, 162, 140, 186, // C...we.]....
-   3, 238, 106, 167, 160,  92, 213, 199, 132,  46,  70, 129, // ..j.......F.
-  98,   5, 119, 216, 250, 101, 165,  30, 159, 232,  45, 227, // b.w..e....-.
-  58, 162,  56,  79, 163, 159, 212,  61,  10,   2, 126,  96, // :.8O...=..~`
-  67,  39, 131,  40, 215,  41, 178,  39, 116, 122, 184, 204, // C'.(.).'tz..
- 243,  36, 246, 140, 160, 129, 235,  15,  86, 173, 202, 241, // .$......V...
-  60,  47,   6, 174,   3, 178, 150, 139,  77,  70,  92, 178, // </......MF..
- 166, 229,  67, 114, 124,  58, 208, 211, 219, 213, 179,  32, // ..Cr|:..... 
-  43,  21, 225, 254,  93,  43, 166, 175,  47,  56, 116,  22, // +...]+../8t.
- 165,  90, 108,  74, 204,  25,  55, 232,  97, 243,  14,  50, // .ZlJ..7.a..2
-  26,  58, 229, 225, 236,   2, 198,  55, 120, 164, 218,   9, // .:.....7x...
-  12,  93, 236, 168,  22, 240, 172, 248, 240, 105, 138, 155, // .].......i..
- 136, 115, 210, 137, 224,  75, 238, 237, 209, 109, 178, 122, // .s...K...m.z
- 184,  90, 133,  54, 247, 106, 144, 169, 104, 242, 100,  47, // .Z.6.j..h.d/
- 244, 236, 213,  14, 187, 205,  66,   7, 167, 105,  47, 211, // ......B..i/.
- 156, 141,  53,  27,  93, 184, 236, 121, 136,  33,  96,  84, // ..5.]..y.!`T
- 170, 100, 143,  99, 210,  73,  84, 200,  45, 174,  17,  84, // .d.c.IT.-..T
-  25, 160, 160, 123, 142,  91,  67,  56, 245, 187, 139, 252, // ...{.[C8....
- 178,  13, 235, 240,   7,  36,  63, 122,  28,  90, 191, 117, // .....$?z.Z.u
-  52, 245, 235, 221,  53,  25,   6, 120, 137,  10, 124, 169, // 4...5..x..|.
- 104, 224, 232, 177,  64,   6, 209, 106, 112,   4, 179, 247, // h...@..jp...
-  69, 114,  57, 160,  39, 172, 237, 101, 254,   5, 143,  61, // Er9.'..e...=
-  79, 210, 251,  70,  67,  39,  46, 146, 166,  67, 145,  54, // O..FC'...C.6
- 231, 114,  87, 158,  91, 186, 208, 131, 225, 175, 151, 124, // .rW.[......|
- 249,  42, 247, 138,  43, 135, 208, 100, 241, 102,  62,  87, // .*..+..d.f>W
- 227,  16,  90, 224, 161, 166,  96,  74, 130, 129,  68, 124, // ..Z...`J..D|
- 172, 204, 165, 125,  25,  40, 220,  81, 127, 179, 218,  34, // ...}.(.Q..."
- 165,  35, 143, 175,  88, 213,  65,  22, 160, 128,  15, 157, // .#..X.A.....
-  32, 118, 139, 251, 181,   0,  23,  41, 130, 115,  32,  82, //  v.....).s R
-  31, 148, 247, 198,  26, 109,  39, 238, 130, 110, 177, 175, // .....m'..n..
-  94,  41,  26, 168,  53,  13,  18,  12,  68,   4,  21,  14, // ^)..5...D...
- 248, 114,  54,  56, 198, 167, 253, 196, 195, 206,  96, 183, // .r68......`.
- 191, 195, 128, 232,  80, 144,  27, 123,  14,  71,  40, 114, // ....P..{.G(r
- 208, 173,   9,  79, 178, 158, 230, 113, 218,  73, 252, 146, // ...O...q.I..
- 190, 141,  80,  45,  52, 185, 107,  97, 152,  97, 107,  55, // ..P-4.ka.ak7
-  32, 151, 175, 221,  82,  11,  19, 162, 182, 122, 162,  56, //  ...R....z.8
- 201,  73, 177, 127, 218,  14,  91,  11, 173,  87,  42, 189, // .I....[..W*.
-  49,  14,  76, 116, 152, 209, 176,  54,  86,  43, 239,   7, // 1.Lt...6V+..
-  20,  28,  89, 217, 129,  88, 128, 124, 227, 111,  41, 158, // ..Y..X.|.o).
- 233, 226,  97, 120, 177, 125,  58, 207,  47,  25, 159, 220, // ..ax.}:./...
-  22, 148,  90, 169, 162,  57, 134,  87, 174,  71,   4,  37, // ..Z..9.W.G.%
-   8, 250, 234,  28,  55, 193, 206,  41,  26, 122, 187,  90, // ....7..).z.Z
- 109,  29, 173, 198,  67, 187,  68, 198, 210, 237, 124, 160, // m...C.D...|.
-  59, 168,  92, 160,  36, 154, 100, 219,  45,  70,  81,  56, // ;...$.d.-FQ8
- 186,   6, 129, 121, 130, 156, 125, 167, 141, 110, 140, 128, // ...y..}..n..
- 145,  12,  49, 110, 151,  18, 151,  14, 106,  82, 217,  67, // ..1n....jR.C
- 212, 135, 123, 237, 170,   2, 120,   0,  99, 197,  40, 109, // ..{...x.c.(m
-  92, 133, 162, 205,  85,  33,  42, 175,  10,  30,  26, 180, // ....U!*.....
-   6,  13, 221,  13, 124, 233,  29, 138,  50,  38, 118,  93, // ....|...2&v]
-  18,  33, 248, 116, 100,  24, 247,  11,  97,  14, 184,  82, // .!.td...a..R
- 195,  26,  14,  41, 179, 244, 242, 132, 186, 222, 230,  16, // ...)........
-  27, 124, 251,  40,  77,  30, 175,   8,  80,  79,  55, 246, // .|.(M...PO7.
- 179,  96, 225,  53,  38, 181, 154, 123, 124,  35,  83,  77, // .`.5&..{|#SM
- 139, 200, 149,  94, 238, 202, 171, 157, 222,  15,  69, 179, // ...^......E.
-  10, 244,  89,  53, 190, 107, 183,  32, 229, 158,  59, 240, // ..Y5.k. ..;.
- 255,  61, 112,  47, 254, 243, 175, 203, 111,  61, 111, 224, // .=p/....o=o.
- 254, 171, 253, 173,  55, 120, 178,  71, 107,   1, 107, 239, // ....7x.Gk.k.
-   4, 245,  63, 216, 111,  90, 211, 227,  21,   1,  51, 106, // ..?.oZ....3j
-  32, 241, 213,  88,  49,  13,  88,  41,  56, 228,  22,  84, //  ..X1.X)8..T
-  66, 110,  28,  89,  11,  48, 170, 166, 107,  74,  92,  56, // Bn.Y.0..kJ.8
-  46, 198,  10,  63,  43, 241, 233, 195,  27,  43, 243, 238, // ...?+....+..
-  18, 131,  67, 151, 114,  87, 137, 190,  42, 208,  53, 134, // ..C.rW..*.5.
- 151,  68,  82,   3,  90, 208,  60,  51,  22,  86,  66,  81, // .DR.Z.<3.VBQ
-  75,  88,  28,  32,  55,  39, 110, 176,   8,  26,  73,  60, // KX. 7'n...I<
-  81,   4,  83, 186, 179, 166, 146, 176, 247, 249, 244, 105, // Q.S........i
- 150, 145,  57,  43, 148, 211, 158,  60,  25,  95,  18, 211, // ..9+...<._..
- 133,   1, 166,  15, 126, 115, 110, 201, 176, 243,  87,  23, // ....~sn...W.
- 205, 111,   7, 151, 214, 178,  19,  99,  73, 189, 152,  21, // .o.....cI...
-  80, 151, 238, 193, 178, 173, 198,  30,   6, 152,   1,  58, // P..........:
-  49, 147, 255, 119, 108, 249, 201, 105,  58,  24, 160,  47, // 1..wl..i:../
- 231, 124, 235,  96, 168,  30,  79,   8,  96, 117, 164,  64, // .|.`..O.`u.@
-  29,  28, 255,  58, 222, 214, 233,  60,  47, 213,  27, 160, // ...:...</...
-  57,  48,   3, 224,  98,  84, 209, 124,  44,   9, 111, 209, // 90..bT.|,.o.
-  93,  44, 118, 226, 114, 238,   9, 144, 149,  41, 152,   4, // ],v.r....)..
-  88,  65, 105, 204,  78, 216, 180, 221, 174, 111,  48,  14, // XAi.N....o0.
-  86, 170,  57, 242, 100,  79, 213,   3, 104, 250,  12,  67, // V.9.dO..h..C
- 101, 112, 125,  56, 161,  78, 235, 187,  49, 166, 241, 222, // ep}8.N..1...
-  64, 157, 227, 185, 225,  26, 239, 234, 148, 204, 106, 243, // @.........j.
-  66,   6, 133, 249,  74, 202,   5,  48, 232, 229,  26,  52, // B...J..0...4
-  43, 109, 189, 108,  72, 132, 222, 182,  21,  24, 220,  55, // +m.lH......7
-  58,  29,  24, 149, 204,   2, 220, 133,  32, 229, 138,  55, // :....... ..7
-  80,  89,  71, 191, 118, 139, 189,  70, 220,  61, 195, 113, // PYG.v..F.=.q
-  50,  90, 237,  31, 145,  12, 254,  82,   6, 111, 108,  41, // 2Z.....R.ol)
-   3,  92, 233,  99,  12, 124, 143, 138, 127,  43,  95,  93, // ...c.|...+_]
- 192,  27, 151, 114,  71,  62, 134,  56, 255, 219, 231,  38, // ...rG>.8...&
- 240, 147,  13, 210,  90,  70,  57, 125, 217, 193, 174,  54, // ....ZF9}...6
- 120,  44,   6, 234, 208, 215,  40,  76, 252, 116, 215,  23, // x,....(L.t..
-  41, 178, 255, 201,  23,  41, 174,  93, 115, 103,  23, 183, // )....).]sg..
-  26, 249,  30, 111, 130,   9, 115, 113, 207,  91, 187,  25, // ...o..sq.[..
- 110,  42, 160, 247,  54, 227, 165,  44,  20, 196, 221,  42, // n*..6..,...*
- 243,  35, 153, 129,  34, 160,  93, 189,   7, 252,  90, 132, // .#..".]...Z.
- 185, 219, 175,  38, 190, 141,  50,   0, 214, 241,  26, 113, // ...&..2....q
- 128, 119, 148, 209, 116,   3, 165,   6,  93, 157,  89,  90, // .w..t...].YZ
-  73, 221,  39, 154,  37,  97, 178, 204, 124,  83,  83, 152, // I.'.%a..|SS.
-  40, 101,  44, 144,  85, 252, 120,  80, 230,  28,  62,  96, // (e,.U.xP..>`
-  96,   1, 193, 245, 136,  87, 139, 148, 247, 231, 131, 118, // `....W.....v
-  48,  66, 187,  88, 198, 131, 139, 248, 210, 191, 184,  44, // 0B.X.......,
-  69, 251, 149,  61, 219, 187,  68,  51,  81,  13,  47, 150, // E..=..D3Q./.
- 151,  24, 165, 221, 229,  97,  39, 141,  70,  82, 218, 248, // .....a'.FR..
-  57, 115, 213, 181, 221, 168,  22,  15, 124, 253,   1, 239, // 9s......|...
- 105, 163, 113, 211, 199,  15, 215, 168, 143, 146,  63,  24, // i.q.......?.
- 135, 107,  56,  30,  31,  82,   0,  72, 139,  63, 230, 130, // .k8..R.H.?..
-  23, 133,  10,  95, 227,  79, 151, 173, 243,  23, 207, 187, // ..._.O......
-  21, 235,  88, 189,   0, 168, 168,  43, 129,  62,  13,   1, // ..X....+.>..
- 222, 183, 236, 144, 244, 249,   3,  57, 145,  76, 250, 124, // .......9.L.|
- 157,  81,  99,  93, 253, 220, 108,  22, 213,  34,  93,  45, // .Qc]..l.."]-
-   6,  65,  76, 232, 174,  88, 219, 214,   4, 208,  26, 178, // .AL..X......
- 181,  47, 234,  46, 222,  59, 193,  91, 181, 234,  11, 198, // ./...;.[....
- 148,  48, 212,  17, 181,  71, 110,  57,  60, 131,  70,   2, // .0...Gn9<.F.
- 126,  99,   8,  29, 166, 117,  36,  99,  58, 247, 168, 126, // ~c...u$c:..~
- 150,  48,  30, 128,   9, 188, 109, 246, 156, 139, 121, 189, // .0....m...y.
-  54, 110, 199, 139, 231,  29, 107, 214, 186,  94,  95, 189, // 6n....k..^_.
-   0,   0, 113, 140,  34, 111,  61,   9,   1,  45, 209, 253, // ..q."o=..-..
-   3,  34,  99, 189, 166,  73, 191, 192, 190, 105, 128, 239, // ."c..I...i..
-  80,  61, 219, 110,  95, 233, 110, 173, 156, 196, 198, 227, // P=.n_.n.....
- 193, 102, 232, 115, 197, 253,  77,  39,  35,  71, 119,   9, // .f.s..M'#Gw.
- 195,  18, 241,   0, 172, 219, 135, 208, 239, 136, 115, 252, // ..........s.
- 194, 137,  31, 183, 129, 225,  13, 191, 210, 135, 161, 204, // ............
- 203, 157, 229,  98,  31, 204,  46, 139,  79, 104, 128, 106, // ...b....Oh.j
- 163, 157, 181,  99, 220, 231, 128,   4,  69,  15, 208, 107, // ...c....E..k
- 216, 239,  53,  98, 192,  40,  40, 133, 115,  12, 238, 229, // ..5b.((.s...
- 158,  79,  23, 107, 243, 118, 136,  17, 213,  16, 102,  82, // .O.k.v....fR
- 186,   3,  20,  83, 152,  18,  56,  25, 109, 237, 114, 193, // ...S..8.m.r.
- 130,  10,  22, 216,  99,  59, 166, 224,  54, 142, 137,  39, // ....c;..6..'
- 113,  12, 217, 244, 224,  60,  54, 141, 163, 133, 172, 192, // q....<6.....
- 209,   7, 107, 125, 222, 152, 239, 157, 224, 248, 148, 176, // ..k}........
- 253, 208,  91,  46, 183,  26, 159, 150, 194,  23, 104, 156, // ..[.......h.
-  83, 111, 165, 242,  47, 198, 217,  50, 248, 206,  10, 118, // So../..2...v
- 203, 233, 156,  69,  76, 171, 104, 251, 188,  29, 210, 148, // ...EL.h.....
- 192,  23, 172, 227, 219, 204,  37, 183, 213, 102, 239, 240, // ......%..f..
- 193, 138,  81, 222, 252, 141,  81, 180,   0,  96, 151, 113, // ..Q...Q..`.q
- 229, 142,  85,  68,  72,  76,  37, 157,  95,  60,  39, 108, // ..UDHL%._<'l
-  33,   5,  90,  93,  81, 176,   4, 182,  87, 136,  66, 179, // !.Z]Q...W.B.
- 170, 149,   6, 255, 149,  14, 193, 224, 192,  20, 117, 203, // ..........u.
-  54, 100, 207,   8,  21, 158, 170,  94, 244, 137, 202,  17, // 6d.....^....
-  82,  57, 130, 177,  62, 129, 184,  20, 244, 228, 219,  27, // R9..>.......
-  40, 124, 113,  41,  55,  34, 242,  71,  68, 126, 112,  69, // (|q)7".GD~pE
- 253,  28,  47,  58,  18, 156,  81,  59,  45,  87,  75, 169, // ../:..Q;-WK.
-  90, 170, 105, 132, 247, 131, 213, 154,  96,  46, 193, 250, // Z.i.....`...
- 137, 252, 176,  15, 250, 240,  21, 234,  60,  83, 155,   8, // ........<S..
- 124, 103,  24,  32, 171, 208, 125,  42, 213, 119, 128,  14, // |g. ..}*.w..
- 118,  50, 228,  65, 169, 191, 175, 118, 238,  48, 243,  37, // v2.A...v.0.%
- 125, 157,  12, 172, 117, 221, 118, 151, 185,  12, 163, 163, // }...u.v.....
-  68,  51,  45, 226, 190, 225,  47,  18, 241, 226, 218,  60, // D3-.../....<
- 125, 132, 135,  84,   4, 105, 157,  30,   8, 205, 100,  37, // }..T.i....d%
- 143, 133, 250, 158,  78,   6,  89,  13,   0,  56,  16, 172, // ....N.Y..8..
-   5,  74,  48, 125, 255,  55, 152,  33,  39, 228, 227, 109, // .J0}.7.!'..m
-  35, 152, 179, 209, 133, 197, 172, 105,  94, 165,  46, 223, // #......i^...
- 105,  53,  18, 107,  71,  78,  43,  48, 253,  89, 180, 247, // i5.kGN+0.Y..
- 203, 188, 149,  76,  90, 244, 241, 188, 154, 226, 207, 130, // ...LZ.......
-  65, 207, 191, 106, 179,  63,  54,  72, 229, 169,  28,  55, // A..j.?6H...7
- 244,  75,   3,  32, 213, 158,  14,  78, 161,  24, 237, 189, // .K. ...N....
-  21,  72,  75, 143, 101, 133,  30,  85, 234,  36, 149, 183, // .HK.e..U.$..
- 137, 220, 239, 149, 250, 250, 189,  32,  16, 137,  39, 246, // ....... ..'.
- 205, 200,  46, 233, 108, 101, 208, 157, 183, 199, 232, 194, // ....le......
- 152, 133,  11,  94, 121,  31,  53,   7, 243, 249,  67, 233, // ...^y.5...C.
- 140, 202,  48,  13, 226, 177,  84,  31,  69,  37, 119, 182, // ..0...T.E%w.
- 125, 150,  13,  29, 153,  74, 157, 243, 237, 147,  54,  57, // }....J....69
- 179, 190,  21,  54, 213, 102,  65, 184, 227, 197,  62,  47, // ...6.fA...>/
-  41,  60, 122,  55,  94,  97, 222,  86, 184, 111, 168,  53, // )<z7^a.V.o.5
-  19, 186, 213, 149, 145,  62, 109, 126,  85, 111, 163, 155, // .....>m~Uo..
- 130, 111,  21, 201, 237,  93, 137,  75,  72,  35, 220,  33, // .o...].KH#.!
- 115, 181, 149, 149, 167, 138, 194, 136, 160,   0, 117, 249, // s.........u.
- 157,  45, 198,  43,  44,  27,   0,  74,  60,   1,  90, 133, // .-.+,..J<.Z.
-  42,  91,  14, 241, 227, 132, 195, 234, 137,  35, 179, 184, // *[.......#..
- 253, 238, 226,   7, 216,  52,  96, 172, 146, 209,  88,  16, // .....4`...X.
-  91, 162,  66, 223, 223,  41,  73,   1,  30, 129, 173,  14, // [.B..)I.....
-  68,  13, 223,  79, 182,  73,  82,  43, 250, 221, 104, 146, // D..O.IR+..h.
-  39, 252, 189, 153, 191, 108, 211, 196, 211,  18,  27, 205, // '....l......
- 126,  60, 127, 255, 238, 159,  12, 180,  80, 234, 186, 114, // ~<......P..r
- 242, 143, 212, 227, 198,  20, 183,  59,  41, 230, 139, 123, // .......;)..{
- 208, 143, 124, 188, 177,  52, 142,  48,   7, 187, 241, 107, // ..|..4.0...k
- 142, 118,  24, 176,   9,  42,  39, 108,  54, 212, 111, 200, // .v...*'l6.o.
- 120,  15,  53,  99, 221, 172,   5,  29, 167,  97, 227, 196, // x.5c.....a..
-  48, 207,  13, 191, 254, 252,  28, 183, 221,  42, 186, 224, // 0........*..
- 229, 253,  40,  82, 181, 177, 202,   1,  54,  53, 166, 207, // ..(R....65..
-  34,  86,  22, 214, 102,  19,  76,  20, 124,  24, 187, 198, // "V..f.L.|...
-  40,  42, 165, 153, 167, 224,  66, 220, 128,   6,   6, 243, // (*....B.....
-   0, 195, 237, 119,  91, 102,  15, 110,  38, 185, 234, 211, // ...w[f.n&...
-  70, 108,  76, 125, 240, 170,  98, 104, 174,  66, 179, 241, // FlL}..bh.B..
- 214, 213, 186, 199,  44, 166,  93, 212, 216, 251,  61,  48, // ....,.]...=0
- 181, 247, 143,  76,  17,  30,  33,  50,  45,  14, 141, 254, // ...L..!2-...
-   7, 104, 190,  43, 133,  65,  77, 175, 184,  48, 104, 181, // .h.+.AM..0h.
- 179, 146, 122, 129,   8, 159, 119, 240, 188, 206,  23, 125, // ..z...w....}
-  50, 174,  76,  70,  86, 128, 245,  78, 223,  16, 156,  88, // 2.LFV..N...X
- 249, 141, 213, 147,  20,  99,  42,  33, 227,  14,  12,  64, // .....c*!...@
- 183, 107,  32, 211,  81, 174, 155,  58, 125,  45, 162,  99, // .k .Q..:}-.c
- 196,  45, 244, 140, 188, 221, 148,  21, 109, 247, 169, 197, // .-......m...
- 120,  69, 205,  85, 234,   1, 208,  71, 182, 154,  61, 167, // xE.U...G..=.
-   5, 197,  86, 121,  87, 224,   6,  54, 254, 244, 168,  46, // ..VyW..6....
-  43,  91, 153,  70, 195, 152,  81, 246, 143, 250,  27, 116, // +[.F..Q....t
- 206,  54, 233,  28,   3, 157, 207, 219, 116, 208, 182, 170, // .6......t...
-  48,  75, 107,  53, 233, 184,  79, 255,  64, 199,  33,  71, // 0Kk5..O.@.!G
-  87, 116,  98, 165,  51, 177,   9, 175,   1,  24, 121, 101, // Wtb.3.....ye
- 255, 111,  66, 252, 137, 142, 231,  86, 193, 122, 183, 193, // .oB....V.z..
- 129, 117, 183, 103, 184, 171, 192, 201,  22,  74, 254, 130, // .u.g.....J..
- 245,  31, 149, 246,  79, 143,  75,  59, 140, 107, 217, 253, // ....O.K;.k..
- 175,  69, 116,  67,  47,  24, 230,   6,  11, 116, 211,  54, // .EtC/....t.6
-  43, 148, 131, 229,  74, 221,  55,  51,  86,  37,  44, 123, // +...J.73V%,{
-  67, 155, 205, 239,  75, 120,  25, 109,  43,  61, 170, 121, // C...Kx.m+=.y
- 238, 242, 154,  12,  35,  31,  91, 102, 175,  18, 231, 174, // ....#.[f....
- 236, 183, 148, 196, 227, 145, 179, 179,  38, 108,  90, 210, // ........&lZ.
-  26, 132, 198,  10,  56, 231,  27, 100, 250, 155, 232, 218, // ....8..d....
- 144, 119, 228, 150, 103, 104,  49, 105,  91, 198, 136, 179, // .w..gh1i[...
- 181, 243,  80, 208, 173, 104,  49, 235, 189, 211, 102, 133, // ..P..h1...f.
- 101, 234, 247, 143, 113,  79, 207, 226, 195,  53, 227, 246, // e...qO...5..
- 140, 217, 131, 231, 216, 104, 172, 141,  14, 198, 229,  14, // .....h......
-  76, 171,  99, 171, 252,  86,  43,  99, 120, 173,  25, 190, // L.c..V+cx...
-  31, 132, 250,  44,  20,  30,  18,  43, 121, 142,  63, 234, // ...,...+y.?.
- 239,  59, 210, 167, 105,  25,  92, 138,  30,  96,   6, 158, // .;..i....`..
- 250, 192, 117, 122,  93,  57,  69, 245,   7, 217, 214, 159, // ..uz]9E.....
- 193, 174, 251, 140,  70, 212, 103, 169, 216, 189,  43, 215, // ....F.g...+.
- 249, 205, 125, 192, 157,  57, 140, 236,  27, 243, 131, 206, // ..}..9......
- 166, 228, 188, 196,   1, 227,  67, 238,  69,  36, 226,  75, // ......C.E$.K
- 169, 194, 194,  24,  96, 130, 139, 200, 156, 182, 190,  97, // ....`......a
-  31,  35, 162, 115,  78, 180, 103, 197,  95,  77, 120, 160, // .#.sN.g._Mx.
-  31, 248, 255,   9, 204, 248,  64, 251,  42, 236, 209, 211, // ......@.*...
- 234, 240, 169, 210,  37, 143, 169, 175, 216, 105,  10, 145, // ....%....i..
-   1,  54, 232, 248, 117,  78,  56, 142,  79, 145, 243,  53, // .6..uN8.O..5
- 158, 147,  44, 119,  81, 222, 238, 213, 247,  74,  93, 252, // ..,wQ....J].
-  82,  32, 159, 171,  50,  23, 102,  85, 249, 132, 252,  26, // R ..2.fU....
- 191, 185,   7,  38, 206, 142, 213, 233, 157,  84,  93, 145, // ...&.....T].
- 232, 198, 198,  92, 213, 128,  41, 186, 218, 219, 104, 236, // ......)...h.
- 147, 105, 136, 233, 210, 237,  90,  87, 231, 208, 117, 197, // .i....ZW..u.
- 156, 142, 119, 132,   6,  73,  79, 150, 237, 113,  69,  32, // ..w..IO..qE 
-  57, 171,  98, 168, 224, 153, 194,  66,  39,   2,  35,  93, // 9.b....B'.#]
-  36, 128, 123,  58, 224,  86, 156,  44,  35,  56,  48, 144, // $.{:.V.,#80.
-   4, 102, 139, 139,   7, 123, 181,  57,  98, 169, 250,  75, // .f...{.9b..K
- 217, 134,  99, 178, 145,  99, 188, 113,  78, 174, 131, 123, // ..c..c.qN..{
-  33, 175,  75,  36,  96,  42,   2, 213,  75, 231, 204, 212, // !.K$`*..K...
-  15, 246, 210,  67, 185, 109, 215, 229,  83, 185, 234, 167, // ...C.m..S...
- 210,  22,   9, 157, 105, 125, 236,  92, 146, 130,  81, 160, // ....i}....Q.
- 100, 169, 206, 194,  17, 136,  70, 144,  93, 243, 200,  27, // d.....F.]...
- 121,  52, 142, 231, 185, 170,   3,  11,  79, 133,  56, 234, // y4......O.8.
-   7, 198, 228, 187, 181, 135, 252, 252,  91,  91, 127, 114, // ........[[.r
- 155,  46, 188,  58,  87,  89, 238, 236, 212, 202, 161, 202, // ...:WY......
- 170,  86, 216,  67, 249, 243, 174,  15,  27, 159, 207,  22, // .V.C........
-  28,  13, 211, 113,   5,  65,  95, 147, 125, 164, 142, 250, // ...q.A_.}...
- 109, 173,  63,  51, 187,  85, 129,  53, 190,  62, 168,  72, // m.?3.U.5.>.H
-   2, 134, 144, 131, 141,  68, 159, 156, 125, 164, 191,  46, // .....D..}...
- 233, 231,  31,  93,   7, 234,  56, 130, 196,  29, 208, 179, // ...]..8.....
- 235, 187,  75, 230,  75,  96,  28,  95, 139, 204, 173, 102, // ..K.K`._...f
- 187, 128, 197, 252,  49,  37, 106,  91, 186, 216,  41, 227, // ....1%j[..).
- 226,  74,  40,  86,  75,  36, 222, 150, 235,  39,  80,  59, // .J(VK$...'P;
- 203, 241, 148,  23,  42, 235,  15, 250, 152,  53, 158, 201, // ....*....5..
- 138, 193, 195, 231, 111,  26,  65,  61,  80, 111,  17, 253, // ....o.A=Po..
- 104, 190,   3, 230,  38, 171, 223, 192, 156,  22,  48, 131, // h...&.....0.
- 234, 225,  85,  12, 207, 118, 211, 109,  21, 250, 192, 141, // ..U..v.m....
-   6, 184,  31, 147,  66,  32,  27, 198,  46,  42, 120,  73, // ....B ...*xI
- 137,   4,   2, 153, 104, 131, 238,  68, 118, 190, 113,  35, // ....h..Dv.q#
- 137, 101,  98, 173,  81, 186,  24,  70, 178,  59, 148, 232, // .eb.Q..F.;..
- 114, 112,  31,  18,  63, 201, 186,   6,  40,  34, 250, 162, // rp..?...("..
- 116,   1, 163,  98,  24, 233, 146, 128, 134,  83, 152, 175, // t..b.....S..
- 175, 233,  74, 124,  96, 175, 152,  11,  77, 131,   2,   9, // ..J|`...M...
-  88, 249,  17,  82, 232,  29, 126, 188, 164, 110,  23,  82, // X..R..~..n.R
- 194,  31, 205, 159, 137,  19,  78,  10, 215,  55, 106, 127, // ......N..7j.
- 162, 101, 221,  51,  20, 211, 231, 136, 116, 180, 147,  78, // .e.3....t..N
-  18,  21,  33, 194, 213, 138, 138, 145,  42,  49,  57, 196, // ..!.....*19.
-  88, 110, 252,  60, 222, 207, 200, 241, 172,  12, 244,  42, // Xn.<.......*
- 115, 203,   4,   9, 127,  55, 137, 186,  76, 233, 219, 145, // s....7..L...
- 120,  22,   2, 126, 138, 158, 211, 129,  91, 253, 244,  57, // x..~....[..9
- 223, 158,  96, 222, 224, 239,  46,  85, 252, 224, 228,  54, // ..`....U...6
-  86, 233, 249, 231,  31, 244, 181,  62,  84, 159, 167, 128, // V......>T...
-  99, 173, 153,  30,  18, 223,  32,  45,  53, 203,   7, 206, // c..... -5...
- 127,  45, 198, 126, 149, 162,  86, 199, 234, 184,  75,  90, // .-.~..V...KZ
- 209, 252, 248, 229,  47, 237, 213,  98,  18, 188, 222, 100, // ..../..b...d
-  64,  95, 126, 138, 252, 104, 176, 245,  93, 166, 168, 248, // @_~..h..]...
- 104,  86, 249,   3,  78, 168,  69, 240,  83, 130, 184,  23, // hV..N.E.S...
- 130, 145,  72, 152, 183,  76,  61,  63, 109,  39, 110,  72, // ..H..L=?m'nH
- 129, 238,  50, 243, 234,  35, 119, 255,  64, 232, 152, 216, // ..2..#w.@...
-  21, 154, 170, 157,  52,  69, 155, 216, 132,  67, 108,  91, // ....4E...Cl[
-  36,  47,  45, 198,  99, 242, 156, 232,  78, 123, 209, 237, // $/-.c...N{..
- 104, 163,  91, 228, 104,  58, 224, 202,  73, 219,  29, 182, // h.[.h:..I...
- 222,  20, 194,  89, 149, 193, 221, 248, 100, 127, 181, 122, // ...Y....d..z
- 102, 110,  34, 228,  90, 110, 122,  21, 174, 175,  92, 177, // fn".Znz.....
- 250,  47, 183, 246, 204,  36, 162,  98,  81,   3,  18,  71, // ./...$.bQ..G
- 165, 157, 158, 168,  93, 232,  33, 197,  92, 189, 229, 166, // ....].!.....
-  93,  93,  77, 118, 125,  94, 207, 236,  93, 215, 173, 149, // ]]Mv}^..]...
- 185,  52,  40, 235, 153, 171,  78,  79,  38, 180, 149, 232, // .4(...NO&...
- 226,  70, 207, 106, 117,  80, 100, 195,  26, 223,  45, 189, // .F.juPd...-.
- 217, 112,  79, 113, 187,  62, 222, 172, 191, 191, 163, 190, // .pOq.>......
- 133,  93, 127, 118,  12,  57, 225, 234,  42,  75, 150, 233, // .].v.9..*K..
-   8, 191,  78, 134, 161,  24, 197, 252, 201,  59, 222, 244, // ..N......;..
- 173, 242, 252, 242, 145, 246,  69,  29, 143,  64, 208, 157, // ......E..@..
- 238, 136,  29,  11, 103, 233, 156, 252, 213, 193, 202, 213, // ....g.......
- 106, 103, 182,  62, 145,  17,  72,  55,  52, 127, 136,   0, // jg.>..H74...
-  76, 136, 255, 146, 100, 229, 156, 201,   7, 218,  94, 194, // L...d.....^.
-  63, 124, 242, 205,   9, 238,  71, 213, 198, 210,  57,  59, // ?|....G...9;
- 168, 117, 143, 106, 111, 187,  93, 252, 233,  30, 212, 122, // .u.jo.]....z
- 207, 106, 221, 227, 218, 126, 173,  71,  25, 189,  99, 120, // .j...~.G..cx
-  58, 181, 189, 231, 223,   8,  39,  24, 143,  91, 244,  71, // :.....'..[.G
-  93, 156, 114, 115, 106,  86, 123,  75, 149, 187, 181, 179, // ].rsjV{K....
- 218,  97, 173, 139, 175, 189, 167, 248, 139, 175, 144, 162, // .a..........
-  87, 250, 237,  62, 171, 245, 246,  33, 187, 244, 190, 223, // W..>...!....
- 117, 108, 247, 252,  23, 152, 176, 255, 105, 205, 254, 149, // ul......i...
-  16, 233, 208, 159, 124, 170, 185, 173, 174, 168, 117,  61, // ....|.....u=
- 167,  40, 105,  37,  41, 126, 194,  88,  58, 252,   7, 123, // .(i%)~.X:..{
- 156, 231, 255, 191, 193,  58, 153,  26, 200, 194,  56,  79, // .....:....8O
-  16, 174,  20, 236, 141, 218, 157, 116, 186,  78, 237,  94, // .......t.N.^
-  58,   7,  78, 141, 255,  84, 213, 126, 167, 198, 223, 205, // :.N..T.~....
- 147, 189,   3, 192,  86, 173,  10, 200, 177,   6, 228,   0, // ....V.......
- 134,  56,  38, 116,  99, 218,  32,  22, 230, 150, 230, 101, // .8&tc. ....e
- 148,  66, 133, 253, 218,  91, 232,  18, 104, 209, 195, 199, // .B...[..h...
- 151,  26, 230, 225,   4, 240, 231,  25, 189,   1, 188, 248, // ............
- 214,  59, 212, 157, 164, 176, 240, 223, 168,  13, 194, 118, // .;.........v
- 106, 111,  15, 144, 134, 246,  31, 228, 156, 245, 106,   7, // jo........j.
- 181, 183,  61,  76, 194,  16, 252,  60, 160,  33,  32, 239, // ..=L...<.! .
-  16,  74,  32, 243, 208, 144,  28,  92, 176,  91, 253,  23, // .J ......[..
-  96,  42,  84, 135, 129, 123,  52,  62,  66,  73,  47, 103, // `*T..{4>BI/g
- 252,  66,  48,  85,  90, 227, 159, 106, 169, 180, 133,  33, // .B0UZ..j...!
- 143,   8, 128,  35,  28,  29,  90, 159,  81,  26,  39,  92, // ...#..Z.Q.'.
- 240,  26,  53, 165,  63, 101,  83, 105,  11,   3, 153, 154, // ..5.?eSi....
-  56,  40,  54, 230,  23, 234, 175, 210,  56,  79,  22,  27, // 8(6.....8O..
-  32, 119,  53, 120, 216,  12,  17,  65, 105, 158,   4, 183, //  w5x...Ai...
- 196,  63,  39, 115,  27, 164, 227, 108, 131,  26,  61,   3, // .?'s...l..=.
-  46,  77, 209,  38, 248, 159,  41, 249,  98, 250, 152, 150, // .M.&..).b...
-  91,  31, 214, 158, 213, 222,  30,  18,  37, 159, 234,  39, // [.......%..'
- 211, 179,   3, 191,  47, 233, 137,  36, 160,  30, 113,  70, // ..../..$..qF
- 244, 120,  70,  15, 211,  95,  12, 253, 141, 194,  20, 189, // .xF.._......
- 224,  17, 114,  30,  76, 115, 116, 207, 191,  41, 252,  28, // ..r.Lst..)..
-  56,  85, 134,  59,  34, 236,   2, 208,  26,  29,  67,  21, // 8U.;".....C.
-  69, 101, 136, 128,   9, 158, 214,  94, 194,  19, 199,  33, // Ee.....^...!
- 200, 137, 153, 136,  61,  33,  15, 159,  79, 241, 137, 232, // ....=!..O...
- 133, 196, 161, 126, 226,  36,  14, 107,  47, 233, 121, 140, // ...~.$.k/.y.
- 133, 212,  15, 204,   4, 248,   5,  11, 248, 167,  71,  76, // ..........GL
- 139,  40, 123,  70, 157, 241, 243,  80,  63,  53, 103, 227, // .({F...P?5g.
- 144,  26, 182,  36, 185, 222, 192,  53, 192,  70,  79, 104, // ...$...5.FOh
-  89, 235,  49, 163,   0, 223, 190,  36,   1,  53,  10, 169, // Y.1....$.5..
- 120,  66,  38, 252,  67,  42,  28,  19,  91,  28,   1,  32, // xB&.C*..[.. 
-  80, 175,  70,  93, 208, 131, 101, 231,  41,  83, 254, 184, // P.F]..e.)S..
-  24,  22, 255,  10, 214,   6,  71,  51, 218, 144,  59,  52, // ......G3..;4
- 131,  97, 127, 144, 212, 148,  69,  37,  20, 143, 131, 180, // .a....E%....
- 194, 143,  12, 161, 101,   6,   2, 225,  11, 113, 244,  33, // ....e....q.!
- 243,  41, 204, 250,  41,  78,  26, 103, 116, 214, 221, 167, // .)..)N.gt...
- 249, 239,  83, 250,  25, 165, 159,  97,  26, 112,   3, 105, // ..S....a.p.i
- 120,  62,  51,  67, 225,  31, 252, 169,  14, 132,  74, 228, // x>3C......J.
-  89, 141, 232, 118, 128, 160,  29, 224, 204, 143, 113, 196, // Y..v......q.
-  99,  35, 133, 248, 248, 194, 236, 240,  56, 195,  24, 217, // c#......8...
-  30,   5, 176,  24, 237, 146, 109, 214,  10, 132,  47, 236, // ......m.../.
- 179, 107,  17, 160, 155, 108,   9, 116, 143,  16, 240, 246, // .k...l.t....
- 200,   8, 229,  70, 253, 109,  41, 102, 165, 131, 216, 214, // ...F.m)f....
-  58,  96, 163, 197, 166, 232, 226, 244,  88,  82, 105, 146, // :`......XRi.
- 189, 130,  34,  85, 197, 121, 164, 149, 195,  17, 233, 121, // .."U.y.....y
- 196,  44,  42,  75, 228,  95, 196, 116,   7, 127,  14, 177, // .,*K._.t....
-   3, 214,  80,  21,  36, 161,  30,  69,  36, 245, 158,  18, // ..P.$..E$...
- 146, 182,  43, 116, 123, 219,  21,   0,   2, 252,  84, 202, // ..+t{.....T.
-  38,  43, 245, 144,  60, 111, 187, 196, 184, 168,  92, 205, // &+..<o......
- 220, 102, 234,  38,  77, 226, 199,  80, 206,  19,  68, 193, // .f.&M..P..D.
- 171, 117, 123,  27,  77, 182,  81, 206,  24,  60, 214, 108, // .u{.M.Q..<.l
- 186,  89, 127,   7, 202, 153,  70, 180, 236, 144,  52, 110, // .Y....F...4n
- 180, 216, 133, 114, 102, 130,  99, 196, 151,  86, 144, 140, // ...rf.c..V..
- 143, 255, 170, 143,  38,  97,  20, 193, 162, 204,  71,  97, // ....&a....Ga
- 232, 175,  15, 234, 230,  81, 184,  24,  38, 160,  96,  55, // .....Q..&.`7
-  32, 235,  17, 182, 180, 192, 245,  72, 165,  18,  27, 129, //  ......H....
- 144, 116, 113, 177,  58, 130, 135,  89, 106, 248, 121, 128, // .tq.:..Yj.y.
- 171, 250, 129, 233,  53,  25,  93, 255,  51,  29, 201, 107, // ....5.].3..k
-  50, 235, 109,  28, 175,  99, 123, 202,  84, 149, 146, 136, // 2.m..c{.T...
-  52,  82, 242, 103, 251, 154, 105,  13, 234, 240, 232, 217, // 4R.g..i.....
-   6,  83, 131, 170, 223,  71, 173, 216,  37,  93, 120,  70, // .S...G..%]xF
- 154, 252,  45, 234, 192, 167,  36,  23, 168,   0, 143,  73, // ..-...$....I
-  21,   1, 248,  79,  77,  47,  81,  20,  44, 170, 163,  62, // ...OM/Q.,..>
- 109, 239,  31,  62, 133,  58, 207, 218, 221, 131, 222, 241, // m..>.:......
- 209, 231, 238, 209, 233,  97, 251, 136, 147, 157, 246,  49, // .....a.....1
- 148, 157, 118, 218, 135, 159, 117, 241, 169, 174, 254,   5, // ..v...u.....
- 144,  69, 169,  90, 231, 243, 161,  46, 234,  30,  65, 189, // .E.Z......A.
-  35, 106, 114, 112, 250,  76, 247, 209,  57, 213,  21, 191, // #jrp.L..9...
-  56,  91,  70, 150, 219,  19,  61, 176, 176, 192,  23,  74, // 8[F...=....J
- 174, 245,  95, 222, 148,  78, 199, 100, 108, 210, 116,   7, // .._..N.dl.t.
- 157, 121,  78, 224,  78, 108,  32, 242,  41, 219,  22,  79, // .yN.Nl .)..O
- 121, 197, 164, 199,  33, 226, 229, 144,  16, 171,  87,  44, // y...!.....W,
-  22,  88,  90, 110, 186, 164, 216, 191, 212, 244, 138, 207, // .XZn........
-  43, 246, 255, 163, 237, 202, 187, 219,  54, 146, 252, 255, // +.......6...
- 249,  20,  48, 198, 209, 144,  18,  72,   1, 224,  77,  25, // ..0....H..M.
- 226, 115, 148, 201, 219, 217,  39, 101,  50,  73,  60, 243, // .s....'e2I<.
- 158,  61,  94, 139,  34,  65,   9,  99,   8,  96,   8,  82, // .=^."A.c.`.R
- 150,  34, 241, 187, 111, 253, 170, 170, 113, 145, 114, 156, // ."..o...q.r.
- 217, 172, 143,  38, 142,  70,  31, 213, 117,  55,  80,  69, // ...&.F..u7PE
- 167,  92, 227,  92, 239,  26,  16,  46,  31, 246, 243, 100, // ...........d
- 161,  18,  95, 121, 178,  32, 213, 185,  10,  57, 220, 144, // .._y. ...9..
-  50, 111, 103,  21, 206, 163, 245, 172, 134, 158,  62,  22, // 2og.......>.
- 140,  23, 175, 227, 106, 201,  66, 165,   7,  53, 249, 156, // ....j.B..5..
- 149, 101,  58, 246,  61,  86, 161, 125, 175, 134, 104,  62, // .e:.=V.}..h>
- 107, 109,  62, 166,   3,  26, 151, 210,  67, 143, 207, 209, // km>.....C...
- 200,  60, 204,  62,  34, 199,  93,  21, 179, 124,  81,  22, // .<.>".]..|Q.
- 124, 214,  22, 132, 136,  85,  68,  75,  57, 210, 242,  92, // |....UDK9...
-  42, 177,   4,  18, 217,  41, 210, 177,  35, 146,   9,  23, // *....)..#...
- 117, 182,  38,  82, 115, 185,  35, 110, 229, 140, 171, 123, // u.&Rs.#n...{
- 162,  31, 120,  29,  97, 185,  29, 225, 187,  96, 220,   0, // ..x.a....`..
-  72, 199,  87, 201, 203, 138, 159,   7, 138,  52, 202,  32, // H.W......4. 
- 159,  92,   8, 105, 149, 117,  43, 192, 182, 198,  96,   6, // ...i.u+...`.
-  44, 242, 128,   8, 162, 248, 200, 228,  68, 169, 240, 204, // ,.......D...
- 170, 123,   2, 108, 230, 255, 114,  87, 219, 131, 231, 175, // .{.l..rW....
- 206,  67, 133, 168, 209, 166,  55, 100,  24, 248,  34, 133, // .C....7d..".
- 141, 150, 108, 147,  46,  20,  45, 179,  40, 107, 221, 144, // ..l...-.(k..
- 233, 240,  43, 130, 222, 199, 118, 149, 117,  12, 148, 205, // ..+...v.u...
- 119,  13, 155, 223, 191,  80, 185, 108, 216, 119, 187, 204, // w....P.l.w..
- 130, 138, 134, 190, 224, 161,  92,  10, 117, 203,  66, 166, // ........u.B.
-  24, 181, 201, 160, 105, 239, 103, 119, 131,  47,  28, 243, // ....i.gw./..
-  30,  22, 249, 251,  30, 194,  56,  63, 247,  16,  45,  79, // ......8?..-O
-  82, 165, 162,  46, 171,  87, 221,  92, 224, 139,  10, 144, // R....W......
-  99, 114, 142,  37, 247, 203, 105, 245,  73, 226, 116,  84, // cr.%..i.I.tT
-  39, 103, 118, 126, 219, 167, 131, 209,  63, 188, 110, 219, // 'gv~....?.n.
-  39, 182, 102, 152,  31, 120,  36, 213,  36,  30, 216, 109, // '.f..x$.$..m
-  15, 232, 186, 165,  76, 239,  31,  94, 123, 128, 250, 101, // ....L..^{..e
- 230,  87, 230, 137,  90, 157, 112, 234, 255, 135,  21,  74, // .W..Z.p....J
- 110, 187,  10,  36,  88, 121,  62,  87, 213,  64,  10,  53, // n..$Xy>W.@.5
- 159, 186,  70,   3, 184,  24,  26, 117, 160,  43,  90, 185, // ..F....u.+Z.
-   1,  14,  25, 185, 201, 180, 162, 205,  67,  76,  64, 234, // ........CL@.
- 140, 132, 128, 124,  83, 130,  45, 209, 255,  46, 247, 196, // ...|S.-.....
-  54,  32, 213, 188, 224,  99, 136,  31,  79,  53, 225, 240, // 6 ...c..O5..
- 161,  46, 205,  21, 255,  61,  89,  97, 239, 183, 240, 166, // .....=Ya....
- 191, 203, 240, 160, 131, 139, 238, 109, 172, 139, 158, 101, // .......m...e
-  84, 234, 114,   9, 218,  23,   9, 140, 186, 162, 107, 106, // T.r.......kj
- 161,  52, 190,   8, 195, 121, 117, 120,   6, 255, 126,  19, // .4...yux..~.
- 105, 203,  86,  48,  89,  39, 112, 111, 176, 188, 129,  91, // i.V0Y'po...[
-  99,   0, 112,  92,  64, 165,  56, 243,  48,  72, 140, 130, // c.p.@.8.0H..
- 199,  98, 236,   3, 106,  52,  28, 215, 109, 131, 170,   2, // .b..j4..m...
- 226,  49, 183,  17,  29, 101, 200,  10, 204,  80, 173,  89, // .1...e...P.Y
- 207, 205,  27, 161, 229, 170, 138,  18, 216,  73,  22,  67, // .........I.C
-  67,  13,  62,  20, 212,  96,  79,  10,  88,   3, 104, 135, // C.>..`O.X.h.
- 205, 196,  92, 100, 112, 251,  61,   3, 146, 184, 106,  95, // ...dp.=...j_
-  22,  67, 203,  13,  63,  86, 105,  60, 177, 114, 135,  88, // .C..?Vi<.r.X
-   3, 157, 149, 189,  72,  99, 164,  87,  77, 151,  97,  82, // ....Hc.WM.aR
- 209, 245,  24,  61, 206, 197,  65,  32, 154, 168, 199, 166, // ...=..A ....
- 160, 231, 178, 242,  55, 100, 134,  44,  40, 201,   8,  36, // ....7d.,(..$
- 127,  13, 172, 184, 209, 154, 250,  43, 106, 184,   0, 107, // .......+j..k
- 128, 214,  88,  39,   2,  15,  96,  79, 131, 170, 187, 133, // ..X'..`O....
- 162,  75, 100, 247, 140, 221,  93, 182, 183,  85,  95,  19, // .Kd...]..U_.
- 161,  93,  51, 187, 237, 197,  38, 142,  51,  18, 225,  97, // .]3...&.3..a
- 210,  10, 239, 163, 117, 109, 130, 158, 168, 152, 242, 175, // ....um......
- 203,  70, 107,  87,  92,  29, 172, 165,  83, 121, 209, 205, // .FkW....Sy..
- 181, 118, 115, 149, 105, 213, 229, 106, 250, 207, 204,  57, // .vs.i..j...9
- 239, 107, 183,  23, 128, 166, 210, 135,  33, 191, 188,  11, // .k......!...
- 115,  90, 238,  65, 252,  51,  69,  15, 215, 209,  98,  93, // sZ.A.3E...b]
- 107, 187, 139,  39, 197, 210, 149, 146,   9, 154,  53,  76, // k..'......5L
-  28,   2,  62,  92,  26, 119,  17, 105,  12,  22, 255, 208, // ..>..w.i....
- 101, 182,  17,  89, 250, 203, 149, 162,  24,  90, 162,   7, // e..Y.....Z..
- 137, 126,  80, 220, 144,  22, 202,   2, 252,  58,  90, 223, // .~P......:Z.
- 108, 174, 204, 160, 118, 216, 226,  62,  66, 100, 177, 236, // l...v..>Bd..
-  83,  15, 103,  60,   6,  87, 134, 194,  87, 122,  29, 160, // S.g<.W..Wz..
- 121, 159, 181, 138,  62, 171,  49,  90, 122,  92, 138, 169, // y...>.1Zz...
- 210, 235,  49, 133, 246,  24, 133, 240,   4, 217, 111, 110, // ..1.......on
-  81, 118,  71,  80,  15, 186, 130,  91, 192, 251,  46, 187, // QvGP...[....
- 188,  80, 118, 184, 236,  89, 221, 161,  41, 135,  86, 143, // .Pv..Y..).V.
-  59, 235, 113,   7,  61, 158,  53,  93, 135,  45, 209, 215, // ;.q.=.5].-..
-  18, 252, 146,  93,  21,  93,  70, 147,  14, 235,  64,  66, // ...].]F...@B
- 137,  62, 183, 230, 251, 166, 100, 170, 244,  88,  77, 149, // .>....d..XM.
- 210, 119,  77,  53, 118,  33, 210, 197,  14, 151,  93,  23, // .wM5v!....].
-  87, 116,  72, 163, 162, 196,  48,  92,  28,  83, 107,  82, // WtH...0..SkR
- 234, 192, 184, 199,  30, 247, 222, 227, 145, 208, 144, 232, // ............
-  95, 103, 136,  17, 118,  70, 152, 110, 151,  31, 164, 178, // _g..vF.n....
-   7, 124, 115,   1, 173,  51, 252, 120, 184, 214, 231, 135, // .|s..3.x....
- 250, 252,  28, 149, 125,   6,  28, 149,  29,  62, 246, 120, // ....}....>.x
- 234, 186,   6,  74,  58, 215, 171, 244, 211,  23, 251, 231, // ...J:.......
- 120, 189, 114, 167, 155, 248, 224, 164, 153, 155, 176, 102, // x.r........f
- 141, 179, 108,  63,  19,  32,  90,  96, 241, 226,  95,   2, // ..l?. Z`.._.
-  84, 250, 226,  21,  21, 238, 235, 137, 227, 162, 139,  41, // T..........)
- 247,  13, 212, 135,  70,  66, 184, 123, 188,  62,   3, 241, // ....FB.{.>..
- 127,  20, 212, 127, 147, 222, 134, 117, 155,  82, 136, 185, // .......u.R..
-  16, 178, 158, 138, 151, 156, 248, 202,   6, 130, 159,  67, // ...........C
-  67, 210,  70, 255,  39,  18, 187, 159,  27, 240, 133, 111, // C.F.'......o
-  55,  74, 174, 210, 251,  42, 115, 100,  59, 168,  98,  79, // 7J...*sd;.bO
- 136, 240,  25,  88, 234, 174, 146,  42, 158,  43, 130, 139, // ...X...*.+..
- 127,  60, 207,   0,  66,  52, 108, 183, 132, 138, 198, 207, // .<..B4l.....
- 100,  58,  92, 164, 191, 219,  22, 246, 116,  30,  29, 171, // d:......t...
- 100,  25,  43, 217, 199, 112,  37,  36, 200, 179,  94, 134, // d.+..p%$..^.
- 239,  16,  56,  44,  54,  27,  31,  66,  96, 140, 212,  70, // ..8,6..B`..F
- 231, 195, 183, 230, 233, 228,  99, 237, 193,  33,  77,  10, // ......c..!M.
-  37, 171, 132, 192, 117, 113,  97, 169, 171,  80,  52, 196, // %...uqa..P4.
- 145, 153, 174, 199,  45,  15,  44, 232,  57, 116, 239,  76, // ....-.,.9t.L
- 126, 134,  34,  46, 225, 216,  17, 230, 229, 187, 226,  87, // ~."........W
- 199,  72,   4, 113,  61,  33,  80,  29, 133, 249,  76, 127, // .H.q=!P...L.
-  63,  96,  60,   6,  76,  29,  46,  66, 242, 103,   0, 183, // ?`<.L..B.g..
-  95,  87,  93, 196, 138,  19,  39, 104, 207, 130,  67, 212, // _W]...'h..C.
- 115, 141, 250, 194,  30,  48,  26, 218,  80, 153, 198, 219, // s....0..P...
- 124,  12,  21,  72, 244, 120, 229,   4,  11,   6,  90, 162, // |..H.x....Z.
-  54, 155, 184,  61,  56,  60, 241,  23, 186,  47, 102, 218, // 6..=8<.../f.
- 145,  66,  84,  59, 113, 164, 170, 123, 198, 239,  60, 175, // .BT;q..{..<.
- 165, 119,  11,  29, 238, 207, 206, 237,  52, 138,  63,  35, // .w......4.?#
- 166, 213,  56,  84, 195,  49, 151, 185, 138, 199, 183,  97, // ..8T.1.....a
- 178, 169, 210, 182, 104,  12, 172,  71, 177, 251, 157, 225, // ....h..G....
- 127, 193, 203, 195, 226, 172, 107,  30, 204, 178, 233, 117, // ......k....u
- 205, 169, 210, 229, 126,  69, 154, 249, 202,  84,  24,   3, // ....~E...T..
- 134,  10, 189, 220,  38, 191, 197, 123,  34, 203, 155,  52, // ....&..{"..4
-   9, 119,  84, 131,  51,  97,  38,  44, 212, 100, 204, 162, // .wT.3a&,.d..
- 123,  42,   2, 248,  37, 138,  49, 255, 228, 148, 135,  43, // {*..%.1....+
- 174, 226, 194, 223, 212,  23,  93,  46, 119, 142, 155, 245, // ......].w...
-  51,   4, 173, 100,  61, 208,  18, 158,  92,  54, 183,  71, // 3..d=....6.G
- 248, 185, 144, 106, 188,  28,  35,  51, 240, 100, 147, 213, // ...j..#3.d..
-   8, 191, 186, 199, 113, 155,  94, 213, 212,  76, 230, 132, // ....q.^..L..
- 236,  70,  16,  99, 159, 149, 250,  17, 160,  53,  50,  62, // .F.c.....52>
- 240, 145, 217, 182, 241, 196,  25, 197,  63, 103, 226, 128, // ........?g..
- 205, 117, 127, 214, 230,  72, 208, 176,  47, 188, 163,  32, // .u...H../.. 
- 245, 100, 130,  64, 169, 115,  70, 167,  11, 214,  50, 113, // .d.@.sF...2q
- 108, 124,  81, 183, 105, 154, 212, 108,  11, 255,  12,  56, // l|Q.i..l...8
-  71, 141, 192, 135,  13, 161, 166,  88,  40,  62, 173,  17, // G......X(>..
- 115, 232,  81, 225,  97,  80, 229, 181, 103,  13, 148,  41, // s.Q.aP..g..)
- 248, 102,  29, 211, 234, 222,  84,  71,  86, 129, 149, 141, // .f....TGV...
-  98,  87, 128,  65, 233, 171, 179, 158, 169, 122, 192,  23, // bW.A.....z..
-  96, 197, 203, 109,  95,  61, 107,  61,  81,  32,  71, 133, // `..m_=k=Q G.
- 148, 184,  24, 240, 165, 142,  88,  30, 198, 163, 119, 187, // ......X...w.
- 201, 162,  89, 101,  78, 158, 180, 230, 201, 134,   7, 139, // ..YeN.......
- 108, 230, 123, 158, 112, 180, 174,  50,  62, 235, 149,  24, // l.{.p..2>...
- 221,  85, 167,   0, 140, 162, 123, 102,  21, 171,   7, 245, // .U....{f....
- 164,  87,  43, 162,  95, 174, 217, 217, 173, 137, 209, 172, // .W+._.......
- 171,  11, 238, 138, 181, 228,  10,  31,  17, 150, 206,  94, // ...........^
-  93,  53, 145, 125, 165,  12, 190, 131, 149, 150,  31, 159, // ]5.}........
- 185, 172,  60, 173,   0, 150, 232, 222,  89,  77, 110, 245, // ..<.....YMn.
- 161,  51, 246,  69, 123, 231,  99,  79,  78, 124,  62,  97, // .3.E{.cON|>a
- 209, 222, 181, 100, 218,  35,  70, 254,  14, 247,  62, 146, // ...d.#F...>.
-  93, 157, 142, 168, 190, 138, 209, 203, 233,  50,  92, 193, // ]........2..
- 131, 187, 235, 244,  20, 159,  20, 227, 236, 208, 216,  45, // ...........-
- 194,  36,  71,  74, 227,  34,  67, 153,  55, 248,  76, 121, // .$GJ."C.7.Ly
- 190, 172, 175,  47, 214, 141, 216, 125,  24, 138, 215, 101, // .../...}...e
-  82, 230,  69,  81, 110, 239, 241, 158, 147,  44, 180,  39, // R.EQn....,.'
- 206,  65, 161, 205, 161, 248, 245, 135,  86,  62, 194,  77, // .A......V>.M
- 205, 235, 216,  97, 175,   3,  15,   8, 232,  14,  66,  50, // ...a......B2
- 234,  44,  49, 149, 117,  90,  91,  12, 166,  97, 195, 198, // .,1.uZ[..a..
- 185,  40, 220, 149, 221, 156, 233, 250,  70, 223, 246, 205, // .(......F...
- 198, 143,  49,  73, 186, 187, 172,  88, 241,  97, 196, 156, // ..1I...X.a..
- 184, 163,  93, 199, 211, 135,  26,  16, 197, 187, 149, 123, // ..]........{
-  68, 222, 154, 138, 155,  61,  38, 145, 128, 118, 151, 161, // D....=&..v..
-  64, 111,  33, 107,  44, 170, 206, 138,  41,  21, 148, 226, // @o!k,...)...
- 179,   9, 128,   2, 252, 139, 247, 147, 204, 222,  17, 144, // ............
-  80, 181, 187, 110, 193,  39, 135,  37, 214, 200, 212,  42, // P..n.'.%...*
- 150, 160, 151, 239, 253, 194, 199, 192, 245, 206,  76, 109, // ..........Lm
-  30, 188, 218,  63, 158,  47, 155,  85, 106, 209,  44,  87, // ...?./.Uj.,W
-  81,  82,  81, 171, 100,  87, 145, 137, 155,  57, 157,  43, // QRQ.dW...9.+
- 133, 223, 211, 127,  23, 188, 133, 115,  62,  40, 244,  36, // .......s>(.$
- 172, 188, 248,  54, 121,  87, 149,  31,  28, 240, 255,  17, // ...6yW......
- 251, 137, 161, 198, 160, 142, 138, 158,  85, 184,  88, 133, // ........U.X.
- 217, 205, 231, 181,  33, 198, 134, 242, 110, 189,  56, 165, // ....!...n.8.
- 161, 117, 240, 225,   5, 235,  32,  61,  53, 166, 161, 156, // .u.... =5...
- 246,  76, 235, 117, 239, 169, 229, 181,  49, 235, 118, 111, // .L.u....1.vo
- 100, 189, 102, 165, 173,  39,  54,  15,  13, 189,  13, 129, // d.f..'6.....
- 212, 102, 133, 153, 192, 239, 209, 209,  69, 229, 106,   7, // .f......E.j.
- 219,  28, 230, 210, 168, 221, 245, 180,   5, 181, 154, 164, // ............
- 101, 190, 126, 142, 109, 209, 161, 117,  81, 185,  52, 108, // e.~.m..uQ.4l
- 119, 114, 142, 135,  15, 253, 235, 216, 213, 103, 190, 200, // wr.......g..
- 198,  17,  20, 215, 142,  40, 124, 108,  65, 158, 249, 125, // .....(|lA..}
-  99,  61, 234,  54, 162, 105,  38,  11, 171, 238,  85,  15, // c=.6.i&...U.
- 143, 191, 246, 186, 102,  84, 188, 228,   3, 112,  13,  42, // ....fT...p.*
- 227,  86, 159,  46, 232, 113, 167, 221, 179,  90,  60,  70, // .V...q...Z<F
- 182, 172,  98,   6, 132,  82, 143, 158,   8, 177, 197,  46, // ..b..R......
-  51, 167,  62,   0,  29, 231, 186, 198, 167, 213, 116,  89, // 3.>.......tY
- 149, 156, 216, 250,  20,  68, 195, 220, 135,  14, 149, 244, // .....D......
- 191, 235,  40,  35,  60,  23,  53, 240,  92, 221, 211,  23, // ..(#<.5.....
- 165,  83, 227, 251, 200, 166,  85, 249,  35, 187, 128,  29, // .S....U.#...
-  49,   7,   6, 230, 253,   8,  45, 114, 164, 242,  93,  41, // 1.....-r..])
- 208, 230,  64, 106,  10, 211, 145, 210,  24, 235,  18, 209, // ..@j........
- 163, 134, 103,  93, 197,  51, 213, 193, 252, 186, 118, 201, // ..g].3....v.
- 146, 244, 156, 249, 135, 105, 165, 230,  50,  53, 244, 157, // .....i..25..
- 107, 159, 172, 210, 136, 251, 196,  87,  79, 133, 121, 116, // k......WO.yt
- 189,  38,  13, 189, 202,  43, 152, 247, 177, 255, 158,  48, // .&...+.....0
-  25, 234,  12,  59, 109,  44, 126,   1, 134,  53, 101,  95, // ...;m,~..5e_
-  11, 126,  11, 128, 183,  93,  60,  75, 213, 107, 176, 113, // .~...]<K.k.q
- 207, 108, 195, 244,  13,  75,  31, 105, 233, 139, 209, 214, // .l...K.i....
-  99, 110,  33, 144, 235, 242,  41, 251, 254, 243, 106, 226, // cn!...)...j.
- 189, 146, 199, 125, 177,  97,  84, 239, 231, 221, 187,  65, // ...}.aT....A
- 222, 179, 255, 219, 155, 214, 102,  15,  21, 159, 164, 183, // ......f.....
- 162, 170, 251,  74, 117, 137, 142, 232,  18,  61, 107, 104, // ...Ju....=kh
-  78,  60,  30, 225,   5,  79,  11,  28, 144,  95, 110, 194, // N<...O..._n.
- 104, 189, 124, 233, 164, 193, 116,  83, 219,  93,  21, 113, // h.|...tS.].q
-  41,  42,  45,  35, 158, 234, 183, 190,  10,   2,  79, 222, // )*-#......O.
-  55,  16, 118, 202, 172,  66,   7, 152, 173, 171, 239,   7, // 7.v..B......
-   8, 199,  22, 143, 146,  46, 161, 175,  42, 146,  50,  92, // ........*.2.
-  86, 173, 120, 199, 157,  33, 145,  59, 169, 222,  22,  13, // V.x..!.;....
-  86, 232, 112, 168,  26,  66,  63,  87, 149,  59, 106, 252, // V.p..B?W.;j.
-  12, 115,  84,  90, 179, 143, 176, 188, 187, 173, 216,  56, // .sTZ.......8
-  44, 239,  69, 148,  49, 109, 200, 252, 160,  16, 119,  66, // ,.E.1m....wB
- 230, 157, 220,  42,  94, 135, 113, 184, 163, 134, 179, 177, // ...*^.q.....
- 117,   6,  93, 210, 115, 115,  75, 133, 183, 115,  70,  82, // u.].ssK..sFR
- 200,  27,  32, 106, 173, 122,  90, 178, 101, 235, 137, 101, // .. j.zZ.e..e
- 235, 137,  22, 192,  13, 201, 110,  47,  88, 146, 252, 244, // ......n/X...
-   5,  63,  88, 153, 229, 159,  51,  65,  46, 177,   9, 165, // .?X...3A....
-  60, 151, 170, 207, 163, 143, 239, 149, 209, 103, 189, 154, // <........g..
- 178,  60, 168, 169,  72, 112,  29,  13,  75,  27, 130, 236, // .<..Hp..K...
-  74, 178, 116,  23,  43, 223, 150,   7,  30, 121, 178, 152, // J.t.+....y..
- 138,   3, 234,  84, 228,  51, 177,  64, 148, 158, 152,  80, // ...T.3.@...P
- 149, 155, 173,  63,  69, 235, 146,  31, 248, 139, 253, 102, // ...?E......f
- 125,  49,  84, 122, 108, 110, 156, 247, 196, 253, 218,  19, // }1Tzln......
-   0, 117, 125, 245,  41, 246, 120,  39, 174, 203, 175, 204, // .u}.).x'....
-  48, 225,  26, 161,  43, 239, 247, 176, 218,  47, 206, 142, // 0...+..../..
- 115, 102, 197, 103, 125,  60,   0,  54, 201,  60, 183,  51, // sf.g}<.6.<.3
-  20, 181,  99, 200, 170,  86, 151, 201,  58,  47, 207, 228, // ..c..V..:/..
-   7, 246,  45,   8, 136, 138, 179, 206, 192, 234, 179,  59, // ..-........;
- 142,  14, 122, 188,   6, 138,  30, 155, 228, 247, 155, 183, // ..z.........
-   3,  54, 111,  68, 209, 239,  72,  49,  20, 235, 226,  63, // .6oD..H1...?
- 177, 110,  55, 203,  63, 108,  51,  83, 119,  17,  21, 201, // .n7.?l3Sw...
- 134,  86, 217,  67, 162, 154,  38, 233, 153,  85, 151,  55, // .V.C..&..U.7
-  99, 246, 153,  24, 179, 133, 247, 194,  53, 158,  65,  87, // c.......5.AW
- 157, 105,  30,  11,  81, 198,  42,  51, 117,  87,  44, 180, // .i..Q.*3uW,.
- 190,  82, 199,  91, 216, 208,  29, 215, 184, 155, 206, 148, // .R.[........
-  93, 149, 172,  89, 207, 213, 183, 127,  60, 171,  76, 161, // ]..Y....<.L.
-   8, 238, 145, 214, 199, 212,  41, 116,  60, 217,  40,  86, // ......)t<.(V
- 253, 137,  57,  90, 101,   7, 121, 152, 183, 147, 198, 155, // ..9Ze.y.....
- 219,  63, 222,  74, 177, 196, 186,  61,  19, 111,  95,  79, // .?.J...=.o_O
- 118, 133,  60, 179,   9,  36, 118, 172, 148, 120,  87,   0, // v.<..$v..xW.
- 122, 201,  64, 166, 103,  20,  84, 157, 130, 200, 234,  65, // z.@.g.T....A
- 206, 192,  63, 165, 213, 119, 111,  58, 194, 173, 229, 173, // ..?..wo:....
-  21, 179,  89, 243, 246, 139, 244,  84,  86,  95, 152, 237, // ..Y....TV_..
-  15, 217,  46, 194, 177, 159, 239, 115, 216, 191, 166, 233, // .......s....
- 173, 138, 158, 255, 131, 156,  47,  59, 222, 228,   5,  77, // ....../;...M
- 222, 141, 227,  23,   2, 115, 173, 172, 220, 163, 202, 166, // .....s......
-  63, 168, 203, 103,  58,  97, 109, 239, 143, 235, 134,  57, // ?..g:am....9
- 255,  57, 191, 127, 229, 151, 246,  18, 244, 133,  44, 236, // .9........,.
- 132, 176, 225, 126, 110,  78,  61, 121,  29, 142,  61, 168, // ...~nN=y..=.
- 114,  13,  84, 196,   3, 220,  58, 155, 160, 241, 136,   0, // r.T...:.....
- 106, 227, 208, 153, 101, 217, 120, 237, 204, 226, 105, 150, // j...e.x...i.
-  33, 126, 142, 211, 110, 183, 147, 109,  51,  56, 109, 184, // !~..n..m38m.
- 206, 180, 205,  25, 192,  46, 191, 178, 172,  87, 217, 221, // .........W..
- 181, 117,  23, 133, 159, 190,  73, 105,  26, 234, 237, 238, // .u....Ii....
- 208, 240, 169, 250, 203, 199, 100, 107, 113,   3, 129,  29, // ......dkq...
- 205, 210, 196, 122, 249,  24,  79,  38, 182, 189, 197, 190, // ...z..O&....
- 238,  67,  28,   6,  47,  31, 215, 124,  78, 237,  60, 147, // .C../..|N.<.
-  16, 141, 170,  60,  74, 190, 177, 113, 134, 232, 232,  91, // ...<J..q...[
-  26, 230, 165,  51,  11,  46, 159, 237,  87,  88,  60, 239, // ...3....WX<.
-  47,  75, 164, 194,  98,  19, 249,  79,  83, 254,  99, 122, // /K..b..OS.cz
- 151,  68, 220,  99, 194,  11, 247, 235,  19, 125, 163,  88, // .D.c.....}.X
- 207, 236,  83,  76, 237,  15, 183,  86, 209, 232, 231, 237, // ..SL...V....
- 213, 175,  94,  33,  29, 226, 233, 229, 137, 241, 162, 182, // ..^!........
- 111, 210, 108, 157, 135, 203, 228, 240, 160, 199, 242, 134, // o.l.........
- 249, 130, 150, 202, 172, 142,  89, 173,  40,  89, 110, 214, // ......Y.(Yn.
-  63, 134,  11,  90, 174, 112, 181,  26,  39,  88, 180, 116, // ?..Z.p..'X.t
- 107, 190, 180,  89,   5, 165, 181, 123, 197, 117,  45, 178, // k..Y...{.u-.
- 219,   8, 198, 113, 177,  78, 124, 245, 229,  99,  88,  95, // ...q.N|..cX_
- 168, 173, 172, 104, 202,  43, 144, 127,  11,  56,  41,  99, // ...h.+...8)c
- 195,  43, 130, 120,  98,  26,  90, 175,  91, 176,  45,  24, // .+.xb.Z.[.-.
- 146,  47,  31,  87,  91, 254,  65, 112, 147, 210,  16, 170, // ./.W[.Ap....
- 245,   9,  10,  41, 150, 101, 157, 166, 241,  58, 162,  39, // ...).e...:.'
- 129,  63,   4,  15, 170, 116, 122, 185, 253, 202,  28, 141, // .?...tz.....
-  87,  91, 103, 249, 249, 185, 239,  65, 213,  87,   8,  41, // W[g....A.W.)
-  79, 248,  48, 253, 221,  51,  78, 100, 198, 249, 215, 121, // O.0..3Nd...y
- 115, 234,  58, 227, 110, 117,   0, 107, 244,  23, 111, 205, // s.:.nu.k..o.
-  39, 105, 229,  78, 231, 209, 157, 233,  38, 139,  17,  16, // 'i.N....&...
- 202,  50,  40,  95, 244,  35, 253,  50, 110, 200,  80, 248, // .2(_.#.2n.P.
- 251, 126, 123,   5, 130, 176,  45,  25,  67, 188,  85, 236, // .~{...-.C.U.
- 121, 249, 184, 216, 106,   5,  76, 200,  46, 223, 126, 117, // y...j.L...~u
-  76, 227,  44, 190,  34, 188, 217,  29, 231,  58,  90, 199, // L.,."....:Z.
-  33, 193, 135, 127, 249,  50, 161,  72, 154, 112,  84, 198, // !....2.H.pT.
- 113,  74,  71, 183,  68, 128, 225, 102,  57,  94, 153,  99, // qJG.D..f9^.c
- 188, 184,  52, 142, 156,  60,  45, 107, 230, 204, 163,  12, // ..4..<-k....
-  95, 214, 205, 199,  51,   7,  52,  61,  94,  96, 246,  75, // _...3.4=^`.K
- 253, 194, 117,  46,  24,  70,  15, 254, 196, 225, 172, 154, // ..u..F......
- 156,  92, 230, 102, 223,  85, 124, 207,  58, 153, 100, 152, // ...f.U|.:.d.
-  60, 163, 243, 117, 128, 111,  24, 231,  38,  71, 213, 106, // <..u.o..&G.j
- 210, 110,  32, 211, 171, 124, 234, 244, 194,  51,  89, 160, // .n ..|...3Y.
-  76,  75, 127, 225, 200,  43,  77, 254, 202, 177, 145, 167, // LK...+M.....
-  70, 219, 141,  56, 169,  51, 178, 157, 235, 166, 131, 186, // F..8.3......
- 121,  85, 249, 170, 233, 249, 218, 252,  61, 167,  83,  65, // yU......=.SA
- 111,   9, 225, 107,  22,  84, 207, 158,  91,  80,  75, 225, // o..k.T..[PK.
-  74,  23,  42, 249, 179, 248, 187, 163,  70,  58, 153, 148, // J.*.....F:..
-  62, 217,  66, 168, 246,  38, 190,  66, 218,  23,  68, 167, // >.B..&.B..D.
-  61, 211, 252,  79,  55,   6,  24, 248,  60,  73, 130,  28, // =..O7...<I..
-  96,  70,   4,  75,  78,  35, 196,  39, 121,  29,  15,  95, // `F.KN#.'y.._
-  47,  17, 198,  16, 103, 213,   5, 163, 129, 204, 158, 158, // /...g.......
- 180,   2, 134, 151,  47,  48, 198,  92, 192,  30, 237,  71, // ..../0.....G
- 128, 254,  54, 175, 180,  89,  82, 149, 107, 165, 135, 229, // ..6..YR.k...
- 214,  98,  84,  44,  17,  47, 248, 122, 130,  89, 143, 237, // .bT,./.z.Y..
- 155, 104,  62,  15,  19, 194, 103,  96,  37,  48,  82, 176, // .h>...g`%0R.
- 118, 179, 181,  32,  86, 168, 166,  14,   0,  81, 116, 161, // v.. V....Qt.
-  68, 218, 227, 133,  82,  98,  72,  48,  37,  88,  85,  90, // D...RbH0%XUZ
- 177,  74, 245, 179,  37, 244,   1, 134, 244,  46, 178,  95, // .J..%......_
-  55,  30, 115, 250,  47,  99, 188, 124, 252, 105,  56, 130, // 7.s./c.|.i8.
- 249, 108,  55,  62,  12,  60, 231,  57,  94,  24,  26,   2, // .l7>.<.9^...
- 227, 215, 141, 175, 210, 123, 155, 193, 104, 216,  84, 122, // .....{..h.Tz
- 125,  77, 236, 187,  88, 117, 205, 223,  40,  44, 165, 196, // }M..Xu..(,..
-  48, 138, 177, 221, 150, 191,  55,  83, 215, 241, 201, 235, // 0.....7S....
- 213, 106, 250, 208, 142,  50, 254, 109, 172, 155,  79,  79, // .j...2.m..OO
- 118,  42, 217,  48, 243, 108, 158, 146,  13,  72, 191, 186, // v*.0.l...H..
- 253,  24,  62, 100,  84,  77, 130, 140,   7, 167, 239,  66, // ..>dTM.....B
- 103,  77, 242,  16,  73, 138, 118, 191, 165, 227, 240, 213, // gM..I.v.....
- 185, 208, 104, 216, 237,  35, 196, 129, 108, 188, 251,  31, // ..h..#..l...
- 231,  95, 217, 123,  42, 223,  31,  54, 143, 129, 224, 187, // ._.{*..6....
-  99, 160, 231, 222,  17,  67,  36, 168,  69, 115,  75, 135, // c....C$.EsK.
- 106, 191, 215, 207,  77, 185,  73, 238,  93, 102,  99, 226, // j...M.I.]fc.
- 127, 215, 251,  15,  39,  94,  16,  52,  56,  22, 147,  68, // ....'^.48..D
- 245,  28, 219, 142, 159, 167, 109, 153, 208, 208, 195, 247, // ......m.....
- 227, 119, 200, 220,  66, 115, 240, 222, 191, 199, 247, 241, // .w..Bs......
- 220, 242, 186, 202, 177, 165, 127,  75, 144, 146,   0, 142, // .......K....
-  84,  47,  86,  70, 182,  49,  66,  19, 232, 133,  60, 171, // T/VF.1B...<.
-  29,  16,  14, 173,  49, 206,  93,  54,  79, 118, 120,  49, // ....1.]6Ovx1
-  73,  39, 126, 148,  22,  83, 215, 185, 109,  48,   6, 116, // I'~..S..m0.t
-  66, 212, 202, 145,  34, 249, 134,  57, 193,  13, 195, 190, // B..."..9....
- 249,  97, 136, 137, 182,  98, 151, 172, 255,  87,  21,   2, // .a...b...W..
-  11, 219, 230,   4, 143, 230,  12, 161,  77, 140, 216,  40, // ........M..(
-  58,   5,  91, 224, 126, 112,  44, 151, 153, 210, 136,  37, // :.[.~p,....%
- 173, 244,  86, 126,  46, 183, 175, 226, 141, 185, 131, 195, // ..V~........
- 173, 200, 213, 120,  91, 167, 132, 187, 125, 108, 127, 246, // ...x[...}l..
-  17, 161,  24, 109,  23, 153,  35, 108,  37, 138,  36, 112, // ...m..#l%.$p
- 241,  66, 116, 186, 250, 240, 107, 154,  80,  61,  78,  18, // .Bt...k.P=N.
-  69,   8, 188,  82,  94,  30, 129,  33, 115, 108,  84,  82, // E..R^..!slTR
- 203, 146, 121, 195,  11,  59, 135,  97, 243, 152, 126, 156, // ..y..;.a..~.
-  12,  31,  34, 202, 218,  58, 118, 142, 147, 164, 110, 101, // .."..:v...ne
- 225, 119,  68, 212, 146, 155, 202, 109, 158, 184,  65, 144, // .wD....m..A.
- 213, 211, 113, 187,  77, 100,  75, 218, 185, 204,  41,  45, // ..q.MdK...)-
- 208, 237,  38, 224, 104, 146,  51, 250, 201, 242, 208, 245, // ..&.h.3.....
- 239, 157,  69,  48, 107, 109,  28, 124,  50, 125, 218, 242, // ..E0km.|2}..
- 134, 238,  97, 195, 107,  69, 141, 197, 169,  59, 105, 132, // ..a.kE...;i.
- 173,  77, 243, 120,  49,  70,  90, 144, 121, 144,  35, 103, // .M.x1FZ.y.#g
-  16, 190, 218,  76,  54, 227, 240, 116,  54, 153, 141, 241, // ...L6..t6...
-  25,  55, 207, 228, 135, 191, 226,  65, 121, 110, 157,  63, // .7.....Ayn.?
- 103,  62, 177, 189,  31,  71, 141, 158, 123, 212, 117,  15, // g>...G..{.u.
- 185, 242,  44, 205,  16, 243, 208, 121, 224, 203,  45, 115, // ..,....y..-s
-  57, 139,  18,  78, 175, 177, 117, 232, 129,  27, 186, 123, // 9..N..u....{
- 189,  13, 230, 200, 231, 113, 139, 100,  70, 105, 155, 168, // .....q.dFi..
- 225, 182, 145,  39,  41, 114, 157, 187,  32, 157, 152, 139, // ...')r.. ...
- 121,  96, 216, 127, 101,  71, 136,   7, 107,  21, 161, 254, // y`..eG..k...
- 173,   2, 144,  97,   9, 184, 205, 201,   4, 169, 132,   2, // ...a........
-  13,  79,  41,  31, 108, 110,  78, 194,  87, 193, 236,  36, // .O).lnN.W..$
-  60,  10, 122, 205, 140, 208, 120,  22, 111, 230, 248,  16, // <.z...x.o...
- 159, 160, 254, 193, 100, 171, 219,  75,   1, 101, 157, 185, // ....d..K.e..
-  69,  58, 106, 139, 205,  72, 215,  26, 245, 204, 183, 117, // E:j..H.....u
-  54, 244,  95, 163,  69,  39, 132,  24, 182, 161, 128, 235, // 6._.E'......
- 233, 230,  58, 124,  94, 220,  49, 235,  91, 169, 108,  40, // ..:|^.1.[.l(
- 185, 233,  93, 188,   3, 243, 154,  95, 163, 113, 213, 193, // ..]...._.q..
-  62, 194, 181, 106, 187,  45, 198, 201, 214, 213, 116, 101, // >..j.-....te
- 201,  57,  99, 166, 111,  31,  11, 154, 223,  18, 107,  42, // .9c.o.....k*
- 113, 134, 207,  55,  79,  50,   3, 130, 227, 122, 251,  37, // q..7O2...z.%
-  93, 224, 195, 195,  75,  81,  78, 111,  15,  14, 238, 120, // ]...KQNo...x
-   9,  74,  95, 167, 191, 227,  72, 178, 239, 131, 208,  89, // .J_...H....Y
-   5,  37, 252, 142,  17, 121, 162, 116, 158,  32, 192, 113, // .%...y.t. .q
-  30,  71, 120, 227, 172,  16,  57,  88, 206,   9,  91, 102, // .Gx...9X..[f
-  38, 172, 236, 105,  96, 190, 133, 229,  40,  26, 140, 239, // &..i`...(...
-  75,  66, 158,  12,  58, 210, 188, 177, 216, 183, 104,  22, // KB..:.....h.
- 255, 225,  41, 235, 177, 101, 145,  48,  32, 192,  95, 130, // ..)..e.0 ._.
- 110,  91,  80,  84,  47, 183, 249,  45, 134,  10,   9, 233, // n[PT/..-....
- 246, 253, 150, 127,  30, 182,   4, 157, 151, 143,  93, 119, // ..........]w
- 171, 101,  14,  35, 169, 113,  67,  53, 236, 252, 105,  53, // .e.#.qC5..i5
- 140, 196,  96,  26,  67, 219,  63,  41, 110, 238,   7, 166, // ..`.C.?)n...
- 185, 207,  43, 101,  89, 151, 219, 230, 182, 138,   1, 180, // ..+eY.......
-  62,  93, 108,  38, 192, 177,  53, 116, 172,  33, 222, 167, // >]l&..5t.!..
- 114,   4,   7, 232,  42, 157, 246,  60,   7,  55, 123, 190, // r...*..<.7{.
- 131,  75,  61, 159,   6,  12, 243,  74,   6, 202,  79, 215, // .K=....J..O.
-  22, 146,  63,  57, 172, 124,  78, 129, 240,  22, 235, 176, // ..?9.|N.....
-  65,  19, 166, 165, 216, 114,  51, 110, 115, 143, 197, 213, // A....r3ns...
-  83, 139,  11, 191, 226, 206, 218, 109, 184,  53,  79, 215, // S......m.5O.
- 250, 232, 203, 199, 204, 208, 100,  25, 253, 174, 159, 233, // ......d.....
-  58,  60,  90,  28, 251,  69, 247,   2, 144,  42,  36,  90, // :<Z..E...*$Z
- 216,  65, 194, 239, 168, 214,  53, 120, 180, 109, 128, 200, // .A....5x.m..
- 198, 138, 165, 227, 125, 128,  90, 212, 242, 188, 150, 127, // ....}.Z.....
-  40,  17, 219, 136, 184, 149, 187, 212,  49,  28, 141, 180, // (.......1...
- 196,  46, 216,  55, 194,  86,  62,  68,  64, 218, 177, 158, // ...7.V>D@...
- 109, 182,   9, 219,  43,  36,  81, 138, 182,  24, 134, 199, // m...+$Q.....
- 100, 147,  54, 133,  76,  62, 252, 209,  32, 233,  40,  72, // d.6.L>.. .(H
-   6, 207, 131, 164, 232, 223, 128, 134,  30, 120,   8, 250, // .........x..
- 195, 125,  72,  25,  79, 175, 194, 216,  88, 143, 187, 170, // .}H.O...X...
- 226, 135,  93, 211, 145, 136, 148, 196, 163, 235,  16, 241, // ..].........
- 146,  88,  36,  14, 168,  34,  50,  53,  34, 146,  12,  34, // .X$.."25".."
- 226, 111, 145,  74, 198,  44,  72,  90, 177, 179,   9, 106, // .o.J.,HZ...j
- 194, 145, 232, 155, 196,  74,  35, 125, 197, 233, 140,  79, // .....J#}...O
- 147,  73,  50,  78, 155, 173, 184, 121, 156,  65, 200,  64, // .I2N...y.A.@
- 112, 238, 227, 201,  37,  19, 209,  36,  18, 223, 103, 140, // p...%..$..g.
-  10, 147,  21,  46,  27, 137, 181, 136,  39, 171, 158, 140, // ........'...
- 151, 143,  52, 246, 195, 205, 246, 235,  19, 152, 220, 147, // ..4.........
-  75, 124,  98, 123, 205,   3,  28, 179,  13, 126,  41, 234, // K|b{.....~).
- 115, 173,  59, 102, 137,   6, 208, 123, 134,  83,   0,  52, // s.;f...{.S.4
- 221, 126, 189,  15, 162,  15, 141,  71, 177,  44,  67,  49, // .~.....G.,C1
-   9, 215, 206, 116,  54,  11, 151, 107, 210, 187, 217, 151, // ...t6..k....
-   4,  27, 147,  29, 198, 105,  97,  61, 174, 114, 187,  51, // .....ia=.r.3
- 114,  74, 186,  14,  25, 152,  28,  21, 102,   3, 120, 207, // rJ......f.x.
-  20, 222, 139,  29, 251,  49, 108, 194,   5, 160,  23,  73, // .....1l....I
- 131, 107, 114, 184,  38,  14, 174, 190, 115, 113, 175,  32, // .kr.&...sq. 
- 132,  39, 161, 176, 184,  21, 138,  26, 242, 102,  12, 177, // .'.......f..
- 119,  98, 171,  21, 128, 215, 211, 109,  85,  25, 231, 108, // wb.....mU..l
- 213, 113, 202, 174, 154,  89,  55,  47, 242, 182,  58, 249, // .q...Y7/..:.
- 177, 164, 206, 218, 150, 117, 203,  90,   4, 183,  23,  38, // .....u.Z...&
-  13,  12,  98, 248, 135,  80, 124,  62, 215, 148, 206, 100, // ..b..P|>...d
- 107, 108, 137, 218, 163, 142, 164, 162, 254, 142,  78, 127, // kl........N.
-  12, 167, 243, 112, 117,  18, 211, 227, 211, 249, 107,  81, // ...pu.....kQ
- 240, 191, 217, 144, 201, 188,  66, 252, 225, 184,  45, 235, // ......B...-.
- 177,  27, 160, 236, 114, 186, 140, 142,  65,  56,  84, 132, // ....r...A8T.
- 201,  78, 124, 120,  73, 250, 221, 220,  94, 158, 124,  75, // .N|xI...^.|K
-   4, 222,  78, 210,  79,  26, 138, 102, 133, 136, 180,  97, // ..N.O..f...a
- 182, 137, 215,  36,  23,  17, 144,  58, 148, 228, 196, 143, // ...$...:....
- 183, 225, 250,  38, 157, 143, 237,  31, 254, 246, 211, 207, // ...&........
- 182, 115, 149, 206,  31, 198, 164,  95, 138, 189,  10,  93, // .s....._...]
-  13,   9, 100, 210, 143, 116, 165, 100, 207, 186, 205, 182, // ..d..t.d....
- 198,  49, 147,  24,  70,  28,  96,  59, 210, 140, 227, 206, // .1..F.`;....
- 170, 125, 245, 176,  14, 207,  53,  62, 127,  14, 160, 131, // .}....5>....
- 131, 231, 225, 230, 216, 196, 144, 200,  62, 217, 144, 182, // ........>...
-  89, 164,  81,  67, 219, 185, 151,  77, 140,  81, 122, 146, // Y.QC...M.Qz.
- 168, 148, 147,  95,  47,  77, 174, 247, 131, 131, 252,  80, // ..._/M.....P
- 162,  79,  49, 214, 114, 158,  20, 133, 191,  24,  40, 164, // .O1.r.....(.
-  60, 239, 102,  78, 161, 197,  23,  82,   8,  42,  62,  28, // <.fN...R.*>.
- 210,  79, 152,  96, 128,  16, 198,  30,   7, 229, 136, 215, // .O.`........
- 105, 191, 227,  64, 245, 134, 104, 194, 193,  64,  34, 186, // i..@..h..@".
-  52, 110, 204, 219, 139, 228, 233, 105, 158, 143, 207,  12, // 4n.....i....
-  13, 104, 160, 249, 132, 115, 101, 166,   0,  73, 200, 224, // .h...se..I..
- 129,  85,  25, 172,  17, 212, 108, 171, 216,  77, 134, 125, // .U....l..M.}
- 201, 148,  89, 109, 107,  54,  73, 166,  58, 222, 108, 159, // ..Ymk6I.:.l.
- 179, 233, 158, 236, 239,  91, 188, 122,  88, 182,  59, 192, // .....[.zX.;.
-  92, 115, 211,  91, 226, 222,  16,  95, 155,  25, 231,  97, // .s.[..._...a
- 106,  44,  84, 232, 165, 199, 205, 201,  30, 173, 135, 184, // j,T.........
-  81,  93, 253, 224, 110,  10,  53, 180, 166, 186,  24,  15, // Q]..n.5.....
- 115, 126,  89,  45, 242,  66,  63, 250,  77,  63, 115, 186, // s~Y-.B?.M?s.
- 221, 214,  84, 154, 113, 125, 100, 175, 162, 219, 107,  43, // ..T.q}d...k+
-  91, 205, 196,  91,  96, 124,  32, 202, 163, 171,   3,  41, // [..[`| ....)
- 185,   4, 190, 130, 118,  36, 241,  68,  74, 129,  67, 174, // ....v$.DJ.C.
- 118, 168,  16,  17, 102,   2, 123, 211,  74,  23,  11, 219, // v...f.{.J...
-  73, 112,  36,  12,  24, 137,  92, 153, 209, 115,  46,  95, // Ip$......s._
- 241,  87,  35, 163, 175, 173, 223,  56,  59, 211, 192, 230, // .W#....8;...
- 111, 151,  73,  23, 181, 229, 163, 100,  18,  82, 246, 159, // o.I....d.R..
-  92, 216, 124, 179,  96, 115, 100, 211, 239,  34,  16,  39, // ..|.`sd..".'
-  23, 156,  95,  54,  49,  81,  59, 247,   2, 217, 196,  61, // .._61Q;....=
-  11,   7, 216, 141,  30,  75, 172,  15, 231,  90,  79, 227, // .....K...ZO.
- 112, 138, 231,  72, 200, 207, 175,  98, 205, 230, 114,   7, // p..H...b..r.
-  87,   9, 123,  43, 201,  78, 177, 231, 203, 229, 189,  57, // W.{+.N.....9
-  37, 213, 165, 200, 131, 244,  41,  74, 168,  27, 231,  62, // %.....)J...>
- 120, 152,  24,  39, 156, 132, 232, 191, 162,  43, 114,  83, // x..'.....+rS
- 206,  63, 209, 121,  50, 189, 139, 174, 167, 136,  33, 198, // .?.y2.....!.
- 140,  47, 199, 179,  11,  13, 212, 183, 104, 104,  66, 114, // ./......hhBr
-  19,  49,  71, 205, 114, 184, 242, 136, 237,  33,  18, 215, // .1G.r....!..
-  52,  74,  50, 118, 106,  72, 202, 122, 196, 139, 203, 155, // 4J2vjH.z....
- 249,  88,  14, 182, 243, 236, 163, 200, 255,  39, 110,  66, // .X.......'nB
-  14, 192, 107,  30,  62,  55,   9,  33, 144, 107, 136, 214, // ..k.>7.!.k..
- 154, 163,  39,  29, 217, 203, 123, 187, 168, 115,  86,  15, // ..'...{..sV.
- 248, 116, 223, 158,  17,  47,  94, 135,  26, 221, 169, 148, // .t.../^.....
- 213,  71,  39, 114, 112, 112, 209,  72, 145, 236,  86, 206, // .G'rpp.H..V.
-  57, 249,  32,  13,  35,  92, 173, 191, 225,  56,  45, 116, // 9. .#....8-t
- 147, 172, 140, 180, 232, 226, 101,  37,  97, 221,  25, 130, // ......e%a...
- 107, 221,  17,  15,  66, 162,  67, 116, 249,  19,  11, 131, // k...B.Ct....
- 127, 134, 211, 143,  23, 211, 101,   1, 192, 159, 121,  96, // ......e...y`
- 156, 212, 203, 152, 249, 178,  89,  18,  67, 101, 179, 143, // ......Y.Ce..
- 214, 152, 136,  99,  31,  37, 248, 109, 218,  39, 209, 139, // ...c.%.m.'..
- 224,  39,  77,  55, 205,  65, 146, 120, 198, 237,  66, 217, // .'M7.A.x..B.
- 139, 156, 159,  52,   5, 117, 212, 116, 220, 211,  53, 217, // ...4.u.t..5.
- 253, 167,  72, 205, 115, 154,  62,  61,  37, 167, 171,   9, // ..H.s.>=%...
-  22,  44, 110, 142,  63, 242, 143, 140, 236, 215, 242, 200, // .,n.?.......
- 156, 191,  84, 206,  94,   7, 143,  75,  36, 249, 190,  67, // ..T.^..K$..C
- 232, 182, 173, 243,  67, 240,  72, 244, 243, 218, 153,  73, // ....C.H....I
- 214, 114,  92,  43, 166, 242,  77,   1, 227,  61, 158, 223, // .r.+..M..=..
-  16, 119,  38,  63, 140,  95, 151,  86, 238, 219, 242,  19, // .w&?._.V....
- 251,  28, 192, 251,  30, 250, 177, 182, 148, 112,  92, 211, // .........p..
-  44,  85, 238, 185, 247, 131, 133, 252,  57,  13,  26,   9, // ,U......9...
- 194, 137, 173, 139, 132, 123,  18, 242, 143, 148, 197,  83, // .....{.....S
- 239, 164,  25, 158, 174, 223, 165, 193, 106,  18,  31,  37, // ........j..%
- 167, 167, 222, 248, 151,  70, 131, 142, 154, 164,  29, 191, // .....F......
- 159, 196,  65,  74, 122, 103, 154, 231,  55, 108,  33, 136, // ..AJzg..7l!.
-  21,  85,  79, 222, 183,  66, 210,  34, 227,  98,  48, 255, // .UO..B.".b0.
-  85,  12,  38,  15,  69,  22, 120, 200,  94,  64, 218, 214, // U.&.E.x.^@..
-  73, 122,  10,  60, 138,  79, 169, 169, 244,  40, 224,  88, // Iz.<.O...(.X
- 251,  26, 154, 241,  93, 106, 162,  40,  89, 121,  55, 173, // ....]j.(Yy7.
-  82,  80, 253, 183, 117, 124, 133, 124, 230,  16, 142,   9, // RP..u|.|....
-   7,  78, 151,  48, 217, 136, 103, 159,  78,  26, 225,  33, // .N.0..g.N..!
- 242,  61,  28,   7, 180, 174, 141, 240,  24, 199, 116,  65, // .=........tA
- 227,  30,  69, 164,  62,   7,  65,  60,   9, 211, 113, 184, // ..E.>.A<..q.
-  34, 142, 212, 224,  71, 126,  25, 255, 189, 217, 136,  26, // "...G~......
- 255, 141, 244, 106,  48, 149, 113, 117,  53, 249, 251, 248, // ...j0.qu5...
-  23, 185, 186, 198, 213,  77,  16, 198, 141, 216, 153,  54, // .....M.....6
- 137,  87, 241,  81,  17, 181, 153, 155, 228, 220,  54,  83, // .W.Q......6S
-  42, 169, 226,   3, 217, 216, 173, 105,  19,  24, 135, 164, // *......i....
-  11,  51,  92, 153,  57, 173,  12, 237, 208,  18, 248,  24, // .3..9.......
-   1, 233,  23, 155,  67, 162, 168,  96, 118, 184, 194,  64, // ....C..`v..@
-   3, 228,  79, 116,  54,  38,  11, 144,  51, 131, 139, 159, // ..Ot6&..3...
- 102,  93,  74, 185, 252, 215,  58,  20,  10, 176, 148,  66, // f]J...:....B
- 102,  34,  32,  29, 210, 116,   7,  46, 245,  47, 128,  73, // f" ..t.../.I
- 145, 125, 222,   5, 121,  62,  28,  28, 228, 205, 197,  13, // .}..y>......
-  19, 115, 110,  30, 222,  69, 179, 240, 135, 232,  62, 140, // .sn..E....>.
- 127, 132, 194, 113,  18, 190, 144, 124, 233,  65, 130, 188, // ...q...|.A..
- 160, 223,  54, 238, 152, 163,  56, 223, 224,  32,  96, 177, // ..6...8.. `.
- 120, 129,  20, 110, 141, 203,   6, 217,  38,  45, 150, 220, // x..n....&-..
-  27, 254, 168,   2, 182,  65, 171, 237, 186, 222,  22, 140, // .....A......
- 182, 105,  77, 147, 185, 213,  32, 187, 165,  94, 231, 168, // .iM... ..^..
- 168, 115, 217,  68, 211,  87,  28, 209,  17,  45,  51, 202, // .s.D.W...-3.
-  55,  56, 185, 218,  38,  35, 193,  33, 231,  31,   8, 118, // 78..&#.!...v
-  91,  85, 231, 254,  25,  60, 222,  34, 224,  66, 199,  89, // [U...<.".B.Y
- 146, 214, 222, 246, 182, 206,  27, 208, 229, 124, 236,  58, // .........|.:
-  89, 186,  80, 182, 205,  53, 136,  70, 255,  77, 149, 201, // Y.P..5.F.M..
- 126, 122, 195, 214, 211, 155,  18, 125, 126,  87,  64, 211, // ~z.....}~W@.
-  32, 246, 207, 141, 184,  57, 249, 155, 242, 207, 113, 227, //  ....9....q.
-  77, 155,  26,  37, 252, 121, 211,  70, 179, 132, 196, 174, // M..%.y.F....
-  52, 253, 166, 141, 198, 131, 206, 225, 139,  23, 137,  35, // 4..........#
- 213, 255,  93, 142, 190, 250, 125, 133, 245,  73,  64, 210, // ..]...}..I@.
- 112, 130, 108, 213, 121,  21, 211,  73, 158, 226, 132, 198, // p.l.y..I....
- 136, 236, 125, 112, 208,  16,  90, 127, 223,  72, 208, 183, // ..}p..Z..H..
- 227, 194, 145, 243, 125,  35,  53,  39,  83, 190, 115,  51, // ....}#5'S.s3
-  93, 205, 157,  86,  56,   5, 170, 226,  38, 159, 227, 116, // ]..V8...&..t
- 195, 183,  49,  88,  62, 157, 241,  93,  62, 229, 218,  11, // ..1X>..]>...
- 190, 141, 177, 163, 173,  37, 223,  53, 103, 243,  96, 221, // .....%.5g.`.
-  10,  73, 172, 134, 105,  99, 142, 116,  78, 196,  51,  65, // .I..ic.tN.3A
-  14,  14,  99,  63,   9,  84,  58,  73,  27, 215, 205, 214, // ..c?.T:I....
-  13, 162,  96, 135, 173, 209, 233, 252, 233, 233, 246, 212, // ..`.........
- 115, 193, 118, 231, 100, 135, 186,  47, 128, 120,  84,  98, // s.v.d../.xTb
-  91,  96,  30, 160, 138,  67, 120, 190,  56,  56, 216, 208, // [`...Cx.88..
-  29, 208, 197,  10,  24,  72, 151, 150,   7,   7, 179,  23, // .....H......
-  65, 139, 175,  69,  72, 151,  44, 139, 122,  23,  80, 139, // A..EH.,.z.P.
- 215,  79,  79, 112, 224, 126,   0, 133, 121, 174, 243,  11, // .OOp.~..y...
-  58, 189,   3, 213,  60, 128, 132,  64,  33, 173, 187, 195, // :...<..@!...
-   6,  97, 245, 124,   2,  76, 159, 180, 189, 177,  55,  94, // .a.|.L....7^
-  53, 157,  15, 199,  52,  18, 103, 212,  36, 241, 189,  57, // 5...4.g.$..9
-  13, 169, 145,  23, 232, 185, 209, 161, 159, 167, 167, 255, // ............
- 101, 237, 205,  23, 218,  70, 182, 125, 225, 255, 247,  83, // e....F.}...S
-  16, 111, 118, 142, 132, 203,  96, 155, 144,  65, 110, 225, // .ov...`..An.
- 155, 121, 232, 144, 137,  36, 157, 180,  55, 151,  45, 236, // .y...$..7.-.
-  50,  40,   8, 201, 145, 101, 134, 128, 223, 229,  60, 203, // 2(...e....<.
- 121, 178, 111, 253, 214, 170, 146,  74, 198,  36, 221, 231, // y.o....J.$..
- 126,  61,  96, 169, 102,  85, 173, 170,  90, 243, 186, 216, // ~=`.fU..Z...
- 102, 199, 146,  93, 126, 153, 109,  95, 248, 125,  29,  17, // f..]~.m_.}..
-   5, 119, 128, 111, 140, 212, 249,  54, 237,   9, 189,  29, // .w.o...6....
- 158, 247, 207,   3, 173, 189, 115, 117,  65, 221, 157, 113, // ......suA..q
- 119, 180,  13, 155,  78, 119, 133, 116,  23,  59, 221, 237, // w...Nw.t.;..
- 132, 197, 246, 144, 187, 155,  72, 119, 147, 171, 171, 225, // ......Hw....
- 246, 153, 233, 142,  94, 206, 182, 135, 126, 159, 190,  53, // ....^...~..5
-  24, 170, 227, 144, 154, 159, 170, 179, 237,  29, 186,  75, // ...........K
- 233,  36, 236, 239,   4,  52, 128,  29, 117,  86, 114, 120, // .$...4..uVrx
-  87,  14, 194, 240, 152,  38,  49,  12,  15, 168, 129,  99, // W....&1....c
-  80, 250, 116,   6,  28, 168, 227,  61, 190, 152, 190, 242, // P.t....=....
-  85, 244,  50,  45, 146, 245,  55, 179, 147,   3, 157,  63, // U.2-..7....?
- 163,  27,  46,  42,  60,  66,  79, 214,  19, 194, 104, 102, // ...*<BO...hf
-  64, 112,  27,  58, 109, 125, 218,  37, 196, 237,  57, 152, // @p.:m}.%..9.
- 205,  95,  17, 195, 231, 132,  57, 222, 234,  51,  51,   4, // ._....9..33.
- 212, 239, 225, 231, 245, 119,  47, 213,  43, 250, 137,  14, // .....w/.+...
- 166, 234,  59, 253, 142, 147,  44, 203, 213,  23, 122,  98, // ..;...,...zb
-  98,  92, 189, 167, 167, 161, 142,  19, 196, 161, 255, 204, // b...........
- 144, 169,  11,  60,  16, 104,  18, 101, 249, 121, 125,  66, // ...<.h.e.y}B
- 120, 146,  78, 233,   1,  10, 147,  74, 103, 244, 148, 100, // x.N....Jg..d
- 135, 180,  94, 132, 136, 243,  99,  87, 233,  56,   4, 132, // ..^...cW.8..
- 135,  29, 194, 237, 169, 163, 105, 156,  18, 189, 181,  65, // ......i....A
- 232, 131, 142, 194, 206, 134,  27,  21, 103, 234,  80,  15, // ........g.P.
- 157, 166, 215, 190, 162,  37, 247, 244, 255, 213, 219, 219, // .....%......
- 155,  29, 191, 229, 201, 111, 205, 183, 241, 204, 238,  29, // .....o......
- 187, 109, 181, 199,  55,  60,  72,  71, 183, 220, 208, 137, // .m..7<HG....
-  71, 187, 196,  51, 117,  95,   7, 236,  28,  87, 130, 246, // G..3u_...W..
- 140,  49,  93,  90, 233,  73, 104,  40,  18, 218,  66,  35, // .1]Z.Ih(..B#
- 246,  56,  42,  97, 103, 143,  66,  33, 254, 148,  62, 180, // .8*ag.B!..>.
-  37, 112, 235,  56,  31, 114, 226,  32, 109, 165, 191,  94, // %p.8.r. m..^
- 134, 163,  11, 124, 186, 234, 220, 241, 253,  53, 106, 245, // ...|.....5j.
-   2,  17, 178, 239, 184,   3,  61,  93,  90, 243, 253, 175, // ......=]Z...
-  43, 238,  47, 173, 248, 253, 215,  21,  47, 120, 113, 218, // +./...../xq.
-  18,  57,  96, 181, 138,  42, 186, 162, 141,  44, 173, 211, // .9`..*...,..
-  94,  91, 179,  18, 180, 149,  47, 116, 165,  38, 107,  94, // ^[..../t.&k^
- 167,  41,  96, 183, 254, 244, 221, 238, 203, 215, 111, 223, // .)`.......o.
- 248, 254,  70,  34, 147, 119, 206, 144,  89,  67, 228, 244, // ..F".w..YC..
-  65,  53, 251,  30, 194,  31, 234,  82, 148, 176, 222, 240, // A5.....R....
- 233,  62, 226,  48, 119, 150, 163,  87,  85,  59,  91, 188, // .>.0w..WU;[.
- 227,   6, 123, 116,  30, 166, 194, 212,  59, 240,  75,  41, // ..{t....;.K)
-  67,  76, 115, 159, 108, 199,  61, 184, 212,  55,  34, 149, // CLs.l.=..7".
-  87,  94, 204, 129, 102, 232, 227,  18,  65, 248,  10, 223, // W^..f...A...
- 145,  74, 180, 123, 169, 149, 122, 232, 158, 182, 213, 162, // .J.{..z.....
-  48,  29, 232, 189, 181,   4, 183,  62, 221, 223, 192,  15, // 0......>....
-  99,  58, 170, 219, 126, 211, 203,  41, 131,  94, 240,  67, // c:..~..).^.C
- 239, 138, 239, 245,   8, 215, 126,  38,  66, 140, 153,   4, // ......~&B...
-  88,  36, 216, 155,  81, 234, 220, 186, 236, 207, 100,  78, // X$..Q.....dN
- 118,  56, 130, 241,  49, 199,  46, 126,  29,  14, 202, 176, // v8..1..~....
- 169, 244, 250,  56, 172, 137,  54, 149,  94,  13, 205, 204, // ...8..6.^...
- 198,  83, 218, 222, 154,  40,  64, 103,  34, 119,  29,  48, // .S...(@g"w.0
- 190,  38, 203, 116, 102, 238,  99,  37, 199, 149,  88,  10, // .&.tf.c%..X.
-   6, 183, 114, 232, 136, 202, 247, 113, 175,   8, 229,  94, // ..r....q...^
-  34,  92, 145, 254, 138,  20, 183,  12, 181, 226, 180, 250, // "...........
- 195, 141, 169,  36,  13, 222, 190, 109, 101, 193, 206,  56, // ...$...me..8
- 248, 155, 159,  90, 113,  48,  97, 228, 239, 172,  95, 209, // ...Zq0a..._.
- 183,  99, 239,  83, 156,  22, 247, 249,  91, 221, 240,  97, // .c.S....[..a
-  15,  25,   8, 245,  71,  11, 192, 128,  69,   4,  68, 182, // ....G...E.D.
- 151,  34,  34,  71, 166,  35, 240,  97, 236, 151, 152,  34, // .""G.#.a..."
-  41, 162,  49, 121,   8,  86, 156, 200,  76, 150, 161,  17, // ).1y.V..L...
- 171, 245,  78, 105, 189, 109, 234, 118, 218,  75, 105, 189, // ..Ni.m.v.Ki.
- 217, 131,  49, 122, 165,  95, 144,  33, 236,  29,  52,  41, // ..1z._.!..4)
- 227,   8, 250, 165, 187,  80,  93, 115, 138, 252, 212, 119, // .....P]s...w
- 202, 244, 202,   8, 130,  24, 104, 221, 231,  50,  47, 248, // ......h..2/.
-  98,  47,  61, 219,  75, 185,  63, 157, 201, 125,  87,  45, // b/=.K.?..}W-
-  89,  25, 215, 174, 252,   2, 218, 132,  61, 139, 172, 111, // Y.......=..o
-  39,  18,  26, 211, 113,  17,  92, 243,  53, 154, 250,  88, // '...q...5..X
- 126, 248,  34, 237, 163,  81, 122,  80,  52,   4, 120, 208, // ~."..QzP4.x.
- 245, 253, 128,  41,  64, 251, 106, 215, 216, 172, 216, 163, // ...)@.j.....
- 208, 241,  61,  90, 247, 198, 221, 167, 137,  55,  92, 154, // ..=Z.....7..
- 138, 117, 101,  88,  99, 126,  80,  47, 171, 244, 147, 112, // .ueXc~P/...p
- 208, 120,  21, 165, 179,  40, 191, 104, 168, 198,  51, 125, // .x...(.h..3}
- 144, 155, 199,  29, 216,  67, 208, 239, 195,  73,  30,  39, // .....C...I.'
- 252, 142, 212,  87, 179,  84, 243,  79, 130, 183, 135, 179, // ...W.T.O....
- 195,  25,  92, 120,  55, 118, 245, 164, 208, 216,   9, 244, // ...x7v......
- 252, 150, 224,  84, 158, 222,  16,  33, 100,  18, 159, 232, // ...T...!d...
- 161,  60, 210,   7, 126, 160,  46, 119, 233, 190, 226,   6, // .<..~..w....
- 119,  50, 243, 240, 113, 166, 167, 242, 244, 135,  30, 165, // w2..q.......
- 246, 249, 227, 209,  44,  55, 143, 207, 242,  88,  30, 118, // ....,7...X.v
-  35, 154,   9,  60, 186, 174, 246, 221,  24,  98, 118, 213, // #..<.....bv.
- 219, 106,  83,  72,  67, 253, 103, 168,  63, 200,  81, 244, // .jSHC.g.?.Q.
-   2, 209,   5,  66, 253, 164, 122,  35, 172, 116, 135, 254, // ...B..z#.t..
-   9, 244,  19, 197,  63,  47, 213,  31, 244,  79, 160,  63, // ....?/...O.?
-  40, 254, 249, 211, 141,  36, 255, 201,  57,  28,  59, 237, // (....$..9.;.
- 109, 221, 111, 180, 161,  59, 226,  55, 205, 178,  16, 210, // m.o..;.7....
- 250, 149, 254,   9,  88, 218,  74, 155, 233,  25, 109, 128, // ....X.J...m.
- 175,  58, 130, 139, 120,  73, 245,  22, 146, 155,  28, 149, // .:..xI......
- 157,  71, 219, 245,  21, 143, 195, 222,  99, 235, 120,  27, // .G......c.x.
- 112, 121, 154, 164, 226, 200, 243, 247, 212,  98, 254, 181, // py.......b..
- 108, 238, 249, 147, 231,  38,  55,  59, 212, 112,  57, 162, // l....&7;.p9.
-  50,  81,  61, 121, 226,  22, 126, 194,   1, 127, 125, 245, // 2Q=y..~...}.
- 164,  44,  41,  41,  50,  25, 101, 159, 120,  27, 152, 236, // .,))2.e.x...
-  11, 116, 185, 152,  91, 203, 124, 241, 194, 237, 226,  69, // .t..[.|....E
-  70, 107, 137,  62,  94, 148, 125, 152,  36, 117,  20,  56, // Fk.>^.}.$u.8
-  18, 118,  39, 195,  33, 143, 138, 126, 167,  27,  20, 219, // .v'.!..~....
- 157, 110, 191, 104, 225, 105, 174,  30,  62,  68, 173,  78, // .n.h.i..>D.N
- 183, 214,  84, 191, 241, 112, 135, 150, 228, 221,  78,  67, // ..T..p....NC
-  69, 209, 210, 252, 232,   4,  17, 182, 193, 215,  90, 158, // E.........Z.
- 141, 220, 134,  58,  57, 169,  77, 101, 156, 206,  10, 205, // ...:9.Me....
- 131,  63, 169, 166, 210,  38,  42,  40,  70,  84, 133, 119, // .?...&*(FT.w
-  53,  29, 216,  35,  46,  60,  45,  11, 151, 137, 138, 104, // 5..#.<-....h
- 122, 254,  90,  14, 202, 220, 171, 128, 201,  51, 159, 190, // z.Z......3..
-  19,  39,   9, 237,  93, 219,   6, 129,  24, 193,  24, 161, // .'..].......
- 148, 219,  69,   9, 109, 197, 220,   5, 202, 103, 130,  77, // ..E.m....g.M
-  20,  64, 225, 245,  31, 165,  15, 247,   1, 194, 240, 110, // .@.........n
- 252, 251, 210,  27,  68, 173,  31, 123,  77, 255, 223, 243, // ....D..{M...
- 171, 193, 255, 189, 220, 107, 110,  28, 198,  54, 242,  67, // .....kn..6.C
- 182, 174, 207,  25, 221, 234, 249, 169, 220, 141, 141,  75, // ...........K
- 186,  28,  18, 162,  66, 233, 191, 190, 254,  54,  72,  88, // ....B....6HX
- 147,   6,   9, 229,  90, 216, 149,  74, 194,  70, 163, 114, // ....Z..J.F.r
-  92, 238,  94, 211,  96,  19, 208, 177, 221,  12, 175, 221, // ..^.`.......
- 123,  41, 162, 153, 227,  79, 128,  63,  60, 238, 234, 124, // {)...O.?<..|
- 149,  45, 244,  38, 244,  74, 116,  25,  32,   8, 190, 186, // .-.&.Jt. ...
-  32, 204, 190,  61, 206,  70, 111,  69, 133,   8, 199,  26, //  ..=.FoE....
- 229, 254, 153, 165, 132,   0, 190, 101,  68, 240,  95, 157, // .......eD._.
-  16,   1,  28, 191, 134, 131, 142, 234, 170, 238, 250, 150, // ............
- 218, 162,  19, 135, 112, 234,  51, 208,  37, 173, 206,  93, // ....p.3.%..]
- 133,  92, 137, 172, 193,  73, 109,  69, 105, 156, 242, 123, // .....ImEi..{
- 168,  63, 151,  49, 143, 223, 194,  57, 119, 136,  56,  10, // .?.1...9w.8.
- 144, 204, 208, 165, 241, 153,  18, 190, 135,  13, 222, 222, // ............
- 243, 134, 210,  95, 194, 198, 191,  83, 194, 142, 190,  43, // ..._...S...+
- 253, 158, 146, 119, 230,  27, 151,  79, 144, 222,  54, 233, // ...w...O..6.
- 239, 149, 238, 132, 186, 221, 108, 108,  92,  74, 133,  46, // ......ll.J..
- 149, 138,  34,  60, 109, 210, 211, 209,  60, 184,  60,  57, // .."<m...<.<9
- 153,  83,  65, 194, 185, 239, 154,  58, 155,  74, 223,   9, // .SA....:.J..
-  27, 193, 229, 116,  58, 111,  56, 235, 187,  85, 221,  54, // ...t:o8..U.6
- 172,  44,  67, 184, 210, 221,  54, 225, 135,  41, 126,  18, // .,C...6..)~.
-  90, 228, 238, 157, 181, 148, 144, 173, 205, 246,  90,  70, // Z.........ZF
- 100, 231, 230, 221, 173,  53, 203, 140,  25, 128,  35,  66, // d....5....#B
-  24, 179, 249, 212,  77, 124, 169, 243, 141, 129, 153, 150, // ....M|......
-  77, 153,  21, 223, 126, 237, 160,  80,  91, 212,  65,   7, // M...~..P[.A.
- 189, 116, 240, 180, 137, 167, 132,  18,  19,  36,  38,  72, // .t.......$&H
-  76, 144,   8,  53, 134,  46, 117, 190,  73, 255,  99,  16, // L..5..u.I.c.
- 119, 233, 255, 251, 244, 127,   7, 137,  25, 101, 101, 148, // w........ee.
- 149,  81,  86,  70, 117,  51, 202, 206, 212,  61, 250, 255, // .QVFu3...=..
-  62, 253, 255, 128, 254, 239,  96, 196,  29, 228, 228,  84, // >.....`....T
-  54, 167, 178,  57, 149, 205, 169,  92, 174,  98,  74, 137, // 6..9.....bJ.
- 169,  86, 140,  82, 244, 130, 167, 173,  54, 191, 210, 223, // .V.R....6...
-  61,  34, 176,   6,  49,  45, 137, 114, 226, 218,  47, 249, // ="..1-.r../.
- 211, 217,  83, 131,  46, 186, 107, 224, 144, 231, 133, 251, // ..S...k.....
- 121, 225,  76,  97, 233, 126,  81,  40,  85,  88,  65,  89, // y.La.~Q(UXAY
- 188, 142,  36, 235, 246, 178, 130, 148, 190, 249, 139,  34, // ..$........"
- 132, 231, 223, 161,  34, 205, 198,  10,  67, 128,  41,  89, // ...."...C.)Y
- 127, 189,  91,  21,  39,  72, 191, 211, 108, 172,  95, 210, // ..[.'H..l._.
-  41, 130, 175, 249, 139, 245, 246, 170,  80, 234,  37, 131, // ).......P.%.
-   3,  56, 177, 154, 169, 161,  26, 171, 137,  85, 229,  30, // .8.......U..
- 225, 212,  56,  10, 199, 219,  97, 172,  14, 241, 147, 223, // ..8...a.....
- 190,  29, 111, 143, 213,  73,  88,   0, 109,  62,   5,  42, // ..o..IX.m>.*
- 125,  66,  16, 184,  73, 180, 116,  88, 228, 222, 201, 194, // }B..I.tX....
-  37, 119, 212, 111,   7,  39, 206,  53, 163,  14, 175, 174, // %w.o.'.5....
- 142, 250,  29,  73, 179,  87,  12, 243,   4, 246, 185,  21, // ...I.W......
-  32, 134,  40,  98, 113, 221, 195, 254, 120,  35,  15, 104, //  .(bq...x#.h
- 158, 194,  35, 122,  66, 212, 212,  44,  60,  13, 195, 139, // ..#zB..,<...
- 254, 105,  64, 117, 168, 195, 253, 133, 235,  51,  85, 251, // .i@u.....3U.
- 238, 173,  70, 223, 234, 203, 240,  34,  38, 109, 184, 203, // ..F...."&m..
-  47,  94, 182, 161, 153,  63,  24,  45,  12, 119,  38,  41, // /^...?.-.w&)
- 166, 118, 121, 152, 229, 116, 152,  13, 193, 237, 204,  45, // .vy..t.....-
- 238,  22, 227,  99, 167, 205, 148, 224, 114, 214,  76, 232, // ...c....r.L.
- 111,   7,  61, 196, 173,   2,  36,  91, 204,  61, 250,  61, // o.=...$[.=.=
-  47, 195, 135, 121, 205, 184,  25, 201,  32, 124, 240,  24, // /..y.... |..
-  70, 114, 176, 102, 190,  19,  51,  32,  15, 179, 237, 113, // Fr.f..3 ...q
- 127,  28,  96, 187,  94,  52, 189, 239,  52, 183, 173, 239, // ..`.^4..4...
-  96, 152,  52, 137, 166,  60, 109,  93, 168, 220, 239, 153, // `.4..<m]....
- 122, 177, 112,  89, 142, 104,   1,  98, 240, 119, 142, 156, // z.pY.h.b.w..
- 203, 170, 121,  84, 187, 134,  54,  18,  73,  40, 175, 154, // ..yT..6.I(..
- 141, 148,  22, 110,  76, 127, 247, 195, 201,  70, 180,  30, // ...nL....F..
- 157, 235,  41, 130, 162, 239,  79,  39, 209, 208, 196, 141, // ..)...O'....
- 161, 207, 244,  98,  12,  59, 110, 142, 105, 251, 121,  29, // ...b.;n.i.y.
- 160, 235, 244,  45, 224, 241, 158, 108, 119, 172,   0, 151, // ...-...lw...
-  73, 211, 195, 230, 137, 186, 235, 251, 255, 234, 222,  65, // I..........A
- 248,  18,  26, 142,  51, 148,  22,  17, 160, 219,  29,  14, // ....3.......
- 169, 209, 162, 185, 137,  91,  97,  66,  39,   0, 145, 220, // .....[aB'...
-  84, 137, 107, 172, 223, 219, 198, 228, 196, 173, 209,  96, // T.k........`
-  84, 233, 223, 249,  27, 212, 171, 191, 182,  95,  78,  83, // T........_NS
- 108, 176, 249, 234, 213,  92,  15, 163, 249, 156, 185,  41, // l..........)
-   3, 125,  95, 233,   7,  74, 223,  35, 212, 120, 203, 163, // .}_..J.#.x..
- 174,   6,   5, 221,  34, 133,  42,  18,  78,   0, 123, 210, // ....".*.N.{.
- 161,  85, 138, 180, 198, 210, 211, 149,  42,  28,  43, 100, // .U......*.+d
-  73, 196, 133,  54, 135, 235, 184, 207, 127,  13, 113, 213, // I..6......q.
-  79, 130,   2,  71, 103, 202,  49, 226, 244, 224, 254,  30, // O..Gg.1.....
- 165, 104, 186,  11, 155,  73, 141, 167,  81, 100, 110, 251, // .h...I..Qdn.
-  94,  34,  18,  16,  34,  97, 205, 126, 114, 182,  24,  56, // ^".."a.~r..8
- 117,  37,  97,  20, 111,  83, 163, 116, 167,  18,  61,  52, // u%a.oS.t..=4
- 168,  24, 251, 101, 152, 237, 212, 234, 173,  90,  18,  16, // ...e.....Z..
- 226, 117, 112,  27, 235, 224, 155,  73, 138, 221, 107, 185, // .up....I..k.
- 188,  26, 188,  45, 150, 183,  18, 195,  50, 101,  75, 156, // ...-....2eK.
- 229,  80,  18,  42, 188, 228,  36,  76, 111, 133, 209, 237, // .P.*..$Lo...
- 219, 163,  65, 151, 136, 252, 236,  86,  56, 197, 243,  38, // ..A....V8..&
-  61, 231, 183,  32, 227,  30,  13, 238, 208, 115, 124,  43, // =.. .....s|+
-  28, 226, 121, 139, 158, 143, 152,  91,  55,  26, 220, 165, // ..y....[7...
- 231,  67, 102, 165, 141,   6, 247, 232, 121,  52, 168,  62, // .Cf.....y4.>
- 133, 246,  33, 109, 188, 140, 182,  90, 174, 134, 116, 170, // ..!m...Z..t.
- 140, 195,  35,  53,   9,  15, 213, 137, 151, 112, 184, 143, // ..#5.....p..
- 106,  42, 243,   5, 246,  80, 185, 127,  37, 217,  41,  25, // j*...P..%.).
-  47, 155, 116, 195, 241, 129,   0, 160, 209, 106,  53, 104, // /.t......j5h
- 253,  52,  72, 205,  57,  93, 113,  93, 213, 218, 218,  84, // .4H.9]q]...T
- 244,  31, 141,  75, 182,  83,  17, 133, 151, 211, 163, 236, // ...K.S......
-  12, 129, 124,  18, 145,  10, 169, 152, 112,  11, 234,  46, // ..|.....p...
- 184, 213,  81,  28,  89,  36, 144, 240,  92,  10, 158, 161, // ..Q.Y$......
- 117,  62,  13, 202,  10, 162,  21, 211,  85,  70, 157, 109, // u>......UF.m
-  89, 160,  13,  68,  60, 201,  99, 141,  40,  19,  85,   8, // Y..D<.c.(.U.
-  40, 174, 215,  79, 214, 165,  30,  23,  15, 146, 245,  73, // (..O.......I
-  22,  35,  94, 186, 205,  52, 175, 110,  25,  86, 247, 128, // .#^..4.n.V..
-  43, 194, 100, 161, 175, 138, 220, 177, 157, 225, 110,  79, // +.d.......nO
-  56, 115, 174,  70, 176, 147, 109, 208,  71, 197, 163, 198, // 8s.F..m.G...
-  92, 197, 163, 115,  97, 130, 211, 195,  84, 158,  88,  67, // ...sa...T.XC
-  96,  26,  12, 246, 230, 170, 152, 134,   3,  66,  16,  28, // `........B..
- 130, 170, 152,  89, 134,  14,   2, 112,  95,  58, 184,  31, // ...Y...p_:..
-  56, 198, 235,  98, 165,  64, 251, 133,  67, 210, 179, 194, // 8..b.@..C...
-   2, 179, 144,  57, 230, 148, 179,  84, 195, 155,  90,  89, // ...9...T..ZY
-  94, 145, 215, 102,  92, 173, 205,  57, 254,  92, 240,  42, // ^..f...9...*
- 193,  54, 149, 151, 230, 180,  62, 229,  14, 196,  20,  80, // .6....>....P
-  87,  65, 228, 101,   4, 135, 135, 252, 104,  58,  87,  50, // WA.e....h:W2
- 159, 102, 241, 150,  47, 213, 144, 118,  72, 150, 155, 153, // .f../..vH...
- 167, 145, 174, 154, 221,  51, 141, 127, 200,  10, 244,  94, // .....3.....^
- 123,   0,  49,  58, 127, 241, 128, 237, 221,  19,  22,  84, // {.1:.......T
- 203, 139,  55, 186, 146, 221,  32,  48,  57, 140, 211, 215, // ..7... 09...
-  44,  40, 143, 164, 164,  73, 251, 152,  77, 144, 100, 226, // ,(...I..M.d.
- 119,  24,  56, 224, 161, 199,  37, 246,  75, 123, 141, 107, // w.8...%.K{.k
-  28, 112,   0, 224,  63,  68,  28, 143, 120, 150, 115, 133, // .p..?D..x.s.
-  97, 252, 122, 225,  45, 220,  80, 225, 185, 129, 208, 246, // a.z.-.P.....
-  95, 132,  80,  83, 183,   2, 212, 125, 169,   7,  17, 247, // _.PS...}....
-  62,   0, 106,  41, 240, 253, 133, 102,  80, 139,  27, 145, // >.j)...fP...
- 246, 230, 115, 133,  16, 120, 132, 248, 150,  38,  64, 197, // ..s..x...&@.
-  76,  89, 219,  32, 122,  20, 197,  45, 122, 176,  74,   0, // LY. z..-z.J.
- 101,  62, 175, 122,  49,  84, 149, 178,  64, 249, 198, 154, // e>.z1T..@...
-   4, 244,  70,   0, 159,  71, 135, 180, 208, 116, 166, 193, // ..F..G...t..
- 245, 171,  11,  62,  29,  40, 136,  21,  52,  33, 179,  52, // ...>.(..4!.4
-  22, 216, 151, 230, 173,  18,  75,  65, 251,  45, 155,  32, // ......KA.-. 
- 246,  88, 116,  24, 137, 206, 132, 146, 180, 151,  39,  39, // .Xt.......''
-  16, 152,  21, 186, 150,  57,  87, 251, 231, 104, 117,  31, // .....9W..hu.
- 109, 211, 236, 100, 195,  25, 129,  24, 247,  97, 225,  93, // m..d.....a.]
- 101,  56, 144,  90,  25, 162, 141, 157,   7, 173,  14, 125, // e8.Z.......}
- 122,  52, 133,  92, 235, 136, 245, 209,  46, 167, 199, 241, // z4..........
-  36,  24,  72,   4, 158,  61,  41,  36,  90,  11, 166,  24, // $.H..=)$Z...
-  52,  46, 168,  90,  91, 193, 143,  52, 126, 203,  13, 140, // 4..Z[..4~...
- 208, 100,  47, 175, 239, 102, 214,  16,  50, 103,  69,  49, // .d/..f..2gE1
- 169, 182, 144, 129, 129,  70, 126, 120,  16, 121,  32,   2, // .....F~x.y .
- 232, 223, 245, 246,  61, 191,  97, 207,  49,  42,  62,  10, // ....=.a.1*>.
- 245,  59, 239,  18, 245, 212, 165, 113, 121, 170,  39, 115, // .;.....qy.'s
-   4,  46, 181,  25,  35, 117, 201, 112, 216, 105,  35, 249, // ....#u.p.i#.
- 208,  41,  47, 253, 116, 144, 124,  18, 254,  87, 167,  59, // .)/.t.|..W.;
-  57,  95, 153,  94,  76,  11, 125, 210, 154, 197, 106, 165, // 9_.^L.}...j.
-  21,  77,  38, 137, 110,  73, 138,  90, 105, 236, 234, 195, // .M&.nI.Zi...
-  76, 175, 124, 122, 217,  80,  43,  31, 178, 131, 172, 200, // L.|z.P+.....
-  40, 237, 133,  38, 154,  14,  46, 145,  87, 222, 104, 196, // (..&....W.h.
- 222,  92, 121, 152, 199,  81,  66,  25, 111,  40, 127, 101, // ..y..QB.o(.e
-  55,  74, 167, 148,  54, 165, 159,  22,  96, 109,  76,  25, // 7J..6...`mL.
-  15, 209, 232,  10,  27, 218, 175,  60,  61, 201, 190, 197, // .......<=...
-  13, 167, 233,  37,  41, 187,  23,  39,   7,  89, 210, 176, // ...%)..'.Y..
-  77, 186,  21, 255,  75,  21, 167,  80, 117,  73,  70, 132, // M...K..PuIF.
-  56,  23,  39, 170, 216, 119, 166, 142, 225, 168, 113, 222, // 8.'..w....q.
- 176, 147,  56,  83, 140,  58,   5,  91, 109, 117,  24,  77, // ..8S.:.[mu.M
- 130,  45, 217, 155, 244, 198, 154,  52, 207,  41, 201,  60, // .-.....4.).<
- 238,  34, 125, 211, 188,  60, 163, 251,  57,  40,  78, 169, // ."}..<..9(N.
- 240,  72, 211, 181, 113, 152, 199, 163, 128,  38,  84, 204, // .H..q....&T.
-  39, 138,  35,  37, 123,  62,  40,  14,   9, 144,  80, 242, // '.#%{>(...P.
-   4,  30, 247,  52,  90, 235,  16, 253,  42,  90, 175,   1, // ...4Z...*Z..
- 199, 181,  91,  54, 180, 104,  86, 100, 128,  69,  58, 194, // ..[6.hVd.E:.
-  10,  61,  10,  58, 172, 117, 170,  35,  22, 155, 182, 232, // .=.:.u.#....
- 151,  33, 132, 206, 120, 231, 104,  63, 175, 157,  34, 165, // .!..x.h?..".
- 249, 141,  21, 120,  54,  26, 193, 115, 112,  73, 157,  99, // ...x6..spI.c
- 252, 160,   2, 107,  62, 255,  12,  11, 158, 136, 133, 105, // ...k>......i
- 168, 207,  89, 145,  35, 131, 109, 134, 195, 182,  79, 194, // ..Y.#.m...O.
-  24,  56,  19, 139, 227, 136,  72, 245, 193, 128,  79, 183, // .8....H...O.
-  37,  42,  43,  37,  54,  51,  74, 240,  35,  65, 243,  12, // %*+%63J.#A..
- 247,  57, 158,  82,  55, 173, 182,  79,  68,  68, 165, 199, // .9.R7..ODD..
-  18,  57, 195,  56, 115, 118, 151,  65, 164,   7,  28,  33, // .9.8sv.A...!
- 109, 157, 231,  99,  58, 208, 130, 228, 210,  97, 196,   9, // m..c:....a..
- 123,  16, 106,  17, 162, 254, 221, 243,  32, 235, 143,  69, // {.j..... ..E
- 125, 192, 135, 157,  69,  47, 131, 172,  50, 198,  81, 205, // }...E/..2.Q.
-  89, 183, 111, 139,  22,   0, 227, 240,  25, 107,   1, 216, // Y.o......k..
-   3, 187,  55, 202,  86, 114,  25,  40, 157, 200, 211, 102, // ..7.Vr.(...f
- 152, 217,  42, 222,  20, 165, 167, 170, 156,   2, 162,  50, // ..*........2
- 178, 181, 120, 123, 122, 117,  69,  13, 209,   7, 159,  29, // ..x{zuE.....
- 197,   9, 161,  33, 219, 244, 108,  62,  39, 119,  62, 103, // ...!..l>'w>g
- 231, 250, 231, 220, 252,  37,  44, 139, 163, 111, 133, 246, // .....%,..o..
- 139, 153,   8, 234,  50, 135,  12,  30, 245, 131,  65, 190, // ....2.....A.
-  71,  95, 202,  90,  50, 201, 118, 187,  63, 216,  11, 232, // G_.Z2.v.?...
-  50, 180, 236, 165,  86, 190, 157, 212, 106, 181,  82,  95, // 2...V...j.R_
- 181,  18,  83,  15, 140,  21,  58, 148, 166, 224,  19,  27, // ..S...:.....
-  88, 104, 233, 146,  25,  64,  32,  36,  92, 212, 226,  56, // Xh...@ $...8
- 220,  88, 223,  80, 197, 235, 112,  99, 208, 233, 110, 110, // .X.P..pc..nn
- 221, 219, 163, 151, 199, 252, 178, 133, 199, 213, 112, 163, // ..........p.
-  67,  63, 187, 161,  19, 205,  76,  91, 203,   7,  28, 135, // C?....L[....
- 119,  88, 171, 161, 205, 161, 151, 179, 127, 165,  97, 216, // wX........a.
- 134,  54,  18, 161, 163, 132, 171, 173,  23, 217, 211, 115, // .6.........s
- 209,   7, 165, 205, 239, 249, 131, 166, 215, 222, 214,  62, // ...........>
-  24, 227, 129, 232, 219,  86, 243, 246, 177,  46, 132,  55, // .....V.....7
-  83, 149, 128, 223, 149, 202, 116,  41, 103,  38,  37, 134, // S.....t)g&%.
-  30, 244,  33,  63, 102, 239, 178,  41,  40,  67,  67,   2, // ..!?f..)(CC.
-  17, 240, 198, 224, 127, 100, 160,   4,  99, 239,   1,  61, // .....d..c..=
- 180, 166, 191,  69, 253, 216, 187,  87,  61, 110, 217, 199, // ...E...W=n..
-  98,  53,  40,  30,   7, 197, 235, 160,  56,   6, 217,  58, // b5(.....8..:
- 163, 143,  89, 181, 244, 209,  43, 143,  26, 226, 130,  76, // ..Y...+....L
- 210,  70,  52, 114, 187, 187, 118, 189, 194,  10,  33, 170, // .F4r..v...!.
- 105,  86,  57, 212,  38,  10, 162,  38, 213, 123,  47,   2, // iV9.&..&.{/.
- 117,  90, 229, 205, 157, 154,  78, 185, 142, 187,  31, 127, // uZ....N.....
- 252, 149,  25,  40,  63, 115, 225, 243, 203, 193, 198, 132, // ...(?s......
-  25, 103, 149,  20,  59, 223, 166, 143,  92,  62, 220,  77, // .g..;....>.M
-  85,  28, 211,  72, 243, 141, 200,  29, 105, 224,   8, 156, // U..H....i...
- 138, 167, 215, 212,  50, 228,  60,  73,   5,  29, 151, 151, // ....2.<I....
-  66,  14,  23, 163,  75,  86,  60, 188, 118, 160,  93,  92, // B...KV<.v.].
-  59, 107,  55, 255, 247, 103, 237, 230, 255, 195,  89, 251, // ;k7..g....Y.
- 142, 134, 198,  67, 226, 203,  85,  14, 217, 182,  61, 100, // ...C..U...=d
- 219,  11, 135,  44, 149, 127,  20, 214, 110, 254,  76,  21, // ...,....n.L.
-  79, 170, 143, 187,  86, 157, 190, 136, 134, 243,  72,  69, // O...V.....HE
- 201, 228,  40, 162,  51, 123,  76,  95,  74,  88, 234, 192, // ..(.3{L_JX..
-  92, 171, 239, 212, 101, 121, 192,  35,  76, 224,  98, 234, // ....ey.#L.b.
-   5, 165,   2, 107, 255,  16,  86,  41, 215,  59,  41, 167, // ...k..V).;).
- 118,  18, 165, 207, 209,  33, 221,  18, 139,  29,  47,  71, // v....!..../G
- 143,  45, 104, 217,  41, 144,  75,  36, 155,  19,   5, 107, // .-h.).K$...k
- 208, 189,  54, 164, 187, 197, 250,  62, 144,  17, 188, 196, // ..6....>....
-  18,   9, 152,  65, 204, 203,   7, 208,  99, 218, 163, 169, // ...A....c...
-  32, 164, 223,  66, 215,  43, 111, 161,  68, 199, 150, 104, //  ..B.+o.D..h
- 197, 254, 134,  87, 182, 156,  84, 184,  44, 214, 127,  77, // ...W..T.,..M
- 251, 219,  33,  10, 183, 208, 230, 220, 122, 100,  23,  60, // ..!.....zd.<
- 199,  80,  48, 162,  55, 180, 244, 218,  83, 176,   9,  41, // .P0.7...S..)
-  81, 190, 137, 212, 115, 142, 146,  23,  11,  36,  68, 178, // Q...s....$D.
-  65,  24,  14, 195, 230, 159, 225,  37, 152, 203, 238, 242, // A......%....
- 241,  86, 164,  73, 163,  75, 133,  16,  33, 197,  39, 178, // .V.I.K..!.'.
- 185, 112, 101,   8, 145,  69, 209,  98,  20, 203, 242, 152, // .pe..E.b....
-  65, 233, 165, 197, 150, 254,  84, 166,  73, 201,  99, 156, // A.....T.I.c.
- 233, 143, 240, 210,  29, 207, 167, 138, 215,  91, 252,  49, // .........[.1
- 208,  37, 245,  40,  70, 187, 151, 199, 250,  34, 208, 106, // .%.(F....".j
- 146, 100,   5, 127, 220, 116, 198, 210, 250,  98, 157,  83, // .d...t...b.S
- 172, 137, 222, 156, 208, 220, 122,  78, 104,  75,  24, 214, // ......zNhK..
- 111,  17, 110,  23,  96, 244,  16, 121, 132, 114, 213, 197, // o.n.`..y.r..
-  78, 215,  97, 169,   0,  56,  13, 219,  61,  91, 207,  48, // N.a..8..=[.0
- 246, 167, 189, 105, 179, 233, 155, 196, 193, 116, 143, 245, // ...i.....t..
-  73, 171, 215, 245, 235, 173,  17, 206,  95,  74, 159,  61, // I......._J.=
- 254, 162,  16, 122,  73, 238, 193, 241, 109, 241,  44,  99, // ...zI...m.,c
- 213, 166, 204,  37,  45,   8, 214, 186,  56,  73, 180,   1, // ...%-...8I..
- 184,  98,  47,  48, 143, 206, 229,  79,  39,  27, 209, 165, // .b/0...O'...
-   7, 217,  57,  29, 235,  57,  96, 114,  38, 149, 114,   2, // ..9..9`r&.r.
- 158,  32,  71,  43,  67,  73, 136,   7, 217, 186, 108,  56, // . G+CI....l8
-  42, 101, 174, 215,  32,  30, 232,  10, 182,  77, 162,  26, // *e.. ....M..
-  95, 171, 208, 113,  42, 100, 182, 216,  36, 140, 214, 129, // _..q*d..$...
- 175, 171,  17,  61,  16, 190, 174, 142, 232, 151, 177, 107, // ...=.......k
- 117,  72,  79, 162,  82, 173,  78, 156,  83, 248,   5,  88, // uHO.R.N.S..X
- 169, 229, 219, 103,  71, 204,  53,  92,  39, 208, 232,  39, // ...gG.5.'..'
- 132, 130,  88, 206, 209, 137,  58,   5, 247,  72,  81,  99, // ..X...:..HQc
- 170, 120, 165, 138,  47, 170,  32, 170, 160, 171, 138, 187, // .x../. .....
- 126, 224, 150,  59, 165, 146,  35,  42, 121,  72,  37, 139, // ~..;..#*yH%.
- 239, 170, 120, 175, 138, 142,  42, 232, 228, 118,  53,  72, // ..x...*..v5H
- 138, 103,  46, 245,   6,  70,  43,  88, 172, 111,  56,   4, // .g...F+X.o8.
- 118,  58,  34,  76, 230, 184, 174, 122, 145,  45,  81, 189, // v:"L...z.-Q.
- 200, 105,  63,   2,  50, 171, 249, 194, 193, 142, 136, 176, // .i?.2.......
- 128, 251,  50, 185, 179,  39,  74, 140, 233,  21,  52,  73, // ..2..'J...4I
-  57, 179, 223,   9, 186, 246, 126,  27,  36, 138,  21,  76, // 9.....~.$..L
-  91, 148, 134,  95, 250,  89, 243,  54,  17, 244, 212, 209, // [.._.Y.6....
- 156,  44, 222,  44,  69, 145,  74, 184, 112,  80, 191, 110, // .,.,E.J.pP.n
- 104,  64, 167, 159,  47,  46,  22, 198, 196,  43,  85, 169, // h@../....+U.
- 168,  66, 123,  52, 134, 138,  84,  96,  31, 105, 239,  82, // .B{4..T`.i.R
- 239, 177, 220, 183,  48,  53, 143, 121, 196,  82,  72, 242, // ....05.y.RH.
- 219, 206, 192, 222, 186,  24, 113, 133,  75,  11,  48,  11, // ......q.K.0.
- 113, 175, 106, 220,  63, 117, 100, 153, 130, 135,  88,  82, // q.j.?ud...XR
-  26, 236, 228, 252,   3, 171, 109, 237, 135, 180, 238,  17, // ......m.....
- 175, 123, 241,  37,  40, 222, 247,  58, 120, 165, 206,  89, // .{.%(..:x..Y
- 133,  77,  50,  58,  68,   3, 250, 125, 239,  48,  76, 192, // .M2:D..}.0L.
- 167, 243,   3, 122,   2, 115,  55,  17,  36, 245,  34,  60, // ...z.s7.$."<
- 245, 102,  94,  49,  56,  36,  20, 144, 122,  26, 251,  80, // .f^18$..z..P
- 168,  59, 245, 134,  94, 140, 164,  41,   1, 196, 196, 135, // .;..^..)....
-  73, 128, 148,  58, 169,  74, 157, 113,  41, 214, 154, 157, // I..:.J.q)...
- 242,  39,  78,  89, 109, 204, 214, 216,  97,  38, 250,  59, // .'NYm...a&.;
-  58,  66, 187,  79,   8, 187, 181, 211, 183, 239, 237, 168, // :B.O........
-   3, 117, 230,  43,  60,  92,  84,  15, 231,  84, 195,  13, // .u.+<.T..T..
-  56,  94, 124, 173,  79, 146, 112, 210,  89, 243,  30, 218, // 8^|.O.p.Y...
-  26, 165,  45, 179, 127,  25,  59,  29,  25, 222,  10, 139, // ..-...;.....
- 124, 139, 118,  64,  64,  12,  28, 188,  84, 155, 112, 245, // |.v@@...T.p.
-  67, 138,  94,  97, 129,  50,   9, 161,  46, 129, 118,  33, // C.^a.2....v!
- 178, 220, 102, 137, 165,  65, 206, 240, 220, 154, 246, 244, // ..f..A......
-  54, 161, 155,  17, 161, 252,  83,  26, 143,  86, 105,  51, // 6.....S..Vi3
- 135,  72,   0, 165, 133, 239,  52,  11, 147, 102,  70, 229, // .H....4..fF.
- 102,  78, 185, 214,  22,  45,  32, 149, 108, 118, 218,  37, // fN...- .lv.%
-  94,  22,  59,  31, 248, 252, 103, 116, 145,  25, 101,  57, // ^.;...gt..e9
- 244,  89, 200, 176, 150,   4,  41, 245, 129, 147, 147, 232, // .Y....).....
- 130,  89, 111,  70, 244, 132, 213, 168,  70,   8, 221, 193, // .YoF....F...
- 204,  12, 124,  24, 206, 232,   0, 154, 225, 147,  80, 143, // ..|.......P.
- 149,  86, 122, 205, 230, 236,  55, 168, 248,  58, 165, 123, // .Vz...7..:.{
-  62,  74,  49, 215, 156, 139, 180,  90, 166, 245, 197,  34, // >J1....Z..."
-  98,  22, 156, 123, 122,  48, 220, 131, 226, 232, 152,  78, // b..{z0.....N
- 155, 254,  36,  64, 194, 120,  15,  28, 226,  97,  43, 235, // ..$@.x...a+.
-  77, 194, 120, 187,  13, 109, 170, 163, 171, 171,  35, 162, // M.x..m....#.
-  91,  76, 129,  35, 195,  56,  61,  12, 199,  77,  42, 180, // [L.#.8=..M*.
-  13, 221, 209, 237,  24, 229,  14, 175, 174,  14,  81, 110, // ..........Qn
- 196, 229,  14, 247, 124, 162,   3,  13,  89,  55,  32, 176, // ....|...Y7 .
- 175,  52,  87,  92,  66, 238, 179, 163, 173, 193,  10, 161, // .4W.B.......
- 122,  28, 176, 164, 146, 224, 159, 136, 134,  19, 194,  64, // z..........@
- 180,  11,  72, 191,  87, 215,  34,  23,  47,  94,   5, 116, // ..H.W."./^.t
- 196,  37, 242,  82,   3,  50,  68,   8,  95, 143, 242, 225, // .%.R.2D._...
- 199, 204, 171,  18, 231, 193,  77, 101,  18,  74, 206,  40, // ......Me.J.(
-  57,  71,  28, 242, 197, 230, 164,  32, 162, 197, 218, 182, // 9G..... ....
- 106,  45,  57, 217, 166,  25, 191, 116,  39, 163, 237,  13, // j-9....t'...
-  72, 128, 208, 166, 155, 168, 141, 194, 240,  91, 192, 244, // H........[..
- 207, 172, 239, 148, 160, 205,  60,  21,  21, 211, 120, 163, // ......<...x.
- 171, 162, 141,  46, 171, 172, 105, 111,  86, 189,  67,  75, // ......ioV.CK
-  50, 107,  78,  97, 255, 157, 240,  99,  76,  85, 249, 111, // 2kNa...cLU.o
-  19, 138, 109,  85,  34, 189, 102, 252, 119, 102,  18, 109, // ..mU".f.wf.m
- 146, 147,  96, 170,  79,  57,  54,  59, 130, 229,  97, 219, // ..`.O96;..a.
- 113,  84, 106, 158, 224,  87,   6, 145, 149, 175,   3, 227, // qTj..W......
-  77, 166, 146,  38, 168, 248, 190,  44,  47,  97, 110, 115, // M..&...,/ans
- 241, 165, 150,   7, 172, 186, 170, 247, 126,  89, 158, 169, // ........~Y..
- 215,  14, 105, 117, 219, 244, 141,  29,  60, 116, 232, 161, // ..iu....<t..
-  27,  46,  93,  45, 119,  61, 233,  94, 187, 161,  80,  82, // ..]-w=.^..PR
- 154, 161,  80, 161, 187, 225, 194, 254, 228,  98,   7, 250, // ..P......b..
-  71, 172, 243, 199, 179, 220, 126,  90, 153,  77,  85, 238, // G.....~Z.MU.
- 252, 133,  42,  22, 104,  98, 244, 226,  32, 111,  91,  94, // ..*.hb.. o[^
-  41, 148, 112,  71,  70, 151,   2,  94, 169, 218, 181,  43, // ).pGF..^...+
-  65,  29, 218,  75,   1, 183, 252, 165, 185,  17, 130, 125, // A..K.......}
- 139, 151,  95, 204, 233, 232,  99, 119,  23, 184,   4, 188, // .._...cw....
- 147, 144,  16, 128, 211, 176, 232,  18, 204, 208, 243, 119, // ...........w
-  60, 111, 202, 198,  60,   7,  39, 226,  66, 176,  14, 145, // <o..<.'.B...
- 128,  30, 132, 244,  14, 162, 169, 101, 146, 253, 141,  46, // .......e....
- 229, 176, 138, 116, 119, 237,   0,  69, 220, 243,  93,  29, // ...tw..E..].
- 187,  47, 151, 204, 127, 124, 205, 220, 199, 199, 134,  83, // ./...|.....S
- 184, 170, 140,  51, 179,  93,  16,   2, 192, 180, 122,  69, // ...3.]....zE
- 219,  59,  86, 175,  91, 103, 234,  49, 253, 191, 218, 236, // .;V.[g.1....
- 174, 157, 169,  93, 252, 149,  49, 125, 100, 191,  25, 165, // ...]..1}d...
-  70,  99,  68,  88, 131, 221, 197, 251, 124,  57, 233, 234, // FcDX....|9..
- 114,  74,  40, 137,   8, 103,  36, 205,   8, 133,  25,  17, // rJ(..g$.....
-  89, 122,  66, 151,  74, 209,  60,   0, 135, 227,  20, 143, // YzB.J.<.....
-  52, 135,   7, 170, 173, 186, 107, 191,  19, 172, 226,  88, // 4.....k....X
- 204, 253,  28, 122, 210,  79, 163, 225, 145, 247, 209, 175, // ...z.O......
- 142,  64,  57, 246,  83, 216, 173,   8, 218, 242, 177, 178, // .@9.S.......
- 139, 186,  52, 228, 229, 249, 118, 187, 191,  35, 216,  58, // ..4...v..#.:
-  51, 183, 119, 132,  62,  56, 230, 224,  76, 211,  96, 115, // 3.w.>8..L.`s
-  94, 187, 200, 238,  59, 122,  95,  11, 192, 145, 222, 130, // ^...;z_.....
- 127,  14,  47, 103, 203, 139, 152, 255, 218,  56, 237,  42, // ../g.....8.*
- 231, 188, 152, 255,  74,  98, 102, 163, 184, 199, 229, 134, // ....Jbf.....
- 123,  16,  82, 243, 197,  23,   2, 252, 123, 252, 244, 222, // {.R.....{...
-  97, 117,  36, 186,  58, 248,   8,  21, 234, 175,  71,  73, // au$.:.....GI
- 124, 200, 196, 156,  42,  41,  43, 139, 113,  11, 164, 225, // |...*)+.q...
- 197, 203, 127,   5, 105, 251, 132, 143,  89, 244, 227,   2, // ....i...Y...
- 171, 132, 245, 208, 229,  98, 156,  75, 210,  24, 134,  45, // .....b.K...-
- 102,  49, 106,  64, 248,   5, 128, 247,  64, 128, 240,  61, // f1j@....@..=
- 158, 239, 201, 130,  31,  80,  25, 139, 183,  76,  43, 188, // .....P...L+.
- 133,  96, 206,  78, 187,   3,  98,  60, 237, 117, 202,  12, // .`.N..b<.u..
- 129, 146,  71, 242, 196, 132, 170,  44,  15,  47,  72, 103, // ..G....,./Hg
-  78, 208, 122, 102, 228,  98, 138, 128,  78,  61,  86, 171, // N.zf.b..N=V.
-  33,  17, 122, 187,  48,  73,  80,  31, 195,  11, 130,  39, // !.z.0IP....'
- 186,  66,  14,  96,  30,  79, 183, 217, 143, 240, 133,  23, // .B.`.O......
- 241,  58,  53,  15, 124, 245, 180, 124, 107, 117, 214, 232, // .:5.|..|ku..
- 253,  33,  23, 255,  65, 229, 222, 241, 211,  83, 122, 122, // .!..A....Szz
- 196,  22, 198,  37, 248, 216, 182,   8, 111, 192, 154,  26, // ...%....o...
-  88,  10,  15, 236, 114,  92,  48, 252,   2, 112,   1, 180, // X...r.0..p..
- 189,  34,  12,  63, 246, 141, 141,  93, 223, 123,  29, 158, // .".?...].{..
- 195, 153, 199, 106,  40,  38,  20,  12, 201, 234, 181,  79, // ...j(&.....O
- 123, 236,  53,  82, 233, 116, 127, 173,  86, 125,  26, 187, // {.5R.t..V}..
-  46, 232, 105, 215, 247,  13, 127, 132, 205, 145,  30,  65, // ..i........A
-  86,  22, 120, 171, 198, 254,   2, 176, 255,  81, 173, 170, // V.x......Q..
-  93, 124, 181, 175,  30, 135,  31,  75,  99, 190, 190, 109, // ]|.....Kc..m
- 153, 187,  67, 203, 187,  33, 186, 160, 202, 213, 212,  44, // ..C..!.....,
- 182, 236, 211, 100, 209, 201, 107, 154, 167, 159, 221, 219, // ...d..k.....
- 183,  31, 223,  10,  63, 222, 190,  93, 239,   9,  43,  58, // ....?..]..+:
- 120, 162,  62,  16, 197, 246, 140, 205, 236,  42, 221, 228, // x.>......*..
- 124,  93,  68,  59, 237,  91, 225,  19,  59,  31, 103, 156, // |]D;.[..;.g.
- 230,  34, 140,  59, 144,  89, 159, 123,  82, 248,  99, 198, // .".;.Y.{R.c.
- 160, 153,  51, 126, 153, 179,  77, 194,  19, 222, 227, 133, // ..3~..M.....
- 122, 135, 173, 130, 135, 135, 184,  65,  97, 190, 158, 175, // z......Aa...
-  91, 158, 133, 180,  62, 131, 159, 154,  71, 183, 111, 207, // [...>...G.o.
-   4, 175,  88,  95,  95,  39, 204,  11,  32, 142,  21,  61, // ..X__'.. ..=
-  32, 204,  19,  52, 229, 217,  58,  96,  38, 156, 209, 232, //  ..4..:`&...
- 240,  80,  18, 162,  51, 100,   1, 196,  66, 194,  71, 103, // .P..3d..B.Gg
- 138, 225, 178, 220,  19,  22,  57, 161,  47, 249,  64,  19, // ......9./.@.
- 116, 198, 100,  16, 168, 190,  15, 253,   1, 227, 248, 210, // t.d.........
- 198, 142,   2,  24, 215,  18,  58, 254,  94,  80,  75, 248, // ......:.^PK.
- 128,  49, 184, 167,  70,  82, 212, 175,  18, 154, 111,  81, // .1..FR....oQ
- 220, 183, 232, 107, 167,  84, 101, 103,  99, 212, 138, 238, // ...k.Tegc...
-  38,   4,   0, 198,  22, 186,  78, 119,  83,  85, 145,  23, // &.....NwSU..
- 221,   2,  86,  55, 221, 115, 236,  85, 163,  74, 151,  94, // ..V7.s.U.J.^
-  83,  78,  75,  15,  34,  66, 216, 102, 219,   5, 219, 181, // SNK."B.f....
- 193, 122, 254, 149, 151, 112, 150, 185, 149,  90, 120, 139, // .z...p...Zx.
- 236,  27, 157,  69,  81,  56, 157,  47, 193, 112,  69, 154, // ...EQ8./.pE.
- 188,  72, 128,  25, 196, 150, 186, 239, 110, 231, 215,  92, // .H......n...
- 207, 212, 144, 121,  32, 228, 180,  84,  90, 220, 114,  17, // ...y ..TZ.r.
-  82,  14,  83, 162, 220,  79,  57, 173,  35, 174, 186, 228, // R.S..O9.#...
- 232,  54, 104, 188,  40, 134, 231, 128,  29, 243, 216,  98, // .6h.(......b
- 101,  27, 231, 101, 234, 188,  56, 106, 215, 237,  30,  37, // e..e..8j...%
-  24, 141, 235, 104, 144, 236,  65, 223, 186, 217, 217,  99, // ...h..A....c
- 171,  71,   5, 198,  18, 145,   8, 156, 160, 145, 144,  34, // .G........."
-   1, 197,  54, 144, 213,   3, 145,  16, 166,  96, 153,  59, // ..6......`.;
-  71,   0,  55,  40,  87,   8, 157, 104, 108, 113, 192,  10, // G.7(W..hlq..
-  33, 120, 106, 193,  20,  66, 126, 183, 105,  69, 144,  71, // !xj..B~.iE.G
-  87,  74,   2,  14,  71,  59, 240, 248,  23, 190,  59, 184, // WJ..G;....;.
-  64,  19,  78,  70, 253,  13, 143, 238,  93,  60,  53,  37, // @.NF....]<5%
- 213, 223, 144, 234,  77, 143,  19,  57, 207,  38, 211,  60, // ....M..9.&.<
- 197, 211, 103, 113,  26,  23, 154, 219, 130,  19,  53, 105, // ..gq......5i
-  27, 114, 137,   1, 141,  11, 163, 205,  91, 221, 189, 154, // .r......[...
- 230,  60, 198,  43,  74, 243,  25,  79, 112, 138, 190, 210, // .<.+J..Op...
- 189, 141,  77,   5, 171, 207,  38, 116, 220, 215,  76,   2, // ..M...&t..L.
- 101,  98,  46, 170, 108, 188,  37, 252,  83,  47,  98, 242, // eb..l.%.S/b.
-  28, 250, 135, 167,  59, 229,  85, 222, 213, 142,  41,  77, // ....;.U...)M
- 146, 121,  21, 251,  72, 175, 100,  99,  42, 229,  19, 129, // .y..H.dc*...
- 126, 145,  14,  63,   0,  75, 166, 195,   7, 134, 140, 222, // ~..?.K......
-  35, 175, 145, 107,  96,  38,  13, 218, 188,  73,   6, 251, // #..k`&...I..
- 196, 198, 116, 152, 103,  73,  34,   9,  96,  10,  82, 218, // ..t.gI".`.R.
-  62, 189, 176,  14,  70, 114, 136, 203,  10, 178, 215,  80, // >...Fr.....P
- 207, 141,  92,  38, 201, 195,   4, 156, 233,  36,  14, 129, // ...&.....$..
- 119,  57, 131, 136,  22,  25, 209,  94, 218,  31,  48, 252, // w9.....^..0.
-   1, 224, 246,  74, 141, 206,  82, 237, 218,  15,  56, 251, // ...J..R...8.
-  90,  14, 204, 151, 172, 248,   2, 178, 140,   4, 103,  74, // Z.........gJ
- 202, 120, 172, 187, 203, 167, 215, 237,  17, 153, 221, 199, // .x..........
-   4,  44, 221, 112,  53,  74,  38,  89,  52, 130, 178, 124, // .,.p5J&Y4..|
- 113, 253,  58,  24,  80, 186, 195, 251,  72, 134,  55,  23, // q.:.P...H.7.
- 125, 198,  56, 196, 122,   7,  51, 229, 212,  24, 223, 192, // }.8.z.3.....
- 131, 231,  58, 127, 114, 157, 146,  95, 146, 138, 112, 236, // ..:.r.._..p.
- 150,  43,  87,  72,  38,  63, 107, 224, 229,  95, 104,   0, // .+WH&?k.._h.
-   6, 241, 151,  70,   3, 217, 234, 160, 194, 105,  96, 233, // ...F.....i`.
- 161, 204, 251, 247, 168, 233,  79, 206,  55,  20,  53,   6, // ......O.7.5.
- 148, 197,  75, 194,  47, 158, 151, 134, 205, 204,  95, 211, // ..K./....._.
- 190, 207, 246, 238,  62,  70, 224, 206, 196,  17,  90,  45, // ....>F....Z-
- 214, 193, 164, 190, 125, 123,  80, 172, 131, 119, 175, 138, // ....}{P..w..
- 245, 146, 227, 191,  87, 162, 129, 142, 206, 212, 133,  87, // ....W......W
-  12, 186, 123, 132, 241, 210,  33, 193,  62, 253, 240, 167, // ..{...!.>...
-  26, 200, 160, 221, 122, 176, 190, 215, 196,  80,  18, 211, // ....z....P..
- 107, 193, 106,  35, 181,  35, 252, 144, 134,  57,  83, 167, // k.j#.#...9S.
-  62, 107, 107,  95,  48, 228,  17, 138,  75,  55, 213,  59, // >kk_0...K7.;
- 245,  66, 125,  82, 223, 212,  91, 245,  85,  61,  87, 223, // .B}R..[.U=W.
- 149,  78,  97,  69,  39, 246, 173, 111, 188,  66, 152, 152, // .NaE'..o.B..
-  52,  53,  10,  22, 106,  57, 191,  58,  42, 189, 251,  53, // 45..j9.:*..5
-  13,  38, 176, 189,  10, 195, 120, 210, 116,  79, 210,  57, // .&....x.tO.9
- 162,   3, 184, 221, 136,  78, 104,  65, 114,  24, 223, 243, // .....NhAr...
- 181,  89, 240, 181, 201,  78,  27,   9, 104, 239,  56, 149, // .Y...N..h.8.
-  88,  35,  74,  68, 132, 126, 160, 253,  86, 177, 190,  79, // X#JD.~..V..O
-  21, 152, 173, 190,  15,  43,  94, 243, 254,  51, 123,  45, // .....+^..3{-
-  51, 166,  82,   5, 173, 153, 172, 177,  97, 118,  33, 140, // 3.R.....av!.
- 187,  86,  22, 100, 110, 253, 213, 191,  87,  63,  11, 168, // .V.dn...W?..
-   5, 183, 254, 117, 113,  17, 246,  11, 227, 140, 206, 216, // ...uq.......
-   2, 167, 159,  57,  77,  99, 201,  63,  13, 245, 153, 114, // ...9Mc.?...r
- 222,  63, 135, 122, 149,  23,  71,  63,   1,  22,  71,  57, // .?.z..G?..G9
- 211,  34,  42, 102,  96,  97, 115, 234,   7, 172,  65, 158, // ."*f`as...A.
- 101,  69, 184, 234,  53, 224, 102, 190, 104, 248,  61, 227, // eE..5.f.h.=.
-  33,  97,  61,  30, 193, 100, 250,   3, 253, 242,  11, 145, // !a=..d......
-  69, 244, 166,  10, 113, 223,   0,  69,  16, 118, 170,  66, // E...q..E.v.B
- 101,  80, 183, 197,  47,  13, 165,  63, 248, 235, 240,  25, // eP../..?....
- 245, 152, 192,  79, 167,   0, 113, 206, 144, 195,  73, 191, // ...O..q...I.
-   8,  31, 123, 141,  97, 148, 158,  70,  83, 130,  43, 152, // ..{.a..FS.+.
- 159, 228, 235, 195, 130, 208, 234,  23,  16,  20, 115, 157, // ..........s.
- 243, 194, 107, 116,  71,  13,  54,  71, 225, 134, 217, 173, // ..ktG.6G....
-  49, 218, 237, 209, 113, 104, 124,  96, 232, 151,  74,  51, // 1...qh|`..J3
-   1,  42, 154,  82, 116, 243, 232,  79,  96, 169,  22, 132, // .*.Rt..O`...
- 252, 221, 167, 235,   7,  72, 224,   3, 255, 246, 237, 116, // .....H.....t
- 108, 156, 180,   0,  90,   8, 232, 110,  25, 175, 135, 250, // l...Z..n....
-  15, 244,  76,  88,  62,  92, 173, 160,  19, 126,  68, 187, // ..LX>....~D.
- 116, 231, 190,  92, 143,  38,  19, 157, 142,  30, 195,  11, // t....&......
-  47, 108,  97, 164, 202,  39,  84,  17, 231,  44, 168, 129, // /la..'T..,..
-  39, 174, 160, 244, 183, 176, 249, 198, 131, 153, 194,  67, // '..........C
-  24,  23, 211, 153, 252,  16, 212,   8, 116,  97, 245, 155, // ........ta..
-  16,  60, 157, 111, 126, 207, 131,  56,  96, 118,  24, 167, // .<.o~..8`v..
- 211, 171, 171, 193, 158,  95, 110,  76, 249, 140, 108,  82, // ....._nL..lR
-  76, 217, 141, 168,  60,  98, 184, 112, 165,  65, 232, 168, // L...<b.p.A..
- 233, 252,  45, 188, 129,  82,  85, 232, 113,  66, 141,  95, // ..-..RU.qB._
-  91, 118,  50, 240, 113,  61, 238, 211, 233, 110,  37,  69, // [v2.q=...n%E
- 104,  95,  21, 132, 251, 125, 192,  25,  20, 120,  23, 161, // h_...}...x..
- 147,  35,  22, 123,  23, 174, 223,  61,  62, 143, 145,  30, // .#.{...=>...
-  24, 113, 204,  19, 197, 110,   3,  96,  29, 144, 179,   0, // .q...n.`....
-  53, 228, 214, 241,  36, 109, 239, 171, 226,  33, 223,  69, // 5...$m...!.E
- 176,  22,  48,  60, 228,  41,  91, 139, 125, 199,  59, 115, // ..0<.)[.}.;s
- 204,  65,   9, 227,  23,  53, 122, 250, 251, 194, 247,  50, // .A...5z....2
-  74,  12,  11,  11, 131,  48, 139,  59,  41, 184, 243, 204, // J....0.;)...
- 153, 233,  78, 191, 192,  44, 237, 215, 127,   1, 230,  73, // ..N..,.....I
-  95, 169, 191, 130, 119, 189,  32, 163,   8,  40, 213,  62, // _...w. ..(.>
- 195, 232, 224,  18,   3, 173, 100, 118, 213, 205, 203,  44, // ......dv...,
- 210, 231, 203, 121, 164, 207,  13, 147, 244,  86, 194, 167, // ...y.....V..
- 233, 213, 213,  45, 168, 103, 209, 147,  15,   7,  37, 113, // ...-.g....%q
-  58,  19,  67,  82,  70,  11,  89,   5, 142,  78,  49, 194, // :.CRF.Y..N1.
- 168, 255, 213,  85, 195, 176, 210,  92, 196, 170, 169,  49, // ...U.......1
- 216, 101, 249, 213, 213,  38, 184, 199, 173,  78, 192, 182, // .e...&...N..
- 139, 137,  28, 202,  22,  29, 165, 163, 157, 218,  79,  38, // ..........O&
- 217, 180, 105, 114,   8, 169,  95,  27, 227, 168, 239,  37, // ..ir.._....%
- 111, 109, 105,  28, 225, 236, 156,  83,  53, 134, 198,  49, // omi....S5..1
-  76, 151, 245,  56, 139, 108, 210, 128, 221, 182, 254, 115, // L..8.l.....s
-  29, 193, 127,  60, 246, 241,  57, 235, 211, 117,   1,  23, // ...<..9..u..
- 106, 148,  90, 185,  24,  41, 212,  23, 175, 232,  52, 139, // j.Z..)....4.
- 205, 141, 174, 207,  21, 140, 183,  56,  79, 134, 247, 123, // .......8O..{
- 240,  59, 124,  98,  16, 152, 164,  52, 168, 162, 221,  44, // .;|b...4...,
- 186,  96, 172, 101,  97, 193, 133, 153,  66, 193, 150,  52, // .`.ea...B..4
-  35,  98, 116, 151,  91, 209, 211,   2,  94,  82,  88,  96, // #bt.[...^RX`
- 205, 252, 204,  16, 138, 109,  32, 156, 241, 185,  48,  49, // .....m ...01
- 175, 207, 220,  81, 168,  63,  15,  18,  43,  25,  58,  12, // ...Q.?..+.:.
- 153, 219,  87, 116, 131,  98,  83, 157, 152,  23, 230, 105, // ..Wt.bS....i
- 159, 210,  48,  18,  16,  42,  52,  21,  68, 142,  99,  21, // ..0..*4.D.c.
-  96, 101,  59,  37, 114, 156, 190, 253, 200,  28, 236, 165, // `e;%r.......
-  83, 188,   4, 162,  51,  63, 216,  39, 210, 220, 201, 166, // S...3?.'....
- 212, 125, 224,  52,  45, 126,  32,  20,  38, 152, 168,   3, // .}.4-~ .&...
- 106, 139, 197, 221,  68, 117,  39, 235,  34, 239,  38, 210, // j...Du'.".&.
- 249, 128, 215, 187, 255, 197,  59,  96, 158,  16, 245,  26, // ......;`....
- 180, 137,  28, 109,  97, 125, 100, 170, 214, 104, 134,  58, // ...ma}d..h.:
- 247, 219,  68,  76, 234,  55,  72, 165,  69, 195, 216,  30, // ..DL.7H.E...
- 135, 175, 155, 222,  78, 243, 212,  95,  27, 247,  50, 249, // ....N.._..2.
- 130, 199, 172, 161, 223, 177, 143, 188, 144, 227, 114,  13, // ..........r.
-  41,  61,  17,  62,  69,  63, 130, 104, 199, 190,  76, 131, // )=.>E?.h..L.
-  99, 186, 216, 162, 160, 189, 125,  76, 207, 220, 144,  93, // c.....}L...]
- 238, 128,  23, 105,  26,  68, 234, 248, 234, 138, 219, 109, // ...i.D.....m
- 156, 196, 163,  17, 157, 179,  65,  13,  16, 120, 134,  87, // ......A..x.W
-  67, 211,  27,  33, 170, 201, 186,  17, 223,  19, 173,  91, // C..!.......[
- 206,  21,  13, 159, 175,  23,   8, 204,  78, 124, 166, 119, // ........N|.w
- 233, 115,  68,  86,  92,  19, 110, 125,  92,  34, 220,  42, // .sDV..n}.".*
- 194, 143,  32, 231,  93,  79,  64, 194, 176,  13, 119,  97, // .. .]O@...wa
-  79, 156, 241, 143,  49, 182, 110, 137,  67, 226,  70, 163, // O...1.n.C.F.
-  89, 248, 235,  49, 157, 172, 231, 111, 199,  30,  76, 121, // Y..1...o..Ly
- 252,  62,  68, 148, 133,  49, 156, 222, 248, 119, 186, 113, // .>D..1...w.q
- 120,  82, 151, 171,  37,  75, 187,   6, 134, 223,  59, 238, // xR..%K....;.
- 123,  21, 188, 215,  96, 156, 128, 178, 169, 215,  86,  93, // {...`.....V]
- 240,  62, 174, 131, 111,   1, 237, 190,  58, 224, 210,  29, // .>..o...:...
-  90,  43,  96,  27, 153, 207, 231,   7,   6, 163,  74, 222, // Z+`.......J.
- 123, 187, 234, 160, 180,  11, 202,  65,  80,  19, 125, 124, // {......AP.}|
- 238,  19, 234, 147, 171, 215,  68, 219,  18,  50, 117,  80, // ......D..2uP
- 227,  45, 214, 143, 130, 131, 117,  40,  27, 211, 207,  48, // .-....u(...0
- 154, 200,  34, 253, 128, 118, 121,  30, 143, 122,  63, 220, // .."..vy..z?.
-  62, 126,  44, 239, 131,  39, 184,  27, 116, 228, 161, 232, // >~,..'..t...
-   4,  69, 219,  60, 110,   6,  69,  23, 157, 255, 112,  59, // .E.<n.E...p;
- 255,  81, 239, 252, 135, 116, 254, 131,  59,  39,  82, 191, // .Q...t..;'R.
- 236, 111, 240, 122,  15,  26, 223, 170, 137, 109,  58, 243, // .o.z.....m:.
- 165, 201,  78, 208, 149,  67,  68, 186, 233, 212, 186,  57, // ..N..CD....9
- 115, 187,  57, 171, 119, 115,  38, 221, 156, 113,  55, 243, // s.9.ws&..q7.
- 244, 165, 215,  24, 229, 209, 217,  67,  58, 131,  27, 116, // .......C:..t
- 225, 202, 197, 227, 158, 198, 201,  99, 200, 145,  60, 253, // .......c..<.
- 181, 188,  18, 172, 182,  41, 172, 144, 145, 167, 205,  80, // .....).....P
- 189, 228,  51, 173,  11,  60, 218, 203,  67, 219,  55,  60, // ..3..<..C.7<
-  27,  77, 155, 144, 168, 232,  41,  12, 166,  95,  66, 235, // .M....).._B.
- 154, 181,  54, 208, 232, 159, 235, 135,  73, 118,  16,  37, // ..6.....Iv.%
-  15, 145,  16,  38,  47, 109, 158, 117, 169,  45, 215, 200, // ...&/m.u.-..
- 160, 173, 102,   4, 136, 184,  53,  74,  19,   3,  71, 139, // ..f...5J..G.
- 183, 244,  30,  62, 243, 146, 213,  22, 205, 190,  74,  30, // ...>......J.
- 131, 188,  78,  56, 101, 183,  89, 166,  24, 127,  67,  50, // ..N8e.Y...C2
-  38, 106, 240, 246, 109,  26, 127, 207,  47,  90, 173, 122, // &j..m.../Z.z
-  78,  66,  57, 168,  64,  52, 184,  79,  68, 120, 137, 255, // NB9.@4.ODx..
- 131, 172, 241,  48,  18,  66,  58, 204,  39,  65, 252, 137, // ...0.B:.'A..
-  95, 158,  92, 149, 176, 155,  65, 112,   2,  84, 135,  48, // _.....Ap.T.0
- 154, 151,  75,  63, 145, 174,  73, 232, 194, 252, 106,  62, // ..K?..I...j>
- 255, 250,  92,  89, 205,   4,  51,  36,  26, 251, 239, 178, // ...Y..3$....
-  14,  61, 115,  91, 214, 243, 251, 246,  97, 189, 226,  77, // .=s[....a..M
-  66,  93, 193, 106, 171,  80, 223, 230, 107,  86,  85, 178, // B].j.P..kVU.
-  11, 174, 117,  86, 229,  86, 112, 143,  29, 152,  16, 158, // ..uV.Vp.....
- 148,  94,  93, 101, 226, 251, 202,  20, 169,  38,  70, 222, // .^]e.....&F.
- 221, 249, 225,  22, 233,  70, 146,  17, 182, 137, 254, 252, // .....F......
- 217,  60,  41,  11, 157, 187,  12, 149,  13,   8,  90, 216, // .<).......Z.
-  35,  31, 204,  19,   9, 195,  65, 214,  91, 220,  11, 132, // #.....A.[...
- 180,  52, 128,  69,  52,  84,  67,   0, 184, 177,  87, 121, // .4.E4TC...Wy
- 139, 126, 143,  27, 199, 161,  89,  58,  94, 229, 146, 224, // .~....Y:^...
- 179, 115,  70, 210,   9, 111, 117,  55, 128, 155,  49, 146, // .sF..ou7..1.
- 116, 117, 165, 119, 124, 230, 150, 232, 157, 234,  44,  77, // tu.w|.....,M
- 215, 199, 121, 118, 226,  83,  75, 230,  73, 113,  67,  70, // ..yv.SK.IqCF
-  61, 134, 158,  37,  25,  92,  41, 209, 116, 153,  27, 206, // =..%..).t...
- 144, 103, 186, 180,  37,   9, 216, 190, 244, 139,  63, 131, // .g..%.....?.
- 226,  37, 209,   5,  62, 232, 161,  80, 110, 223, 130,  47, // .%..>..Pn../
- 191,  19, 205, 166,  49,  28, 234,   2, 154, 128, 143,  33, // ....1......!
- 187, 166,  81, 120, 154,  86, 243,  11, 251, 113, 210, 227, // ..Qx.V...q..
- 219, 183, 111, 193,  21, 155, 151,   3, 159, 230, 207, 128, // ..o.........
- 130, 145, 181,   0, 130, 198, 145, 207, 234, 160, 151,  86, // ...........V
- 189,  71,  10, 244, 255,   8, 132, 200, 235,  40, 184, 239, // .G.......(..
-   9, 144,  38, 222, 139,  68,  63, 201, 234,   0,  73,  19, // ..&..D?...I.
- 215,  75, 119, 202, 210, 144,  59, 211, 232, 176, 239, 111, // .Kw...;....o
- 209,  32, 244,  71, 214,  31,  53,  50, 235, 140, 238,  90, // . .G..52...Z
- 207,  42,  81,  90, 163,  36,  38, 252, 129, 155,  16, 138, // .*QZ.$&.....
- 111,  62,  15, 200, 101,   6, 221, 160, 126,  50,  11, 100, // o>..e...~2.d
-  94,  54, 113, 229,  26, 252,  96,  12,  42, 177, 124, 155, // ^6q...`.*.|.
-   4,  84, 232, 167, 217, 112,  94,  69, 247, 245, 172, 200, // .T...p^E....
- 208,  48, 134,  37, 111,  72, 101, 114,  20, 201, 230, 145, // .0.%oHer....
- 208, 246,  23,  72,   7, 101, 137,  11, 150, 190, 220, 120, // ...H.e.....x
-  38, 157,  87,  60, 160, 152,   1, 167,   1, 234,  26, 191, // &.W<........
-  23,  13,  70, 225,  48, 251, 206,  70, 102,  92, 185, 227, // ..F.0..Ff...
-  25, 206, 130, 143,  93, 254, 252,  39, 153,  22, 200, 124, // ....]..'...|
-   6,  73, 193, 156, 187,  12,  32,  95, 246,  96,  93, 171, // .I.... _.`].
- 187, 242,  69, 144,  89, 208,  51,  11,  45, 152, 164,  35, // ..E.Y.3.-..#
- 106, 230, 232,  71, 131, 189,   4, 157, 129, 247, 190,  74, // j..G.......J
- 232, 160, 205,  56,  45,  36,  99,  21,  25,  70, 126, 165, // ...8-$c..F~.
- 239, 178, 114,  86, 237,  99,  62, 151, 167,  38, 239,   1, // ..rV.c>..&..
- 195,  30,   1, 121, 110,  37, 238,  76, 165, 211, 146, 232, // ...yn%.L....
- 187, 128,  88,   6,  31,  33, 223,   1,  26, 156,  57,  23, // ..X..!....9.
- 122,  94,  74, 242, 156,  25,  55,   5, 119,  64,  70, 254, // z^J...7.w@F.
- 128, 209,  19, 234, 211, 194,  87,  38, 140, 122,  67, 191, // ......W&.zC.
- 101, 106, 101,  11, 102, 100,  39, 133,  20, 210, 207,  84, // eje.fd'....T
- 145,  51, 105, 244, 182, 175, 239, 121, 250, 142,  31,  20, // .3i....y....
-   9, 126,  96, 209,   3, 227, 180,  59, 170,  72,  61, 147, // .~`....;.H=.
- 255,  32,  40,  10, 170,  15, 245, 171,  89,   8,  35, 170, // . (.....Y.#.
-  59, 244, 230,  25, 147, 230, 214, 229, 206,  14, 253, 121, // ;..........y
- 242, 100, 190,  98, 141, 147, 217,  92,  25, 165, 135,  80, // .d.b.......P
- 104,  40,  38, 160, 121,  18, 125,  72,  20, 163,  85, 104, // h(&.y.}H..Uh
- 139, 192, 132, 225,  20,  31,  70,   4, 197, 132,  79,  65, // ......F...OA
- 152,  13, 208, 163, 177, 155, 234, 209,  35, 148, 241, 194, // ........#...
-  98,  72,  25, 114, 193,   2, 138, 236,  51, 172,  12, 248, // bH.r....3...
- 106,  53, 137, 120, 228,  52,  19,  94,  73,  82, 229, 133, // j5.x.4.^IR..
- 211,  45,  77, 101,  30, 141,  65, 215,  33, 204,  15,  48, // .-Me..A.!..0
- 204,  83, 254, 123,  76, 251,  10, 154, 202, 151,  44,  40, // .S.{L.....,(
- 164,  33, 192, 202, 203, 110,  46,  38, 175,  12, 145, 229, // .!...n.&....
- 168,  16, 214,  93, 115,  20, 135, 180,   1, 143, 237,  29, // ...]s.......
- 224, 247,  25,  15, 160,  43, 209,  15,  46, 247, 131, 246, // .....+......
- 220,  47,  94, 195,  61,   7, 116,  91,  33, 178,  40,  70, // ./^.=.t[!.(F
-  96, 207,  63,   4, 217,  95, 192, 213, 105,   3,  48,  37, // `.?.._..i.0%
-  83, 195,  52, 189,  98, 142,  64,   1,  79, 181,  13,  49, // S.4.b.@.O..1
- 202, 125,  72,  31,  67, 147,   4,  75,  51, 180, 140, 215, // .}H.C..K3...
-  99, 255, 242,  29,  23,  59, 210, 209, 200,  22,  83, 150, // c....;....S.
-  46, 231, 156, 220,  36, 191, 147,  75, 153, 125,   8,  60, // ....$..K.}.<
- 198, 112, 185, 154, 201, 196,  60,  29, 250,  54, 133,  94, // .p....<..6.^
- 235, 156, 138, 199,  98,  98, 185, 227,  61, 196,  32, 227, // ....bb..=. .
-  20,  40, 116, 131,  71, 131,  73, 130, 195,  72, 206, 192, // .(t.G.I..H..
-  75, 195, 204, 238, 106, 169, 203,  58, 135, 130, 119, 105, // K...j..:..wi
- 244,   1,  61, 217, 107,  46, 132, 138, 210, 131,  34,  27, // ..=.k.....".
- 125,   9, 123, 168, 120, 199,  42, 242, 160, 246,  47, 113, // }.{.x.*.../q
- 236,  37,  68, 155,  16, 202,  76,  91, 196,  92, 113, 236, // .%D...L[..q.
-  12, 143, 153, 195, 168,  12,  13, 179,  48, 167,  65, 189, // ........0.A.
-  99,  71,  61, 224,  21, 186, 242, 216,  63,  92,  45, 182, // cG=.....?.-.
-  90, 211,  21,  59, 156, 125, 187, 248, 165, 246,  97, 122, // Z..;.}....az
-  11, 106, 231, 222,  19, 143,  57, 184, 131,  20,  42,  48, // .j....9...*0
- 154,  10, 234,  21, 126, 177,  72,  12, 225,  54, 239, 214, // ....~.H..6..
-  37, 163,  84,  83, 254,  70, 196, 102, 241,  12, 127, 222, // %.TS.F.f....
- 226, 207,  87, 252, 121, 142,  63, 191, 227, 207,  43, 252, // ..W.y.?...+.
- 249, 142,  63,  95, 240, 231,  61, 254, 180, 241, 167, 131, // ..?_..=.....
-  63,  93, 252, 217,   4,  69, 158, 179, 200,  28,  16, 201, // ?]...E......
- 141, 222, 101,   8, 189, 195, 127, 183, 248, 239, 125, 254, // ..e.......}.
- 251, 128, 255, 222,  99,  97, 164,  43,   6,  22,  86, 176, // ....ca.+..V.
- 151, 208, 166, 191, 133, 157, 200, 155, 135, 206,  96, 126, // ..........`~
-  17, 193,  60,  60, 139,  90, 135,  90, 109,  14, 145, 132, // ..<<.Z.Zm...
- 150, 219, 220,  11,  81, 108, 145,  87,  23,  78,  85,  74, // ....Ql.W.NUJ
- 151,  34, 159, 234, 217,  86,  67, 250,  98, 250, 212,  66, // ."...VC.b..B
- 149,  45, 135, 244, 249, 244, 221,   9, 190, 155, 191,  58, // .-.........:
- 197,  40,  51, 252, 193,  13, 198, 222, 153,  23,  15, 109, // .(3........m
- 150, 116,   9, 134, 171,  13, 143,  65, 116, 138, 161, 154, // .t.....At...
-  93, 168, 125, 214, 231,  78, 230, 161,  86, 132, 182,  52, // ].}..N..V..4
- 173, 215,  35, 161, 191, 251, 230, 151, 117, 187, 219, 126, // ..#.....u..~
-  47,  98,  92, 186, 248,  87, 183, 239,  21, 111,  91,  97, // /b...W...o[a
- 164, 192,  49, 165, 231, 231, 205,  16,  42, 160, 144, 151, // ..1.....*...
- 230,  34,  53,  45, 190,  34, 187,  45, 217, 191,  35, 155, // ."5-.".-..#.
- 161, 144,   8,  55,  70, 155, 232, 250,  72, 206,  88, 212, // ...7F...H.X.
- 131, 223,  14, 193,  24, 126, 187, 123,  97, 134, 223, 205, // .....~.{a...
- 189,  48,  86, 232,  32, 121, 205, 182, 190, 175,  41,  69, // .0V. y....)E
- 161,  19, 243, 244, 149, 115, 186, 156,   3, 121, 214, 239, // .....s...y..
- 156, 211, 118, 172, 235, 237,  17,  67, 149, 138, 183, 138, // ..v....C....
- 230, 237, 247, 102, 241,  21, 230, 210, 207, 105,  28, 197, // ...f.....i..
- 239, 213, 146, 102,  30, 171, 196,  77, 207,  98, 248,  42, // ...f...M.b.*
- 206, 252, 203,  97,  68, 123, 178,  19,  88, 153, 126, 147, // ...aD{..X.~.
- 160, 191, 149, 247,  56, 181, 107,  83,  11,  55, 117, 211, // ....8.kS.7u.
- 166,  38,  45,  74, 109, 154, 212, 182,  77,  77,  37, 117, // .&-Jm...MM%u
-  62, 255, 107, 203, 194, 142,  87, 176,  52, 140, 162, 103, // >.k...W.4..g
- 211,  16, 154,  49,  40,  64,  43,  80,  97, 202, 188,  40, // ...1(@+Pa..(
- 140, 180,  50,  83, 199,  20,  42, 151, 138,  39, 216, 122, // ..2S..*..'.z
- 123, 140,  66,   3, 242,  61, 218,  14, 162,  32,  27,  66, // {.B..=... .B
- 179, 235,  57, 145,  87, 235,  91, 172, 240, 195, 218, 178, // ..9.W.[.....
- 156, 248, 187,  77, 236,  90, 213,  89,  78, 126, 107, 147, // ...M.Z.YN~k.
-  55,  75,  61,  90,  78, 255,  42, 233, 115, 102,  15,  22, // 7K=ZN.*.sf..
- 232, 186, 114, 119, 124,  41, 218,  42, 218, 106, 171,  20, // ..rw|).*.j..
- 236,  37,  90, 140,  98, 133,  60,  74, 152,  29, 203,  86, // .%Z.b.<J...V
- 159, 246,  38,  27, 171,  75,  49,  31, 188,   8,  24,  59, // ..&..K1....;
- 156, 227, 142, 150,  34, 190, 131, 232,  18, 174,  36, 214, // ....".....$.
- 119, 165, 110,  97, 178, 206,   6, 125, 138, 167, 239,  56, // w.na...}...8
- 158,  88, 169, 152,  39, 175,   8, 179, 226, 247, 216, 143, // .X..'.......
- 172,  17, 222,  90,  18,  13,  94, 189, 233,  56,  96, 230, // ...Z..^..8`.
-  32, 158, 124,  38,  38,  96, 254, 215, 239, 131,  65,  80, //  .|&&`....AP
- 118,  21,  90,  85,  49,  67, 235, 180, 161,  12, 104,  77, // v.ZU1C....hM
-  54, 204,  76, 231, 208, 100,  44, 203, 245, 251,  58,  66, // 6.L..d,...:B
- 164, 155, 109,  24, 216, 232, 104, 123,  42, 188,  58, 131, // ..m...h{*.:.
-  11,  21, 111,   3,   2, 201,   9, 134, 110, 148, 150, 103, // ..o.....n..g
-   0, 225,  35, 250, 201,  24, 169,  47, 214, 143, 162, 169, // ..#..../....
- 119,   4, 195,  32, 255, 210,   8, 167, 249, 107, 149, 144, // w.. .....k..
-  68,  48,  50,  49,  58, 156,  98,  58,  15,  62,  72, 202, // D021:.b:.>H.
- 250, 137,  58, 204, 205,  65,  74,  80, 162,  91, 173,  21, // ..:..AJP.[..
- 166,  19,  77, 123,  70, 138, 105, 252, 129,  73, 213,  37, // ..M{F.i..I.%
-  53, 161,  43, 211, 108, 254, 118, 100, 165, 204,  11, 245, // 5.+.l.vd....
-  51,  83, 223, 168,  64,   8, 194, 126,  43, 204, 236, 138, // 3S..@..~+...
-  76,  90, 118, 177, 250, 173, 206,  70,  59,  24, 246, 207, // LZv....F;...
- 188,  17,   4, 190, 186, 171, 198, 184, 190, 161, 107,  22, // ..........k.
-  90, 148, 191,  95,  21, 201, 220,  34, 173,  73,  79, 111, // Z.._...".IOo
-  23, 253, 130,  77, 185,  34, 106,  61, 208, 230,  49,  49, // ...M."j=..11
- 142,  28,  86, 134, 183, 111, 191, 242,  38,  45,  84, 205, // ..V..o..&-T.
- 203, 170,  62,  59, 142, 149,  73, 115,  76, 216,  68, 100, // ..>;..IsL.Dd
- 154,  73,  28, 161, 100, 157, 109,  53,  67,  61, 199,  42, // .I..d.m5C=.*
-  91, 220,  40,   1, 163,  52,  27,   2, 113,  17,   8,  57, // [.(..4..q..9
- 196,  10,  25, 155, 218, 228, 144, 183,  44,  99, 223, 242, // ........,c..
-  72, 231, 216,  33, 115, 242, 108,  26, 239,  83,  60, 148, // H..!s.l..S<.
- 104,  83, 249, 194, 233,  37, 226, 101, 159,  57, 213,  34, // hS...%.e.9."
-  83, 230, 209,   0, 231,   9,  54,   8,  91, 181, 218, 253, // S.....6.[...
-  33, 111, 116, 193, 138, 225, 200, 250, 230,  28,   3, 230, // !ot.........
-  68, 106, 231,  52,  76,  78,  24, 136,   9, 226,  84, 178, // Dj.4LN....T.
-  31,  26, 246, 123, 114,  81,  62, 157, 155,  39, 231,  78, // ...{rQ>..'.N
-  59, 240, 172, 207, 109, 166,   8, 224, 220, 185,  93, 250, // ;...m.....].
- 185,  49,  52, 194, 231, 129, 182, 246, 111,  76, 214,  37, // .14.....oL.%
-  54,  46,  87, 207, 252,  66,  50, 185,  11, 239, 175,  37, // 6.W..B2....%
-  62, 155, 248, 126,  64,  80,  81, 204, 248, 239,  83, 123, // >..~@PQ...S{
-  60, 217, 195, 139, 105, 165,   6, 156,  10,  53, 130, 198, // <...i....5..
- 103,  52, 209,  96, 157,  19, 238,  92, 155,  89, 178, 236, // g4.`.....Y..
-  23,  49, 202, 239,   4, 230,  73,  25, 166, 133, 101,  94, // .1....I...e^
-  92,  93,  37,  68,  66, 235, 145, 210,  70, 197, 165,  98, // .]%DB...F..b
- 245, 127,  36, 162, 172, 120,   3,  86, 191, 145, 146,  64, // ..$..x.V...@
- 116,  82, 190,  40, 253,  77, 178,  88,   3, 139,  69,  39, // tR.(.M.X..E'
-  54,  11, 233, 213,  18, 218, 231,  74, 114, 112, 147,  68, // 6......Jrp.D
-  97, 223,  86,  18, 179, 235, 208,  97, 180, 236, 203,  74, // a.V....a...J
- 150, 251, 184, 128, 108, 180, 233, 109,  54, 187, 107, 112, // ....l..m6.kp
- 192,  73,  23, 183,   1,   8, 218, 142, 132, 238, 111,  50, // .I........o2
-   7, 200,  64, 158,  89, 127,  49, 254,  45, 140,  34,  32, // ..@.Y.1.-." 
-  87,  90, 239, 174,  17, 158,  97, 212, 186, 236,  56, 141, // WZ....a...8.
- 205,  22, 101, 177, 225, 205,  52,  72,  98, 181, 111,  85, // ..e...4Hb.oU
- 191, 112, 116, 236, 151,  90,  95, 115, 101, 251,  32, 160, // .pt..Z_se. .
- 171, 160, 219,   2, 183, 225, 152,  72, 154,  60, 155, 212, // .......H.<..
- 164,  76,  75, 144, 226, 192, 123,   5, 238, 118, 157, 144, // .LK...{..v..
-  40,  44,  52, 164, 153, 149,  40, 231, 218,  32, 238,   6, // (,4...(.. ..
-  67, 173, 155, 183, 203,   9, 197,  49, 239, 142, 175, 174, // C......1....
- 110,  25, 228, 216, 240,  14,  42, 183, 155, 175, 123,  82, // n.....*...{R
- 153, 189,  93,  26,   4, 157, 112, 103, 195,  77,  81,  47, // ..]...pg.MQ/
- 212, 139, 117,  14, 114, 249,  38,  27, 177, 197, 130, 223, // ..u.r.&.....
- 219, 241, 114, 165, 173, 108,  81,  27,  41, 204,  14,  27, // ..r..lQ.)...
- 114,  26, 237,  25,  23, 149, 151, 219,   7,   4,  80, 121, // r.........Py
-  81, 107, 145, 203,   9, 121, 213,  48,  49, 160, 202, 189, // Qk...y.01...
-  67, 168, 198, 145, 245,  48,   0, 190, 101,  47, 113, 252, // C....0..e/q.
- 171, 139,  52,  64, 188, 202, 195, 220,  89, 168,  45,  41, // ..4@....Y.-)
- 200, 158, 131,  74,  74,  75, 210,   4,  24, 185, 102,  25, // ...JJK....f.
- 242,  37,  52, 116, 151, 148, 144, 147,  45, 162,  33, 165, // .%4t....-.!.
-  24, 137, 165,  73, 166,  64, 190, 163,  26, 217,  97, 246, // ...I.@....a.
- 159,  42,   4, 149,  59,  50,  95, 238,  69, 166,   7,  14, // .*..;2_.E...
- 136,  99, 247, 220, 118, 187, 191,  48, 148, 160, 214,  45, // .c..v..0...-
-  29, 225, 149, 144, 148,  80,  54, 185,  25, 237,  17, 106, // .....P6....j
-  86, 167, 151, 100, 112,  50, 110, 174, 219, 175,  37, 135, // V..dp2n...%.
-  94, 238,  15, 186, 230, 134,  69, 158, 252, 174,  47, 224, // ^.....E.../.
-  91, 253,  68,  23,  17,  61, 250, 183,  64, 185,  26,  79, // [.D..=..@..O
-  32,  21, 185, 184,  62, 205,  78, 202, 144,  23, 252,   1, //  ...>.N.....
-   5, 155,  62,  25, 142,  99, 207, 101,  74,  22, 204, 178, // ..>..c.eJ...
- 185,  76,  81,  42, 221, 167, 105, 209, 253,  20, 151,  17, // .LQ*..i.....
- 204,  71, 119, 131,  98,  85,   1,  21, 255, 196, 104,  11, // .Gw.bU....h.
-   3,   9, 188, 160, 240, 125,  66, 133,  19, 107,  78,  47, // .....}B..kN/
-  13, 207, 175, 151,  21,  54, 241,  41,  13, 224, 145, 119, // .....6.)...w
- 100, 190, 220, 126,  54,  46, 215, 140,  61, 197, 236, 123, // d..~6...=..{
- 181, 207,  85, 233, 197, 181, 150, 164,  41,  38,  20,  47, // ..U.....)&./
-  43, 242, 114, 196, 208, 203,  39, 107,   3, 176, 167, 107, // +.r...'k...k
-  75,   8,  98,  87, 101, 165, 153, 153,  97, 239, 230,  42, // K.bWe...a..*
- 219, 155, 139, 236, 191,  56,  97, 145, 199,  80, 179,  32, // .....8a..P. 
-  34,  99, 117, 175, 226, 180, 158,   6,  38,  47, 205, 177, // "cu.....&/..
- 208, 221, 210, 150, 112,  64, 100,   1,   5, 206, 139, 161, // ....p@d.....
-  91,  73,  46,  83,  89, 199, 107, 187, 212, 129, 252,  36, // [I.SY.k....$
- 185, 198, 140, 229, 165,  78, 236, 118, 221, 161,  25, 166, // .....N.v....
- 239,  19, 188, 174,  53,   1, 203,   7,  73, 229, 118, 252, // ....5...I.v.
-  72,  47,  45, 246,  19,   7,  90, 143, 240, 125, 218,   0, // H/-...Z..}..
- 159, 234, 225,  18,  18, 186, 223, 176, 143,  85,  50,  55, // .........U27
-  31, 109,  16,  17, 240, 241, 247, 221,  81, 227, 116, 186, // .m......Q.t.
- 112,  19,   8, 241,  72, 206, 235,   9,  34,  72,  32, 228, // p...H..."H .
- 208, 225, 212,  66,  24, 109,  19,  22,  62, 215,  58, 127, // ...B.m..>.:.
- 165,  75, 239, 171,  65, 143, 232,  80, 214,  86,  54,  46, // .K..A..P.V6.
- 154,  72,  44,  18, 167,  59,  80, 222, 248,  20,  41, 158, // .H,..;P...).
-  48, 227, 220, 233,  26, 135,  36,  93, 192,  95,  97,  68, // 0.....$]._aD
-   5,  53, 124, 234, 148, 136, 222, 107, 157, 138, 190,  98, // .5|....k...b
-  89,  19,  26,  45,  10,  39, 102, 181, 128, 181, 156,  83, // Y..-.'f....S
- 247, 213, 220,  53,  21,  76,  32,  17,  10, 118,  68, 189, // ...5.L ..vD.
- 203, 168, 104,  67, 231, 211, 130, 213,  15, 192, 213,  51, // ..hC.......3
-  49,  49, 136, 232,  78, 172, 100, 164, 130,   3, 238, 128, // 11..N.d.....
-  38, 216, 170,  78, 214, 166, 219, 180,  92, 182, 224,  76, // &..N.......L
- 188, 212,  59, 119,  95, 125, 195,  32, 183, 223, 219,   0, // ..;w_}. ....
-  63,  85, 192, 235,  44,  28,  16,  33, 107, 255, 115, 177, // ?U..,..!k.s.
- 149,  29, 199,  74, 113,  96,   8, 102, 248, 152, 137,  66, // ...Jq`.f...B
- 162,  74,  97, 228, 225, 216, 240, 177, 135, 116, 195, 222, // .Ja......t..
- 135, 123,  98, 118, 112, 147,  26, 231, 226, 244, 152, 195, // .{bvp.......
- 195, 193,  23, 175, 216, 103, 172, 109,  99, 211, 103, 166, // .....g.mc.g.
- 104, 196, 182, 114, 148,  41, 181,  58,  92, 148, 219, 216, // h..r.).:....
- 228, 199, 216, 212, 122,  40, 181,  32, 230, 158,  10,  94, // ....z(. ...^
- 121,  12, 116, 109,  66,  64,  19, 167,  96,  90, 217, 199, // y.tmB@..`Z..
- 171, 171,  65, 178, 163, 236, 127,  14, 103, 127, 232, 193, // ..A.....g...
- 172,  46, 217, 193,  76,  36, 175,  81, 121, 223, 214,  78, // ....L$.Qy..N
- 142,  93, 149,   9, 109, 120,  51, 103,   0,  85, 149,  60, // .]..mx3g.U.<
-  86, 201, 170,  80,   0, 201, 174, 249, 253, 104,  96,  79, // V..P.....h`O
- 116,  19,  42, 111,  36, 201,  15, 149,  60,  85, 201,  67, // t.*o$...<U.C
- 149, 188,  83, 201,  35, 149,  60,  81, 201,   7, 149, 188, // ..S.#.<Q....
-  80, 201, 159,  42, 121, 169, 146,  63,  76, 245,  79, 117, // P..*y..?L.Ou
-  54, 199, 183, 114,  87, 207,  44,  14,   6,  71,   6,  90, // 6..rW.,..G.Z
- 201, 173, 123, 153,  60,  14, 219,  53, 253, 204, 114,  27, // ..{.<..5..r.
-  24,  57, 106, 242, 184,  73, 100, 140, 118,  68,  94,  96, // .9j..Id.vD^`
- 106, 176, 165, 104,  56,  19, 255, 107, 144,   2, 150,  81, // j..h8..k...Q
-  66, 169, 159, 193,  96,  15, 187, 249, 113, 232, 209, 168, // B...`...q...
-  64,   9,  89, 231, 214, 134, 235, 198,   6,  88, 232, 127, // @.Y......X..
- 179, 140, 178,  76, 137, 214,  70,  30,  96, 103, 180,  81, // ...L..F.`g.Q
- 147, 199,  11,  34, 222, 199, 102,  80,   5,  75,  46, 230, // ..."..fP.K..
- 213,  64, 228,  69, 158, 153,  83, 211,  22, 136, 156, 178, // .@.E..S.....
- 243, 174, 168, 193,  58, 178, 122,  19, 240,  15, 254, 141, // ....:.z.....
-  79, 160, 120,  75, 112,  17,  34, 225, 192, 142, 199, 178, // O.xKp.".....
-  36, 159, 252, 126, 242, 204, 243, 131, 244, 212, 211,  95, // $..~......._
- 136, 254,  16, 135, 239,  93, 240, 148, 125,  48, 147, 138, // .....]..}0..
- 251, 132, 159,  10, 141,   7, 180,  28,  44,  37,  97,   2, // ........,%a.
- 185,  92, 160, 103,  85, 116, 160,  30,  86, 163, 109, 217, // ...gUt..V.m.
- 243,  30, 228, 151, 125, 143,  22,  60, 249, 200,  65,  41, // ....}..<..A)
- 176, 230, 244,   8,  13, 185, 199,  45, 194,  25, 121, 174, // .......-..y.
-   6, 201,  42, 157,  31, 230, 113, 119,  79, 198, 141,  16, // ..*...qwO...
-  25, 201,  42,  37,  39, 187, 126,  96,  66, 124, 108, 114, // ..*%'.~`B|lr
-   6, 199, 197, 224, 232,  23,  26,  35,  53, 234, 131,  16, // .......#5...
-  66, 148, 153,  47,  23,  51, 233,  17, 168, 127, 159,  48, // B../.3.....0
- 136, 230,  23, 239, 254, 221,  59, 237,  54,  88, 225, 129, // ......;.6X..
-  20, 151,  96,  16, 162,   8,   9, 237, 142, 114, 188, 186, // ..`......r..
-   4,  84,  25, 180,  28, 157, 216, 250,  50,  93, 202,  13, // .T......2]..
- 189, 147,  56, 102, 166, 224, 202, 104,  34, 193, 137,  34, // ..8f...h".."
- 163, 191, 250,  88, 165, 244, 195,  81, 185, 233, 238, 227, // ...X...Q....
- 244,  28,   9, 140,  11, 209, 201,  65,  39, 255,  15,  17, // .......A'...
- 195,   9, 182, 178, 203,  97, 154, 146,  31,  68, 165, 170, // .....a...D..
- 140,  50, 159,  74,  38,  80,  23, 147, 245, 148, 168,  73, // .2.J&P.....I
-   5, 252, 225, 161, 100, 129, 253, 202,  14, 159,  40,   5, // ....d.....(.
- 234,  40,  57, 101,  61, 170, 178,  94, 101,  16, 175,  60, // .(9e=..^e..<
-   2,  51,  52, 165, 156,  39,  85, 206, 227, 136, 136, 248, // .34..'U.....
-  39,  68,  63,  43, 220,  63, 239,   8,  29, 249,  19,  23, // 'D?+.?......
- 252, 107, 202, 122,   2, 180,  46, 121,  23, 186, 110, 211, // .k.z...y..n.
- 146, 210, 100, 149, 206, 239,  27,  70,   6, 109,  24, 202, // ..d....F.m..
- 250,  96, 178, 232, 222, 167,  23, 124,  10, 122, 120,  33, // .`.....|.zx!
- 169, 192,   8,   4, 145,  78,  94, 132, 137, 140, 234, 207, // .....N^.....
-  42, 235,  81,  52, 213,  24,  29,  37, 134, 174, 198,  97, // *.Q4...%...a
- 226,  24, 131,  26,  15, 246, 165, 195,  88,  22, 222,  58, // ........X..:
- 128,  93, 138, 228,  10,  43, 143,  99, 129, 137,  95, 153, // .]...+.c.._.
- 194,  16, 124, 181, 125,  14, 184, 145, 236, 170, 180,  20, // ..|.}.......
- 111, 195, 113, 151, 161, 254,  81,   1, 178,  48, 109, 196, // o.q...Q..0m.
-  91, 139,  62, 195,  68,  98, 169,  35,  26,  77,  75,  71, // [.>.Db.#.MKG
- 142, 239,  71, 248, 167,  15, 243, 202, 247,  35,   1,  30, // ..G......#..
-  17, 248,  86,  91, 144, 101, 223,  24,  31, 235, 214, 167, // ..V[.e......
- 152, 177,  98,  59,  99,  73,  33, 161, 165,  22,  39,  74, // ..b;cI!...'J
-  25,  39,   2, 167,  57, 247,  23, 188, 149,  57,  26, 147, // .'..9....9..
-  17, 125,   0, 250,  22,  18,  56, 245,  51, 150, 174,  67, // .}....8.3..C
-  98,   9, 141, 116, 235, 177, 188,  85, 230,  37, 146,  87, // b..t...U.%.W
- 236, 213,  77, 157,  82,  25, 178, 232, 125, 151,  67,  78, // ..M.R...}.CN
- 157,  33, 123,  25, 143,  54, 147, 209, 230,  28, 212, 195, // .!{..6......
-  25,  45, 193, 188,  29,  45, 123, 132, 145, 168,  38,  28, // .-...-{...&.
- 211, 132, 186,  98,  81,  21,  98,  53, 216,  84, 122, 141, // ...bQ.b5.Tz.
-  25, 181, 211,  44, 191,  98,  94,  23,  20,  83, 185,   2, // ...,.b^..S..
- 101,  65,  87, 220, 112, 230, 112, 156, 133, 201,  55, 185, // eAW.p.p...7.
-  92, 159,  87, 178, 212,  82,  76, 234, 152, 207,  37, 159, // ..W..RL...%.
- 107,  76, 125,  92,  41, 218, 250, 130,   8, 248, 165,  87, // kL}.)......W
- 186,  18, 171, 233, 162,  49, 193,  39,  84, 111,  82, 210, // .....1.'ToR.
-   8,  53, 165, 235, 223, 133, 215,  13, 202, 164, 116,  77, // .5........tM
-  32, 222, 125, 160, 214, 214, 103,  52, 200, 233, 137, 214, //  .}...g4....
- 192, 218,  43, 141, 197,  76, 105,  34,  54,  74,  35,  99, // ..+..Li"6J#c
- 140, 116,  84,  18, 181, 135, 225, 208, 142, 201, 208, 182, // .tT.........
-  39,  72, 193, 147, 218,  23, 106, 249, 148,  18, 248, 105, // 'H....j....i
- 142,  28, 166,  70, 123, 236,  72, 245,  84,  92, 160,  98, // ...F{.H.T..b
-  28, 251, 114,  90,  93, 132, 167, 255, 234, 110, 116, 123, // ..rZ]....nt{
- 165, 245, 238,   9, 140, 135, 194,  83,  58, 137,  27, 255, // .......S:...
-  28, 143, 199, 141, 224, 208,  90, 251, 117, 224,  42, 192, // ......Z.u.*.
- 208, 177, 183, 111,  95, 108, 183,   1,  69, 231, 124,   6, // ...o_l..E.|.
-  84,  10,  67,  23, 234, 130,  46, 143, 164, 100,  74, 183, // T.C......dJ.
-  91, 167,  27,  93, 112, 165,  59, 252,  64, 179, 220, 109, // [..]p.;.@..m
- 158, 130,  49, 189, 217,  60, 237, 121, 251, 142, 221, 134, // ..1..<.y....
-  47, 118, 173, 165, 238, 109, 210,  79,  94, 121, 135, 234, // /v...m.O^y..
-  84,  13,  69,  13, 102,   8,  53,  24, 117, 194, 214, 101, // T.E.f.5.u..e
-  71, 106, 196, 122, 117, 167, 180, 149,  76, 118,  30,  74, // Gj.zu...Lv.J
- 129,  56,  60,  33,  12, 105, 159, 240,  35,  66, 168,   8, // .8<!.i..#B..
-  15, 162,  43, 215, 209, 145, 100, 171, 162, 146,  37, 237, // ..+...d...%.
-  56,  19,  48,  80, 140, 136,  77,  95,  43, 191,  12, 112, // 8.0P..M_+..p
-  24, 114, 130, 235, 221,  77,  56,  13,  61,  59, 171, 172, // .r...M8.=;..
- 116, 192, 218, 152,  61, 253, 216,  59, 197,  41, 114, 202, // t...=..;.)r.
- 232,   9, 107,  32, 159,  82, 211, 193, 105, 233,   1,  82, // ..k .R..i..R
- 102, 188,  55,  52, 152, 230, 105,  21,  95, 201,  30,  16, // f.74..i._...
- 216,  94,  56, 106,  10,  70, 220, 113, 210,  40,  93,  29, // .^8j.F.q.(].
-  52, 216, 113,  69, 207,  49, 193,  97,  47, 254, 178, 161, // 4.qE.1.a/...
- 110, 181, 161, 115, 105, 118, 215, 173, 206, 220,  59,  17, // n..siv....;.
-  13,  14, 191,  79, 115, 172,  75,  16,  77, 124,  66, 234, // ...Os.K.M|B.
-  16,  72, 202, 234, 149,   0, 198, 124, 130,  23, 185, 185, // .H.....|....
-  48, 223,   2, 173, 251, 102, 154,  97, 181,  95, 168,  83, // 0....f.a._.S
-  24, 192, 220, 106,  67, 148,   1,  14,  84,  85,  44, 174, // ...jC...TU,.
- 138, 193, 134, 111,   1,  22,  90,  23, 170, 117, 225, 110, // ...o..Z..u.n
- 138,  87, 117, 235, 164, 202,  96, 144, 102, 223, 117, 187, // .Wu...`.f.u.
- 160,  60, 234, 102, 118, 117,  53, 246, 205,  61,  39, 154, // .<.fvu5..='.
- 105,  83, 110,  31,  67, 134,  87, 172,  89, 245,  54, 163, // iSn.C.W.Y.6.
- 206, 199, 125, 111, 243, 118, 228, 135, 225,  38,  43, 179, // ..}o.v...&+.
- 113, 250, 216,  87, 195, 170, 212, 144, 230, 244, 139, 199, // q..W........
-  78,  21, 147, 239, 212,  27,  83, 245,  65, 247, 118,  68, // N.....S.A.vD
-  56, 135,  73, 119,  42,  58,  69,  58, 183, 163, 218,  56, // 8.Iw*:E:...8
- 126, 217, 188, 171,  12, 231,  54, 228,  93, 239, 223, 253, // ~.....6.]...
- 212, 154, 242, 103,  53, 107, 223, 203, 251,  67, 248,  24, // ...g5k...C..
- 110, 200, 137, 157, 104, 210,  47, 174, 169,  39,  93,  71, // n...h./..']G
-  13,  10,  85, 166, 129, 142,  22, 227,  63,  62, 168, 181, // ..U.....?>..
-  92, 226, 146,  85, 212,  48, 181,  47, 134,   4, 252,  75, // ...U.0./...K
-  29, 214,  47, 117, 171,  34, 184, 180,  51, 206, 168,  33, // ../u."..3..!
-  67, 239, 151,   1, 134, 245,  73,  16, 243,   1, 133,  93, // C.....I....]
- 245, 109,   1, 192, 134,  10, 147, 254,   6, 254, 194,  24, // .m..........
- 146,  34, 158, 250,   3, 125,  24, 167,  98,  97, 206, 251, // ."...}..ba..
- 174,  52,  71,  13, 179, 166, 145,   1, 108, 178,  27, 144, // .4G.....l...
-  60, 200, 217, 202,  52, 233, 123, 147,  48,  83,  71, 225, // <...4.{.0SG.
-  33,  45, 209, 152, 158,  70, 244, 244, 179, 240,  32, 230, // !-...F.... .
- 123, 232, 194,  67,  40,  55,  52,  48,  14,  71, 124,   1, // {..C(740.G|.
-   6, 147, 240, 136,  31,  48,  16,  99, 173,  14, 103, 215, // .....0.c..g.
- 202,  32,  80, 244,  10, 183,  28, 126, 175, 154, 115,  81, // . P....~..sQ
-  79,  89, 252, 180, 214,  80, 181, 134, 238,  20, 181,  65, // OY...P.....A
-  26, 215, 185,  62, 124, 146,  25, 160, 176, 188,  87, 145, // ...>|.....W.
- 198,  83, 138,  16,  73, 158, 168, 125,  24, 226, 183, 212, // .S..I..}....
- 253,   8,  10, 163, 234, 189, 160,  60,  94, 150, 213, 101, // .......<^..e
- 217,  57,  76, 245,  68,  42, 157, 116,  84,  66,  71, 248, // .9L.D*.tTBG.
- 166,  74, 238, 170, 228, 142,  74, 182,  84, 114,  95,  37, // .J....J.Tr_%
-  15,  84, 114,  79, 165,  90, 165,  68, 249, 211,  10, 178, // .TrO.Z.D....
- 152,  54, 101,  57, 109,  10,  95, 121, 213, 109, 155, 198, // .6e9m._y.m..
- 132, 249, 115,  78,  61, 212,  78,  94,  39, 168, 136,  44, // ..sN=.N^'..,
-  65, 160, 213, 156, 117, 193, 202, 204, 208, 241, 132,   2, // A...u.......
- 138, 226,  50,  77, 161, 176, 242, 200,  75, 225, 178, 148, // ..2M....K...
-   5, 174,  78, 129, 169,  39, 140, 154, 187,  52,  17,  75, // ..N..'...4.K
- 212, 213, 127, 162,  87, 195,  42,  52,  21,  50, 136,  25, // ....W.*4.2..
- 177, 242,  30, 100, 125, 129,  38, 162, 139,  55, 242,   9, // ...d}.&..7..
- 197, 106,  55, 201, 115, 127, 254, 215,  59, 176, 150,  32, // .j7.s...;.. 
- 208,  62, 179, 111, 148,  37,   9, 123, 181,  70, 235, 189, // .>.o.%.{.F..
-  11, 241, 102,  40,  69,  71, 249, 128,  53,  72, 244, 221, // ..f(EG..5H..
-  82,  95, 238, 174,  81, 187,  55, 188, 162,  18, 251,  52, // R_..Q.7....4
-  17,  94, 104,  72, 136, 252, 242, 195,  21, 108,  49, 194, // .^hH.....l1.
- 171, 223, 121, 172,  45,  88,  70, 175, 113,  20, 216, 124, // ..y.-XF.q..|
-  97,  81,  39, 143,  45, 178,  96, 148, 234, 204, 101, 159, // aQ'.-.`...e.
- 138, 130,  24, 102,  70,  84,  21,  25, 234, 104,  17,   5, // ...fFT...h..
- 159, 131, 200,  47,  21, 252,  13, 154, 104, 194, 129, 148, // .../....h...
- 172, 200, 100, 192, 177,  25, 115, 229, 136,  18, 244, 235, // ..d...s.....
-  95, 118,  29, 242, 173,  24, 167, 140, 117,  99,  12,  21, // _v......uc..
-  50, 124, 124, 234,  40,  11, 102,  37, 119,  86, 140,  73, // 2||.(.f%wV.I
-  77, 102, 187,  84,  35, 212,  97,  94,  13, 221, 181,  23, // Mf.T#.a^....
- 134, 130,  72,  53, 248, 188,  28,  60, 184,  18,  31,  60, // ..H5...<...<
-  41, 201,   4, 188,  34, 162,  64,  82, 168,  22, 167, 248, // )...".@R....
- 173, 100, 149, 121,  70,  92, 106, 219, 146, 174, 180, 128, // .d.yF.j.....
- 171, 205, 166, 178, 228, 235,  54, 215, 160, 196, 221,  86, // ......6....V
- 203,  55,  58,  90, 201,  31,  66, 227, 114, 111, 120, 217, // .7:Z..B.rox.
-  53, 147, 101, 205, 209,   4,   0, 169, 210,  87, 143, 176, // 5.e......W..
- 103,  58,  56, 103, 192, 211,  41, 151, 221, 176,  65, 246, // g:8g..)...A.
-  11, 174,   8, 240,  26, 208, 196, 242,   2,  34, 122, 183, // ........."z.
-  12,  91, 196, 135,  70, 189, 185, 146, 205, 180,  23, 218, // .[..F.......
- 195, 129,  29, 250, 201, 156, 198, 161, 113,  61, 165,   6, // ........q=..
- 116,  54, 239, 133, 220, 227, 144, 201,  20,  53, 166, 159, // t6.......5..
- 216, 162, 254,  67,  30, 214,  80, 209,  18, 228, 208, 170, // ...C..P.....
- 196, 202, 154, 113,  25, 145, 254, 152,  75, 140,  81,  34, // ...q....K.Q"
- 222,  83, 112,  38, 149, 149,  37, 100,   2, 178, 202, 244, // .Sp&..%d....
-  12, 207, 209,  57, 107, 225, 186,  78, 119,  32, 184, 118, // ...9k..Nw .v
-   1,  28, 196, 151, 236,  36, 243,  90, 250,  85,  79,  29, // .....$.Z.UO.
-  42,  78,  91,  13,  77, 222, 187, 220,  21, 129, 158,  24, // *N[.M.......
- 232,  56,   4,  72,   8,  48,  44,  83,  97, 254,   6, 113, // .8.H.0,Sa..q
-  81,   9,   5,  73,   5, 194, 243,  58, 136,  46, 186,   5, // Q..I...:....
- 178, 219, 170, 218,  35, 104,  66, 222, 157, 161, 203,  16, // ....#hB.....
- 165, 135, 164,  60, 119,  43,   3, 229, 218, 176, 185, 176, // ...<w+......
- 236, 150, 159, 140, 203,   4,  86, 191, 156,  19,  22, 233, // ......V.....
-  28, 183, 169,  51, 204,  76, 174, 169,  28, 135, 147, 236, // ...3.L......
-   7,   6, 212,  91,  50, 251,  87,  87,  12, 152, 183, 100, // ...[2.WW...d
- 254, 253, 203, 220,  89, 152, 188,  90, 152, 158, 221,  61, // ....Y..Z...=
- 162, 253, 152, 139, 102, 230,  38, 187, 215, 201, 164,  65, // ....f.&....A
- 225, 181, 192,  94, 208, 110,  44,  99,  51, 104,  95,  89, // ...^.n,c3h_Y
- 139, 211, 169,  66, 221, 185,  85,  16, 228, 210, 169, 130, // ...B..U.....
- 207,  70, 216, 172, 132, 241,  81, 230, 180,  47,  28, 235, // .F....Q../..
-  95, 175,  33, 251, 162, 154, 110,  96, 254,  66, 116,  73, // _.!...n`.BtI
- 170, 219, 146,  46, 195,  82, 228, 123,  45,  15, 186, 159, // .....R.{-...
- 190, 168,  52,  25, 118,  25, 123, 122,   6, 255, 182,  87, // ..4.v.{z...W
- 242, 140,  43, 150,  23, 110, 226, 251,  33, 243, 189,  22, // ..+..n..!...
-  47, 131, 187, 190, 156, 232, 124, 167, 194, 217, 243, 221, // /.....|.....
-  80, 212, 165, 234,  87, 148,  76,  40, 244, 177,  12, 223, // P...W.L(....
- 177, 119,  75, 247,  44,  96,  93,  87, 164, 191,  85,  50, // .wK.,`]W..U2
- 129,  29, 157,  27,  19, 100, 224, 178,  50, 186, 114,  15, // .....d..2.r.
- 192, 204,  53,  23, 114,  14,  73,  94,  44, 211,  24, 244, // ..5.r.I^,...
-  70,  60,  99, 166, 197, 198, 115,  52,  32, 243, 202, 143, // F<c...s4 ...
- 172, 234,   5, 179, 104,  73,  99,  79, 129, 110, 145, 182, // ....hIcO.n..
-  45,  98, 142,  92,  99, 214, 197, 196, 120, 204, 148, 120, // -b..c...x..x
-  52,  39,  60, 107,  64,  72, 219,  94, 120,   3, 179,   2, // 4'<k@H.^x...
- 160, 249, 220,  42, 125,  91, 137,  75,  76, 176,  38,  46, // ...*}[.KL.&.
-  70, 195,  92, 188,  53,  26, 107,  85, 209, 230, 203, 174, // F...5.kU....
-  53, 230, 248,  16,  32, 218,  18,  17,  36, 149, 158, 114, // 5... ...$..r
- 160, 210, 152, 195, 152,  70, 116, 106, 103,  27, 233,  90, // .....Ftjg..Z
- 140,  59, 111, 148, 217,  13,   7,  71,   5,  69, 152, 174, // .;o....G.E..
- 233, 141,  88, 100, 157, 208,  17, 233, 220, 219,  14, 243, // ..Xd........
- 166, 183, 181,  77, 176, 121, 110,  66,  73,   7, 109,  43, // ...M.ynBI.m+
- 153, 149,   8, 188, 226, 126, 183, 217, 140, 126, 179, 246, // .....~...~..
-  54,  54,  27, 206, 238, 231, 172,  96,  77, 159,  16, 167, // 66.....`M...
- 195, 124,  74, 159, 192, 191, 206,  39, 128,  56, 192,  31, // .|J....'.8..
-  57, 169,  51, 227,  34, 223, 170, 222,  24,  51, 176,  48, // 9.3."....3.0
-   3, 235,   4,  88,  50, 204, 225, 254, 213,  21, 253,  26, // ...X2.......
- 171, 226,  50, 115,  23, 123,  88, 153, 121,  97,  17, 248, // ..2s.{X.ya..
- 129, 143, 145, 146, 250, 234,  98, 233, 121, 251, 250, 226, // ......b.y...
- 124, 208, 188, 245, 135,  11, 134,  96,  67,  53, 113, 179, // |......`C5q.
-  41, 117, 104,  13, 193, 134, 108,   8,  54,  37, 188, 185, // )uh...l.6%..
- 180, 122, 162,  39, 121, 144, 179, 182,  50,  70,  24,  83, // .z.'y...2F.S
- 223,  51,  96, 196, 242, 211,  43, 141, 193,  66, 182, 187, // .3`...+..B..
-  74, 172, 153,  17,  21,  29, 161,  12, 205, 176, 177, 114, // J..........r
-  75,  68,  53, 172, 103, 126, 195, 247, 158, 117, 152,  47, // KD5.g~...u./
-  69,  17, 112,  69, 142, 220,  35,  40, 145, 115,  33, 126, // E.pE..#(.s!~
- 102, 224, 228, 173,  60, 167, 149, 225, 184,  22,  63, 219, // f...<.....?.
-  73, 201, 241, 181, 157,  36, 251,  38, 145, 153,  75, 206, // I....$.&..K.
- 176, 251, 193, 105, 125,  45,  20,   0,  55, 175, 248, 141, // ...i}-..7...
- 150, 134, 187, 161, 163, 153, 166, 110, 147, 217, 137,  96, // .......n...`
- 173, 176,  26,  18, 180, 110, 173,  90,  71, 169,  64,  41, // .....n.ZG.@)
- 170, 146, 254, 156, 207, 132,  45,  57,  19, 238,  48, 246, // ......-9..0.
- 250, 218, 211, 127, 208,  34,  21, 207, 225, 218, 159,  30, // ....."......
- 217,  36,  77,  21, 191, 155,  87, 186, 248, 223, 154, 199, // .$M...W.....
- 156, 229, 134, 244, 248, 169,  42, 255, 169,  94, 254,  83, // ......*..^.S
-  85, 254,  83,  85, 254,  37,  82, 191, 153,  71,  74, 125, // U.SU.%R..GJ}
-  70, 187, 227, 133, 209,  72, 249, 226,  21, 223,  96, 141, // F....H....`.
-  71,   9,  70,  13, 142,  82, 158, 113, 138, 115, 212,  92, // G.F..R.q.s..
- 238, 235,  36, 208, 138, 247, 125, 169,  98, 153,  42, 232, // ..$...}.b.*.
- 243,   5, 153, 248, 196, 205, 231, 190, 235, 147,  73,   3, // ..........I.
- 139, 180, 252,  22, 128, 111,  24, 118, 122,  28, 137, 190, // .....o.vz...
- 223, 192,  49, 218,   8, 100, 224,  89,  11,  44, 124, 152, // ..1..d.Y.,|.
- 123, 194, 253,  69, 222,  79, 177, 213, 148,  41, 200,  67, // {..E.O...).C
- 164, 146,  50, 178,   6, 220, 185, 152,  28, 182, 219, 147, // ..2.........
- 134, 232, 181, 248,  61,  48, 243, 129,  60,  83,  58,  48, // ....=0..<S:0
- 213, 145, 255,  53, 192, 172,  72,  80, 119, 171, 164, 204, // ...5..HPw...
- 207, 180, 160,  63,  64, 202,  38,  15, 193,  10,  79, 158, // ...?@.&...O.
- 128,  43,  13, 238, 243, 159,  97, 242, 206, 176,  75,  94, // .+....a...K^
- 134,  68, 227, 236, 178,  44, 165, 120,  78, 200, 252, 171, // .D...,.xN...
- 171, 171, 226, 119, 250, 253,  78, 191, 111, 233, 151, 208, // ...w..N.o...
- 230, 226,  43, 253, 190, 167, 143, 229, 227, 208,  92, 151, // ..+.........
- 197, 219,  13, 184, 212,  12, 139, 175,  27, 197, 251,  94, // ...........^
-  37, 132, 134, 125, 200, 125, 247,  58, 241,  47, 205, 243, // %..}.}.:./..
-  90, 168, 161, 252,  68, 223, 182,  70, 180, 117, 178, 121, // Z...D..F.u.y
- 251, 246,  71, 143, 232, 176,  47, 158, 201, 247,  85,  41, // ..G.../...U)
-  61,  78, 238, 114,  38, 162, 142, 113,  54, 213, 241,  77, // =N.r&..q6..M
-  94,  45,  94, 100,  37, 216,  20, 247,  37, 201,   5, 161, // ^-^d%...%...
- 116, 220, 207,  57,  63,  20,  16,  77, 239, 179,  22, 219, // t..9?..M....
- 169, 199, 153, 108, 117,  77, 207, 231, 230,  89,  26, 197, // ...luM...Y..
-  29, 156,  30, 149, 227, 127,  64, 192, 126,  84,  93, 135, // ......@.~T].
- 233, 145, 213, 174,  40, 209, 249, 132, 163,  80,  30, 149, // ....(....P..
- 223, 101, 139, 152, 103, 243, 141, 244,  36, 171, 197,  47, // .e..g...$../
-  79, 253, 215,  94, 122, 136,   3, 242, 136,  58,  39,  12, // O..^z....:'.
- 247,  21, 212,  91, 139, 239,  97, 241,  59, 116, 160,  49, // ...[..a.;t.1
- 146, 247,  52, 157, 115, 123,  71, 195, 209, 135, 236, 172, // ..4.s{G.....
- 206, 188, 248, 198,  23, 255,  51, 177, 141,   3, 179,  70, // ......3....F
-  71,  57,  59,   7,  65,  96,   2,  11, 238,  21, 152,  87, // G9;.A`.....W
- 182,  76, 143,  81,  18, 102,  36, 109, 151,  76, 230, 128, // .L.Q.f$m.L..
-  82, 182,   8, 140,  21, 202, 175, 199, 199, 123, 233,   9, // R........{..
-  77, 135,  47,  74, 213, 190,  42,  87,  22,  11, 235, 165, // M./J..*W....
- 143,  69,  12,  77, 247,  35, 239, 243, 251, 178, 221,  39, // .E.M.#.....'
- 182, 140,  85, 135,  47, 238, 161, 240, 107, 207,  23, 173, // ..U./...k...
- 108,  26, 193,  19,  16, 187,  79, 112, 177,  86, 142,   6, // l.....Op.V..
-  58,  60, 138,  92,  71, 163,  11,  12, 131,  37, 155,  66, // :<..G....%.B
- 127,  59, 148, 240, 204, 229, 112,  47,  26,  81,  25, 204, // .;....p/.Q..
- 212,  82, 117,  85, 136, 241,  18, 221, 116, 189,  64, 104, // .RuU....t.@h
-  80,  22, 204,  33,  96,  77, 100, 193,  84, 129, 110, 178, // P..!`Md.T.n.
-   2,  39, 136, 156,  66, 144,  69,   3, 229,  72, 234,  57, // .'..B.E..H.9
- 102,  39, 166, 138,  54,   4,  94, 167,  34, 130,  75,  83, // f'..6.^.".KS
- 150,  91,  82, 146, 174,  90, 221, 234, 220, 149, 246,  90, // .[R..Z.....Z
- 133, 131, 153, 244, 216, 224, 232, 246, 237, 110, 105,  68, // .........niD
-   4, 251,  63, 195,   2,  65,  79,  31, 228, 215,  80, 101, // ..?..AO...Pe
- 210,  35, 167,  89, 186, 204, 208,  24, 182,  35, 254,  33, // .#.Y.....#.!
- 240,  87, 130, 157,  21, 140, 151,  25, 205, 245,  57,  91, // .W........9[
- 220,  23, 195, 163,  26,  86, 129,   5, 185, 100, 142,   3, // .....V...d..
- 216,  28, 133, 194,  60,  17,  16,  32, 158,  81,  65,  95, // ....<.. .QA_
- 145,  59,  18, 166, 122, 228,  83,  47, 141,  69, 237,  33, // .;..z.S/.E.!
- 215,   0,  29,  27,  27, 250, 146,  78, 125, 186,  37,  88, // .......N}.%X
- 252, 127,  11, 120, 239,  50, 233, 106, 192,   3,  82,  70, // ...x.2.j..RF
- 249,  24, 168,  27, 157,  65,  98,  55,  63, 228, 101,  31, // .....Ab7?.e.
- 179, 166, 112,  30,  29, 170, 116,  18, 166, 227, 117, 162, // ..p...t...u.
-  93,  71, 248, 189, 168, 208,  84, 156,   6, 231, 248, 233, // ]G....T.....
- 136,  58, 151, 209,  73,  57,  39, 100, 246, 147, 207, 160, // .:..I9'd....
-  10, 220,  56, 233, 214, 114,  47,  76, 174,  99, 216, 148, // ..8..r/L.c..
- 108, 134, 224,   4, 221,  13,  19,  56,   5, 196,  91, 151, // l......8..[.
- 223,  96,   5,  88, 148,  58, 190,  41,  43, 199, 224, 244, // .`.X.:.)+...
- 145,  97,  30, 137,  99, 133, 132,  54,  30, 107, 248,  89, // .a..c..6.k.Y
-  87, 225,  28, 155,   4,   8,  35, 188, 255, 181, 203,  56, // W.....#....8
-  50, 240,   2, 216, 182, 250, 212,  48,   1,  49, 117, 169, // 2......0.1u.
- 143, 195, 208, 236, 184,  62,  15,  84, 210,  27, 216, 134, // .....>.T....
- 104, 171, 175,  63,   5, 250,  15, 223, 152, 215, 148, 251, // h..?........
- 224, 164, 148, 243, 167,  86, 179, 109, 129, 120, 163, 163, // .....V.m.x..
-   5, 172,  17,  86,  79, 225,  35, 234,  41,   7, 200,  57, // ...VO.#.)..9
-  68, 252,   2,  86, 163, 179,  34, 113, 123, 200,  72, 191, // D..V.."q{.H.
- 110, 236, 161, 244, 212, 178, 106, 121, 223, 137,  33,  22, // n.....jy..!.
- 163, 187,  53,  23,  47, 233, 190, 232, 201,   0,  55,  45, // ..5./.....7-
- 249,  64,  80, 152, 116,  37,   2, 162,   7, 115,  43, 124, // .@P.t%...s+|
- 107, 111,  74, 195,  62,  34, 138,  14, 134, 152,  39,  98, // koJ.>"....'b
-  81,  90, 211,   3,  51,  14,  66,  43, 245, 214,  12, 104, // QZ..3.B+...h
-  51,  68,  80, 185, 209, 243,  43, 248,  50, 205,  40, 135, // 3DP...+.2.(.
-  10, 244,  82, 171, 167, 105, 156,  84,  16,  14, 204, 114, // ..R..i.T...r
-  58, 248, 208, 179,  29,  40, 253, 117, 144, 237, 201,  51, // :....(.u...3
-  44,  23,  74, 154, 103, 159, 146,  89,  35,   6, 217, 162, // ,.J.g..Y#...
-  79, 151,  17,  62,  30,  23,  23, 108,  68,  51, 162, 173, // O..>...lD3..
- 117,  34,  69, 248, 247,  90,  17,  54, 140, 120, 139, 239, // u"E..Z.6.x..
- 161,  25, 229, 221, 230, 149,  90, 255, 150,  51, 177, 228, // ......Z..3..
- 227,  24, 151, 239, 181, 183, 241,  17, 154, 189,  28,  26, // ............
- 172, 130,  14, 200,  84, 116,  58, 165,  54, 156, 197, 143, // ....Tt:.6...
- 250, 220, 183, 137,  86, 195,  31, 194, 112,  67, 135, 198, // ....V...pC..
-  49, 171,  63,   6, 176, 197,  20,  77, 200, 186, 166, 207, // 1.?....M....
-  71, 249, 176,   5, 213,  44, 209, 146,  24, 247,  61,  90, // G....,....=Z
- 232, 116, 209,  89,  70, 197, 243,  98, 137, 127, 186, 232, // .t.YF..b....
-  18, 218, 201, 103,  13, 138, 116,  73,  53,  86, 149,  48, // ...g..tI5V.0
- 202,  23, 169,   3, 105,  70, 103,   8, 102,  54, 248, 226, // ....iFg.f6..
-  55, 245, 228,  92, 116,  11, 204, 225,  32,  91,  44,  61, // 7...t... [,=
- 177, 135, 133,  40,  88, 165, 251,  74, 180, 188,  30, 193, // ...(X..J....
- 219,  92,  93, 199, 235,  47,  59,  13,  81, 250, 123, 169, // ..]../;.Q.{.
- 209,  85, 233, 133, 125, 175, 244, 194, 218, 236,  10,  70, // .U..}......F
-  58,  94, 214, 209,  59,  79, 127, 135, 191, 205,  74, 255, // :^..;O....J.
- 107, 161, 148, 108,   8, 166, 254, 191, 151, 156, 223, 160, // k..l........
- 234, 150,  29,  28, 201, 129, 114,  17,  94,  74,  20, 164, // ......r.^J..
-  91, 109,  71, 164, 155, 158, 123, 117, 137, 247, 103,   8, // [mG...{u..g.
- 182,  83, 198, 210, 139,  13, 221,  98, 199, 198,  98, 148, // .S.....b..b.
- 192, 168, 161, 165,  80, 139, 183,  61, 155, 195, 101,  33, // ....P..=..e!
- 174, 254, 234, 183, 104, 194, 217, 115,  55, 102, 128, 211, // ....h..s7f..
- 243,  86,  97, 149, 102,  51, 230, 118,  32,  40,  99, 179, // .Va.f3.v (c.
- 216, 200, 215, 188,  76,  28,  31, 197,  16, 150, 101, 150, // ....L.....e.
-  35,  34,  36,   5,  33, 178, 211, 190,  78,  16, 249,  35, // #"$.!...N..#
-  98, 238, 198, 180, 207, 178, 147, 176,  67,  48, 253, 121, // b.......C0.y
-  29, 220,  13, 250, 246, 181, 194, 247,  34, 149,  89, 110, // ........".Yn
- 135, 227, 189,  56,  53, 154, 235, 124,  30,  69, 202,  96, // ...85..|.E.`
-  79, 208, 146, 224, 148, 172,  68, 162,  66,  87, 172, 146, // O.....D.BW..
- 158,  57, 181,   4, 169,  22,   4, 171, 172, 152,  87, 120, // .9........Wx
-  22, 106,  98, 215,  26,  77, 207,  67, 245,  80, 233, 107, // .jb..M.C.P.k
- 154, 158, 229,  14, 125,  43, 154, 166,  12, 186, 203,  52, // ....}+.....4
-  61, 253, 210,  85,  18, 204,  73, 168, 161,  15, 112, 236, // =..U..I...p.
-  41,  34, 124, 196,  61, 155,  74, 198, 210,  24,  99,  31, // )"|.=.J...c.
- 188,  20, 225, 130, 232,  14, 164, 217, 103,  67,  17,  17, // ........gC..
- 101, 206, 203, 170, 159, 163,  36,  76, 207,  93, 111,  76, // e.....$L.]oL
- 149, 183,  95,  92,  84, 224, 109,  87, 126, 157, 132, 213, // .._.T.mW~...
- 157, 176,  75, 148, 183, 248, 109,  19,  37,  33, 110, 158, // ..K...m.%!n.
- 202, 172,  77,  24, 168,  36, 240, 208, 208, 246,  13, 252, // ..M..$......
-  62,  22, 107, 157, 202, 141, 176, 104,  20, 155, 187,  77, // >.k....h...M
- 179, 215, 125, 139, 208, 177, 211,  97,   1, 203,  29, 199, // ..}....a....
- 238,  37,  61,   8, 210,  51, 149,  30, 179,  72, 216,  73, // .%=..3...H.I
- 114, 192, 245, 181, 124, 122, 105,  51,  72, 155,  13, 252, // r...|zi3H...
- 218, 190, 252,  92,  19, 180,  21,  67, 190, 164, 230, 126, // .......C...~
-  32, 166,  61, 112, 207, 132, 146,  68, 105,  12, 141, 192, //  .=p...Di...
-  13, 175, 140,  84, 210, 111,  88,  12,  57, 142, 178,  43, // ...T.oX.9..+
- 111,  89,  84,  96, 131, 243,  47, 182, 138,  17,   3, 245, // oYT`../.....
-  99, 191,  46, 151,  46, 125, 171, 177,  96,  28, 225,  94, // c....}..`..^
- 218, 108, 179,  40, 122,  87, 201,  31, 193, 140, 213,  36, // .l.(zW.....$
- 194, 226, 184, 159,  58,  36,  63, 106, 246, 251, 197, 107, // ....:$?j...k
-  99, 153, 238, 209, 130,  73, 174, 149,  14, 148, 174, 145, // c....I......
-  50,  22,  68,  64,  22, 138, 226, 151, 251,   1,  71,  19, // 2.D@......G.
-  51,  77, 177,  12, 132, 181,  94, 135,  44,  15, 226, 123, // 3M....^.,..{
- 197, 162, 201,  14, 219, 140, 213, 234, 203,  44, 191, 250, // .........,..
- 222, 166,  39, 146, 139, 107, 159, 109, 176,  94,  96, 219, // ..'..k.m.^`.
- 199, 117, 127,  58,  69, 232, 118,  15, 151, 223, 117,   6, // .u.:E.v...u.
- 106, 225,  23, 167,  80, 248,  35, 170, 105, 207, 209,  39, // j...P.#.i..'
-  93,  79, 179, 145, 254,  44,  22,  34, 131, 116,  79,   8, // ]O...,.".tO.
- 122, 160, 239, 106,   1, 113, 120,  45,  54, 186, 238,  70, // z..j.qx-6..F
- 125,  92,  83,  17, 234,  37, 247,  66,  72, 211,   8, 199, // }.S..%.BH...
-  75, 212, 128, 229, 106, 123,  64, 166,  88, 211,  20, 211, // K...j{@.X...
- 135,  20,  70, 216, 248,  20, 160,  87, 193, 180,  80, 220, // ..F....W..P.
- 193, 246,  42,  42,  49, 189, 145,  64,  68,  59, 246, 110, // ..**1..@D;.n
- 251,  20, 234, 200, 112,   8,  23,  77, 183, 114,   7, 130, // ....p..M.r..
-  57, 133, 121,  77, 219, 169, 224,  19, 201, 227, 171, 171, // 9.yM........
- 100, 117, 155, 182, 232, 101,  26, 138, 125,  81, 221, 191, // du...e..}Q..
- 232,  50, 176,  99, 223, 248, 215, 239,  92, 189, 120, 231, // .2.c......x.
- 246, 112,  32,  45, 156,  53, 214, 110, 182, 118, 232,  84, // .p -.5.n.v.T
- 214, 196, 158, 221,  11, 169, 172,  64, 219, 175, 226, 224, // .......@....
-  66, 235, 208, 234,  27, 150, 131, 165, 195, 137, 206,  19, // B...........
- 207, 217, 184,  69,  64, 115, 169, 191, 212, 206,  31,  58, // ...E@s.....:
- 174, 207,  60,  22, 220, 164, 108, 124, 149,  65,  69, 213, // ..<...l|.AE.
- 161, 169, 151, 128, 154, 144, 214, 134, 115,  73, 251,  39, // ........sI.'
-  65, 192,  44,   2, 101, 120,   7,  53,  23, 168, 145,  52, // A.,.ex.5...4
- 136, 184,  22,  98, 149,  65, 180,  23, 240, 111,   7, 143, // ...b.A...o..
- 208,  22,  42, 237, 242, 152, 151, 198, 156,  46,  53,  54, // ..*.......56
- 213, 135, 215, 170,  15, 171, 234, 195, 189,  30,  60,  60, // ..........<<
- 223, 187, 186,  26, 223,  10, 167,  87,  87, 195,  91,  97, // .......WW.[a
- 164, 184, 251, 112, 200,  43,  61,   9, 135, 144, 132,  23, // ...p.+=.....
- 193, 153, 103,  91, 104,  87,  45, 240, 163, 253, 210, 158, // ..g[hW-.....
-  21,  27, 197, 174,  97,   8, 208,  88,  51, 146, 113, 159, // ....a..X3.q.
-  22,  45, 216, 245, 198, 202, 232, 231, 126,  30, 196,  54, // .-......~..6
- 114,   9,  63,  47, 198,  51, 161, 219, 199,  52, 123, 106, // r.?/.3...4{j
- 177, 184, 177,  37,  30,  59,  11,  75,   1,  55, 179, 132, // ...%.;.K.7..
- 146, 226,  82, 149,  73,  24,  10, 195,  15, 213,  63, 109, // ..R.I.....?m
-  23,  37, 229, 122, 194, 230, 140,  12, 157, 183, 194,  18, // .%.z........
-   9, 224, 251, 196,  12,   6,  42, 124, 237, 237,  76, 220, // ......*|..L.
- 135, 229, 183,  66,   2, 227,  49, 191, 128,  69, 199,  97, // ...B..1..E.a
-  41,  56,  70,  72, 182,  61,  14, 198, 219,  89, 192,  47, // )8FH.=...Y./
- 120, 160,   4, 148, 248,  68,  20, 223, 183, 208, 242, 138, // x....D......
- 204,  27,  11,  34,  28,  10,  73, 135,  19, 112, 143,   9, // ..."..I..p..
- 189,  36, 184, 162,  39, 112,  96, 238, 213, 160, 221, 191, // .$..'p`.....
- 188, 181,  92,  59, 176, 104,  38, 189, 244,  86, 248, 195, // ...;.h&..V..
- 176, 151,   9,  74, 127, 176,  57,  58, 252, 129,  46,  53, // ...J..9:...5
- 141,  81, 117,  75,  27,  14,  52, 136, 241,  25, 230,  77, // .QuK..4....M
- 101, 160,  80, 233,   0,  57, 137, 149,  74,  91,  98,  80, // e.P..9..J[bP
- 161,  82,   5,   3,   4, 238, 212,  49, 112,  96, 187, 218, // .R.....1p`..
- 146, 139,  55, 133, 157, 166, 177,  27, 212, 161, 112, 121, // ..7.......py
- 253,  94, 110, 111, 200, 216,  94, 144, 214, 188, 134,  61, // .^no..^....=
- 211,   8, 166,  33,  83,  71,  69, 193, 130,  87, 112, 172, // ...!SGE..Wp.
- 230, 140, 199, 240, 115, 225, 174, 230,  38,  37, 198, 162, // ....s...&%..
- 217, 104, 208,  44, 101, 183, 194, 167, 213,  44,  61,  53, // .h.,e....,=5
- 179, 148,  85, 179, 100, 240,  26, 113, 181,  89, 166,  26, // ..U.d..q.Y..
-  52, 169, 158,  88,  69,  82, 133,  94,  72, 177, 209, 229, // 4..XER.^H...
- 108,  34,  64, 235,   5,  62, 226, 140, 237, 183, 146,  50, // l"@..>.....2
- 159,  16,  29,  51, 207, 152, 182,   8,  86,   0, 216,  92, // ...3....V...
- 185,  48, 209, 194, 216, 229, 161, 229, 134, 127,  22,  59, // .0.........;
- 188, 179, 249, 188, 198,  62,  75, 135, 190, 195,  38, 101, // .....>K...&e
- 129,  44,  60,  25, 133,  56, 231,  36, 224, 208,  32, 133, // .,<..8.$.. .
-  13,   0, 189, 159, 128,  47,  97, 132, 177, 101,  60,  89, // ...../a..e<Y
- 184, 189, 181,  37, 103,  85,  50, 216,   2, 188, 114, 147, // ...%gU2...r.
- 112, 182, 190, 207, 156,   1, 250, 189,  80, 233, 132,  48, // p.......P..0
- 125,  99, 140,  86, 249, 109, 191, 100,  74, 252, 136,  41, // }c.V.m.dJ..)
- 240,  67,  67, 143, 159,  88,  74, 252, 116, 206, 193, 112, // .CC..XJ.t..p
-  64,  98, 168, 253,  42,  18, 142, 160,  91, 240, 235,  94, // @b..*...[..^
-  34, 104, 234,  60,  44, 213, 126, 224, 193,  62,  66, 120, // "h.<,.~..>Bx
- 128, 210, 112,  37, 246,  18,  68, 103,  60, 167, 188,  73, // ..p%..Dg<..I
-  31,  91, 103, 191, 239, 205, 194,  35,  58, 237,  78, 104, // .[g....#:.Nh
- 215, 204, 194,  67, 122,  58, 197,  41,  39,  24,  90, 186, // ...Cz:.)'.Z.
- 227, 105, 237,  77, 232, 252, 189, 240,  88, 205, 103, 204, // .i.M....X.g.
- 103, 146,  26,  73,  74, 115,  88, 165, 249, 234, 149,  55, // g..IJsX....7
- 106,  77, 160, 154,  77, 181,  56, 210, 222,   1, 245,  50, // jM..M.8....2
- 234,  99, 115, 255, 164,  23, 172, 225, 177, 244, 178, 203, // .cs.........
- 189,  76, 209,  98,  46, 189, 236, 154,  94, 202,  52, 183, // .L.b....^.4.
- 151,  99, 234,  37, 183,  22,  85,  15,  61, 247, 178, 193, // .c.%..U.=...
- 169, 117, 175, 149, 192,  57,  10,  61, 166, 186, 149, 108, // .u...9.=...l
- 249,  70, 247,  86, 206, 138, 146,  51, 215, 211, 224,  61, // .F.V...3...=
- 209,  81,  98, 216,  55,  68, 252, 110, 227,   1,  39, 158, // .Qb.7D.n..'.
- 101, 229,  64,  17, 216, 166, 245,  12,  86,   6, 237, 227, // e.@.....V...
- 241, 250,  44, 141, 141, 252, 157,  14, 204,   9,  62,  23, // ..,.......>.
- 215,  27, 225, 249, 219,   4, 131,  56,  37, 248, 151, 151, // .......8%...
-  27, 178, 186, 109, 221, 167, 196,  91, 237, 128, 138,  64, // ...m...[...@
- 139,  61, 144,  30, 165,  15, 207, 128, 133, 180, 192, 229, // .=..........
-   8, 235, 159, 136, 166,  83, 201,   3,  10, 147, 251,  56, // .....S.....8
- 249,  11, 112, 128, 194, 228,   1, 158,  65, 192, 242,  58, // ..p.....A..:
- 113,  32,   2, 250, 220,  22,  43, 191,  83, 143, 102, 138, // q ....+.S.f.
- 240,  98,  52, 147, 126, 209, 204, 241, 245, 102,  48,  40, // .b4.~....f0(
-  89,  79, 191, 250,  18,  78, 105, 115,   5, 177, 109,   2, // YO...Nis..m.
- 148, 143,   9, 198, 195, 148, 206,  30, 122, 184, 160,  15, // ........z...
- 176, 248,   2, 163, 124, 137, 163,  63, 153, 126, 147,  61, // ....|..?.~.=
- 198, 106, 253, 229,  30, 235, 209, 147, 193, 254, 218, 123, // .j.........{
- 214,  25,  75, 127,  25, 122, 224,  27, 143,  92, 101, 249, // ..K..z....e.
- 142,  45,  95, 160, 252, 181,  59, 204, 196, 213,  38, 242, // .-_...;...&.
- 125, 172,  44,  26,  39,  39, 129, 241,  66, 159, 156, 150, // }.,.''..B...
- 138,  10, 117, 228,   6, 144,  33, 230, 206,  70, 139, 232, // ..u...!..F..
- 109, 159, 110,  61, 154, 132, 125, 239, 155,  65, 138, 104, // m.n=..}..A.h
-  52, 148, 212, 175,  99,  74, 148, 248, 205,  18, 107,  85, // 4...cJ....kU
- 193, 249, 156,  25, 204, 134,  68,  72,  21,  56, 205, 254, // ......DH.8..
-  34, 150,  42, 228,  79, 195, 178,  21,   4, 105,  13,  83, // ".*.O....i.S
- 177,  62,  77,  87, 195,   5, 254, 218, 174, 167, 153,  49, // .>MW.......1
-  74,  51,  37, 121,   1, 183,  99, 252, 112,  19, 225, 185, // J3%y..c.p...
-  26, 234,  79,  56, 174,  31, 225, 218, 138, 211, 195, 199, // ..O8........
-  73, 172, 211, 130, 249, 240, 174, 210,  97, 250, 177, 110, // I.......a..n
-  23,  81, 209, 159, 233, 176, 228, 245,  72,  68,  79, 198, // .Q......HDO.
- 135,  79, 168, 145,  47,  11, 239,  95,   1,  25,  63, 106, // .O../.._..?j
-  42, 133,  96, 184,  91, 151,  18, 165, 111, 137, 190, 203, // *.`.[...o...
- 143,  39, 146, 144,  94,  11, 195, 155, 119,  71,  84, 111, // .'..^...wGTo
- 137, 229, 166,  37,  16,  17, 118, 176,  74, 195, 218, 101, // ...%..v.J..e
- 215,  39,  46, 129, 172, 125, 142, 243, 205,  31, 249, 165, // .'...}......
- 149, 174,  26, 194, 177,  76, 251, 138,  52,  58,  98,  69, // .....L..4:bE
- 205, 131, 177, 105,  68,  55, 216,  46,  69, 240,  68, 109, // ...iD7..E.Dm
-   2,   9, 102,  73, 124,  10, 199, 143, 162, 244,  69, 192, // ..fI|.....E.
-  26, 187,  23,   2, 161, 147, 238, 233, 111,  68, 234, 145, // ........oD..
- 129,  72,  53, 160,  83,  29, 175, 246, 250,  96, 119, 162, // .H5.S....`w.
- 229, 245,  65, 247, 160, 132, 241,   4,  15,  43,  30, 105, // ..A......+.i
- 150, 197, 137,   7, 209,  26, 250, 127, 178, 136, 254, 171, // ............
- 211, 240, 168, 159,   6,   9, 221,   1,  71,  28,  93,  10, // ........G.].
- 192, 107,  96, 127, 216, 135,  75, 239, 161, 223, 215,  79, // .k`...K....O
-  17, 167,  22,  34,   7, 117,   8,  23,   7,  64,  15,  79, // ...".u...@.O
-  55, 188, 163, 126,  30, 100, 254, 218, 161,  65,  28,   9, // 7..~.d...A..
- 233, 235, 143, 232,  82,  28, 115, 133,  25,  42, 196, 123, // ....R.s..*.{
- 234, 196,  86, 216,  71, 133,  44, 200, 253, 181,  19, 181, // ..V.G.,.....
- 112, 106, 210,  46,  33, 186,  51, 197, 164, 206, 231, 240, // pj..!.3.....
- 129, 144, 128, 138,  40, 222, 194,  27, 160, 120, 125,  56, // ....(....x}8
-  65, 220, 156, 183,  56,  48,  56, 231,  43,  92, 213,   3, // A...808.+...
-  54, 144, 147,  50, 209, 227,  43, 104, 255, 222,   9, 137, // 6..2..+h....
- 112, 218, 162, 166,   6, 172, 208,  88,  35, 182, 112,  10, // p......X#.p.
-  65, 215, 156, 118,  32, 232, 126, 218, 168,  38, 116, 240, // A..v .~..&t.
-  72, 143, 227, 148, 131, 116, 235, 188, 184,  64, 209,  70, // H....t...@.F
- 206, 160, 126,  73,  80,  30, 192, 139, 252, 117,   8,  73, // ..~IP....u.I
-  87, 173, 227, 221, 244, 105, 120, 105, 121, 221, 150, 203, // W....ixiy...
- 109, 121, 224, 204, 251, 118, 121,  90,  15, 161, 239,  72, // my...vyZ...H
-  67, 126,  90, 119, 125, 158, 190, 171, 239,  21, 136,   2, // C~Zw}.......
- 218,  74,  14, 109, 115,  10, 242,  17,   8, 208, 191, 182, // .J.ms.......
-  29,  68,   4,  85, 241,  29, 138,  71, 222,  72,  17, 110, // .D.U...G.H.n
- 240,  72, 210, 223, 120,  19, 156,  81, 162, 224, 105, 206, // .H..x..Q..i.
-  40, 102,  93,  98, 244, 130,  34, 196,  60, 208, 200, 160, // (f]b..".<...
-   8,  83, 251,  25, 179, 121, 152,  30, 245, 190, 210, 133, // .S...y......
- 243, 156, 168, 141, 239,  33, 193,  64,  26, 206,  20, 223, // .....!.@....
- 140, 213, 208,  31,  93,  27, 250,  47,  71, 220, 177,  62, // ....]../G..>
- 166, 127, 221,  61, 187,  34, 105,  95,  93, 205, 182, 219, // ...=."i_]...
- 116, 187, 127, 165, 107, 241, 234, 234,  57,  17,  63,  87, // t...k...9.?W
-  87, 223, 153,  16, 210, 132,  98, 179, 149,  29, 157,  41, // W.....b....)
-  68,   9,  26, 153,  29, 245, 109, 165,  43, 183, 111,  35, // D.....m.+.o#
- 199, 194,  25,  84, 230, 167,   8, 187,  66, 176,  54, 171, // ...T....B.6.
- 221, 223,  96, 216, 128, 166, 130,  85,  29, 174, 216, 112, // ..`....U...p
-  42, 119, 165, 200, 112,  12,  31, 203, 231, 135, 102, 129, // *w..p.....f.
-  71, 220, 129, 254,  79, 213,  68, 217,  99,  96, 229, 217, // G...O.D.c`..
-  77, 212, 218,  10, 209, 205,  66, 248,  20,  22,  50,  80, // M.....B...2P
- 131,  73, 147,   9,  65,  60, 129,  18, 154, 151, 168, 199, // .I..A<......
-  10,  24,   3, 116, 100, 138, 196, 199, 120, 248, 176,  79, // ...td...x..O
- 202,  57,  80, 107, 210,  72, 107,  85,  44,  81,  51,  61, // .9Pk.HkU,Q3=
- 246, 147,  74,  80,  48, 186, 118,  83,  49,  20,  56,  43, // ..JP0.vS1.8+
- 249, 132, 117,  40,  22, 217, 132,  48, 243, 227,  53, 175, // ..u(...0..5.
-  64, 140,  90,  59, 249, 101, 107,  31,   8, 212,  29, 253, // @.Z;.ek.....
- 130,   4,  62,  67, 244,  18, 189,   9,  14,  67,  32,   1, // ..>C.....C .
-  27, 210,  15, 102,  75, 189, 128,  62, 108, 250,   2,  30, // ...fK..>l...
- 206, 166, 122, 148, 157, 209,   1, 243,  78, 217, 119, 236, // ..z.....N.w.
- 231,  48, 253,  88, 190, 207, 104, 155,  60, 194, 219, 232, // .0.X..h.<...
-  32,  97, 171, 254,  48, 125, 130, 215, 138, 101,  94, 210, //  a..0}...e^.
-  29, 225, 246, 101, 139,  46,  71,  58,  81,  60, 102, 116, // ...e..G:Q<ft
- 242, 225,  57, 232, 238, 249, 198,  86,  21,  74, 192, 108, // ..9....V.J.l
-  74, 159, 154, 185, 156,  59, 108,  24, 218,  87, 180, 147, // J....;l..W..
-  62, 169, 244,  29, 123,  16,  24, 243, 243,  71, 126,  62, // >...{....G~>
- 194,  51,  51,  89, 229, 226, 224,  51,  98, 206,  89, 135, // .33Y...3b.Y.
- 200,  90,  16,   6,  45, 241,  53, 160, 173, 201, 115,  58, // .Z..-.5...s:
- 100,   4, 127,  88, 145, 229,   9, 159,   5,  80, 107, 169, // d..X.....Pk.
-  17, 166,  41,  83, 166,  35,  33,  77,  71, 120, 134, 114, // ..)S.#!MGx.r
-  58,   1,  24, 160,  37, 236, 180,   9, 193,   4,  94,  65, // :...%.....^A
-   8,  35,  14,  82, 118, 186, 140,  52, 200,   4,  96, 126, // .#.Rv..4..`~
- 242,  21, 247,  16, 202,  39, 236,  19, 158, 208, 183, 237, // .....'......
- 180, 232, 183,  89, 137,   2, 184,   3,  82, 129, 200, 109, // ...Y....R..m
- 167,   9,  82, 191, 250, 170, 126, 199,  42,  22,  87, 206, // ..R...~.*.W.
- 205, 229,  38, 247, 218,  98,  17, 182, 114,  27, 130,  31, // ..&..b..r...
- 205,  83, 113, 194,  51, 246, 132, 224,  32, 101, 159,  70, // .Sq.3... e.F
- 144, 182, 234, 188,  12, 241,  17, 166, 187, 102, 249, 217, // .........f..
- 229, 253,  81, 150,  29, 195,  67,  58, 255, 138, 119, 182, // ..Q...C:..w.
-  18, 182,  94, 150, 210, 185, 172, 159, 154, 240, 234,   3, // ..^.........
-  78, 218, 243,   3, 222, 139, 233, 159, 244,  13, 127, 194, // N...........
-   8, 172, 174,  23,  79,  71,  66,  34,  99,  52,  43,  14, // ....OGB"c4+.
- 159,  83,  63, 113,  59,  95,  23,  45, 202,  96, 124, 106, // .S?q;_.-.`|j
- 152, 240,  76, 143, 127, 164,  74,  25, 253, 131,  11,  64, // ..L...J....@
- 200, 104, 111, 135,  63,  42, 190,  51,  16,  76, 150, 152, // .ho.?*.3.L..
- 194,  63,  41, 143, 161,   4,  81, 132, 245,  21, 205, 170, // .?)...Q.....
- 105, 112,  57, 153,  29,   4, 250,   8,   1, 122, 233, 103, // ip9......z.g
-  46, 209, 173,  17, 223, 249, 139, 114, 157,  15,  86,  17, // .......r..V.
- 166, 233, 146,   5,  28,  83,   9,   2,  54, 186, 141, 255, // .....S..6...
- 216, 179, 193, 141,   7, 165,  72, 106,  79,  32, 153, 166, // ......HjO ..
- 218, 239,  33, 100, 170, 129, 253, 210, 152, 185,  76,  16, // ..!d......L.
- 167,  10, 127, 248, 182,  56,  21, 149,  15, 249, 134,  74, // .....8.....J
-  52, 114, 149,  62,  11, 139,  79,  30, 161, 220, 206, 130, // 4r.>..O.....
- 188, 169,  99,  86, 180,  48, 159, 140, 166, 216, 212,   4, // ..cV.0......
- 246, 117, 115, 169, 187, 103,  75, 146, 157, 195, 227,  45, // .us..gK....-
- 238,  73,  66,  59,  17, 196, 166,   1, 189, 104,  26, 207, // .IB;.....h..
-  55, 111,   6, 111,  27,  28, 185, 151,  85,  41,  88, 143, // 7o.o....U)X.
- 190,  15,   1, 237,  23, 243, 226,   7, 124,  90,  21,  15, // ........|Z..
- 194, 146,  18, 247,  42, 197,  21, 130, 124,  43,  35, 217, // ....*...|+#.
- 110, 139, 153,  51, 219,  53, 211, 177,  84, 152,  83, 169, // n..3.5..T.S.
- 176, 170,  35,  54,  96,  13,  13, 148, 195,  33,  11, 168, // ..#6`....!..
- 210, 152, 151, 232,  37,  94, 251, 226, 233, 178,  47, 126, // ....%^..../~
-   1, 119, 133,  86, 198, 224,  68,  13, 100, 233,  25, 184, // .w.V..D.d...
-  55,  23, 161, 195,   6, 167, 126,  77,  32, 230, 156, 247, // 7.....~M ...
- 139, 241,  42, 168, 197, 173,  33, 107, 190, 208, 135,  62, // ..*...!k...>
- 177, 199, 166, 210,  31,  42,   7,   6,  15, 251, 213, 179, // .....*......
-  56,  43, 224, 230, 225, 106, 218, 145, 195,  38,   7,  53, // 8+...j...&.5
- 253, 175, 107, 190,  49, 140, 131, 183,  80, 220, 137,  40, // ..k.1...P..(
- 237,  48,  11,  89, 134,  80, 185,  87,  50, 148,  76,  42, // .0.Y.P.W2.L*
- 206,  98,  88, 165,  65,  27,  44, 180,   6, 171, 184,  71, // .bX.A.,....G
- 221, 122, 190, 225,  81, 167, 108, 164, 221, 211, 165,  75, // .z..Q.l....K
-  42, 109,  60,  82, 105,  81,  12,  53,  73, 120,  68, 154, // *m<RiQ.5IxD.
-  81,  50, 228,  68, 121, 166, 212, 199,  16, 151,  64,   5, // Q2.Dy.....@.
-  19, 214,  87, 242,  84, 223, 249, 231, 236,   8,  76, 251, // ..W.T.....L.
- 132,  50, 156,  27,  14, 147,  70, 152, 107, 150, 112,  73, // .2....F.k.pI
-   5, 105, 146,  31, 233, 246, 195,  46, 177,  33,  82, 126, // .i.......!R~
-  15, 178, 190, 113, 132, 122,  63,  40, 232,  75,  94, 137, // ...q.z?(.K^.
- 123,  27,  81, 199,  52, 195, 195,  51, 124, 140, 221, 190, // {.Q.4..3|...
- 221, 169, 170,  22,  57, 156, 230, 150, 111, 103,  16,  25, // ....9...og..
- 150, 111,  59,  65, 113, 224,  47, 119, 218, 132,  84, 248, // .o;Aq./w..T.
-  64, 175, 101,  57,   9, 200, 103,  79, 253, 181,   2, 110, // @.e9..gO...n
-  10,  74,   8,  39, 177,  86, 164, 150, 100, 101, 166, 198, // .J.'.V..de..
-  33, 214, 212, 122, 198, 154, 194, 239,  49, 156,  73, 220, // !..z....1.I.
- 194,  47,   4,  79, 125, 170, 156, 251,  52,  13, 156, 209, // ./.O}...4...
-  47, 221, 195, 230, 236,  20,  54, 208, 187,  72,   5, 166, // /.....6..H..
- 254,  12, 225, 183, 172, 183, 155,  82, 241, 148,  74,  99, // .......R..Jc
- 174, 169, 100,  78, 123, 120, 202, 127, 207, 197,  35, 149, // ..dN{x....#.
- 113, 212, 100, 159, 105,   6,  55, 183, 205,  12,  93,  93, // q.d.i.7...]]
- 117, 192, 252, 133,  57, 127, 191, 154,  69, 150,  88,  73, // u...9...E.XI
-  98, 241,  35, 208, 147, 160, 248, 200, 147,  40,  22, 231, // b.#......(..
-  35,  79, 158, 124, 235, 188, 235,  89, 153,  92, 190, 250, // #O.|...Y....
- 214,  57,  97, 168,  75,  62, 165, 217, 153, 109, 201,  19, // .9a.K>...m..
- 176,  43,  21,  90, 181, 213, 243, 213,  86, 113,  87, 151, // .+.Z....VqW.
- 202, 184, 186,  84, 148,  53, 246,  86, 220,  50,  43,  50, // ...T.5.V.2+2
-  37, 103, 184,  39,  64, 169, 175, 239, 235,  68, 180, 113, // %g.'@....D.q
- 162, 243, 120, 202,  33,  81,  88, 109, 226, 180, 127, 234, // ..x.!QXm....
- 218, 228, 189, 248, 184, 243, 250, 105, 194, 164, 111, 223, // .......i..o.
-  59, 173, 135,  88, 161,  77, 142,  99, 209,  15,  78, 121, // ;..X.M.c..Ny
- 184, 111, 137, 202, 125,  11,  19, 198, 124, 158,  28, 174, // .o..}...|...
-  71, 211,  41, 123, 167, 122, 199, 126, 217,  78, 138,  55, // G.){.z.~.N.7
- 179, 147, 240,  57, 158,  89, 255,  11, 111, 207, 202, 183, // ...9.Y..o...
- 215, 217,  97, 248, 103, 249, 246,  16,  34, 234, 240,  37, // ..a.g..."..%
- 222,   9, 177,  96,  31, 175, 223, 148,  27,  52,  11,  47, // ...`.....4./
- 223, 224,  71, 224, 218,   9, 177, 196,  27,  60,  36,  13, // ..G......<$.
-  16, 179, 132, 197,  98,   0, 227,  20,  30,  55, 234, 198, // ....b....7..
- 119, 142, 245,   2,  92, 187,  80, 139,  54,  98,  56, 204, // w.....P.6b8.
- 156, 172,   5,  44, 167, 115,  44, 133, 154, 131,  12,  35, // ...,.s,....#
- 124,  66,  38,  29, 172, 176, 225, 211, 165,   9, 109, 199, // |B&.......m.
-  70, 163, 187, 213, 134,  46, 138,  59,  58, 235, 123, 163, // F......;:.{.
- 166,  65, 169, 235,  82, 158, 162, 140,  20,   8, 179, 249, // .A..R.......
-  42, 160, 151, 213,   1, 168, 233, 144, 117, 218, 165,  11, // *.......u...
-  33,  55, 182,  93, 103, 187, 250,   4,  81, 123, 150, 104, // !7.]g...Q{.h
- 233,  73,  75, 140,  56,  16,  95, 180, 244, 250, 204, 118, // .IK.8._....v
-  76,  62,  77, 201, 178, 172, 140, 178, 178,  86,  75, 148, // L>M......VK.
- 231,  75,  11,  40, 211,  40,  43, 195, 119, 212, 119, 207, // .K.(.(+.w.w.
- 203,  90, 105, 179, 227, 111,  20, 142,  32,  75,  44, 249, // .Zi..o.. K,.
- 225, 120, 177, 153, 163,  81, 124,  93, 152,  59, 246,  43, // .x...Q|].;.+
- 142, 109,  75, 106, 252,  33, 133, 105,  53, 241, 132, 145, // .mKj.!.i5...
- 185,  19, 201,  17, 248, 216,  64,  96, 249, 194,  59, 171, // ......@`..;.
-  94, 198, 223,  75, 234,  18, 235, 180,  46,  57,  76, 217, // ^..K.....9L.
- 185,  73,  79, 236, 138, 172, 145,   7,  22, 146, 195, 238, // .IO.........
- 217, 235,  97, 176, 231, 124, 209, 242,   0, 222, 226, 217, // ..a..|......
-  64, 197, 203, 123,  45,  97, 133, 253,   2,  15, 208, 235, // @..{-a......
-  94, 207, 184, 162, 138, 203, 155,  62, 155, 179,  49,  65, // ^......>..1A
-  33,   6, 146,  85, 128, 186,  95, 116,  45, 134, 120, 248, // !..U.._t-.x.
- 124,  92, 100,  11,  64, 143, 222,  51, 235,  94, 134, 113, // |.d.@..3.^.q
-  94,  14, 207,  55, 151, 138,   3,  30,  45, 211, 133,  52, // ^..7....-..4
- 228, 114,  18, 216, 121,  78, 171, 240, 185, 197, 202,  25, // .r..yN......
-  13, 108, 184, 172, 183, 228,  37, 205,  51, 111, 207,  67, // .l....%.3o.C
- 121, 176, 105, 116,  61, 182, 161,  94,  46, 198,  20,  41, // y.it=..^...)
- 102, 188,  24, 184,  48,  94,  18,  95, 100,  26, 114, 196, // f...0^._d.r.
- 221, 153, 153, 225, 204,  23,  41, 148, 113,  75,  74,  84, // ......).qKJT
- 122, 209, 199, 154,  33, 204,   9,  97, 178, 238, 154,  97, // z...!..a...a
- 144, 211, 165,  17,  75, 140,  80,  62, 103, 217,  79,  36, // ....K.P>g.O$
-  86, 162,  51, 137,  59, 222, 111, 179,   1, 154,  55, 227, // V.3.;.o...7.
-  80, 140,  80, 214,   2,  21,  47,  75,   6, 173,  43,  73, // P.P.../K..+I
- 159, 123, 139, 162, 183, 242, 180, 129, 118,   3,  60, 100, // .{......v.<d
-  16,  20, 219, 190, 179,  94,  86, 125, 123,  97, 252, 149, // .....^V}{a..
- 198, 219, 185, 212,  74, 195, 152,  10, 167, 162, 235, 236, // ....J.......
- 236,  74, 250, 219, 106, 237,  85,  82, 112,  42, 215, 236, // .J..j.URp*..
-  16,  72, 165, 139, 197, 104, 121, 154, 205,  61, 235, 197, // .H...hy..=..
- 222, 247, 102,  16,  99, 208, 153,  45, 131, 158, 249, 101, // ..f.c..-...e
- 132, 204, 116, 110,  14, 233,  39, 124, 181, 240, 193,  44, // ..tn..'|...,
- 142, 219, 195,  37, 234,  26, 230, 208, 105, 124, 250, 248, // ...%....i|..
- 184, 193,  70,   8, 141, 167, 197, 112, 195, 188, 245,   5, // ..F....p....
-  78, 217, 205, 123,  83,  55, 239, 234,  59, 107,  26, 179, // N..{S7..;k..
-   9,  23, 149,  63, 178,  84, 191,  29, 143,   1,  21,  52, // ...?.T.....4
-  97,   5,  13, 244,  13,  21, 215,  96, 207, 151, 117,  32, // a......`..u 
- 218, 123, 157,   1,  25, 219,  45, 242,  56,  61, 244,  26, // .{....-.8=..
-  58, 109, 125, 218, 109, 168,  75,  96, 100, 127,  82,  11, // :m}.m.K`d.R.
- 240, 128, 235, 251, 128, 173,  29,  90, 239, 120, 170, 137, // .......Z.x..
- 210,  25,  77,  61, 238, 165, 150,   2, 189,  83, 254,  48, // ..M=.....S.0
-  38,  26, 138,  79,  61,  68,  94,  36, 136, 127,  30,  77, // &..O=D^$...M
- 194, 229,   2,  82,  61, 168,  92,  34, 176,  98,  87,  42, // ...R=..".bW*
-  14,  28, 250,  41, 219,  56,   6, 218, 208, 117,  76, 213, // ...).8...uL.
- 113, 211, 176, 206,  71,  96,  87, 162,  94,  13, 181, 140, // q...G`W.^...
- 139, 138, 109, 188,  46, 141,   7, 142,  98, 107, 142,  21, // ..m.....bk..
- 143,  83,  66, 144, 195,   4, 129, 237, 166, 133, 166, 107, // .SB........k
- 212,  81,  77,  43, 149, 168,  17, 106,  47, 178,  81, 200, // .QM+...j/.Q.
-  82, 121, 157,  14, 159, 232, 233, 144, 233, 139, 172,  42, // Ry.........*
-  96, 130,  38, 179, 207, 152,  98,  93, 159,  23, 116,  45, // `.&...b]..t-
- 115, 176, 143,  50, 172, 179,  48, 147,  77, 188, 238,  88, // s..2..0.M..X
- 121, 181, 232, 201, 138, 195,  38, 171,  11, 171, 246, 120, // y.....&....x
-  30, 206, 202,   8, 202, 194,   2,  59,  48, 204, 175,  51, // .......;0..3
-  27,  29,  91, 237,  64, 215, 234, 220,  35, 236, 149,  90, // ..[.@...#..Z
- 217,  71,  44,  34, 117,  44,  73, 135, 148,  52,  82,  23, // .G,"u,I..4R.
- 234,  20,  70,  20, 224, 240,  78, 132, 157, 251,  37,  40, // ..F...N...%(
- 222, 171, 199, 255, 191,  68,  75,  94,  13,  31,  91, 167, // .....DK^..[.
- 156, 187, 212, 188,  13, 203,  60, 169, 194,  50, 247, 162, // ......<..2..
- 240, 133,  55, 102, 203,  35,  14, 170, 106,  95,  90,  29, // ..7f.#..j_Z.
-  27, 190, 251, 216,  27,  35, 166, 242, 110,  63,  10, 166, // .....#..n?..
-  28,  83, 121, 199,  27, 186,   9,  79, 195,  31, 234,  97, // .Sy....O...a
- 248,   3, 126, 219, 161, 152, 151,  64,  71, 119, 149,  82, // ..~....@Gw.R
-  14, 212,  71, 232, 180, 173, 170,  31, 244,  80, 143, 169, // ..G......P..
- 204,  85,  17,  83,  57, 186, 125, 123, 106,  98,  42, 239, // .U.S9.}{jb*.
- 218, 211, 100,  92, 211, 136,  47,  22,  98, 146, 113, 239, // ..d.../.b.q.
- 136, 140, 154, 209, 192,  10,  31, 154,  35,  73,  31, 189, // ........#I..
- 164, 212,  75, 128, 135, 167, 216, 173, 146, 146,  33, 236, // ..K.......!.
-  83,  70,  35,  76, 249, 164, 126,  23,  62, 197,  40, 171, // SF#L..~.>.(.
-  65, 190,  11,  15, 154, 103,  24,  29, 216, 248, 143, 212, // A....g......
-  19, 142, 114,  92,  24, 111, 154, 114, 159, 206, 170,  40, // ..r..o.r...(
- 199, 143,  74,  39, 137, 215, 162,  28, 175, 194,  57, 200, // ..J'......9.
- 177,  55, 179,  81, 142,   1,  58,  51, 209, 122, 103,  61, // .7.Q..:3.zg=
- 247,  71, 116, 155,  67, 175, 236,  29, 100, 253, 120, 120, // .Gt.C...d.xx
- 168, 196, 217, 225, 173, 217,  66, 148,  99,  54, 208, 207, // ......B.c6..
- 221,  16, 199, 128,  63, 172, 200, 174, 218, 129, 168, 141, // ....?.......
- 167,   1, 226,  98,  19, 165, 104, 163, 171, 142, 140,  19, // ...b..h.....
- 229, 164,  63,  10,  90,  35, 117, 104, 221,  49,  39, 253, // ..?.Z#uh.1'.
- 214,  40,  24, 245, 242,  58,   1,  69, 155, 179,  25,  30, // .(...:.E....
- 113,  28, 212, 102, 120,  72, 184, 235,  99, 137, 153, 156, // q..fxH..c...
-  83, 155,  28,  51, 217, 108,   2, 149,  35, 203, 198,  76, // S..3.l..#..L
- 206,  21,   3,  77, 185,   3, 156, 152, 201, 240,  70, 245, // ...M......F.
- 184, 140, 153, 252, 132,  99,  38, 219,  54,  86, 109, 204, // .....c&.6Vm.
- 228,  42, 193, 196,  76, 174,  18, 158,  16, 252,  63, 158, // .*..L.....?.
- 251, 208,  40,  63, 136, 242, 233, 210,  13,  14,  93,  81, // ..(?......]Q
- 113, 237,   2, 164,  92,  13, 214, 239,  42,  29,  41, 184, // q.......*.).
- 145, 132,  41,   3, 239, 109,  90,  35, 132, 114, 195,  55, // ..)..mZ#.r.7
- 224,  49,  71, 192, 209, 104,  20, 207, 166,  80, 125,  32, // .1G..h...P} 
- 162, 199,  40, 197, 228, 125, 182, 224,  11,  26, 233, 236, // ..(..}......
- 228,  64, 231,  56, 125,  47,  38, 192, 217,  41,  35,  71, // .@.8}/&..)#G
-  70, 142,  64, 195, 157,  22, 135,  35, 154, 194, 227,  11, // F.@....#....
- 172, 203, 117, 228, 211, 157, 137, 151,  46,  91, 218,  12, // ..u......[..
- 249,   0,  33,  50, 102, 162, 104,  80, 116,  81, 242, 121, // ..!2f.hPtQ.y
-  66, 115,  44, 193, 106, 105,  86,  47, 141, 207,  32, 179, // Bs,.jiV/.. .
- 139,  71, 243, 112,  88, 157,  50, 137, 202, 213, 145,  61, // .G.pX.2....=
- 101,  18, 229, 149,  39, 139,  58,  87, 116, 132, 208,  74, // e...'.:Wt..J
-  35, 248, 182,  57, 101,  30,  35,  26, 119, 120,  88, 158, // #..9e.#.wxX.
-  52,   4, 210, 107, 154, 246, 225, 148, 254,  62,  13, 103, // 4..k.....>.g
- 107,  26, 252, 196, 125, 222, 210,   3,  42, 187,  23, 198, // k...}...*...
- 108, 143,  31,  12,  86, 213,  99, 251, 194,  80, 243, 144, // l...V.c..P..
-  74, 217,  35,  96, 223, 137, 204, 254,  78,  17, 236, 171, // J.#`....N...
-  15,  97, 153,  44, 209, 233,  94,  84,   9, 227,  96, 129, // .a.,..^T..`.
-  15,   2, 142, 154,  73, 202, 216, 116,  49, 167, 245, 251, // ....I..t1...
- 147, 103, 129,  35,  33,  42, 125,  12, 204,  34,  29, 177, // .g.#!*}.."..
- 125, 142, 235, 215, 135,  54, 192, 203, 240, 176, 218,  40, // }....6.....(
- 116, 110, 241,  70,  57,  20, 243, 126, 222, 116, 127, 246, // tn.F9..~.t..
- 255, 196,  64, 161, 249, 249,  71, 184, 235,  29, 120,  47, // ..@...G...x/
- 105, 102,  94, 171,  29,  86, 137,  59,  86, 223,  40, 237, // if^..V.;V.(.
- 208, 194, 191, 175, 158,  65,  56, 241,  86, 168, 182, 175, // .....A8.V...
- 242, 243,  92, 126,  62, 203, 117,  47,  11,  63, 225,  77, // ...~>.u/.?.M
- 252, 205,  94, 247,  16,  86,  63,   3,  77, 247,  54, 180, // ..^..V?.M.6.
- 186, 133, 229, 194, 160,  25,  65, 209, 148, 245, 228, 254, // ......A.....
- 182, 206,  78,  44,  89, 232,  95, 173,  46,  80, 229,  53, // ..N,Y._..P.5
- 137,  22, 159,  13, 156, 188, 231, 225, 232,  90, 203, 159, // .........Z..
- 175, 181, 252, 252, 134, 150,  63,  47, 107, 217,  72, 123, // ......?/k.H{
- 206, 219, 193, 239, 138,  13, 251,  94,   1, 174, 202, 211, // .......^....
- 234, 119,  43, 144, 125, 229,  95, 158, 132, 191,  95, 235, // .w+.}._..._.
- 157, 246, 231, 239,  80,  77,  40, 216, 165, 212, 137,  37, // ....PM(....%
- 235, 139,  82,  71, 196,  59, 107, 234, 181,  99, 181, 207, // ..RG.;k..c..
-  12,  66, 118, 167, 103, 244, 137,  94,  45, 182, 213, 123, // .Bv.g..^-..{
- 132, 221, 254, 138,  91, 235, 227,  80,  89,  59,  14, 206, // ....[..PY;..
-  61, 166,  31, 246,   9, 122, 207, 252, 214, 185, 215,  54, // =....z.....6
- 143, 234,  73, 232, 125,  10, 147, 194,   3, 148, 159,  75, // ..I.}......K
- 162, 250, 228, 251, 173,  71, 205, 143,  34,  32, 185, 161, // .....G.." ..
- 192,  90, 212, 252, 168,  30, 133, 159,  90,  79, 122, 157, // .Z......ZOz.
- 109, 156,  51,  79,  66,  68, 133, 222, 232, 110, 127, 163, // m.3OBD...n..
- 229, 251, 134, 151,  45,  78, 223, 101,  53,  63,  12, 245, // ....-N.e5?..
-  75, 248, 100, 187,  77, 131, 219, 245, 244, 204, 163, 138, // K.d.M.......
-  45, 239,  75, 255,  27,  32, 233, 169, 250,  65, 240, 243, // -.K.. ...A..
-  46, 100, 135,  51, 125, 106,  35,  72, 195, 240,  97, 191, // .d.3}j#H..a.
-  29,  60, 242,  91, 233, 218, 195,  53,  79,  50,  62,  82, // .<.[...5O2>R
-  70, 219, 111, 162,  22,  63,  73, 171, 239, 171, 235, 152, // F.o..?I.....
-  47, 216, 191, 117,  17, 183, 231,  74,  39, 225,  51, 209, // /..u...J'.3.
-  11, 116, 174, 115, 157, 150,  62, 244,  13, 220, 251,  26, // .t.s..>.....
- 199,  25,  56, 163, 131,  63,  29,   7,  87, 165, 231, 129, // ..8..?..W...
- 203, 139, 118, 160, 213,  69,  39,  72, 177, 236, 149,  28, // ..v..E'H....
-  71,  72,  63, 246, 117, 149,  94,  91, 116, 157, 150, 124, // GH?.u.^[t..|
- 161,  50, 209, 196,  26, 202, 194, 199, 107, 143,  16, 179, // .2......k...
- 120, 117, 237,  81, 253, 138, 126, 216, 207, 131,  35,  92, // xu.Q..~...#.
- 209, 116,  97,  30, 153,  43, 250, 161, 197, 248,  78, 107, // .ta..+....Nk
-  87, 116,  90,  93, 209, 149, 174,  84,  90,  82, 148, 160, // WtZ]...TZR..
- 148, 250, 125, 118,  77, 150, 182,   8, 125, 109,  87, 197, // ..}vM...}mW.
- 255,   8,  15, 104,  68, 178, 181, 231,  66,  36, 158, 195, // ...hD...B$..
-  61, 234, 190, 101,  27,  89, 249, 245,   9, 232,  17, 109, // =..e.Y.....m
- 161,  41, 167, 106, 111, 188,  84, 189, 244,  77,  93,  58, // .).jo.T..M]:
- 225, 119, 137, 112, 126, 135, 147, 123,  23, 238, 204, 115, // .w.p~..{...s
- 245,   7,  60, 163, 226,  69, 155, 151,  89,  24, 181, 166, // ..<..E..Y...
-  53,  58, 217,  40, 214, 110, 167, 125, 157,   7,  58,  99, // 5:.(.n.}..:c
-  45,  68, 122, 206,   2, 157, 247, 158, 245,  61, 222, 195, // -Dz......=..
-  82, 248,  57,  59, 136, 249, 224, 125, 102,  10, 231, 185, // R.9;...}f...
-  68, 102,  87, 211, 230, 119, 239,  27,   2, 136, 210,  12, // DfW..w......
- 194, 116, 113, 214, 250, 230, 179, 236, 212, 106, 228, 155, // .tq......j..
-  90,  95, 185, 214, 219,  95, 213, 242, 131,  15, 158,  78, // Z_..._.....N
- 126, 218, 238,  11,   9, 190, 173, 226,  22, 229, 211, 221, // ~...........
- 249, 168, 249,  77,  57,   4,   9, 141, 184, 255, 222,  50, // ...M9......2
-   9, 159, 245,  63,   7,  58,   9, 158, 209,  62, 121, 111, // ...?.:...>yo
-  28, 227,  17, 124, 155,  99, 179, 127,  40,  73, 193, 161, // ...|.c..(I..
- 117,  92, 215, 183,  73, 234, 189,  81, 200, 163,  45, 243, // u...I..Q..-.
-  94,  16, 157, 103, 253, 175, 212, 148, 122,  47, 119,  52, // ^..g....z/w4
- 216, 101, 169, 190, 206,  59, 176,  92,  21, 184,  75, 211, // .e...;....K.
- 253,  58, 190,  13, 150, 128,  18, 123, 161, 226,  27, 191, // .:.....{....
- 120,  53, 111,  99,  22, 193, 182,  87, 158, 185,  13, 137, // x5oc...W....
- 164, 180, 151,  30, 155,  44,  92, 120,   8, 135,  62, 165, // .....,.x..>.
- 146,  19,  31, 202, 107, 156, 132, 123, 104,  70, 184, 249, // ....k..{hF..
- 200, 103, 215,  81,  83, 145, 171, 157, 132, 197,  43, 181, // .g.QS.....+.
-  31,  22,  95, 212, 105,  88, 220, 245,   3,  36, 124,  71, // .._.iX...$|G
- 194, 123,  36, 220, 145,  93, 125,  70, 165, 237, 133,  56, // .{$..]}F...8
- 117, 112, 226, 148, 208, 224, 136, 239,  58,  38,  31, 236, // up......:&..
- 139, 197, 137, 119,   8,  74,  99, 160, 192, 103, 253,  52, // ...w.Jc..g.4
- 200, 246, 128, 208, 239,  16,   6,  63, 216,  35, 172, 189, // .......?.#..
-  70,  48, 219,  34, 216,  71, 180,  59,  51, 179, 143, 206, // F0.".G.;3...
-  42, 157,  66, 166, 150, 205,  78,  65, 163, 160, 157,  95, // *.B...NA..._
-  11, 246, 119,  12,  71, 141, 143, 229, 249,  64, 200, 106, // ..w.G....@.j
- 217,  36, 171, 229,  89,  68, 132, 251, 107, 245, 152, 112, // .$..YD..k..p
- 135, 125, 154, 175,  11, 255, 239, 211,   7, 187, 225, 170, // .}..........
- 165,  15,   6,  31, 213,  15, 198, 127, 193, 189, 169, 246, // ............
-  73,  94, 225, 191,  31, 237,  64,  87, 175, 225, 191, 187, // I^....@W....
- 192, 195,  14, 188, 220,  94, 235, 154, 125,  42,  84,  94, // .....^..}*T^
- 123,  62, 210, 218, 236,  19, 240,  30,  67, 129,  12,  15, // {>......C...
-  59,  70, 191, 234,  86, 190, 128, 255, 206,  48, 131,  51, // ;F..V....0.3
-  23, 255,   5, 152,  96, 246, 207, 212,  57, 187, 103,  91, // ....`...9.g[
-  21, 116, 117,   6, 126,   3, 208,  85,   3,  90,  16,  45, // .tu.~..U.Z.-
- 173, 150, 232, 234,  76, 241, 122, 150, 112, 229, 160, 171, // ....L.z.p...
- 240, 212, 186,  90, 162, 171,  63,  24,  93, 181, 109, 236, // ...Z..?.].m.
-  90, 116, 181,  74,  48, 232, 106, 149, 128,  91, 100, 117, // Zt.J0.j..[du
-  94, 237, 186, 228,  16, 193, 110,  74, 145, 215,  89, 197, // ^.....nJ..Y.
-  76, 155,  16,  54, 171,  95, 166,  28,   6, 102, 118,  48, // L..6._...fv0
-  21, 202, 188, 131, 216,  10, 157, 187,  32,  24, 150, 230, // ........ ...
- 111, 170,  45, 201,  79, 151, 231, 111, 169, 123, 156, 111, // o.-.O..o.{.o
- 182, 219, 127, 242, 195,   3, 111, 245, 178, 152, 171, 149, // ......o.....
- 213, 203, 132, 255, 166, 244, 183, 189, 222, 217, 242, 255, // ............
-  51,  23, 104,  93, 194, 141,   8, 245, 134,  87, 108, 119, // 3.h].....Wlw
- 244, 221,  62, 253,  31, 224, 105, 147, 158,  54, 131, 138, // ..>...i..6..
-  20, 126, 195, 232, 241, 122,  60, 165,   1, 232,  67,  77, // .~...z<...CM
-  32,  45, 129,  91,  96, 215, 240,  44,  62, 215,  35, 175, //  -.[`..,>.#.
- 107, 140,  80, 253,  62,  65,  98, 211,  52, 215,  56, 105, // k.P.>Ab.4.8i
- 152, 230,  26, 199, 141, 160,   1,  89, 213, 113,  88,  19, // .......Y.qX.
-  35,  20, 225, 246,  14,  34,   6, 245, 141,  10,  84, 127, // #...."....T.
- 253, 162,  47, 209, 242,  88, 121, 223, 206, 227, 235, 106, // ../..Xy....j
-  30, 133, 189,  22,  79, 133, 101, 197, 253,  13, 152,  75, // ....O.e....K
- 137,  80, 140, 253, 203,  57,  77, 149, 209,   0,  34, 172, // .P...9M...".
- 101,  10,  22, 156, 117, 110,  17, 110,  95,  67, 243,  19, // e...un.n_C..
- 222,  99, 246, 172, 178,  24,  80, 106, 135, 198, 134, 165, // .c....Pj....
- 142,   4, 243, 177, 119,  57, 156,  78, 233, 238,  97, 239, // ....w9.N..a.
- 240, 122,  26,  20,  10, 215, 115,  64, 240, 173, 163,   4, // .z....s@....
- 220, 149,  32,  85, 197, 145, 166, 223,  12, 222, 125, 178, // .. U......}.
-   9, 170,  77, 131,  28,  47,   4, 192, 241, 220, 242, 221, // ..M../......
- 232,  36, 143, 214, 103,  83, 189,  75, 231,  98, 148, 248, // .$..gS.K.b..
-  94, 253, 171,  18, 159, 168,  88,  32, 237, 123, 184, 170, // ^.....X .{..
- 108, 217,  15, 132, 213, 120, 160,  54, 178, 245, 195,  60, // l....x.6...<
- 154,  28, 193, 175,  46, 235, 147,  95,  93, 101,  28, 193, // ......._]e..
- 211, 188,  52, 254, 185, 185, 249, 224, 193, 112, 216,   0, // ..4......p..
- 203, 110, 168,  26, 255, 212, 163, 123, 186, 115, 175, 161, // .n.....{.s..
-  26,   5, 141, 146, 126,  14, 115, 173,  83, 250, 205,  88, // ....~.s.S..X
-  86,  64,  15, 195, 139,   8, 239, 147,  89,  62, 225,  64, // V@......Y>.@
- 117, 147,  56,  61, 110,  64,  95,  10, 222, 255,  15, 216, // u.8=n@_.....
- 245,  63,  85, 138,  46, 232, 231,  66,  39,  73, 118, 134, // .?U....B'Iv.
- 228,  60,  59,  75,  27, 123, 106, 226,  10,  56, 141, 186, // .<;K.{j..8..
- 185, 137, 200, 130, 248, 119,  11, 171, 117, 251, 246,  66, // .....w..u..B
-  10, 251, 226, 114,  89, 249, 236, 108,  92,  68, 235, 186, // ...rY..l.D..
- 244,  79,  14, 198, 177,  79,  39, 193, 240,  40, 202,   9, // .O...O'..(..
-  93,  53,  15, 214, 159,  44, 156,  21, 206, 213,  40, 244, // ]5...,....(.
- 236, 141,  81, 146,  39, 215, 171,  24, 177, 169, 103, 173, // ..Q.'.....g.
-   4, 103,  80, 207, 203, 117,  90, 220, 164, 252,  72,  88, // .gP..uZ...HX
- 196,   0, 241,  78, 132, 149, 211,  89, 223, 178,  68, 220, // ...N...Y..D.
-  80,  78, 216,  51, 111, 232, 207, 247, 168, 247,   1,  45, // PN.3o......-
- 176, 249, 114,   6, 197, 193, 158, 123, 250, 119, 123, 250, // ..r....{.w{.
- 183,  81, 233, 129, 188, 217, 244,  35,  57, 214, 174, 183, // .Q.....#9...
-  59,  30, 232,  22, 209, 149, 166, 113, 121, 179, 138,   7, // ;......qy...
-  71,  22, 182,  69,  52, 228,  85,   3, 139, 109, 248, 183, // G..E4.U..m..
-  50,  14, 220, 157, 118, 169, 186,  22,  27,   1,  56, 114, // 2...v.....8r
- 237,  83, 167, 219,  86, 194, 160,  12, 104, 134,  15,  12, // .S..V...h...
- 179, 210,  43, 185, 136, 180, 107,  65,  79,  53, 158, 206, // ..+...kAO5..
- 160,  66, 183, 241,  58,  75,  71,  89, 218, 240, 149,  81, // .B..:KGY...Q
- 170, 224,  77, 199,  74, 167,  65,  21, 251, 143, 227, 207, // ..M.J.A.....
-  15,  46, 141, 158,  66, 227, 242, 197,  11, 137,  27, 217, // ....B.......
-  16, 242, 164, 187,  69, 195,  53, 153, 199,  52, 103,  38, // ....E.5..4g&
-  68, 114,  52, 167, 139,  97,  54,  73, 178,   2, 251, 215, // Dr4..a6I....
- 239,  29,  89, 197, 141, 208,  59, 170, 235, 112,  24, 133, // ..Y...;..p..
- 140,   1, 157,  60,  80, 125,   1, 137,  95, 173, 121, 120, // ...<P}.._.yx
- 227,  18, 246,  18,  99, 247, 208,  60,  35,  34,  52,  59, // ....c..<#"4;
- 163, 179,  38, 207, 146, 132,   5, 215,  80, 242, 172,  39, // ..&.....P..'
- 127, 165,  65, 178, 194,  71, 112,   9,  69, 133,  32, 129, // ..A..Gp.E. .
-  93,  31, 157, 116,  28, 212, 139, 160, 113, 148,  13, 103, // ]..t....q..g
- 144, 229, 173,  15, 105, 211,  23, 218,  72, 246, 188, 198, // ....i...H...
-  40,  62, 109, 248, 190,   4, 142, 120,  19, 157, 232, 176, // (>m....x....
- 193, 187, 180,  85, 100,  25,  29,  13, 147, 202, 154, 129, // ...Ud.......
- 200, 171,  24, 251,  37, 108,  68,   7, 211,  44, 153,  21, // ....%lD..,..
- 180, 189, 202,  70,  17,  15, 178,  46,  34,  36, 164,   3, // ...F...."$..
- 218,  15,  96, 187,  62,  69, 148, 168, 215, 132,  13, 235, // ..`.>E......
- 148,  14, 180,   6,  43,  74,  73, 188, 116, 225,  52, 216, // ....+JI.t.4.
-  30, 192, 138,  72, 162, 139, 144, 246, 110,  54,  60, 110, // ...H....n6<n
- 204, 127,  82,  61, 209, 209, 169, 190, 169, 122, 154, 165, // ..R=.....z..
- 186,  49, 231,  96, 214, 236, 180, 131, 213,  38,  47,  51, // .1.`.....&/3
-  79,  82,  68,   5,  57,  48, 161,  86, 110, 105, 199, 177, // ORD.90.Vni..
- 209, 101,  60,  58,  15, 178, 121, 169, 252, 122, 163, 179, // .e<:..y..z..
-  63, 161, 111, 250, 235, 216,  49, 235, 176, 232, 142, 171, // ?.o...1.....
- 164, 142,  36,  85, 117, 115, 235,  53,  46, 190, 186,  42, // ..$Uus.5...*
- 111, 164,  55, 209,  27,  47, 247,  23,  18,  98, 223, 237, // o.7../...b..
-   6,  74, 184, 214,  18, 181,  95,  61,  18, 214, 137,  48, // .J...._=...0
- 180,  70, 105, 231, 134,  50, 177,  66, 136, 218, 160,  78, // .Fi..2.B...N
- 154,  69, 150,  22, 152,  90, 103,  88,  37, 226, 186,  16, // .E...ZgX%...
-  32, 229,  63, 171, 151,  11,   1,  59, 242,  11, 115, 233, //  .?....;..s.
- 226,  98, 236, 116, 250,  59,  17, 226, 216,  36,  25, 124, // .b.t.;...$.|
-  11, 111, 208, 166, 243,   3, 209,  67, 198,  94,  98,  39, // .o.....C.^b'
- 232, 162,   0, 204, 157, 179,  56, 175,  97,  27, 172, 174, // ......8.a...
-  49,  75, 230, 149, 190,   8,  74,  75,  79, 197,  34, 183, // 1K....JKO.".
- 107,   7,  49,   2,  67,  90,  17, 138, 213, 104, 198,   5, // k.1.CZ...h..
-  90, 122,  32, 108,   8, 130, 113, 189, 139, 219, 183,  15, // Zz l..q.....
- 172, 148, 195,  86,  44,  19, 188, 114,  28, 226, 163, 103, // ...V,..r...g
-  62, 132, 242,  17, 174, 238, 185, 251, 201, 252, 121, 116, // >.........yt
-  53, 242, 231, 225, 215, 156,  61, 253, 218, 155, 151,  44, // 5.....=....,
- 155,  26,  63,  40,  15, 168, 164,  95,   4,  56, 164,  10, // ..?(..._.8..
-  14, 171,  29, 110,  27,  97, 135, 246,  17, 237,  98, 183, // ...n.a....b.
- 160, 195, 222, 235, 170,  70, 187,  81,  34,  71, 171,   4, // .....F.Q"G..
- 185,  41, 206, 136,  23,  25,   1,  37, 212, 218, 131,  50, // .).....%...2
- 105, 135,  72, 208,  66, 115, 226, 127, 224,   5,  44, 247, // i.H.Bs....,.
- 231,  43, 255, 158,  93, 118, 219, 221, 238, 156, 176, 168, // .+..]v......
-  29, 130, 131,  98,  25, 142,  50, 255, 143, 186,  97, 211, // ...b..2...a.
-  65,  44, 220, 140, 232, 250,  78, 155, 240,  41, 174, 111, // A,....N..).o
- 188,  95, 198,  97, 214, 188,  79, 215, 232, 172,  53,  52, // ._.a..O...54
- 135, 115, 235,  62,  44, 103, 106,  71,  85, 179,  60,  32, // .s.>,gjGU.< 
- 236, 131,  57, 119, 140, 190,  58, 135,  11,  80, 227, 166, // ..9w..:..P..
- 113,  44, 190,  13,  67,  14, 106, 184, 101, 222,  91, 247, // q,..C.j.e.[.
- 233, 224, 254, 173, 126, 204,  81,   9, 234, 180, 121, 191, // ....~.Q...y.
- 178, 200,  98, 115, 213, 113, 221, 244,  10, 118, 171,  19, // ..bs.q...v..
-  78, 194,  21,  43, 151, 167,  28,   3, 132, 179,  17,  78, // N..+.......N
-  74, 125,  35, 146,  21, 150, 178, 122,  51, 154,  74, 229, // J}#....z3.J.
-   1, 102,  66,  47,  20, 165,  28,  13, 120, 141,  92, 200, // .fB/....x...
-  76,  56,  28, 120,  71, 138, 238, 147, 242,  46, 166, 193, // L8.xG.......
- 226, 140,  57, 114,  81, 139,  25, 235,  19, 101, 179, 226, // ..9rQ....e..
-  37, 125,  27, 171,  74, 125, 148, 119, 207, 201,  65, 179, // %}..J}.w..A.
- 229,  75,  56,  21, 153,  25, 202, 240, 136,  71,  94,  61, // .K8......G^=
- 159,  71, 163, 182, 104,  21,  45, 158, 107,  48, 173, 167, // .G..h.-.k0..
- 227,  49, 124, 153, 112,  45,  15, 181, 192,  77, 145, 154, // .1|.p-...M..
-  57,  90,   5,  22, 156,  19, 168,  95, 247,  12,   8, 200, // 9Z....._....
-  92,  79, 179,  51, 156, 216, 161, 110,   1,  62, 137,  16, // .O.3...n.>..
-  58, 103,  68, 139, 238, 220,  45,  96, 250,  22,  61,  98, // :gD...-`..=b
- 181,   0, 235, 134, 142, 205, 109,  69, 209, 226, 183, 162, // ......mE....
- 231,  67,  63,  53,  30, 227, 238, 154, 120, 229,  92, 213, // .C?5....x...
-  16,  31, 214, 131,  70,  28, 109, 215, 143, 137, 198,  97, // ....F.m....a
- 141, 203, 148, 142,  80, 189,  67, 183, 102,  23, 193, 157, // ....P.C.f...
- 205, 186,  95, 191,   1, 114, 141, 123, 185,   1, 190,  16, // .._..r.{....
-  79, 144,  41,  40, 171, 119, 115,  89,  57, 251,  66,  51, // O.)(.wsY9.B3
-  33, 102,  53, 202,  57,  49, 201, 224, 124,  14, 136, 228, // !f5.91..|...
- 131, 243, 213,  37, 211, 122, 153, 246, 205,  60,  24, 129, // ...%.z...<..
- 160,  51, 115, 208, 247, 244,  76, 110,   8,  68,  24, 224, // .3s...Ln.D..
-  64,  31,  70, 200, 108, 142,  76, 105, 240, 168,  56,  73, // @.F.l.Li..8I
- 252, 255, 172, 252,  70, 247, 238,  63,  86, 232, 159,  92, // ....F..?V...
- 143, 195, 213, 203, 217, 156,  95, 248,  22,  54,  55,  48, // ......_..670
- 237,  95, 194,  44,  26, 141, 121, 131, 179,  24, 174, 195, // ._.,..y.....
-   6,  77,  90, 203, 160,  71,  43, 247, 232, 139, 123,  43, // .MZ..G+...{+
-  72,  17, 100, 106, 165, 211, 230, 148,  85, 196, 253,  40, // H.dj....U..(
-  43,  18, 126, 183, 122,  25, 163, 253, 237, 223,  54,  54, // +.~.z.....66
- 182, 255,  99, 232, 239, 255, 252, 214,  63,  63,  73,  86, // ..c.....??IV
-   8,  59, 152, 242, 165, 222,  89, 111,  55,  86, 116,  58, // .;....Yo7Vt:
- 204,  56, 124,  78,  99,  86, 140,  91, 247,  27, 253, 237, // .8|NcV.[....
- 127, 252,  54,  61,  61,  92,  57, 141, 245, 217, 163, 236, // ..6==.9.....
-  60, 108, 180,  87, 218,  43, 119, 219, 237, 149, 206,  22, // <l.W.+w.....
- 149, 166, 250, 132, 237,  52, 142, 138,  98,  18, 108, 108, // .....4..b.ll
- 156, 157, 157, 173, 159, 109,  18, 197, 122, 184, 209, 109, // .....m..z..m
- 183, 219,  27,  84, 175, 177,  77, 189, 254,   6, 251, 133, // ...T..M.....
-  21, 212, 109, 172,  92, 240,  95, 225, 205,  52, 168, 157, // ..m..._..4..
- 198, 138,  49, 167, 108, 112, 131,  57, 149, 234, 226, 247, // ..1.lp.9....
-  66, 126, 205,  55,  27,  12, 115,   5, 247, 122, 111, 133, // B~.7..s..zo.
-  49, 204, 149, 127, 234, 142, 222, 210,  15, 122, 141,  13, // 1........z..
- 238,   3, 151, 151,  45, 110,  10,  60, 184, 243, 112, 243, // ....-n.<..p.
- 209, 125,  42,  79, 119,  90, 107,  28, 157, 196, 201,  69, // .}*OwZk....E
- 176, 242,  48, 143, 163,  68, 173,  76, 163, 116, 202, 177, // ..0..D.L.t..
- 237, 198,  38, 159,  17, 189, 149,   7, 221, 201, 121, 111, // ..&.......yo
- 148, 209, 140,  70, 148, 118,  96,   2, 128,   4,  52, 197, // ...F.v`...4.
- 163,  81,  66,  93, 163, 151,  86, 148,  14, 143,   8, 127, // .QB]..V.....
-  40,  19,  27, 248, 182, 173, 246, 191, 248, 235, 240, 187, // (...........
- 125, 114, 177, 146, 100, 135, 217, 111,  27,  40,  79,  51, // }r..d..o.(O3
- 136, 169, 216, 254, 143, 218,  13,  27,  38,  58,  81,  64, // ........&:Q@
- 180, 237, 189,  45,  94,  43,  34, 255, 241, 182,  85,  46, // ...-^+"...U.
- 165,  93, 220,  46, 167, 152, 211,  57,  88,  25,  39, 250, // .].....9X.'.
- 188, 199, 127,  91, 163,  24,  51,  74, 139,  22, 172,  12, // ...[..3J....
-   9,  15,  59,  73,  77, 250,  33, 145,  54,   4,   3, 189, // ..;IM.!.6...
-  21, 160, 124, 116, 255, 208,  11,  92, 240, 246,  86,  74, // ..|t......VJ
- 232, 104, 255, 139, 134, 171,  62, 134, 151,  35,  61, 142, // .h....>..#=.
- 102,  73,  17,  92,  30,  28,  50, 245,  21,  52, 254,  57, // fI....2..4.9
- 186,  63,  26, 142, 198,  13, 118, 174, 119,  16, 229, 143, // .?....v.w...
- 202, 140,  49, 255,  83, 102, 240, 145,  29,  52, 186, 119, // ..1.Sf...4.w
- 218,  56, 111, 241, 133, 140,  98,  53,  58, 119, 236, 187, // .8o...b5:w..
- 173, 120, 231, 222, 214, 214, 221,   7,  13,  53, 137,  82, // .x.......5.R
- 157, 212, 218, 179, 105, 149, 109,  49,   6, 176, 133, 127, // ....i.m1....
- 107,  89,  31,  88, 246,  21,  52, 218, 235,  93,  76, 144, // kY.X..4..]L.
- 201, 123, 103,  38, 177,  33, 211, 102, 231, 210, 228, 126, // .{g&.!.f...~
- 140, 139,  68, 239, 176,  97, 109, 208, 104, 153,  34,  45, // ..D..am.h."-
-  83, 134, 160, 183, 181, 164, 248,  13,  45, 210, 239, 230, // S.......-...
-  13,  29,  56, 159, 243,   0, 255, 186, 121, 208, 234, 251, // ..8.....y...
-  67,  86, 145,  97, 124,  33,  75, 166, 171, 189,  78, 117, // CV.a|!K...Nu
-  16, 140,  39,  75,  63,  58, 115, 198, 147,  35, 201,  85, // ..'K?:s..#.U
-  23, 221, 173, 187, 155, 250, 160,  76, 175, 205,  90,  61, // .......L..Z=
- 239,   5, 150, 222, 102, 109,  30, 220, 239, 142, 239, 218, // ....fm......
- 172,  39, 241,  20, 241, 220,  71, 229, 116, 119, 104, 186, // .'....G.twh.
- 203, 138, 206,  12, 116, 187, 181, 111, 142, 211, 201, 172, // ....t..o....
- 168, 247,  57,   4, 145, 206, 233,  79, 243,  60, 203,  23, // ..9....O.<..
-  50, 183, 182, 108, 165, 250, 146,  59,  13,  93,  91,  87, // 2..l...;.][W
- 206, 115, 199,  96, 166,  95, 114, 197,  50, 216, 205, 238, // .s.`._r.2...
-  72, 182, 169, 173,  71, 113, 161,  71,  78, 119,  91, 212, // H...Gq.GNw[.
-  33, 230,  61, 207,  14, 233, 252, 159, 222,   4,  76, 181, // !.=.......L.
- 108,  83, 153, 125, 229,  11,  74,  64, 228, 141, 229,  78, // lS.}..J@...N
-  80, 163, 247,  59, 163, 241, 240,  94,  67, 209, 245, 149, // P..;...^C...
- 151, 203, 165, 199, 119, 182, 238, 108,  53,   8, 197, 136, // ....w..l5...
- 242,  99, 119,  55, 221, 221, 162, 127, 163,  37, 187, 105, // .cw7.....%.i
- 179,  75, 255, 222, 175, 111,  20, 173, 245, 181,  93,  98, // .K...o....]b
- 203,  45,   3, 185,  59,  93, 250, 247, 254, 210,  77, 116, // .-..;]....Mt
- 247, 238, 221,  37,  96, 117, 118,  20, 131,  90,  91, 132, // ...%`uv..Z[.
- 171, 187, 157,   7,   7, 247, 163, 165, 112,  85, 155, 134, // ........pU..
-  37, 176, 117, 175,  19,  29,  60, 136, 110, 130, 173, 123, // %.u...<.n..{
- 247, 238,  45,   5,  28,  78,  95,  50, 169, 132, 163, 253, // ..-..N_2....
-   8, 255, 243,  15,  92, 141, 106,   5, 164, 228, 202, 229, // ......j.....
- 138,  61,   7, 229, 212,  18,  75, 121,  58,  41, 123,  43, // .=....Ky:){+
- 213,  25, 218, 163, 178, 231,  56, 186, 249,  85, 148, 137, // ......8..U..
-  91, 240,  39,  80,  59, 243, 103, 113, 171,  58, 238, 213, // [.'P;.gq.:..
- 244, 130,  48, 131, 147, 214,  44,  86,  78, 226, 195, 201, // ..0...,VN...
-  36, 209,  43,  60, 168, 149, 167,  39, 217, 183,  88, 237, // $.+<...'..X.
- 234, 195,  76, 175, 124, 122, 185, 248, 186, 123, 113, 114, // ..L.|z...{qr
- 144,  37, 234,  77,  86, 100, 110, 249, 222, 202, 252,  31, // .%.MVdn.....
- 215, 199, 125, 122, 132, 244,  72, 173,  68, 193, 105,  60, // ..}z..H.D.i<
-   5, 140, 226, 145, 174, 148,  99,  42, 199,  97,  66, 233, // ......c*.aB.
- 154, 218, 218,  26, 155, 139, 101, 164, 135,  89,  30, 201, // ......e..Y..
- 193,  46,  87, 221, 252,  31, 255,  88,  83, 255,  88,  11, // ..W....XS.X.
- 130,   3, 142, 217, 200, 143, 209, 152,  16, 150, 149,  75, // ...........K
- 186, 244, 110, 248, 248, 127,  80,  45,  66, 159, 127,  68, // ..n...P-B..D
- 249, 168, 197,  76,  61,  46, 236, 220, 114, 167,  81, 238, // ...L=...r.Q.
- 181,  90, 246, 228, 246, 123, 148, 107,   6,  83, 229, 240, // .Z...{.k.S..
- 183, 113,  86, 229,  21, 194, 230,  27,  40, 247, 165,  39, // .qV.....(..'
-   8, 194,  34, 186,  37, 105,  76, 139, 183,  21, 178, 245, // ..".%iL.....
- 201, 164, 184, 104,  57, 133,  22, 154, 156, 229, 137,  23, // ...h9.......
- 159,  68, 135, 122, 186,   1, 218, 109, 130,  72, 140, 167, // .D.z...m.H..
- 135,  62, 161,  69,  19,  29,  21,  43,  67, 230,  19, 216, // .>.E...+C...
- 159,  49, 120, 182,  24, 212,  66,  71,  44, 167, 105, 209, // .1x...BG,.i.
-   4, 159,  76,   3,  83, 182, 183, 242, 109,  54,  45, 226, // ..L.S...m6-.
- 177, 244,  77,  73, 101,   6,  85, 119, 174,  97, 185, 120, // ..MIe.Uw.a.x
- 101, 250, 104, 209,  38, 231,  43, 211,  44, 137,  71,  43, // e.h.&.+.,.G+
- 255, 140, 162,  72,  62, 144, 225,  88, 173,  24, 255,   4, // ...H>..X....
- 252,   1, 182, 251,  56,   5, 126, 208, 146,  65, 152,  37, // ....8.~..A.%
-  16, 125,  13,  59,  87, 215,  14, 189,  27, 230, 212,  61, // .}.;W......=
-  48, 149,  73, 115,  79,   4, 223, 239, 253, 116, 145, 174, // 0.IsO....t..
- 141, 255,  90, 247, 139, 133,  45, 206,  72, 248, 248, 208, // ..Z...-.H...
- 187,  86,  26, 144, 161,  86,  58, 254, 202,  26, 218, 228, // .V...V:.....
- 106,  68, 124,   8,  54,  36, 176, 121,  19, 244, 173,   8, // jD|.6$.y....
-  48,  87,  56, 136,  78, 146, 120,  50, 141, 167, 132, 135, // 0W8.N.x2....
- 224,  24, 106,  73, 100, 101, 106, 229, 140, 176,  92,  23, // ..jIdej.....
-  89,  57,  34, 132,  74, 167, 229,  94, 111,  95,   3,  76, // Y9".J..^o_.L
-  30, 223, 199, 218, 135,  59,  96, 189, 248,  33, 246, 174, // .....;`..!..
- 133,  32, 225, 254, 230, 230,  22, 127,  11, 173, 118,  85, // . ........vU
- 239, 204, 108, 213, 133,  74, 114, 119, 251, 180, 248, 178, // ..l..Jrw....
- 246,   4, 216,  37, 192,  56,  69, 205, 125, 228,   3, 206, // ...%.8E.}...
-  75, 224,  88,  44,  89, 187, 186, 124, 217,  18,  83,  90, // K.X,Y..|..SZ
- 159, 101, 219, 101,  41,  20,  27, 252, 176,  43, 112, 122, // .e.e)....+pz
- 125, 178, 230, 101, 123, 219,  43,  60, 172,   1,  56,  31, // }..e{.+<..8.
-  97,  67, 120, 228, 123, 212,  75,  29,  55,  52, 171, 190, // aCx.{.K.74..
- 133,  67,  53,  26, 162, 151,  86, 109, 142, 107, 119, 132, // .C5...Vm.kw.
- 127, 115, 251,  88, 100, 110, 222,  52, 184, 105, 135,  88, // .s.Xdn.4.i.X
- 110, 153,  96, 100, 110, 133, 114, 239, 184,  41,  92, 100, // n.`dn.r..).d
- 253,  90, 145,  90,  10, 247,  91, 166,  80,  95,  55, 159, // .Z.Z..[.P_7.
-  69,  43, 183, 226, 147,  73, 150,  23, 132, 183, 211,  70, // E+...I.....F
-  17,  14,  31, 129,  24,  97, 235, 224, 251, 211, 161, 177, // .....a......
-  98,  87, 115,  93, 176, 133, 170, 199, 234,  93, 250, 147, // bWs].....]..
- 247, 237, 181, 165, 253, 213,  80,  13, 223, 109,  21, 152, // ......P..m..
-  16, 170, 200,  86, 184,  14, 183, 139, 168, 146,   1,   6, // ...V........
- 153, 239, 155,  79,  21,  23,  40, 110,  58, 217,  92,  88, // ...O..(n:..X
-  49,  39,  26,  53, 231, 238,  54, 187, 217,  22, 206,  40, // 1'.5..6....(
- 103, 203, 184,  56, 128, 156,  84, 138, 193, 174, 218,  53, // g..8..T....5
- 139, 160,  93,  67,  28, 221, 131, 101, 122,  20, 141,   0, // ..]C...ez...
- 109, 114,  78, 216, 197,  96, 157,  88, 140,  50, 155, 213, // mrN..`.X.2..
- 143,  17,  57, 185, 110,  24, 202, 194,  57,  84,  59, 220, // ..9.n...9T;.
- 174, 161,  45, 215, 118, 182,  91, 174, 218, 217,  10,  20, // ..-.v.[.....
- 236, 226, 121, 186, 128,  51,  81, 246,  18,  96, 171, 239, // ..y..3Q..`..
- 141,  27, 143, 159, 170, 195,  27, 206, 159, 185,  93, 247, // ..........].
- 224,   8,  59, 122,  57, 100,  47,  32,  93,  52, 162, 149, // ..;z9d/ ]4..
- 170,  94,  68,   4, 224, 169, 198, 238, 102,  41,  33,  29, // .^D.....f)!.
- 193,  57,  62,  45,  37, 116, 214,  35, 210,  66,  32, 211, // .9>-%t.#.B .
- 148, 117, 182, 148, 219, 235, 245, 244, 245,  27,  74, 254, // .u........J.
-  98,  11,  94,  71,   1, 235, 219, 113, 217, 150,  88,  86, // b.^G...q..XV
- 233, 198, 141, 251,  15, 227, 155, 186,  53, 140, 243,  97, // ........5..a
- 162, 157, 147, 243, 230,  61, 226, 236, 133, 165,  59, 129, // .....=....;.
-  15,  54, 183, 213,  22, 139,  23,  29, 196, 172,  59, 220, // .6........;.
- 234,  93,  47, 149, 243,  44, 216,  50, 250, 206,  29,  30, // .]/..,.2....
- 224,  63, 214, 139, 236, 240,  48,  17,  84, 203,  10,  74, // .?....0.T..J
-   2,  66,  98, 146,   8, 235,  84,  30, 187,  93,  75, 246, // .Bb...T..]K.
- 151,  88, 226, 250,  93, 161, 252,  75, 252, 150,  26, 160, // .X..]..K....
-  41,  47,  98, 130, 167,  22, 127,  88, 176,   2, 135,  30, // )/b....X....
-  43, 203, 118, 138, 116, 250, 235, 157, 226, 150,  51,  40, // +.v.t.....3(
- 134, 131, 224,  47, 133, 117, 169, 242,  49, 167,  12, 174, // .../.u..1...
- 241, 118,  60,  86,  63,  89,  59, 119, 255,  47,  57,  93, // .v<V?Y;w./9]
- 220,   1,  84, 167, 203,  61, 247, 116,  89,  64,  47,  22, // ..T..=.tY@/.
- 143,  13, 106, 158, 118, 245, 193, 113,  76, 144,  49,  33, // ..j.v..qL.1!
- 212,  48, 135, 149, 154,  45, 220,  58, 201, 126,  44,  73, // .0...-.:.~,I
- 190, 150, 130, 141,  39,  67, 113, 241, 232,  18,  65, 108, // ....'Cq...Al
-  52, 122, 206, 226,  89,  41,  87, 111, 133, 181, 226,  49, // 4z..Y)Wo...1
- 171,  61,  44, 133, 125, 194,   4, 218, 162,  73,   2,  94, // .=,.}....I.^
- 193, 148, 143,  93, 195, 108,  89, 223,  92,  92, 105, 147, // ...].lY...i.
- 112, 211,  92, 191, 136, 210,  81, 162, 127, 138,   1,  46, // p.....Q.....
-  76,  48,  46, 113, 231, 147, 134,  71, 122, 120, 124, 195, // L0.q...Gzx|.
-  38, 189, 182, 156, 169,  90, 122, 168, 201, 193,  81, 111, // &....Zz...Qo
- 176, 156,  43, 249, 102, 162,  68,  78, 130, 149,  50, 166, // ..+.f.DN..2.
- 220,  23, 143, 215,  25, 100, 218,  74, 107, 101, 147,  64, // .....d.Jke.@
- 175, 214,  70, 121, 164, 152, 132, 191, 127, 150, 252, 228, // ..Fy........
-  88,  24,  18, 141, 115,  29, 231, 114, 153,  68, 215,  39, // X...s..r.D.'
- 205, 157, 217,  26,  94, 126,  35,  18, 189,  72, 102,  47, // ....^~#..Hf/
- 221,  47, 181, 165,  18, 134,  28, 181,  68, 255, 182, 177, // ./......D...
- 185, 207,  91,  53,  30, 220, 220,  12, 125, 155,  14, 178, // ..[5....}...
- 211,  32,  45, 142,  90,  67, 150,  57, 208, 238, 189,  52, // . -.ZC.9...4
-  71,   1,  33, 211,  52,  21,  39,  14, 238, 183,  20, 123, // G.!.4.'....{
- 190, 169, 165,  46,  90, 114, 110, 167, 206,  93, 244,  91, // ....Zrn..].[
- 195, 122, 233,  18,  92, 134,  80, 254,  61, 236,  29, 171, // .z....P.=...
- 192, 159,  94, 195,  96, 126, 193, 173, 116, 121, 158,  75, // ..^.`~..ty.K
- 169, 161, 250, 100, 254, 132, 190, 185, 190,  52,  63, 163, // ...d.....4?.
- 111, 156, 210,  75, 232, 155, 191,  10,  39,  32, 133,  22, // o..K....' ..
- 103, 205, 165,  41, 151,   1, 225, 114, 138, 131, 203,  56, // g..)...r...8
-  20, 199, 205,  24,  69,  89, 178,  68,  40, 238, 213, 233, // ....EY.D(...
- 153, 218, 229,  42,  60,  35, 135,  78, 154, 219,  69,  18, // ...*<#.N..E.
-  48,  97, 239, 178,   2,  40, 188, 108, 246, 242, 113, 107, // 0a...(.l..qk
-  87,  92, 212, 235, 152, 223,  53, 198, 169,  59, 127,  22, // W.....5..;..
- 110, 255, 206,  82, 253, 106, 206, 111, 206, 104, 203, 141, // n..R.j.o.h..
- 121,   3,   8, 185, 124, 179, 159,  46, 194,   2, 223, 246, // y...|.......
-  87,  43,  81, 227, 229,  94,  95,  14, 108,  10, 182, 239, // W+Q..^_.l...
- 230,  83, 238, 215, 184, 202,  34,  62, 207, 123, 172, 117, // .S....">.{.u
- 160, 139,  51, 173, 237, 118, 233, 148, 196, 149, 101,  91, // ..3..v....e[
- 150, 180, 151, 156,  41,  37,  76, 218, 141, 188, 124, 110, // ....)%L...|n
- 151, 176,  68, 149,  61,  99, 150,  31, 108, 166,  70, 117, // ..D.=c..l.Fu
- 119, 148,  55,  71, 117, 103, 148, 183, 102, 133, 241, 252, // w.7Gug..f...
- 253, 207, 182, 233,  75,  16, 157, 250, 176, 205, 172,  47, // ....K....../
-  69, 117, 150,  48, 117, 229,  62, 178,  25,  45,  94,  25, // Eu.0u.>..-^.
- 154, 188,  31,  68, 151, 141, 112,  74,  63, 184,   6, 224, // ...D..pJ?...
- 139,  84, 123, 125, 119, 217,   9, 113, 104, 133,  27,  96, // .T{}w..qh..`
- 197, 148, 172,  32, 165, 227,  32,  60, 203,  96, 209, 169, // ... .. <.`..
-  96,  32, 209,  29, 249,  65, 132,  75, 184, 156, 235,  10, // ` ...A.K....
-  65,  49, 123, 174,  13, 188,  68, 188, 125,  89,  92, 133, // A1{...D.}Y..
-  31, 110,  94, 212,  71,  81,  94,  91, 210, 146,  55, 235, // .n^.GQ^[..7.
-  27, 242, 244,  48, 154,  29, 234, 146, 172, 173, 125,  29, // ...0......}.
- 103, 201,  52, 139,  24, 255, 134,  21, 113, 202, 149, 215, // g.4.....q...
- 231, 141, 136, 162,  83, 184,   4,  78, 103, 206, 230, 102, // ....S..Ng..f
-  68,  66,  76, 116, 104,  96,  86,  54, 232,  86, 255, 249, // DBLth`V6.V..
-  71, 185,  45, 116, 151, 183, 240,  83,  88,  47,  91,  96, // G.-t...SX/[`
-  65, 111,   9,  78, 203,  65, 128,  75,  46,  95, 255, 101, // Ao.N.A.K._.e
-  82,  77, 119,  12,  22, 188, 236,  16,  42, 142, 223, 114, // RMw.....*..r
- 224,  41, 187, 178,  84, 238,  61, 166, 114, 151, 202,  44, // .)..T.=.r..,
-  23, 190,  65,   0,  75,   6,  84,  98,  42, 247,   1,  58, // ..A.K.Tb*..:
-  50,  44, 203, 141,  54, 149, 162,  60, 207, 206, 132, 246, // 2,..6..<....
- 132, 160, 245, 206,   3, 252, 187, 248,  65, 245, 210, 173, // ........A...
-  81,  86, 148,  53,  24, 147, 184, 177,  60, 252, 134,  56, // QV.5....<..8
- 203, 242, 207, 209,   3, 252, 219,  91,  24,  30, 161,  15, // .......[....
- 102, 116,  82, 221,  18,  88,  12, 240, 181, 182, 120, 226, // ftR..X....x.
- 150, 175, 243,   7,  48, 201, 156, 137,  54, 159, 226,  47, // ....0...6../
-  89, 142, 155, 139,  46,  27, 215, 205, 176, 192, 237, 184, // Y...........
-  87, 199, 157,  26,  21, 116, 211, 186, 150, 213, 236, 226, // W....t......
- 118, 120, 113, 255, 174, 172, 154, 182, 244, 192,  40, 246, // vxq.......(.
- 237, 185,  71, 137,  67, 169, 206, 171,  18,  21, 226, 191, // ..G.C.......
- 140, 160, 224,  50,  37, 203, 250, 159, 119, 238, 220, 249, // ...2%...w...
- 233, 206, 182,  21, 126, 198,  97, 170, 115, 184, 165, 130, // ....~.a.s...
-  59, 231,  90, 107, 223, 145, 137, 203, 202, 151, 103, 183, // ;.Zk......g.
- 145,  26, 202,  77, 185, 140, 142,  59, 151,  57,  17, 162, // ...M...;.9..
- 218, 222,  54, 213,  53,  64, 255, 220, 180, 116, 206,  88, // ..6.5@...t.X
- 110, 188, 246, 151, 173, 221,  66,  61, 139,  93, 212,  39, // n.....B=.].'
-  89, 132,  59, 127, 103, 150,  75, 138, 245, 191,  86, 254, // Y.;.g.K...V.
- 235, 250, 124,  44, 249, 114, 187, 167, 235,  20,  41, 191, // ..|,.r....).
-  45, 124, 191,  59,  50,  97,  19, 149,  64,  80, 246, 195, // -|.;2a..@P..
- 154,  98,  75, 139, 150, 159, 242, 179, 178, 101, 131, 229, // .bK......e..
- 103,  68,  69, 145, 123,  38, 223,  47, 175,  51, 144,  78, // gDE.{&./.3.N
-  66, 122,  51, 183, 122,  25, 241, 233, 181,  40,  75, 173, // Bz3.z....(K.
-  84,  20, 104, 147,  54, 134, 144, 160,  55, 144,  43,  75, // T.h.6...7.+K
- 231, 253, 255, 165, 191,  45, 116, 183,  98, 194,  75, 222, // .....-t.b.K.
- 217,  26, 105, 203, 230,  47,   8,  24, 168, 211,  27, 182, // ..i../......
-  89,  57,  65, 134, 219,  91, 206,  19, 213,  91, 224,  34, // Y9A..[...[."
-  93, 187, 231, 107, 253, 119,  65, 190, 172, 108, 172,  81, // ]..k.wA..l.Q
-  49,  90,   3, 225, 209, 175, 172, 109,  80,  11, 242,  45, // 1Z.....mP..-
- 174, 196, 244,  14, 225, 228, 124, 172,  47, 108,  83,  74, // ......|./lSJ
-  95, 196, 162, 255,  57, 220,  34,  88, 187,  83, 238,  73, // _...9."X.S.I
- 200, 240, 107, 187, 163,   3,  93,  25,  23, 137,  90,  34, // ..k...]...Z"
- 119,  92, 144,  61, 252,  69, 242, 144, 230,  96,  20,  77, // w..=.E...`.M
- 143,  14,  50, 180, 132,  41, 156, 232,  26, 222,  83,  77, // ..2..)....SM
- 226, 255, 182, 249,  73, 196,  72, 205, 234, 229, 238, 220, // ....I.H.....
- 190, 182, 198, 179,  36, 145,  67, 124, 197, 230, 187, 146, // ....$.C|....
- 102, 230,  66, 138,  48, 191,  37, 244,  82,  69, 170, 243, // f.B.0.%.RE..
-  68,  27, 204, 209,  81, 146,  49, 210,  19,  83, 105, 201, // D...Q.1..Si.
- 135, 252, 117,   4, 206, 201, 150, 173, 188, 180,  55, 135, // ..u.......7.
-  37,  21,  37, 137, 251, 222,  26, 205, 140, 100, 121, 179, // %.%......dy.
- 221,  62, 153, 214,  23, 178, 179, 245, 175, 114,  86, 156, // .>.......rV.
-  97,  46,  48, 184, 126, 222, 220, 255, 102,  33, 106,  44, // a.0.~...f!j,
- 145,  69, 157, 165, 106, 230, 150,  47, 189,  57, 196, 164, // .E..j../.9..
- 242, 108,  10, 177, 131, 200, 152, 140,  88, 225, 218,  81, // .l......X..Q
-  90, 215, 196, 240,  23,   9, 148, 159,  64,  11, 116, 185, // Z.......@.t.
-  42, 193, 254,  29,  97, 198, 184,  99,  55, 252, 169,  82, // *...a..c7..R
- 194, 241,  19, 185, 222, 175, 104,  31, 219,  29, 148, 238, // ......h.....
-  46, 175,  51, 142, 144,  80,  87, 140,  48,  21, 156, 117, // ..3..PW.0..u
-  51,  21, 238,  47, 112,  31, 183, 106, 250, 100,  55, 142, // 3../p..j.d7.
- 236,  38, 169, 185, 176, 244, 178,   4,  11, 178,  48,  35, // .&........0#
- 213,  72,  44, 172, 163, 197,  86,  18,  79, 129, 118, 221, // .H,...V.O.v.
- 188, 176,  92, 236,  26, 129, 188,  56, 153, 191,  98, 238, // .......8..b.
- 219,  77,  74, 152,  84, 117, 251, 255, 130,  23,  97,   6, // .MJ.Tu....a.
- 240, 146,  26, 173,  49, 197, 151, 225, 250, 118, 176,   2, // ....1....v..
-  94, 122, 100,  71, 125,  35, 132, 237, 154, 130, 104, 253, // ^zdG}#....h.
- 166, 118,  23, 152, 221, 152,  91, 123, 197, 180, 206,  91, // .v....[{...[
- 237,  26, 171, 181, 186, 124, 104, 255,  51,  57, 100,  46, // .....|h.39d.
-  27, 122, 154,  30, 235, 179,  47, 246, 225,  43,  63,  64, // .z..../..+?@
- 191, 246,  11,  56, 137, 252, 244, 149, 158, 184, 253, 150, // ...8........
- 219,   1, 206, 186,  27, 250, 104,  97,  49, 255, 215, 189, // ......ha1...
-  24, 168, 113, 160, 209,  48,  66, 123,  63, 191,   4,  43, // ..q..0B{?..+
- 125,  17,  11,  99,  75,  55, 253, 223,  19, 251, 212, 128, // }..cK7......
- 192, 236, 163, 206, 114, 122, 248, 218, 225, 176, 160,  33, // ....rz.....!
-  82, 233, 107, 222, 164, 132, 241, 215, 248, 166,   6,  15, // R.k.........
- 169, 246,  18, 129,  21,  31,  56,  68, 202, 254, 234, 115, // ......8D...s
- 170,  35, 155,  17,  79,  78,  99, 212, 193,  30, 133, 149, // .#..ONc.....
-   4, 126, 177, 117,  34, 115, 255,  31, 106, 111, 174,  92, // .~.u"s..jo..
- 254, 189, 137, 119, 154,  24, 197, 167,  70, 217, 225, 111, // ...w....F..o
-  12, 224,  31, 235, 241,  16,  50, 241,  26, 245,  89,  39, // ......2...Y'
- 223,  80, 192, 108,  46, 163, 124, 111, 215, 193, 144,  99, // .P.l..|o...c
- 104, 122,   8, 198,  25, 175, 243,  34, 149, 198, 184, 139, // hz....."....
-  83,  18,  62,   5, 203, 162,  75,  20,  99, 168,  55,  67, // S.>...K.c.7C
- 192, 223,  45,  89, 198, 229, 241, 247, 171, 130, 208,  17, // ..-Y........
- 128, 134, 211, 223,  57, 212, 255, 177,  46, 108,  60,  23, // ....9....l<.
- 149,  46, 207,  10, 172, 194, 114, 109, 171,   2, 114,  19, // ......rm..r.
- 139, 119,  45, 191, 205, 164, 200, 162, 188,  32,  27, 141, // .w-...... ..
- 252, 165, 135, 218,  18,  62, 170, 224,  66,  19, 198, 128, // .....>..B...
- 162, 148,  62,  77, 250,  64,  74, 171, 124,  95, 233,  76, // ..>M.@J.|_.L
-   9,  23,  29, 195,  20,  77, 175, 136,  11,  44,  84, 252, // .....M...,T.
-  63, 199, 250,  98, 156,  71,  39, 122, 186,  88,  30,  56, // ?..b.G'z.X.8
-  47,  33, 180,  53,  33, 147,  61, 130,  44,  82, 189, 194, // /!.5!.=.,R..
- 243, 179, 180, 204, 230, 221, 178,  20, 171,  85,  24,  45, // .........U.-
-  59, 103, 124, 156,  84,  31, 160, 140, 171,  28, 231, 194, // ;g|.T.......
-   0,  23,  43,  96, 132,  91, 220, 189, 137,  55, 106,  16, // ..+`.[...7j.
-  67, 102, 202, 206,  96, 129,  84, 235, 143, 147, 220, 254, // Cf..`.T.....
- 214, 183, 166,  55, 117, 181,  88, 150,  53, 246, 242, 140, // ...7u.X.5...
- 239,  25, 232,  89,  25, 141, 138, 182, 252,  75, 183,  89, // ...Y.....K.Y
- 126, 120,  16, 121, 221, 173,  45, 181,  82, 253,  33,  98, // ~x.y..-.R.!b
- 218, 204,  82, 145,  45, 173, 216,  45, 107, 222, 189, 163, // ..R.-..-k...
-  86, 236, 255, 109,  59, 105, 255, 231,  68, 143, 226, 104, // V..m;i..D..h
- 197, 115,   0, 244,  46, 180, 188, 125,  30, 142,  72,  16, // .s.....}..H.
- 212, 138,  21, 186,  85,  18,  46,  11, 179,  84, 230, 167, // ....U....T..
-  24, 178, 204, 150,  83, 170, 186,  37,  74,  50, 162, 211, // ....S..%J2..
- 105,  91, 181,  78,  51, 116, 220, 221, 109, 243, 255, 130, // i[.N3t..m...
- 254,  33,  15, 251,  63, 234, 105, 120,  89,   0,  64, 131, // .!..?.ixY.@.
-   6, 225,  37, 113, 218,  80, 216, 133,  65,   3,  72,  97, // ..%q.P..A.Ha
-  67,  37, 250,  84,  39,  65,  91, 193,   0, 122,  87, 209, // C%.T'A[..zW.
- 118, 161, 171,  55,  24,  92,  90,  75, 232,  70, 169, 153, // v..7..ZK.F..
- 216, 224,  34, 141,  58,  38, 123,  19,  54, 212, 248,  11, // ..".:&{.6...
-  45, 153,  43, 196, 124, 251,  93, 123, 188, 217, 100, 150, // -.+.|.]{..d.
-  36, 223,  89, 175, 221,  42,  70, 215, 190, 126,  67, 177, // $.Y..*F..~C.
- 138, 247, 211,  71, 127,  77, 156, 182, 128, 137, 243,  27, // ...G.M......
- 166,  57,  88, 225, 139, 231, 175, 140, 187, 166, 134,  54, // .9X........6
- 133,  65, 218, 207, 186, 112,  90, 132,  98,  88, 208, 224, // .A...pZ.bX..
- 163, 142, 214,   0,  63, 193, 106,  53, 169,   2, 132,  53, // ....?.j5...5
- 131, 132, 251, 235, 117,  17, 249, 157,  37, 205, 207, 247, // ....u...%...
- 230, 234, 230, 177,  94,  31, 151, 243, 177,  55, 141, 243, // ....^....7..
- 167, 107, 191, 100, 152,  29,  25, 215, 178, 121, 249, 235, // .k.d.....y..
-  75, 178, 124,  17, 112, 132,  69,  69, 208, 248,  67,  39, // K.|.p.EE..C'
- 195, 236,  68, 223, 178,   3, 113,  57,  73, 247, 177,  35, // ..D...q9I..#
-  28, 122, 141,  71, 211, 160,  89, 177, 149,  95, 232, 156, // .z.G..Y.._..
- 232, 254, 233, 255, 252, 119, 244,  63, 255, 205, 104,   6, // .....w.?..h.
- 161,  28,  72, 162,  62,  86,  78, 208, 198, 202,  89, 148, // ..H.>VN...Y.
-  22, 116,  40, 252, 207, 127, 143, 244, 116, 152, 199,   7, // .t(.....t...
- 122, 133,   8, 244, 255, 175, 189, 107, 223, 111, 218, 216, // z......k.o..
- 214, 255, 247,  41,  20, 253, 104,  42,  53, 194, 177, 115, // ...)..h*5..s
-   1, 182, 131, 240,  15,  10,  20, 246, 134, 150,  77,  74, // ..........MJ
-  57, 109, 146, 147,  40, 182, 156, 168,  56, 146,  43, 201, // 9m..(...8.+.
- 132, 224, 248,  93, 120,  22, 158, 236, 172, 111, 205,  69, // ...]x....o.E
-  35,  89, 190, 112, 217,  52, 244, 236, 125,  33, 242, 104, // #Y.p.4..}!.h
-  52, 151,  53, 107, 214, 172, 185, 125, 159,  21, 146,  20, // 4.5k...}....
-  98, 138, 157, 244, 223, 191, 163, 184, 169,  69,  29, 230, // b........E..
- 117, 132, 128, 148, 210, 138,  47, 172, 132,  98, 177, 117, // u...../..b.u
- 228, 140,  96, 151, 144,  36,  73,  45, 227,  49,  93,  31, // ..`..$I-.1].
- 241, 161, 210, 165,  60,   7, 203,  56,  19, 112, 199,  91, // ....<..8.p.[
- 114, 113, 133, 122,  36, 117, 201, 147, 247, 239, 162, 184, // rq.z$u......
-  49,  95, 202,  27, 134, 151, 163, 170, 190,  85, 169, 186, // 1_.......U..
- 242,  17, 160,  21,   7, 243,  53, 163, 212, 131,  84, 183, // ......5...T.
- 154, 213,  92,  51,  39,  61, 243, 142, 100, 126, 174, 254, // ...3'=..d~..
-  38,  77,  36, 219, 131,  91,  58, 205,  58,  61,  44, 222, // &M$..[:.:=,.
- 126,  14, 157,   3, 134, 131,   5, 115,  89, 168, 156, 144, // ~......sY...
- 242, 198, 116,  67, 176,  14,  86,  14,  38, 136, 153, 150, // ..tC..V.&...
- 169, 136,  47,  72,   5,  98,  26, 207, 108,  13,  52,  97, // ../H.b..l.4a
- 179,  97,  70,  28, 105,  28, 176,  58,  37, 175,   6, 180, // .aF.i..:%...
- 197,  25,  82,  47,  13, 251, 210, 114, 227, 178, 157,  72, // ..R/...r...H
- 192,  72, 244,  25, 165, 116,  78, 158, 252, 178, 137,  14, // .H...tN.....
- 117, 124,  35,  97,  29,  88,  46, 173,  21, 244, 206, 162, // u|#a.X......
- 120, 157, 255, 181, 164,  14, 175, 227,  31, 140, 160, 114, // x..........r
-  48,  97, 233,  40, 251, 140,  67, 225, 165,  11,  99, 124, // 0a.(..C...c|
- 163,  74, 151, 132,  63,  17, 103,  88, 108,  79, 142,  73, // .J..?.gXlO.I
-  44, 230, 199, 122,  84, 202,  88, 161,  98, 179, 116,  53, // ,..zT.X.b.t5
- 122, 208,  50, 181, 156, 244, 252, 174,  63, 158,  30, 157, // z.2.....?...
- 150,  53, 105, 159, 103,  56, 171, 235,  10,  75,  25, 255, // .5i.g8...K..
-  25, 198,  94, 173,  72, 124, 208, 217, 253, 138, 207, 187, // ..^.H|......
-  96, 116,  40,  57,  31, 162,  43, 213, 228, 182, 160, 242, // `t(9..+.....
- 114, 189, 184, 109, 223,  15, 217,  56, 210, 171,  88, 116, // r..m...8..Xt
-  61,  75, 156,  12, 148, 153,  45, 113, 152, 123,  90,  92, // =K....-q.{Z.
- 221,  68,  43, 134,  56,  95,  40,  18, 251, 238, 218, 120, // .D+.8_(....x
-   0,  36, 220,  70, 194, 139, 195,  86, 199, 146,  26,  88, // .$.F...V...X
- 221, 208, 220, 177, 173, 118, 249, 157, 118, 142, 236, 201, // .....v..v...
- 119,  44,  29, 145, 147, 232, 106,  74, 245, 169, 154, 185, // w,....jJ....
-   5, 108, 220, 182, 165, 114,  66,  16,  66,  38,  37, 217, // .l...rB.B&%.
- 181, 165, 199,  41, 218, 202, 232, 130,  83,   5, 252,  78, // ...)....S..N
- 204,  87, 190, 163, 242, 124, 247, 221, 196, 158, 145, 241, // .W...|......
- 229,  84, 234,  50, 229,  25, 241, 159,  94,  88, 195,  52, // .T.2....^X.4
- 233, 141, 186,  57,  15,  59, 137, 217, 237,  63,  45, 101, // ...9.;...?-e
-  85,   1, 101, 114, 140,  34, 155, 173,  34, 156,  72,  51, // U.er."..".H3
- 101,  45, 142,  82, 183, 167,  86,  85, 253, 222, 232, 231, // e-.R..VU....
-  20, 170, 135, 170, 103, 255, 237, 194,  95, 162,  11,  47, // ....g..._../
- 171,  69, 178,  85, 238, 213,  82, 168,  40,  20, 110,  32, // .E.U..R.(.n 
- 182,  10,  50, 141, 142, 252, 235, 216,  13,  27, 120,  14, // ..2.......x.
- 123, 121,   1,  23, 237, 129, 116,  54,   1, 252, 249, 237, // {y....t6....
-  34, 148, 241, 189,   1, 236,  13, 170, 158, 203,  75,  39, // ".........K'
- 220, 195, 143,   3,  31, 176, 170, 161,  47, 127,  41,   8, // ......../.).
-  39, 205, 186,  62,  88,  93,  21, 228,  42,  22, 163, 229, // '..>X]..*...
- 139, 240,  21,  14, 119,  16,   2, 228, 209, 116, 226, 221, // ....w....t..
-  47, 129,  23, 145,  30, 227,  17, 156,  34, 167, 170, 148, // /......."...
-  29, 219, 221, 107,  29,  72, 220, 203, 177,   6,  10, 152, // ...k.H......
-  19, 247, 242, 210, 182,  93,  21, 180, 106,  23, 128, 158, // .....]..j...
- 185,  68, 170,  25, 248,  90,   6, 190, 237, 238, 132, 123, // .D...Z.....{
- 184, 175, 214,  11,  95,  60, 127, 252,  67,  66, 158,  96, // ...._<..CB.`
-  12,  52,  25,  64,   1, 184,   7, 126, 237, 155, 214,   1, // .4.@...~....
- 211, 155,  76, 188, 231,  10,  75, 139, 193, 215, 104, 150, // ..L...K...h.
-  27, 101, 161,  51, 240, 239,  24, 184,   7,   3,  65, 221, // .e.3......A.
- 238,  61, 242, 247,  76, 149, 144, 237,  42, 123, 168,  82, // .=..L...*{.R
-  85, 229,   0, 216, 226, 132,  41,  61, 244, 210, 100,   8, // U.....)=..d.
- 166,  46, 122,  20, 151,  58, 240,  32, 141, 181, 157,   5, // ..z..:. ....
- 175,  67, 213,  87, 237,  64,  64, 146, 120, 118, 146,   7, // .C.W.@@.xv..
-  64, 144, 146, 231,  98,   0,  28, 133, 109, 119,   1,  32, // @...b...mw. 
-  53,  60, 165, 191,  64, 250,   9,   0,  44,  85,  26, 228, // 5<..@...,U..
-  43, 125,  31, 119, 207,  67, 251, 160,  64,   0, 251, 221, // +}.w.C..@...
- 129, 248,  21, 192, 201, 163,   6,  79, 115, 127,   6, 161, // .......Os...
-  13,  20, 181, 192, 240, 186,  13, 172, 213, 220,  95, 115, // .........._s
- 108, 161, 180,  54, 212,   6,   2, 216, 203,  15, 248, 194, // l..6........
- 254,  99,  40, 227, 120,   2, 222, 120, 111,  12,  36,  53, // .c(.x..xo.$5
- 246, 227, 219, 134, 246, 198, 238,  88,  67, 162, 132,   7, // .......XC...
- 224,  70,   0, 197,   0, 244,  45, 103,  94, 249,   3,  63, // .F....-g^..?
- 246,   6, 107, 107,  19, 143, 185, 124, 166, 191,  31, 184, // ..kk...|....
-  99,  73, 236,  35, 190, 167,  47, 247,  64, 213,  52,  28, // cI.#../.@.4.
-  29,  15, 162, 236, 180,  18, 149,  70,  27, 240,  74, 203, // .......F..J.
- 152,   5,  98,  20, 243,  93,  49, 153, 130,  51,  96,  86, // ..b..]1..3`V
- 145, 151, 170, 181, 181,  18, 241, 153, 147,  78,  99,  20, // .........Nc.
- 117,  26,  56, 182, 192, 123, 133, 164, 125, 242,  78, 186, // u.8..{..}.N.
- 173, 100,  50,   5,  25,  21,  54, 100,  20, 143, 129, 181, // .d2...6d....
-  38, 222, 139,  25,  96, 238, 128,  48, 243,   7, 102,  62, // &...`..0..f>
- 156,   7, 195, 172, 165, 229,  23, 210, 240,   0,  46, 193, // ............
- 168,  67, 210, 183,  76,  48, 182,  92,  67,  56, 153, 161, // .C..L0..C8..
- 137, 235,  42,  32, 186, 132, 197,   0,  97, 236,  48, 131, // ..* ....a.0.
-  25,   4,  63,  16,  64, 135,  81,   9, 214,  45, 118,  21, // ..?.@.Q..-v.
-  54, 216, 209, 245, 235, 215, 198, 225,   4,   3,  48, 162, // 6.........0.
-  79, 118, 142,  92, 102,  54, 113, 236, 253, 216, 178,  52, // Ov..f6q....4
- 250, 139,   5,  80,  18,  50, 151, 221, 144,  44,  79, 121, // ...P.2...,Oy
- 115, 149,  92, 200,  53, 138,  92,   9, 229, 175, 215,  34, // s...5......"
- 188, 177, 221, 201,  14, 154,  41, 240, 157, 200, 177, 111, // ......)....o
- 190, 248,  87, 240, 163, 237, 122, 139,  30,   5,  98, 215, // ..W...z...b.
-  31,   2, 190,  77,  96,  69,  49,  42, 208, 155,  28,  40, // ...M`E1*...(
- 110,  15,  75, 152, 153,  18, 146, 149,  37,   9, 227,  44, // n.K.....%..,
-  58,   3,  73,  64,  65, 119, 140,   0, 233, 143,  48, 116, // :.I@Aw....0t
- 236, 116,  10,   2, 101,  86, 180,   2, 251, 163, 250, 166, // .t..eV......
-  10, 142, 210,  15,   1, 213,  99,   7, 195, 104,  93, 100, // ......c..h]d
-  78, 134, 139,  36,  17, 243,  75, 109, 237, 210,  16, 125, // N..$..Km...}
- 215,  97, 102, 158, 186,  18, 127,  15, 148,  30,  82, 168, // .af.......R.
- 159, 166,  70,   3, 133, 176,  42, 149, 166,  65,  25, 117, // ..F...*..A.u
-  26, 212,  39, 165,  46,  37,  34, 152, 187, 192,  20,  90, // ..'..%"....Z
- 145, 124, 233, 174, 174,  78, 225,  16, 198, 164,  58, 242, // .|...N....:.
-  53, 172, 122,  88,  34, 168,   8, 111, 167,  38, 226, 154, // 5.zX"..o.&..
- 180,  29,  41, 180,  75, 243, 104, 160, 155, 229, 128,  91, // ..).K.h....[
- 193,  58,  68, 246,  50, 202,  73,   8, 163, 232, 208,   6, // .:D.2.I.....
- 191, 178,  74, 152, 148, 144, 169,  75,  38,   2,  30, 169, // ..J....K&...
- 196,  30,  39, 227, 208, 192, 149, 186, 249, 220,  84, 114, // ..'.......Tr
- 208, 148, 228,  32,  64, 145, 159, 140,  27, 141, 134, 124, // ... @......|
- 158,  24,  60, 120,  63,  27,   4,  44, 166, 176, 216, 205, // ..<x?..,....
- 234, 232,  62,  71, 254,  20,  47, 201, 117,  58,  77, 111, // ..>G../.u:Mo
-  96, 198, 132,  12, 103, 130,  32, 198, 210, 124,  36, 106, // `...g. ..|$j
-  32, 179,   1, 182, 101, 211, 192,  72, 226,  99,  83,  74, //  ...e..H.cSJ
-   6,  36, 128, 212,  43,  97,  93, 242,  66, 146,  51,  51, // .$..+a].B.33
- 144, 235, 198,  63, 189, 149,  80,  21,  11,  16,  38,  40, // ...?..P...&(
-  42,  89, 118, 176, 102,  53, 176, 132, 113, 168, 202, 233, // *Yv.f5..q...
- 222,  22, 172, 129, 137, 111, 106, 143, 244,  40, 168, 234, // .....oj..(..
- 157,  92, 233, 225,  17, 244,  16,  64, 150,  71,  82,  11, // .......@.GR.
-  25,  56, 252, 143,  12, 227, 180,  12, 161, 113, 238,  39, // .8.......q.'
- 240, 199, 130,  92, 179,  33, 129, 166, 252,  59, 210,  45, // .....!...;.-
-  65,   9,  28, 251, 113,  76, 185, 208, 192, 255, 207, 221, // A...qL......
- 159, 127, 178, 184, 158, 136, 204, 232,  69, 207, 157, 214, // ........E...
- 118, 115, 141, 254, 255,  61, 131,  76, 165,   1, 245, 146, // vs...=.L....
-  51, 167,  96,   3, 146, 163, 105, 131, 137,   5, 149, 169, // 3.`...i.....
-  73, 152, 237, 170, 128, 131, 252, 205,  25, 147,  73, 165, // I.........I.
-  78, 221,   7, 240, 206, 216, 192,  16,  18, 216,  52, 223, // N.........4.
-   0, 155,  70, 129, 169, 168, 165, 110, 156, 107,  43,  38, // ..F....n.k+&
- 190,  55, 183, 191, 221,  41,  54,  94,  75,  59, 100, 165, // .7...)6^K;d.
- 173, 162, 153, 235,  39, 234,  86, 131, 173,  32, 111, 206, // ....'.V.. o.
- 201, 206, 208, 192, 151, 190,  18, 152,  49,   0,  84, 189, // ........1.T.
-  51,  76, 206,  67, 220, 183,  58, 190, 176, 110,   7,  22, // 3L.C..:..n..
- 233, 232,  73, 152, 251, 246, 225, 241,  32, 136,  95, 217, // ..I..... ._.
- 214,  41, 144, 115,  24, 124,  38, 107, 175, 175, 159,  37, // .).s.|&k...%
- 241,  73, 146,  80, 213, 207,  51, 141,  27,  83, 189,  85, // .I.P..3..S.U
- 207,  27,  40, 246, 157, 167,  50,  42, 208, 112, 110, 175, // ..(...2*.pn.
-   7,   0, 104,   1,  44, 142, 150, 207, 143,  44, 159, 103, // ..h.,....,.g
- 240, 127,  67,  79,  73,  42, 247, 112,  60,  34, 107,  15, // ..COI*.p<"k.
- 102,  75,  76, 214,  68, 174, 110, 139, 122,  76, 135,  23, // fKL.D.n.zL..
- 155, 227,  28, 195, 194,  12, 172,  35, 224,  35,  37,  43, // .......#.#%+
- 104,  73, 209, 141,  76,  44, 254,  15,  39,  73, 163,  17, // hI..L,..'I..
- 147, 139,  94,  27,  11,  32,  65, 211, 173, 243, 203,  78, // ..^.. A....N
- 158,  26,  62, 214, 247,  59, 141, 239, 215,  61, 114, 242, // ..>..;...=r.
- 188,  82, 132,  53, 255, 168,  51, 244, 129, 184, 122, 164, // .R.5..3...z.
- 172,  35, 168, 150, 100, 110,   6,  40,  81, 105, 215, 254, // .#..dn.(Qi..
- 154, 178, 253, 128,  27, 183, 107, 247, 200, 129, 156,  58, // ......k....:
- 145, 117, 228, 130,   3, 229, 200, 194,  92, 139, 114,  27, // .u........r.
- 240,  22, 223, 196,  90,  47, 222,  83, 146, 185, 163,  86, // ....Z/.S...V
- 103,   6,  13,  94,  62, 153,  80,  71,  57,  98, 193,  55, // g..^>.PG9b.7
- 174, 141, 147,  73, 227, 151, 199, 191,  60, 121, 112, 228, // ...I....<yp.
- 170, 210, 137, 134, 227, 159, 120,  84,   2,  87,  56,  64, // ......xT.W8@
- 122, 226,  68,  19, 173,  59,  50,   2, 245,  78, 163,  19, // z.D..;2..N..
- 199, 201, 249,  25,  13, 253, 109,  33, 102, 215, 249, 141, // ......m!f...
- 210, 170, 104, 195, 175,  70, 111, 241,  70,  17,  46,   0, // ..h..Fo.F...
- 147,  50,  80, 208,  35,  26, 200, 242, 123,  52,  62,  62, // .2P.#...{4>>
- 161, 169, 243,  46,  77, 157,  49,  46, 181,   7, 165,  87, // ....M.1....W
-  15,   3, 242,   7, 123, 237,  88,  43, 141,  21, 130, 232, // ....{.X+....
-  70,  21,  64, 109, 147,  98, 126,  32,   3, 161, 207, 194, // F.@m.b~ ....
-  16, 117, 238, 182, 159, 209, 128,   5, 183, 150,  35, 129, // .u........#.
- 122,  82,  83, 104,  26, 221, 249,  95, 102,   1, 233, 105, // zRSh..._f..i
- 151,  26, 227,  94, 144, 126, 120,  33,  85, 237,  18,  79, // ...^.~x!U..O
- 206, 217,  94, 138, 253, 153, 231,  97, 191, 157, 214, 170, // ..^....a....
- 189, 214,  71, 169,  34, 170, 164, 170,  81, 169, 201,  79, // ..G."...Q..O
-  39,  22, 183, 164, 111, 219,  22, 154, 220, 183, 207, 194, // '...o.......
- 120, 100,  87,  52,  88, 182, 137, 191,  34,  31,  12, 197, // xdW4X..."...
- 152, 213, 162,  11, 206, 239,  80, 164, 218, 141, 234, 178, // ......P.....
-  66, 254, 106, 234, 185, 148, 162,  15, 191, 204,   8,  22, // B.j.........
-  82, 241, 161, 127,  70, 168, 128, 237,  74, 139, 160, 162, // R...F...J...
- 192, 235,  84,  98, 241, 163, 192, 219, 250, 167, 239, 140, // ..Tb........
- 101, 149, 169, 149, 146, 152,  65,  44, 249, 204,  36,  12, // e.....A,..$.
-  11,  77, 174, 169,  73,  80,  71, 168, 138,  48,   1,  12, // .M..IPG..0..
-  79, 122, 183, 215, 123,  25, 245, 200, 236, 221, 143,   2, // Oz..{.......
-  82,  10, 106, 154,  40, 166,  17,  20,  72, 110, 137,  58, // R.j.(...Hn.:
- 103,  66, 109, 163, 177, 118, 181, 167, 246, 135,  91,  99, // gBm..v....[c
-  64,  36, 230, 152,  16,  38, 245, 120,   6,   9, 195, 117, // @$...&.x...u
-  38, 221,  22, 161, 248, 169,  75, 231,  99,  48, 251,  70, // &.....K.c0.F
- 155, 128,   2, 198, 163,   2, 235,   1, 164,  49, 140,  84, // .........1.T
- 215,  81,  23, 116, 239, 201,  55, 218, 140, 171, 198, 179, // .Q.t..7.....
- 239,  60, 192,  71, 150, 254, 136, 123, 164,  16, 145, 247, // .<.G...{....
- 103,  21, 139, 125, 220,  37, 201,  96,   9,  96, 160,  23, // g..}.%.`.`..
- 157, 104, 106,  46,  37, 152, 148,  36, 152,  42, 197, 141, // .hj.%..$.*..
- 180, 181, 206,  60, 129,  31,   2, 213,  29, 201, 231, 199, // ...<........
- 188, 195, 216,   5, 160, 113, 127,  66, 142, 207, 208,  15, // .....q.B....
- 153, 175, 169, 211,   9, 247, 108,  93, 120,  27, 152, 184, // ......l]x...
-  89, 237,  56, 239, 157, 250, 198, 236,  44, 247,  78, 252, // Y.8.....,.N.
- 149, 211, 213,  85,  82,  89, 177, 248, 208,  81, 220, 104, // ...URY...Q.h
- 103, 224, 229,  16,  83,  85, 154, 186, 255, 238,  80,  11, // g...SU....P.
- 187, 157, 188, 145,   7,  39, 152, 229,  68, 175, 237,  54, // .....'..D..6
-   0, 221, 165, 165, 123,  30, 156, 183, 243, 134, 126, 150, // ....{.....~.
-  90,  48,  16, 144, 161, 162, 234, 237,  88, 254, 154,  85, // Z0......X..U
- 125,  80, 248,  14, 189,  30, 142, 136, 167,  20,  60, 184, // }P........<.
- 216,   5, 214,  31,  73,  24,  20, 142, 237, 211, 206, 248, // ....I.......
- 240,  16,  26, 160, 243, 161,  98, 188, 127, 103,  79,   4, // ......b..gO.
- 130,  40,  21, 171, 205, 133,  19, 130,  81, 158,   4, 168, // .(......Q...
-  69,  94, 151, 228, 226,  15,  21, 130, 157, 235, 156,  80, // E^.........P
- 189, 123, 157, 127, 182, 129, 113,  95, 212, 159,   7,  49, // .{....q_...1
- 201,  25,  23,  50, 200, 253, 209, 181, 241, 112, 210,  96, // ...2.....p.`
- 143,   8, 108,  66,  94,  23, 142,  72, 225,  51, 254, 143, // ..lB^..H.3..
-  51,  70, 246, 161, 103, 200,  66, 117,   7,  85,  89, 180, // 3F..g.Bu.UY.
- 250, 241,  96, 148,  82, 173, 103, 213,  48, 149,  82, 139, // ..`.R.g.0.R.
- 148,  34, 100, 168, 203,  72,  78, 187, 187,  83, 168, 213, // ."d..HN..S..
-  32, 212, 234,  79, 133, 230, 174,  55,  22,   8, 132,  18, //  ..O...7....
- 163, 146, 156, 169,  97, 123, 184, 184, 115, 185,  78,  40, // ....a{..s.N(
-  27, 214,  43, 250, 184,  68, 151, 237, 202,  57, 128, 246, // ..+..D...9..
- 140, 229, 105, 149,  95, 216, 153, 217, 169,  66,  61, 162, // ..i._....B=.
- 133, 200, 101, 117,  20,  99, 137, 156,   6, 157, 128, 154, // ..eu.c......
- 121,  16, 202,  21,  31, 242, 155,  43,  96, 190, 124,  59, // y......+`.|;
-   0,  31,  73,  76,  11, 128,  89,  74,  40,  87, 204,  94, // ..IL..YJ(W.^
- 129,  83,  46, 192,  17, 239,  14,   6,  28,  55, 115,  56, // .S.......7s8
- 144,  60,  56, 241,  41,  83,  79, 199, 157,   6,  53,  26, // .<8.)SO...5.
- 184, 178, 251, 210,  28,  83,  15,  84, 134, 185,  57,  81, // .....S.T..9Q
- 237, 128, 170, 233, 224, 150, 151, 224,  43,  23, 111,  73, // ........+.oI
-  13, 177, 232, 194,  17,  28, 251,   1,  47, 204, 249,  84, // ......../..T
- 101,  10,   7,  83,  92, 214,  13, 134, 161,  10, 128,  23, // e..S........
- 110,  36,  66,  61,  49,  13,   1, 220, 120,  95, 204, 240, // n$B=1...x_..
-  29,  61,   3,  44,  87, 189, 166,  30,  42, 235, 209, 144, // .=.,W...*...
-  51,  30, 146,  23, 165, 122, 169,  87,  17, 183,   9, 113, // 3....z.W...q
- 235,  78, 102, 170, 147,  44, 151, 238,  54,  82,  26,  19, // .Nf..,..6R..
- 210,  51,  57,  48,  66, 201, 112, 140,  70,  69, 165,  78, // .390B.p.FE.N
- 116,  44,  14,  48, 168, 111,  91,  18, 158, 151, 245, 146, // t,.0.o[.....
- 122,  65, 196, 182, 214,  56, 248, 119,  77, 201, 176,  35, // zA...8.wM..#
- 224, 138, 219, 246, 136,  44, 123,  78, 113, 142, 164, 242, // .....,{Nq...
-  22,  35, 252, 191,  11,  30, 228,  14, 207,  97,  86, 124, // .#.......aV|
-  57, 217,  49, 240, 131, 213, 212,  50, 215, 171,  18,  42, // 9.1....2...*
- 182, 239, 139, 217,  82,  39, 148, 211, 176, 118, 168, 231, // ....R'...v..
-  99, 152, 217, 149,  22, 112,   4, 183,  56, 169,  70, 158, // c....p..8.F.
- 167, 209,  49, 192, 101,  65, 244, 112,  68, 179,  66, 238, // ..1.eA.pD.B.
- 197, 244, 178, 160,  18, 173, 204,  43, 105, 234, 154, 223, // .......+i...
-  46, 146, 150,  83, 216,  92,  16, 163, 138,  58,  20, 132, // ...S.....:..
- 161, 154,  29, 149,  21,  61, 244,  75, 203, 175, 210,   9, // .....=.K....
- 142, 212,  98,  17, 207,  36,  49, 227,  14, 252, 188, 126, // ..b..$1....~
-  10, 214,  33,  37, 218, 203, 188, 209, 129,  15,  34, 230, // ..!%......".
- 176,  15, 113, 187, 197, 146, 173, 183,   1,   0, 250, 104, // ..q........h
-  47,  19,  19, 247, 190, 223, 149, 197, 164,  81,  64, 207, // /........Q@.
-  27, 187,  44, 173, 213,  85,  99, 197,  17, 230, 123,  26, // ..,..Uc...{.
- 253, 189, 175, 231,  91,  67, 178, 131,   1,  99, 214, 238, // ....[C...c..
- 245, 247, 154,   7,   7, 174,  55, 236, 244, 133,  29,  20, // ......7.....
- 245,  96, 246,  35,  81,  49,  46,  23, 115, 164,  24, 129, // .`.#Q1..s...
-   9, 147,  78, 209, 180, 166,  90, 127,  44, 220,  68, 108, // ..N...Z.,.Dl
-   5,   0, 195,  91, 149, 195, 241,  92,  57, 156, 123,  79, // ...[....9.{O
- 231, 200, 225, 149, 127, 222,  17, 252, 234, 206, 250, 255, // ............
-  58, 251, 187, 107, 238, 254, 158, 248, 115, 112, 109, 221, // :..k....spm.
- 221, 121, 133, 229,  27, 255,  21, 150, 107,  57, 251,  39, // .y......k9.'
- 126, 119, 239, 252, 192, 187, 230,  63,  41, 148,  70, 168, // ~w.....?).F.
- 195, 211, 201, 209,   1, 216,  55,  58,  29, 227, 213, 211, // ......7:....
- 131, 157,  39,  90, 237, 132, 100,  87,  87, 207, 125,  63, // ..'Z..dWW.}?
- 161, 100,  41, 105,  59, 162,  49, 241, 213, 222, 198,   1, // .d)i;.1.....
- 253,  76, 253,  53,  60, 185, 148, 134,  83,  74,  62,  61, // .L.5<...SJ>=
-  40, 229, 225, 150,  50, 224, 151,  79, 101, 225, 222, 226, // (...2..Oe...
- 179,  66,  85, 249,  13,   4, 164, 202,  96, 116, 148, 167, // .BU.....`t..
-  52, 160, 237,  22, 185, 116, 246, 100,  18,  15,  72,  82, // 4....t.d..HR
-  53, 155,   0, 138, 201, 142, 132,  29, 249,  99, 166,  75, // 5........c.K
- 104, 121, 156,  22, 253, 229,  53, 141, 118, 171, 178, 236, // hy....5.v...
- 153,  54,  14, 255, 200, 176, 240, 237,  39,  30, 150,   1, // .6......'...
- 169,  87, 250, 177,  75,  90,  15,  50, 219, 189,  80,  44, // .W..KZ.2..P,
-  63,  32,  98,  68, 114, 224,  82, 176,  31,   1,  46,   7, // ? bDr.R.....
-  64,  87, 203,  21,  13,  29,  83, 117,  99,  44,   3,  52, // @W....Suc,.4
- 152,  70, 195, 225,  71,   1, 113,  29, 245,  47,  68, 162, // .F..G.q../D.
-  98, 124, 113, 203,  69,  33, 111, 143, 197,  23, 138,  30, // b|q.E!o.....
-  11, 250, 103,  94, 147, 220, 211, 193, 224, 143, 224,  32, // ..g^....... 
- 209, 137,  83, 177,  90, 164, 210, 147, 248, 227, 179, 179, // ..S.Z.......
-  14, 139,  53,   7, 181,  97,  33,  32, 144,  60, 115,   1, // ..5..a! .<s.
-  39,  44, 177,  88, 144,  58,  82, 227, 135, 229, 157,   5, // ',.X.:R.....
- 232, 249,  64, 208,  34, 238,  40, 187,  77,  66, 160,  18, // ..@.".(.MB..
-   7, 123,  71,  48,  57, 228,  20,  28,  29,  48, 175, 173, // .{G09....0..
- 235,   5,  88, 141,   2, 177,  55,   8, 118,  99, 166, 144, // ..X...7.vc..
- 193,  10,  68, 203,  19,   4,  25, 244, 112,  76,  51, 144, // ..D.....pL3.
-  48, 136, 193,  11,  51, 133,   5,  62, 232,  12, 140, 217, // 0...3..>....
-  48,  77,  60,  26, 107,  29, 119, 178, 126, 226,  73, 222, // 0M<.k.w.~.I.
-   6,  57, 241,   6, 212, 121,  82, 203,  55, 146, 171,   6, // .9...yR.7...
- 222, 145, 117,  46,   2, 240, 209,  67, 245,   9,  57,  19, // ..u....C..9.
- 110,   1,  34,  62,  32, 215,  87, 146, 236,  74, 217, 244, // n."> .W..J..
- 211,  48, 124,  27,  58, 140,   0,  94,  89,  29,  22,  75, // .0|.:..^Y..K
- 192,  94, 177, 254, 171,  19,   5, 100, 242,  17, 246,  35, // .^.....d...#
- 113, 110,  53, 234, 230,  54,  95,   3, 195,  17, 123, 204, // qn5..6_...{.
-  76,  38, 150, 111, 189, 217,  97, 250, 148,  29,  75, 126, // L&.o..a...K~
- 138, 118, 222,  57, 114,  41, 217,   9,  13, 138, 169,  42, // .v.9r).....*
-  82, 142, 117,  91, 110,  43, 140, 234, 210, 206,  10,   9, // R.u[n+......
-  37, 188, 122, 175, 178, 142, 120,  90, 170,  98, 186,  94, // %.z...xZ.b.^
- 212,  73, 192, 192, 218, 134, 179, 224,   5,  19, 146,  76, // .I.........L
- 151, 153, 244,  74,  43, 250,  66,  30, 108, 118, 220,   6, // ...J+.B.lv..
- 249, 239, 120, 242, 238, 194, 241,  49,  86, 218,  35, 159, // ..x....1V.#.
-  92,  54, 223, 121,  82,  25, 159,  84, 231, 108,  27, 221, // .6.yR..T.l..
-  61,  18, 227, 147,  87, 141, 124, 121,  89,  53,  51, 100, // =...W.|yY53d
- 166, 181, 205, 160, 106, 100, 164,  66, 119, 215, 124, 219, // ....jd.Bw.|.
-  18, 144,  93, 182, 171, 246, 137, 224, 129,   8,  67, 191, // ..].......C.
-  82, 215, 200,  52,  54,  49,  44, 248, 235, 179,  40,  46, // R..461,...(.
- 254, 174, 137, 135,  59, 107, 208,  76, 138,  68,  30, 164, // ....;k.L.D..
- 140,  21, 188,  41, 254, 174, 137, 135, 219,  69,  44,  86, // ...).....E,V
-  12,  17,  51, 165, 225, 153, 226, 172,  96, 215, 235, 121, // ..3.....`..y
- 120, 242, 224, 205, 208,  81, 161,  46, 121,  38,  89, 206, // x....Q..y&Y.
- 240, 246, 226,  51,   3, 130,  94,  49, 244,  20,  59, 131, // ...3..^1..;.
- 141, 215, 125, 154, 177, 123,   3, 177, 106, 128, 103, 110, // ..}..{..j.gn
- 158,   1,  90, 100, 215, 213, 213,  70, 187, 217, 194, 198, // ..Zd...F....
-  61, 243, 201, 183,  75,  98, 225,  72, 117, 212, 126,  12, // =...Kb.Hu.~.
- 176, 210, 147,  33, 188, 220, 224,  36, 144, 174, 101, 141, // ...!...$..e.
-  35, 102, 126, 218, 192, 210, 165,  43, 103,  14, 247,  68, // #f~....+g..D
- 170,  12,  81, 213,   9,  63,  48,  65, 241,  85,   3, 158, // ..Q..?0A.U..
- 167,  72, 237, 126, 105, 144, 155, 183, 108, 252,  72,  47, // .H.~i...l.H/
-  19,  84,  23, 110,  73,  37, 206,  83, 106, 109, 177, 116, // .T.nI%.Sjm.t
-  11, 160, 251, 219, 254, 125, 239, 119,  18, 143, 143,  86, // .....}.w...V
-  87, 208,  51, 152, 157, 165,  35, 225, 139,  22,  97,  43, // W.3...#...a+
- 143,  46,  47, 143, 201,  50,  27, 251, 131, 134, 170, 252, // ../..2......
- 219, 121,   2, 246, 178, 199, 165, 121,  42,  60, 124, 250, // .y.....y*<|.
- 196,  41,  70, 155,  89, 186, 169,  72,   7, 158,  59, 219, // .)F.Y..H..;.
- 184, 184,  43,  84, 173,  78, 253,  12,  87,  44, 102,  87, // ..+T.N..W,fW
- 204, 197,  82, 181, 159, 235,  17,  49,  38, 219, 221, 233, // ..R....1&...
- 224, 119,  76,  83,  85, 105, 135,  74, 111,  85, 255,  29, // .wLSUi.JoU..
- 240, 158, 196, 244, 104, 188,  50, 229,  51, 166,  83,  46, // ....h.2.3.S.
- 142, 234, 129, 186, 224, 230, 202, 114, 209,  61, 141,  25, // .......r.=..
- 159,  51, 166,  70,  78,  47, 104,  50,  39,  60,  97, 112, // .3.FN/h2'<ap
-  53,  27, 214,  31, 242,  11, 197, 246, 167, 235,  42, 162, // 5.........*.
- 162, 210, 170, 121,  56, 193, 210, 185, 136,  66, 211, 197, // ...y8....B..
- 241,  89, 152, 159,  38, 189, 182,  61,  76,  50,  96, 208, // .Y..&..=L2`.
-  38, 189, 139, 118, 101,  16, 226, 146,  20, 163,  63,  25, // &..ve.....?.
-  34,  46, 130, 203,  28, 147,  96, 238, 164, 194, 146, 183, // ".....`.....
-  86, 206, 100, 225, 210,  60, 251, 169, 238, 142, 220,  75, // V.d..<.....K
-  92, 198,  70, 165,  96,  71, 175,  22,  38,   6, 163,  95, // ..F.`G..&.._
- 145, 171, 106, 148, 233, 230, 112, 162,  53, 255, 104,  29, // ..j...p.5.h.
- 107,  73,  71,  52, 243, 226, 194,  70, 203, 212,  62, 161, // kIG4...F..>.
- 106,  46, 174,  10,  28, 206,  73, 105, 171,  84,  97, 254, // j.....Ii.Ta.
- 219, 247, 130,  44, 234,  90, 246, 218, 113, 158,   4, 142, // ...,.Z..q...
- 209, 168, 234,  72,  12, 159,   8,  88, 163, 153, 201, 154, // ...H...X....
- 241,  82, 157, 164, 227, 151, 122, 148,  58, 238, 148,  55, // .R....z.:..7
- 226, 112, 168, 109, 124,  26,   6, 189,  48, 205, 218, 227, // .p.m|...0...
- 187,  35, 170,  75,  26, 189,  21, 171, 240, 225,  68, 149, // .#.K......D.
-  59,  22,  29, 215, 104, 170, 162, 140, 211,  57, 162, 159, // ;...h....9..
-  41, 232, 125,  25, 228,  99,  53, 123, 186, 224,  70,  76, // ).}..c5{..FL
-  21, 132, 152,  19, 176,  19, 162, 251,  77, 188,  63, 170, // ........M.?.
- 221,  88, 114,   3, 236, 174, 174,  82, 127, 126,  66, 255, // .Xr....R.~B.
-  83, 243, 246,  82,  15,  98,  21, 112, 229,  59, 195,  67, // S..R.b.p.;.C
- 245,  67, 143,  94, 251, 234, 197, 211,   3, 109, 172, 167, // .C.^.....m..
- 227, 238,  40, 174, 146,  41,  27,  33, 215,   8, 158,  24, // ..(..).!....
- 122, 197,  83, 179, 124,  58, 167, 220, 204, 195, 124,  47, // z.S.|:....|/
- 188, 185, 162,  32,  62, 185,  38, 198, 190, 157,  90,  94, // ... >.&...Z^
-  37, 141, 120, 232, 195, 253, 162,  49,  17,  35, 226,  91, // %.x....1.#.[
- 105, 230,  28, 131, 240,  45, 119,  97,  64,  61, 187, 151, // i....-wa@=..
- 140, 200,  64, 214,  68, 122,  56,  72,   2,  29, 237,  15, // ..@.Dz8H....
-  94, 103, 224,  61,  85,  24,  80, 140, 120, 228, 239, 173, // ^g.=U.P.x...
- 174,  62, 118, 206,  73, 222, 191, 249, 165, 205,  13,  94, // .>v.I......^
- 121,  75, 131, 179, 140, 180, 168, 237, 218,  48,  83, 246, // yK.......0S.
- 144, 207,  93, 248, 224, 125,  38,  79, 145, 156, 184,  12, // ..]..}&O....
- 121, 198, 174,  98, 158,   9,  77, 111,  52, 113, 119, 120, // y..b..Mo4qwx
-  96, 201,  50,  28, 153, 208, 159, 194, 161, 154, 114,  84, // `.2.......rT
- 167, 199,  82, 165, 173, 178, 119,  14, 102,  88, 155, 196, // ..R...w.fX..
- 232,  95,  63,  99,  94, 173, 213,  71,  83, 243, 142, 177, // ._?c^..GS...
- 244,  86, 172,  85,  61,  43,  45, 204, 221, 211, 139, 105, // .V.U=+-....i
- 199,  52,  54, 253,  90,  94,  76,  27, 184, 222,  93,  18, // .46.Z^L...].
- 229, 175, 202,  47, 242, 239, 186, 222,   3,  17,  64, 149, // .../......@.
- 122, 224, 122, 191, 243,  15,  53,  60, 249, 191,  67, 186, // z.z...5<..C.
-  50,  31, 126, 163,  22, 109, 117,  40,  34, 200, 195, 138, // 2.~..mu("...
-  28,  65,  62, 251,  58, 148, 218, 146,  92,  24,  62,  89, // .A>.:.....>Y
- 194,  17, 232,   7, 189, 164, 127, 241,  34, 120,  99, 188, // ........"xc.
-   8, 222, 224,  69, 240, 198, 133,  19,  29,  14, 139,  55, // ...E.......7
- 248, 229, 135, 252, 199,  53,  28, 108, 165,  25, 111, 153, // .....5.l..o.
- 217, 154, 121, 131,  57,  21, 177,   4, 224, 139,  96, 176, // ..y.9.....`.
-  18,  74, 127,  69, 120,  76, 217,   9, 199,  35,  71, 197, // .J.ExL...#G.
-  23,  63,  93, 125, 132, 167,  24, 120, 157,  31, 125, 189, // .?]}...x..}.
- 232, 232,  65, 133, 127, 133, 180,  79, 177, 116, 211, 126, // ..A....O.t.~
-  70,  98, 197, 178, 217,  67, 103, 101, 215, 117,  61,  97, // Fb...Cge.u=a
- 151, 119,  61, 113,  28, 178, 124, 206, 132, 199, 243, 140, // .w=q..|.....
- 198,   5, 121, 120, 168,  54, 131, 145, 204,   0,   6, 163, // ..yx.6......
-  29, 242,  14,  21, 185, 171,  56, 255, 110, 139,  47, 249, // ......8.n./.
- 188,  81, 237, 167, 111, 228, 167, 226, 216,  92,  40,  46, // .Q..o.....(.
- 124, 241,  71, 250,  72,  81, 237, 119, 135, 242, 187, 114, // |.G.HQ.w...r
- 217, 201,  91, 230, 187, 109,  96,  72, 225,  22,  18,  44, // ..[..m`H...,
-  41,  16,  41, 167,  41, 206,  36, 213,  38, 248, 131,  76, // ).).).$.&..L
-  80, 208, 249,  57, 229, 179,  55,  47, 249,  39, 211, 141, // P..9..7/.'..
- 215,  30, 142,  73, 252, 210,  81, 158, 202,  49, 152,  65, // ...I..Q..1.A
- 237,  49, 152, 216, 213,  68, 120,  49,  31, 131, 193,  76, // .1...Dx1...L
- 115,   7,  14, 112, 194, 115,  74,  77,  91,  73, 221, 201, // s..p.sJM[I..
- 249,   5, 217, 243, 100, 122, 183, 224,  30, 172, 216,  87, // ....dz.....W
-  77,  63, 200, 188,  74, 145, 106,  54, 113,  30, 171, 182, // M?..J.j6q...
- 206, 175,  63,  84, 136,  30, 112,  97, 144,   1, 255, 245, // ..?T..pa....
-  64, 255, 140,  95, 252,  87, 124, 125, 248,  54, 137, 195, // @.._.W|}.6..
-  76, 165,  33, 126,   9,  29, 168, 204,  33, 140,  98,  80, // L.!~....!.bP
- 210, 228, 224,  70,  88, 223, 235,  12, 219, 253,  74, 161, // ...FX.....J.
- 180, 214, 134,  80,  88, 250,  92,  44,  73, 138,  97, 134, // ...PX..,I.a.
- 222, 138, 227, 235, 244, 242, 143, 154, 151, 106, 105, 213, // .........ji.
-  28, 181, 140,  33, 235, 242, 178, 198, 205,  46, 175, 192, // ...!........
- 162, 203, 137,  84, 181, 180, 245, 161, 120,  28,  46, 156, // ...T....x...
- 254, 254,   5, 175, 173, 242, 121, 202,  80, 128,  28,  83, // ......y.P..S
- 103, 224,  93,  13,  22, 132,  60,  88,  87,  43, 137, 158, // g.]...<XW+..
- 172, 187, 178,  94, 237, 223, 231,  87, 176, 174, 137,  96, // ...^...W...`
-  99, 218, 194, 212,  44,  39,  67,  46, 149,  62, 249,  87, // c...,'C..>.W
-  91, 174, 179, 106, 155,  84,  53, 109, 137,  28, 106, 167, // [..j.T5m..j.
-   7,  70,  30, 167, 202,  18, 224,  24, 176,  48,  34, 242, // .F.......0".
-  42,  64,  40, 246, 180, 139, 209,  66, 154,  47,  12, 145, // *@(....B./..
-  34, 109, 243, 104, 225, 103,  74, 156,  91,  81, 166,  93, // "m.h.gJ.[Q.]
-  28,  84, 252,  76, 137, 215, 184, 125, 166, 107, 135, 109, // .T.L...}.k.m
-  13,  61, 106, 138,  82,   4, 138,   2, 238, 147, 243, 167, // .=j.R.......
- 176,  52,  58, 161, 217, 203,  97,  18,  31, 178,   7, 112, // .4:...a....p
-  24, 196, 189,  67, 233,  58,   8, 158, 114, 148, 241,  55, // ...C.:..r..7
- 231, 220, 179, 249,  51, 242,  87, 213, 248,  44, 246,  41, // ....3.W..,.)
- 230, 167,  32,  62,  22, 171, 182, 210, 197, 144, 164, 123, // .. >.......{
-  50,  17, 236,  56, 124,  64,  18, 202, 169,  17, 137,  64, // 2..8|@.....@
-  26,  14, 159,  58,  85, 178,  32, 191,  71, 158,  49,  53, // ...:U. .G.15
-  66, 248,  60, 169, 250, 237, 150, 196, 117, 177,  80,  92, // B.<.....u.P.
-  60, 142, 157, 123, 128, 121,  31,  82, 207, 107, 136,   7, // <..{.y.R.k..
- 213, 165, 241, 135, 170, 130,  28, 153,  74, 179,   3,  31, // ........J...
-  71, 151, 237,  71,  18, 113, 145, 215, 159,  50, 175,  46, // G..G.q...2..
-  77, 239, 228, 254, 156, 220, 106, 139, 141,  19,  50, 197, // M.....j...2.
- 158, 107,  82, 218, 115,  77,  57,  65,  99, 223,  47,  28, // .kR.sM9Ac./.
- 152, 103,  22, 112, 190, 163, 216, 247,  83, 233, 150, 142, // .g.p....S...
-  76, 228, 158, 224,  46,  54, 206,  63, 240,  16,  21, 251, // L....6.?....
-  99,  91,  50,  88, 209,  60, 165, 213, 104,  54,  54, 109, // c[2X.<..h66m
- 143, 207,   4, 217, 237, 177, 252, 139, 169, 190,   8, 203, // ............
- 212, 143,  81, 164, 158, 132, 210, 182, 251,   1, 185, 205, // ..Q.........
-  19, 114, 131, 254, 204, 115, 124,  25, 198, 176,  91,  50, // .r...s|...[2
- 156, 226, 167,   3,  74,  30,  47, 219, 235, 235, 199, 184, // ....J./.....
-  53, 158,  54,  78, 163, 215, 225, 217, 159,  52,  62, 156, // 5.6N.....4>.
- 181,  91, 183, 110, 109, 218, 244, 245, 121, 120, 156,  37, // .[.nm...yx.%
- 221,  87, 225, 116,  18, 244, 178,  23, 103,   8, 134, 212, // .W.t....g...
-  41,  45, 117, 216,  85, 165,  61, 234, 129,  66, 235,  86, // )-u.U.=..B.V
- 131, 255, 219, 222,  70,  45, 186, 193,  16, 168,   7,  69, // ....F-.....E
-  10,  89,  44, 170,  85,  41, 156,  72, 177,  89,  78,   9, // .Y,.U).H.YN.
-   3, 107, 227,  36,  73, 128, 184, 203,  69, 220, 216, 228, // .k.$I...E...
- 131, 210, 130, 236, 204, 110, 111, 222, 104,  54,  81, 223, // .....no.h6Q.
- 164, 119,  60, 202, 106,  18, 197, 205,  62, 187, 189, 221, // .w<.j...>...
- 220,  64, 181, 162, 126, 132,  40, 193,  80, 191, 206,  72, // .@..~.(.P..H
- 111, 213, 115,  48,  60, 228,  59,  91,  56, 103, 127, 119, // o.s0<.;[8g.w
- 248,  83, 136,  74,  81,  24,  70,  23,  28,   1, 226, 200, // .S.JQ.F.....
-  69,  12, 122,  79,  99, 206,  43,  25,  44,  35,  61, 189, // E.zOc.+.,#=.
- 120,  86,  92, 208, 178, 143,  71, 209, 160, 135,  12, 169, // xV....G.....
- 116, 248,  40,  14, 153, 184,  23, 112,  64, 244, 139, 254, // t.(....p@...
-  29,  69, 113, 114,  61, 204, 134, 155,  27, 168,  19, 199, // .Eqr=.......
- 185,  43,  66, 193, 254,  75,  19,  16,  27, 247, 255,  82, // .+B..K.....R
- 242, 106, 114, 170, 235,   4, 197, 225,  10, 244, 200, 112, // .jr........p
- 159, 152, 141, 192, 238, 134,  93,  28, 246,  99,  49,  26, // ......]..c1.
-  43,  72, 252, 187, 152, 211, 227,  83,  41,  46, 153,   2, // +H.....S)...
- 102,  79, 158,  92, 203, 231,  53, 231, 227, 139,  60, 188, // fO....5...<.
-  57,  43,  66,  83,  70, 184, 177,  40, 194, 246, 162,   8, // 9+BSF..(....
-  91, 139,  34, 108,  46, 138, 176, 177,  40,  66, 107,  81, // [."l....(BkQ
- 132, 230, 188,   8,  66, 157, 122,  70,  20, 172, 204,  23, // ....B.zF....
- 113, 148,  78,   7, 189,  30,  91, 214,  57,  73, 209,  44, // q.N...[.9I.,
- 151, 102, 199,  11,  10,  51,  51, 133,  91,  52, 213,  85, // .f...33.[4.U
- 207, 178, 245,  90, 186, 153, 154, 186,  61, 154,  90, 240, // ...Z....=.Z.
-  77,  45, 225, 166,  22, 101,  83, 203, 172, 169, 133, 211, // M-...eS.....
- 212,  82, 104,  26, 213,  85, 125,  66,  85, 171, 169, 203, // .Rh..U}BU...
- 223, 212,   5, 229,  34, 225,  58,  66,  88, 175, 139, 100, // ....".:BX..d
- 147,  47, 138, 148,  74, 218, 151,  13, 195, 146,  80, 167, // ./..J.....P.
- 100,  65, 158,  83, 116,  54,  58, 219, 157,  23, 175, 197, // dA.St6:.....
-  93,  63,  29, 158,  45, 145, 208, 243, 103,  79, 103, 197, // ]?..-...gOg.
- 162,  65,  29,  17,  79, 194,  32,  53, 162, 200,  57, 161, // .A..O. 5..9.
- 142, 101,  63,  67,  87,   7,   5,  99, 123, 147,  98, 247, // .e?CW..c{.b.
-  71, 232,  85, 115, 218,  50, 232, 190,  26, 224, 118, 209, // G.Us.2....v.
- 204,  72,  42,  53, 196, 238, 146,  78,   5, 113, 126, 152, // .H*5...N.q~.
- 135, 103, 195,  37,  42, 243, 131, 136, 254, 203, 156, 216, // .g.%*.......
- 173, 109, 142,  31, 197, 203, 198,  71, 116, 242, 115, 122, // .m.....Gt.sz
-   9, 205,  18,  22,  21, 227, 148,  42, 118, 120,  28,   6, // .......*vx..
- 103,  11, 187, 197,  89,  16, 197, 135,  44, 135, 108,  97, // g...Y...,.la
-  92, 220, 141,  58, 140, 226,  94,  68,  51, 179,  36,  93, // ...:..^D3.$]
-  24, 157, 121,  34,  62,  32, 126,  63,  57,  57, 236, 167, // ..y"> ~?99..
-  73, 156,  47,  21,  51,  45, 107,  67, 125,  68,  22,  86, // I./.3-kC}D.V
-  50,  12, 227, 197,  49, 179, 238,  98,  19, 114, 188,  88, // 2...1..b.r.X
-  70, 228, 211, 247, 142, 211, 224,  85, 184,  48, 102, 116, // F......U.0ft
-  18,  51, 234, 208, 204, 136, 240,  27,  16,  79,   9,  48, // .3.......O.0
-  59, 100, 156, 144, 197,  85,  73, 105,  48,  63,  20,  67, // ;d...UIi0?.C
- 218, 236, 222, 242,  67, 114, 214, 199, 208, 171, 180, 156, // ....Cr......
- 244, 107,  50,  61,  36, 105, 123,  38, 237,  65, 179, 218, // .k2=$i{&.A..
- 241, 169, 139, 203,  30, 222,  44, 119, 101, 116,  90, 213, // ......,wetZ.
- 103, 185, 107, 138,  14, 217,  44, 245, 188, 102, 181, 103, // g.k...,..f.g
-  53, 235, 187,  16, 117, 150, 250, 190, 210, 106,  86,  59, // 5...u....jV;
-  69, 179, 164, 253, 210, 182, 149, 180,  92, 134,  85, 181, // E.........U.
-  89,   6,  79, 105, 173,  12,  55, 180, 211,   8,  17,  90, // Y.Oi..7....Z
-  40,   3,  12, 109,  83,  33, 208,  42, 101,  95, 143, 139, // (..mS!.*e_..
- 188,  13,  45, 145,  33, 133,  54,   8, 119, 113, 186, 213, // ..-.!.6.wq..
-  85, 146,  70, 235, 234,  70,  20, 118,  62,  12, 209, 198, // U.F..F.v>...
- 135,  98, 230,  37,  38,   9,  37, 219, 172, 175, 160, 205, // .b.%&.%.....
- 245,  67,  38, 218,  87, 253,  36, 247,  69, 207, 249, 231, // .C&.W.$.E...
- 232,  96, 161, 124, 148, 169, 190, 146, 191, 220,   7, 147, // .`.|........
- 154,  33,  76, 107, 107, 145,  57,  62,  41,  82, 182,  89, // .!Lkk.9>)R.Y
-  82, 188, 227, 103, 100,  35, 126,  87,  43, 160, 238,  41, // R..gd#~W+..)
-  47,  85,  30,  54, 230, 226, 138, 242, 252, 254, 108, 250, // /U.6......l.
-   8,  69,  14,  72,  72, 125,  45, 162,  77, 196, 220,  97, // .E.HH}-.M..a
- 108,  23,  71, 110, 116,  53, 143, 113,  27, 131, 157,  89, // l.Gnt5.q...Y
- 235,  30,  63, 138,  57,  55, 133, 148, 153, 118, 247,  49, // ..?.97...v.1
-  79, 217,  55, 184, 118, 247,   5, 217, 238, 190, 221, 185, // O.7.v.......
- 179,  31, 151, 232, 118, 247,  77, 190, 221, 125,  69, 184, // ....v.M..}E.
- 187,  63, 135, 113, 119, 223, 190, 131,  27,  96, 138, 115, // .?.qw....`.s
- 151,  18, 216,   7,  47, 173, 248,  43, 120, 119, 247,  65, // ..../..+xw.A
-  74, 186, 175, 153, 119, 247, 109, 145, 118, 138, 216,  27, // J...w.m.v...
- 252, 116, 161, 158, 196, 201, 221, 253, 185,   4, 188, 251, // .t..........
- 246, 186, 200, 210, 160, 224, 221, 255, 210,  28, 188, 144, // ............
-  13, 229, 186, 221, 252,  86,  86, 151, 159,  42,  68, 188, // .....VV..*D.
-  36,  92, 102, 226, 181, 139,  35, 245, 212, 146,  93, 158, // $.f...#...].
- 129,  84, 110, 101, 219, 226,  72, 171, 221, 222, 163,   8, // .Tne..H.....
-  98, 129, 222,  46,  93,  78, 174, 251, 108,  63, 158, 125, // b...]N..l?.}
-  57, 123, 217,   4, 203,  49, 229, 121,  24, 178,  40,  65, // 9{...1.y..(A
- 250, 195, 128,  18,  15, 211, 247, 239, 138, 204,  43, 144, // ..........+.
-  29, 226,  42, 245, 220, 228, 167, 175,  83, 239, 199, 245, // ..*.....S...
- 183, 194, 139,  98, 200, 155, 210, 246,  41, 238,  11, 144, // ...b....)...
- 253, 166, 176,  13, 234, 149, 250, 242,  28,  91,  25,  94, // .........[.^
-  67,  38, 113, 194,  41, 211, 249, 227,  66,  45, 238, 110, // C&q.)...B-.n
- 112,  93,   4, 104,   7,  85,  69, 212,  67, 221, 226, 197, // p].h.UE.C...
-  84,  56, 123, 149,  39,  67, 100, 169, 141, 150,  40, 237, // T8{.'Cd...(.
-  20,  91, 242, 126, 108, 130, 156, 236, 199,  83, 124, 201, // .[.~l....S|.
- 251, 113, 249, 118, 249, 126,  60,   3,  45,  69, 190,  40, // .q.v.~<.-E.(
- 154, 174,   2,  83, 249, 129,  42,  80, 151,  65, 185, 168, // ...S..*P.A..
- 211, 128,  44,  31, 169,  99, 213, 132, 202,  25, 205,  74, // ..,..c.....J
- 150, 193, 187, 230,  38,  73,  61,  45, 202,  12, 212, 153, // ....&I=-....
- 229,  11,  56,  39, 127, 126,  95, 135, 196, 188,  31, 207, // ..8'.~_.....
- 194,  75, 164, 226, 152, 200,  51,  55, 155,  77,  36, 170, // .K....37.M$.
- 123,   2,  59,  56, 251, 177, 212, 117,  53,   2, 168,  75, // {.;8...u5..K
- 222,  56,  98, 214,  22, 115, 171, 134, 240, 141, 132, 166, // .8b..s......
-  98, 209,  86, 141, 225, 216, 234,   2, 254, 131, 136, 101, // b.V........e
- 250,  77,  19,  91, 238, 119, 181, 237, 150,  45,  54, 203, // .M.[.w...-6.
- 218, 118, 115, 170,  91, 253, 109, 100,  73,  30, 225, 126, // .vs.[.mdI..~
- 188, 148,  44, 225,  74,  46,  41,  73,  74, 212, 148,  35, // ..,.J.)IJ..#
- 248, 175, 255, 254, 146,  84, 119, 113,  44, 246, 172,  75, // .....Twq,..K
- 242,  52, 176,   8,  76, 137, 114,  68, 114,  47, 196, 190, // .4..L.rDr/..
-   3, 156, 113, 239, 185, 247, 147, 119, 223, 219, 245,  90, // ..q....w...Z
- 222, 134, 183, 233, 109, 121, 219, 222,  13, 239, 166, 119, // ....my.....w
- 203, 251, 135, 215, 106,  78,  73,  95, 226,  95, 253, 215, // ....jNI_._..
- 114,  44, 221,  70,  15, 105, 166,  99, 253,  57,  34, 175, // r,.F.i.c.9".
-  34, 202,  47, 150, 208, 121, 158,  25, 205,  82, 122, 161, // "./..y...Rz.
- 215, 255, 159, 140, 197,  61,  53,  63,  44, 168,  38, 151, // .....=5?,.&.
-  16,  98,  49, 171, 252, 170,  37,  89,  32, 222,  52, 255, // .b1...%Y .4.
- 177, 169, 124, 145, 207,  42,  94,  57, 127, 182,  48,  93, // ..|..*^9..0]
-  14, 211,  32,  31, 165, 225,  18, 226,  45,  77, 211, 151, // .. .....-M..
-  52, 208, 198,  76, 189, 100, 168, 181, 232, 117, 252, 169, // 4..L.d...u..
- 153, 253, 228, 255,  89, 163, 252,  44, 214,  48,  62, 176, // ....Y..,.0>.
-  81,  74,  43,  31, 179,  26, 101, 171,  86, 235, 175, 111, // QJ+...e.V..o
-  54, 237, 165,  45, 251,  87, 101, 202,  43, 152, 134, 251, // 6..-.We.+...
- 113, 125, 235,  21,  52, 169, 173, 230,  86, 107, 171, 181, // q}..4...Vk..
- 177, 185, 189, 185, 221, 218, 190, 241,  31, 104, 220,   7, // .........h..
- 111, 104,  26,  18,  81, 235, 202,  21, 168, 197,  82, 159, // oh..Q.....R.
- 154, 222, 149, 137, 218,  62, 204, 229, 215, 229, 120,  68, // .....>....xD
- 217,  91, 188,  46, 102,  40, 150, 134,  50,  50,  21, 171, // .[..f(..22..
-  88,  65, 171, 241,   6, 254, 146, 178,  63,  13, 112, 189, // XA......?.p.
-  68, 202, 111,  65, 233, 205, 213, 190, 171,  82, 254,  39, // D.oA.....R.'
-  52,  17, 182, 138,  85, 197,  69,  85, 168,  44,  78,  94, // 4...U.EU.,N^
- 149,  90,  60, 231,  97, 121, 249, 106,  84,  23,  83, 175, // .Z<.ay.jT.S.
-  74,  61,  30,  98,  33, 215, 234,  39,  39, 203, 170,  84, // J=.b!..''..T
- 177, 250, 123,  85, 170, 240,  28, 120, 226,  31,  88, 131, // ..{U...x..X.
-  84,  76,   5,  22, 249, 247, 127,  27,  79, 242, 177,  94, // TL......O..^
-  68, 255, 203, 108, 238, 125, 140, 234, 188,  39, 176, 168, // D..l.}...'..
- 129, 138, 221, 131, 171, 162,  98, 247, 119, 127,  88,  92, // ......b.w.X.
- 234, 172, 123, 101, 202, 123, 247, 222, 238, 194, 242,  98, // ..{e.{.....b
-  23, 230, 170, 148, 247, 145, 222,   5,  90,  56,  30, 235, // ........Z8..
- 152,  87, 187, 247, 126,   1,  71,  25,  72, 225, 127,  93, // .W..~.G.H..]
- 119, 126, 172, 182, 233,  22, 181, 152, 222, 207, 187,  42, // w~.........*
- 202, 182, 247, 235, 203,   3, 171,  48, 136, 130, 115,  98, // .......0..sb
- 113,  53, 170, 219, 144,  87, 166,  58, 247, 158, 190, 180, // q5...W.:....
-  30,  30,  88, 247, 177,  29, 106, 241, 118, 232, 226, 165, // ..X...j.v...
-  48,  99, 239, 212,  92,  16,   3,   9,  43, 195, 174, 200, // 0c......+...
- 237,  84, 111, 119, 168, 255,  93, 243, 200,  10,  90,  73, // .Tow..]...ZI
- 191, 239,  61, 232,  38,   0, 119, 173, 239, 129, 127, 195, // ..=.&.w.....
- 121, 212, 127, 190,  47, 223, 237, 138,  22,  88,  44, 189, // y.../....X,.
- 186, 157, 163, 217, 155,  96,  31, 166,  82, 213, 205, 113, // .....`..R..q
- 181, 125, 180,  43, 247, 211,  45, 177, 159, 110,  97, 238, // .}.+..-..na.
-  44,  55, 146,  12, 181, 170, 223, 115, 199, 118,  20, 110, // ,7.....s.v.n
-  29, 241, 148, 251, 235, 168, 222, 198, 199,  85, 111, 227, // .........Uo.
-  43, 169, 222, 230, 199,  85, 111, 243,  43, 169, 222, 214, // +....Uo.+...
- 199,  85, 111, 235,  43, 169, 222, 246, 199,  85, 111, 251, // .Uo.+....Uo.
-  43, 169, 222, 141, 143, 171, 222, 141, 154,  21, 188, 191, // +...........
- 247, 136, 241, 152, 111, 200, 113, 149, 117, 216,  79,  73, // ....o.q.u.OI
-  14, 214,  80,  75, 157, 249, 207, 172,  32,  13, 173, 224, // ..PK.... ...
- 117,  16,  13, 152, 128, 140, 228, 139, 215,  93, 113,  26, // u........]q.
-  32,  91,  49, 200,  46, 138, 179,   2, 156, 176, 110, 132, //  [1.......n.
-  72, 252, 186, 178, 103,   3, 106,  26, 249, 171, 153, 145, // H...g.j.....
- 107, 138, 159, 106,  59,  22,  39,  79,   0, 195, 154,  54, // k..j;.'O...6
- 155, 131, 168, 177,  31, 223,  62,  78,  45,  28, 251,  81, // ......>N-..Q
- 127, 127, 140, 242, 211, 209, 113, 219, 186,  29, 220,  81, // ......q....Q
- 128, 172,  39,  28, 132, 203,   7, 235, 252, 213, 122, 145, // ..'.......z.
-  18,  64,  87, 167, 211, 120,  25,  30,  91,  47,  30,  91, // .@W..x..[/.[
-  56, 253, 159,  91, 163,  12,  29,  81,  33, 181, 150,  18, // 8..[...Q!...
-  54, 144,  94,  69,  66, 118,  85, 109, 158, 135,  56, 107, // 6.^EBvUm..8k
-  21,  90,  97, 124,  66,  50,  13, 229, 233,  48, 169,  69, // .Za|B2...0.E
-  93, 225, 103, 214, 152,  25, 193, 233,  52, 213, 250, 159, // ].g.....4...
-  67, 211,  62, 250, 116, 201, 199,  29,  34, 153, 214, 196, // C.>.t..."...
- 210, 210, 123, 173, 106, 234, 197, 119,  65,  51, 116,  69, // ..{.j..wA3tE
-  53, 245,  41, 153,  91, 166,  82,  12,  99, 108, 188,  72, // 5.).[.R.cl.H
-  59, 203, 249,  84, 101, 190, 228,  16,  82,  59, 239, 105, // ;..Te...R;.i
-  77,  87, 166, 240, 143, 229, 217, 254,  69,  67,  88, 137, // MW......ECX.
- 187,  83,  55, 220, 236, 241,  72, 177,  24, 136, 129, 134, // .S7...H.....
- 239, 170,  52, 212,  61, 130, 153,  77, 105, 146, 253,  78, // ..4.=..Mi..N
- 207, 129, 204, 142, 220, 124, 115, 109,  92,  74, 180, 145, // .....|sm.J..
-  39, 187, 124, 114, 210, 105, 221, 112,  39, 197, 160, 245, // '.|r.i.p'...
-  69, 133, 121,  31, 151,  35,  44, 231,  44, 115, 205, 137, // E.y..#,.,s..
-  98, 157,  40, 196,  53, 138, 143,  20, 196,  95,  80,  51, // b.(.5...._P3
-   1, 178, 130,  59, 212, 226, 218, 199, 188, 121, 176, 168, // ...;.....y..
- 161, 136, 103,  78, 129,  43,  39,  65, 254,  18, 117, 191, // ..gN.+'A..u.
-  55,  90, 170, 236, 163, 169, 146,  95, 137,  86, 216,  37, // 7Z....._.V.%
-  59, 129, 145,  68,  93, 208, 153, 189, 178,  34, 234, 161, // ;..D]...."..
- 226, 205,  43, 187,  73, 212, 165, 112, 204, 167, 232, 110, // ..+.I..p...n
-  40, 223, 157, 229,  88, 115, 167, 203,  95, 179, 116, 241, // (...Xs.._.t.
- 183,  89, 252, 151,   6, 252, 175,  81, 101, 234,  96,  86, // .Y.....Qe.`V
-  83, 215, 219, 112, 140, 111,  40,  94, 193, 153,  91, 251, // S..p.o(^..[.
-  69,  23, 109, 214,  55, 131,  93, 156,  92,  81, 123, 252, // E.m.7.]..Q{.
-  27, 219, 152,  33,  25, 155, 252,  75, 153, 103, 206,  99, // ...!...K.g.c
- 218,  56, 255,  53, 210, 106,  45, 180, 184,  27, 141,  27, // .8.5.j-.....
- 173, 214, 214, 246, 173, 155,  55, 111, 109, 222, 106, 109, // ......7om.jm
- 110, 221, 188,  41, 124, 149, 143, 148, 110, 235,  11,  72, // n..)|...n..H
- 183, 117,  85, 164, 187, 177,  31, 127, 105, 249, 110, 124, // .uU.....i.n|
-   1, 249, 110,  92,  21, 249, 110,  26, 242, 253,  72, 121, // ..n...n...Hy
- 109, 206, 148, 215, 212, 185, 158,  26, 249, 205,  17, 210, // m...........
- 230,  85,  17, 210, 214, 167, 138, 104, 235,  11, 168, 212, // .U.....h....
- 214,  85, 145, 214, 246, 167,  74, 107, 251,  11,  72, 107, // .U....Jk..Hk
- 251, 170,  72, 235, 198, 167,  74, 235, 198,  23, 144, 214, // ..H...J.....
- 141, 171,  34, 173, 155, 159,  42, 173, 155,  95,  64,  90, // .."...*.._@Z
-  55, 235, 230, 141, 244,  95, 243, 126, 162,  92, 135, 145, // 7...._.~....
-  64, 128, 106, 229,  69, 112, 105,  46, 190, 229,  83, 102, // @.j.Epi...Sf
-  50, 158,  90,  93, 169,  16,  72, 206, 228,  67,  46, 243, // 2.Z]..H..C..
- 102, 126, 218, 253, 158,  37, 232,  55, 151,  77, 239, 106, // f~...%.7.M.j
- 210, 194,  47,  91, 250,  15,  37, 135, 175,  91, 231,  80, // ../[..%..[.P
- 172, 141, 252, 247, 191, 183,  35, 175, 222, 237, 200,  90, // ......#....Z
- 135, 212, 154,  65,   2, 187,  85, 211, 236, 139, 247, 119, // ...A..U....w
- 230, 146, 149, 127, 194, 101, 204,  58, 218, 244, 173, 105, // .....e.:...i
- 146,  90, 169, 185,  31,  73, 165,  94, 107, 193,  95, 134, // .Z...I.^k._.
- 131, 110, 114,  22, 174,  20, 197,  49, 167, 193, 183,  42, // .nr....1...*
-  76, 246,  91, 218, 166,  23, 231, 142, 194,  52, 180, 162, // L.[......4..
- 236, 253, 187, 224, 253,  59,  30,  63, 172, 243,  83,   4, // .....;.?..S.
-  81,  86, 212, 146,  56, 225, 121, 206,  23,   4, 146, 247, // QV..8.y.....
- 239, 122, 161, 160, 239, 180, 242, 211, 208, 194,   6,  84, // .z.........T
- 220,   5,  90, 223, 251, 119,  20,  55, 181,  72, 107, 152, // ..Z..w.7.Hk.
- 169,  58,  73,  41, 173, 248, 194,  74, 112,  56, 199, 138, // .:I)...Jp8..
- 138,  53, 126,  78,  18, 224, 225,  24,  70, 172, 232,  12, // .5~N....F...
-  39,  42,   2,  62, 121,  41,  40, 208,  51, 206,   4, 247, // '*.>y)(.3...
- 184, 173, 227, 144,   2,  67, 232,   9, 153, 242, 147, 247, // .....C......
- 239, 162, 184, 177,  72, 222, 210, 160, 149, 170, 191,  85, // ....H......U
- 169, 126,  75, 209, 191,  45, 119,  76, 163, 100, 247, 148, // .~K..-wL.d..
-  49, 156, 213, 120,  51, 137, 135, 103, 146, 209, 125, 118, // 1..x3..g..}v
-  43, 105, 174,  16, 221, 210,  41, 215, 233, 102, 241, 246, // +i....)..f..
- 115, 233,  33, 243, 205,  71, 113,  89,  13, 141,  91, 194, // s.!..GqY..[.
- 214, 180,  94, 202, 226,  30,  39, 121, 158, 156,  73,  63, // ..^...'y..I?
- 197,  42,  43, 231,  11, 117,  89, 223, 188, 223,  43, 198, // .*+..uY...+.
- 249, 154, 117,  91, 241,  87, 209,  48,  75,  55, 133, 189, // ..u[.W.0K7..
-   1,  13, 200,  91,  78,  94, 195,  63, 125,  80, 242, 195, // ...[N^.?}P..
- 226,  43,  51,  11,  29,  92, 173, 129,  21, 244, 200, 112, // .+3........p
- 174, 243, 191, 150, 212, 245, 117, 252,  67, 250, 110,  41, // ......u.C.n)
- 103,  69,  72,  77, 141, 188,  65,  16, 148, 237, 111, 243, // gEHM..A...o.
-  91,  41,  26, 141,  82,  96, 178,   1, 235, 173, 100,  52, // [)..R`....d4
- 194,  99, 195, 247,  97,  58, 240,  40,  46, 151, 180,  86, // .c..a:.(...V
-  95,  90, 102, 191,  56,  96,  72,  28, 201, 145, 107,  23, // _Zf.8`H...k.
- 176,  97, 147, 201,  78,  72, 178, 140, 128, 220, 136, 191, // .a..NH......
-   6,   5,   8, 176, 224,   5, 123,  80,  34, 224, 219,  50, // ......{P"..2
- 201, 111,  20, 198, 174,  23, 166, 229,  48, 138, 202, 191, // .o......0...
-  83, 222,  78, 113,  29, 133, 247, 166, 113,  38, 103, 112, // S.Nq....q&gp
- 223,  49,  57,  34, 179, 200, 253,  18,  28, 183,  99,  15, // .19"......c.
-  67,  50, 240, 114,  37, 105, 198,  20, 225, 146, 230,  43, // C2.r%i.....+
-   2, 176, 110, 163,  59, 136, 192,  46, 135,  46, 112, 121, // ..n.;.....py
-  57, 243, 213, 157,  27,  91,  32,  29, 152,  65, 186, 233, // 9....[ ..A..
- 101, 126, 196,  48, 178,  21, 214,  60, 111,  52, 157, 123, // e~.0...<o4.{
-  19, 228,  47, 213,  80,  70, 145, 171, 161, 129,   2, 180, // ../.PF......
- 255, 176,  54, 180,  55,  29, 106, 230,  47,  97, 232,  93, // ..6.7.j./a.]
- 239,  84, 199, 123,  30, 246,  65, 154, 123,  82,  13,  56, // .T.{..A.{R.8
- 171, 162, 113, 231, 138, 233,  73,  81,  51, 122,  96, 155, // ..q...IQ3z`.
- 160, 218, 230,   9, 105,  98,  65,   1, 204, 136, 118, 158, // ....ibA...v.
- 125, 158,   1, 152, 123, 125, 221,  94, 203,  27, 167,  73, // }...{}.^...I
- 150, 211,  31, 160, 231, 161,  95, 173,  25,  40, 116,  94, // ......_..(t^
- 204,  56, 197,  59,  50, 237,  12,  36,  71,   2,   0, 206, // .8.;2..$G...
-  68, 218,   6, 250, 245, 229, 229,  74,  79, 130,  92,  10, // D......JO...
- 208, 189,  29, 137, 232,  26, 158,  91,  47, 195, 227,  93, // .......[/..]
-  78, 207,  25, 184,  59, 121,  35, 137, 113,  26, 218, 172, // N...;y#.q...
- 192, 227, 134, 164, 136, 118,  20,  90,   6,  67, 204,  78, // .....v.Z.C.N
- 188, 156, 161, 137, 147,  44, 156,  21, 187, 223, 215, 209, // .....,......
-  25, 119, 144, 191,  56,  19,  43, 196, 197,  55, 185,  59, // .w..8.+..7.;
-   6,   8,  52,  51, 133, 152,  32, 208, 121,   3,   8,  40, // ..43.. .y..(
- 238,  78,  45, 141, 131,  70, 184,  85, 148,  57, 212,  49, // .N-..F.U.9.1
-  90,  10, 219, 118,  47, 247, 146, 131,   2, 221,  22, 168, // Z..v/.......
- 241,  81,   8, 186,  18, 133, 141,  62, 216, 203,  25, 123, // .Q.....>...{
- 219,  75, 149, 250,  41, 138,  95,  69, 211,  34,  17,  25, // .K..)._E."..
- 199, 101,   6,  24,  55, 172, 231, 210,   5,  18,  46,  40, // .e..7......(
-  86, 220,  29, 244,  79, 205, 179, 153,  76,  20,  24, 120, // V...O...L..x
- 133,  57, 120,  10, 143,  63, 117, 141, 172, 152,  35,  56, // .9x..?u...#8
- 145,   4,  75, 212,   9, 202, 124, 193,  37,  38,  39, 206, // ..K...|.%&'.
- 116,   6, 193,  47,  88, 193, 115,  81,  46,  38, 248, 173, // t../X.sQ.&..
-  20, 109,  18,   3, 234, 123,  26,  60, 220,  35, 137, 130, // .m...{.<.#..
-   6,  21, 164,  34, 161, 235,  25, 237,  73, 106, 233,  13, // ..."....Ij..
-  12, 188, 237, 110,  29, 171, 237, 121, 102, 245,  83,   0, // ...n...yf.S.
-  83, 218, 158, 104,  64,  74,   4, 192,  42, 160,  96, 246, // S..h@J..*.`.
- 230, 107,  42,  21,  40, 110,  96, 231, 215,   1, 154, 187, // .k*.(n`.....
- 183,  73,  95,  76, 188, 215, 254,  92,  30, 104, 240,  82, // .I_L.....h.R
- 244,  10, 162,  49,  69,  98, 220, 156, 184, 222,  33,  35, // ...1Eb....!#
- 160, 131, 195, 129, 212, 238, 149, 107,  70,  27, 233,  71, // .......kF..G
-   9, 225,  61, 201,  37, 192, 190,  72,  53,  55,  83, 109, // ..=.%..H57Sm
- 122, 247,  28, 131, 200,  88,  34, 217,  84,   0, 232,  81, // z....X".T..Q
-  91,  60, 187, 139,  34, 139, 233,  49,  88, 245, 240, 160, // [<.."..1X...
-  25, 171, 185,   5, 228, 243, 196, 123,  72, 226, 245, 246, // .......{H...
- 108, 134,  33,   5,  31,  26, 217,   4,   9,  17, 140,  89, // l.!........Y
- 125,  55,  77,   6, 216,  44, 202, 147,  81, 247, 148, 155, // }7M..,..Q...
- 222,  62,  40, 145, 238, 104, 155,  75, 147, 206,   7,  64, // .>(..h.K...@
- 253, 125,  18, 101, 228,  43, 129,  61, 204,  19, 128, 218, // .}.e.+.=....
- 148,  60, 153, 205, 137, 166,  24,  64,  40,  24, 158,  11, // .<.....@(...
- 172, 126, 132,  20,  98, 114,  39,  59, 202, 198,  61, 232, // .~..br';..=.
- 247, 169,  83, 185,  78, 197, 196,  49, 179, 213,  78, 182, // ..S.N..1..N.
- 186,  58,  11,  50, 246, 208, 245, 178, 203,  75, 100,  82, // .:.2.....KdR
- 100, 105, 100,  32,  41, 137, 238,  59, 110, 153, 171,  44, // did )..;n..,
-   0,  40, 117,  95,  37,  43, 126, 205, 228,  69, 200,  17, // .(u_%+~..E..
-  34, 146, 204,  93,  42,  46, 144, 210, 149,  74, 104, 224, // "..]*....Jh.
- 123,  10, 118, 105, 224,  41,  70,  23, 109,  81,  59, 114, // {.vi.)F.mQ;r
- 127, 112, 117, 245, 204,  41, 197, 192, 216, 164, 241,  81, // .pu..).....Q
-  24, 255,  60, 158,  49, 110, 213, 142,  89,  38, 179, 116, // ..<.1n..Y&.t
- 145,  14,  25, 159, 166,  55, 199, 104, 175, 174, 174,  24, // .....7.h....
- 154, 164,  41,  83,  76,  58,  44, 173,  80, 179,  12,  60, // ..)SL:,.P..<
- 152, 232, 153, 159, 130, 108, 106, 111,  23, 170, 226, 108, // .....ljo...l
- 120, 118, 211, 118, 119, 134, 202, 238,  57, 195,  66, 209, // xv.vw...9.B.
- 141, 182,  43, 224,  96,  10, 105, 111,  53,  55, 125, 134, // ..+.`.io57}.
- 135,  15, 242,  81, 214, 121, 237, 184, 237, 105,  94,  10, // ...Q.y...i^.
- 201, 171, 129, 145, 229, 126, 144, 135,  59, 138,   5,  48, // .....~..;..0
- 119,  98, 144, 253,  61, 162,  25,  12,  88, 253, 152, 119, // wb..=...X..w
-  66, 134,  61, 141,  98,  84, 167,  18, 186,  27,  82,  83, // B.=.bT....RS
- 247,  16, 170, 249,  10, 153,  73, 112,  38, 137, 140,  24, // ......Ip&...
- 156, 168,  66, 115, 122, 160,  28, 192, 152,   5, 177, 174, // ..Bsz.......
- 231, 185, 176,  32,  98, 169,  98, 197,  79, 153, 196,  76, // ... b.b.O..L
-   7, 120, 208, 221, 250, 175,  38, 138, 235,  27, 189, 175, // .x....&.....
- 191, 148, 225, 208,  37, 105, 205,  53,  25,  26, 173,  74, // ....%i.5...J
-  81,  53, 214, 151,  96,  82,  75, 178, 161,  91, 182,  53, // Q5..`RK..[.5
-   1, 214,  55, 153, 224, 239,  19,  87,  39, 192,  99, 167, // ..7....W'.c.
-  26,  79, 141,   2, 208,  96, 129, 145, 112, 197,  41,  72, // .O...`..p.)H
- 204,   6,  24,  80,  52,  39, 187,   2,  47,  22,   8,  94, // ...P4'../..^
-  70, 128, 102, 104,  23, 131, 103, 101, 244, 212,   4, 243, // F.fh..ge....
-  19,  18, 178, 161, 197,  52, 122, 187, 242,  29,  51, 150, // .....4z...3.
-  25, 239,  10, 194, 178,  74, 218,  70, 191, 222, 147,  15, // .....J.F....
-   7,  52, 204, 192,  79,  58, 129,  23, 230, 159, 146, 133, // .4..O:......
- 149,  40,  80, 248, 121,   2, 131, 139, 190, 232,  31, 138, // .(P.y.......
-  39,  26,  66, 252, 215, 158,  74, 228, 118, 243, 242,  82, // '.B...J.v..R
-  62, 222, 241,  29,  45,  31, 238, 218,  64,  56,  82, 108, // >...-...@8Rl
- 135,  96, 139, 119, 141, 188,  65,  22, 161, 136, 230,  46, // .`.w..A.....
- 252,  23, 206,  91, 239, 165, 243,  11,  70, 205, 208, 133, // ...[....F...
-   8,  71, 165,  46, 105, 219,  28, 239, 141, 175,  25, 175, // .G..i.......
- 101,  50, 147,  35, 239,  24, 218, 114, 142, 127, 158, 150, // e2.#...r....
-  13, 139, 200,  93, 242, 236, 144, 118,  57, 114, 224,  16, // ...]...v9r..
- 228,  71, 206, 156, 238,  96, 114,  42, 185, 160,   5, 124, // .G...`r*...|
- 218, 105, 104,  89, 177, 187,  35,  73,  78, 163,  78,   6, // .ihY..#IN.N.
- 186,  87, 201, 123,  35, 167,  46, 190,  15,  39, 197,  57, // .W.{#....'.9
-  70, 159,  59, 199,  63, 111, 124,  53, 169, 121,  85,  42, // F.;.?o|5.yU*
- 161, 228, 102, 122, 160, 200,  99,  37,  21,  49,  47, 133, // ..fz..c%.1/.
- 221, 185,  54, 190, 152,   8,  26,  96, 131,  69, 250,  60, // ..6....`.E.<
- 122,  27, 164, 189, 235,  98, 206, 163, 217, 138, 201,  76, // z....b.....L
-  29, 131, 170, 219, 190, 126,  93, 210, 141, 243,  44, 161, // .....~]...,.
- 221, 164, 201,  18, 248,  53, 109,  99, 161, 184, 213, 108, // .....5mc...l
- 190,  62, 221, 193, 196, 170,  20, 246,  45,  69,  61, 154, // .>......-E=.
-  84, 121, 217, 123,  65, 118, 202, 224, 194,  60, 185,  30, // Ty.{Av...<..
- 210,  52, 190, 194, 128,  44,   8, 170,  11, 202,  42, 129, // .4...,....*.
-  63, 173, 200, 219, 207,  73,  10, 211,  36, 237, 215, 198, // ?....I..$...
- 255,  42, 168, 161,  11,  82, 238,  50, 101, 116,  45, 225, // .*...R.2et-.
- 244,  44, 210, 110, 138, 213, 173, 143,  37, 248, 187, 233, // .,.n....%...
- 125, 191, 120, 175,  73, 171, 243,  34, 172,  91, 101, 245, // }.x.I..".[e.
- 166, 215,  39, 234, 181, 164, 175,  62, 154,  76, 145, 122, // ..'....>.L.z
- 203, 207, 180, 116,  20, 207,  53, 181,  71,  93, 213, 235, // ...t..5.G]..
-  73, 239, 229, 199, 244,  81, 170, 104,  79, 243,  52, 136, // I....Q.hO.4.
- 179,   1,  13,   1, 215, 223,  92, 111, 162,  93, 205, 128, // .......o.]..
-  62, 201, 184, 196,  30, 207,  50, 253, 113,  98, 201, 201, // >.....2.qb..
-  39, 115,  76,  91, 172, 253,  62, 152, 111,  74, 178,  52, // 'sL[..>.oJ.4
-  89, 229,  37, 237, 187,  81, 183, 114,   1, 145,  68,  93, // Y.%..Q.r..D]
- 233,  84, 193, 197, 212, 220,   6,  70,  33, 189,  94,  33, // .T.....F!.^!
-  21, 228,  47,  80, 190, 235, 188, 136,  99,  79, 211, 220, // ../P....cO..
- 135,   3, 147,  41,  92, 206, 217, 169, 100,  43,  77,  51, // ...)....d+M3
- 124,  40, 170, 241, 170,  28, 198, 244, 217, 111,  62, 132, // |(.......o>.
- 150,  60, 159, 166,  37,  63, 173, 165,  37,  95,  47,  72, // .<..%?..%_/H
- 201, 191, 145, 127,  36, 251, 118,  49, 203,  79, 244, 236, // ....$.v1.O..
-  62, 212, 180, 218,  99,  26,  61, 188, 210,  52, 221, 221, // >...c.=..4..
- 185, 189, 142,  21, 200,  97, 126, 231, 155, 111, 254,  15, // .....a~..o..
-   3, 197,   7,  25,  95,  67,   2,   0, 0 // ...._C..
+  31, 139,   8,   0,   0,   0,   0,   0,   2,   3, 236, 253, // ............
+ 251,  98, 219, 184, 146,  47,  10, 255, 253, 173, 167, 144, // .b.../......
+ 185, 178, 188, 200,  24, 146,  37, 217,  78,  28,  42, 180, // ......%.N.*.
+  78, 226,  36, 157, 116, 199,  73,  58,  78, 250, 230, 246, // N.$.t.I:N...
+ 184, 105,   9, 178,  25, 211, 164, 154, 162, 124, 137, 173, // .i.......|..
+ 243,  44, 243,  44, 243, 100,  95, 253, 170,   0,  94,  36, // .,.,.d_...^$
+  57,  73, 175, 153, 179, 207, 204, 222,  39,  23, 145, 196, // 9I......'...
+  29, 133,  66, 161, 170,  80,  40,  60,  94, 121, 246, 118, // ..B..P(<^y.v
+ 247, 195, 175, 239, 158,  55,  78, 243, 243, 120, 231, 241, // .....7N..x..
+ 185, 206, 195, 198, 224,  52, 204,  38,  58,  15, 166, 249, // .....4.&:...
+ 168, 185, 109, 194, 146, 240,  92,   7,  23, 145, 190,  28, // ..m.........
+ 167,  89, 222,  24, 164,  73, 174, 147,  60, 112,  46, 163, // .Y...I..<p..
+  97, 126,  26,  12, 245,  69,  52, 208,  77, 254,  80, 141, // a~...E4.M.P.
+  40, 137, 242,  40, 140, 155, 147,  65,  24, 235, 160, 211, // (..(...A....
+ 106,  59,  59, 143, 227,  40,  57, 107, 100,  58,  14,  34, // j;;..(9kd:."
+ 202, 218,  56, 205, 244,  40, 136, 211, 147, 180,  53, 185, // ..8..(....5.
+  56, 105, 228, 215,  99,  29,  68, 231, 225, 137,  94, 167, // 8i..c.D...^.
+ 207, 181,  43, 180,  99, 146,  95, 199, 122, 167,  53,  29, // ..+.c._.z.5.
+ 199, 105, 174, 228, 209, 184, 111,  95, 252,  99,  61,  74, // .i....o_.c=J
+  51,  93, 124, 134, 163,  92, 103,  55, 199, 233,  85, 115, // 3]|...g7..Us
+  18, 125, 142, 146,  19, 255,  56, 205, 134,  58, 107,  82, // .}....8..:kR
+ 200,  76, 210, 220, 112, 211, 252, 243,  40, 105, 154, 166, // .L..p...(i..
+ 247,  70, 244, 108, 142, 194, 243,  40, 190, 246,  39, 215, // .F.l...(..'.
+ 147,  92, 159,  55, 167, 145, 106, 134, 227, 113, 172, 155, // ...7..j..q..
+  18, 160, 246, 245,  73, 170,  27,  31,  95, 169, 247, 233, // ....I..._...
+ 113, 154, 167, 234, 165, 142,  47, 116,  30,  13, 194, 198, // q...../t....
+  27,  61, 213, 234,  73,  70, 221,  84, 111,  40, 166, 177, // .=..IF.To(..
+  31,  38,  19,  53, 161, 159, 230,  68, 103, 209,  72,  61, // .&.5...Dg.H=
+  65,  49, 141, 221,  52,  78, 179, 198, 243, 243, 244,  83, // A1..4N.....S
+  84, 148,  53, 255, 185, 127, 125, 126, 156, 154,  82,  42, // T.5...}~..R*
+ 233, 123,   4,  49, 221,  60, 213, 209, 201, 105, 238, 119, // .{.1.<...i.w
+  90,  91, 212, 145, 102,  30, 229, 177, 190, 201, 245,  85, // Z[..f......U
+ 222,  12, 227, 232,  36, 241,   7, 212,  17, 157,  73,  87, // ....$.....IW
+ 168, 235, 218, 239, 108, 143, 175, 228, 243,  82, 114,  62, // ....l....Rr>
+ 108, 183, 145, 243,  50,  11, 199,  55,  83, 106,  26,  53, // l...2..7Sj.5
+  47, 214, 131, 220,  79, 210,  68, 247, 198, 233, 132,  70, // /...O.D....F
+  42,  77, 124,  26, 152,  48, 143,  46,  52, 146, 166,  23, // *M|..0..4...
+  58,  35, 200,  54, 167,   9, 129, 240, 166,  72,  18,  30, // :#.6.....H..
+  79, 210, 120, 154, 115,  18, 137,  66, 194,  81, 156,  94, // O.x.s..B.Q.^
+ 250, 167, 209, 112, 168,  19,   3, 233, 198,  32,  76,  46, // ...p..... L.
+ 194, 137,   1, 120, 167, 221, 254,  71, 207, 118,   2, 239, // ...x...G.v..
+ 195, 104,  50, 142, 195, 107, 255,  56,  78,   7, 103, 203, // .h2..k.8N.g.
+  27,  16,  94,  69, 147, 229, 245, 198, 250,  68,  39, 195, // ..^E.....D'.
+  37,   0,  56,  15, 179, 147, 136, 210,  78, 243, 180,  10, // %.8.....N...
+ 140, 205,  49, 198, 191,  25,  37, 128, 229,  77, 173, 234, // ..1...%..M..
+  50, 188, 113, 191, 136, 145, 128, 230, 124, 130,  60, 187, // 2.q.....|.<.
+ 145,  10, 154, 153, 116, 228, 129, 148,  43, 205, 105, 228, // ....t...+.i.
+ 167,  55,  85, 136,  63,  16, 136,  23, 145,  59, 247, 111, // .7U.?....;.o
+   8,  80,  64, 154, 216,  52, 250, 156, 224,  21, 235, 222, // .P@..4......
+  93, 181, 154, 156, 244,  70, 181, 158,  17, 160,  13,  40, // ]....F.....(
+ 245, 121,   1,  73, 122, 173, 181, 136,  58, 218,  59,  14, // .y.Iz...:.;.
+   7, 103,  39,  89,  74,  99, 211,  28, 196, 209, 216,  31, // .g'YJc......
+ 135, 195,  33, 205,   5,  76, 130, 149, 232,  28, 179,  54, // ..!..L.....6
+  76, 242, 178,  87, 168, 136,   0,  78,  13,  52, 211, 199, // L..W...N.4..
+ 204,  11, 223, 241, 157, 222, 210,   6, 151, 121,   9, 123, // .........y.{
+ 114, 215,  20, 224, 161, 161,  23,  97,  60,  45,   1,  12, // r......a<-..
+ 220,  66,  98, 204,   4,  61, 161, 254, 155, 166, 248, 102, // .Bb..=.....f
+  60,  36,  28, 112,  27,  76, 179,  73, 154, 249, 227,  52, // <$.p.L.I...4
+ 194,  48, 214,  59, 159, 142,  70, 148,  53,  29, 135, 131, // .0.;..F.5...
+  40, 191, 246,  91,  27, 146,  19, 200, 123,  99, 210,  55, // (..[....{c.7
+ 245,   5,  53, 120,  34, 184,  92, 118, 223, 255, 123, 155, // ..5x"..v..{.
+ 255, 116, 186, 189, 165,  88,  36, 149,  54, 175,  84, 249, // .t...X$.6.T.
+ 126, 189, 180, 200, 203,  40, 142, 155,  68,  11, 147,  19, // ~....(..D...
+ 237, 231,  25, 205, 109,  34,  58, 231, 139, 101, 246, 242, // ....m":..e..
+ 116, 236, 183, 123, 177,  30, 229,  62,  15, 253, 233, 231, // t..{...>....
+ 198,  92,  53,  23, 121, 163,  90, 153,  33,  79,   6, 155, // ..5.y.Z.!O..
+ 198,  87, 141,  97,  56,  57, 213, 195, 198, 223,  31, 180, // .W.a89......
+  31,  14, 183, 143, 171,  19, 102, 161, 188, 235, 133, 242, // ......f.....
+ 174, 110,  10, 114, 151, 231, 233, 249, 178,   2, 203, 201, // .n.r........
+  88,   1, 192,  56, 255,  11, 189, 150,  42, 252, 118, 131, // X..8....*.v.
+ 250,  28,  13, 123, 182,   7, 225,  48, 154,  78, 252,  45, // ...{...0.N.-
+ 154, 216,  95,   6, 203, 183,  99,  39, 102, 191, 140, 190, // .._...c'f...
+  42,   6, 188, 252, 182,  93,  94,   8, 185,  94,   8,  25, // *....]^..^..
+ 155, 108, 117, 180, 124, 188,  46,  43, 203, 227, 227, 116, // .lu.|..+...t
+ 120, 189, 243, 183, 199, 147,  65,  22, 141, 115,  89, 130, // x.....A..sY.
+ 206, 211, 225, 148, 162,  70, 211, 100, 128, 158,  52, 180, // .....F.d..4.
+ 171,  85, 174,  98, 149, 120,  55, 111, 143,  63, 161,  29, // .U.b.x7o.?..
+  67,  61,  34, 244, 127, 151, 165,  99, 154,  32, 215,  28, // C="....c. ..
+ 125, 115, 162, 115,  63,  86, 180,  92, 250, 137, 210, 201, // }s.s?V......
+ 244,  92, 103, 225, 113, 172, 253, 149, 182, 162,  25,  53, // ..g.q......5
+ 138,  78, 166, 246, 123, 230, 205,  46, 194, 172, 193,  37, // .N..{......%
+   6,  39, 113, 122,  28, 198,  31,  78, 163, 137,  74, 131, // .'qz...N..J.
+ 155, 153, 202, 240,  19,   5,  73, 107,  28, 102,   3,  29, // ......Ik.f..
+ 191, 215, 127,  78, 163,  76,  63, 218,  28, 116, 123, 201, // ...N.L?..t{.
+  52, 142, 131,  32,  90,  93, 117, 221,  40, 176, 141, 115, // 4.. Z]u.(..s
+ 181, 119,  19, 141,  92,  77, 139, 109,  35, 245,  50, 157, // .w...M.m#.2.
+  79,  51, 122,  57, 208, 135,  45, 125,   5, 104,  78, 122, // O3z9..-}.hNz
+  54,  54, 243, 110, 184, 218,  32, 163, 216, 222, 144,   0, // 66.n.. .....
+ 154, 235,   6, 191,  35,  56,  14, 110, 162, 161, 175, 149, // ....#8.n....
+ 201, 229, 223, 204, 102, 189,  74, 105,  65, 172, 242,  22, // ....f.JiA...
+  17, 130, 216, 141, 109, 193, 212, 252, 226, 221,  43,  95, // ....m.....+_
+ 185, 111,  73, 240,  60, 203, 210, 204, 117, 118, 195, 132, // .oI.<...uv..
+ 104,  68, 131, 160,  53, 108,   8,  88,  27, 255, 116, 214, // hD..5l.X..t.
+ 244, 154, 243,  79, 199, 235, 229, 167,  89, 122, 217,  72, // ...O....Yz.H
+  90, 131, 116, 168,   3, 103, 239, 237, 179, 143, 175, 159, // Z.t..g......
+  31, 189, 121, 251, 225, 232, 197, 219, 143, 111, 158,  57, // ..y......o.9
+  42, 153, 121, 173,  76, 159,  68, 180,   4, 103, 149,  14, // *.y.L.D..g..
+ 171, 220, 187,  65, 187, 131, 124, 166, 150, 192,  41, 136, // ...A..|...).
+  60, 229, 182,  85,  84, 100, 245,  92, 231, 225, 199,  31, // <..UTd......
+ 194, 239,  28,  85, 148,  65, 176, 247, 110,   8,   0, 141, // ...U.A..n...
+  68, 165,  61, 237, 230,  69, 159, 156,  76,  99,  77, 115, // D.=..E..LcMs
+ 148, 235,   5,  59, 175,  60,  85, 139,  27, 100,  58, 204, // ...;.<U..d:.
+ 245,  46, 232, 227,  85,  46,  73, 126, 158,  75,   2, 230, // ....U.I~.K..
+  73,  98, 190, 155, 139, 161,  69, 247, 249, 104,  68, 200, // Ib....E..hD.
+  35, 209,  58,  93, 140, 127, 175,  71,  38,  50,  91, 140, // #.:]...G&2[.
+ 220, 211, 231, 169, 137, 141,  22,  99, 107, 141, 210, 225, // .......ck...
+  92, 130, 227,  48,  31, 156, 154, 184, 231, 115, 113,  19, // ...0.....sq.
+  34, 236, 161, 105, 179, 126, 185,  88, 242, 126,  53, 254, // "..i.~.X.~5.
+ 199, 249, 238,  74, 248, 158, 199,  56, 148, 169,  72, 133, // ...J...8..H.
+ 106, 162, 166, 106, 160,  70, 106, 172, 134, 234,  84, 157, // j..j.Fj...T.
+ 168, 115, 117,   1, 156,  62,  10,  14,  14, 213, 117, 176, // .su..>....u.
+  14,  50, 126, 171, 175, 220, 190,  63, 185,  61, 185,  77, // .2~....?.=.M
+ 110, 199, 183, 247, 188, 219, 108, 124, 122, 123, 146,  69, // n.....l|z{.E
+ 195, 219, 244, 114, 114, 123, 158,  12, 110, 147, 252, 242, // ...rr{..n...
+ 150, 102, 216, 193, 224, 244, 240, 246, 115, 154, 222, 254, // .f......s...
+  27, 209, 153, 219, 136,   6,  51,  92, 143, 212,  85, 240, // ......3...U.
+  36, 203, 194, 235,  86,  52, 225, 103, 175, 152, 168, 199, // $...V4.g....
+ 130,  28,  68, 168,  92, 198, 105, 160, 125, 238, 233, 131, // ..D...i.}...
+ 152, 112, 133, 126,  44,  66, 235,  89, 145, 227,  18, 243, // .p.~,B.Y....
+  71, 175, 174, 106, 224,  17, 209, 190,  55, 132, 138, 245, // G..j....7...
+  47,  66, 163, 115, 226, 112, 118,  79, 163, 120,  72, 137, // /B.s.pvO.xH.
+ 203, 172, 123,  66,  21, 100,  86,  17,  30, 161, 243, 212, // ..{B.dV.....
+ 209,  30, 106, 143, 164, 102, 231,  76,  95,  59,  52, 101, // ..j..f.L_;4e
+ 251,   9, 213,  31,  29, 250, 132,  93,  35, 254,  78, 229, // .......]#.N.
+  59, 164,  31, 126, 195,  36, 165, 117, 156, 136,   6, 145, // ;..~.$.u....
+ 223,  86, 172, 147,  19, 226,  23, 186,  52, 211, 195, 214, // .V......4...
+   0,  21,  83,  99, 130, 133, 248, 141, 126,  38,  83, 178, // ..Sc....~&S.
+ 136,  81,  93, 207, 143,  61, 229, 216,  54,  82,  93,  32, // .Q]..=..6R] 
+ 104, 233, 168,  65, 157,   2, 249,  88,   9,  52, 104,  87, // h..A...X.4hW
+  56, 141, 115,  16, 175, 137,  87,  52, 118,  46, 252,  34, // 8.s...W4v.."
+ 141, 134, 141, 118,  16,   4, 104,  34, 218, 129, 150, 214, // ...v..h"....
+ 211,  80, 136, 103,  33, 122,  70, 176,   8,  21, 128, 128, // .P.g!zF.....
+  90,  42,  64,  58, 179, 164,  83, 165,   2,  40, 162, 111, // Z*@:..S..(.o
+ 104,  18,  81, 154,  49,  10, 241, 115,  69,  48,  34, 186, // h.Q.1..sE0".
+  73, 144,  33, 186, 121, 116, 116, 230, 163,   4, 122, 177, // I.!.ytt...z.
+ 207,  99, 191,  77, 191, 218, 126,  14, 228, 133,  72, 234, // .c.M..~...H.
+  36, 207, 166, 131, 156, 184,   6, 105,  43, 197,  93, 248, // $......i+.].
+  66,  34, 211, 254, 218,  90, 232, 167,  20,  18, 249, 205, // B"...Z......
+  14,  61, 166, 180,  30, 219, 166, 154,  36,  22,  30,  81, // .=......$..Q
+ 235,  34, 225,  49,  55,  47,  46,  77, 189, 172, 108, 255, // .".17/.M..l.
+ 107, 224, 135,  69, 155,  98,  44, 202, 248,  93, 193, 184, // k..E.b,..]..
+ 156, 232, 119, 139,  59,  20, 208,  55,  62,   6,  50,  33, // ..w.;..7>.2!
+ 137,  70,  21, 105, 239,  73,  90,  26, 106, 105,  67, 238, // .F.i.IZ.jiC.
+  21,   5,  31,  29, 245,  41, 150,  30,  10,  63, 209,  90, // .....)...?.Z
+ 199, 227, 174, 244,  10,  76, 238, 229, 143,  17, 115, 102, // .....L....sf
+ 198, 190, 151, 175, 173, 121, 166, 160, 149, 192, 141,   3, // .....y......
+ 142,  60, 200,  15,  61, 219, 175, 152,   2, 180, 173, 128, // .<..=.......
+  63,  12,   0, 150,  33,  71,  11,  47, 104, 129,  84,  91, // ?...!G./h.T[
+  54, 121,  31, 221, 119,  87,  80, 250, 144, 176, 128, 159, // 6y..wWP.....
+ 193,  74, 155, 106, 161, 238,  78,  39, 167,  20, 189, 186, // .J.j..N'....
+ 186, 242, 129, 130, 179, 181, 181, 219, 219, 233,  10,  33, // ...........!
+  55,  33, 201,  49, 173, 239,   3,  34, 103,  32, 165, 180, // 7!.1..."g ..
+ 184, 123,  88, 178, 166,  75,  99, 110, 111,   7, 158, 251, // .{X..Kcno...
+ 161, 130,  48,  31,  92, 193, 147,   2, 109,  84,  70, 152, // ..0.....mTF.
+  53, 101,  72,  76,  90, 180, 158, 231, 238, 200, 235, 233, // 5eHLZ.......
+ 128, 222,  79, 163,  81, 238, 122,  61, 207, 182,  46,  15, // ..O.Q.z=....
+ 236, 212, 160, 117, 213,  32,  69,  22, 184,  41, 195, 199, // ...u. E..)..
+ 163,  68,  23, 248,  33,  68,   5,  37, 154, 226,   7, 112, // .D..!D.%...p
+ 121, 135, 198,  37, 193, 177,  75,  52,  42, 245,  56,  89, // y..%..K4*.8Y
+ 144, 226, 119, 173, 163,  22, 144,  35, 241, 212,  51, 151, // ..w....#..3.
+ 115, 113, 211, 240, 150,  72,  41,  45, 200, 197,  19,  98, // sq...H)-...b
+  82, 245, 199, 247, 175, 212,  70, 119,  21, 101,  76, 251, // R.....Fw.eL.
+   7, 217, 161,  32, 108, 168, 100, 208,  51,   2, 115, 234, // ... l.d.3.s.
+ 249, 153,  90,  89, 113, 109,  42,  79, 209, 191, 164, 172, // ..ZYqm*O....
+ 153, 223, 121,  64, 241,  66,  19,  47,  81, 239,  93,  76, // ..y@.B./Q.]L
+  47, 147,  76, 175,   4, 217, 234, 106, 133,  61, 201,   5, // /.L....j.=..
+ 102,   4, 175,  94, 137,  20, 132, 123, 148, 182,  64,   8, // f..^...{..@.
+ 124,  12, 132,  54, 226,  85,  75,  64, 235,  56, 156, 232, // |..6.UK@.8..
+ 128,  91,  24,   7, 196, 164,  61, 206, 171,  88,  22, 215, // .[....=..X..
+ 176,  44, 225,  44, 103,  68,  72, 139,  66, 185,  53, 132, // .,.,gDH.B.5.
+ 254,  11,   5,  50, 194,  29, 211, 122, 121,  54, 179,  72, // ...2...zy6.H
+  78, 173, 156, 205,   8, 130, 158,  42,  40,  88,  14,  60, // N......*(X.<
+  50,  99, 234, 245,  24, 141, 130, 118, 137,  11, 159, 221, // 2c.....v....
+  58,  22, 152, 149,  69,  58,  91,  46,  47, 215, 234,  56, // :...E:[./..8
+  72, 168,  69, 104, 220, 237, 237, 145, 218, 163, 150, 152, // H.Eh........
+  14, 160, 183, 211,  26, 235,  80, 163,  69, 101, 153,  52, // ......P.Ee.4
+  95,  12, 234, 140, 131, 145,  26,  18,  40, 144, 149, 103, // _.......(..g
+ 149,  44,  54,  52, 104, 132,  76, 237,  94, 246,  56, 237, // .,64h.L.^.8.
+  17, 174, 123,   6,  38,  33, 145, 239,  12, 240, 112, 142, // ..{.&!....p.
+ 211,  52, 214,  97, 226, 172, 216,  89,  21,  82,  96,  49, // .4.a...Y.R`1
+ 215, 202, 208,  62,  53,  40,  91,  27,  42, 202,  42, 147, // ...>5([.*.*.
+  54,  59,  12,  28, 162, 101,  52,  27, 202,  25,  25, 222, // 6;...e4.....
+ 222,  58, 196,  66,  30,  19,  39,  82,  11,  59, 142,  72, // .:.B..'R.;.H
+ 214, 203, 107,  97,  97, 171,  66,  11, 131,  96, 159,  75, // ..kaa.B..`.K
+ 234, 159, 185,  21, 172,  43, 127,  60, 255, 202,  13,  61, // .....+.<...=
+ 138, 125, 173, 110,  44,  49, 243, 195, 217,  66, 170, 146, // .}.n,1...B..
+ 252,  87,  75,  95,  93,  13, 169, 197, 199,  59, 109,  42, // .WK_]....;m*
+  32, 100, 154, 161,  66, 161, 122, 244,  36,  50,  78, 191, //  d..B.z.$2N.
+  68, 198, 251, 252, 107, 176, 158, 103, 157,  31,  98,  90, // D...k..g..bZ
+   5, 154,  63, 143, 185, 219, 199,  52, 187,  38, 130, 119, // ..?....4.&.w
+ 205,  14,  81,  13, 119,  16,  32,  50,  90,  24,  43,  25, // ..Q.w. 2Z.+.
+  41, 140, 127,  68,  25, 185, 146,  64, 232,  21, 229, 231, // )..D...@....
+  69, 189, 160, 167, 193, 228, 246, 118,  66, 115, 149,  94, // E......vBs.^
+ 144, 144,  90, 139,  48,  78, 187, 186,  74, 157, 113, 187, // ..Z.0N..J.q.
+ 132, 109, 152, 110,   5,  89, 228, 188,  59, 107,   6, 193, // .m.n.Y..;k..
+  39, 115, 169, 120, 113,  76, 131, 152, 150, 144,  44, 136, // 's.xqL....,.
+ 215,  58, 189, 116,  39, 104, 223, 222, 102, 143,  11, 244, // .:.t'h..f...
+  98,  98, 142,  80, 126, 113, 209, 160,  20, 200,  80,  45, // bb.P~q....P-
+ 102, 121, 131,  10,  78, 189, 151,  54, 155,  51, 202,  92, // fy..N..6.3..
+ 150,  90, 150, 149, 253, 181, 178,  50,  32, 230, 204, 206, // .Z.....2 ...
+ 183, 102, 103,  70,  52,  35,  38, 244,  30, 123,  32, 192, // .fgF4#&..{ .
+ 227, 102,  83,  81, 169, 241, 193,   0, 165, 186,  92, 224, // .fSQ........
+ 109, 208, 165, 233,  40, 208,  35, 224,  89,  48,  98, 208, // m...(.#.Y0b.
+ 250, 110, 179,  19,   4, 131, 213, 213,  33, 229,  91, 134, // .n......!.[.
+ 199,   6, 174, 110,  40,   5, 109, 122, 158,  63,  88,   9, // ...n(.mz.?X.
+ 166,  20,  50,   8, 130, 105, 179, 211, 167, 140,  62,  94, // ..2..i....>^
+ 215, 232, 117, 109, 205, 119,   7,  59,  83,  14, 163,  15, // ..um.w.;S...
+  85, 102, 242, 252,  98,  22, 240, 138,  71, 125,  31,  51, // Uf..b...G}.3
+ 224, 101, 178, 141, 170, 147,  13, 173,  95,   2,  19, 238, // .e......_...
+ 139,  14,  64,   3, 136,  70, 221, 115,  39, 212, 167,  42, // ..@..F.s'..*
+ 113, 172, 161,  17,  42, 136,  90, 211, 228, 156,  22, 162, // q...*.Z.....
+  28, 132, 221, 188,  18, 117,  82,  52, 216,  57, 112,  23, // .....uR4.9p.
+ 101, 166,  45,  18,  31, 193,   3, 174, 174,  22, 175, 132, // e.-.........
+ 167,  76, 233, 110, 111,  95, 186, 194, 233,  16, 251,  39, // .L.no_.....'
+ 240,  91,   9,  56,  51,  72, 172,  32,   5, 205,  27, 146, // .[.83H. ....
+ 102,  19, 202, 245,  51, 201, 209,  31, 165,  18,  47, 207, // f...3...../.
+ 174, 111, 150,  71, 185, 222, 108,   0,  46, 157, 229,  57, // .o.G..l....9
+  84,  66,  19, 128,  24, 169,  84, 232,  41, 150, 133, 119, // TB....T.)..w
+  12,  32, 224, 138, 212, 116,  86,   1,  83, 106,  49,  18, // . ...tV.Sj1.
+ 208,  74,   9,  72, 196, 195, 186, 120, 162, 239,  68,  55, // .J.H...x..D7
+  22, 199,  47,  23, 212, 233,  81, 236, 165,  44,   8, 158, // ../...Q..,..
+ 226, 246, 115, 217, 210,  79, 179, 136, 206, 220, 137,  34, // ..s..O....."
+ 152,  22,  12, 212, 204,  37,  97,  80,  29,  19, 102, 237, // .....%aP..f.
+ 121,  68,  46, 219, 189, 241, 227, 189, 222, 184,  28, 166, // yD..........
+  83, 102,  62, 206,  14, 198, 140, 104, 195,   0, 136,  20, // Sf>....h....
+ 156,  98, 118, 247,  47, 252, 227,   3, 126,  59, 188, 189, // .bv./...~;..
+ 189,  80, 252,  22, 140,  73,  42, 120,  70, 189,  61,  37, // .P...I*xF.=%
+ 130,  94, 167, 243, 234, 132, 179,  81,  20,  70, 133,  80, // .^.....Q.F.P
+  17, 143, 149, 192, 124, 185,  67, 121, 190, 148,  23,  25, // ....|.Cy....
+ 143,  83,  26, 122, 225,  76,  56,  21,  87,  49, 184, 189, // .S.z.L8.W1..
+  61, 161,   8, 139, 232, 231, 118, 241,  58, 161,  50, 206, // =.....v.:.2.
+ 131,  19,  79, 109, 174, 158,  50,  62, 222,  14, 153, 222, // ..Om..2>....
+  75,  99, 207, 250, 229, 194, 177,  20, 139, 150,  48,  82, // Kc........0R
+   6, 168,  55,  66,  56, 120, 144, 120, 209,  32, 110, 115, // ..7B8x.x. ns
+ 233,  24, 241,  16,  49, 184, 105, 245,  45,   7, 172, 132, // ....1.i.-...
+ 117,  60, 203, 101, 189, 143,  41,  49, 253, 207, 205, 172, // u<.e..)1....
+  91,  73, 152, 193,  12, 163, 100, 226, 198, 128, 114,  76, // [I....d...rL
+ 120, 159, 163, 139,  45,  10, 210,  89, 254, 148,  21, 227, // x...-..Y....
+  50, 176,  42, 150, 169,  77,  66, 186, 140, 171, 215,  27, // 2.*..MB.....
+ 166,  36, 240,  83, 121, 113,  43,  33,  38, 117,  63,  58, // .$.Syq+!&u?:
+ 142, 105, 209, 232,  93, 210, 138, 160,  13,  49, 164, 200, // .i..]....1..
+ 237, 128,   6,  18, 108, 207, 135,  10, 145, 137, 103, 238, // ....l.....g.
+  41,  13,  15, 113, 138,  75, 250, 127, 106, 154,  39, 120, // )..q.K..j.'x
+  67, 211, 229, 154, 128, 120, 237,   3, 208, 211, 224, 164, // C....x......
+  90, 151, 199,  35,  51,  93,  13, 154,  15, 203, 206,  50, // Z..#3].....2
+ 206, 157, 171, 105, 201,   1,  60,  55, 210, 190,  36,  32, // ...i..<7..$ 
+ 142, 230, 246, 150, 216,  54,  25,  71, 141, 245, 208,  44, // .....6.G...,
+ 186,  37,  43, 123, 123, 235,  94, 209,  28, 234, 107, 226, // .%+{{.^...k.
+  43, 206, 181,  91,  85, 147,  72,  97,  51, 207, 207,  45, // +..[U.Ha3..-
+ 239,  74,  40,  95, 214, 245, 196, 202, 115,  78,  19, 229, // .J(_....sN..
+  29, 180,  15,  81, 136, 206,  11,  45,  79, 110,  42, 142, // ...Q...-On*.
+ 251, 142,  67,  98, 150, 175, 137, 223,  14,  42,  65, 118, // ..Cb.....*Av
+ 197,  46, 230,  24, 193, 253, 186, 149, 235,   9, 136,  75, // ...........K
+  63, 246, 227,  53, 103, 124, 229, 148,  21, 190,  91, 224, // ?..5g|....[.
+  71, 122, 218,   7,  98, 177, 102,  10, 109, 240, 228, 171, // Gz..b.f.m...
+ 206,  27, 196, 196, 240, 114, 138, 214,  96,  50, 249,   0, // .....r..`2..
+  25,  35, 238, 233, 120, 162, 111, 150,  37,  78, 152, 107, // .#..x.o.%N.k
+ 175,  39,  79,   2, 199,  33,  76,  97, 242, 145,  67, 246, // .'O..!La..C.
+  75,  60, 160,  22, 222, 168, 197,  79, 108, 122, 106,  27, // K<.....Olzj.
+ 165,   3, 166, 199, 101, 210, 216, 163,  18,  99, 116, 156, // ....e....ct.
+ 232,  45,  61, 234, 233,  17, 225, 205, 208, 152,   6,  26, // .-=.........
+ 147,  26,  56,  18,  35, 196,  67, 116, 208,  57, 244, 178, // ..8.#.Ct.9..
+  32,  55, 188, 105, 166, 199,  49, 177, 203, 238,  88,  57, //  7.i..1...X9
+ 247,  58,  14, 198, 130,   2, 243, 244, 117, 122, 169, 179, // .:......uz..
+  93,  34, 122, 174,   7, 177, 148,   6,  57,  77,  94, 164, // ]"z.....9M^.
+ 131, 233, 228, 237, 148,  25, 159,  50, 224,  21,  23, 218, // .......2....
+ 159, 203, 212, 154, 196,  17, 149, 218, 197,  48, 219,  87, // .........0.W
+ 146, 170, 168, 103, 212, 208, 152,   4, 116, 254,  58, 200, // ...g....t.:.
+ 215,  50,  40, 181, 226, 126, 210, 143,  91,  83,  98,  88, // .2(..~..[SbX
+ 167, 190, 139, 151,  33, 197, 134, 195, 225, 115,  40,  66, // ....!....s(B
+  95,  67, 125, 148, 104, 234, 186, 202, 250,  39, 254, 169, // _C}.h....'..
+ 202, 120, 185,  18, 133, 192,  93,  41, 202, 177,  56, 205, // .x....])..8.
+ 243, 177, 191, 190, 126, 121, 121, 217, 186, 220, 104, 165, // ....~yy...h.
+ 217, 201, 122, 183, 221, 110,  99, 107, 139, 218, 157, 122, // ..z..nck...z
+  85,  24, 172,  95,  97,  95, 204, 125, 121, 235, 159, 122, // U.._a_.}y..z
+ 235,  80, 171, 120, 101, 212, 228,  13,  73,  22, 247,  40, // .P.xe...I..(
+ 116, 226,  72, 225,  12,  91, 214, 228,   2, 213,   8, 184, // t.H..[......
+ 162,  38, 182,  31, 208,  49, 200, 107,  76, 173,  51, 175, // .&...1.kL.3.
+ 208, 221, 154, 215,  60,  60, 126,  69, 226, 215, 149, 249, // ....<<~E....
+  28, 166, 151,  73, 156, 134,  67, 243, 153, 165, 151, 251, // ...I..C.....
+  99,  97,  99, 233, 107, 144, 198, 149, 175, 140,  38, 155, // cac.k.....&.
+ 121,  29, 167,  99, 108, 251, 200,  23,  99, 134, 230, 197, // y..cl...c...
+ 109, 126,  78, 196,  34,   4,  52, 116, 185, 186, 205, 150, // m~N.".4t....
+  16,  14, 140, 142, 201, 117, 123, 187, 130, 245, 130,  48, // .....u{....0
+ 146, 230,  33,  21, 127, 176, 137, 121,  40,  48, 127, 146, // ..!....y(0..
+  19, 122,  31,  79, 115, 200,  18,  62,  79, 206,  74, 136, // .z.Os..>O.J.
+  42,  26,  21, 160,  81, 157,  98, 162, 146, 216,  81, 204, // *...Q.b...Q.
+ 185, 167,  21, 121, 190, 212,   6, 242, 146, 205,  98, 187, // ...y......b.
+  81, 231,  16, 161, 228, 175,   3,  33, 184, 107, 186, 194, // Q......!.k..
+ 102,  82, 144,  71, 255,   3, 226,  99, 138, 225, 160, 239, // fR.G...c....
+ 199, 132,  61, 134,  72,  22,   4, 141,  56,  13, 214, 168, // ..=.H...8...
+ 247, 205,  19, 205, 134,  20,  84, 182, 231,  89,  69, 196, // ......T..YE.
+ 185,  83, 192,  57,  34,  17, 103,  79, 157, 169, 125, 245, // .S.9".gO..}.
+  65,  61,  87,  79, 212,  83, 245,  76, 189,  87,  47, 213, // A=WO.S.L.W/.
+ 171,  64, 154, 135, 182,  21,  36,  55, 175, 114, 236,  94, // .@....$7.r.^
+  69, 233, 209, 235, 116, 183,  87,  99, 166, 186, 224, 209, // E...t.Wc....
+  68, 254, 140,  69, 254,  36, 145, 120, 106, 214, 124, 166, // D..E.$.xj.|.
+ 194, 135, 196,  12, 141,   3, 240,  33, 199, 180, 186, 140, // .......!....
+ 169, 221, 134,  52,  45,  14, 221,  43,  30, 119, 138, 131, // ...4-..+.w..
+ 216,  37, 194, 192,  89, 224, 208,  75, 158,  34, 133,  67, // .%..Y..K.".C
+ 168, 241, 106, 117, 245,  85, 171,   8, 105, 137, 138,  85, // ..ju.U..i..U
+ 237,   7,  84, 197,  43, 171,  40, 225,  53, 134,  86, 230, // ..T.+.(.5.V.
+ 131,  49,  86, 236,  67, 245,  33,  24, 247, 247, 251, 251, // .1V.C.!.....
+  82,  98, 139, 247, 149, 124,  68, 249,  34, 111,  15, 250, // Rb...|D."o..
+ 215,   1, 177,  22, 194, 177, 112,   0, 139,  24,  88, 192, // ......p...X.
+ 159, 251, 238,  89,  95,  34, 134,  65, 162,  47,  27, 175, // ...Y_".A./..
+ 220,  61, 245, 193, 243, 221, 106, 216,  46, 135, 169,  97, // .=....j....a
+  77, 120, 122, 165, 134, 166, 113, 193, 111, 158, 218,  95, // Mxz...q.o.._
+  93, 221, 111,  77, 166, 199, 238,  16, 233,  68, 185, 179, // ].oM.....D..
+  71, 111, 147,  60, 204, 177, 204, 152,  55, 166,  40, 195, // Go.<....7.(.
+  66, 223, 243,  65, 161,  13,   9, 137, 236, 167, 220,  26, // B..A........
+ 168,  75,  56, 232,  20,  10,   7, 122, 153,  28, 211, 139, // .K8....z....
+ 167, 206, 132,  11,   9,  56, 209, 132, 185,  25, 122,   6, // .....8....z.
+ 166, 208,  34, 126, 133,  32, 116, 162, 243, 103,  58, 139, // .."~. t..g:.
+  46, 244, 112,  31, 113,  47, 178, 244, 156,  21, 112,  69, // ..p.q/....pE
+  38, 155, 171,   8,  96, 101,   6, 191,  18,  89,  61, 150, // &...`e...Y=.
+  64, 117, 119,  65, 238, 158,  77,  12, 150, 203, 244,  85, // @uwA..M....U
+ 157, 219,  98,  57, 242, 130, 120, 148,  83, 175, 104, 245, // ..b9..x.S.h.
+ 151,  90,  37, 237,  30, 214, 217, 220,  61, 225, 183, 151, // .Z%.....=...
+ 133, 186, 149, 222,  86, 226, 159,  69, 195,  34,  19, 129, // ....V..E."..
+  79, 214, 236,  37, 241,  37, 197, 253, 166, 214, 237, 209, // O..%.%......
+  28,  57, 185, 163, 145, 239, 245,  64,  83,  30, 147, 242, // .9.....@S...
+  11, 145, 130,  61,  43, 104,  24, 160, 110,  11, 155, 156, // ...=+h..n...
+ 166, 211, 120, 184, 107, 115, 125,  28,  15, 121,  84, 152, // ..x.ks}..yT.
+ 160, 221,  17, 107,  97,  79, 229, 221, 222, 230,  12, 104, // ...kaO.....h
+ 198, 231,  11, 175, 212, 213,  92, 136,  58, 239, 130, 199, // ........:...
+ 119,  14,  17,   5, 127, 148,  65, 181, 142,  48, 241, 102, // w.....A..0.f
+  22, 243, 251, 153, 112, 227, 242, 190, 200,  20, 105, 163, // ....p.....i.
+ 214,  11, 192,  25, 169, 231, 196, 172,  62, 127, 204,  88, // ........>..X
+ 106, 185, 213, 231, 196, 173, 214,   6, 128, 226,  14, 158, // j...........
+  31,  18,  15, 105, 112,  89, 176, 219,  36,  47,  20, 131, // ...ipY..$/..
+  67, 175, 160, 252,  75,  65, 109,  97, 179,  52, 184,   2, // C...KAma.4..
+ 148, 187,  80, 163, 204,  95,  52, 173, 232, 150, 119, 179, // ..P.._4...w.
+  44, 173, 203, 164, 148, 122,   9,  17, 170,  62,  97,  75, // ,....z...>aK
+ 152,  66, 204,  18, 132, 215,   4,  77, 245, 132, 105,  96, // .B.....M..i`
+ 166, 158,   6, 109, 117,  38,   3, 178,  28, 238, 234, 201, // ...mu&......
+ 234, 234,  19, 200, 144, 227, 192, 210,  16,  59,  86, 170, // .........;V.
+ 156,  70, 166,  78,  79,  61,  35,  56,  63, 171, 195, 249, // .F.NO=#8?...
+ 217,  50,  56,  63, 171, 192,  89, 248,  42, 226, 220, 255, // .28?..Y.*...
+ 197,  58, 107,  13,  55, 188, 254,  80,  84, 167, 107, 107, // .:k.7..PT.kk
+  79,  31, 119, 183, 188, 122, 215,  44, 212, 105,  42, 241, // O.w..z.,.i*.
+ 230, 135, 217,  98,  98,  33, 251, 216, 101,  18, 147, 160, // ...bb!..e...
+ 212, 185, 120,  23,  84, 132,   6, 109, 229, 180,  28,  56, // ..x.T..m...8
+  74, 178, 159, 132,  99, 154,   0,  70,  48, 177, 163, 231, // J...c..F0...
+  30, 221,  29, 139, 241, 162, 162, 166,   1, 212, 128,  87, // ...........W
+ 238, 251,  64,  74,  27, 211, 122, 196, 171,  30, 205, 169, // ..@J..z.....
+ 215, 118, 194, 143, 161,  19, 233, 143, 205, 106,  81, 104, // .v.......jQh
+ 182, 198,  94, 255, 189, 127, 240, 254, 112, 201,  18,  75, // ..^.....p..K
+  13, 103, 201,  58,  47,  38,  10, 132, 145, 206, 131, 206, // .g.:/&......
+  93, 232, 172, 174,  13, 121, 125, 206, 240,   9, 100, 163, // ]....y}...d.
+ 163, 148, 217,  71,  50,  85,  69, 167,  53,  16, 137, 107, // ...G2UE.5..k
+  37,   8, 193, 194, 235,  86, 126, 170, 147, 114,  62,  79, // %....V~..r>O
+ 111, 131,  65, 191, 243, 160, 237, 211, 138, 220, 155, 178, // o.A.........
+ 160,  53,  45,   4, 173, 213, 213, 105,  77,  40, 243, 166, // .5-....iM(..
+  65,  61,  32,  60,   8,  73, 200,  35,   6, 238, 237, 200, // A= <.I.#....
+ 157, 122, 194, 109, 153,  89,  63,  21,  28,  65,  61,  47, // .z.m.Y?..A=/
+ 131, 208,  98, 214, 203, 102, 179, 231,  93, 186, 225, 193, // ..b..f..]...
+ 203,  67, 195,  64, 222,  65,  35, 122,  86, 241,   0,  49, // .C.@.A#zV..1
+  72, 138,  18, 240, 134, 144,  60,  75, 210, 212, 119, 231, // H.....<K..w.
+   9, 139,  41, 204, 243,  45,  23, 177, 168, 114, 181, 176, // ..)..-...r..
+  23, 230, 166, 186,  61,  72, 236,  13, 101,  23, 188,  61, // ....=H..e..=
+  46, 152, 136, 189,  10, 115, 227,   8, 207, 188, 215,  79, // .....s.....O
+ 131,  47, 113, 213, 190, 115,  30,  18,  83, 124, 103, 194, // ./q..s..S|g.
+ 206, 163,  71, 219, 235, 123, 148, 132, 127, 246,  94,  59, // ..G..{....^;
+ 126,  74, 235, 248,  93,  73,  31, 173,  95, 241, 110, 174, // ~J..]I.._.n.
+  85, 240, 132,  50, 128,  35, 232, 134,  31,  23, 192,  29, // U..2.#......
+ 137, 138, 220,  61,   9, 194, 131,  17,  43, 130, 171,  92, // ...=....+...
+  41, 184, 159, 147, 128, 120, 173,  61,  66, 158, 189, 254, // )....x.=B...
+  73,  43,  78,   7,  97,  12, 134, 158,  26, 233, 111,   4, // I+N.a.....o.
+  16, 138, 173, 128,  77, 180,  56,  56,  81,  40,  69,  52, // ....M.88Q(E4
+  97, 162,  61, 159,  21, 124, 167, 174, 108,  29, 237,  89, // a.=..|..l..Y
+ 198, 110,  72, 130,  16, 182, 254,  90, 178,  55,  13, 249, // .nH....Z.7..
+  14, 155, 150, 238,  49, 246,  72, 230,  34, 159, 199,  26, // ....1.H."...
+  95, 111, 246, 221, 148, 216, 201, 227,  86,  68, 107, 220, // _o......VDk.
+  49,  77,  48, 106,  26,   6, 254,  28, 218,  48, 122,  16, // 1M0j.....0z.
+  39,  29,  98, 218,  97,  49,   9,  11, 157, 147, 209,  13, // '.b.a1......
+ 238, 121, 215, 244, 123, 124, 123,  59, 197,  46,  41,  77, // .y..{|{;..)M
+ 211,  80,  62,  93, 243, 113,  92, 174, 198,  33, 208, 198, // .P>].q...!..
+ 236,  80, 154, 173,  51,  52, 109, 226, 149, 195,  13,  37, // .P..34m....%
+ 208, 202, 212, 210, 137, 144, 197, 204, 107, 108,  22,  11, // ........kl..
+ 144,  73,  18, 179, 128, 156,  84, 225, 125, 125,  64, 224, // .I....T.}}@.
+ 174,  70,   2, 242, 188,   1, 115,  72,   0, 101,  94, 145, // .F....sH.e^.
+ 213, 247,  35, 200,  37, 215,  24, 158, 147, 224, 154, 210, // ..#.%.......
+  40, 199,  82,   6, 194, 145,  81,  69, 152,  26, 194, 200, // (.R...QE....
+  37,  75, 167, 147, 248, 122,  95, 231, 175,  18, 146, 232, // %K...z_.....
+  94, 126,  32, 252,  64, 170,  97, 112,  82,  36,  92, 145, // ^~ .@.apR$..
+  34, 143,  69, 199, 231, 112,  77,  72,   4,  49,  74, 118, // ".E..pMH.1Jv
+  70, 127, 226,  32, 164,  33,  57, 117, 112, 170,   7, 103, // F.. .!9up..g
+ 122,  88,  79, 177, 107,   2, 185,  28,  16, 231,  40, 161, // zXO.k.....(.
+ 230,  66,  23,  96,  84,  88,  39,  42, 245, 102,  69, 243, // .B.`TX'*.fE.
+ 143, 189, 147, 224, 120, 161, 237, 253, 211, 224, 196, 255, // ....x.......
+  82, 179, 251,  99,  36,  40,  26, 216,  63, 199, 103, 165, // R..c$(..?.g.
+  61, 253,  35,  10, 152,  46, 221, 161,  56, 185, 189,   5, // =.#.....8...
+ 176, 104,  92, 233,  77, 218, 117, 162,  24, 124, 169,  39, // .h..M.u..|.'
+ 234,  89, 104, 202, 160,  81,   6, 161, 164,  25,  18,   8, // .Yh..Q......
+  19, 139, 215, 219, 219,  74, 160,  38,  50, 101, 154, 228, // .....J.&2e..
+  49, 134,  20, 159, 129,  77, 229,  25, 242, 115, 112,  88, // 1....M...spX
+ 192,  88, 246,  25, 203, 164, 208,  85, 200,  10, 112, 234, // .X.....U..p.
+ 245,  79, 253, 131,  83,  75, 205,  33, 211, 146, 224, 155, // .O..SK.!....
+ 136,  73,  14, 207, 250,  47,  79, 100,  95, 104,  80, 216, // .I.../Od_hP.
+  15,  15, 218, 135,  62,  19, 175, 213, 213, 123, 110, 172, // ....>....{n.
+ 218,  30,  19,  38,  85,  69, 195,  81,  73,  63,  71, 150, // ...&UE.QI?G.
+ 126,  18, 150, 245, 168, 239,  20, 103,  32, 171,  32, 231, // ~......g . .
+ 156, 100, 122,  50,  65, 245, 118,  49,  58,  95,  34, 175, // .dz2A.v1:_".
+ 154,  12, 149, 157, 149, 243, 219, 219, 115,   0, 137,  74, // ........s..J
+ 165,  30, 151,   5, 173,   4, 123,  20,   3, 157, 158, 147, // ......{.....
+ 142, 205, 200, 236,  73,  90,  12, 130, 103, 199, 228, 220, // ....IZ..g...
+ 142,   9,  77, 150,  98, 100,  85,  33,   6,  30, 173, 174, // ..M.bdU!....
+  30, 173, 216, 226,  37, 199, 145, 205, 225,  21, 123, 114, // ....%.....{r
+  51, 215,  44,   2,  21,  26, 141, 213, 209,  72, 176,  44, // 3.,......H.,
+   3,  14, 163, 209,  72,  15, 141,  24, 168,  32,  68, 242, // ....H.... D.
+  26, 214, 151, 170, 252, 138, 182, 238, 189, 213, 160, 217, // ............
+ 109, 235, 132, 166, 113, 242, 216, 110, 173, 245,  18, 154, // m...q..n....
+ 187,  47, 221, 248,  32,  57,  84, 241, 193, 218,  90, 241, // ./.. 9T...Z.
+ 240, 120, 225,  25,   8, 253,  25,  16, 253, 209, 208, 209, // .x..........
+ 212,  89,  85, 108, 178,  67, 191, 192, 235, 203,  41, 163, // .YUl.C....).
+  13,  75,  84,  75, 244, 124,  90, 104,  14,  24, 218,  69, // .KTK.|Zh...E
+ 157,  58, 175,  99,  36, 130,  87, 182, 156,  95, 218, 102, // .:.c$.W.._.f
+  27,  65, 118, 217,  14, 185, 177, 242,   8, 150, 238, 158, // .Av.........
+  19,  52, 122,   9, 232,  33, 189, 144,  48, 147,  88,  68, // .4z..!..0.XD
+ 200,  25, 235,  41,  48, 128, 194, 194, 172, 168, 218, 238, // ...)0.......
+  38,   4, 249,  82, 141, 127, 217, 174, 223, 108, 187, 172, // &..R.....l..
+ 250, 211, 216,  21,  88, 121,  85, 210,  23, 201,  95, 205, // ....XyU..._.
+ 219, 163, 208,  96, 246, 242, 160,  88,   5, 120, 135, 188, // ...`...X.x..
+  88,  18, 236, 139,  89,  20,  60, 133,  38, 200,   8, 176, // X...Y.<.&...
+ 154,  84, 165, 216, 240,  93, 166, 170, 241, 250, 232, 157, // .T...]......
+ 207, 218,  99, 222, 113,  21,  61,  55, 239, 170,  79, 240, // ..c.q.=7..O.
+ 243,  12,  35,  24, 184,  43, 208,  20,  82, 172, 199,  51, // ..#..+..R..3
+ 124, 207, 125,  45, 228, 237,   0, 202, 133,  20, 148, 255, // |.}-........
+ 130,   6, 163, 182, 107, 206,  57, 250,   7, 241, 161, 159, // ....k.9.....
+  74,  29, 121, 107,  20, 101,  19,  97,  47, 173, 177,  75, // J.yk.e.a/..K
+  94,  93,  74, 236, 222, 186, 228, 140,  41,  31, 118,  74, // ^]J.....).vJ
+ 116,  45,  35,  33,  54, 173,  57, 216,  64, 215, 244,  82, // t-#!6.9.@..R
+ 194, 235, 103, 209,  45,  27, 227,  55,  88, 150, 228, 129, // ..g.-..7X...
+  67, 143,  93, 103, 237, 124, 109,  13,  22,  40,  90,  17, // C.]g.|m..(Z.
+  79,  59, 129,  37, 159,  63, 103, 125,  54, 111,  16,   2, // O;.%.?g}6o..
+ 100,  83,  36,  25,  94,  68, 195,  90, 226, 114,  95, 190, // dS$.^D.Z.r_.
+  58, 134, 115,  28,  51,  97,  73, 204,  74,   9,  34, 226, // :.s.3aI.J.".
+ 138, 128, 126,  51, 243, 160,  69,  67,  82, 181,  44, 125, // ..~3..ECR.,}
+  80,  17, 116, 138,  61,  25, 107, 117, 178, 184, 179,  84, // P.t.=.ku...T
+  77,  30, 203, 122,  46, 137, 151, 202, 163,  53, 195, 194, // M..z.....5..
+ 210, 172,  69,  86,  85,  16,  20, 121, 195, 224, 211,  44, // ..EVU..y...,
+ 127,  30,  14,  78, 231, 230,  30,  75,  78, 109,   5, 203, // ...N...KNm..
+  17, 154, 100, 166, 166, 233, 113, 173, 220,  24,  42,  86, // ..d...q...*V
+ 122, 233, 137,  65, 162,  94, 218, 238, 158, 254, 122, 119, // z..A.^....zw
+ 208,  12, 177, 100, 116, 177, 127,   5,  54,  85, 248,  13, // ...dt...6U..
+ 204, 112,  85,  49, 216, 153, 149, 155,  12, 118, 152, 192, // .pU1.....v..
+ 196, 199,  45,  59, 194,  85,  61,  84,  16, 207, 178, 224, // ..-;.U=T....
+  72, 180, 199,  42,   2, 110, 104, 127, 113,  95, 218,  18, // H..*.nh.q_..
+  57, 222, 155, 238, 137, 181,  69, 143, 121,  65, 187,  19, // 9.....E.yA..
+  72,  66,  16, 208, 209,  42, 200, 220,  44,  72, 107, 202, // HB...*..,Hk.
+  57, 203, 248, 100, 203, 212,  21, 108,  64, 201,  27, 145, // 9..d...l@...
+ 196,  80, 114, 168, 123, 119,  58, 222, 203, 136, 120, 155, // .Pr.{w:...x.
+ 112, 104, 215, 177, 180,  38,   3, 239, 130, 212, 200, 190, // ph...&......
+ 230, 124,  40, 117,  41, 185, 189, 133,  26, 171,  40,  33, // .|(u).....(!
+  42, 246, 167,  89, 224,  73,  13, 165, 202, 193, 163, 230, // *..Y.I......
+  51, 177, 219, 212, 179,  25,  77, 250, 182, 218, 173, 168, // 3.....M.....
+ 246, 108,  83, 231, 172,  53, 197, 132,  41,  54,  18,  28, // .lS..5..)6..
+ 163,   4,  43, 189, 236,  27, 212, 150, 140,  39, 200, 219, // ..+......'..
+ 183, 161, 190, 125,  17, 125,  86, 153, 226,  46,  11,  55, // ...}.}V....7
+  87,  19, 161, 229, 180,  96,  44,  10, 220,  37, 208,  80, // W....`,..%.P
+ 228,  49,  45, 244, 218, 194,  70,  23, 117,  67, 169, 146, // .1-...F.uC..
+ 219,  47, 146, 198,  89, 218,  35, 242, 183, 207, 250,  96, // ./..Y.#....`
+  34, 218, 181, 254, 209, 152,  15, 244,  93,  19, 197,  20, // ".......]...
+  38, 175,  60,   9, 202, 106,  78, 237, 150, 211,  29,   5, // &.<..jN.....
+  27, 181, 227, 107, 161, 160, 131, 101, 132, 151, 240, 246, // ...k...e....
+  60, 154, 232, 190, 121,  86,  50,  67, 186, 108,  29, 147, // <...yV2C.l..
+  76, 232, 218,  56, 226,  36, 210, 248,  66, 147,  44, 238, // L..8.$..B.,.
+ 211, 144, 124, 136, 206, 117,  58, 205, 137,  81, 184, 131, // ..|..u:..Q..
+ 140,  81, 203, 161, 234, 109, 230, 246, 109, 166, 140,  49, // .Q...m..m..1
+ 142,  26,   7, 235, 238,  59, 177,  14, 223,  13, 199, 148, // .....;......
+  94, 123, 247, 110, 205, 219, 189, 245,   8, 166,  50, 234, // ^{.n......2.
+  52, 120, 234,  66,  90,  56, 193, 147, 152, 169, 115,  90, // 4x.BZ8....sZ
+ 246,  49, 228,  31, 213,  39, 245,  66, 189,  81, 111, 239, // .1...'.B.Qo.
+ 178, 234, 232,  97, 119, 200, 216, 218, 136, 113,  96, 167, // ...aw....q`.
+  87,  49, 175, 192,  70,  41,  39, 140,  96,  12, 177, 182, // W1..F)'.`...
+ 118, 168, 196, 220, 134, 228,  79, 202, 119,  27,  68, 253, // v.....O.w.D.
+ 142, 223, 197, 166,  19,  71,  30, 122, 126,  78, 236,  68, // .....G.z~N.D
+ 118, 216,  35, 185,  10,  54, 151,  40,  59, 244,  55, 205, // v.#..6.(;.7.
+  71, 231,  48,  48, 198, 219, 225,   4,  54, 175,  46, 130, // G.00....6...
+ 128, 246,  36, 237, 248,  91, 156, 136, 131,   2,  27,  78, // ..$..[.....N
+  68, 152, 139,  67,  33,  15, 138,  66, 108, 224,  90,  16, // D..C!..Bl.Z.
+ 174,  57, 142,  79, 153,  82, 136,  34, 227, 113, 124,  77, // .9.O.R.".q|M
+  43, 204,  91, 182, 131, 164,  69, 206, 113,  24, 211,  14, // +.[...E.q...
+ 121,  75, 150, 135, 158,  24,  53, 240, 157, 125, 105, 122, // yK....5..}iz
+ 215, 167,  62, 100, 205,  46, 245,  94, 161,  75,   1, 113, // ..>d...^.K.q
+ 101, 190,  73,  25,  22, 252,  25, 145, 245,  95, 121, 101, // e.I......_ye
+ 216,  11, 199, 234, 187, 192, 157,  95,  88, 242, 224,  87, // ......._X..W
+ 144,   4, 193, 168,  98, 137, 161, 245,  36,  47, 114, 253, // ....b...$/r.
+ 138,  57, 233, 202,  90,  66, 141, 161, 152, 183, 230, 139, // .9..ZB......
+ 115, 106, 112, 230,  57, 167, 161, 161, 169, 225, 180,  29, // sjp.9.......
+  20, 177,  83, 239,  16,  67,  64, 157, 202, 240,  19,   5, // ..S..C@.....
+ 212,   7,  26, 139, 106, 106, 168,  56, 121, 179, 145,  37, // ....jj.8y..%
+ 234, 180, 220, 190, 250, 183, 223,  39, 247, 127,  79, 232, // .......'..O.
+ 231, 214, 190, 220,  91,  63, 193, 206, 162, 231, 245,  35, // ....[?.....#
+ 233,  48,  77,  20, 226,  74,  33,  14, 219,  34,  82, 175, // .0M..J!.."R.
+ 239, 154, 200,  13, 142, 164,  22, 116,  61, 191,  43,  41, // .......t=.+)
+ 156,  86, 171,  69, 243,   2,  70, 156, 218, 150, 177,  73, // .V.E..F....I
+ 201, 218,  69,  10, 138,  89,  41, 162, 182,  84,  91, 209, // ..E..Y)..T[.
+ 100, 164,  26, 146, 157,  96,  11, 230, 126, 196, 126, 172, // d....`..~.~.
+ 208, 220, 196, 168,  39,  30, 139, 191, 156,  48, 161, 132, // ....'....0..
+  41, 104,  71,  18,  60,  96, 154,  81,  70,  80, 225,  54, // )hG.<`.QFP.6
+ 194,  99,  72, 204, 104, 166, 182, 123,  19, 146,  81,  13, // .cH.h..{..Q.
+ 178,  78, 128, 172, 208, 201,  27,  72, 132, 196,   9, 134, // .N.....H....
+ 176,  69,  41, 176, 123,  74,  25, 166, 143, 245, 193, 228, // .E).{J......
+ 208, 230, 153,  82,  30,  90, 254,  40, 228,  96, 122, 168, // ...R.Z.(.`z.
+  56,  99, 223, 121, 140, 174, 229, 125,  23,   5,  16, 164, // 8c.y...}....
+ 163,  67, 170, 117, 195, 243, 211, 181,  32, 103, 100, 166, // .C.u.... gd.
+  36, 205, 166, 233, 190, 179,  99,  18, 219,   1, 162, 116, // $.....c....t
+  65, 190, 150,  66, 192, 201, 250, 196, 252,   5,  89,  31, // A..B......Y.
+  67,  38, 185, 255, 233, 252,  51, 144,  29, 212, 127,  74, // C&....3....J
+ 182, 140,   2, 139,  34,  80,  31,  21,  67,  80, 130, 236, // ...."P..CP..
+  17,  20,   5, 111, 169,  56,  72,  77, 225, 206,  58,   7, // ...o.8HM..:.
+  67,   7, 248, 120, 139, 202, 225, 188, 210, 254, 181, 206, // C..x........
+ 161,  39, 133, 216, 113, 140, 130, 136, 218, 129,  66,  35, // .'..q.....B#
+ 101,  63,   4, 158,  93, 130, 102, 130,   8,  26,  49, 167, // e?..].f...1.
+ 225, 152,  70, 253, 255, 236, 203, 239,  73, 241, 150, 213, // ..F.....I...
+  26, 215,  21,  48,  20,  85,  56,  43,   5,  36, 168, 161, // ...0.U8+.$..
+ 155, 202,  84,  98, 167,  15,  67, 112,  38, 251, 252,  52, // ..Tb..Cp&..4
+  24, 133, 149, 244,   1,  77,  75, 107, 130, 216, 233, 231, // .....MKk....
+  62, 166, 228, 204,  19,  10, 186, 231, 169, 159, 104,  78, // >.........hN
+ 254,   0,  50, 252,  61,  53, 252, 207, 224, 123,  16,  68, // ..2.=5...{.D
+ 245,  11,  63,  51, 245,  35,  61,  69,  34,  82,  90, 115, // ..?3.#=E"RZs
+ 216,  64, 233, 156,  94, 140,  29, 145, 210,  49, 135, 150, // .@..^....1..
+  70, 233, 218,  80,  91, 132, 210,  10, 204,  15, 247,  19, // F..P[.......
+  97, 212,  79,  96, 142,  81, 155,  57, 128, 241, 137,  98, // a.O`.Q.9...b
+  94, 210, 244, 225,  39, 184,  14, 159, 218,  64, 137, 233, // ^...'....@..
+  49,  43, 102, 183, 222,  97,  85,  91, 161, 159, 228,  15, // 1+f..aU[....
+   6,  42,  22, 112, 124,  17, 131,  93,  50, 185,  58, 173, // .*.p|..]2.:.
+ 114, 185, 212, 148, 143, 196, 218, 110, 120, 189, 149, 239, // r......nx...
+ 101,   5, 214,  99, 150,   0,  95,  82,  26,  88, 145, 136, // e..c.._R.X..
+ 153,  94, 220,  34, 130, 171, 184,  25, 229, 210, 133, 125, // .^.".......}
+ 212, 178, 216, 172, 178, 143, 250,  19, 161, 136, 142, 220, // ............
+   5, 174, 244, 198,   8,  58,  62,  56,   5, 130, 121,  37, // .....:>8..y%
+ 123, 180, 164,  85, 165,  33, 200, 178,  70, 185, 210, 185, // {..U.!..F...
+ 151,  48, 149,  97, 217,  79,  75,  64, 165, 208, 176,  36, // .0.a.OK@...$
+ 139, 159,  44,  59, 119, 160, 101,  59, 177, 168, 229,  81, // ..,;w.e;...Q
+ 197, 220, 100,   0,  99, 237, 190, 221, 120, 102, 249,  71, // ..d.c...xf.G
+ 106,  35, 106, 145, 243, 214, 223,  39, 160,  78, 149,   3, // j#j....'.N..
+  22, 115, 181,  74, 165,  19, 183, 164, 148, 186, 167, 131, // .s.J........
+  31,  74, 187, 100, 214, 252, 178, 129,  49,  30,  47, 101, // .J.d....1./e
+ 127, 188,   0, 170, 229, 158, 245, 192,  83,  75,  66,  71, // ........SKBG
+ 149,  80,  40, 255,  75,   6, 172,  18, 170, 190, 103, 185, // .P(.K.....g.
+  49, 231, 164, 144, 106,  25,  87, 107, 116, 249, 147, 232, // 1...j.Wkt...
+ 135, 255,  92,  93, 253,  19,  92,  49, 231, 152,  99,   3, // ...]...1..c.
+ 180, 104, 119, 207, 204,  67,  84, 129, 220, 244, 243, 160, // .hw..CT.....
+   8, 161, 230,  16, 183, 173,  99, 177, 161, 225,  98, 178, // ......c...b.
+  90,  69, 191, 172, 174, 254,   2, 254, 230, 163, 193, 231, // ZE..........
+  60, 112,  63, 177, 169,  39, 239, 204, 190, 236, 129, 104, // <p?..'.....h
+ 188, 160, 185, 250,  73, 180, 199, 220, 252,  79, 246,   5, // ....I....O..
+  33, 119, 202,  19, 111, 236,  22,  21, 127,   0,  46, 145, // !w..o.......
+ 188,  90, 251,  52, 207, 108, 238, 214, 129, 154,  47,   0, // .Z.4.l..../.
+ 180, 168, 151, 218,  72,   3, 251,  34, 248, 132, 142, 200, // ....H.."....
+ 108, 174, 245, 229, 199, 213, 213,  31, 171, 226,   9, 117, // l..........u
+ 162, 151,  11, 120,  94, 130, 197,  43, 134, 203, 206,  66, // ...x^..+...B
+  23,  54, 172,  63,  88, 230, 113, 117, 245,  13, 117, 244, // .6.?X.qu..u.
+ 123,  90,   3, 255, 156, 234,  73, 254,  36, 137, 206,  67, // {Z....I.$..C
+  20, 253,  34,  35, 105, 151,  38, 184, 251, 230, 174,  72, // .."#i.&....H
+  90, 141,  23, 214, 120, 194, 221, 202, 212,  26, 196,  58, // Z...x......:
+ 204,  12,  67,   7, 115, 116,  61,  93,  93,  29, 132, 201, // ..C.st=]]...
+  64, 199, 245, 146, 192, 195, 150, 172,  31,  15, 125,  18, // @.........}.
+  84,   2,  98, 213, 105, 183, 189,  30, 178,  19,  79, 176, // T.b.i.....O.
+ 180,  49,  60, 229,  61,  87,  79,  60,   1, 221, 203, 187, // .1<.=WO<....
+   7,  41,  50,  67, 244,  18,  74,  63,  25, 161,  98, 108, // .)2C..J?..bl
+   0, 103,  35, 118,  50, 185, 156, 195, 190, 124,  81, 129, // .g#v2....|Q.
+  99,  39, 202, 226,  36,  57,  13,  76, 120,  20,  19,  67, // c'..$9.Lx..C
+  90, 203,  36, 179, 154, 143,  42, 220, 222, 234, 145, 136, // Z.$...*.....
+ 159,  50, 107, 226, 165, 181, 104, 161, 199, 174,  54,  88, // .2k...h...6X
+ 129, 253, 207, 188, 156,  84, 113,  49, 169, 168, 106, 156, // .....Tq1..j.
+   9, 210,   5, 234,  79, 231,  37,  81, 148,  70, 248, 193, // ....O.%Q.F..
+ 252,  84, 207,  14, 154, 160, 141,  81, 147, 188,  52, 164, // .T.....Q..4.
+ 229,  78,  24, 114, 159,   7, 104, 117, 161,  20,  34, 204, // .N.r..hu..".
+ 155, 205,  44, 217,  51, 231,  25, 114,  89,  64, 216,  30, // ..,.3..rY@..
+  81, 118, 137, 103,  92, 161, 158,  46,  19,  25, 150,  14, // Qv.g........
+ 107, 101, 101,  26,  84,  40, 102, 209, 226, 101,  58,  31, // kee.T(f..e:.
+   3, 166, 129, 109,  70,  76, 146, 133, 250,  84,  61, 220, // ...mFL...T=.
+ 194,  16, 183, 101, 245,  36,  49, 126, 221, 249, 116, 227, // ...e.$1~..t.
+ 170, 236, 177,  66, 211, 193, 114,  80, 108, 187,  34, 175, // ...B..rPl.".
+ 208,  41, 205, 169, 255, 170, 122,  48, 214, 107, 198, 135, // .)....z0.k..
+ 230,  28,  37, 205,  93, 156, 186,  42,  42,  56, 253, 203, // ..%.]..**8..
+ 135, 192, 244, 201, 156,  60, 148, 133, 201,  25, 137,  33, // .....<.....!
+ 120, 144, 136,  33, 223,  59, 230, 187, 137,   0, 222, 127, // x..!.;......
+  35, 113, 137, 159, 149, 130, 206, 231,  10, 226, 248,   0, // #q..........
+ 244,  25, 121,   3, 109, 150,  18, 179,  21, 208, 111, 251, // ..y.m.....o.
+ 250, 194, 181, 129, 227,  48,  63, 245,  90, 231,  33,   1, // .....0?.Z.!.
+ 232, 200, 107, 125,  34, 153, 203, 133, 238, 219,  68,  87, // ..k}".....DW
+  42, 185, 168, 157,  73,  42,  24, 109, 247, 223, 126,  95, // *...I*.m..~_
+  95, 187, 165, 255, 247,  60,  97, 176,  91, 147, 113,  28, // _....<a.[.q.
+ 229,  46, 241, 108, 213, 165, 247, 168, 204, 237, 248,  14, // ...l........
+  20,  58, 240, 242, 240,  36, 119, 219,  94, 191, 179, 230, // .:...$w.^...
+ 220,  95, 235,  59, 197, 246,  98,  17, 103, 199, 168, 217, // ._.;..b.g...
+ 241, 136,  68, 109, 250,  91,   2, 121, 222, 171, 161,  14, // ..Dm.[.y....
+  66,  15, 203, 166,   0, 250,  82, 150,  27, 189,  23, 220, // B.....R.....
+  76, 179, 216, 215, 175,  93, 154,  49, 250,  44, 248, 217, // L....].1.,..
+ 213, 123,  94, 101, 144,  94, 219,  99,  62, 246,  84, 146, // .{^e.^.c>.T.
+ 179, 230,  66, 124, 191, 164,  89, 116, 201, 187, 100,  72, // ..B|..Yt..dH
+ 215, 175, 188, 251,  38,  14, 202,  48, 225,  43,  94,  87, // ....&..0.+^W
+  82,  45, 134, 186, 196,  90,  78, 157,  29, 139, 193,  54, // R-...ZN....6
+ 109,  89, 220, 181, 199,  32,  79, 152,  38,  19, 184, 214, // mY... O.&...
+  96, 200,  72, 196, 117, 112, 202, 159,  21, 144, 237, 214, // `.H.up......
+ 196,  33, 236, 188, 203,  89,  25, 125,  85,  61,  40, 163, // .!...Y.}U=(.
+ 175,   8, 187,  90,  25,  17,  87, 253,  33, 229, 131,  81, // ...Z..W.!..Q
+  68,  88,  73,  28,  46, 228, 178,  74, 137, 247, 204, 150, // DXI....J....
+ 241,  10,  64, 156, 103, 241,  15, 250,  26,  19,   1,  14, // ..@.g.......
+  54, 204, 107,  24, 231, 230, 141, 249,   9, 243, 126,  60, // 6.k.......~<
+ 205, 243,  52, 241, 236,  68,  35, 209, 159, 184,  90, 157, // ..4..D#...Z.
+ 195, 158,  23, 138, 235, 144, 185, 229, 114, 147,  17,  75, // ........r..K
+ 214,  73, 213,  72,  78, 172,   3,  61, 179,  93, 125,  26, // .I.HN..=.]}.
+  78,  42,  81, 216, 191, 107,  38, 236, 125, 193,  97,  91, // N*Q..k&.}.a[
+ 148, 122, 180, 141, 177,  54, 110,  84, 194, 252,  25, 100, // .z...6nT...d
+  48,  58, 213, 234, 138,   5,  76,  78, 240,   4, 122, 105, // 0:....LN..zi
+  99, 248,  96,  71,  61,  66, 122,  37, 198, 167,  25,  54, // c.`G=Bz%...6
+  17, 207, 153,  38, 146,  44, 185, 190, 206, 167, 201,  86, // ...&.,.....V
+ 162, 219, 219, 168,   8,  61, 234,  79, 116,  60, 186, 183, // .....=.Ot<..
+  30, 121, 197, 209, 142,  98, 155, 133,  13, 167, 121,  47, // .y...b....y/
+ 211, 218, 198, 218, 141,  46,  44, 123,  30,  32,  68, 136, // ......,{. D.
+ 202, 137,  10, 115,  76, 182,  68, 165, 208, 242,  24,  65, // ...sL.D....A
+  29,   1, 202, 113, 207, 177,  53, 132, 174,  95,  29, 228, // ...q..5.._..
+ 135,  45,  90, 135, 223,  99, 248,  33, 113,  24, 250, 214, // .-Z..c.!q...
+  54, 163, 191, 210, 153,  49,  99, 128,  67,  84,  36,  75, // 6....1c.CT$K
+ 197, 125, 199, 212,  69, 115,  16,  92, 131, 163,   4, 189, // .}..Es......
+  15, 210, 195,  62, 255, 210, 218,  94, 197,  95, 146, 216, // ...>...^._..
+ 243,  52, 187,  94,  93,  53,  47,   7, 233, 154, 195, 154, // .4.^]5/.....
+  54, 231, 112,  89, 152,  91,  57, 208,   3, 245, 215, 174, // 6.pY.[9.....
+  28, 190, 202, 189, 242, 200,  33, 101,  25, 191,  58,  63, // ......!e..:?
+ 215, 195, 136, 114, 192, 168,  41,  60, 225, 137, 129,  65, // ...r..)<...A
+ 188,  43, 206, 229, 125,  25, 138,  92, 146, 126,  62, 217, // .+..}....~>.
+  56,  99, 147, 199, 103,  66, 234,  40, 136,  64,  32,  70, // 8c..gB.(.@ F
+  39, 128, 110, 121, 190, 150, 218, 197, 132,  96, 159,   6, // '.ny.....`..
+ 169,  71, 196, 123, 110, 141,  46,  58, 238,  18, 109,  41, // .G.{n..:..m)
+  62, 189, 138,  54, 208,  80,  26,  12,  24,  77,  17,  16, // >..6.P...M..
+  28, 146, 229,  10, 229, 152,  88, 251, 169, 155, 165, 202, // ......X.....
+ 110, 127,   9,   3, 209, 102,  37,  55,  74, 142,   6, 152, // n....f%7J...
+ 114,  84, 172,  85,  79,  10, 157, 150, 122,  90, 105, 178, // rT.UO...zZi.
+ 203, 190,  17, 234, 145,  54, 116, 166,  44,  50, 248, 139, // .....6t.,2..
+  74, 155, 231, 110,  37, 135,  85,  81,  23, 116, 162, 180, // J..n%.UQ.t..
+ 228, 100, 221,  63, 111, 135, 205, 148, 161,  43, 254, 130, // .d.?o....+..
+ 214, 177, 208,  14,  11,  24, 102, 150, 107, 149, 253, 128, // ......f.k...
+  18,  35, 107,  59,  16,  99, 154, 223, 120,  86, 244, 153, // .#k;.c..xV..
+  46, 140, 225, 213, 162, 117, 158,  95,  97,  62,  37,  47, // .....u._a>%/
+  17, 181,  74,  66, 107, 134,  87,  77, 199,   3, 202,  45, // ..JBk.WM...-
+ 232, 233, 125, 108, 130, 237, 179,  54, 244, 242, 246, 118, // ..}l...6...v
+ 193, 180,  26,  70, 187,  60, 140, 149, 211, 249,  52, 238, // ...F.<....4.
+  68, 114, 105,  36, 193, 146,  45, 230,  24, 196, 209, 224, // Dri$..-.....
+ 140,  38, 204,  61,  96, 246, 149,  97, 186, 161,   1, 227, // .&.=`..a....
+  57,  36, 176, 157,   6,  88,  58,  56,  75, 109,  15, 209, // 9$...X:8Km..
+  24, 247,  22, 171,  10, 193, 129, 152,  21,  75, 180, 177, // .........K..
+  10, 197, 243, 171,  66,  92,  93,  21,  60,  48, 180,  22, // ....B.].<0..
+  12, 157,  57, 120, 153,  29, 138,  42,  36, 150,  29,  18, // ..9x...*$...
+ 225, 246,  25, 205,  48, 246,  11, 169,  15,  88, 169, 105, // ....0....X.i
+  13, 167,  55, 187, 244,  74, 135,  58, 222, 124,  21, 115, // ..7..J.:.|.s
+ 120, 123, 231, 152, 220, 157, 144,  90, 125,  50, 183, 159, // x{.....Z}2..
+  69,  11, 175, 101, 169, 245, 185,  39,  39,  50, 245,  73, // E..e...''2.I
+ 169, 185,  50, 203,  93, 117, 181,  51, 251, 161,  96, 171, // ..2.]u.3..`.
+ 136, 158, 213, 245, 187, 197,  22, 100, 176, 238, 246, 253, // .......d....
+ 223, 251, 238, 193, 191, 253, 253, 240, 190, 231, 245, 221, // ............
+ 191, 183, 238, 123, 253, 123, 235, 188,  22,   8, 245,  78, // ...{.{.....N
+  65, 255, 137, 127,  51, 148,  30,  71,   4, 108, 173,  97, // A...3..G.l.a
+ 128,  79, 203, 197, 172, 210,  74,  33,  42, 183, 176, 166, // .O....J!*...
+ 114,  19, 205,  90,   8, 173, 154,  73,  25,  96, 225,  56, // r..Z...I.`.8
+  24, 106, 184, 149, 248, 248, 254,  85,  49, 231, 221,  41, // .j.....U1..)
+ 148,  67, 135, 193, 178,  24, 115,  84, 160,  99,  25, 175, // .C....sT.c..
+   0,  67,  77,  96,   1, 123, 102,  57, 172, 148, 181, 150, // .CM`.{f9....
+ 180,  56,  80, 104, 206, 216,  80,   0, 104,  16, 192, 162, // .8Ph..P.h...
+ 136, 186, 116,  85, 176,  74, 170,  56, 207, 103, 172,  89, // ..tU.J.8.g.Y
+   6, 214,  86,  40, 231,  61, 121, 102, 190,   2, 188, 151, // ..V(.=yf....
+  12, 152,  49, 252, 150, 208,  10,  99, 231, 223,  30, 172, // ..1....c....
+ 221, 239,  31,  22, 156, 157,  26,   6,  92, 138,  93,   1, // ..........].
+  77, 236,  58,  45, 219, 122, 232,  65, 193,  76, 173,  83, // M.:-.z.A.L.S
+ 167, 193, 255,  61,  44, 240, 201,  89, 115, 160, 160, 175, // ...=,..Ys...
+ 134, 220, 119, 160, 170, 135, 133,   0, 146,  99,   4,  86, // ..w......c.V
+  72, 240,  95, 193, 105, 157, 246,  78,  37,  93,  31, 236, // H._.i..N%]..
+ 192,  41,  53,  46,   1, 137,  22, 179,  36, 156, 162,  59, // .)5.....$..;
+  24,  47, 133, 229, 185, 167, 104, 174, 156,  16,  75, 128, // ./....h...K.
+   4, 218,  64, 118,  36, 172, 237,  98, 122,  11, 113, 226, // ..@v$..bz.q.
+  82, 173, 201,  83,  97,  85,  79,  77,  51,  54,  12, 181, // R..SaUOM36..
+ 202, 141, 113, 194,  10, 175, 239, 150, 153, 198, 185, 129, // ..q.........
+  21, 209, 231,  70,  51, 156, 213, 169, 176, 213, 246, 131, // ...F3.......
+  25,  10, 235,  37, 229, 128,  16, 244, 112,  70, 148, 149, // ...%....pF..
+ 183,  94, 252,  37,  59,  86,  96,  91, 130, 146, 210,  19, // .^.%;V`[....
+ 162,  50,  91, 128,  93,   8,  38, 174,  56, 129,  42,  52, // .2[.].&.8.*4
+ 250, 185,  91, 238,  53,  98, 247,  12, 245,  76, 120, 181, // ..[.5b...Lx.
+ 191,  99, 102, 136, 167,  12, 217, 216, 210, 182, 113,  21, // .cf.......q.
+ 103,  12, 114, 142,  74, 158,  53, 175,  11,  56, 113,  25, // g.r.J.5..8q.
+  44,   9, 135, 138, 243, 107, 238,  38, 224, 178,  33,  40, // ,....k.&..!(
+  56, 163, 156,  61,  59,  20, 171,  13, 204,  98,  40,  13, // 8..=;....b(.
+ 123, 163, 176, 250, 211, 101,  30,  41,  38, 255, 138,  71, // {....e.)&..G
+ 138,  51, 215, 158, 217, 197,  86, 163, 156, 227,  77, 241, // .3....V...M.
+  98,  15, 238, 121,  51, 119, 130,  77,   5,  72, 111, 167, // b..y3w.M.Ho.
+ 178, 148,  69, 138, 177,  91,  79, 252,  56, 152,  16,  33, // ..E..[O.8..!
+ 224,  93, 189,  27, 120, 139, 176, 103, 251, 245, 200,  47, // .]..x..g.../
+ 180,  12,   4, 117,  28,  35,  14, 113,  70,  25, 172,  27, // ...u.#.qF...
+  17,  53,  42, 106, 175,  24, 171, 192, 148,   9, 182,  36, // .5*j.......$
+  74, 167,  19, 223, 166,  84,  86,  75, 153,  40, 160, 138, // J....TVK.(..
+ 159, 244, 171, 152,  35,   6,   6,  69,  67, 176,  30, 201, // ....#..EC...
+ 106, 145, 201, 254, 124, 216,  10,   7, 224, 139, 131, 164, // j...|.......
+ 127, 144,  28, 250,   7, 135,  21, 109, 191,  46, 108, 123, // .......m..l{
+ 167,  96,  19, 245, 241, 193, 244,  16,  90, 218, 101,  18, // .`......Z.e.
+ 118, 186, 186, 154,  86,  54, 126, 246,  92, 125,  86, 108, // v...V6~..}Vl
+  84, 171,  27,  57, 254, 128, 115, 218,  96, 110, 122, 112, // T..9..s.`nzp
+  92, 163,  63,   4, 226,  48,  14, 107,  56, 204, 135,  52, // ..?..0.k8..4
+  53, 164,  41, 206,  92, 112,  80, 168, 148,  53,  62, 187, // 5.)..pP..5>.
+ 194, 157,  63, 217, 233, 212, 184,  99, 253, 132,  90, 197, // ..?....c..Z.
+  69,  41, 200,  52, 220, 240,  94, 129,  14, 105,  79,  28, // E).4..^..iO.
+ 228, 196,  65, 218, 147, 227, 140,   6, 234, 250, 221, 218, // ..A.........
+  90, 153,  44,  54, 201,  18, 154, 136,  41, 159,  21, 107, // Z.,6....)..k
+  21,  41, 169, 105, 171,  65, 115,  67, 173, 184,  56, 119, // .).i.AsC..8w
+ 130,  83, 181, 250,  55, 232, 148, 160, 234, 136,  91,   3, // .S..7.....[.
+ 183, 170, 158,   1, 147,   0,  31,  67,  16, 152, 102, 113, // .......C..fq
+ 144, 176, 221, 163, 126,  23,  80, 125, 212,  76, 194, 109, // ....~.P}.L.m
+ 187, 231,  92, 246, 235, 185,  21,  59, 158, 236, 180,  11, // .......;....
+ 182, 214, 245, 122, 250,   9,  53,  16, 117, 148,  97, 179, // ...z..5.u.a.
+  81,  68,  96, 137, 175, 111,   0, 140, 217, 140,  59, 253, // QD`..o....;.
+   4, 101, 115,   5,  79,  65, 158, 139,  98, 159, 153,  98, // .es.OA..b..b
+ 139, 121, 146,  88, 137,   7, 217,  32, 115,  37, 189, 121, // .y.X... s%.y
+  33,  35, 135, 184,   4, 181,  68, 210,  39, 238, 246,  38, // !#....D.'..&
+ 242, 219, 106,  31,  30,  78, 252, 164,  69,   8, 111, 241, // ..j..N..E.o.
+ 149,  29,  67, 217, 143, 171,   2, 139, 125,  98, 187,  10, // ..C.....}b..
+ 120,  82,   6, 144, 141, 214, 164, 149,  96, 159, 131,  94, // xR......`..^
+  88, 123,   0, 169,  97, 163, 187, 154,  16,  68, 137,  40, // X{..a....D.(
+ 236,  67, 185, 151, 123,  62,  31, 172, 205,  91,  17,  52, // .C..{>...[.4
+ 170,  17, 245, 164, 114,   6,  40,  97,  53,  37,  97,  50, // ....r.(a5%a2
+ 120, 237, 106, 196, 152,  35, 198,  40, 177, 149, 176, 114, // x.j..#.(...r
+  27, 117, 194,  18, 199,  14, 155, 169,  92, 234, 230, 122, // .u.........z
+ 204,  36,  43,  97, 244, 190, 224,  62,  47, 172, 191,  19, // .$+a...>/...
+ 212, 207,  47,  69,  57, 252, 149,   7,  11, 153,  95,  86, // ../E9....._V
+ 212,  23,  96, 206, 185, 180,  74, 252, 111,  86, 216, 178, // ..`...J.oV..
+ 240, 158, 148, 232, 150, 179, 157,  69, 194, 171, 104, 107, // .......E..hk
+ 191,  21, 113, 151,  72,  22,  92, 193, 215, 169, 203,  98, // ..q.H......b
+ 107,  17, 188,  68,   6,  43, 107, 121, 245,  13, 181, 152, // k..D.+ky....
+   9, 128,  34, 147, 218,  25, 171, 152, 129, 152,   5, 108, // .."........l
+ 191, 184, 207, 208, 194,   8,  52,  59, 170,  68,   9, 228, // ......4;.D..
+ 215,   0, 161,  93, 213,  42, 149, 255, 204,  70,  48, 168, // ...].*...F0.
+ 152, 181, 110, 147, 185, 185, 103,  39,  21, 172, 170, 199, // ..n...g'....
+  61,  30, 229,  24, 163,  28,  83,  93,  31, 105, 186, 148, // =.....S].i..
+ 227,  41, 167,  55,  48, 249, 146,  74, 104, 204, 195,  31, // .).70..Jh...
+ 243, 240, 147,  40, 234, 231,  56, 232, 200, 237, 140,  91, // ...(..8....[
+  89,  53,  89, 198, 201,  50,  51,  70,  56,  31, 172, 103, // Y5Y..23F8..g
+ 220, 230,  74,  91,  63, 178,  28, 246, 222,  24,  95, 129, // ..J[?....._.
+ 230, 217, 212,  60, 192,  87,  22,   1,  38, 181, 113,  63, // ...<.W..&.q?
+   9, 244,  83,   2, 135,   8,  25, 193, 102, 165, 188,  79, // ..S.....f..O
+  69, 223, 169, 231,  83, 246,  78,  70, 220, 186, 201, 187, // E...S.NF....
+ 140,  93, 166, 218,  49, 163, 101,  44, 146, 158, 197,  47, // .]..1.e,.../
+ 158, 226, 229, 177, 121, 118, 194, 195,  36, 130, 169,  78, // ....yv..$..N
+ 151,  38, 205, 232,  54, 216,  86, 250,   5,  91,   6,  21, // .&..6.V..[..
+  20, 128,  96, 160, 132,  10,  84, 218, 244, 226,  27, 144, // ..`...T.....
+  33, 103, 224, 227, 180,  17, 245, 217, 210, 194, 178, 215, // !g..........
+ 220, 175,  74, 145, 111,  12,  25,  73, 140,  32, 103,   8, // ..J.o..I. g.
+ 152, 113, 139, 246, 118, 154,  55, 211,  81, 147, 157, 231, // .q..v.7.Q...
+  53, 180, 184,   5, 163, 146, 127,  54, 108, 127,  98, 129, // 5......6l.b.
+  42,  93, 217,  94,  53,  31, 171, 212,  82,  35, 233, 160, // *].^5...R#..
+  11, 101, 109, 111, 139,   9,  89, 140, 199, 180,  54,  30, // .emo..Y...6.
+ 245, 209,  73, 107,  95, 163,  96, 163,  91,  41, 235, 215, // ..Ik_.`.[)..
+ 114, 128, 120, 122, 162, 108,   1, 118, 133, 102, 107,  11, // r.xz.l.v.fk.
+ 238, 188,  53, 132,   8,  99,  23,  46, 250, 148, 125, 212, // ..5..c....}.
+ 156, 216, 231, 247,  21,  27, 149, 227,  44,  76, 134, 129, // ........,L..
+ 254, 160, 106, 161, 167, 139, 182, 108,  16, 100, 106, 105, // ..j....l.dji
+ 246,  23,  45, 109, 114,  65, 253,  98, 178, 233, 150,  76, // ..-mrA.b...L
+ 132,  43,  89, 236, 115,  85, 151, 161, 115,  43,  21, 230, // .+Y.sU..s+..
+  45, 141, 125,  67,  67, 153,  32,  86, 215, 106, 250,  56, // -.}CC. V.j.8
+ 239,  85, 111, 174, 152,  18, 111,  53, 207, 219, 171,  10, // .Uo...o5....
+ 150,  48,  69, 184,   2, 114, 181, 116,  49, 159, 106,   4, // .0E..r.t1.j.
+  35, 166,   8, 208, 242, 171,  34,  26,  71,  88, 230,  26, // #.....".GX..
+  24, 192,   2, 180, 222, 170, 201, 244,  24, 206,   9, 143, // ............
+ 235,  22,  71, 118, 113, 251, 213, 133,   3,  54, 211,  48, // ..Gvq....6.0
+  33, 201,  96,  22, 212, 194,  84,  97, 255,  59, 149,  89, // !.`...Ta.;.Y
+   0,  19, 216, 122,  69, 156, 241, 237, 104, 137, 121,  97, // ...zE...h.ya
+  89, 238,  92, 150,  60,  21, 127,  51,  95, 204, 179,   6, // Y...<..3_...
+ 107, 137, 185, 108, 223, 239, 191, 125, 243,  87,  42,  26, // k..l...}.W*.
+ 107, 125,  86, 179, 252,  99, 242,  56, 215, 197, 197,  66, // k}V..c.8...B
+ 202, 254,  98,  15, 250,  14, 231, 141, 149, 122, 148,  53, // ..b......z.5
+ 236, 134,  55, 199, 162,  26, 226,   9, 106,  22,  54, 115, // ..7.....j.6s
+ 228,  55,  18, 184,  71,   6, 177,  46, 102, 138, 205, 105, // .7..G...f..i
+ 132,  57, 177, 200, 115,  33, 159, 239, 118, 176, 237,  86, // .9..s!..v..V
+ 163,   5, 187, 215, 131,  88,  55, 134,  58, 167, 182, 233, // .....X7.:...
+  33, 187,  69, 172,  45, 172, 107, 107, 196, 162, 224, 199, // !.E.-.kk....
+ 242,  53, 150,  80, 105, 131,  60,  37,  22,  98,   3, 154, // .5.Pi.<%.b..
+  16, 204,  35,   8, 183, 222,  44, 176,  61, 216,  76, 114, // ..#...,.=.Lr
+ 245, 199,  57, 221, 152, 126, 239, 213, 167, 161,  61,  10, // ..9..~....=.
+  45, 204,  91, 199, 208,  30, 187, 152, 118,  64, 177,  55, // -.[.....v@.7
+ 186, 196, 106, 111,  60, 176,  81,  48,  33, 178,  57, 182, // ..jo<.Q0!.9.
+  44, 253, 167, 214,  60, 173, 168,  65, 109, 169,  88,  24, // ,...<..Am.X.
+  12, 217, 185,  13, 204,   2,  17, 237, 180,  97, 175, 243, // .........a..
+ 155, 177, 140, 171,  14, 163,  16, 192, 149, 118, 207,  14, // .........v..
+  56, 163, 242, 171, 130,  78, 178, 142, 169,   2, 140,  43, // 8....N.....+
+  98,   0, 221, 142, 109, 153, 209, 114,  93, 172, 176, 183, // b...m..r]...
+ 136, 182, 157, 110, 145, 103, 231, 219,  69, 149, 208, 118, // ...n.g..E..v
+  30,  22,  16, 175, 145, 185,  90,  58, 106, 244, 131,  34, // ......Z:j.."
+  89,  97, 167,  69, 209,   5, 241, 174, 181, 155, 208, 248, // Ya.E........
+ 227, 157, 180, 172, 202, 101,  90,  10,  99, 107, 217, 120, // .....eZ.ck.x
+ 208, 155,  27, 231, 201, 252,  56,  39,  52, 206, 251,  45, // ......8'4..-
+  54, 180, 173,  19, 204, 202,  90, 205,  52, 238, 227,  95, // 6.....Z.4.._
+ 160, 113, 192, 232,  26,  77, 172,  21, 166, 230, 219, 107, // .q...M.....k
+  27,  12,  92, 217, 248, 198,  22, 127, 100, 243, 220, 122, // ........d..z
+ 179, 222, 204,  97, 224, 138, 219, 181, 216,  85, 194, 100, // ...a.....U.d
+   1,  36,  95,  64, 253,  59, 103, 251, 199, 187, 103,  59, // .$_@.;g...g;
+ 213,  91, 160, 251, 151, 167, 232,  28,  93, 176, 200,  77, // .[......]..M
+  28, 168, 186, 147,  56,  20,  88, 105, 202,  22, 196, 170, // ....8.Xi....
+ 169, 101,  47, 120, 179, 249, 109,   5,  46, 131,  69, 162, // .e/x..m...E.
+ 199,  41, 247,  93,  89, 147, 169, 230, 237,   2, 217, 235, // .).]Y.......
+ 131, 115,  85, 149,  91,  42, 211, 227,  14, 219,  89, 171, // .sU.[*....Y.
+  54, 173,  80,  13,   6,  99, 173,  57, 251, 115, 195, 244, // 6.P..c.9.s..
+ 141, 224, 154, 155, 239, 192, 150,  71, 224, 152,  12,  47, // .......G.../
+  99, 167, 115, 193, 231,  97, 162,  23,  83,  75,  80, 239, // c.s..a..SKP.
+ 141,  97,  43,  10, 164, 126, 123,  23, 246, 116,  11, 120, // .a+..~{..t.x
+ 184, 182, 222, 174, 101, 123,  96, 199, 198, 117, 205,  21, // ....e{`..u..
+  48,  12, 230,  21, 165, 204,  60, 118, 138, 162,  44, 227, // 0.....<v..,.
+  53, 147, 246, 125, 167, 244,  79,  74, 195,  72, 172,  34, // 5..}..OJ.H."
+  57, 126, 111, 252,  59, 178, 107,  90, 105,  46, 107,  15, // 9~o.;.kZi.k.
+  16,   0, 171,  15, 172, 211, 179, 154,  21, 213, 159, 204, // ............
+  91, 255,  68, 124, 221,  79,  96, 162, 126,  10, 180, 136, // [.D|.O`.~...
+ 119, 213,  52, 191, 184,  55, 216, 153, 131, 102, 223, 178, // w.4..7...f..
+  31, 108, 155, 146, 203,  18,  71, 136,  79, 161,   7, 177, // .l....G.O...
+  74,  14,   3,  29, 149, 204, 128,  12, 184, 138, 173, 181, // J...........
+ 245, 133, 200,  24,  49, 219,  57, 241, 158, 149, 120,  77, // ....1.9...xM
+ 184, 225,   7, 253, 191,  71,  61, 222,  52, 178, 138,  72, // .....G=.4..H
+ 244, 188,  58, 124, 172,  21,  41, 117, 154,  35, 118, 102, // ..:|..)u.#vf
+ 132, 152,   1, 235, 183, 253,  21, 121, 113,  28, 159,  53, // .......yq..5
+ 231,  51, 216,  73,  86, 139, 168, 110, 247, 154, 115, 165, // .3.IV..n..s.
+  46,  60,   5, 138,  93, 149,  61,  48, 171, 171,  22, 242, // .<..].=0....
+  51, 248, 220,  35,  22, 103, 201, 234, 244,  38, 208,  29, // 3..#.g...&..
+ 149, 154, 204, 150,  93,  53,  13, 211, 124, 180, 119, 117, // ....]5..|.wu
+ 117, 131,  89,  67, 188,  87,  78, 215, 186,  38, 132, 143, // u.YC.WN..&..
+  43, 230, 108, 222,  17,  89,  32, 221, 155, 182, 134, 181, // +.l..Y .....
+   9,  41,  65,  53,  70,   5,  54, 133,  37,  77,  36,  68, // .)A5F.6.%M$D
+  58,  72,   9, 246, 108, 224,  86,  90, 150, 113,  59, 160, // :H..l.VZ.q;.
+  72,  34, 182, 197, 133,  97, 175,  97,  71, 138,  81, 253, // H"...a.aG.Q.
+ 177, 202, 195, 201, 176, 177,  96,  60, 103,  39, 215, 198, // ......`<g'..
+  94, 200, 243, 202,  16, 200,  40, 210, 168,  87, 236, 204, // ^.....(..W..
+ 244, 119, 197, 161, 135, 106, 222, 142,  43,  86, 185, 250, // .w...j..+V..
+ 135, 202,  22,   9, 219, 180, 222, 101, 151, 164, 169,  22, // .......e....
+ 138, 153, 234, 189, 104,  64,  83,  35, 156, 156,  73, 205, // ....h@S#..I.
+ 115,  97,  92, 143, 231, 185, 186,  77,  11,  79, 109, 112, // sa.....M.Omp
+ 244, 119,   2, 201,  55,  51,  15, 248, 252,  75, 203, 184, // .w..73...K..
+ 220, 230,   3, 175, 206, 209,  36, 119, 150,  82, 229,  72, // ......$w.R.H
+  79, 234,  92, 216,  77, 213, 189, 235, 205, 156, 251, 108, // O...M......l
+  37, 218,  48, 163,  87,  80, 236,  77, 246, 142,  52, 250, // %.0.WP.M..4.
+ 151, 153, 113,  51, 187, 144,  64,  40, 190,  49,  84, 228, // ..q3..@(.1T.
+   9, 134, 150,  19, 143, 196,  46, 103, 239,  40, 175, 195, // .......g.(..
+ 244, 249, 123, 215, 161,  52, 142, 226, 233,  78, 224,  89, // ..{..4...N.Y
+ 230, 119, 201, 122,   2,  19, 253,  90, 108,  79,  53,  23, // .w.z...ZlO5.
+  11,  88,  34, 206, 148,  56, 111, 229,  96, 103, 144, 148, // .X"..8o.`g..
+  71,  66, 145,  44,  13, 112,  90, 174, 151,  82, 234,  73, // GB.,.pZ..R.I
+  14,  43,  47,  16, 235, 247, 198, 204,  26,  54,  89,   9, // .+/......6Y.
+  73, 248, 226, 211, 136, 210,  17, 121, 139, 249,  97, 240, // I......y..a.
+ 142, 144, 155, 185, 126, 219, 230, 172, 108,  51, 145,  30, // ....~...l3..
+  89, 197,  96, 219, 205, 167,  85, 216, 193, 141, 105, 112, // Y.`...U...ip
+  47,  97, 130, 192,  60,  76, 177, 168, 224, 144,  18,  79, // /a..<L.....O
+   8,  32, 209, 220, 184, 243, 176, 203, 137, 155, 128,  81, // . .........Q
+  38,  49,  20, 165,   3,  53,  82, 177,  67,   9, 145,  67, // &1...5R.C..C
+ 202,   8, 224, 146, 117,  70, 173, 136, 217, 163, 116, 217, // ....uF....t.
+  70,  45, 109, 228,  67,   2, 166, 157, 202, 122,  95,  51, // F-m.C....z_3
+ 137, 196,  96, 175, 236,  11, 119, 131,  21,   9,  72, 124, // ..`...w...H|
+ 199,  80, 152,  29, 126,  28,  82,  47,  22,  82, 134,  31, // .P..~.R/.R..
+ 247,  95,   6,  39,  26, 149, 162, 111, 220, 250, 200, 203, // ._.'...o....
+ 186, 103,  71, 204, 216,  17,  25, 109,  39,  91,  18, 149, // .gG....m'[..
+  42, 194, 219,  91, 142, 198, 168,  36,  44,  16,  35, 222, // *..[...$,.#.
+ 202, 121, 178, 159, 145, 195,  86, 134,  74,  13, 242,   2, // .y....V.J...
+   9,  82, 241, 155, 196,  69, 102, 236,  59,  18, 182,  16, // .R...Ef.;...
+ 244,  40,  75, 206, 250, 110, 182, 228, 244, 132, 224, 134, // .(K..n......
+ 248,  93, 170, 201, 193, 233, 101, 162, 179, 253, 159, 190, // .]....e.....
+  51, 199, 250,  64,  62,  95,  18, 140,  13, 101, 186,  73, // 3..@>_...e.I
+ 125,  11, 180, 204,  46,  31, 232, 255,  76,  13, 253, 250, // }.......L...
+ 136,  22,  52, 214, 232,  93, 178,  26, 229, 135, 231,  47, // ..4..]...../
+  35, 213, 226, 149, 164, 222, 180, 207, 158, 159,  98,  63, // #.........b?
+ 238,  47, 248, 101, 138,  75, 167,  89,  85,   7,  78, 160, // ./.e.K.YU.N.
+  34, 112,  37, 136, 189,  16, 104,  34, 169, 223,  65, 230, // "p%...h"..A.
+ 249,  89,  43, 117,  35,  86, 116,  87, 145, 215, 152, 220, // .Y+u#VtW....
+ 253, 133,  73,  39, 131,  93,  27,  83, 189, 116,  76, 193, // ..I'.].S.tL.
+  19,  91, 117,  72, 145,  23, 195, 203, 139, 241, 144,  37, // .[uH.......%
+  39,  62, 211,  94,  22,  59, 152,  43,  22,  24, 205,   6, // '>.^.;.+....
+ 174, 242,  90,  20, 135, 220, 243, 147, 240, 180, 142, 224, // ..Z.........
+ 110, 242, 120, 227, 246, 246, 145,  61, 137, 144, 155, 121, // n.x....=...y
+ 211, 173,  97, 125, 237, 136, 213,  87,  78, 237, 217,  78, // ..a}...WN..N
+ 196, 229, 162,  70,  67,  28,  87, 118, 122, 226,  86,  73, // ...FC.Wvz.VI
+ 135, 180,  96, 245, 130, 152, 118, 116,  52,  90, 230,  94, // ..`...vt4Z.^
+ 207, 238,  93, 175,  20,  92, 230, 212, 130, 172, 107, 143, // ..].......k.
+  58, 221,  27, 241,  86, 162, 139, 141, 158, 219, 219, 205, // :...V.......
+  50, 152, 214, 248,  78, 229, 171,  80, 247, 148, 167, 235, // 2...N..P....
+ 147, 249, 244,  27,  75, 210,  23, 109,  55, 110, 199, 128, // ....K..m7n..
+   9,  71,  71, 147, 116, 154,  13, 224, 157,  12, 170,  24, // .GG.t.......
+  45, 248,  89,  90,  89, 192,  47, 221, 242, 252, 149,  99, // -.YZY./....c
+  98, 220,   4,  83, 232,  18, 221, 177, 114, 166, 206, 227, // b..S....r...
+  47,  25,  86, 222, 222,  46,  13,  54,  22,  25,  97, 224, // /.V....6..a.
+  70, 246,  34,   2,  98,  33, 190, 242,  42, 196, 121,  18, // F.".b!..*.y.
+ 220, 240, 246,  18,  46,  62, 249, 231,  99, 236,  71,  53, // .....>..c.G5
+ 134, 129, 179, 183, 217, 232,  60, 104, 188, 238, 116, 240, // ......<h..t.
+ 232, 108,  54, 186, 143,  26, 157, 237, 198,  70, 163, 203, // .l6......F..
+   1, 221, 109, 250, 117,  26, 235,  59, 255,  84,  78,  56, // ..m.u..;.TN8
+  28,  54, 249,  82,  23, 167, 154, 157, 179,  53,  94, 115, // .6.R.....5^s
+ 226,  78,  99, 175, 177, 213, 232, 224, 179, 251,  16,  79, // .Nc........O
+ 124, 210,  27, 127, 242, 179, 243, 168, 209, 221, 160, 224, // |...........
+ 202, 247,  70, 199,  41, 138, 151,  27, 152,  80, 254,  73, // ..F.)....P.I
+ 163, 184,  37,  36, 112, 248, 202, 167, 134, 219, 236, 168, // ..%$p.......
+  70, 199, 115, 202, 152, 102, 154, 193, 133, 113, 224, 200, // F.s..f...q..
+ 133,  61, 206, 206, 127, 117, 179,  30, 159, 216, 150,  69, // .=...u.....E
+  73, 158, 162,  93,  25, 241,  27, 141, 171, 192, 233,  56, // I..].......8
+ 141, 235, 192, 217, 116,  26, 114,  85, 213,  70, 187,  33, // ....t.rU.F.!
+ 126, 243, 130, 238,  38,  65, 171,  81, 111, 200, 182, 105, // ~...&A.Qo..i
+ 200,  38,  85, 177, 205, 224, 198, 187,   5,  44, 245,  45, // .&U......,.-
+ 203, 171,  32, 165,   4,  27, 141, 215,  84,  36, 141,  69, // .. .....T$.E
+  23,  63, 191,  53,  16, 134,  14, 224, 241, 136, 191, 168, // .?.5........
+ 189, 248, 234, 110, 153,  66,  50,  90, 248,  47, 244, 220, // ...n.B2Z./..
+ 192, 182,  27, 175,  55,  49, 134, 197,  63,  10, 217, 235, // ....71..?...
+  54,  54,  27, 175, 187, 120, 165,  42, 228, 119, 147, 171, // 66...x.*.w..
+ 160, 176,  45, 138, 161, 192,  45,  59, 228,  36, 130,  93, // ..-...-;.$.]
+ 154,  27,  96, 106, 163,  78,  21, 119, 185, 126, 180, 146, // ..`j.N.w.~..
+  63, 246, 228, 131, 219,  84, 203, 141, 171,  90, 106, 121, // ?....T...Zjy
+ 169, 202,   7, 220, 128,   7, 168, 157, 114, 239, 241,  59, // ........r..;
+  58,  92, 226,  26, 103, 229, 171, 108, 106, 121, 169,  34, // :...g..ljy."
+ 155,  18, 149,  34, 179, 124, 112, 121, 181, 204, 121,  58, // ...".|py..y:
+ 158, 107, 114, 199,  52,  15, 217,   0,   8, 126, 151,  78, // .kr.4....~.N
+  72,  78,  92,  39, 115,  25, 102, 195, 201, 220, 104, 116, // HN.'s.f...ht
+ 109, 115, 185, 139, 197, 139, 252, 179,  49, 191, 217,  50, // ms......1..2
+  78, 170, 185, 183,  26, 143,  26, 175, 183, 120,  36,  31, // N........x$.
+ 154,  95,  25, 207,  54,  61, 119, 249,  23,  67, 192,  37, // ._..6=w..C.%
+ 162,  71, 252, 243, 136, 127, 108, 121,   9, 149,  55, 136, // .G....ly..7.
+  50,  72, 193,   3,  96,  30, 117, 115, 112,  45, 207, 140, // 2H..`.usp-..
+  30, 155,  78,  29, 225,  30,  48, 116, 169, 209,   6,  28, // ..N...0t....
+ 199,  58, 142, 171,  45,  34,  36, 120, 216, 216, 165,  95, // .:..-"$x..._
+ 212, 195,  45, 103, 100,  98, 244, 164,  48, 252,  62, 196, // ..-gdb..0.>.
+  47, 192,  75,  47,  91, 230,  23, 157, 216, 106, 236, 242, // /.K/[....j..
+ 239,  54,  34, 185,  28, 234,   9, 225,  11,  34, 228, 209, // .6"......"..
+ 101, 164,   5, 200,  30, 113,  97, 242, 187, 101, 126,  13, // e....qa..e~.
+ 102, 163,  74, 211, 182,  52,  61, 155, 131,  53, 181, 141, // f.J..4=..5..
+ 127,  41, 103, 163,  43, 136,  66, 120, 187, 203,  19, 212, // .)g.+.Bx....
+  18, 164, 242, 151,   2, 233,  31,  70,  97, 155, 209, 226, // .......Fa...
+   1,  53, 132, 210,  53, 184,   8, 254, 145, 185, 243,  80, // .5..5......P
+  70, 126, 187, 172,  22, 183,  96, 205,  97, 180, 128,  13, // F~....`.a...
+ 216,  97,  16,  12, 229, 209, 171,  25,  89,  16, 161, 100, // .a......Y..d
+  24, 102,  53, 124, 148,  22,  22, 200, 192,  77, 248, 141, // .f5|.....M..
+  49, 122,  75, 240, 148, 122, 253,  16, 157,  70, 143, 246, // 1zK..z...F..
+  58,  27, 220, 255,  13, 126, 127, 196, 239, 143, 240,  78, // :....~.....N
+ 176, 161, 119, 250, 125, 100, 171, 194, 133,  63, 245, 138, // ..w.}d...?..
+  64,  68,  30,  53, 120, 220,  54, 209, 180,  77, 244, 124, // @D.5x.6..M.|
+  27,  53, 110, 219,  89, 136, 159, 223,   4,  29, 238,  70, // .5n.Y......F
+  24,  59, 183,   7,  33,  45,  70, 203, 230, 182,  80,   5, // .;..!-F...P.
+ 134,  23, 202, 236,  20,   0,  48,  89,  22,  38, 116, 151, // ......0Y.&t.
+   1, 240, 250, 129, 157, 148, 115, 233,  23, 103, 177,  16, // ......s..g..
+  29,  64, 219, 208, 128, 185,  28, 243,  83,  23, 221, 147, // .@......S...
+ 153, 202, 157, 236, 150,  35,  82,  39, 156,  15,  12, 113, // .....#R'...q
+ 120, 192, 116,  30, 144,   5, 177,   4, 254,   2, 210, 109, // x.t........m
+  60, 182,  80, 128,  80, 168,  26, 144,  64,  71,   1, 164, // <.P.P...@G..
+ 238,  67,   6, 210,  98, 130,  78, 119,  49,   1, 181,   0, // .C..b.Nw1...
+ 174,  82, 230,  81, 169, 139, 225, 121, 221,  97, 196,   5, // .R.Q...y.a..
+ 113, 181, 125,  59, 213,  23,  89, 154, 220,   5, 114, 233, // q.};..Y...r.
+  32,  38,  94, 163, 211, 157, 203, 178,   8, 114, 129, 224, //  &^......r..
+ 182,  65, 211, 249, 244,  75,  64,  46,  99, 196, 203,  14, // .A...K@.c...
+ 207, 198, 185,  28, 203,  64,  46,  72, 176,  13, 120,  25, // .....@.H..x.
+   2,  41, 240, 248,  42,  61,  26,  69, 113,  76, 139, 178, // .)..*=.EqL..
+ 152, 194, 240, 237, 131,  38, 123,  28, 141, 143,  83,  34, // .....&{...S"
+ 176, 115,  45, 235,  50, 180, 204, 132, 235,  50,  73, 101, // .s-.2....2Ie
+  52, 162,  73, 210, 193,  98, 245, 128, 126, 236,  82,  35, // 4.I..b..~.R#
+ 191, 155,  88, 213,  55, 109, 169, 233, 224, 236, 175, 209, // ..X.7m......
+  72,  89, 147, 133, 110, 163, 190, 118,  81, 210,  68, 215, // HY..n..vQ.D.
+  71,  18,  64,  99,  34, 191, 183,  97, 144, 214, 130,  14, // G.@c"..a....
+ 166, 103, 115,  72,  77, 164, 126,   3,  84, 177, 195, 180, // .gsHM.~.T...
+ 112, 143,  41, 249, 107, 208, 192, 135,  60,  47,  64,   0, // p.).k...</@.
+ 183, 153,  20,  81, 243,  31, 218,  82, 226,  56,  28, 215, // ...Q...R.8..
+ 107, 125, 216, 218, 216, 122,  72, 105,  30, 181,  58, 155, // k}...zHi..:.
+ 221, 237,   7,  63, 117,  30, 188, 220, 106,  61, 144, 215, // ...?u...j=..
+ 118, 107, 155, 226,  94, 182,  91,  91,  63, 153, 232, 151, // vk..^.[[?...
+  38, 249, 111,   4,  44, 126, 107, 180, 127, 218,  50,  81, // &.o.,~k...2Q
+ 157,   7, 148, 238,   1, 103, 217, 124, 249, 200, 148, 209, // .....g.|....
+ 126, 105,  18, 254, 230,  44,  48,  89, 110,  87, 117, 137, // ~i...,0YnWu.
+ 195,  34,  89,  40,  61,  51,  55, 111,   6,  78, 219,   6, // ."Y(=37o.N..
+ 204, 143, 233, 146, 113, 150,  62, 145,  56,  49,   7, 200, // ....q.>.81..
+ 135, 194,  91,  60, 148,  21, 147, 127, 182,   0, 151,  45, // ..[<.......-
+   6, 172,  89, 177, 100, 194, 242, 114, 211,  97, 194, 254, // ..Y.d..r.a..
+  91, 195, 172, 248, 178,  98, 211,  39, 167, 120, 109,  98, // [....b.'.xmb
+  45,   8, 199, 215, 203, 105, 178, 204, 146, 174, 161, 201, // -....i......
+ 130,  84, 175, 205,  34, 135,   8, 249,  45, 202, 201, 244, // .T.."...-...
+  48, 202,   7, 115, 232, 217, 197, 128, 241, 224, 109, 180, // 0..s......m.
+ 205,  47,  47,  42,  91,  96, 147,  95,  51, 179,  76, 239, // .//*[`._3.L.
+ 221,  14, 179, 208, 221, 206,  28, 162, 117, 153, 107, 235, // ........u.k.
+ 162,  59, 152, 227, 242, 219,  65, 141, 119, 205, 145, 161, // .;....A.w...
+ 158, 156, 225, 142, 187,  58, 102, 117, 133,  89, 232,  50, // .....:fu.Y.2
+ 183,  32, 147, 216,  44, 209, 242, 251, 200, 252, 190, 150, // . ..,.......
+  68, 188,   2, 201, 218,  41, 171, 227, 134, 172,  76,   8, // D....)....L.
+  52, 189, 181, 158, 154, 171,  21, 113,  41, 187, 156, 188, // 4......q)...
+  35, 252,  65, 103,  67,  72, 238, 134, 208,  93,  16, 110, // #.AgCH...].n
+   0, 100, 163, 107,  86,  94, 102, 252,  58, 152, 145, 150, // .d.kV^f.:...
+  25, 228, 143,  61, 153,  90,  85, 222,  10, 176, 157,  35, // ...=.ZU....#
+  48,  15, 121, 201,   3,  34,   8, 227,  35, 157,  19, 166, // 0.y.."..#...
+ 162,  99,  71, 189,  35, 192, 102, 250,  47, 177, 166,  60, // .cG.#.f./..<
+ 104, 254, 230, 105, 168,  76, 106, 148, 217, 217, 102,  24, // h..i.Lj...f.
+ 116, 101,  21, 182,  92, 178,  67, 188,  80,  52, 158,  68, // te....C.P4.D
+ 147, 230,  41, 137,  14, 159, 225, 244,  62, 118, 234, 164, // ..).....>v..
+ 227, 161,  33, 243, 155, 150, 204,  47,  31, 168,  98, 109, // ..!..../..bm
+  88,  22,  93,  37,  65, 101,  65, 223, 144, 169,  88, 133, // X.]%AeA...X.
+  54, 171, 139,  76, 217, 106, 123, 131, 166, 179, 156, 220, // 6..L.j{.....
+  61, 252, 198,  54,  47,  33, 145, 127,  45,  19, 218, 249, // =..6/!..-...
+ 165,  76,  52,  60,  73, 125,  22, 109,  50, 123, 181,  89, // .L4<I}.m2{.Y
+  44, 248, 194,   2,  20, 152,  92,  96, 201, 213,  56, 172, // ,......`..8.
+ 231,  36,  74,  71, 105,  10,  98, 215, 109, 117, 233, 229, // .$JGi.b.mu..
+ 209,  79, 157, 205,  86, 151, 200, 154,  37, 126, 160, 145, // .O..V...%~..
+ 148, 146, 104, 224, 102, 235,  33, 133,  55,  12, 209, 251, // ..h.f.!.7...
+ 169, 211, 122, 136, 244,  85, 226,  87, 165, 137,  38,  57, // ..z..U.W..&9
+ 225, 212, 255,  51, 164,  80, 238, 182, 171,  65, 130, 153, // ...3.P...A..
+ 231, 215, 134,  53, 144,  31,  35,  62, 109,  90,  14,  96, // ...5..#>mZ.`
+ 111, 219, 178,   3, 155, 194, 149,  91, 224, 144, 144, 155, // o......[....
+ 132,  53, 110,  30, 203,   4,  86, 157,  71,  50, 129, 186, // .5n...V.G2..
+ 246,  23, 100, 137, 254, 111, 114,  77,  44,   3,  82, 202, // ..d..orM,.R.
+  61, 126, 199, 242, 211,  49, 156, 176, 190, 158,  95, 205, // =~...1...._.
+  13, 254, 119, 100, 132,  59,  95, 195, 155,   7, 139,   4, // ..wd.;_.....
+  15,  60, 184, 240, 222,  86, 186, 216, 106,  88, 150, 186, // .<...V..jX..
+ 250, 139, 185,  47,  43,  48, 210,  10, 175, 105, 126, 204, // .../+0...i~.
+  28,  31, 105,  61, 172,  55, 207, 226, 223,  87, 145, 182, // ..i=.7...W..
+  42,   5, 147, 116,   2, 245,   6, 175,  55,  80, 107,  60, // *..t....7Pk<
+   4,  56, 246, 192,  82, 236, 118, 208,  72, 180, 130, 219, // .8..R.v.H...
+  98, 229,   3,  42,  84,  47, 200,   6, 117,   6, 164, 195, // b..*T/..u...
+ 212,  70, 120, 148, 109, 102,  96, 182, 141,  52, 219, 105, // .Fx.mf`..4.i
+  23, 133, 208, 112, 213, 151,  18, 200,  73,  13, 134, 134, // ...p....I...
+  17, 248, 240,  67,   5, 110, 201,  15, 164,   1, 148, 195, // ...C.n......
+  98,  98, 177, 100, 112, 249,  91,  22,  36, 113,  93, 190, // bb.dp.[.$q].
+  44, 155,  86,   8, 126, 204, 210, 116,  68, 202, 221, 198, // ,.V.~..tD...
+  24, 152,  94,  57, 163,  52, 198, 245, 170, 233,  88,  39, // ..^9.4....X'
+  78,  93,  81,   0, 233,  73,  20,   4, 194, 137, 118,  88, // N]Q..I....vX
+  20, 236, 180, 153, 249, 219, 102, 130,  44,  40, 201,   8, // ......f.,(..
+  36, 127,  45, 172, 184, 208,  57, 246,  87, 216, 112,   1, // $.-...9.W.p.
+ 214,  67, 148, 198,  60,  17, 104,   0, 107,  26,  12, 187, // .C..<.h.k...
+  91,  50, 186,  52, 237, 238, 144, 187, 171, 242, 182, 225, // [2.4........
+ 215, 100, 209, 158,  19, 187, 157, 209,  52, 142,  39, 180, // .d......4.'.
+ 132, 235, 164, 169, 175, 162, 124, 174, 131,  29,  97,  49, // ......|...a1
+ 229, 223,  38,  11, 173, 155, 162, 234,  96,  46, 157, 126, // ..&.....`..~
+ 247,  54,  11, 174, 221, 134, 242,  92, 109, 115,  50, 243, // .6......ms2.
+ 207, 246, 185, 168, 107, 177,  22, 128, 166,  86, 135, 157, // ....k....V..
+ 126,  69,  21, 246, 179,  90, 131, 232, 103, 202,  26,  78, // ~E...Z..g..N
+ 162,  81,  62,  87, 246,  38, 114, 138, 164,  43, 191,  60, // .Q>W.&r..+.<
+ 161, 153, 195, 196,  43, 224, 195, 191,  86,  93,  68,  28, // ....+...V]D.
+  67, 131,  31,  20, 204,  50,  34, 175, 254,  18,  82, 254, // C....2"...R.
+ 108,  55, 132,  15,  18, 254, 160, 140, 144,  18, 170,  11, // l7..........
+ 248,  73, 148, 159,  78, 143, 109, 163,  22, 200, 226, 178, // .I..N.m.....
+ 137, 200, 203, 114, 151, 106, 216, 229,  54, 180, 165,  41, // ...r.j..6..)
+  28, 178, 181,   1,  52, 127, 192,  92, 197,   3, 102,  99, // ....4.....fc
+ 204, 111, 135, 127,  69,  84, 217, 218, 226,  25, 186, 197, // .o..ET......
+  40, 132,  28,  36, 191, 181, 203, 223, 205,  71,  96,  15, // (..$.....G`.
+  54,   5, 183, 128, 247, 155, 172, 242, 194, 239,   6, 255, // 6...........
+ 110,  53,  54, 183, 237, 239, 118,  99, 139,  43, 219, 226, // n56...vc.+..
+  10, 182, 184, 215,  20,  14,  89, 226, 129, 249,   5, 189, // ......Y.....
+ 100,  85, 197,  38, 163, 201,   6, 243,  64,  50,  19, 187, // dU.&....@2..
+  92,  90, 183, 107, 127, 121,  86, 118, 152,  77, 149, 223, // .Z.k.yVv.M..
+ 110, 219,  38,  99,  21,  34,   5, 110, 240, 239, 102,  27, // n.&c.".n..f.
+  33, 166,  73, 143, 202,  95,  52, 163, 141, 119,  42,  77, // !.I.._4..w*M
+ 126,  77, 195, 184, 198,  45, 174, 125, 139,  91,  66,  77, // ~M...-.}.[BM
+ 162, 127,  27, 219, 104, 225, 198,  35, 116, 119, 147,  51, // ....h..#tw.3
+ 210, 239,  22, 240, 173,  13, 104, 237, 226, 209,  65, 216, // ......h...A.
+   3, 206, 244, 128, 243, 209, 239,   3,   6,  28, 253, 110, // ...........n
+ 240, 123, 135, 187, 110, 198, 192,  76, 157, 147,  44, 189, // .{..n..L..,.
+ 252, 102, 253,  28, 143,  87, 161, 116,  19,  29, 156,  20, // .f...W.t....
+ 115, 170, 231, 164, 113,  94, 219, 119,   5, 136,  13, 144, // s...q^.w....
+ 120, 209,  47,   1,  42,  15,  68,  43,  42, 212, 183,  35, // x./.*.D+*..#
+ 138, 139,  77, 116, 249, 129, 133, 250, 182,  93,  33, 218, // ..Mt.....]!.
+  75, 180,  62,  15,  69, 255,  81, 206, 254, 211, 244,  92, // K.>.E.Q.....
+ 207, 203, 148,  50, 153, 203,  69, 182,  99, 150, 151,  98, // ...2..E.c..b
+ 242,  85,   5, 132, 110,   1,  13, 185,  54, 250,  95,  89, // .U..n...6._Y
+ 177,  31,  20,   2, 124, 169, 219, 141, 146, 227, 244, 170, // ....|.......
+  78,  28,  89,  14, 170, 201,  19, 178, 248,  60, 108,  24, // N.Y......<l.
+ 117, 149,  36, 233, 180, 101, 225, 226,  71, 167,  99,   1, // u.$..e..G.c.
+  33,  28, 118, 187, 130, 138,  86, 207, 100,  43,  28, 165, // !.v...V.d+..
+ 127,  89,  22, 238, 152, 126, 108,  52,  42, 146, 177, 153, // .Y...~l4*...
+ 246,  49,  84,   9,   9, 238,  89, 175, 194, 119,  27,  56, // .1T...Y..w.8
+  44,  50,  27, 191,  98, 193, 120, 100, 100, 116, 126, 253, // ,2..b.xddt~.
+ 205, 230,  78, 206, 230,  50, 110,  83, 167, 240, 203,  44, // ..N..2nS...,
+  33, 112,  93,  84,  88,  70,  85,  40,  28, 226,  35, 219, // !p]TXFU(..#.
+ 221,  14, 151, 252, 176,   1,  62, 135, 226, 118, 229, 177, // ......>..v..
+  45, 203,  37,  20,  59,  66, 188, 186, 109, 209, 171, 163, // -.%.;B..m...
+  37, 130, 184,  29, 153, 160, 166,  21, 246, 152, 254, 114, // %..........r
+ 192, 116,  24,  48, 243, 112, 145,  41, 191,  11, 112, 119, // .t.0.p.)..pw
+ 231,  89,  23, 145, 226,  68,   9, 186, 213, 128,  66, 180, // .Y...D....B.
+ 211, 182, 236,  11, 107, 192, 168, 105, 219, 134, 104, 252, // ....k..i..h.
+  86, 180, 225, 172, 174,  24, 238, 176,  82, 117, 131, 133, // V.......Ru..
+  26, 249,  69, 106,  22, 113, 183, 160, 240, 196,  95, 240, // ..Ej.q...._.
+ 190, 232, 233, 134, 252,   8, 107,  39, 138,  84, 163, 158, // ......k'.T..
+ 233, 110, 220, 205, 165, 111, 150,  60, 220,  63, 213, 121, // .n...o.<.?.y
+  24, 197,  95,  88, 166, 141, 112, 104,   4, 199,  98, 205, // .._X..ph..b.
+  53, 120, 124, 174, 147, 105, 125, 110,  11, 199, 192, 124, // 5x|..i}n...|
+  20, 171, 223,  25, 254, 123,  60,  60, 188, 156, 109, 218, // .....{<<..m.
+ 140, 147,  73, 120,  50, 167,  84, 217, 228, 122, 101,  53, // ..Ix2.T..ze5
+ 235,  26, 162, 194,  24, 176, 109, 160,  87, 200, 228, 231, // ......m.W...
+ 176,  19,  25, 159, 166, 137,  94,  96,  13, 118, 133, 152, // ......^`.v..
+ 240, 162,  38, 109,  22, 222, 211,  32,  64, 183,  50,  99, // ..&m... @.2c
+ 236,  63, 249, 228, 230, 138, 170, 184, 212,  55,  61,  16, // .?.......7=.
+  94, 174,  80, 142, 219, 241, 179,  19, 218,  76, 235, 135, // ^.P......L..
+ 230,  23, 154,  92,  22, 183,  31, 225, 177,  39, 201, 120, // .........'.x
+  56,  30, 217, 134,  39, 211, 201, 220, 196, 175, 239, 113, // 8...'......q
+ 156, 167, 199, 115, 108,  38,  83,  66,  86,  35, 136, 176, // ...sl&SBV#..
+ 207,  76, 253,  35,  64, 235, 145, 213, 129,  63, 178, 219, // .L.#@....?..
+  54,  29,  81,  70, 241,  99,  87,  20, 176,   5, 239, 207, // 6.QF.cW.....
+ 220,  28,  45,  52, 172,  11, 223,  48,  32, 237,  72,   7, // ..-4...0 .H.
+ 129,  82, 175,  25, 157, 246, 152, 203, 196, 187, 213,  69, // .R.........E
+ 157, 167, 105,  50,  39,  91, 116, 119, 129, 115,  84,   8, // ..i2'[tw.sT.
+ 116, 216,  88, 212,  12,  22, 138,  78, 235,  17,  83, 232, // t.X....N..S.
+  71, 165, 134, 193,  48, 175,  91, 141, 135, 134,  40, 116, // G...0.[...(t
+ 237,  56, 166, 245, 189, 169,  13,  25,   5, 102,  54, 202, // .8.......f6.
+  93,   1,   6, 101, 215,  40, 235, 121,  86,  63, 228,   0, // ]..e.(.yV?..
+  72, 241,  18, 221,  53, 154, 181,  45,  97,  32,  31, 149, // H...5..-a ..
+ 171, 196, 222,  67,  14, 218,  16, 201, 195, 106, 244, 206, // ...C.....j..
+ 167, 147, 104,  80, 235,  83,  71,  74, 235, 200, 134,   7, // ..hP.SGJ....
+  47, 217,  76, 247,  58,  66, 209,  54,  13, 225, 107,  60, // /.L.:B.6..k<
+  22, 161, 187, 174,  20, 128,  80, 116, 197, 164,  34, 187, // ......Pt..".
+  54, 154, 244, 122,  66, 212, 203,  41,  55,  22,  83, 162, // 6..zB..)7.S.
+  53, 185, 158, 211, 226, 118,   4,  13, 153, 142,   8,  73, // 5....v.....I
+ 103, 173, 174,  17, 145, 187, 102, 102, 112,  12,  70,  90, // g.....ffp.FZ
+  30,  93, 166, 178, 146, 219,   0,  88, 188, 123,  79, 230, // .].....X.{O.
+ 214, 173,   7, 224,  25,  31,   8, 247, 206, 239,  29, 249, // ............
+ 232, 242,   7,  47, 237, 155,  13, 233, 246,  35,  70, 254, // .../.....#F.
+  13, 174, 253, 145, 236, 234, 108,   8, 235, 107,  48, 122, // ......l..k0z
+  28, 142, 117,   6,  13, 238, 162, 210,  83, 116,  82, 140, // ..u.....StR.
+ 179, 219,  86, 110,  17,  34, 249, 200, 204, 113,  89,  67, // ..Vn."...qYC
+ 153,  54, 116, 121, 230, 117, 101, 124, 187,  34, 221, 136, // .6ty.ue|."..
+ 220, 135, 166, 116,  54, 121,  42, 243, 160,  24, 106, 223, // ...t6y*...j.
+ 225,  61,  39,  25, 232, 142,  40,   7, 101, 110, 110, 139, // .='...(.enn.
+  94, 127, 187,  81, 180, 112,  58, 167, 117, 220,  96, 173, // ^..Q.p:.u.`.
+   3,  55,   8, 232, 142, 137, 100, 217,  89,  34,  42, 121, // .7....d.Y"*y
+  58,  55,  24,  60, 135,  45,  25, 231, 159,  82,  93, 185, // :7.<.-...R].
+  89,  16, 221, 174, 229, 183, 187, 221,  98,  11,  80,  68, // Y.......b.PD
+ 146, 205,  69,  82, 108, 240, 225,  17,  83, 226,  13,  83, // ..ERl...S..S
+ 117,  28,  94, 207, 235, 247,  24, 136, 133,  70, 228,  55, // u.^......F.7
+ 155, 112, 186,  68,  36,  18, 208,  46,  18,  20, 240,  45, // .p.D$......-
+  36, 141,  69, 245,  94, 241,  76, 197,  76, 233, 178,   8, // $.E.^.L.L...
+ 128,  31, 208,  47, 222,  79, 178, 123,  71,  64,  66, 195, // .../.O.{G@B.
+ 221, 109, 150, 116, 114, 187,  66,  26, 101, 135, 117, 219, // .m.tr.B.e.u.
+ 136,  22, 102,  51,   6,  58,   6,  78, 183, 107,  83, 115, // ..f3.:.N.kSs
+ 227, 141, 252, 211, 233, 202, 102, 149, 145, 104, 198,  89, // ......f..h.Y
+ 148, 212, 216,  42, 217,  85, 228, 201, 205, 148, 174,  45, // ...*.U.....-
+  63, 221,  45, 243, 111, 143, 183, 112,  94,  63,  44, 249, // ?.-.o..p^?,.
+  36, 140, 188, 232,  54, 121,  87, 149,  51,  62, 228, 255, // $...6yW.3>..
+ 143,  88,  79,  12,  54,   6, 105, 204, 210, 147, 233,  81, // .XO.6.i....Q
+ 166,  39, 167,  95, 230, 134,  24,  27, 170, 187, 245, 162, // .'._........
+ 148,   6, 215, 193, 175, 123, 204, 131, 108,  25,  97,  26, // .....{..l.a.
+ 204, 233, 150,  45, 125,  94, 123, 218, 232, 180, 208, 235, // ...-}^{.....
+ 214, 214, 163, 198,  19, 102, 218, 182,  68, 230, 161, 166, // .....f..D...
+ 183, 176,  32, 181, 152,  97,  38, 240, 119, 232, 109, 175, // .. ..a&.w.m.
+  22, 186, 129, 109,  14,  27, 244, 168, 181, 217,  49,  37, // ...m......1%
+  24, 169,  73,  74, 230, 240, 215, 216,  22, 221, 110, 236, // ..IJ......n.
+ 213, 130, 182,  91,  27,   5, 197, 195,  65, 255, 235,  69, // ...[....A..E
+ 118,  94,  88,  52, 198, 217, 189,  13,  97, 248,  88, 130, // v^X4....a.X.
+ 220, 237,  62, 176, 210, 163, 217,  70, 180, 197,  76, 116, // ..>....F..Lt
+  93, 189, 218,  65, 246,  39, 157,  77, 219,  42,  30, 242, // ]..A.'.M.*..
+ 135, 160,  26, 244,  27,  55,  31,  80, 128, 121, 223, 104, // .....7.P.y.h
+ 109,  53, 154, 220,  70, 150, 172,  98,   6, 132, 153,  61, // m5..F..b...=
+ 230,  67,  38,  91, 220, 102, 226, 244,   0, 128, 142,  11, // .C&[.f......
+  94, 227,  50,  11, 199, 139,  91, 159, 130, 104, 232, 251, // ^.2...[..h..
+ 182, 162,  95, 250, 191, 169,  12,  33, 124,  45, 108, 224, // .._....!|-l.
+ 107, 163, 158, 222, 171, 124,  90, 221, 199,  36, 172, 175, // k....|Z..$..
+  63, 178,  11, 184,  33, 226, 192,  67, 107,  31,  97, 126, // ?...!..Ck.a~
+  10, 164, 234, 182, 229,   7, 101,  62, 148, 148,  66, 116, // ......e>..Bt
+ 228, 215,  10, 235, 226, 209,  99,  14, 207,  54,  13, 158, // ......c..6..
+  25,  30, 172,  59, 207,  93, 242,  74, 250, 154, 233, 135, // ...;.].J....
+  45, 101,  78, 101, 106, 231, 119, 193, 125,  50,  75,  35, // -eNej.w.}2K#
+ 234, 147, 174, 209,  84, 216, 172, 121,  78,  28, 122, 157, // ....T..yN.z.
+  86,  48, 237,  99, 253,  61,  97,  50, 216,  25,  86, 218, // V0.c.=a2..V.
+  52, 216,   0, 134,  57, 229, 174, 249,  97,  43,   0, 222, // 4...9...a+..
+ 118, 233,  52,  12, 123,  13,  50, 222, 177, 219,  48,  15, // v.4.{.2...0.
+  44,  73, 127, 100, 126, 187,  34, 180, 109,  49, 181,  16, // ,I.d~.".m1..
+ 200, 109, 242,  39, 235, 254, 139, 100, 162, 189, 146, 236, // .m.'...d....
+  93, 145,  97,  12, 223, 207, 187, 119,  15, 139, 154, 187, // ].a....w....
+  95, 223, 180, 182, 123, 168,  56, 146, 222, 140, 234, 234, // _...{.8.....
+  43, 195,  75, 108,   8,  47, 177, 213, 216, 182,  31,  29, // +.Kl./......
+ 110, 225,  30, 119,  11,  20, 144, 141, 155, 208, 218,  78, // n..w.......N
+  49, 116,  82,  96,  58, 157, 219,  93, 149, 229,  82,  88, // 1tR`:..]..RX
+  90,  70,  60, 195, 223, 118, 205,  66, 208,  17, 123,   3, // ZF<..v.B..{.
+  33, 167,  76,  42,  76,   3,  39, 121, 221,  62, 192,  24, // !.L*L.'y.>..
+ 143, 240, 224, 153,  33, 236,  26,  22, 201,  16,  92, 102, // ....!......f
+ 173, 120, 199, 157,  33,  81,  40, 169, 126,  43,  11, 204, // .x..!Q(.~+..
+ 235, 230,  27,  93, 187, 239, 107,  88, 229,  13,  35, 252, // ...]..kX..#.
+ 108,  23, 168, 148, 179, 142, 176, 186, 187, 109, 176, 113, // l........m.q
+ 187, 186,  23,  81, 197, 180, 109, 166,   7, 229, 114,  39, // ...Q..m...r'
+ 211, 188, 180, 125, 200, 117, 172,  23, 216, 112,  22, 182, // ...}.u...p..
+ 118, 193,  75, 118, 218, 133, 164, 194, 219,  57, 143, 228, // v.Kv.....9..
+  71,  44,  64, 140, 180, 218,  49, 191,  44, 217, 118,  68, // G,@...1.,.vD
+ 178, 237,   8,  23, 192,   5, 201, 110,  47,  72, 146,  60, // .......n/H.<
+  30,   8, 126,  48,  51, 203, 143,  93,  65,  46, 145,   9, // ..~03..]A...
+ 229, 247, 181,  36, 189,  27, 125, 186, 157,  42, 250, 228, // ...$..}..*..
+  89, 200, 235, 193,  28, 139,   4, 213, 209, 118, 101,  67, // Y........veC
+ 144,  85,  73,  13, 179, 139,  85, 108, 203,   3, 143,  58, // .UI...Ul...:
+  50, 152,   6,   7, 140,  82, 145, 191,  68,   2,  49, 243, // 2....R..D.1.
+ 137,  39, 170, 161, 102, 249, 101, 148,  87, 244, 192, 223, // .'..f.e.W...
+ 172,  55, 123,  32, 130, 202,  22, 139,  27, 175, 183,  68, // .7{ .......D
+ 253, 186,  37,   0, 218, 236,  26, 157, 226,  22, 239, 196, // ..%.........
+ 109, 178, 201,  12,  79,  92, 187, 232, 138, 125,  15, 179, // m...O....}..
+ 253, 162, 236, 120, 205, 164, 120, 247,   1,  50, 128,  76, // ...x..x..2.L
+  50, 205, 221, 216,  22, 182,  99, 155,  89, 173,  77, 158, // 2.....c.Y.M.
+ 214, 197, 239, 174,  60,  32, 223,  98,   2, 209, 207, 238, // ....< .b....
+ 198, 195, 198,   3,  86, 199, 209, 203,  22, 143, 129,  65, // ....V......A
+ 143, 105, 242, 215, 197, 219, 135,  44, 222,   8, 163, 191, // .i.....,....
+  33,  63, 219,  34,  93, 252,  43, 210, 237, 116, 252,  95, // !?."].+..t._
+ 182, 153, 105, 118,  17,  13, 146, 109,  55, 170,  26,  18, // ..iv...m7...
+ 195, 105,  18, 159, 153, 205,  89, 192,   0, 165,  69, 152, // .i....Y...E.
+  45, 181,  23, 109, 171,  25, 108,  27, 101,  90, 135,  23, // -..m..l.eZ..
+  81, 198,  42, 219, 245, 182,  72, 104,  15, 204, 236, 248, // Q.*...Hh....
+  13,  50, 244,  70, 219, 170, 155, 118,  13, 185, 170,  72, // .2.F...v...H
+ 179, 157, 182, 177, 254, 233,  52, 170,  51,  20, 206,  61, // ......4.3..=
+ 210, 249,  54, 109, 148,  60, 158, 108,  20,  27, 254, 137, // ..6m.<.l....
+  41,  90, 109,   7, 121, 187,  40,  39, 141, 167, 231, 255, // )Zm.y.('....
+ 245,  82,  74,  67, 164, 219,  93, 209, 246, 109, 201, 174, // .RJC..]..m..
+  80, 177,   9,  36, 114, 172, 252, 194,  86,   0, 124, 201, // P..$r...V.|.
+  67, 233, 222, 118,  41,  77, 160,  52,  89, 171,  31,  22, // C..v)M.4Y...
+   4, 252,  50, 173, 219, 222, 108,   8, 181,  22, 171,  21, // ..2...l.....
+ 187,  89, 243, 219,  55, 241, 169, 204, 190,  48, 217, 223, // .Y..7....0..
+ 102, 185,   8, 239, 221,  98, 159, 195, 249, 156, 166, 231, // f....b......
+ 102, 233, 249,  79, 172, 243, 141, 154, 120, 205, 118,  86, // f..O....x.vV
+ 155, 130, 100, 237, 146,  43, 171, 214, 104, 214, 166, 255, // ..d..+..h...
+ 162,  42, 239, 168, 132, 185, 189, 255, 186, 106, 152, 242, // .*.......j..
+ 191, 102, 251, 171, 110, 101,  47, 193,  24, 100,  97,  39, // .f..ne/..da'
+ 132,   5, 247, 215, 246, 179,  35, 230, 112, 172,  65, 149, // ......#.p.A.
+  48, 204,  34, 110, 224,  76,  77,   3, 247,   6,  14, 212, // 0."n.LM.....
+ 124, 173,   6, 147, 137, 159, 171,  65,  28,  78,  38, 240, // |......A.N&.
+ 159, 163,  90, 173,  86,  50, 243, 130,  29, 183, 173, 194, // ..Z.V2......
+  22, 223,   0, 246, 199, 223,  26, 141, 199, 147, 139, 147, // ............
+ 198,  69, 164,  47, 159, 166, 212,  13, 163, 237, 222, 160, // .E./........
+ 230,  83, 242, 123,  55, 201, 172, 193,   5,   4,  78,  52, // .S.{7.....N4
+  72, 147, 198, 189, 155, 184, 223, 119, 156,  25, 246, 117, // H......w...u
+ 175,  99,  29, 220, 187, 201, 249, 155, 202, 185, 227,  66, // .c.........B
+  52,  74, 114,  35, 247, 141, 249,  19, 120,  71, 159,  81, // 4Jr#....xG.Q
+  51, 255,  80, 131, 224, 143,  59, 235,  21,  18, 207, 251, // 3.P...;.....
+ 203, 226, 169, 176, 220,  68, 254, 123, 200, 127, 108, 237, // .....D.{..l.
+ 114,  17, 183,  79, 120, 209, 254,  71, 207,  88,  20, 155, // r..Ox..G.X..
+  47, 103,   7,  93, 251,  47, 151,  86,  81, 232, 151, 229, // /g.]./.VQ...
+ 213, 191,  61, 198, 117, 136,  59, 127, 244, 172,  22, 181, // ..=.u.;.....
+ 117, 154,  78, 242, 194,  93,  38, 187,   7,  93,  23,  11, // u.N..]&..]..
+ 243,  17,  13, 149,  29,  29,  59,  90,  81,  50, 158, 230, // ......;ZQ2..
+ 239, 245, 136, 134,  75, 103, 153, 159,  96, 208, 210, 153, // ....Kg..`...
+  61, 105, 147,   5, 149, 177, 123, 204, 105,  27,  36, 183, // =i....{.i.$.
+  17, 140, 227, 114, 156,  56, 244, 222, 141, 158,  31, 168, // ...r.8......
+ 153, 140, 104, 202,  35,  80, 156,   5, 236,  87, 177, 225, // ..h.#P...W..
+  49,  65,  60, 177,   5, 229, 121,  19, 178,   5,  67, 242, // 1A<...y...C.
+ 222,  77,  54, 227,   7, 156, 155,  84, 154,  80,  79,  79, // .M6....T.POO
+  80,  72,  49,  44, 121, 154, 198, 121,  68,  57, 129,  63, // PH1,y..yD9.?
+   4,  15,  74, 180, 243, 199, 236, 111, 246, 205, 207, 102, // ..J....o...f
+ 106, 252, 229, 190,  47,  65, 213, 199, 112,  41,  79, 248, // j.../A..p)O.
+  16, 254, 229,  30,  39, 210, 227, 226, 116, 222, 144, 170, // ....'...t...
+ 158, 112, 181, 166,   1,  57, 234, 139, 103, 246,  72,  90, // .p...9..g.HZ
+ 181, 210,  97, 116,  97, 171, 153, 196, 112,   8, 213, 176, // ..ata...p...
+  40,  95, 214,  35, 245,  50, 110,  72,  83, 248, 124, 191, // (_.#.2nHS.|.
+ 147,  97,  66,  56,  13, 105,  67,  60,  51, 216, 115, 239, // .aB8.iC<3.s.
+ 102,  52,  51,   9, 208,  33, 167,  26, 253, 120, 157, 218, // f43..!...x..
+  89, 158,  34,  60,  93, 108, 103,  30, 229, 177,  38, 248, // Y."<]lg...&.
+ 240, 147, 131,   9,  69, 210, 132, 189,  50, 250,  41, 189, // ....E...2.).
+ 157, 211,   4, 212, 211, 177, 159, 217, 119,  24,  46, 249, // ........w...
+ 145,  42, 174, 101, 157, 168,  97,  52, 193, 201, 186, 161, // .*.e..a4....
+  63,  80, 152, 211, 254,   8, 189,  31, 155,  19, 174,  67, // ?P.........C
+ 193,  48, 202, 184, 207, 238, 172,  60, 190,  92, 230, 116, // .0.....<...t
+  89,  40, 206, 179, 246, 251,  19, 116, 158, 209, 249,  36, // Y(.....t...$
+ 192,  25, 198, 161, 189, 163,  42, 235, 183,  92, 220, 244, // ......*.....
+  42,  71, 157,  86,  58, 246,  22,  40,  91, 210, 115, 246, // *G.V:..([.s.
+ 188, 226, 241,  41,  71, 183, 184,  26, 109, 209, 227, 164, // ...)G...m...
+ 233, 145, 163,  78,  60, 133, 180,  69,  82,  57, 213, 116, // ...N<..ER9.t
+ 119, 106,  62, 207, 169, 106, 232,  45,  46, 124, 237, 128, // wj>..j.-.|..
+ 154, 175, 187,   6, 180,  97, 224,  74,   1, 181, 251, 179, // .....a.J....
+ 248, 220, 145, 155, 246, 251, 149,  35,  91, 112, 213, 238, // .......#[p..
+ 225,  20, 210,  50,  39,  58, 173, 129, 185, 255, 233, 212, // ...2':......
+   2,   3, 199, 147, 196, 201,   1, 122,  68, 176, 228, 107, // .......zD..k
+ 132, 248, 163,  72, 211, 193, 233,  37, 194,  24, 162, 172, // ...H...%....
+ 102, 192, 168,  33, 131, 219,  91, 147,   0, 205,  43,   6, // f..!..[...+.
+  24, 109,  46,  97, 143, 242,  35,  64, 127,  86,  36, 154, // .m.a..#@.V$.
+ 142,  41, 201, 137, 153,  15, 227,  89, 131,  81, 177,  50, // .).....Y.Q.2
+ 121,  65, 215,  19, 244, 218, 119,  78, 163, 225,  80,  39, // yA....wN..P'
+ 132, 207, 192,  74,  96, 164,  96, 237, 116, 214, 192, 178, // ...J`.`.t...
+  66,  41,  77,   3, 224,  69,  23,  76, 164, 227, 143, 204, // B)M..E.L....
+  76, 212,   4,  83, 130,  85, 173, 148,  70,  37, 253, 100, // L..S.U..F%.d
+  12, 126, 128,  33, 189, 136, 236,  39, 238,  77,  49, 255, // .~.!...'.M1.
+ 171,  24,  47, 135,  63,  45,  69, 176, 199, 118, 227, 251, // ../.?-E..v..
+  65,  71, 221,  69,  11, 181, 157,  96, 108, 110, 124, 156, // AG.E...`ln|.
+  94,  57,  12,  70,  75, 166, 210, 147,  19,  34, 223, 229, // ^9.FK...."..
+ 168, 155, 251,  27, 133, 164,  84,   8,  70, 217, 182, 243, // ......T.F...
+ 234, 121,  51, 163,  58, 238,  61, 201, 178, 240, 186,  21, // .y3.:.=.....
+  77, 248, 233, 230, 222, 237, 173, 147, 202, 109, 152, 197, // M........m..
+ 109, 158, 114,  27, 144,  57, 117, 123, 166, 175,  39, 148, // m.r..9u{..'.
+  76, 156, 140,   7,  59,   7,  90, 229, 180,  30, 226, 146, // L...;.Z.....
+ 162, 197, 179, 116, 236, 190, 186,  88,  52,  92, 167, 181, // ...t...X4...
+   6,  63, 144, 238, 193, 191, 169, 223,  39, 135, 244, 123, // .?......'..{
+ 120, 223,  91,   7, 130,  47, 182, 129, 242,  29,  16,  65, // x.[../.....A
+  36, 168,  69, 195, 134, 105, 170, 115, 104, 142, 155, 114, // $.E..i.sh..r
+ 145,  92, 187, 244, 198, 250, 255, 158, 175,  95, 247,  59, // ........._.;
+  65, 224, 178,  47,  38, 241, 234, 233,  59, 170,  91,  92, // A../&...;.[.
+ 219, 210, 167, 166, 235,  67, 255,   0,  55, 183,  80,  31, // .....C..7.P.
+  58, 135, 135,  56,  31, 207,  37, 231, 117, 138,  45, 245, // :..8..%.u.-.
+  55,   4,  41,   9, 224, 184, 234, 165,  49,  33, 217,  24, // 7.).....1!..
+ 174,   9,  76,  64, 113, 171,  29,  16,  14, 165,  49, 206, // ..L@q.....1.
+ 253, 225, 245,  22, 104,  49, 173,  78, 156, 149,   6, 211, // ....h1.N....
+ 140, 115, 203,  98,  12, 230,   9, 205,  86, 246,  20, 201, // .s.b....V...
+  17, 246,   3,  17, 150, 124, 115, 102,  44,  19,  45, 131, // .....|sf,.-.
+  93,  50, 254, 127, 171,  77,  48, 221, 178,  31, 200,  90, // ]2...M0....Z
+  16, 132,  22,  17,  98, 203, 232, 148, 100, 129, 235, 193, // ....b...d...
+ 187,   4, 243,  76,  35, 146, 148, 153, 168, 226,  91, 162, // ...L#.....[.
+ 143, 227, 169, 141, 193, 235,  76, 214, 213, 120,  54,  63, // ......L..x6?
+  19,  46, 150, 145, 253, 193,  25,  92,  49,  58, 109, 220, // ........1:m.
+  28, 225, 152,  73, 145,   4, 109,  24,  68, 167, 217, 209, // ...I..m.D...
+ 231,  52, 161, 116, 124,  73,  20,  33, 112, 102, 104, 121, // .4.t|I.!pfhy
+   4, 130, 204, 190,  81, 137,  45,  75, 134, 110,  71, 111, // ....Q.-K.nGo
+ 220, 215, 222,  58,  61, 212,   4,   7,  17, 101, 108, 149, // ...:=....el.
+  83, 224,  36, 177,  91,  19, 253, 130,  38, 181, 220,  77, // S.$.[...&..M
+ 213, 246, 122, 237,  32, 152, 204,  95, 199, 221, 246, 112, // ..z. .._...p
+  91, 210,  66,  48,  95, 105, 129, 106, 167,   1, 123, 147, // [.B0_i.j..{.
+  28, 208,  99,  82, 184, 174,  63,  84, 163,  96, 208, 156, // ..cR..?T.`..
+  42,  28, 153, 222, 105, 118, 182, 219, 247, 221,  78,  51, // *...iv....N3
+ 114,  71,  59, 237, 190, 171, 155,  83, 111, 125, 228, 227, // rG;....So}..
+  90, 144,  97,  80,  32, 103, 160,  31,  79, 251,  83,  95, // Z.aP g..O.S_
+ 239,  12, 250,   3,  31, 199, 184, 185,  39, 239,  94,  33, // ........'.^!
+ 163, 228, 203, 139, 124, 246, 136, 237, 149,  31, 185,  91, // ....|......[
+ 237, 181, 205, 246, 125,  78,  60,  72,  39, 240, 121, 168, // ....}N<H'.y.
+ 174,  57, 184, 105, 131,  39,  81, 194, 215, 107, 204,  20, // .9.i.'Q..k..
+ 101,  56, 165, 216, 147,  89,  48, 196, 125,  30, 231, 184, // e8...Y0.}...
+ 204,  40, 109, 209, 108,  56, 119, 139,  75, 138, 218, 234, // .(m.l8w.K...
+  34,  72, 251,  54, 176, 112,  12, 251, 251, 100,  13, 254, // "H.6.p...d..
+  96,  27, 165, 171, 255,  70,   9,  72,  93,   1, 174, 215, // `....F.H]...
+ 239, 227,  42, 161, 192, 184, 167, 148,   3, 155, 211, 158, // ..*.........
+ 126,  28,  12, 122, 122,  45, 216, 242,  38, 132, 198, 131, // ~..zz-..&...
+ 120,  58, 196,  65, 124, 130, 250, 145, 189, 173, 110, 233, // x:.A|.....n.
+  12, 168, 242, 204,  77, 226,  81, 155,  44,  70, 182,  27, // ....M.Q.,F..
+ 143, 182, 236, 217,  58,   7, 252, 175, 229, 162,  19,  66, // ....:......B
+  12, 199, 206, 128, 147, 112, 122, 162, 239,  94, 238, 152, // .....pz..^..
+ 244, 101, 102, 109, 168, 168, 233, 219, 176, 129, 121, 194, // .efm......y.
+ 102,  52, 109, 163,  96, 127, 132, 176, 122, 185,  77, 198, // f4m.`...z.M.
+ 201, 230, 113, 152,  53, 228, 155,  49, 179, 235, 172,  11, // ..q.5..1....
+ 154, 159,  19, 105, 170,  80, 134,  47,  23,  79, 107,   6, // ...i.P./.Ok.
+  22, 142, 147, 217, 183,  84, 129, 131, 135, 127,   8, 115, // .....T.....s
+ 122, 190, 186, 122, 193,  67,  80,  57, 157, 126, 192, 158, // z..z.CP9.~..
+ 100,  15,   3, 173, 178, 160, 130, 223,  49,  60,  79,  84, // d.......1<OT
+ 190,  19,  56,  56,  46, 252,   8,  79,  85,   6, 207, 193, // ..88...OU...
+ 242,  77, 216,  50, 176, 110, 101, 119,   2, 123,  22, 150, // .M.2.new.{..
+ 189, 104,  48, 190, 143,   9, 121,  38, 224, 145, 134, 238, // .h0...y&....
+ 104, 217, 160,  53, 248,  15, 119, 217, 188,  55,  26, 180, // h..5..w..7..
+  24,  16, 224, 255, 192, 188, 109, 130,  81, 253,  99,  86, // ......m.Q.cV
+  68,  49,  84, 104, 145, 110,  93, 205, 248, 113,  61,  35, // D1Th.n]..q=#
+ 232, 220, 187, 217, 108, 207, 204, 111,   1,  35,  73, 113, // ....l..o.#Iq
+  74,  41, 156,  34, 183,  17, 140,  68,  96, 242, 193, 237, // J)."...D`...
+ 247, 202, 200, 229, 192, 180, 241,  60,  82, 141, 198,  31, // .......<R...
+  51, 111,  86, 199,   0,  26, 159,  77, 108,  38,  64, 177, // 3oV....Ml&@.
+ 181, 173,  26, 219, 176, 167,  82, 130,   3,  20,  74, 159, // ......R...J.
+  91,  29, 133, 200, 173, 174,  66, 208,  86, 151,  26,  12, // [.....B.V...
+ 241,  74,  26, 202, 185, 231,   6, 146, 143,  28, 214, 142, // .J..........
+  83, 192, 189,  69, 174,  93, 234,  48,  13, 197, 140, 139, // S..E.].0....
+ 105, 123,  75,  36, 174,  45,  35, 113, 225,  41, 234, 172, // i{K$.-#q.)..
+ 197, 130, 155, 195,  52,  55,  89, 239, 221,  76, 236, 156, // ....47Y..L..
+ 172, 162, 223, 201,  29,  85, 235, 181, 209, 122, 183, 172, // .....U...z..
+  94,   0,  82, 135,  68,  19,  59,  72, 120,  62, 154, 171, // ^.R.D.;Hx>..
+  26,  52, 218, 177,  64, 100,  97, 165,  97, 218, 123,  13, // .4..@da.a.{.
+ 182, 168, 217, 233,  52, 187, 247, 197,  99,  27,  77, 110, // ....4...c.Mn
+  67,  93, 102,  75,  10, 105, 138,  92, 176, 172, 133, 205, // C]fK.i......
+ 162, 137, 128, 180, 106, 220,  89, 172,   7, 217,  75, 211, // ....j.Y...K.
+  82, 138, 178,  24, 134, 235,  36, 147, 122,  50,  77, 142, // R.....$.z2M.
+ 254, 171,  65, 178,  97,  64, 242, 240, 110, 144, 148, 245, // ..A.a@..n...
+  91, 208,  80, 134, 235, 224, 193, 246,  50, 164, 140, 195, // [.P.....2...
+  99,  29,  91, 233, 113, 145,  85,  60,  90,  20,  29, 105, // c.[.q.U<Z..i
+ 146, 210, 242, 216,  86,  52, 121, 105,  89,  36,  10, 104, // ....V4yiY$.h
+ 150, 200, 212,  46, 145,  36,  16,  17, 125, 139, 204, 202, // .....$..}...
+  56,   9, 146, 102, 172, 166, 193, 220, 226,  72, 243, 155, // 8..f.....H..
+ 150,  21,  55, 125, 204, 215,  25, 239,  36, 253, 196,  79, // ..7}....$..O
+ 189, 102, 236, 173,  79, 176, 200,  96, 225,  92,  70, 147, // .f..O..`..F.
+  43,  34, 162, 189,  72, 124, 153,  48,  42,  68,  86, 168, // +"..H|.0*DV.
+ 108,  36, 210,  34, 114, 214,  53,  25, 247, 110, 168, 237, // l$."r.5..n..
+ 247, 167, 179, 127, 244,  32, 114, 247, 255, 192,  17, 219, // ..... r.....
+  19, 110, 160, 207,  50, 248,  31, 194,  62, 207,  85, 199, // .n..2...>.U.
+  36, 209,   2, 122,  73, 115,  74, 128, 166, 179, 127,  44, // $..zIsJ....,
+ 131, 232, 181, 123,  35, 146, 165,  22, 145,  48,  87, 225, // ...{#....0W.
+  96, 160, 199,  57, 241, 221, 172,  75, 130, 140, 201,  10, // `..9...K....
+ 227, 180, 148,  30, 179,  66, 238, 140,  84, 133, 215,  33, // .....B..T..!
+   1, 147, 189, 194,  76,   1, 239, 129, 129, 247, 104,  65, // ....L.....hA
+ 126, 212,  30,  84,   0,  38, 144,  56,  56, 143, 221,  53, // ~..T.&.88..5
+ 177, 115, 245, 133, 192, 165,  11,  33,  52,   9, 165, 196, // .s.....!4...
+ 109, 160, 104,  92, 222, 248,  88, 246, 122, 142, 145,   2, // m.h...X.z...
+  96, 158, 238,  24, 150, 113, 200,  82,  29,  95, 217,  53, // `....q.R._.5
+  39, 214,  13, 203, 123,  91,  85, 241,  46,  87, 103, 205, // '...{[U..Wg.
+ 170, 188, 229, 156,   7, 183,  21, 123,  13,  12, 124, 248, // .......{..|.
+ 107,  48,  62,  95,  42, 202, 244, 100, 102, 101, 137, 185, // k0>_*..dfe..
+ 172,  74, 174, 162, 126,  65, 159, 239, 117,  56, 212,  89, // .J..~A..u8.Y
+  47, 166, 236, 225, 240, 137,  48, 248,  79, 167,  36,  50, // /.....0.O.$2
+ 103, 240,  63,  28, 183, 100,  60,  22,  29, 148, 253,  17, // g.?..d<.....
+ 142, 163, 117,  76,  28, 250, 209, 201, 130, 127, 120, 185, // ..uL......x.
+ 244, 219, 155, 253, 209, 123,  70,  19, 188, 149, 164, 151, // .....{F.....
+ 198,  21,  77,   6, 143, 180, 122,  50, 141, 115,  90,  23, // ..M...z2.sZ.
+ 225, 144,  90, 203, 229, 196,  55, 231,  58,  63,  77, 135, // ..Z...7.:?M.
+ 190, 243, 238, 237, 254,   7,  71,  29, 167, 195, 107, 159, // ......G...k.
+ 248,  75, 145,  87, 193, 171, 225,   2, 153, 244, 140,  66, // .K.W.......B
+  42, 242, 108, 219, 107,  25,  63, 102, 226, 195, 136,  29, // *.l.k.?f....
+ 108,  71, 230, 198, 113, 149, 181, 142, 175, 115, 253, 218, // lG..q....s..
+ 248, 231,  47,   0, 180, 186, 122,  55, 220, 148,  67,   4, // ../...z7..C.
+ 137, 228, 147,  41, 113, 155, 229,  53, 106,  40, 187, 208, // ...)q..5j(..
+ 178, 137,  48,  74,  57, 105, 150, 242, 229, 215,  99, 123, // ..0J9i....c{
+ 215, 251, 234, 106, 241,  42, 222, 167,  24, 107, 249, 158, // ...j.*...k..
+  20,   3, 127,  17,  80, 136, 121,  94, 188,  57, 133,   6, // ....P.y^.9..
+  95, 166,  66,  80, 211, 225,  16, 127, 194,  19,   6,   8, // _.BP........
+  97, 229, 113, 204,  28, 209,  58,  45,  87,  28,  24, 190, // a.q...:-W...
+  33, 234, 179,  51, 144, 136, 130, 124, 119, 216,  26,  37, // !..3...|w..%
+ 183, 183, 195, 162, 125, 182, 105,  64,   3, 115, 159, 112, // ....}.i@.s.p
+ 193, 204, 148,  32, 209,  12,  30,  72, 149,  65,  14, 167, // ... ...H.A..
+ 102,  51, 131, 221,  36, 216,  87,  68, 153, 108,  54,  39, // f3..$.WD.l6'
+ 147,  76,  12, 143,  55,  88, 166, 108, 186,  34, 249, 251, // .L..7X.l."..
+  28, 166, 135,  85, 185,   3, 196, 181,  16, 189, 197, 239, // ...U........
+  13, 209, 181,  65, 175, 184, 160, 218,  72, 168, 224,  75, // ...A....H..K
+ 215, 189, 254,  18, 174, 135, 168, 209,  60, 251, 193, 213, // ........<...
+ 148, 108, 232,  28, 235,  98,  53, 204,  69, 176, 145, 200, // .l...b5.E...
+  75, 254, 232, 171, 122, 230, 116,  54, 155,  99, 105, 252, // K...z.t6.ci.
+ 249, 150,  61, 142, 206,  79,  26, 147, 108,  32, 218,   2, // ..=..O..l ..
+ 171,   3,  49,  52, 186, 222, 144, 138,  74, 224, 111, 224, // ..14....J.o.
+ 142, 196, 159,  72, 197, 113, 200, 241, 194,  44, 132, 135, // ...H.q...,..
+ 153, 192, 153,  54, 211, 209, 200,  81,   9, 222, 132,   0, // ...6...Q....
+ 227,  34,  87,  38, 244, 124, 151, 175, 232, 171, 113, 163, // ."W&.|....q.
+ 175,  99, 206,  56, 171,  48, 112, 248, 236,  50, 241, 162, // .c.8.0p..2..
+ 142,  28,  74, 166,  69, 202, 249, 123,  27,  50, 223,  32, // ..J.E..{.2. 
+ 152, 174,  57, 244,  28,   5, 162, 228, 130, 242, 203,  33, // ..9........!
+  34, 234,  20,  90,  32, 135, 168, 103, 169,   0,  59,  53, // "..Z ..g..;5
+ 239, 226, 235,  67, 157, 152, 207,  88, 135, 200,  71, 139, // ...C...X..G.
+ 252, 240,  56,  54, 183, 185,  92,  64,  85, 194, 218,  74, // ..86...@U..J
+ 146,  83, 156, 225, 120, 124, 101,  63, 137, 117,  41, 239, // .S..x|e?.u).
+  65, 186, 140,  18, 170,  70,  93,   5, 215, 125, 171, 132, // A....F]..}..
+  19,  23, 253, 199,  20,  34, 145, 242, 125,  73, 223,  73, // ....."..}I.I
+ 120,  17, 157, 132, 240,  33, 198, 132, 175, 192, 179,  61, // x....!.....=
+ 227, 168, 111, 228, 154,  11, 201, 173, 199,  28,  35, 150, // ..o.......#.
+  67, 149,  71, 100,  15, 158, 184, 194,  40, 153, 176,  82, // C.Gd....(..R
+  67, 174, 172, 135, 191, 184, 162, 152, 179, 170, 179, 157, // C...........
+  59, 179, 226, 254,  63,  81,  19, 178,   3,  94, 155, 249, // ;...?Q...^..
+ 181, 189,  16,   2, 119,  13, 209,  88, 179, 247, 164,  53, // ....w..X...5
+ 103, 124, 229, 148, 105, 118, 231,  29,  62,  93, 181,   6, // g|..iv..>]..
+  68, 139, 115, 109, 188,  59,  85, 110, 245,  49,  29,  89, // D.sm.;Un.1.Y
+  93, 221, 115,  83,  92, 118,  43, 223, 124, 249,  32,  53, // ].sS.v+.|. 5
+  67, 103, 249,  83, 246, 211,  66, 145,  36, 101, 164, 101, // Cg.S..B.$e.e
+  21, 247, 106,  23, 214, 237, 194, 185, 214,   5, 209,  32, // ..j........ 
+  92, 116, 136,  42, 247, 121,  49, 248,  89, 135, 103, 123, // .t.*.y1.Y.g{
+ 225, 184,   4, 224,   7, 110,  24,  95, 234, 101, 197, 124, // .....n._.e.|
+ 217,  44, 137, 193, 178,  57, 107,  57,  58, 162, 156, 181, // .,...9k9:...
+   4,  79, 207, 233,  69,  43, 193, 190, 185, 110, 154, 157, // .O..E+...n..
+  36, 113, 143,  91,  37, 179,  23, 169, 125, 115,   5, 117, // $q.[%...}s.u
+ 228, 169, 246,  78,  78, 114, 255,  14, 174, 230, 217,  73, // ...NNr.....I
+ 111, 111, 147, 157, 172, 143,   1, 139,  61, 255, 140,  31, // oo......=...
+ 210, 178, 207, 213, 150, 169, 231, 181, 175,  39, 193, 205, // .........'..
+  24, 151, 124,  95, 192, 117, 219,  76, 189,  11, 110, 104, // ..|_.u.L..nh
+ 254,  60,  81,   3, 185, 181,  28,  97, 101,  87, 158, 150, // .<Q....aeW..
+  48,  94, 162, 249, 213, 136, 233, 191, 243, 159,  84,  70, // 0^........TF
+ 238,  89,  53, 199,  50,   5, 240, 178,  76, 239, 231, 134, // .Y5.2...L...
+  18, 138, 107, 234, 165,  89, 247, 218,  87,  15,  71, 242, // ..k..Y..W.G.
+ 103,  39, 112,  19, 184,  19, 203, 203,  11, 247, 196, 229, // g'p.........
+  31,  49, 139,  59, 157, 158, 167, 119, 242, 131,  52, 200, // .1.;...w..4.
+ 250, 241,  90, 178, 179, 211, 241, 255, 116,  93, 122, 243, // ..Z.....t]z.
+ 136,  59,  62, 236, 199,  65,  74, 124, 103,  90, 220, 111, // .;>..AJ|gZ.o
+ 216, 132,  19,  43,  74, 158,  28,  54,  53, 113, 145, 113, // ...+J..65q.q
+ 217, 152, 151, 101,  99,  10,  87, 100,  65,   7, 183,  23, // ...ec.WdA...
+  16, 183, 213,  75, 119, 128,  71, 241,  14,  21, 149, 174, // ...Kw.G.....
+   5, 236, 107, 223, 184, 102,  60,  72, 173,  23, 165,  70, // ..k..f<H...F
+  81,  77, 179, 226,  84, 255, 183, 121, 124, 197, 250, 204, // QM..T..y|...
+  46,  28,  19, 118, 156,  46, 110, 178, 225, 207,  62, 237, // ...v..n...>.
+ 187, 250,  62, 238, 123,  88,  15, 104,  92,  93, 189, 142, // ..>.{X.h.]..
+ 119,  10,  48, 126, 143,  34,  98, 159, 131,  32, 238, 235, // w.0~."b.. ..
+ 212, 215,  25,  81,  36, 151, 179, 252, 233, 255, 232, 185, // ...Q$.......
+ 145, 251,  61, 174,  87, 131, 168, 140, 208, 172, 255, 163, // ..=.W.......
+ 255, 167, 132, 230,   8, 157,   6,  58, 118,  99,  21, 122, // .......:vc.z
+  68, 171, 248, 173, 244, 218, 204,  69, 242, 221,  54,  33, // D......E..6!
+ 253,  82, 194, 107, 146, 177, 155, 161,   7, 140, 195, 165, // .R.k........
+  11,   3, 132,  12,  84, 115, 130, 114, 104,   8, 186, 104, // ....Ts.rh..h
+   1, 241,  23, 211, 251,  52, 163, 130, 193, 253,  12,  13, // .....4......
+  13, 112, 127, 162, 154, 218,  91, 128, 212,   0,  42, 126, // .p....[...*~
+ 234, 117, 229, 202, 229,  87, 243,  80,  40, 193,  82, 113, // .u...W.P(.Rq
+ 153,   9, 135, 116, 184, 166,  59, 104,  83, 253,   2, 152, // ...t..;hS...
+  20, 183, 207, 183,  49,  61, 175,  87,  87, 139, 226,  98, // ....1=.WW..b
+ 215, 250, 156,  27, 234, 139, 104, 160, 223,  69,  87,  58, // ......h..EW:
+ 126,  15, 134, 163, 167,  87, 228, 190, 244,  32, 193, 189, // ~....W... ..
+ 160, 207, 220,  11, 166,  40, 234,  41,  94,   2,  94,  22, // .....(.)^.^.
+ 247, 112, 133, 155, 251, 135,  75, 178,  73, 147,  87, 238, // .p....K.I.W.
+  41,  31, 170, 128, 108, 208, 108, 181, 219, 157,  25,   8, // )...l.l.....
+ 173, 215,   8, 147,  97, 195,  37, 185, 101,  62, 205,  90, // ....a.%.e>.Z
+ 153, 230,  15,  15,  69,  31, 179,  71,  71, 148, 204,  40, // ....E..GG..(
+ 239, 242, 229, 106, 211,   9,  45,  28, 242, 125,  68, 176, // ...j..-..}D.
+ 155,  25, 118, 238, 231, 224, 230,  28,  14,  23,  54, 212, // ..v.......6.
+ 152, 184, 246,  86, 103, 166,  62,  98,  94,  14, 253, 182, // ...Vg.>b^...
+ 154, 164,  35,  67, 182,  57,   5, 205, 209,  79, 148, 152, // ..#C.9...O..
+ 228, 167, 143,  44,  61, 125, 172, 204, 207,  23,  37,  52, // ...,=}....%4
+  45,  98, 127, 112,  99, 175, 255, 214, 208,  79, 223, 253, // -b.pc....O..
+ 216, 162,  66,   9, 127,  62, 182,  80,  44,  33, 113,  91, // ..B..>.P,!q[
+ 138, 254, 216,  66, 225, 193, 198, 253, 149, 149,  68,  73, // ...B......DI
+ 242,  79,  85, 239, 171, 111, 106, 164,  79,  28, 146, 234, // .OU..oj.O...
+  62, 110, 171,  46, 146, 216,  74, 138,  43,  78, 168, 141, // >n....J.+N..
+ 184, 189,  15,  10,  26,  66, 235,  55, 110, 130, 186,  85, // .....B.7n..U
+  27, 138, 156,  55, 110, 106,  63,  66, 142,  57,  13, 179, // ...7nj?B.9..
+ 161, 106, 234,  16, 168, 138,  72, 254, 198, 231, 148, 163, // .j....H.....
+ 209,  88, 254,  28, 112,  44, 127, 114, 234,  17,  71, 163, // .X..p,.r..G.
+ 237,  40, 107, 204, 177, 246, 107,  24, 228,  77,  77, 203, // .(k...k..MM.
+ 170,  78, 221,  33, 174, 115,  34, 154, 137, 233, 160,  24, // .N.!.s".....
+ 251, 105,  65, 165, 143, 212,  61, 241, 154, 167, 240, 130, // .iA...=.....
+ 173, 155, 143, 118, 134, 183, 183, 231,  59, 157,  54, 200, // ...v....;.6.
+ 238, 144, 228, 208, 246,  10,  16, 143, 126, 177,  45,  48, // ........~.-0
+  12, 144,  68,  17, 158, 143,  86,  87, 167,  20, 131, 121, // ..D...VW...y
+ 145,   1,   3,  41, 104, 188, 186,  58,  88,   9, 154,  28, // ...)h..:X...
+  22, 225, 186, 100,  25, 212, 139, 128,  74,  60, 185, 189, // ...d....J<..
+ 133,   2, 247,   8,  51, 172, 211,  86, 127, 162, 210,  11, // ....3..V....
+ 204, 154, 107,  76,  33, 204, 144, 230, 197, 125, 151, 176, // ..kL!....}..
+ 122, 216,   7, 166, 247,  91,  29, 191, 227, 103, 158,  58, // z....[...g.:
+  90, 167, 150, 168,  71,  30,  45, 223, 211,  29,  77, 133, // Z...G.-...M.
+ 172, 160, 102, 119, 131,  30, 183, 183, 215,  59, 236,  88, // ..fw.....;.X
+ 178, 203,  31, 211, 157, 107, 175, 175,  67, 146, 224, 142, // .....k..C...
+ 209, 199,  80,  93, 237, 208, 156, 208,  59, 193,  85, 255, // ..P]....;.U.
+ 202, 215, 218, 189,  82, 215,  84, 221,  37,  87,  71, 211, // ....R.T.%WG.
+ 112, 173,  82,  93,  46, 213,  69, 149, 234, 246, 130, 124, // p.R]..E....|
+ 103, 192, 213, 141, 165, 186, 241, 237, 237,  96, 231, 210, // g........`..
+  84,  71,  31, 151,  59,   3, 175,  79, 125, 245,   7, 234, // TG..;..O}...
+  44, 160, 226,  39, 234, 114, 103, 143, 214,  82, 162, 132, // ,..'.rg..R..
+ 253,  61, 159,  26, 176, 167,  46,  11,  13, 111, 227,  56, // .=.......o.8
+   8, 206,   8, 136,  65, 112,  76,   5, 156,  65, 210,  39, // ....ApL..A.'
+  26, 112, 172, 206,  14, 121,  97, 250, 149, 151, 162,  87, // .p...ya....W
+  73,  30, 183, 222,  76, 207, 143, 117, 246, 130,  86, 184, // I...L..u..V.
+  48, 119, 137,  61, 105, 197, 196, 209,  76, 193, 224,  58, // 0w.=i...L..:
+  58, 105, 126, 220,  39, 198, 237,  59,  40, 155, 127, 197, // :i~.'..;(...
+  29,  62, 231, 172, 241,  86,  63, 177,  66,  64, 253,  16, // .>...V?.B@..
+ 252, 212, 122, 247,  74, 125,  79, 143, 240, 120, 162, 254, // ..z.J}O..x..
+ 164, 231,  40,  78, 211,  76, 253,  66, 111,  44, 140, 171, // ..(N.L.Bo,..
+  31, 233, 109, 160, 163,  24, 247, 208, 255, 196, 152, 169, // ..m.........
+ 115, 188,  16, 106, 146, 100, 249,  83, 107,  76, 124, 146, // s..j.d.SkL|.
+  78, 232,   5,   6, 147,  74, 167, 244,  22, 167,  39,  52, // N....J....'4
+  94, 196, 136, 243, 107,  87, 233,  40,   0, 134,   7,  29, // ^...kW.(....
+ 226, 237, 169, 162,  73, 148, 144, 188, 181,  78, 236, 131, // ....I....N..
+  14, 131, 206, 122, 245,  86, 156,  73,  69, 122, 232, 172, // ...z.V.IEz..
+ 185, 237,  91,  26, 114,  87, 255, 155, 222, 217, 217, 232, // ..[.rW......
+ 120,  77,  87, 158,  53, 223, 198,  83,  59, 119, 236, 180, // xMW.5..S;w..
+ 213,  46, 175, 240,  16,  29, 171, 233,   6, 149, 251, 104, // ...........h
+ 151, 120, 166, 238, 107, 159, 157, 227, 202, 165,  61,  35, // .x..k.....=#
+ 128,  75,  43,  61,  14, 140,  68,  66,  83, 104, 200,  30, // .K+=..DBSh..
+  71, 229, 218, 217, 211,  64, 132,  63, 165,  79, 108,  10, // G....@.?.Ol.
+ 172,  58, 189, 133,  27, 122, 197, 103, 168, 221, 201,  99, // .:...z.g...c
+  60, 186,  70, 215,  85, 103, 211, 243, 238,  83, 169, 215, // <.F.Ug...S..
+ 184,  33, 123, 211, 171,  95, 187, 187,  36, 231, 143,  95, // .!{.._..$.._
+ 207, 120, 180,  52, 227, 159,  95, 207, 120, 205, 131, 211, // .x.4.._.x...
+ 150, 155,   3, 238, 149, 183, 138,  54, 180, 217,  75, 235, // .......6..K.
+ 180, 239, 223, 183,  59, 104, 141,  95, 104,  73, 141, 239, // ....;h._hI..
+ 187, 157,  53,  65, 187, 214, 243, 119, 251, 175,  94, 191, // ..5A...w..^.
+ 125, 227, 121, 235, 177,   0, 239, 138,  49, 179, 198, 200, // }.y.....1...
+ 233, 227,  18, 250,  46, 174,  63, 212, 197,  86,  66, 203, // ......?..VB.
+ 241, 104,  61, 226, 107, 238, 172,  70, 175, 204, 118,  57, // .h=.k..F..v9
+ 191, 198,  29,  28,  18,  61,  76,  68, 169, 119, 236,  21, // .....=LD.w..
+ 187,  12,  17, 193,  62, 222, 137, 122, 112, 169, 111, 182, // ....>..zp.o.
+  84, 190, 119,  35, 190, 104, 134,  58,  23,  11, 195, 151, // T.w#.h.:....
+ 123, 149,  93, 137, 118,  47, 177, 187,  30, 186, 167, 109, // {.].v/.....m
+ 182,  48,  72,  14, 244, 225, 253,  24, 171,  62, 173, 223, // .0H......>..
+ 224,  15,  35,  34, 213, 109, 111, 205, 205,  40, 130,  62, // ..#".mo..(.>
+ 240, 160, 111, 197, 235, 122, 136, 101,  63, 149,  77, 140, // ..o..z.e?.M.
+ 169,  92, 176,  72, 184,  55, 165, 208, 153, 117, 217, 159, // ...H.7...u..
+  10,  76, 246, 248,   6, 227,  51, 190, 187, 248, 117, 112, // .L....3...up
+  80,  92, 155,  74, 159, 187,  65, 109, 107,  83, 233, 123, // P..J..AmkS.{
+ 129, 129, 108,  52, 161, 233, 173,  73,   2, 172,   0, 114, // ..l4...I...r
+ 191, 130, 198,  11, 123, 153,  21, 200, 125,  40, 247, 113, // ....{...}(.q
+ 229,  46,   5, 195,  91,  85, 228, 136, 210, 247, 113,  47, // ....[U....q/
+  15, 100,  93,  34,  94, 145, 126, 101,  23, 119, 182, 228, // .d]"^.~e.w..
+  62, 225, 207, 213,  59, 149, 164, 192, 213,  85, 187,  23, // >...;....U..
+  92, 105,   7, 247, 249, 185, 221,  14,  38, 142, 252, 157, // .i......&...
+ 245,  43, 250, 118, 228, 126, 140, 146, 124, 155, 251,  90, // .+.v.~..|..Z
+ 189,  62, 236,   9,  35, 161, 254, 224,  85, 252, 236, 226, // .>..#...U...
+  66, 100, 187,  40, 226, 230, 200, 100,   8,  61, 140, 237, // Bd.(...d.=..
+ 137,  73, 146, 224,  54,  38,  23, 151,  21, 199,   2, 201, // .I..6&......
+ 226, 106, 196, 114, 188,  19,  26, 111,  27, 186, 147, 244, // .j.r...o....
+  18,  26, 111, 246,  96, 140,  90, 233,   9,  49, 132, 189, // ..o.`.Z..1..
+ 131, 198, 197,  61, 130,  94, 225,  46,  84, 215, 156,  34, // ...=.^..T.."
+  63, 247,  42, 105, 122, 197,  13, 130, 104, 104, 221, 231, // ?.*iz...hh..
+  50,  15, 248, 124,  45,  61,  91,  75,  49,  63,  43, 192, // 2..|-=[K1?+.
+ 125,  87,  14,  89, 113, 175,  93, 209,   3, 154, 132,  61, // }W.Yq.]....=
+ 203, 172, 239, 196, 114,  53, 102, 197,  69, 112, 205, 215, // ....r5f.Ep..
+ 104, 226,  97, 248, 225, 139, 180, 143,  66, 233,  69,  81, // h.a.....B.EQ
+  19, 224,  65, 215, 243, 124, 150,   0, 237, 231, 172, 184, // ..A..|......
+ 164, 156,  71, 236, 105,  80, 241,  61,  90, 247, 198, 221, // ..G.iP.=Z...
+  39, 192,  27,  45,  77, 169, 186,  50, 170,  49, 207, 175, // '..-M..2.1..
+ 167,  85, 250,  89, 112, 224, 124,  31,  38, 211,  48, 187, // .U.Yp.|.&.0.
+ 118, 148, 243,  66,  31, 103, 230, 117,  15, 231,  33, 232, // v..B.g.u..!.
+ 249, 100, 156,  69,  49, 127,  35, 244, 251, 105, 162, 249, // .d.E1.#..i..
+  17, 227, 235, 201, 244, 100,  10,  23, 222, 206, 190,  30, // .....d......
+ 231,  26,  51, 129, 222, 223,  18, 158, 202, 219,  27,  18, // ..3.........
+ 132,  76, 224,  51,  61, 144,  87, 234, 224, 123, 170, 114, // .L.3=.W..{.r
+ 159, 214,  43,  46, 112,  47,  53,  47,  31, 166, 122,  34, // ..+.p/5/..z"
+ 111,  63, 235,  97,  98, 223,  63, 156,  78,  51, 243, 250, // o?.ab.?.N3..
+  34, 139, 228, 101,  63,  36,  72, 224, 181, 234, 106, 255, // "..e?$H...j.
+ 101, 237,  10, 116,  25, 245, 182, 218,  16, 209,  80, 255, // e..t......P.
+  22, 232, 247,  66, 138,  94, 226, 118, 129,  64,  63,  43, // ...B.^.v.@?+
+ 191, 136,  43, 221, 163,  63, 190, 126, 166, 248, 241,  74, // ..+..?.~...J
+ 253,  76, 127, 124, 253,  94, 241, 227, 183, 234,  77, 242, // .L.|.^....M.
+  31,  43, 196, 177, 211, 222, 209, 125, 167,  13, 219,  17, // .+.....}....
+ 111, 205,  12,  11,  49, 173, 191, 210,  31, 159, 119,  91, // o...1.....w[
+ 105,  50, 189, 160,   9, 240, 171,  14, 225,  34,  94,  66, // i2......."^B
+ 221, 185, 224,  53, 190, 149, 157,  91, 219, 245,  20, 183, // ...5...[....
+ 195, 174,  99,  45, 124,  29, 112, 122,   2,  82, 126, 234, // ..c-|.pz.R~.
+ 122, 135, 106,  62, 126,  33, 154, 107, 254, 232,  86, 131, // z.j>~!.k..V.
+ 215,  58,  84, 112, 209, 162,  34,  80,  61, 123,  86,  77, // .:Tp.."P={VM
+ 252, 140,  47, 252, 245, 212, 179,  34, 165, 132,   8,  48, // ../...."...0
+ 138,  58, 241, 117,  96, 162, 175,  81, 229, 124, 108,  45, // .:.u`..Q.|l-
+ 242, 229, 203, 106,  21,  47,  83,  26,  75, 212, 241, 178, // ...j./S.K...
+ 168, 195,   4, 169,  83, 191, 178, 195,  94, 137, 168, 136, // ....S...^...
+  71, 121, 191, 211, 245, 243, 157,  78, 183, 159,  55, 241, // Gy.....N..7.
+  54,  83,  79, 158,  32,  87, 167,  91,  43, 170, 239,  60, // 6SO. W.[+..<
+ 217, 163,  33, 121, 183, 231, 168,  48,  92,  26,  31, 158, // ..!y...0....
+ 227, 134, 109, 232, 181, 150,  71,  35, 214,  81, 231, 231, // ..m...G#.Q..
+  53,  80,  70, 201,  52, 215, 220, 248, 243,  18, 148,  54, // 5PF.4......6
+  80, 193,  48, 162,  76, 188, 175, 137,  96,  15,  57, 241, // P.0.L...`.9.
+ 164,  72,  92,   4,  42, 146, 233, 185, 183, 124,  41, 115, // .H..*....|)s
+ 175,  68,  38, 215, 116, 125,  47, 138,  99, 154, 187, 182, // .D&.t}/.c...
+  12,  66,  49, 194,  49,  98,  41, 119, 242,   2, 219, 242, // .B1.1b)w....
+  89,  21,  41,  95,   8,  55, 145, 131, 133, 215,  63,  23, // Y.)_.7....?.
+  62, 220,  15, 112,  13, 239, 250, 239,  55, 238,  65, 216, // >..p....7.A.
+ 252, 124, 184, 230, 253,  62, 187,  61, 248, 183, 155, 195, // .|...>.=....
+ 181, 245, 147, 200, 222, 252, 144, 182, 244,  21, 179,  91, // ...........[
+  61,  47, 145, 181, 209, 185, 161, 197,  33,  38,  41, 148, // =/......!&).
+ 254, 245, 245, 167, 131, 152,  45, 105,  16,  80, 140, 133, // ......-i.P..
+  29, 169,  56, 112, 156, 210, 113, 121, 117, 153, 134, 154, // ..8p..qyu...
+ 128, 200, 246,  90, 176, 176, 238,  37, 184, 205,  28,  63, // ...Z...%...?
+  62, 126, 184, 221,  37, 125, 149,  41, 244,  38, 112,  11, // >~..%}.).&p.
+ 118,  25,  40,   8, 189, 186,  48, 204, 158,  37, 103, 195, // v.(...0..%g.
+ 183,  98,  66,   4, 178,  70, 177, 191, 165,   9,  49, 128, // .bB..F....1.
+ 111, 153,  17, 252,  71,  39, 192,   5, 142, 191,   6,   7, // o...G'......
+  29, 213,  85, 221, 214, 150, 218,  34, 138,  67,  60, 245, // ..U....".C<.
+  37, 228, 146, 102, 231, 129,  66, 172, 220, 172, 193,  65, // %..f..B....A
+ 109,  69,  97,  28, 242,  67, 160, 127,  42, 238,  60, 126, // mEa..C..*.<~
+  11, 231, 220,   1, 238,  81, 192, 206,  12,  45,  26,  63, // .....Q...-.?
+  81, 192, 159, 129, 195, 211, 123, 230,  40, 253,  75, 224, // Q.....{.(.K.
+ 252, 158,  16, 119, 244, 167, 210,  63,  82, 240, 222, 108, // ...w...?R..l
+ 253, 230,  25, 194, 219,  38, 252,  71, 165,  59, 129, 110, // .....&.G.;.n
+ 175,  57, 235,  55, 146, 161,  75, 169, 194,  16, 111,  27, // .9.7..K...o.
+ 244, 118,  58, 243, 111, 206, 207, 103, 148, 144, 120, 238, // .v:.o..g..x.
+   7,  38, 207, 134, 210, 155, 129, 227, 223,  76,  38,  51, // .&.......L&3
+ 167,  50, 190,  91, 229, 106, 195, 198,  50, 196,  43,  61, // .2.[.j..2.+=
+ 104,  19, 127, 152, 224,  17, 211,  32, 119,  55, 239,  39, // h...... w7.'
+ 196, 108, 109, 180, 239, 167,  36, 118, 110,  60, 216, 186, // .lm...$vn<..
+ 111, 149,  49,   7, 208, 136,  16, 199, 108, 186, 186, 129, // o.1.....l...
+ 158,  86, 250, 232,  27, 176, 108,   8,  84,  60, 219, 219, // .V....l.T<..
+ 131,  92, 109,  81,   5,  29, 212, 210, 193, 219,   6, 222, // ..mQ........
+  98,  10, 140,  17,  24,  35,  48,  70,  32, 204,  24, 186, // b....#0F ...
+  84, 249,   6, 253,  71,  35,  30, 208, 255, 109, 250, 223, // T...G#...m..
+  65,  96,  74,  81,  41,  69, 165,  20, 149,  82, 222, 148, // A`JQ)E...R..
+ 162,  83, 245, 144, 254, 111, 211, 255,  71, 244, 191, 131, // .S...o..G...
+  22, 119,  16, 147,  81, 218, 140, 210, 102, 148,  54, 163, // .w..Q...f.6.
+ 116, 153, 138,  40,  36, 162,  92,  17,  82, 209,   7, 222, // t..($...R...
+ 182, 218, 252,  73, 191, 135,  36,  96,  29,  68,  52,  36, // ...I..$`.D4$
+ 170, 114, 175, 253, 146, 159, 206, 161,  58, 232, 162,  58, // .r......:..:
+   7,  68, 158,   7, 238, 203, 137,  83, 133, 161, 251,  74, // .D.....S...J
+ 162,  68,  97,   4, 101, 240,  58,  18, 172, 219, 203,  18, // .Da.e.:.....
+  82, 248, 198,  87, 146,  16, 159, 191,  73,  73, 214, 156, // R..W....II..
+   6,  99, 128,  73,  89, 255, 124,  80,  38,  39,  76, 223, // .c.IY.|P&'L.
+  92, 115,  90,  55,  68,  69, 208, 155, 111, 204, 119, 168, // .sZ7DE..o.w.
+ 170,  87, 158,  27, 154,  67,  60, 177, 154, 170, 129,  26, // .W...C<.....
+ 169, 177,  53, 229,  30, 130, 106, 156,   6, 163, 157,  32, // ..5...j.... 
+  82,  39, 120, 100, 171, 171, 209, 206,  72, 157,   7,  57, // R'xd....H..9
+ 216, 230,  11, 176, 210, 231, 132, 129,  27,  36,  75,   7, // .........$K.
+ 121, 230, 158, 207,  45, 114, 167, 253, 182, 127,  94,  89, // y...-r....^Y
+ 102, 212, 201, 237, 237, 105, 191,  35,  97, 118, 137,  97, // f....i.#av.a
+ 157, 192,  17, 151,   2, 198,  16,  73,  44, 175, 123, 210, // .......I,.{.
+  31, 173, 103,  62, 193,  41,  56, 165,  55, 220, 154, 154, // ..g>.)8.7...
+   6,  23,  65, 112, 221, 191, 240,  41,  15,  85, 120,  52, // ..Ap...).Ux4
+ 183, 124,  38, 234, 168, 186, 170,  81,  95,  61, 105,  94, // .|&....Q_=i^
+ 200, 162,  13,  87, 249, 139, 155, 174, 107, 214,  15, 134, // ...W....k...
+ 115, 205, 157,  74, 136, 201,  93,  16, 179, 140, 136, 217, // s..J..].....
+   0, 218, 206, 204, 242, 110,  17,  58,  59,  89,  75,   8, // .....n.:;YK.
+  47, 167, 107,  49, 253, 118,  80,  67, 212, 204,  33, 178, // /.k1.vPC..!.
+  69,  92, 163, 215, 115,  83, 116, 204,  93, 139, 214,  66, // E...sSt.]..B
+ 105, 132,   7,  29, 195,  80,   8, 107, 234,  85, 238,  12, // i....P.k.U..
+ 200, 130, 116, 103, 212,  31, 249, 152, 174, 215, 107, 238, // ..tg......k.
+ 159,   4, 219, 230, 159,  80, 152, 172, 145,  76, 121, 209, // .....P...Ly.
+ 188,  86, 153, 215,  51, 249,  34, 209, 178, 156, 210,   0, // .V..3.".....
+  68, 208, 239, 156,  86,  22, 171, 181, 211, 218,  50, 180, // D...V.....2.
+  30,  75,  64, 177, 212, 172,  39,  52, 112,  35, 250,  61, // .K@...'4p#.=
+  10, 198, 235,  97,  43, 188, 210,  19,  92, 138, 126,  52, // ...a+.....~4
+  25, 135,   3, 115, 111,  12, 117, 211, 141, 208, 236, 104, // ...so.u....h
+ 109,  68, 211, 207, 237, 128,  93, 167, 190,  64, 199, 123, // mD....]..@.{
+ 190, 211, 177,  27, 184,  44, 154, 158, 172, 157, 171,   7, // .....,......
+ 158, 247, 143, 238,  38, 174,  47, 161, 230,  84, 154, 210, // ....&./..T..
+  36,   1, 116, 167, 195,  87, 106,  52,   9,  54,  81,  51, // $.t..Wj4.6Q3
+ 136, 137,   2, 144, 200,  77, 153,  56,  71, 235, 225,  14, // .....M.8G...
+ 128,  19,  53, 135,   7, 195, 210, 254, 206,  91, 167,  90, // ..5......[.Z
+ 189, 251,  71,   5, 152,  34, 195, 205, 151, 159, 102, 121, // ..G.."....fy
+  24, 206, 102, 172,  77,  57, 208, 219,  74,  63,  82, 250, // ..f.M9..J?R.
+  33, 177, 198,  91,  46,  85, 117, 144, 211,  42, 146, 171, // !..[.Uu..*..
+  60, 230,   0, 168,  39,  43, 178,  74, 158, 212,  84, 122, // <...'+.J..Tz
+ 186,  52, 133,  99, 131,  44, 185, 113, 161, 205, 215, 117, // .4.c.,.q...u
+ 108, 243, 175,  17, 174, 250, 177, 159, 131, 116,  38, 124, // l........t&|
+  71, 156,  62, 216,  62, 164,  16,  77, 107, 225,  90,  92, // G.>.>..Mk.Z.
+ 211, 105, 228, 105, 181, 124,  55, 150,  29,  16,  18,  97, // .i.i.|7....a
+ 205, 124, 170,  76,  49, 104, 234,  10, 193,  40, 218, 161, // .|.L1h...(..
+  66, 105,  77,  37, 121, 232, 160,  84, 236,  23, 215, 108, // BiM%y..T...l
+  39, 214, 110, 213, 138, 128, 216,  94, 135, 182, 177, 142, // '.n....^....
+ 190, 169, 132, 216, 185, 150, 201, 167, 225, 219,  34, 249, // ..........".
+  42,  56,  44, 147, 182, 224,  89,  78,  36, 160, 228,  75, // *8,...YN$..K
+ 206, 131, 100,  37,   8,  87,  87, 135,   7,  93,  18, 242, // ..d%.WW..]..
+ 211, 149,  96, 130, 247,  13, 122, 207,  86, 176, 199,  61, // ..`...z.V..=
+  60, 216, 164, 247, 104,  37,  24, 224, 125, 139, 222,  79, // <...h%..}..O
+  89,  91,  55,  60, 120,  64, 239,  39, 172,  74,  27,  30, // Y[7<x@.'.J..
+  60, 164, 247, 225,  65, 217,  21, 154, 135,  52, 241,  82, // <...A....4.R
+ 154, 106, 153,  26,  16,  85,  25,   5, 167, 106,  28, 156, // .j...U...j..
+ 168, 115,  55, 230, 235,  62,  74,  80, 102, 115, 234, 161, // .s7..>JPfs..
+  98, 254,  74, 112,  37, 101, 180,  12, 232,  70, 227, 131, // b.Jp%e...F..
+  13,   0, 167, 217, 116, 104, 252,  52,  68, 205,  25,  45, // ....th.4D..-
+ 113,  93, 213, 220, 218,  80, 244, 143, 218,  37, 211,  41, // q]...P...%.)
+  15, 131, 155, 201, 105, 122, 137, 139, 124,  98, 217,  21, // ....iz..|b..
+  82,  17, 241,  22,  84, 157, 191, 210,  81, 124, 179, 136, // R...T...Q|..
+  47, 215, 115,  41, 120, 134, 214, 217, 196,  47,  50, 136, // /.s)x..../2.
+  85,  76,  87,  25, 115, 182, 101,  23, 109, 224, 198, 147, // ULW.s.e.m...
+  44, 210, 184, 101, 162, 188,   2, 138, 243, 245, 227, 150, // ,..e........
+ 228, 227, 228, 126, 220,  26, 167,  17, 238,  75, 183, 145, // ...~.....K..
+ 230, 179, 154, 134, 205,  61, 224, 138,  48, 158, 171, 171, // .....=..0...
+  20, 119, 108, 101,  88, 219,  99, 142, 156, 169,  33, 206, // .wleX.c...!.
+ 201,  58, 212, 169, 104, 232, 204,  84,  52, 188,  18,  37, // .:..h..T4..%
+  56, 189,  76, 228, 141,  45,   4,  38, 254, 193, 225,  76, // 8.L..-.&...L
+ 229, 147, 224, 128,  24, 132, 138,  64, 149,  79, 173,  66, // .......@.O.B
+   7,  23, 112, 223,  84, 120,  63, 104, 140,  91, 114,  74, // ..p.Tx?h.[rJ
+ 129, 230,  11,  95,  73, 207,   6,  11, 172,  66, 230,  59, // ..._I....B.;
+ 167,  42,  67,  53, 184, 171, 148, 229,  25, 121, 108,  70, // .*C5.....ylF
+ 229, 216,  92, 225, 231, 154,  71,   9, 103,  83, 121, 104, // ......G.gSyh
+  46, 234,  32, 175,  96,  76,  14, 115,  21, 220, 188, 140, // .. .`L.s....
+ 203, 225, 177, 127,  52, 153,  41, 129, 167,  25, 188, 229, // ....4.).....
+  67,  53, 160,  25, 146, 102,   6, 242, 212, 210, 123, 102, // C5...f....{f
+ 246,  76, 162, 207,  50,   2, 189, 215,  46,  80, 140, 232, // .L..2....P..
+  47,  94,  48, 189, 123, 162, 130, 106, 186, 209, 122,  87, // /^0.{..j..zW
+ 162,  29,  66, 147, 147,  40, 121, 205,  27, 229, 161, 164, // ..B..(y.....
+  52,  97,  31, 210,  49, 130, 204, 253,  29,   6,  15, 184, // 4a..1.......
+ 233,  81, 193, 253, 210,  92, 227,  28, 199, 124,   1, 240, // .Q.......|..
+ 207, 178,  29, 143, 251,  44, 103,  10, 205, 248, 250, 192, // .....,g.....
+  91, 188, 161, 196,  51, 131, 161, 237, 111, 196,  80, 147, // [...3...o.P.
+ 183,  68, 212,  35, 201, 135,  45, 238,  35,  32, 212,  82, // .D.#..-.# .R
+ 228, 251, 134,  98, 144, 139,  11, 145, 242, 102,  51, 133, // ...b.....f3.
+  43, 240, 136, 241,  45, 142,   0, 229,  83, 101, 207,   6, // +...-...Se..
+ 209, 171,  24, 110, 209, 139,  53,   2,  40, 226, 121, 212, // ...n..5.(.y.
+ 243, 129,  42, 141,   5, 138,  47, 182,  36, 160,  47,  66, // ..*.../.$./B
+ 248,  44,  60, 161, 129,  38, 154,   6, 215, 175,  85, 244, // .,<..&....U.
+ 233, 192,  64,  44,  39, 128,  76, 147,  72, 112,  95, 138, // ..@,'.L.Hp_.
+ 183,  70,  44,  57, 205, 183, 116, 140, 187, 199, 194, 147, // .F,9..t.....
+  80, 108,  38, 148, 132, 189,  58,  63, 199, 134,  89, 174, // Pl&...:?..Y.
+ 107, 145,  51, 117, 116, 133,  82, 143,  80,  54,  65,  39, // k.3ut.R.P6A'
+  29,  76,   9, 197, 184,  14, 139, 239,  42,   5,  65, 106, // .L......*.Aj
+ 166, 184, 109, 236, 202, 111, 118, 168, 235, 225,   4, 251, // ..m..ov.....
+  90, 167, 108, 143, 118,  51,  57, 139, 198, 254, 129, 220, // Z.l.v39.....
+ 192, 115,  40, 137, 196, 106, 193,  36, 131, 197,   5, 101, // .s(..j.$...e
+ 107,  43, 248, 145, 198, 179, 152, 192, 184, 154, 236, 213, // k+..........
+ 226, 108, 102,  11,  33,  67,  43, 242, 113,  57, 133,  12, // .lf.!C+.q9..
+  14,  56, 217, 201, 113, 232,  66,   8, 160, 191, 173, 246, // .8..q.B.....
+  67, 207, 177, 116, 140, 146,  15,   3, 253, 206, 189,  65, // C..t.......A
+  62, 117,  99,  92, 158, 234, 241,  12,  23, 151, 218, 136, // >uc.........
+ 161, 186,  97,  60, 236, 180,  17, 124,  82,  73,  47, 245, // ..a<...|RI/.
+ 116,  16, 124,  30, 252, 179, 211,  29,  95,  53,  38, 215, // t.|....._5&.
+ 147,  92, 159,  55, 167, 145, 106,  52, 195, 241,  56, 214, // ...7..j4..8.
+  77,   9,  81,  13, 103,  95, 159, 164, 186, 241, 241, 149, // M.Q.g_......
+ 163,  26, 239, 211, 227,  52,  79,  41, 236, 165,  38, 153, // .....4O)..&.
+  14,  46, 145,  27, 111,  52, 238, 222, 108,  60, 201, 162, // ....o4..l<..
+  48, 166, 136,  55,  20, 223, 216,  15, 147,   9, 133,  77, // 0..7.......M
+ 232, 209,   4, 174, 141,  40, 226,   9,  10, 109, 240,  65, // .....(...m.A
+ 251, 198, 243, 243, 244,  83, 228,  84, 138,  94,  18, 178, // .....S.T.^..
+ 127, 125, 126, 156, 198, 142,  45, 178, 154, 241, 159,  42, // .}~...-....*
+ 191, 128, 169,  75,  60,  36, 198,  57,  63,  87, 249,  81, // ...K<$.9?W.Q
+   5, 116, 140,  71, 206, 149,  99, 129,  56,  85, 204,  58, // .t.G..c.8U.:
+ 249,  91, 109, 117,  18, 142, 253,  45, 153, 155, 244, 197, // .[mu...-....
+ 150,  52, 223,  81, 144, 121, 221,  71, 248, 134, 249, 120, // .4.Q.y.G...x
+  65, 235, 179, 159,  95,  80, 226, 161, 166, 101, 227,  36, // A..._P...e.$
+ 139, 134,  62,   1,  84, 142,  79, 228, 167,  74, 230, 188, // ..>.T.O..J..
+ 159, 159,  16,  34,  33, 229,  57,  60, 238, 105, 148, 214, // ..."!.9<.i..
+  33, 249,  85, 172,  94, 125, 190, 215, 110,  89, 211, 194, // !.U.^}..nY..
+ 105, 158,   2,  23, 137, 132, 229, 122, 232, 119, 216, 234, // i......z.w..
+  84, 135, 188, 109, 218, 164,  39,  99,   8, 209, 248,  10, // T..m..'c....
+ 105, 191, 170,  81, 145, 226, 248, 141, 221, 240, 116,  28, // i..Q......t.
+ 255,  59, 104,  73,  43, 100, 252, 184,  68, 107, 166, 127, // .;hI+d..Dk..
+  70,   5,  79, 194, 194,  36, 208,  87, 108, 200, 145, 226, // F.O..$.Wl...
+ 108,  70,  69, 109,  31,   7,  17, 120,  38, 222, 142,  35, // lFEm...x&..#
+  33, 213, 131,   2,  62, 217, 145,  91,  89,  41, 112,  45, // !...>..[Y)p-
+ 165,   0,  47,  20,  54, 207, 104, 159, 163,   9,  85, 211, // ../.6.h...U.
+ 108, 123,  36,  68, 148, 118,  44,  97, 165,  25, 151, 149, // l{$D.v,a....
+ 217, 101,  24, 233,   3, 190,  33, 173, 197, 240, 152,  28, // .e....!.....
+ 104,  97, 114, 137,  24, 113, 192,  33,  54, 181, 136,  81, // har..q.!6..Q
+ 255, 211, 117, 177, 215,  31, 137, 249, 128, 135, 115,  22, // ..u.......s.
+ 189,  20, 123, 149,  17,  72,  53,  71, 173, 174, 138,  21, // ..{..H5G....
+   0, 243, 240,  41,  91,   1,  88, 130, 221,  27, 166, 141, // ...)[.X.....
+  76,  26,  74,  20, 121, 178,  22, 164,  54, 139,  59,  65, // L.J.y...6.;A
+ 234, 137,  42,  64,  64,  82,  70, 122,  63, 218, 153, 220, // ..*@@RFz?...
+ 222,  82,  65, 212, 225, 203, 211,  40,  38,  54, 100, 135, // .RA....(&6d.
+ 222,  77, 119, 178,  74, 119, 246,  22, 187, 115, 119,  79, // .Mw.Jw...swO
+ 120,  47, 142, 250,  10, 235,  23,   3,   8, 170,  50, 195, // x/........2.
+  30,  60, 242, 251,   7, 217,  33, 245, 148, 173, 100, 226, // .<....!...d.
+ 157, 118, 255, 224, 208, 167, 197, 208, 170, 151, 154, 217, // .v..........
+  78,  92, 203, 213,  76,  60, 213, 140,  77,  62,  40,  86, // N...L<..M>(V
+ 136,  40,  77, 160,  39,  54, 184, 208, 212, 133,  50, 128, // .(M.'6....2.
+  80,  72, 180, 168, 249,  89, 176, 222,  90,  87, 249, 235, // PH...Y..ZW..
+  96, 253, 160, 211, 221, 216, 122, 120,  72,  31, 187, 252, // `.....zxH...
+ 177, 133, 215, 123, 193, 122, 135,  30, 251,  65, 229,  54, // ...{.z...A.6
+  51, 109,  79,  62, 128,  28, 110, 178,  85,  67, 155, 175, // 3mO>..n.UC..
+  94,  78, 255, 145,   4,  65,  27, 214,  72, 196, 142,  18, // ^N...A..H...
+ 175, 214, 202, 211, 231,  87,  98,  15,  74, 147, 223, 245, // .....Wb.J...
+  14, 214, 220, 246, 142, 246, 160,  24, 247, 197, 222, 182, // ............
+ 132, 219, 135, 250,  38, 188,   1,  85,  12, 125,  87,  34, // ....&..U.}W"
+ 224,  82,  21,  72, 202,  29, 122, 176, 135, 252, 144, 190, // .R.H..z.....
+  75,  39, 144,  12, 141,   8,  68, 200,  27,  65, 255, 145, // K'....D..A..
+  66,  18, 140, 220,  71, 244, 210, 156,  60,  14, 251, 145, // B...G...<...
+ 251, 176, 124, 221, 178, 175, 249,  61,  63, 223, 245, 243, // ..|....=?...
+ 215, 126, 126,   6, 177, 117,  74, 157, 185, 103, 229, 163, // .~~..uJ..g..
+ 239,  93,  42, 136,  19, 178,  72,  27,  82, 203, 237, 236, // .]*...H.R...
+ 218, 119, 115, 187,   9,  81, 130,  89, 101,  48, 155, 200, // .ws..Q.Ye0..
+  73, 154,  84,  63, 186,  33, 164, 211,  50, 110,  86, 201, // I.T?.!..2nV.
+  89,  73, 215, 169, 206, 199, 207, 223,   2, 129, 162, 155, // YI..........
+ 115, 221,  47,  26,  27,  17, 103, 156, 150, 187, 216, 217, // s./...g.....
+  14, 117, 114, 121, 115,  55,  84, 126,  70,  45, 205, 214, // .urys7T~F-..
+ 195, 106,  75, 253, 202, 134,  83, 254, 124, 193,  44,  67, // .jK...S.|.,C
+ 232,  73,  34, 236, 184, 124, 228,  66,  92, 140,  45,  89, // .I"..|.B..-Y
+ 254, 100, 129, 160,  93,  47, 208, 218, 141, 127, 157, 214, // .d..]/......
+ 110, 252,  39, 104, 237,  59, 106,  26,  55, 137,  23,  87, // n.'h.;j.7..W
+  33, 178, 109,  75, 100, 219, 115,  68, 150, 210,  63,  13, // !.mKd.sD..?.
+ 106,  43, 127, 170, 242, 103, 101, 231,  22, 178,  83, 143, // j+...ge...S.
+ 168,  57,  79,  85,  24, 143,  79,  67, 162, 217,  35, 234, // .9OU..OC..#.
+  41, 113, 169,   7, 102,  89, 125, 167, 110,  10,   2, 143, // )q..fY}.n...
+ 107,   2, 231,  67, 175,  41,  20,  92, 251, 251, 160,  12, // k..C.)......
+  89, 172, 164,   0, 237,  56,  76, 190,  67, 133, 180,  74, // Y....8L.C..J
+ 204,  87, 188, 156,  61, 182, 168, 101,  65,  32, 139,  72, // .W..=..eA .H
+  58,  35,   9, 214, 176, 123, 109, 236, 238, 230, 173,  35, // :#...{m....#
+  48,  35, 248, 136, 228,  38,  96,  70,  49,  55,  59, 128, // 0#...&`F17;.
+  29, 211,  33, 129, 130, 152, 126, 139,  93, 223, 187, 115, // ..!...~.]..s
+  41,  58,  54,  69,  51, 242, 214, 221, 162, 228, 184, 228, // ):6E3.......
+ 101,  49, 254, 247, 181, 183,  19,  32, 113,  19, 101, 206, // e1..... q.e.
+ 172,  71, 118, 225, 115, 140,   4,  35, 118,  67,  75, 151, // .Gv.s..#vCK.
+  61, 133,  51,  33,   5, 203,  55, 150, 124,  21,  82, 242, // =.3!..7.|.R.
+ 114,  78, 132, 136, 215, 137, 195,  97, 220, 252,  45, 184, // rN.....a..-.
+ 129, 114, 185,  58, 124,  60,  21,   9, 104, 180, 168,  16, // .r.:|<..h...
+  35, 164, 152,  34, 155,   5,  87, 154,  16,  90,  22,  45, // #.."..W..Z.-
+  66, 178,  52, 139,  24, 149,  94,  89, 110, 233,  55, 101, // B.4...^Yn.7e
+ 138, 148,  56, 230, 153, 126,  14, 110, 170, 237, 249,  88, // ..8..~.n...X
+ 234, 122, 243, 159,  15, 116,  33,  61, 202, 161, 221, 155, // .z...t!=....
+  51, 125, 237, 107,  53, 142, 211, 156,  59,  55, 153, 242, // 3}.k5...;7..
+ 110, 125, 222, 226,  16, 123,  68, 111,  70, 108, 110,  61, // n}...{DoFln=
+  38, 176,  41, 140, 234,  55,  15, 118, 114,  40, 122,  72, // &.)..7.vr(zH
+  60,  66, 186, 114,  97, 167, 229, 176,  48,   0, 156,   4, // <B.ra...0...
+ 237, 158, 205, 103,  20, 251, 147, 222, 100, 109, 205,  51, // ...g....dm.3
+ 129,   7, 147,  67, 182,  39,  45,  63,  91, 139, 165,  17, // ...C.'-?[...
+ 207,  95, 236,  62, 187, 220, 163,   0, 118,  73,  85, 194, // ._.>....vIU.
+ 241, 105, 158, 150, 177, 105,  83,  90,  21,  45,   8, 215, // .i...iSZ.-..
+ 186, 160,  36, 218,  32,  92, 126, 232, 155, 215, 202, 226, // ..$. .~.....
+  79, 148, 141, 228, 210, 227, 244, 138, 200, 122,   6, 156, // O........z..
+ 156,  74, 166, 140, 144, 199, 207,  80, 202,  64,   2, 162, // .J.....P.@..
+ 131, 180,  37,  19, 142,  82, 153, 229, 213, 143,  14, 116, // ..%..R.....t
+ 137, 219,  38,  80, 141,  22,  50, 116,  42,  25,  82, 155, // ..&P..2t*.R.
+ 108,  28, 132,  45, 240, 235, 106,  72,  47, 196, 175, 171, // l..-..jH/...
+  83, 122,  50, 119, 173,  78, 232,  77,  76, 170, 213, 121, // Sz2w.N.ML..y
+ 133,  10, 191, 132,  42, 181, 248, 250, 169, 178, 205,  53, // ....*......5
+ 104,  17, 106, 244,  99,  98,  65, 172, 230, 232,  92,  93, // h.j.cbA....]
+  64, 123, 164, 168,  48, 149, 127, 175, 242,  95,  84,  78, // @{..0...._TN
+  82,  65,  87, 229,  15,  60, 191, 154, 238, 130,  82,  14, // RAW..<....R.
+  41, 229,   9, 165, 204, 255,  84, 249, 143,  42, 239, 168, // ).....T..*..
+ 156,  40, 119, 213, 130,  36, 127,  81, 149, 222, 160, 104, // .(w..$.Q...h
+ 133, 138, 245,  13,  95, 129, 157,  12, 137, 147,  57, 171, // ...._.....9.
+ 155,  94, 164,  75,  76,  47,  50, 154, 143, 192, 204,  18, // .^.KL/2.....
+  94,  32, 236, 184,  17,  22, 120,  95,   4, 119,  14, 197, // ^ ....x_.w..
+ 136,  49, 185, 133,  37,  41,  71, 246,  59, 126, 215, 174, // .1..%)G.;~..
+ 111,   7, 177,  98,   3, 211,  38, 133, 225,  73, 143, 251, // o..b..&..I..
+ 238,   6,  46,  61, 173,  88,  78, 230, 111, 150, 178,  72, // ...=.XN.o..H
+   5,  94,  84,  88, 191, 110,  96,  80, 167, 159, 205,  15, // .^TX.n`P....
+  22, 218, 196,  35,  85, 154, 168, 194, 122,  52, 130, 137, // ...#U...z4..
+ 148, 111,  95, 105, 238,  82, 237, 145, 172, 183,  56, 106, // .o_i.R....8j
+  30, 113, 139,  37, 145, 196, 183,  43,  13, 123,  91, 229, // .q.%...+.{[.
+ 136,  75,  94,  90, 144,  89, 132, 123,  85, 211, 254, 169, // .K^Z.Y.{U...
+  83, 171,  20,  60, 193, 144,  82,  99, 199,  87, 239, 217, // S..<..Rc.W..
+ 108, 235,  40, 160, 113,  15, 121, 220, 243,  95, 252, 252, // l.(.q.y.._..
+ 199,  94,   7, 159,  84,  57, 155, 176,  73,  68, 135, 100, // .^..T9..ID.d
+  64, 175, 239, 158,   4,  49, 244, 116, 158,  79, 111,  80, // @....1.t.OoP
+ 238, 198, 194, 164,  94,   7,  23, 238, 212, 205,  15,  78, // ....^......N
+ 136,   5, 164, 154,  70,  30,  12, 234,  46, 220, 129,  27, // ....F.......
+  33, 104,  66,   8,  49, 246, 112,  36,  64,  82, 157, 151, // !hB.1.p$@R..
+ 169,  46,  57,  21,  91, 205,  78, 184, 139,  19,  54,  27, // ..9.[.N...6.
+ 179,  57, 246,  88, 137, 254, 142,  72, 104, 247,  25, 113, // .9.X...Hh..q
+ 183,  22, 124,  71, 238, 158,  58,  86, 151, 158, 194, 203, // ..|G..:V....
+ 117, 249, 114,  69,  57, 170,  23, 142, 231, 191, 214, 129, // u.rE9.......
+  36, 154, 116, 182, 188, 135, 181,  70, 113, 150, 217, 187, // $.t....Fq...
+ 137,  42,  21,  25, 221,  10, 111, 249, 230, 109, 159, 144, // .*....o..m..
+  24,  60, 120,  97,  54,  81, 181,  15, 201, 123, 185,  69, // .<xa6Q...{.E
+ 202,  56, 128, 185,   4, 202, 197, 150, 229,  14, 239,  88, // .8.........X
+  26, 230,  12, 239, 205,  73,  79, 239,  16, 187,  25,  18, // .....IO.....
+ 203,  63, 161, 246, 104, 149, 172, 101, 216,  18,  64, 106, // .?..h..e..@j
+ 209,  59,  77, 131, 120,  45, 165, 116, 211,  74, 186, 230, // .;M.x-.t.J..
+  22,  13,  32, 165,  92, 235, 180,  11, 190,  44, 170, 116, // .. ......,.t
+ 240, 187,  47, 201,  69, 166, 149,  69, 211, 167,   1, 227, // ../.E..E....
+  90, 236,  39,  84,   7,  40,  39, 201,   5, 211, 222, 148, // Z.'T.('.....
+ 228,   9, 107,  81, 141,  43, 116,  15, 166, 166, 225, 131, // ..kQ.+t.....
+  96,  74,   4, 104, 138,  46,  33,  31,  27, 173, 244, 214, // `J.h..!.....
+ 214, 166, 143,  97, 226,  91,  73, 221, 243, 144, 138, 181, // ...a.[I.....
+ 230, 156, 164, 217,  52, 165, 207,  39, 145,  99, 193, 153, // ....4..'.c..
+ 171,  15,   6, 135,  48,  28,  29,  17, 181, 233, 143, 125, // ....0......}
+   4, 140,  14, 161,  33,  30,  52, 211, 222,  56, 136, 118, // ....!.4..8.v
+ 218, 176, 166,  58, 189, 189,  61,  37, 185, 197,  36,  56, // ...:..=%..$8
+  53, 138, 211, 147,  96, 180,  70, 137, 118,  96,  59, 186, // 5...`.F.v`;.
+  19,  33, 221, 201, 237, 237,   9, 210,  13,  57, 221, 201, // .!.......9..
+ 161,  71, 114, 160,  17, 235,  14,   8, 237,  75, 203, 149, // .Gr......K..
+ 170,  32, 247,  83, 197,  90, 131,  13,  66, 245, 200, 231, // . .S.Z..B...
+ 157,  74, 194, 127,  18,  26, 206, 137,   3, 209,  85,  68, // .J........UD
+ 250, 161,  92,  22,  57, 121, 254, 189,  79,  36,  46, 150, // ....9y..O$..
+ 143,  26, 146, 225, 134, 240,  86, 152,  13,  62, 164, 110, // ......V..>.n
+  25,  56, 243, 239,  74,  19,  83, 112,  74, 193,  25, 238, // .8..J.SpJ...
+  33, 159,  47,  78,  18, 226, 182,  88,  91,  86, 173, 164, // !./N...X[V..
+  74, 180,  41, 198,  43, 220, 201, 104, 187,   2,  18,  34, // J.).+..h..."
+ 180, 105,  37, 106,  35,  49, 252,  22, 176, 252,  51, 237, // .i%j#1....3.
+  87,  82, 208, 100, 158, 136, 137, 105, 180, 222,  85, 225, // WR.d...i..U.
+ 122, 151,  77, 214, 180,  59,  45, 191,  97,  37, 153, 174, // z.M..;-.a%..
+  77, 112, 254,  59, 230, 215, 136, 178, 242, 239,  26,  12, // Mp.;........
+ 219, 202,  64, 250,  76, 249, 119, 106,   2, 109,  80,  37, // ..@.L.wj.mP%
+ 192, 100, 159, 240, 221, 236, 184,  44,  15, 211, 142, 111, // .d.....,...o
+ 165, 102,   0, 127, 111,  24,  89, 233,  29,  20, 111,   2, // .f..o.Y...o.
+  74,   2,  80, 254, 231, 178, 184, 152, 181, 205, 249,  47, // J.P......../
+ 181,  56, 112, 213, 101, 190,  31, 151, 197, 153, 124, 237, // .8p.e.....|.
+ 128,  70, 183,  77, 125, 236, 224, 165,  67,  47, 221,  96, // .F.M}...C/.`
+ 233, 104,  85, 199, 147, 214, 181,  59,  18, 197, 197,  49, // .hU....;...1
+  20,  74, 244,  32, 152, 155, 159, 156, 236,  88, 127, 142, // .J. .....X..
+ 116, 182,  59, 205, 108, 215, 138, 104, 202, 178, 249,  13, // t.;.l..h....
+  89,  44, 210,  68, 168, 165, 194, 188, 109, 185, 197, 166, // Y,.D....m...
+  68, 181, 101, 180,  40, 224, 147, 178,  45,  44,   9, 234, // D.e.(...-,..
+ 196,  46,  10,  88, 229, 111, 204, 138, 224,  31,  89, 190, // ...X.o....Y.
+ 252, 122,  70, 164, 143, 221,  93,  96,  17, 112, 207,   3, // .zF...]`.p..
+  98,   0,  46, 130, 188,  75,  56,  67, 239, 127, 226, 125, // b....K8C...}
+  67,  38, 230,  21,  52,  17, 215, 194, 117, 200,  14, 232, // C&..4...u...
+ 113,  64, 223,  16, 154, 154,  38, 216,  91, 239,  82,  12, // q@....&.[.R.
+ 155,  72, 119, 239,  31,  35,  73, 149, 190, 171, 179, 234, // .Hw..#I.....
+ 199,  13, 235,  31,  95, 179, 246, 113, 215, 104,  10, 239, // ...._..q.h..
+  41, 227, 204, 108,  31, 130,   0,  56, 173,  94, 222, 118, // )..l...8.^.v
+ 207, 212, 235, 230, 165, 218, 165, 255, 247, 214, 186, 247, // ............
+  47, 213,  62, 126, 165,  77,  31, 216, 111,  70,  97, 209, // /.>~.M..oFa.
+  24,  18, 215,  96, 103, 241,  17,  47,  78, 186,  92, 156, // ...`g../N...
+  98,  10,  34, 193,  25,  65,  83,  98,  97, 134,  36, 150, // b."..ASba.$.
+ 158, 211, 162, 146, 175,  29,  67, 195, 113, 129,  87, 130, // ......C.q.W.
+ 225, 177, 106, 171, 238, 253,  31,   8,  87,  65,  22,  51, // ..j.....WA.3
+  47, 131, 157, 244, 243, 112, 112, 234, 126, 240,  74,  18, // /....pp.~.J.
+  40, 100,  63, 193, 185,  21,  97,  91,  62, 148, 231, 162, // (d?...a[>...
+ 110, 140, 120, 121, 181, 211, 238, 239,   9, 183, 206, 202, // n.xy........
+ 237,  61, 145,  15, 206, 248, 114, 166, 137, 191,  49, 171, // .=....r...1.
+  45, 100, 219,  21, 187, 175,  57, 228,  72,  86, 224, 159, // -d....9.HV..
+ 195, 205, 248, 228,  69, 196, 191, 246, 158, 118, 149, 113, // ....E....v.q
+  92, 196, 191,  18, 152, 218,  91, 220, 163,  98, 194,  61, // ......[..b.=
+  10, 168, 248, 252,  23,  66, 252, 135, 252, 246,  99,  69, // .....B....cE
+ 213,  17, 235, 146, 240,  17,  43, 212, 111, 133, 113, 116, // ......+.o.qt
+ 194, 194, 156,  42,  36,  43, 203, 113,  11, 166, 225, 195, // ...*$+.q....
+ 205, 190, 134, 105,  71, 196, 143,  89, 246, 227,  26, 163, // ...iG..Y....
+ 132, 241, 208, 197,  96,  92,  73, 208,   8,   7,  91, 204, // ....`.I...[.
+  96, 212, 144, 240,  23,  32, 222,  35,  65, 194,  31, 241, // `.... .#A...
+ 254,  80,   6, 252, 152, 210,  88, 190, 101,  82, 242,  45, // .P....X.eR.-
+ 132, 115,  22, 236,  21,  20,  99, 176, 215,  37,  51,  92, // .s....c..%3.
+ 148,  60, 148,  55,  22,  84, 101, 120, 120,  64,  58,  51, // .<.7.Texx@:3
+ 194, 214,  75, 179,  47, 166,   8, 233, 212, 174, 186,  23, // ..K./.......
+ 144, 160, 183, 143,  35,   9, 234,  67, 112,  77, 248,  68, // ....#..CpM.D
+  75, 200,  49, 142, 199, 211, 106, 246,  57, 120, 233, 134, // K.1...j.9x..
+  60,  78, 107, 199, 158, 122,  94, 124,  53,  59, 247, 233, // <Nk..z^|5;..
+ 251,   9,  39, 255,  76, 233, 222, 241, 219, 115, 122, 123, // ..'.L....sz{
+ 202,  39, 140,  11, 244, 177, 101,  17, 223, 128,  49,  53, // .'....e...15
+ 184,  20,  28, 219, 225, 184, 102, 252,   5, 226,   2, 105, // ......f....i
+ 123, 121,  16, 124, 232, 155,  51, 118, 125, 247, 117, 112, // {y.|..3v}.up
+   5, 103,  30, 247,   2,  57,  66, 193, 152, 172,  94, 123, // .g...9B...^{
+  52, 199,  94,  35, 148, 168, 251, 107, 117, 207, 163, 182, // 4.^#...ku...
+ 235, 156, 222, 246,  61, 207, 232,  71, 248,  56, 210,  83, // ....=..G.8.S
+ 236, 149, 249, 238,  61, 115, 254,   2, 184, 255,  65, 221, // ....=s....A.
+  83, 251, 232, 181, 167, 118, 131,  15, 197,  97, 190, 190, // S....v...a..
+  45, 153, 171,  67, 201, 251,   1, 170, 160, 204,  37, 104, // -..C......%h
+ 230,  75, 246,   8,  88,  68, 121,  77, 241, 244, 216,  95, // .K..XDyM..._
+  93, 221,  93,   9,  62, 172, 174, 214, 107, 194, 136,  30, // ].].>...k...
+  60,  83, 239,  73,  98, 123, 193, 199, 236,  74, 219, 228, // <S.Ib{...J..
+ 172,  37,  91,  59, 237, 149, 224, 153, 133, 199,  37, 135, // .%[;......%.
+  85,  25, 198,  61, 236,  89,  95, 185, 146, 248,  67, 202, // U..=.Y_...C.
+ 168, 153,  49, 127, 153, 241, 153, 132, 103,  60, 199, 115, // ..1.....g<.s
+ 245,  14,  83,   5,  47,  79, 176, 130, 226, 248, 122, 214, // ..S./O....z.
+ 178,  58,  11,  41, 125,  10,  63,  53,  79,  87,  87, 167, // .:.)}.?5OWW.
+ 194,  87, 180,  90,  45, 226, 188, 128, 226,  24, 209,  99, // .W.Z-......c
+ 226,  60,  33,  83,  94, 182, 128,  51, 193, 148,  90, 135, // .<!S^..3..Z.
+ 151,  66,  16, 157,  34,  10,  40,  22,  16,  63,  58,  85, // .B..".(..?:U
+ 140, 151, 197, 156, 176, 204,   9, 245, 228,  61,   1, 232, // .........=..
+ 146, 197,  32,  72, 125, 239, 251,   7, 204, 227,  75,  25, // .. H}.....K.
+ 123,  10, 104,  92,  11, 232, 120, 135, 126,  45, 224,  61, // {.h...x.~-.=
+ 218,  80, 165,  26, 113,  94,  95,  74,   8, 222,  98, 184, // .P..q^_J..b.
+ 111, 217, 215,  78,  97, 202, 206, 135,  81,  75, 185, 155, // o..Na...QK..
+  24,   0,  28, 182, 208, 117, 185, 155, 178, 202, 126, 209, // .....u....~.
+  10, 184, 186, 201,  97, 229, 188, 106,  88, 218, 210, 107, // ....a..jX..k
+ 138, 105, 234, 131, 144,  24, 182, 233,  78, 206, 231, 218, // .i......N...
+ 112, 122, 254, 123,  55, 230,  40, 179,  42,  53, 241,  21, // pz.{7.(.*5..
+ 218,  47, 162,  69,  97,  48, 153,  45, 225, 112, 101,  55, // ./.Ea0.-.pe7
+ 121,  94,   0,  51, 140,  45,  85, 223, 221, 201,  22,  92, // y^.3.-U.....
+ 207, 212, 152, 121,  48, 228,  52,  84,  90, 220, 114,  17, // ...y0.4TZ.r.
+  83, 142, 163,  68, 153, 151, 112,  88,  71,  92, 117,   9, // S..D..pXG.u.
+ 233,  54, 108, 188,  24, 134, 103, 192,  29, 243, 218, 100, // .6l...g....d
+  99, 155, 202, 199, 164, 242,  81,  49, 187, 110, 247,  40, // c.....Q1.n.(
+ 192,  88,  92, 135,   7, 241,  33, 236, 173, 215,  58, 135, // .X....!...:.
+ 124, 234,  81,  65, 177,  68,  34,   2,   7, 104,   4,  36, // |.QA.D"..h.$
+   8,  64, 178, 117,  68, 245,  32,  36,   4,   9,  84, 230, // .@.uD. $..T.
+  21,  18, 192,   5, 202,  18,  66,  20, 141,  79,  28, 176, // ......B..O..
+  65,   8, 222, 154,  56,  10,  33, 207,  29,  26,  17, 196, // A...8.!.....
+ 209, 146,  18,  67, 195, 209, 246,  93, 126, 194, 119,   7, // ...C...]~.w.
+  39,  88, 131, 147,  81, 111, 221, 165, 117,  23, 111, 107, // 'X..Qo..u.ok
+  18, 234, 173,  75, 246,  53, 151,   3,  57, 206,   6,  19, // ...K.5..9...
+ 156, 162, 201, 139,  40, 137, 114, 205, 101, 193, 137, 154, // ....(.r.e...
+ 148, 141, 125, 137,   3, 106,  23,  90, 155,  53, 187, 135, // ..}..j.Z.5..
+  53, 203, 121, 180,  87, 140, 230,  83,   6, 112, 130, 186, // 5.y.W..S.p..
+ 146, 195, 245,  13, 133,  83, 159, 107, 176, 113, 191, 111, // .....S.k.q.o
+   2,  40,  18, 176,  40, 163, 241,  21, 243, 163, 158, 196, // .(..(.......
+ 196,  85, 228,  31,   6, 119, 194, 163, 188, 175,  43,  71, // .U...w....+G
+ 105, 226, 212,  45, 213,  71, 186, 145, 142,  40, 149,  71, // i..-.G...(.G
+   2, 250, 117,  50, 120,  15,  46, 153, 136,  15,  14,  50, // ..u2x......2
+ 186,  79,  93,  39, 211, 224,  76,  28, 154, 188, 113, 138, // .O]'..L...q.
+ 243, 137, 206, 100, 144, 165, 113,  44,   1,  80,  10,  82, // ...d..q,.P.R
+ 216,  17, 125, 176,  13,  70, 124, 130, 197,  10, 123, 175, // ..}..F|...{.
+ 129, 158, 153, 125, 153,  56,  11,  98, 104, 166, 227,  40, // ...}.8.bh..(
+   0, 223,  85, 105,  68,  56, 175, 136, 118, 147, 254,   1, // ..UiD8..v...
+ 227,  31,  16, 238, 176, 176, 232,  44, 204, 174,  61, 159, // .......,..=.
+ 163,  23,  98, 112, 124, 201, 110,  95,  96,  47,  35,   6, // ..bp|.n_`/#.
+  77,  73, 152, 143, 173, 206, 242, 201, 226, 121,  68,  86, // MI.......yDV
+ 247, 177,   0,  75,  43,  92,  77, 146, 137, 231,  15,  65, // ...K+.M....A
+  89, 189, 184, 126, 237,  31,  80, 120,  69, 247,  17,  15, // Y..~..PxE...
+ 238,  78, 250, 130, 121, 136,  86,   7, 144, 170, 228,  24, // .N..y.V.....
+ 221, 161, 131, 231,  60, 191, 113, 158,  66,  95, 146, 200, // ....<.q.B_..
+ 230, 216,  74, 117,  95,  33,  30, 127, 169, 128,  87, 223, // ..Ju_!....W.
+  80,   0,  14, 196, 223,  24,  11, 100, 107, 131,  10, 167, // P......dk...
+ 129, 133, 135,  50, 247, 247, 225, 154,  55, 190,  90,  87, // ...2....7.ZW
+  84,  24,  88,  22,  55,  14, 126, 113, 221,  36,  88,  75, // T.X.7.~q.$XK
+ 189, 251, 218, 243, 248, 188, 187, 135,  22,  84,  33, 113, // .........T!q
+ 138,  82, 243,  22, 148, 212, 171, 171,   7, 121,  11, 186, // .R.......y..
+ 123, 149, 183,  10, 141, 255,  97, 193,   6,  86, 108, 166, // {.....a..Vl.
+ 174, 221, 252, 160, 123,  72,  28,  47,  17,   9, 246, 233, // ....{H./....
+ 135, 159, 178,  33,   7, 237, 230, 163, 214, 225,  26, 154, // ...!........
+  18, 155,  90, 115,  54,  27, 169, 145, 240,  19, 106, 230, // ..Zs6.....j.
+  84,  93, 120, 108, 173, 125, 205, 152,  71,  44,  46, 173, // T]xl.}..G,..
+  84, 239, 212,  75, 245,  81, 125,  82, 111, 213, 175, 234, // T..K.Q}Ro...
+  59, 245, 167, 210,   9,  78, 209, 201, 249, 214,  55, 110, // ;....N....7n
+  46,  74,  76,   2, 141, 194,   9, 181, 140,  63, 123,  11, // .JL......?{.
+   7, 192, 236,  49, 171,  13, 130, 176,  81,  60, 105,  90, // ...1....Q<iZ
+  39, 137, 142, 104,  31, 110,  55, 194, 115,  26, 144,  12, // '..h.n7.s...
+ 135, 239, 121, 217, 204, 121, 217, 100, 167, 141, 132, 180, // ..y..y.d....
+ 155, 149,  76, 108,  17,  37,  91, 132, 158, 175, 189, 102, // ..Ll.%[....f
+ 222,  58, 162,  12, 172,  86,  63, 194,  41,  94, 243, 253, // .:...V?.)^..
+ 165, 243,  90, 166,  77, 133,   9, 218,  90, 124, 159,  15, // ..Z.M...Z|..
+ 102, 231, 162, 184, 107, 166, 126,  90, 205, 127, 239, 175, // f...k.~Z....
+ 229,  79, 125,  42, 161, 154, 127, 113, 187,   8, 243, 133, // .O}*...q....
+ 121, 198,  74, 219, 252,  74,  61,  51,   2,  99, 161,  63, // y.J..J=3.c.?
+  13, 244, 165, 170, 124, 255,  20, 232, 123,  60,  56, 250, // ....|...{<8.
+  25, 184,  56, 138, 153, 228,  97,  62, 133,  10, 155,  67, // ..8...a>...C
+ 223,  99,  12, 178,  52, 205, 131, 123, 174,   3,  55, 243, // .c..4..{..7.
+ 185, 227, 245, 140, 135, 132,  86,  52, 196, 145, 233, 247, // ......V4....
+ 244, 228,  15,  18, 139, 232,  75, 229, 226, 190,   1, 134, // ......K.....
+  32, 236,  84, 133, 210,  32, 111, 147,  63,  28, 165, 223, //  .T.. o.?...
+ 123,  45, 248, 140, 218,  37, 244, 211,   9,  80, 156,  35, // {-...%...P.#
+ 132,  56, 233, 151, 193, 174, 235,  12, 194, 228,  34, 156, // .8........".
+  16,  94, 225, 248,  73, 214,  26, 228, 196,  86, 191, 196, // .^..I....V..
+  70,  49, 231, 185, 202,  93, 167,  59, 116, 248,  56,  10, // F1...].;t.8.
+  23, 204, 110, 141,  81, 110, 143, 200, 161, 241, 129, 161, // ..n.Qn......
+  95,  41, 205,   2, 168,  88,  74, 209, 202, 163,  63,  66, // _)...XJ...?B
+ 165, 154,  19, 243, 183,  77, 203,  15, 152, 192,  71, 222, // .....M....G.
+ 234, 106,  50,  50,  78,  90, 128,  45, 132, 116,  43, 198, // .j22NZ.-.t+.
+ 235, 161, 254,  25,  53,  19, 151,  15,  87,  43, 168, 132, // ....5...W+..
+  95,  81,  46, 173, 185, 175,  90, 225, 120, 172, 147, 225, // _Q....Z.x...
+  46, 188, 240, 226,  44, 140, 100, 249, 136,  44, 226, 156, // ....,.d..,..
+   5,  57, 240, 198,  25, 148, 254,  20, 172, 189, 113, 113, // .9........qq
+  76, 225,   9,  14,  23,  19,  77, 126,   2, 105,   4, 182, // L.....M~.i..
+ 176, 250,  77,   0, 157, 206,  39, 175, 231,  98,  59,  96, // ..M...'..b;`
+ 122,  18,  37, 147, 219, 219, 131,  67, 175, 152, 152, 210, // z.%....C....
+ 141, 116, 156,  79, 216, 141, 168, 188, 162, 185, 112, 165, // .t.O......p.
+  65, 236, 168, 169, 252,  45, 188, 129,  82,  86, 216, 113, // A....-..RV.q
+ 194, 140,  95,  91, 117,  50, 248, 113,  61, 234,  19, 117, // .._[u2.q=..u
+ 183,  59,  69,  40,  95, 229, 196, 251, 189,   7,  13, 242, // .;E(_.......
+ 221, 235, 160,  18,  35,  39, 246, 174, 171, 126, 247, 152, // ....#'...~..
+  30,  35, 220,  55, 219,  49, 207,  20, 187,  13, 192, 233, // .#.7.1......
+ 128, 140,  55,  80,   3,  46,  29, 111,  82, 246, 145, 202, // ..7P...oR...
+ 159, 240,  90, 132, 211,   2,  70, 135,  60, 225, 211,  98, // ..Z...F.<..b
+ 127, 226, 155,  53, 230, 144, 132, 241,  68, 142, 158, 254, // ...5....D...
+ 115, 174, 191, 204,  18, 227, 132, 133,  97, 152, 197, 157, // s.......a...
+  20, 220, 121, 102, 172, 116, 167,  39,  56,  75, 219, 251, // ..yf.t.'8K..
+  95, 192, 121,  82,  47, 245, 175, 208,  93, 207, 237,  81, // _.yR/...]..Q
+ 248,  20, 106, 223, 113, 232, 224,   6,  13, 245,  43,  94, // ..j.q.....+^
+  94, 106,  42, 210, 239, 150, 235,  72, 191,  51,  74, 210, // ^j*....H.3J.
+ 149, 152, 169, 233, 237, 237,  10, 204, 179, 232, 205, 131, // ............
+ 131, 146,  40, 153, 202,  65,  82, 102,  11, 217,   4, 142, // ..(..ARf....
+ 168,  24, 113, 212, 255, 232, 170,  65,  80,  90,  46,  98, // ..q....APZ.b
+ 212, 212,   8, 234, 178, 236, 246, 118,   3, 218, 227, 102, // .......v...f
+ 199, 231, 179, 139, 177,  16, 101, 203, 142,  18, 105, 167, // ......e...i.
+ 242, 227, 113,  58,  89,  51,  49, 196, 212, 223,  31, 129, // ..q:Y31.....
+ 212, 247, 226, 183,  54,  53,  72,  56,  59, 231,  84, 206, // ....65H8;.T.
+ 192,  56, 134, 233, 178,  29, 103, 158, 142,  29, 156, 219, // .8....g.....
+ 214, 191, 181, 112, 249, 143, 203,  62,  62, 167, 125,  90, // ...p...>>.}Z
+  46, 224,  66, 141,  66,  75,  23,  35, 185, 250, 197, 205, // ..B.BK.#....
+  59, 107, 249, 198, 122, 215, 227,  12, 198,  91, 156,  43, // ;k..z....[.+
+ 205, 251, 193, 255,   1,  62,  49,   8,  77,  18, 106,  84, // .....>1.M.jT
+ 222,  94, 203, 187,  80, 172, 165,  65, 206, 137,  89,  66, // .^..P..A..YB
+ 193, 148,  52,  45,  98, 118, 151,  75, 209, 147,  28,  94, // ..4-bv.K...^
+  82, 120, 195, 154, 245, 153,   1,  12, 219,  32,  56, 163, // Rx....... 8.
+ 187,  56,  98,  94, 135, 220, 105, 160, 127,  58, 136, 237, // .8b^..i..:..
+ 206, 208,  73, 192, 218, 190, 188, 235, 231,  27, 234, 220, // ..I.........
+ 124, 176,  78, 251, 130, 154,  17,  67,  80,  33,  80, 144, // |.N....CP!P.
+  56, 142,  81, 192,  41, 219,   9, 137, 227, 212, 247,  83, // 8.Q.)......S
+  67, 216,  11, 167, 120,  49, 182, 206,  60, 255, 136,  68, // C...x1..<..D
+ 243,  74,  52, 133,  30, 129, 167, 105, 242,  11, 177,  48, // .J4....i...0
+ 254,  88,  29,  83,  89, 188, 221,  77,  82, 119, 220, 146, // .X.SY..MRw..
+ 253, 110,  18, 157, 143, 121, 188, 251, 191, 184, 199, 172, // .n...y......
+  19, 162,  90, 253,  54, 137, 163,  77, 140, 143, 128, 234, // ..Z.6..M....
+  62,  65, 168, 179, 221,  38,  97,  82, 191,  65,  40,  13, // >A...&aR.A(.
+  26, 218, 182,  27, 188,  94, 115, 247, 214,  46, 188, 251, // .....^s.....
+ 163,  94,  42,  61, 216, 101,  11, 253, 142, 125, 229, 129, // .^*=.e...}..
+  28,  21,  99,  72, 225, 177, 232,  41, 250,  33, 182, 118, // ..cH...).!.v
+ 236, 199, 196,  63, 163, 133,  45, 244, 219,  59, 103, 244, // ...?..-..;g.
+ 206,   5, 217, 225, 246, 121, 144,  38, 126, 168, 206, 110, // .....y.&~..n
+ 111, 185,  92, 231,  60,  26,  14, 137, 206, 250,  53,  68, // o...<.....5D
+  96,   8, 223,  11,  76, 109, 196, 168, 198,  45, 179, 125, // `...Lm...-.}
+  79, 178, 110,   1,  43, 106,  62,  47,  47, 216,  48,  59, // O.n.+j>//.0;
+ 247,  88, 222, 165, 238, 200,  94, 113, 109, 115, 235, 195, // .X....^qms..
+ 146, 205, 173,  60, 248,   0, 113, 190, 234,   9,  72,  20, // ...<..q...H.
+ 182, 193,  62, 206,  19, 167, 252,  48, 135, 173, 155, 226, // ..>....0....
+ 144, 216, 113, 214, 114, 175,  21,  17, 101, 189, 122,  59, // ..q.r...e.z;
+ 114, 113, 148, 199, 235,  99, 139,  50,  55,   7, 167, 215, // rq...c.27...
+ 127,  79, 214,  79, 206, 235, 251, 106, 241, 210, 170, 193, // .O.O...j....
+ 225, 247, 206, 250, 110, 137, 239,  53,  28,  39, 164,  92, // ....n..5.'..
+ 211, 247, 239,  85, 209, 251, 172, 142, 190,  57, 172, 251, // ...U.....9..
+ 234, 136,  75, 107, 104,  45, 129,  45, 100,  54, 155,  29, // ..Kkh-.-d6..
+  27, 142,  42, 254, 209, 221,  87, 199, 197, 185, 160,  12, // ..*...W.....
+   2,  53, 201, 199,  87,  30, 177,  62, 153, 122,  77, 178, // .5..W..>.zM.
+  45,  49,  83, 199,  53, 221,  98, 157,  20,  28, 183,  96, // -1S.5.b....`
+ 108,  76, 143,  65,  56, 150,  65, 250,  12, 235, 242,  44, // lL.A8.A....,
+  26, 246,  62,  87, 235, 248, 188, 188,  14,   6, 112, 215, // ..>W......p.
+ 239, 200,  75, 222, 241, 243, 182, 121, 221, 240, 243,  46, // ..K....y....
+  42, 255,  92, 173, 252, 115, 189, 242, 207,  82, 249, 103, // *....s...R.g
+ 174, 156,  68, 253, 162, 190, 131, 215, 135, 176, 248,  86, // ..D........V
+ 107, 152, 166,  83,  79, 138, 236, 248,  93,  33,  34,  82, // k..SO...]!"R
+  77, 167,  86, 205, 101, 181, 154, 203, 122,  53, 151,  82, // M.V.e...z5.R
+ 205,  37,  87,  51,  75,  94, 185, 206,  48,  11,  47, 159, // .%W3K^..0./.
+  16,  13, 118, 104, 193, 149, 133, 167,  74, 141, 227,  93, // ..vh....J..]
+ 236,  35, 185, 250, 215,  98,  73, 176, 214, 166,  56, 133, // .#...bI...8.
+ 140,  56, 109, 154, 234, 198,  63, 209, 184, 192, 163, 189, // .8m...?.....
+ 188, 180,  61, 163, 179, 209,  52,   9,  73, 138, 158, 224, // ..=...4.I...
+ 192, 244,  43,  88,  93, 179, 213,   6,  10, 253, 173, 117, // ..+X]......u
+  18, 167, 199,  97, 252,   4,   1,  65, 252, 202, 198,  89, // ...a...A...Y
+ 151, 218, 178, 140,  28, 180, 213, 148,  16,  17, 171,  70, // ...........F
+ 113, 196, 192,  95, 244,  26, 175, 167, 110, 124, 175,  73, // q.._....n|.I
+ 208,  87, 241,  46, 196, 235, 152,  67, 246, 215, 138,  16, // .W.....C....
+ 227, 111,  72, 218,  68,   5, 174, 174,  82, 251, 123,  94, // .oH.D...R.{^
+ 222, 108, 214,  99,  98, 138,  65,   6, 146, 193,  61,  18, // .l.cb.A...=.
+ 194,  11, 254,  31,  98, 141, 139, 150,  16, 211,  97, 186, // ....b.....a.
+ 132, 237,  79,  60,  25, 184,  42, 102,  55, 131, 208,   4, // ..O<..*f7...
+ 168,  14, 113,  52, 175, 150, 118, 145, 150,  73, 216, 194, // ..q4..v..I..
+ 124,  13, 158, 223,  14,  43, 107, 153,  96, 154,  68, 109, // |....+k.`.Dm
+ 255,  65, 198, 161, 103,  86, 203, 122, 124, 223, 190, 180, // .A..gV.z|...
+  74, 221,  36, 204,  21, 172, 181,  10, 213, 109, 122, 115, // J.$......mzs
+  79, 197, 251, 208,  90, 167, 101, 108, 137, 247, 152, 129, // O...Z.el....
+  49, 241,  73, 201, 237, 109,  42, 190, 175,  76, 146,  18, // 1.I..m*..L..
+  48, 242,  93, 133,  15, 151,  72,  43, 146, 180, 176,  77, // 0.]...H+...M
+ 242, 231, 151, 224, 164,  44, 118, 238,  51,  86,  58, 216, // .....,v.3V:.
+ 104,  97, 143, 124,  56, 158,  72,  28,  14, 162, 222,  98, // ha.|8.H....b
+  93,  32, 166, 197,   1,  23, 225,  40,  71,  16, 216,  57, // ] .....(G..9
+  44, 189,  69, 255, 136,  21, 167,  34, 179, 116, 220, 210, // ,.E....".t..
+  37, 193,  79,  21,  26,  73,  20, 222, 218, 110, 128,  55, // %.O..I...n.7
+  99,  38, 233, 246,  86, 239, 121, 172,  45, 209, 123,  37, // c&..V.y.-.{%
+  45,  77,  90, 163,  44,  61, 247, 168,  36, 243, 166, 184, // -MZ.,=..$...
+  32,  99,  30,  67, 239,  18,  12, 173, 148,  88, 186, 204, //  c.C.....X..
+ 140, 102, 200,  53,  85, 218, 148, 132, 108, 191, 244, 243, // .f.5U...l...
+ 223, 252, 252,  21, 201,   5,  30, 228, 161,  64,  86, 223, // .........@V.
+ 156,  23, 191, 115, 205,  71,  99, 248, 170,  11,  88,   2, // ...s.Gc...X.
+ 238,  98, 239, 154,  90, 225, 106,  26, 205,  95, 216, 143, // .b..Z.j.._..
+ 147,  30, 173, 174, 174, 192,  21, 155, 155, 129, 159, 230, // ............
+ 110, 192, 192, 200, 158,   0, 130, 197, 145, 199, 230, 160, // n...........
+  55, 214, 188,  71,  18, 244, 127, 246,  69, 200, 235,  40, // 7..G....E..(
+ 184, 239, 241,  17,  38, 222, 139, 196,  62, 201, 218,   0, // ....&...>...
+  73,  17, 139, 169,  59,  69, 106, 236,  59,  83, 235,  48, // I...;Ej.;S.0
+ 239,  87, 168,  17, 250,   3, 219, 143, 154,  61, 235, 148, // .W.......=..
+ 214,  90, 215,  26,  81, 218,  67,  73,  44, 248, 131,  55, // .Z..Q.CI,..7
+  33,  22, 223, 116,  15, 204, 101,  10, 219, 160, 126,  60, // !..t..e...~<
+ 245,   5,  46,  27,  88, 114,  13, 127,  48, 130, 148,  88, // ....Xr..0..X
+ 124, 141, 125,  74, 244, 197, 104,  56, 175, 162, 245, 122, // |.}J..h8...z
+ 154, 167,  40,  24, 205, 146,  47, 132, 178,  56, 138,  96, // ..(.../..8.`
+ 243,  74, 108, 251,  75, 132,  67, 178, 196,   2,  75,  61, // .Jl.K.C...K=
+  55, 158,  73, 103, 165,  14,  40,  98, 196, 113,  32,  93, // 7.Ig..(b.q ]
+ 227, 121, 237,  48,  11,   7, 232,  87,  38,  50, 243, 202, // .y.0...W&2..
+  29, 215, 104,  22,  60, 204, 242, 239, 190,  16, 105, 145, // ..h.<.....i.
+ 204,  99, 148,  20, 206, 185, 203,   8, 242, 203,  33,  78, // .c........!N
+ 215, 234, 174, 244,   8, 123,  22, 244, 206, 155,  22,  44, // .....{.....,
+ 210, 145,  52, 115, 250, 217,  97,  47,  65, 151, 208, 189, // ..4s..a/A...
+ 223,  35, 118, 208,  70,  92, 228,  18, 113,  15,  17, 102, // .#v.F...q..f
+ 255,  74,  63,  96, 227, 172,  90, 103, 126,  42, 168,  38, // .J?`..Zg~*.&
+ 207,   1, 163,  30, 129, 120, 110, 119, 220,  89,  74, 167, // .....xnw.YJ.
+  33, 209,  15, 128, 177, 140,  62,  34, 190,   3,  53,  56, // !.....>"..58
+ 114,  38, 242, 188, 164, 100, 152,  25,  55,   5, 155,  16, // r&...d..7...
+  35,  63, 227, 208,  19, 242, 211, 192, 151,  71,  24, 245, // #?.......G..
+ 186, 126, 203, 210, 202,  22, 142, 145, 157, 231, 146,  72, // .~.........H
+ 191,  80, 121, 198, 162, 209, 219, 190, 126, 232, 234,  77, // .Py.....~..M
+ 207, 207,  99,  60, 112, 162,   7, 135, 211,  54,  85, 158, // ..c<p....6U.
+ 184,  38, 254, 145, 159, 231, 148,  31, 230,  87, 211,   0, // .&.......W..
+ 135, 168,  54, 233, 203,  53,  71, 154, 155,  55, 123, 123, // ..6..5G..7{{
+ 244, 243, 236, 217, 172,  97,  15,  39, 243, 113, 101, 164, // .....a.'.qe.
+  30, 192, 160,  33,  31,  67, 230, 137, 245,   9,  73, 140, // ...!.C....I.
+ 214, 160,  45, 132,  18, 134,  67,  60,  28,  34, 200, 199, // ..-...C<."..
+  76,   5, 113, 108, 128,  94, 205, 185, 169,  30, 189, 194, // L.ql.^......
+  24,  47, 200,   7,  20,  33,  11,  44, 176, 200, 190, 227, // ./...!.,....
+ 148,   1,  47, 173,  38,  16, 175,  28, 102, 174,  87, 146, // ../.&...f.W.
+  80, 249, 224, 112,  43,  83, 153,  87, 115, 160, 235,   4, // P..p+S.Ws...
+ 199,  15, 208, 204,  11, 254,  61, 163, 121,   5,  75, 229, // ......=.y.K.
+  27, 222,  40, 164,  38, 224, 148, 151, 157,  92,  44,  94, // ..(.&.....,^
+  25,  33, 171,  98,  66,  88, 119, 205, 145, 159, 208,   4, // .!.bBXw.....
+  60, 179, 107, 128, 215, 103,  62, 128, 150,  68, 207, 191, // <.k..g>..D..
+  57, 242, 219,  51,  47, 127,  13, 247,  28, 176, 109, 197, // 9..3/.....m.
+ 150,  69,  62, 132, 122, 254,   9, 196, 254,  28, 174,  78, // .E>.z......N
+  29, 224, 148, 128, 134, 101, 122, 197,  26, 129,  28, 158, // .....ez.....
+ 106,  29,  57, 148, 251, 132,  58,  67,  64, 194,  73,  51, // j.9...:C@.I3
+ 148, 140, 207,  51, 239, 230,  29,  39,  59, 213, 225, 208, // ...3...';...
+  38,  83,  86,  46, 231, 152, 204,   4, 191, 147,  69, 153, // &SV.......E.
+ 125,   8, 236, 162, 185, 156, 205,  68,   2,  78,  39, 158, // }......D.N'.
+  13, 161, 207, 186, 166,  98,  87, 142,  88, 238, 185,  79, // .....bW.X..O
+ 208, 200,  40,   1,  11, 237, 112, 107,   0,  36,  56, 140, // ..(...pk.$8.
+ 228,   8, 124,  56,   6, 186, 247,  10,  91, 214,  25,  12, // ..|8....[...
+ 188, 139,  67,  31, 176, 147,  93, 112,  33, 148,  63, 173, // ..C...]p!.?.
+  29, 250,  18, 245,  80, 254, 142,  77, 228,  33, 237, 223, // ....P..M.!..
+ 128, 236, 197,  36, 155,  16, 203,  76,  83, 196,  44, 113, // ...$...LS.,q
+ 236,  12, 143, 149, 195, 200,  12,  11, 179,  32, 163,  70, // ......... .F
+ 189,  99,  71,  61, 208,  21,  86, 247,  99, 127, 174,  90, // .cG=..V.c..Z
+ 177, 213, 138, 238, 213, 125, 187, 120, 133, 245,  97, 178, // .....}.x..a.
+   2, 179, 115, 247, 153, 203,  26, 220, 131,   4,  38,  48, // ..s.......&0
+ 154,  18, 234,   6, 127,  88,  38, 134, 120, 155, 119,  45, // .....X&.x.w-
+ 137,  40, 204, 148,  63, 145, 176, 153, 191, 192, 207,  91, // .(..?......[
+ 252, 252, 138, 159, 239, 240, 243,   3, 126, 190, 199, 207, // ........~...
+ 159, 248, 249,   5,  63,  63, 226, 167, 141, 159,  14, 126, // ....??.....~
+ 186, 248, 217, 128,  68, 158, 241, 150,  57,  48, 146,  11, // ....D...90..
+ 125, 192,  24, 186, 201, 191,  91, 252, 187, 205, 191, 143, // }.....[.....
+ 248, 247,  33, 111,  70,  86, 183, 129,  69,  21, 236, 198, // ..!oFV..E...
+  52, 233,  87,  48,  19, 121, 242,  16,  13, 230,  15, 217, // 4.W0.y......
+ 152, 135, 103,  81, 235,  80, 171, 205,  87,  36, 161, 228, // ..gQ.P..W$..
+  54, 215,  66,  18,  91, 232, 214,  55, 167,  74, 163,  75, // 6.B.[..7.J.K
+ 217, 159, 234, 217,  82,   3, 234,  49, 117,  53,  87,  69, // ....R..1u5WE
+ 201,   1, 117, 159, 250,  29, 163, 223, 220, 235,   4, 173, // ..u.........
+  76, 241, 131,  21, 140, 189,  51, 207,  19, 109, 222, 233, // L.....3..m..
+  18,  14,  87,  27,  29, 131, 216,  20, 195,  52,  59,  87, // ..W......4;W
+  71, 108, 207,  29, 207,   2, 173, 136, 109,  89, 179,  94, // Gl......mY.^
+ 143,  68, 254, 238, 155,  39, 219, 118, 183, 189,  94, 200, // .D...'.v..^.
+ 188, 116, 254, 143, 110, 223, 205, 223,  54, 131,  80,  65, // .t..n...6.PA
+  99,  74, 239, 223, 173,   5,  48,   1, 197, 126, 105,  38, // cJ....0..~i&
+ 187, 166, 249, 175, 136, 110,  75, 244,  15, 136, 102,  44, // .....nK...f,
+  36, 193, 141, 217,  38,  90,  62, 226,  75, 222, 234, 193, // $...&Z>.K...
+ 179,  67,  56, 134, 103, 247,  48,  72, 241, 220,  56,  12, // .C8.g.0H..8.
+  34, 133,  10, 226, 215, 124, 214, 247,  53, 133,  40,  84, // "....|..5.(T
+  98, 222, 126, 229, 152,  46, 199,  96,  63, 235,   7, 142, // b.~....`?...
+ 105,  87,  78, 215,  91,  18,  67, 153, 242, 183, 138, 224, // iWN.[.C.....
+ 246, 195,  90, 254,  43, 142,  75, 127,  71, 237, 200, 127, // ..Z.+.K.G...
+  40, 135,  52, 117, 217,  36, 110, 114,  25, 193,  87, 113, // (.4u.$nr..Wq
+ 234, 221,  12,  66, 154, 147,  29, 223, 238, 233, 175,  17, // ...B........
+ 246,  55, 179,  30, 135, 118, 109, 104,  94,  13, 221, 176, // .7...vmh^...
+ 161, 113, 147,  66, 215,  76, 104, 219, 134,  38,  18,  58, // .q.B.Lh..&.:
+ 155, 125, 219, 176, 176, 227,  21,  12,  13, 179, 232, 233, // .}..........
+  36, 128, 101,  12,  18, 208,   8, 148, 156,  50,  15,  10, // $.e......2..
+  51, 173, 172, 212,  49, 137, 138, 161,  98,   0,  91, 111, // 3...1...b.[o
+ 143,  97,  96,  80, 190,  71, 211,  65,  12, 100,   3,  88, // .a`P.G.A.d.X
+ 118, 125,  71, 226,  85, 107, 139,  13, 126, 216,  90, 150, // v}G.Uk..~.Z.
+   3, 127, 176, 129,  93, 107,  58, 203, 193, 111, 109, 240, // ....]k:..om.
+  70,  97,  71, 203, 225, 191,  74, 248, 140, 213, 131,  57, // FaG...J....9
+ 170,  46, 221,  29, 223, 136, 181, 138, 182, 214,  42,  57, // ..........*9
+ 123, 137, 150,  67, 177,  34,  30, 197, 172, 142, 229,  83, // {..C.".....S
+ 159, 118,  37,  27, 169,  27,  57,  62, 120, 237,  51, 119, // .v%...9>x.3w
+  56, 195,  26,  45,  73, 188,  10, 163,  75, 188, 146, 156, // 8..-I...K...
+ 190,  43, 108,  11, 227,  22,  31, 232,  83,  12, 190, 179, // .+l.....S...
+ 104, 108, 119, 197,  92, 249, 196,  53,  43,  94, 143, 253, // hlw....5+^..
+ 200, 154, 205,  91,  43, 162, 193, 171,  55, 145,   3,  86, // ...[+...7..V
+  14, 226, 205,  99,  97,   2, 199, 255, 250, 125,  40,   8, // ...ca....}(.
+ 138, 170,   2, 107,  42, 102, 100, 157,  54, 140,   1, 237, // ...k*fd.6...
+ 145,  13,   3, 233,  12, 150, 140,  69, 186, 126,  95, 135, // .......E.~_.
+ 184, 233, 102,   7,   7, 108, 116, 184,  51,  17,  93, 157, // ..f..lt.3.].
+ 225, 133, 242, 183,  62, 161, 228,  24,  77,  55,  70, 203, // ....>...M7F.
+  83, 160, 240,  41,  61,  82, 102, 234, 243, 214, 105,  56, // S..)=Rf...i8
+ 113,  79, 113,  48, 200, 187,  49, 155, 211, 226,  65,  90, // qOq0..1...AZ
+  68,  34,  28,  50,  49,  54, 156, 114, 116,  30, 122, 144, // D".216.rt.z.
+ 132, 237,  19, 117, 144,  25,  66,  74,  88, 162, 155, 205, // ...u..BJX...
+   6, 203, 137, 166,  60, 179, 139, 105, 252, 129,  73, 214, // ....<..i..I.
+  37,  57,  97,  43, 179, 182, 246, 248, 212, 238,  50, 207, // %9a+......2.
+ 229,  79,  77, 126,  99,   2,  33,  12, 251,  74, 144, 218, // .OM~c.!..J..
+  17,  25,  55, 237,  96, 245, 155, 157, 245, 182,  63, 232, // ..7.`.....?.
+  95, 186,  67, 108, 248, 234, 174,  26,  97, 249, 134, 173, // _.Cl....a...
+  89,  96,  89, 254, 126, 153,  36, 173,  38, 105, 142, 123, // Y`Y.~.$.&i.{
+ 122,  39, 239, 231, 124, 148,  43, 164, 210, 125, 109,  94, // z'..|.+..}m^
+  99, 227, 200, 161,  49,  88,  93, 253, 222,  29,  55, 145, // c...1X]...7.
+  53,  43, 178, 122, 236,  56,  86, 128,  86,  57, 194,  38, // 5+.z.8V.V9.&
+  91, 166, 169, 220,  35,  20, 183, 248, 172, 102, 160, 103, // [...#....f.g
+  24, 101, 203,  27, 197,  80, 148, 166,   3,  48,  46, 130, // .e...P...0..
+  33,  39,  24,  33, 115, 166,  54,  62, 225,  41, 203, 220, // !'.!s.6>.)..
+ 183, 188,  18,  29,  59,  97,  77, 158,  13, 227, 121, 138, // ....;aM...y.
+ 151, 130, 109,  42,  62,  56, 188,  96, 188, 236,  59, 135, // ..m*>8.`..;.
+  90, 102, 202, 188,  26, 228,  60, 199,   4, 225,  83, 173, // Zf....<...S.
+ 118, 126, 200,  23,  45, 176, 114, 112, 164, 181,  49,  67, // v~..-.rp..1C
+ 131,  57, 144, 202, 185,   8, 226, 115,  70,  98, 194,  56, // .9.....sFb.8
+  21,  31,   5,  70, 253,  30,  95,  23, 111,  87, 230, 173, // ...F.._.oW..
+ 178, 166,  29,  23,  62, 183,  89,  34, 128, 115, 231, 118, // ....>.Y".s.v
+ 225, 231, 198, 200,   8,  63,  29, 104, 123, 254, 141, 197, // .....?.h{...
+ 186, 216, 222, 203, 213,  51,  79, 236,  76, 238, 195, 251, // .....3O.L...
+ 107, 193, 207, 198, 158, 231,  19,  86, 228,  83, 254, 125, // k......V.S.}
+ 110, 201, 147,  37,  94,  44,  43,  57, 112,  42, 228, 248, // n..%^,+9p*..
+ 206,  79,  40, 194,  97, 155,  19, 174,  92,  27,  40,  89, // .O(.a.....(Y
+ 245, 139,  28, 202, 239, 248, 230,  77,  25, 165, 133,  85, // .......M...U
+  94, 220, 222, 198,  36,  66, 235, 161, 210, 198, 196, 165, // ^...$B......
+  84, 245, 127,  32, 161,  44, 127,   3,  85, 191, 217,  37, // T.. .,..U..%
+ 193, 214,  73, 241, 161, 244,  39, 137,  98,  11,  44, 222, // ..I...'.b.,.
+  58, 177,  81,   8,  47, 135, 208, 190, 151,  59,   7, 119, // :.Q./....;.w
+ 237,  40,  28, 217,  76, 114, 236,  58, 168,  40,  90, 142, // .(..Lr.:.(Z.
+ 100,  36, 139, 121, 156,  99, 111, 116, 205, 221,  88, 235, // d$.y.cot..X.
+ 222, 135,   3,  78,  90, 184,  13,  66, 208, 116,  36, 118, // ...NZ..B.t$v
+ 127, 131,  53,  64,   6, 243, 204, 248, 203, 225, 223, 220, // ..5@........
+  24,   2, 114, 166,  86, 247,  62, 241,  25, 198, 172, 203, // ..r.V.>.....
+ 182, 211, 156, 217, 162,  40,  62, 120,  51, 241, 227,  72, // .....(>x3..H
+  29,  89, 211,  47, 144, 142, 163, 194, 234, 107, 166, 108, // .Y./.....k.l
+  29, 132, 116,  37, 118,  91, 228,  54,  26,  19,   9, 147, // ..t%v[.6....
+ 119,  19,  26,  23,  97,  49,  66,  42, 248,  94, 162, 187, // w...a1B*.^..
+  29,  39,   4, 138,  10,  13,  97, 102,  36,  10,  88,  27, // .'....af$.X.
+ 198, 221, 112, 168, 245, 227, 237,  66, 161, 248, 206, 187, // ..p....B....
+ 179, 219, 219,  21, 195,  28,  27, 221,  65, 233, 118, 243, // ........A.v.
+ 117, 175, 226, 237, 210,  48, 232, 196,  59,  27, 109, 138, // u....0..;.m.
+ 122, 169,  94, 182, 248, 146, 203,  55, 233, 144,  79,  44, // z.^....7..O,
+ 120, 189,  61,  55,  83, 218, 238,  45, 106, 179,  11, 179, // x.=7S..-j...
+ 199,   7,  57, 141, 245,  76, 149, 149, 151, 213,   7,   2, // ..9..L......
+  80, 177,  80, 107, 217, 151,  19, 241, 202,  49, 119,  64, // P.Pk.....1w@
+  21, 115, 135,  88, 141,  83, 235,  97,   0, 122, 203,  94, // .s.X.S.a.z.^
+  92, 241, 175,  46, 187,   1, 226,  85,  30, 199, 157,  69, // .......U...E
+ 218, 146, 132, 236,  57, 168, 144, 180,  36,  76, 144, 145, // ....9...$L..
+ 115,  22,  87, 190,   4,  70, 238, 146,  20,  66, 217,  66, // s.W..F...B.B
+ 106,  82, 130, 150,  88, 153, 100,   2, 230,  59, 172, 137, // jR..X.d..;..
+  29, 102, 254, 169,  92,  88, 185,  83, 211, 115,  55,  52, // .f...X.S.s74
+  53, 240, 133,  56, 118, 206, 237, 180, 251, 115,  77, 241, // 5..8v....sM.
+ 107, 213,  18,   9,  47,  55,  73, 137, 101, 147, 149, 209, // k.../7I.e...
+ 146,  80,  51,  58, 189,  56, 133, 147, 113, 179, 220, 254, // .P3:.8..q...
+  90, 104, 232, 101, 253, 160, 101, 110, 144, 103, 241,  15, // Zh.e..en.g..
+ 250,  26, 190, 213, 207, 117,  30, 210, 171, 183,   2, 201, // .....u......
+ 213, 120,   2,  41, 197, 197, 214,  36,  61,  47, 174, 188, // .x.)...$=/..
+ 224,  14, 228, 124, 244, 201, 104,  28, 123,  85, 165, 100, // ...|..h.{U.d
+ 206,  42, 155, 155,   4, 169, 146,  35,   2, 139, 238,  39, // .*.....#...'
+  88, 140, 112, 124, 116, 223, 207, 239,  41, 176, 226,  31, // X.p|t...)...
+ 153, 109,  97,  36, 129,  23,  20,  94,  79,  40, 113, 108, // .ma$...^O(ql
+ 143, 211,  75, 193, 179, 197, 180, 162,  38, 190, 160,   6, // ..K.....&...
+  60, 117,  79,  77, 207, 109, 183, 177, 184, 166, 236,  41, // <uOM.m.....)
+ 230, 200, 173, 117,  87,  37, 215,  11,  37,  73,  81,  44, // ...uW%..%IQ,
+  40, 222, 148, 226, 229, 144, 177, 151,  41, 171,   3, 220, // (.......)...
+ 211, 181,  33, 132, 176, 171, 210, 226, 152, 153,  81, 239, // ..!.......Q.
+ 102,  42,  61, 156, 201, 222, 127, 126, 206,  91,  30,   3, // f*=....~.[..
+ 205,  27,  17,  41, 155, 123, 229,  23, 245,  48,  40, 121, // ...).{...0(y
+   9, 198,  34, 119,  75,  89, 162,   1, 145,   1,  20,  60, // .."wKY.....<
+ 207,   7, 213,  76, 178, 152, 202,  56,  46, 204, 210,  10, // ...L...8....
+ 230, 199, 241, 130,  50, 150, 135,  58, 182, 211, 117, 143, // ....2..:..u.
+  32,  76, 253,  19, 190, 174,  57, 134, 202,   7,  65, 197, //  L....9...A.
+ 116, 252,  64,  31,  77, 246,  19,   7,  89, 143, 248, 125, // t.@.M...Y..}
+ 154,   0,  31, 235, 215,  37, 196, 180, 190,  97,  30, 171, // .....%...a..
+ 120, 102,  58,  93,  92, 172, 224, 198,  71, 213,  86, 131, // xf:]....G.V.
+  58,  93,  87,   3, 136, 241, 136, 175, 234,   1, 178, 145, // :]W.........
+  64, 204,  97,  69,  83, 139, 205, 104,  27,  48, 215,  93, // @.aES..h.0.]
+ 235, 252, 149,  22, 189,  95,  13, 123,  68,  68,  89, 219, // ....._.{DDY.
+ 189, 113, 177,  68, 226,  45, 113,  90,   3, 229, 139, 169, // .q.D.-qZ....
+  72, 254, 140,  21, 231, 149, 170,  65,  36, 105,   1, 254, // H......A$i..
+  21, 135, 168,  96, 134,  79, 149, 146, 208, 187,  80, 169, // ...`.O....P.
+ 216,  43,  22,  57,  97, 209, 162,  64,  49, 203,   1, 172, // .+.9a..@1...
+ 197,  92,  84,  63, 205,  90,  83, 226,   4,   2,  97,  96, // ..T?.ZS...a`
+  71, 210, 187, 180, 138,  38, 116,  54, 201, 217, 252,   0, // G....&t6....
+  90,  61, 115,  39,   6,   9, 221, 177, 221,  25,  41, 241, // Z=s'......).
+ 128,  43,  32,   0,  91, 211, 201,  26, 184,  77, 201,  69, // .+ .[....M.E
+   9,  21, 192,  75, 190, 171, 234, 167, 103,  20, 228, 182, // ...K....g...
+ 191,  14, 244, 169, 130,  94, 151, 193,   1,   9, 178, 246, // .....^......
+  95, 149,  91, 217, 171, 156,  82,  60,  48,   2,  51, 124, // _.[...R<0.3|
+ 204, 132,   1,  73, 165,  56, 228,  81,  57, 195, 199,  30, // ...I.8.Q9...
+ 210, 141, 122,  31, 238, 137, 217, 193,  77,  98, 156, 139, // ..z.....Mb..
+ 211, 107,   6,  15,   7, 191, 184, 249,  17, 115, 109, 235, // .k.......sm.
+  27,  30,  43,  69,  67,  62,  43,  71, 145, 146, 171, 195, // ..+EC>+G....
+  73, 185, 140,  13, 126, 141,  76, 174,  39, 146,  11, 219, // I...~.L.'...
+ 220,  19, 225,  43, 207, 192, 174, 141,   9, 105, 162,   4, // ...+.....i..
+  74,  43, 251, 122, 123, 123,  16, 239,  41, 251, 175, 162, // J+.z{{..)...
+ 217,  31, 184,  56,  86,  23, 239,   1,  18, 241, 107, 100, // ...8V.....kd
+  62, 178, 185, 227, 179, 170, 201, 132,  54, 186, 153,  75, // >.......6..K
+ 160, 170, 138, 119,  85, 124,  79,  36, 128, 120, 223,  60, // ...wU|O$.x.<
+  63,  24, 220,  19, 219, 132, 210,  27,  73, 252,  89, 197, // ?.......I.Y.
+ 207,  85, 252,  68, 197, 239,  84, 252,  84, 197, 207,  84, // .U.D..T.T..T
+ 252,  94, 197,  47,  85, 252, 155, 138,  95, 169, 248, 103, // .^./U..._..g
+ 147, 253,  99,  93, 205, 241, 169, 152, 213,  83, 203, 131, // ..c].....S..
+ 193, 145, 129,  86, 178, 234, 222, 196, 187,  65, 187, 102, // ...V.....A.f
+ 159,  89,  76,   3, 179, 143,  26, 239, 174, 145,  24, 163, // .YL.........
+  43,  91,  94,  80, 106, 240,  73, 209,  96,  42, 254, 215, // +[^Pj.I.`*..
+ 176,  11,  88, 220,  18,  74, 245,  28,  28,  28,  98,  54, // ..X..J....b6
+ 239,   6,  46, 181,  10, 146, 144, 117, 110, 221, 179, 151, // .......un...
+  98, 194, 204, 149, 234, 223,  40, 110,  89, 166,  64, 123, // b.....(nY.@{
+  70,  30, 104, 103, 172,  81, 227, 221, 185,  45, 222,  93, // F.hg.Q...-.]
+ 211, 168, 156, 119,  46, 102, 101,  67, 228,  67, 222,  89, // ...w.feC.C.Y
+  83, 211,  22, 140, 156, 176, 243, 174, 208,  97,  27,  89, // S........a.Y
+ 189,   1, 252, 135, 254, 198,  35,  84,  92,  17,  94, 132, // ......#T..^.
+  68,  56, 168, 227,  49,  44, 241,  71, 175,  31, 191, 112, // D8..1,.G...p
+  61,  63, 185, 112, 245,  47,  36, 127, 136, 195, 247,  46, // =?.p./$.....
+ 116, 202,  30, 148,  73, 249,  54, 241, 167,  34, 227, 129, // t...I.6.."..
+  45, 135,  74,  73, 148,  64,  85,  45, 208, 139, 242, 118, // -.JI.@U-...v
+ 160,  30,  70, 163, 109, 213, 243,  46, 246,  47, 251,  46, // ..F.m..../..
+  13, 120, 252, 129,  47, 165, 192, 152, 211,  43,  44, 228, // .x../....+,.
+ 118, 155, 196,  51,  50, 172,  14, 226, 123,  68,  63, 204, // v..32...{D?.
+ 235, 254, 161, 180,  27,  87, 100, 196, 247,  40,  56, 222, // .....Wd..(8.
+ 247, 124, 115, 197, 199,   6,  71, 240, 189,  24, 124, 251, // .|s...G...|.
+ 133,  70,  75, 141, 249,  32,  54,  33, 138, 200,  87, 243, // .FK.. 6!..W.
+ 145, 244,  10, 214, 191,  79,  28, 196, 218,  47, 238, 246, // .....O.../..
+ 131, 205, 118,  27, 170, 112,  95, 146, 203, 101,  16,  98, // ..v..p_..e.b
+   8,   9, 235, 142, 162, 189, 186,  64,  84, 105, 180, 144, // .......@Ti..
+  78,  76, 125,   1, 151, 170,  94, 189,  19, 191, 169,  31, // NL}...^.....
+  84, 212,  36, 130, 147,  68,  70, 191, 250,  76,  37, 244, // T.$..DF..L%.
+ 224,  91, 185, 105, 237, 227, 240,  12,   1, 204,  11,  17, // .[.i........
+ 229,  32, 202, 255,  89, 182, 225, 132,  91, 217, 231, 107, // . ..Y...[..k
+ 154, 226, 207,  36, 165, 170, 148,  34, 159,  75,  36,  88, // ...$...".K$X
+  23,  19, 245, 156, 164,  73,   5, 254, 225, 137,  68,  65, // .....I....DA
+ 253, 202,  14, 159,  40,   4, 230,  40,  25,  69,  61,  45, // ....(..(.E=-
+ 163, 190,  79, 177, 189, 242,  20, 202, 208, 132,  98, 158, // ..O.......b.
+ 149,  49, 187,  33,   9, 241, 207,  72, 126,  86,  88, 127, // .1.!...H~VX.
+ 222,  17,  59, 242,  27,  22, 248, 215,  20, 245,  12, 108, // ..;........l
+  93, 252,  46, 168, 186,  77, 139, 223,  86, 174, 169, 185, // ]....M..V...
+ 163, 101, 176, 134, 161, 168, 247,  38, 138, 214, 125, 250, // .e.....&..}.
+  64,  87,  80, 195,  75,   9,   5,  71,  32, 140, 116, 252, // @WP.K..G .t.
+  50, 136, 165,  85, 191, 149,  81,  79, 195, 137,  70, 235, // 2..U..QO..F.
+  40,  48, 168,  90,  28, 198, 149, 195, 160, 198, 131, 125, // (0.Z.......}
+ 225,  48, 150,  55, 111,  43, 136,  93, 108, 201, 229, 118, // .0.7o+.]l..v
+  63, 142,  55,  76, 188, 242,  40,  12, 225,  87, 219, 227, // ?.7L..(..W..
+  11,  55, 226, 125, 149, 148,  87, 227, 168, 200, 250,  71, // .7.}..W....G
+  71,   6, 236, 133, 105, 179, 189,  53, 239,  51, 204, 156, // G...i..5.3..
+  54,  15, 169,  53,  77,  29,  86, 124,  63, 194,  63, 125, // 6..5M.V|?.?}
+ 144, 149, 190,  31,   9, 241,  72, 192, 239,  21, 247,  41, // ......H....)
+   9,   3, 155, 176, 109, 125,   2, 136, 229,  59,  41, 239, // ....m}...;).
+  20,  18,  91, 106, 121, 162, 132, 121,  34, 104, 154,  51, // ..[jy..y"h.3
+ 111, 206,  91,  89, 197,  98,  50, 164,  14, 160, 110,  17, // o.[Y.b2...n.
+ 129,  19,  47, 229, 221, 117, 236,  88, 194,  34, 221, 122, // ../..u.X.".z
+  44, 111,  22, 113, 177, 196, 229, 135, 245, 163,  78, 137, // ,o.q......N.
+  52,  89, 236, 190, 139,  38,  39, 149,  38, 187,  41, 183, // 4Y...&'.&.).
+  54, 149, 214, 102, 124, 169,  71, 165, 181, 132, 243, 182, // 6..f|.G.....
+ 181, 236,  17,  70, 110,  53, 225,  59,  77, 168,  42, 222, // ...Fn5.;M.*.
+ 170, 194,  93,  13,  54, 148,  62,  35, 102, 237,  52, 239, // ..].6.>#f.4.
+  95, 177, 174,  11, 134, 169, 156, 129, 162,  96,  43, 110, // _........`+n
+  52, 115,  32, 103,  65, 252,  73,  22, 215, 239, 202, 189, // 4s gA.I.....
+ 212,  98, 155, 180, 114, 124,  46, 254, 169, 166, 212, 199, // .b..r|......
+ 146, 162, 173,  47,   8, 159,  63, 122, 133,  43, 177, 154, // .../..?z.+..
+  45,  26,  11, 124,  34, 245, 198, 133, 140,  80,  51, 186, // -..|"....P3.
+ 254,  65, 116, 221, 144,  76,  10, 215,   4, 226, 221,   7, // .At..L......
+ 102, 109, 125, 102, 131,  42,  53, 209,  24, 216, 243,  74, // fm}f.*5....J
+  35,  57, 166,  52, 150,  51,  74,  67, 115,  24, 233, 180, // #9.4.3JCs...
+  16, 106,  79, 130, 129, 109, 147, 145, 109, 207,  17, 130, // .jO..m..m...
+  55, 117,  36, 210, 242,   5,   5, 240, 219,  12,  49,  44, // 7u$.......1,
+ 141, 246, 216, 145, 234, 133, 184,  64,  69,  59, 142, 132, // .......@E;..
+  90,  93,   7,  23, 255, 232, 174, 119, 123, 197, 233, 221, // Z].....w{...
+ 115,  28,  30,  10,  46, 136,  18,  59, 127,  31, 141,  70, // s......;...F
+ 142, 127,  98,  79, 251, 117, 224,  42, 192, 200, 177, 171, // ..bO.u.*....
+ 171, 215,  59, 109,  96, 209,  21, 211, 128, 210,  96, 232, // ..;m`.....`.
+  90,  93, 211, 226,  17,  23,  74, 233, 118, 243,  98, 189, // Z]....J.v.b.
+  11, 173, 116, 135,  95,   8, 202, 221, 181,  11,  40, 166, // ..t._.....(.
+  55, 214,  46, 122, 238,  81, 229, 220, 134,  39, 231,  90, // 7..z.Q...'.Z
+  11, 219, 219, 184,  31, 127, 239, 158, 168,  11,  53,  16, // ..........5.
+  51, 152,   1, 204,  96, 212,  57, 159,  46,  59,  85,  67, // 3...`.9..;UC
+ 182, 171, 187, 160, 169, 100, 162, 179,  64,  18,  68, 193, // .....d..@.D.
+  57, 113,  72,  71, 196,  31,  17,  67,  69, 124,  16,  45, // 9qHG...CE|.-
+ 185,  21,  27,  73,  62,  85,  84, 168, 164,  43, 206,   4, // ...I>UT..+..
+  12,  22, 227, 198, 166,  95,  75, 191,  12, 112,  24, 114, // ....._K..p.r
+ 142, 229, 189,  26, 112,  17, 184,  22, 170, 108, 116, 192, // ....p....lt.
+ 214, 152,  61, 189, 235,  94, 128, 138,  92,  48, 123, 194, // ..=..^...0{.
+  22, 200,  23,  84, 180, 127,  81, 120, 128,  20, 136, 247, // ...T..Qx....
+   6, 134, 211, 188,  40, 239,  87, 178,   4,   2, 211,  11, // ....(.W.....
+ 164,  38, 103, 198,  29, 148,  70, 233, 202,  29,  92,  52, // .&g...F....4
+ 227, 242,  94, 229,   8,  14, 123, 241, 151,   9, 181, 210, // ..^...{.....
+ 134, 205, 165, 153,  93,  43, 157, 153, 123,  46,  22,  28, // ....]+..{...
+  94, 159,  96, 172,  11,  20, 141,  61,  98, 234, 112, 145, // ^.`....=b.p.
+ 148, 181,  43,   1, 142, 121, 132,  47, 178, 114,   1, 222, // ..+..y./.r..
+ 130, 173,  71,   6, 204,  56, 181, 159, 171,  11,  28, 128, // ..G..8......
+  89, 105,  99,  43,   3,  26, 168,  50,  89,  84,  38, 195, // Yic+...2YT&.
+  25, 190,  57,  92, 104,  94, 171, 230, 117, 117,  82, 124, // ..9.h^..uuR|
+  95,  63, 157,  84,  30,  24,  36, 232,  87, 221,  46,  40, // _?.T..$.W..(
+ 151, 170, 153, 222, 222, 142,  60, 179, 206, 137, 101, 218, // ......<...e.
+ 132, 203,  71, 147, 225,  21, 107,  90, 126,  77, 169, 242, // ..G...kZ~M..
+  81, 223, 221,  88,  13, 189,  32, 216,  96,  99,  54,  14, // Q..X.. .`c6.
+  31, 121, 106,  80, 166,  26,  16,  76, 127, 113, 217, 169, // .yjP...L.q..
+  98, 252,  39, 213, 198,  82, 189, 223,  93,  13, 137, 231, // b.'..R..]...
+  48, 225, 149, 140, 149,  36, 157, 213, 176, 214, 142, 175, // 0....$......
+  22,  95,  53, 134, 171,  22, 228,  46, 214,  95, 237, 106, // ._5......_.j
+ 205, 248, 179, 132, 218, 159, 197, 250,  33, 122, 140, 234, // ........!z..
+ 149,  19, 123, 225, 184, 159,  47, 152,  39,  45, 178,   6, // ..{.../.'-..
+ 185,  42, 194,  32,  71, 203, 225,  63,  38, 212,  90,  22, // .*. G..?&.Z.
+ 113, 137, 202, 107, 156, 218,  47,  70,   4, 252, 166,  10, // q..k../F....
+ 235, 139, 186,  53,  17,  92,  90,  25,  71, 212, 152, 161, // ...5..Z.G...
+  31, 151,  33, 134, 245,  73,  16,  49, 129, 194, 172, 250, // ..!..I.1....
+  52, 135,  96,   3,   5, 160, 191, 129, 191,  48, 198, 164, // 4.`......0..
+ 144,  65, 127, 172,  79, 162,  68,  78, 152, 243, 188,  43, // .A..O.DN...+
+ 142, 163,   6, 233, 154, 217,   3, 216,  96,  55,  32, 153, // ........`7 .
+ 159, 241,  41, 211, 184, 239, 142, 131,  84, 157,   6,  39, // ..).....T..'
+  52,  68,  35, 122,  27, 210, 219, 151, 174,   7,  49, 253, // 4D#z......1.
+ 161,   5,  15,  87, 185, 161, 128,  81,  48, 228,   5, 208, // ...W...Q0...
+  31,   7, 167, 252, 130, 134, 152, 211, 234, 112, 118, 173, // .........pv.
+  12,   3,  69, 159, 112, 203, 225, 245,  74, 152, 139, 121, // ..E.p...J..y
+ 202, 124, 215, 154,   3, 213,  28,  84,  65, 212, 134, 104, // .|.....TA..h
+  92, 215, 250,  48,  37,  51,  72,  97, 117, 175, 178,  27, // ...0%3Hau...
+  79,  33,  34,  36, 185,  98, 246,  97, 132, 223, 194, 246, // O!"$.b.a....
+ 195, 207, 141, 169, 247, 156, 241, 120, 145,  86,  23, 105, // .......x.V.i
+ 103,  56, 170,  39, 187, 210, 113,  71, 197,  68, 194,  55, // g8.'..qG.D.7
+  84, 252,  64, 197, 155,  42, 222,  82, 241, 182, 138,  31, // T.@..*.R....
+ 169, 248, 161,  74, 180,  74,  72, 242, 167,  17, 228, 109, // ...J.JH....m
+ 218, 132, 247, 105,  19, 248, 202,  43,  87, 219,  36,  34, // ...i...+W.$"
+ 206, 159,  99, 234,  87, 237, 100, 117, 129, 138, 196,  18, // ..c.W.du....
+  92, 180, 154, 177,  45,  88,  17,  25,  84,  60, 161,  64, // ....-X..T<.@
+ 162, 184,  73,  18,  24, 172,  60, 117,  19, 184,  44, 229, // ..I...<u..,.
+  13, 215,  74, 130, 137,  43, 138, 154,   7,   4, 136,  37, // ..J..+.....%
+ 230, 234,  95, 176, 171,  97,  19, 154, 146,  25,   4,  68, // .._..a.....D
+ 236, 126,  15, 162, 126, 129,  37,  98, 149, 111, 100,  10, // .~..~.%b.od.
+ 197, 102,  55, 241, 119, 222, 236, 219,  43, 176,  39,  65, // .f7.w...+.'A
+  96, 125, 102, 191,  40,  74,   2,  14, 107, 133, 214, 107, // `}f.(J..k..k
+  23, 225, 205,  72, 138,  21, 227,   3, 182,  32, 209,  15, // ...H..... ..
+  10, 123, 185,   7, 198, 236, 222, 232, 138,  10, 238, 211, // .{..........
+ 220, 240,  66,  77, 194, 205,  47, 159, 171,  27,  91, 204, // ..BM../...[.
+ 240, 234, 119,  46,  91,  11,  22, 183, 215,  84,  12, 216, // ..w.[....T..
+  60,  81,  81, 199, 187, 150,  89,  48,  70, 117, 102, 177, // <QQ...Y0Fuf.
+  79, 196,  64,  12, 144,  41,  29, 206,  67,  93,  37, 252, // O.@..)..C]%.
+  28, 182, 252,  18, 225, 223,  96, 137,  38,  26,  72, 137, // ......`.&.H.
+  10,  77,   4,  28, 155, 177,  86, 142,  36,  65, 175, 222, // .M....V.$A..
+ 179,  69, 204, 183, 219,  56, 197,  93,  55, 230, 160,  66, // .E...8.]7..B
+ 138, 206,  39,  21,  99, 193, 180, 208, 206, 202,  97,  82, // ..'.c.....aR
+  19, 217,  46, 204,   8, 117, 144, 149,  77, 175, 158,  23, // .....u..M...
+ 134, 129,  72, 217, 248, 172, 104,  60, 180,  18, 239,  93, // ..H...h<...]
+  73, 201,   2, 188,  34, 161,  64,  66,  40,  23, 135, 120, // I...".@B(..x
+ 205, 248,  30, 235, 140,  56, 213, 142,  21,  93, 105,   0, // .....8...]i.
+ 239, 173, 173,  41,  43, 190, 238, 112,  14,  10, 220, 111, // ...)+..p...o
+  54,  61,  99, 163,  21, 255,  44,  50,  46, 215, 134, 143, // 6=c...,2....
+ 125,   3,  44, 123,  28,  77,  16, 144,  50, 253, 234,  18, // }.,{.M..2...
+ 247,  76, 132, 115,  10,  62, 157,  98, 217,  13,  27, 246, // .L.s.>.b....
+ 126, 161,  21,   1,  95,   3, 153,  88,  62,  32,  68, 239, // ~..._..X> D.
+  23, 215,  22,  49, 209, 168,  23,  87, 168, 153,  14,   3, // ...1...W....
+  75,  28, 216, 161, 159, 192,  52,  10, 140, 235,  41, 117, // K.....4...)u
+  64, 180, 249,  48, 224,  26,   7,  44, 166, 168,  17,  61, // @..0...,...=
+  34, 203, 250,  15, 184,  89,   3,  69,  67, 144, 193, 170, // "....Y.EC...
+  18,  35, 107, 218, 101, 182, 244,  71, 156,  98, 132,  20, // .#k.e..G.b..
+ 209, 161, 130,  51, 169, 180,  72,  33,   0,  72, 203, 163, // ...3..H!.H..
+ 103, 120,  15, 175, 216,  10, 183, 234, 116,   7,  27, 215, // gx......t...
+  85,   4, 135, 240,  37,  51, 201, 124,  22, 126, 213, 147, // U...%3.|.~..
+ 138,  20, 167, 173, 133,  38, 207,  93, 174, 138,  80,  79, // .....&.]..PO
+  14, 232,  84,   4, 144,   0, 104,  88, 132, 226, 248,  27, // ..T...hX....
+ 182, 139,  10,  44, 136,  75,  20, 158, 213,  81, 116, 222, // ...,.K...Qt.
+  45, 144, 157,  86, 229,  28,  65,  17, 242,  93, 105, 186, // -..V..A..]i.
+  52,  81, 106, 136,  11, 186,  91,  30,  80, 174,  53, 155, // 4Qj...[.P.5.
+  19, 203, 108, 249,  66, 187, 204, 197, 234,  55,  51, 226, // ..l.B....73.
+  34,  43, 228,  54, 169,  52,  51, 149, 101,  42,   3, 113, // "+.6.43.e*.q
+ 146, 249, 192, 136, 186,  34, 208, 191, 189, 101, 196,  92, // ....."...e..
+  17, 248, 123,  55,  89, 101,  96, 178, 114,  96, 122, 118, // ..{7Ye`.r`zv
+ 246, 136, 245,  99,  38, 150, 153,  27, 236,  94,  39, 149, // ...c&....^'.
+   2,  69, 215, 130, 243, 130, 118,  98, 153,  51, 131, 246, // .E....vb.3..
+ 147, 173,  56,  43,  89, 168, 186, 106,  22,  92, 114,  89, // ..8+Y..j..rY
+ 201, 130, 110, 227, 218, 172, 152, 249,  81, 214, 180, 207, // ..n.....Q...
+ 145, 245,  95,  23, 152, 125,  49,  77,  55,  56, 127,  45, // .._..}1M78.-
+ 182,  36, 229, 106,  73, 139,  97, 177, 229, 187,  16,   7, // .$.jI.a.....
+ 219,  79,  79,  76, 154, 140, 186, 140,  61,  61,  67, 127, // .OOL....==C.
+ 219,  43, 116, 198, 165, 202,  11,  43, 241, 118, 192, 122, // .+t....+.v.z
+ 175, 249, 197, 224, 129,  39,  20, 157, 215,  84,  56, 123, // .....'...T8{
+ 126,  16, 136, 185,  84, 125, 137,  18, 128, 194,  30, 203, // ~...T}......
+ 232,  29, 123,  43, 186, 103,  17, 107, 209, 144, 126, 165, // ..{+.g.k..~.
+  80,   2,  87, 108, 110, 204,  37,   3,  55, 229, 161, 171, // P.Wln.%.7...
+  42,   1,  76, 171, 199, 133,  42,  68, 146,   7, 203,  20, // *.L...*D....
+   6, 187,  17, 215,  28, 211, 226, 195, 115, 212,  32, 243, // ........s. .
+ 201, 175, 108, 234, 133,  99, 209,  18, 198, 158,   2, 171, // ..l..c......
+  73, 218,  54, 137,  33, 185, 230,  88,  23,  11, 227,  17, // I.6.!..X....
+  75, 226, 225, 140, 248, 172,   3,  98, 218,  14, 131,  59, // K......b...;
+ 148,  21,  64, 205, 239, 172, 209, 183, 221, 113, 137,   8, // ..@......q..
+ 215, 196, 197, 104, 144, 137, 183,  70, 115,  90,  85, 172, // ...h...FsZU.
+ 249, 210, 133, 194,  42,  62,   4,  72, 182, 196,  13, 146, // ....*>.H....
+  74,  79, 248, 162, 210, 136, 175,  49,  13, 137, 106, 167, // JO.....1..j.
+ 235, 201, 253,   8, 107, 222,  48,  45, 252, 119, 133,  80, // ....k.0-.w.P
+  50,  38, 247, 245, 122,  36, 123, 157, 176,  17, 233,  60, // 2&..z${....<
+ 220,   9, 178,  53, 119, 107, 135, 112, 243, 202,  92,  37, // ...5wk.p...%
+ 237, 183, 237, 206, 172, 220, 192,  43, 238, 119, 215, 214, // .......+.w..
+ 194, 199, 246, 188, 141, 141, 134, 179, 251,  25,  27,  88, // ...........X
+  83,  23, 162, 100, 144,  77, 168,  11, 252, 172, 116,   1, // S..d.M....t.
+ 194,   1, 126, 132,  82, 167, 198,  69, 190,  53, 189,  49, // ..~.R..E.5.1
+ 199, 192, 130,  20, 170,  19, 112, 201,  56,  14, 247, 143, // ......p.8...
+ 174, 216, 215,  88,  19, 151, 105, 117, 176,   7, 229,  49, // ...X..iu...1
+  47,  12,   2, 191,  48,  25,  41, 164, 175,  46, 134, 158, // /...0.).....
+ 167, 175,  39, 206,   7, 205,  87, 127,  48, 119,  16, 108, // ..'...W.0w.l
+ 160, 198, 213, 104,  10,  29, 216, 131,  96,   3,  62,   8, // ...h....`.>.
+  54,  33, 190, 185,  56, 245,  68, 111, 242,  34, 180, 182, // 6!..8.Do."..
+  60, 140,  48, 162, 186, 167, 224, 136, 229, 209,  43,  14, // <.0.......+.
+ 131,   5, 124, 238,  42, 182, 199, 140,  40, 233,  16, 105, // ..|.*...(..i
+   8, 194, 230, 148,  91,  44, 166,  97,  61, 243,  12, 126, // ....[,.a=..~
+ 116, 173, 195, 124,  73, 138,  11,  87, 132, 228, 158, 194, // t..|I..W....
+ 136, 156,  19, 241,  59,  35,  39,  79, 229,  25, 141,  12, // ....;#'O....
+ 223, 107, 241, 165, 153,  20, 159,  45, 204,  36, 153,  55, // .k.....-.$.7
+ 177,  64,  46, 190, 196, 236, 135, 166, 245, 181,  72,   0, // .@........H.
+  92, 188, 226,  47,  26,  26, 174, 134,  72,  51, 129, 110, // .../....H3.n
+ 131, 213, 137,  80, 173, 176,  25,  18, 172, 110, 173,  89, // ...P.....n.Y
+  71,  97,  64,  41, 166, 146, 222, 140, 105, 194, 150, 208, // Ga@)....i...
+ 132,  77, 230,  94,  95, 187, 250, 103,  26, 164, 252,  59, // .M.^_..g...;
+ 184, 246, 167,  87,  62, 146, 166, 242,  31, 204,  39,  45, // ...W>.....'-
+ 252, 111, 205, 107, 198, 251, 134, 244, 250, 177,  76, 255, // .o.k......L.
+ 177, 158, 254,  99, 153, 254,  99, 153, 254,  21,  66,  63, // ...c..c...B?
+ 153,  87,  10, 125,  65, 179, 227, 165, 177,  72, 249, 197, // .W.}A....H..
+ 205,  63, 225,  52,  30,   5,  24,  51,  56,  10, 121, 193, // .?.4...38.y.
+  33,  21,  82, 115, 115, 164,  99,  95,  43, 158, 247, 133, // !.Rss.c_+...
+ 137, 101, 162,  96, 207, 231, 167, 226,  19,  55, 155, 121, // .e.`.....7.y
+  85, 159,  76,  26,  92, 164, 213, 183,   0, 125, 131, 160, // U.L......}..
+ 211, 227, 155, 232, 251,  14, 200, 168, 227,  75, 195, 211, // .........K..
+  38,  84, 248,  56, 238,   9, 247,  23,  89,  63, 193,  84, // &T.8....Y?.T
+  83,  38,  33,  55, 145,  82,  74, 203,  28, 184, 115,  49, // S&!7.RJ...s1
+  49, 124, 110,  79,  10, 162, 207, 252,   7, 223, 192,   3, // 1|nO........
+ 113,  38, 181, 111, 178,  35, 254,  87,  31,  80, 145,  75, // q&.o.#.W.P.K
+ 221, 173, 145,  50, 191, 211, 128, 126, 134,  40,  27,  63, // ...2...~.(.?
+ 129,  42,  60, 126,   6, 173,  52, 180, 207, 191,   5, 241, // .*<~..4.....
+  59, 163,  46, 121,  21, 144, 140, 179, 207, 123,  41, 249, // ;..y.....{).
+ 119, 196, 204, 127, 127, 123, 155, 255,  64, 207,  63, 233, // w....{..@.?.
+ 249, 150, 158, 196,  54, 231, 191, 210, 243,  71, 234,  44, // ....6....G.,
+ 147,  67, 179,  92, 230, 111, 215, 225,  82,  51, 200, 127, // .C...o..R3..
+  93, 207, 127, 236, 149, 155, 208,  56,  31, 178,  93,  93, // ]......8..]]
+  78, 188,  27, 243, 126,  63, 208,  48, 126, 162, 190, 221, // N...~?.0~...
+  39, 217,  58, 222,  88,  93, 253, 224, 146,  28, 246, 139, // '.:.X]......
+ 107, 226,  61,  85, 236,  30, 199,  15,  56,  18, 183, 142, // k.=U....8...
+ 113,  52, 229, 241,  76,  92, 237, 190, 200, 114,  99,  83, // q4..L....rcS
+ 220, 151, 196, 215, 196, 210, 113,  61,  87, 252, 146,  99, // ......q=W..c
+ 107, 250, 136, 173, 216,  46,  92, 142, 228,  83, 215, 244, // k........S..
+ 126, 101, 222, 165,  80, 172, 193, 201, 105, 209, 254,  71, // ~e..P...i..G
+ 132, 236, 167, 229, 114, 152, 156,  90, 235, 138, 130, 157, // ....r..Z....
+ 143, 249,  22, 202, 211, 162,  95,  54, 137, 121,  55, 125, // ......_6.y7}
+ 164,  55,  25,  45, 254, 120, 238, 189, 118, 147,  19,  16, // .7.-.x..v...
+ 200,  83, 170, 156,  56, 220, 239,  97, 222, 154, 255,  25, // .S..8..a....
+ 228,  63, 192,   6,  26,  45, 249, 145, 192,  57, 179, 107, // .?...-...9.k
+  52,  28, 125, 200, 204, 234, 204, 242,  79, 188, 240, 191, // 4.}.....O...
+ 144, 179, 113,  80, 214, 232,  48,  99, 231,  32, 184, 152, // ..qP..0c. ..
+ 192, 162, 123, 137, 230, 229,  89, 166,  93, 164, 196,  49, // ..{...Y.]..1
+ 146, 118,  85,  76, 230,  11, 165, 108,  18,  28,  86,  40, // .vUL...l..V(
+ 122, 143, 206, 187, 201,  57, 129, 195,  19, 163, 106,  79, // z....9....jO
+  21,  35, 139, 129, 117, 147,  93, 217, 134, 166, 245, 145, // .#..u.].....
+ 231, 249, 182,  76, 247, 177,  77,  99, 205, 225, 243, 135, // ...L..Mc....
+  72, 252, 218, 245, 196,  42, 155,  90, 240,  12, 194, 238, // H....*.Z....
+  51,  44, 172, 165, 163, 129,  14, 183,  34, 211, 225, 240, // 3,......"...
+  26, 205, 224, 157,  77, 145, 191,  43, 146, 240, 180, 118, // ....M..+...v
+ 117, 198, 220,  33,  42, 195, 153,  90, 169, 174, 188,  98, // u..!*..Z...b
+ 188,  96,  55, 171,  94,  32,  52,  36,  11, 214,  16, 176, // .`7.^ 4$....
+  37, 178, 112, 170,  96,  55, 217, 128,  19,  66,  78,  46, // %.p.`7...BN.
+ 204, 162, 193, 114,   4, 245,  42, 199,  78,  76,  22, 109, // ...r..*.NL.m
+   4, 188,  78,  41,   4,  23,  71,  89,  86,  36,  37,  45, // ..N)..GYV$%-
+ 181, 186, 217, 121,  32, 229,  53, 243,  10, 103, 210, 227, // ...y .5..g..
+   3,  71, 171, 171, 221, 226,  16,  17, 206, 255,  25,  21, // .G..........
+   8, 106, 122,  47,  79,  35, 149,  73, 141,  28, 102, 229, // .jz/O#.I..f.
+  50,  35,  99, 216, 138, 248,  65, 232, 175, 132,  59, 203, // 2#c...A...;.
+ 153,  47,  51, 150, 235,  51,  62, 113, 159,  15,  78, 107, // ./3..3>q..Nk
+  92,   5,   6, 228, 134,  53,  14,  80, 115, 228,  10, 112, // .....5.Ps..p
+  34,  36, 192, 125,  70,  57, 245,  34, 171, 236,  48, 213, // "$.}F9."..0.
+ 111,  62, 117, 147,  72, 204,  30,  50,  13, 212,   9, 138, // o>u.H..2....
+ 171,  64, 182, 176,  74, 240, 246, 255,  10, 248, 222, 101, // .@..J......e
+ 187, 171,  62,  55,  72,  25, 227,  99, 176, 110,  68, 131, // ..>7H..c.nD.
+ 228, 220, 252, 128, 135, 125, 196, 150, 194,  89, 120, 162, // .....}...Yx.
+ 146, 113, 144, 140,  90,  36, 187,  14, 241, 188,  46, 217, // .q..Z$......
+  84,  80, 131,  43,  60,  58,  98, 206, 101, 108,  82, 174, // TP.+<:b.elR.
+ 136, 153, 253, 232,  49, 170, 130,  55, 142, 187, 181, 216, // ....1..7....
+ 107,  19,  91,  57, 216,  20, 111,   4, 208,   4,  61,   8, // k.[9..o...=.
+  98,  56,   5, 196,  87, 151, 191, 112,  10,  48,  47, 108, // b8..W..p.0/l
+ 124,  19,  54, 142,   1, 245, 145, 102, 158, 138,  99, 133, // |.6....f..c.
+ 152,  38,  30,  91, 248,  89,  87, 225, 124,  55,   9,  24, // .&.[.YW.|7..
+  70, 120, 255, 107,  23, 247, 200, 192,  11,  96, 219, 218, // Fx.k.....`..
+  83, 227,   8, 136, 201,  75, 117, 156,   4, 102, 198, 245, // S....Ku..f..
+ 185, 161,  18, 238,  96,  26, 162, 172, 190, 254, 232, 235, // ....`.......
+ 159,  61, 115, 188, 166, 152,   7, 231, 197,  62, 127,  98, // .=s......>.b
+  45, 219, 230, 132,  55,  34,  45,  80, 141, 176, 121,  10, // -...7"-P..y.
+ 147, 168, 231, 124,  65, 206,   9, 238,  47,  96,  51,  58, // ...|A.../`3:
+ 187,  37, 110, 137, 140, 212,  91, 189, 123,  40, 185, 176, // .%n...[.{(..
+ 170,  90, 158, 119, 114,  16, 139, 217, 221, 154, 139, 151, // .Z.wr.......
+ 228,  72, 236, 100, 192, 155,  22, 122,  32,  24,  76,  86, // .H.d...z .LV
+ 119,   4, 196,  14, 102,  37, 120, 107,  87,  74, 163,  62, // w...f%xkWJ.>
+  34, 137,  14,   7,  49, 207, 229,  68, 105, 205,  14, 204, // "...1..Di...
+  56,   8,  45, 205,  91,  83, 176, 205, 216, 130, 202, 140, // 8.-.[S......
+ 157,  95, 206, 139, 105,  74,  49, 148, 160, 151,  88,  59, // ._..iJ1...X;
+  77, 227, 164, 130, 120,  96, 222, 167, 131,  15,  61,  91, // M...x`....=[
+ 129, 210, 191,  30, 164, 135, 242, 142, 147,  11, 133, 204, // ............
+ 115,  68, 193, 108,  17, 131, 104, 177, 167,  75, 137,  31, // sD.l..h..K..
+ 143, 242, 107,  62,  68,  51, 164, 169, 117,  46,  73, 248, // ..k>D3..u.I.
+ 185, 144, 132,  15,  70, 188,  69, 127,   8, 162,  60, 219, // ....F.E...<.
+ 220, 194, 234, 223, 106,  38, 150, 116, 142, 121, 249,  94, // ....j&.t.y.^
+ 123,   7, 157, 208, 236, 229, 208, 112,  21,  68,  32,  19, // {......p.D .
+ 177, 233, 148, 220, 112,  22,  63, 236, 115, 221, 230, 182, // ....p.?.s...
+  26, 238,   8, 227,  13,  17, 141,  51,  54, 127, 244, 113, // .......36..q
+  22,  83,  44,  33, 235, 150,  62,  31, 164,  99, 115, 166, // .S,!..>..cs.
+  89,  98,  37,  49, 234, 187,  52, 208, 201, 188, 179, 140, // Yb%1..4.....
+  82, 231, 197,  59, 254, 201, 188,  75, 232,  74,  60,  91, // R..;...K.J<[
+  80,  36,  75, 178, 177, 169, 132,  49, 190,  72,  42, 152, // P$K....1.H*.
+ 102, 108, 134, 112, 204,   6,  61, 126,  83,  15, 206, 196, // fl.p..=~S...
+ 182, 192,  16,   7, 153,  98, 201, 185,  37,  22,  98,  96, // .....b..%.b`
+ 149,  28,  41, 177, 242, 122,  10, 111, 115, 117,  27, 175, // ..)..z.osu..
+ 111, 118,  26, 162, 244, 159, 133,  69,  87, 105,  23, 246, // ov.....EWi..
+ 103, 105,  23, 214, 102,  87,  48,  82, 241, 178, 138, 222, // gi..fW0R....
+ 185, 250,  79, 248, 219,  44, 237, 191, 230,  82, 201, 132, // ..O..,...R..
+  96, 233, 255, 207,  66, 243, 235, 151, 213, 178, 131,  35, // `...B......#
+  33,  40, 215, 193, 141, 220, 130, 180, 210, 174, 108, 233, // !(........l.
+  38,  87, 110, 125, 199, 251,  39, 108, 108,  39, 204, 165, // &Wn}..'ll'..
+ 231, 235, 186, 201, 142, 141, 229,  80,   2, 179, 134,  86, // .......P...V
+  66, 205, 223, 246, 108,  12, 167, 197, 118, 245, 175,  94, // B...l...v..^
+ 147,   0, 206, 158, 187,   1,   1,  14, 207, 154, 185,  53, // ...........5
+ 154,  77,  89, 219, 129,  75,  25, 215, 242, 245, 236, 190, // .MY..K......
+ 155, 138, 227, 163,   8, 155, 101, 169, 213, 136, 136,  72, // ......e....H
+  65, 140, 236, 164, 175,  99, 220, 252,  17, 178, 118,  99, // A....c....vc
+ 210, 231, 189, 147, 160,  67,  56, 253,  83,  11, 218,  13, // .....C8.S...
+ 234, 251, 253, 220, 115,  67, 149,  90, 109,  71, 197, 123, // ....sC.ZmG.{
+ 113,  98,  44, 215, 153,  30, 133, 202, 112,  79, 176, 146, // qb,.....pO..
+ 224, 144, 180,  96, 162, 130, 234, 182,  74, 114,  89, 201, // ...`....JrY.
+  37,  76, 181,  48,  88,  69, 198, 172, 228, 179, 144,  19, // %L.0XE......
+ 179, 214,  88, 122, 158, 168,  39,  74,  47,  88, 122,  22, // ..Xz..'J/Xz.
+  51, 244, 173,  88, 154,  50, 234,  46, 179, 244, 244,  10, // 3..X.2......
+  87,  73,  56,  78,  66,   5, 189, 135,  99,  79, 217, 194, // WI8NB...cO..
+ 199, 189, 103,  19, 137,  88, 122, 199, 216, 123,  55, 193, // ..g..Xz..{7.
+ 117,  65, 180,   6,  18, 244, 249, 160, 136, 108, 101, 206, // uA.......le.
+ 138, 172,  63, 133, 113, 144,  92,  85, 189,  49, 149, 222, // ..?.q..U.1..
+ 126, 177,  80,  65, 183,  93, 250, 117,  18,  85, 119, 204, // ~.PA.].u.Uw.
+  46,  81, 222, 226, 217,  38,  73,  66, 220,  60,  21,  81, // .Q...&IB.<.Q
+  27,  56, 160,  18, 195,  67,  67, 219,  51, 248, 187,  43, // .8...CC.3..+
+ 167, 117,  74,  55, 194,  98,  81, 108, 214,  54, 205,  94, // .uJ7.bQl.6.^
+ 247,  45,  67, 199,  78, 135,   5,  45, 247,  42, 231,  94, // .-C.N..-.*.^
+ 146,  99,  63, 185,  84, 201,  25, 111,   9,  87, 130,  42, // .c?.T..o.W.*
+ 232, 250,  90, 186,  94, 222,  88, 160,  89,  95, 219, 151, // ..Z.^.X.Y_..
+ 199, 194,  70,  91,  62, 224,  69, 106, 230, 249, 114, 180, // ..F[>.Ej..r.
+   7, 238, 153, 144, 146,  36, 141, 129, 217, 112, 195,  39, // .....$...p.'
+  51, 149, 244,  12, 242,   1, 223, 163,  92, 221, 111, 153, // 3.........o.
+  55,  96, 131, 243,  47,  62,  21,  35,   7, 212, 207, 188, // 7`../>.#....
+ 250, 190, 116, 225,  91, 141,  55, 198, 113, 221,  75, 155, // ..t.[.7.q.K.
+ 207,  44, 138, 221,  85, 252, 179,  63, 101,  51, 137,  32, // .,..U..?e3. 
+  63, 235,  39,  21, 145,  31,  57, 251, 253, 252, 181,  57, // ?.'...9....9
+ 153, 238, 210, 128,  73, 172, 221,  29,  40,  92,  35, 165, // ....I...(.#.
+ 188,  17, 129, 189,  80,  36, 191,  57, 242, 249,  54,  49, // ....P$.9..61
+  83,  20, 239, 129, 176, 213, 235, 128, 247, 131, 120,  93, // S.........x]
+ 177, 108, 114,  69, 109, 198, 102, 245,  69, 148,  87, 246, // .lrEm.f.E.W.
+ 119, 205, 149, 157, 139, 133, 110,  27, 174,  23, 220, 246, // w.....n.....
+  89, 221, 159,  78,  30,  84, 171, 135, 203, 239, 186,   2, // Y..N.T......
+  53, 247, 242,  11,  24, 252, 145, 212, 116,  88, 177,  39, // 5.......tX.'
+ 109,  37, 233,  80, 255,  36,  39,  68,  14, 146,  67,  17, // m%.P.$'D..C.
+ 232, 193, 190, 171,  57, 198, 225, 181, 156, 209, 173,  78, // ....9......N
+ 212, 221, 154, 137,  80,  47, 126,  24,  96,  55, 141, 120, // ....P/~.`7.x
+ 188,  88,  29, 240, 190, 218,  33, 152,  41, 182,  52,   5, // .X....!.).4.
+ 248,  16, 194,  12,  27,  83,   1, 250,  20,  78,  11, 201, // .....S...N..
+  43, 220,  94,  41,  37,  38, 119,  10, 136,  40, 199, 174, // +.^)%&w..(..
+ 109,  31,   3,  29,  26,  13, 225, 252, 209, 173, 172, 130, // m...........
+ 193,  28, 194, 186, 166, 157,  68, 248, 137, 120, 247, 246, // ......D..x..
+  54, 190, 183,  67,  83, 244,  38,   9, 228, 124,  81, 221, // 6..CS.&..|Q.
+ 191, 232,  50, 180,  99, 223, 248, 139, 107, 174, 158,  95, // ..2.c...k.._
+ 115, 123,  32,  72, 115, 180, 198, 158, 155, 173,  17, 157, // s{ Hs.......
+ 242,  52, 177, 107, 231,  66,  34,  35, 208, 246, 202, 123, // .4.k.B"#...{
+ 112,  97, 117, 104, 237,  13, 139, 198,  18, 113,  34, 122, // pauh.....q"z
+ 226,  86,  38, 110, 238,  19,  44, 245,  47,  53, 250,  67, // .V&n..,./5.C
+ 228, 250, 210, 229, 141, 155, 132,  15,  95, 165,  48,  81, // ........_.0Q
+ 173, 200, 212,  75,  80,  77,  68, 107, 163, 185, 164, 249, // ...KPMDk....
+  19, 227, 194,  44,  66, 101, 120,   7,  53,  11, 168, 217, // ...,Bex.5...
+ 105, 144, 237,  90, 108, 171,  28, 132, 135,  62,  63,  59, // i..Zl....>?;
+ 120, 133, 181,  80, 113,  46, 143, 117, 105, 172, 233,  82, // x..Pq..ui..R
+  35, 147, 125, 176, 144, 125,  80, 102,  31,  28, 246, 224, // #.}..}Pf....
+ 225, 249, 225, 237, 237, 104,  37, 152, 220, 222,  14,  86, // .....h%....V
+ 130,  80, 113, 245, 193, 192, 248, 230,  31,  96,  39,  60, // .Pq......`'<
+ 247,  47,  93,  91,  66, 187,  44, 129,  95, 109,  79, 123, // ./][B.,._mO{
+ 118, 219,  40, 170,  30,  12,   1,  27, 107,  90,  50, 234, // v.(.....kZ2.
+ 211, 160, 249, 251, 238,  72,  25, 251, 220, 159,  14,  34, // .....H....."
+ 123, 115,   9, 191, 207, 223, 103,  66, 171, 143,  41, 246, // {s....gB..).
+ 194, 114, 113,  35,  43,  60, 118, 230, 134,   2, 110, 102, // .rq#+<v...nf
+ 137,  37, 197, 162,  42,  64,  24, 136, 194,  15, 217,  63, // .%..*@.....?
+ 238, 228, 133, 228, 122, 206, 199,  25,  25,  59,  87, 130, // ....z....;W.
+ 130,   9, 224, 245, 196,  52,   6,  38, 124, 237, 157,  84, // .....4.&|..T
+ 220, 135, 101,  43,   1, 161, 241, 136,  63, 160, 162, 227, // ..e+....?...
+ 107,  41, 248, 142, 144, 116, 103, 228, 143, 118,  82, 159, // k)...tg..vR.
+  63, 240,  66,   1,  72, 241, 145,  36, 190,  79, 129, 213, // ?.B.H..$.O..
+  21, 153,  47, 222, 136, 168,  72,  72,  58,  24,  67, 123, // ../...HH:.C{
+  76, 236,  37, 225,  21, 189,  65,   3, 243, 176, 134, 237, // L.%...A.....
+ 222, 205, 202, 114, 235, 192, 124,  45, 238,  37,  43, 193, // ...r..|-.%+.
+ 103, 163,  94,  38,  44, 253, 204, 199, 209, 225,  15, 116, // g.^&,......t
+ 233, 209,  24,  85,  63, 105, 195,  23,  13, 162, 125,  70, // ...U?i....}F
+ 121,  83,  30,  80,  40, 109, 128,  42, 129, 165,  73,  91, // yS.P(m.*..I[
+ 108,  88, 161, 194,   4,   3,   2, 238, 164, 114, 192, 129, // lX.......r..
+ 207, 213,  22,  90, 188,   9, 206, 105, 154, 115, 131,  58, // ...Z...i.s.:
+  16,  45, 175, 215, 203, 236,  10,  25, 217,   5, 210,  30, // .-..........
+ 175,  97, 207,  52, 194, 105,   8, 232,  40,  41,  84, 240, // .a.4.i..()T.
+  10, 142, 213,  42, 237,  49, 250,  92, 184, 171, 185, 203, // ...*.1......
+ 136,  49,  95, 115,  28, 130,  82, 186,  18,  60,  47, 161, // .1_s..R..</.
+ 244, 220,  64,  41,  45, 161, 100, 248,  26, 113, 181,  89, // ..@)-.d..q.Y
+ 132,  26,  54, 169,  30,  88, 222, 164,  10, 187, 144, 124, // ..6..X.....|
+ 189, 203, 209,  36, 128, 214,  19, 124,   0, 141, 237,  55, // ...$...|...7
+ 227,  34, 158,  24,  29,   3, 103, 128,  45, 196,  41,   0, // ."....g.-.).
+  76, 174,  76, 148, 104,  65,  84, 213, 161, 101,  70, 127, // L.L.hAT..eF.
+  22,  85, 116, 103, 179,  89,  77, 125, 150,  12, 188, 138, // .Utg.YM}....
+ 154, 148,  55, 100, 225, 201,  40,   0, 157, 147,  11, 135, // ..7d..(.....
+  14,  18, 156,   1, 160, 239, 115, 232,  37, 204, 102, 108, // ......s.%.fl
+ 113, 159,  44, 220, 222, 218, 148, 211,  50,  24, 106,   1, // q.,.....2.j.
+  30, 185, 113,  48, 109,  29, 177, 102, 128, 158, 215,  42, // ..q0m..f...*
+  25,  19, 167, 111,  14, 163, 149, 126, 219, 197,  15, 255, // ...o...~....
+  41,  75, 224,  39,  70,  30,  63, 183, 146, 248, 197, 140, // )K.'F.?.....
+  47, 195, 129, 136, 161, 142, 202, 155, 112, 132, 221, 130, // /.......p...
+  95, 247, 130,  65,  83,  87,  65,  97, 246,   3,  15, 246, // _..ASWAa....
+  33, 174,   7,  40,  14, 174,  68, 110, 140, 219,  25, 175, // !..(..Dn....
+  40, 110, 220, 199, 212,  57, 234, 187, 211, 224, 148, 168, // (n...9......
+ 221,  57, 205, 154, 105, 112,  66, 111,  23, 160, 114, 194, // .9..ipBo..r.
+ 161,  37, 123, 174, 214, 238, 152, 232, 239, 181, 203, 102, // .%{........f
+  62,  35, 166,  73, 106,  40,  33, 107, 131,  50, 204,  83, // >#.Ij(!k.2.S
+ 223, 187, 195, 230,  24, 166, 217, 148, 139, 111, 218,  59, // .........o.;
+ 166,  90, 134, 125,  76, 238,  47, 212, 130,  49,  60, 147, // .Z.}L./..1<.
+  90, 246, 185, 150,   9,  74, 204, 164, 150, 125,  83,  75, // Z....J...}SK
+  17,  86, 173, 229, 140, 106, 201, 236, 137, 170,  39, 110, // .V...j....'n
+ 117, 177,   1, 213, 122, 216, 140, 225,  28, 133,  94,  19, // u...z.....^.
+ 221, 140, 183,  60,  99, 123,  43, 180, 162, 208, 204, 245, // ...<c{+.....
+  52, 116,  79,  68,  74, 140, 250, 134, 132, 223,  29, 188, // 4tODJ.......
+ 128, 226,  89,  85,  14,  12, 129, 109,  88, 207, 112, 101, // ..YU...mX.pe
+ 176,  62,  30, 181, 166,  73, 100, 246, 223, 137,  96, 142, // .>...Id...`.
+ 209,  93,  44, 111, 196, 231, 239,  16,  14, 130,  74, 240, // .],o......J.
+ 147, 135,  27, 123, 117,  59, 186,  79, 129,  43, 109, 159, // ...{u;.O.+m.
+ 146, 192, 138, 221, 151,  26, 165,  14, 215, 160, 133, 148, // ............
+ 192, 233, 136, 235,  31, 139, 165,  83, 161,   3,  10, 226, // .......S....
+ 109,  80, 254,  28,  26, 160,  32, 126, 132, 119,   8, 176, // mP.... ~.w..
+  60,  78, 124,  17,   1, 117, 183, 201, 198, 239,  84, 163, // <N|..u....T.
+   1,  17,  62, 140, 101, 210,  87, 138,  57,  91,  44,   6, // ..>.e.W.9[,.
+ 141, 146, 241, 244, 202, 158, 112,  72, 155,  51, 200, 217, // ......pH.3..
+  38,  96, 249, 136, 112,  60,  72, 136, 246, 208, 203,  53, // &`..p<H....5
+ 117, 192, 242,  11, 204, 242, 197,  21, 251, 201, 228, 147, // u...........
+ 204,  49,  54, 235,  47, 230,  88, 143, 222,  12, 247, 215, // .16./.X.....
+  62, 180, 206,  88, 250, 203, 216,   3, 207, 120, 228,  42, // >..X.....x.*
+ 210, 119, 108, 250,  28, 233,  23, 214,  48, 115, 175,  54, // .wl.....0s.6
+ 137, 239,  35, 101, 217,  56, 161,   4, 198,  11, 125, 124, // ..#e.8....}|
+  81,  24,  42, 212, 153,  27,  96, 134,  28, 119,  54,  86, // Q.*...`..w6V
+  68, 111, 251, 180, 234,  17,  16, 142, 220,  79, 134,  41, // Do.......O.)
+ 162, 214,  80,  80, 191, 206,  41,  81, 224,  39,  43, 172, // ..PP..)Q.'+.
+ 149,   9, 103,  51,  86,  48,  27,  17,  33,  81, 208,  52, // ..g3V0..!Q.4
+ 123, 243,  92, 170, 136,  63, 142,  85,  43,   8, 211,  26, // {....?.U+...
+  36, 114, 250,  52, 185,  23, 204, 233, 215, 246,  93, 205, // $r.4......].
+ 138,  81, 130, 148, 196, 249,  92, 142, 241, 195,  77, 130, // .Q........M.
+ 231, 189,  64, 127,   4, 185, 126, 138, 101,  43,  74,  78, // ..@...~.e+JN
+ 118, 227,  72,  39,  57, 235, 225, 171,  70, 135, 201, 135, // v.H'9...F...
+ 185,  11, 156,  10, 249,  51,  25,  20, 186,  30, 185, 209, // .....3......
+ 147, 249, 225, 115,  42, 228, 151, 185, 239,  95, 129,  25, // ...s*...._..
+ 159, 107,  38, 133,  80, 184,  91, 151,  18, 133, 111, 137, // .k&.P.[...o.
+ 126,  85,  31,  79,  34,  33, 125, 230,  70,  55,  95, 109, // ~U.O"!}.F7_m
+ 209, 231,  69, 227, 196,   2, 137, 136,  59, 184,  71, 205, // ..E.....;.G.
+ 218, 103, 215,  39,  85,   1,  89, 123, 124, 207,  55, 119, // .g.'U.Y{|.7w
+ 242, 151, 102, 114, 207,   8, 142,  69, 216, 175,   8,  35, // ..fr...E...#
+  18,  43, 102,  30, 204,  77, 227, 118, 131, 157,  98,  11, // .+f..M.v..b.
+ 158, 164,  77,  48, 193, 188,  19, 159, 192, 241, 163,  24, // ..M0........
+ 125,  17, 178,  70, 213,   5, 129, 216, 201,  42, 245,  55, // }..F.....*.7
+  91, 234, 161, 193,  72, 117,  64,  84,  29, 159, 118, 249, // [...Hu@T..v.
+  96, 119, 162, 197, 242,  65, 235, 160,  92, 227,   9,  29, // `w...A......
+  86,  52, 212, 188,  23,  39,  30,  68, 107, 236, 255, 249, // V4...'.Dk...
+  60, 251, 175,  46, 130, 211, 126, 226, 199, 180,   6, 156, // <.....~.....
+ 242, 237,  82,  64,  94, 131, 251, 131,  62,  92, 122,  15, // ..R@^...>.z.
+ 188, 190, 126, 142, 123, 106, 177, 229, 160,  78, 224, 226, // ..~.{j...N..
+   0, 236, 225, 197, 186, 123, 218, 207, 252, 212, 187, 127, // .....{......
+  98,  24,  71,  98, 250, 250,  67,  90,  20,  71, 156,  97, // b.Gb..CZ.G.a
+ 138,  12, 209, 161,  58, 183,  25, 142, 144,  33, 245,  51, // ....:....!.3
+ 239, 254, 185, 154, 163, 154,  52,  75,  72, 238,  76,   0, // ......4KH.L.
+ 212, 217,  12,  62,  16,  98,  72,  17, 249,  91, 120,   3, // ...>.bH..[x.
+  20, 175,  15, 231, 184,  55, 231,  45,   8,   6, 199, 252, // .....7.-....
+  10,  87, 245, 192,  13, 196,  36,  44, 244, 120,  10, 214, // .W....$,.x..
+ 191, 155,   1,   9,  78,  91,  84, 212,   1,  27,  52, 214, // ....N[T...4.
+ 132,  45,  80,  33, 216, 154, 211,  12, 132, 220,  79,  19, // .-P!......O.
+ 213,  92,  29,  60, 212, 163,  40, 225,  75, 186, 117, 150, // ...<..(.K.u.
+  95,  35, 169, 147,  49, 170, 223,  16, 150, 251, 240,  34, // _#..1......"
+ 191, 136,  33, 201,  61, 235, 120,  55, 121,  30, 220,  88, // ..!.=.x7y..X
+  93, 183, 213, 114,  91,  29,  56, 235, 190, 171,  58, 173, // ]..r[.8...:.
+  39, 176, 119, 164,  38,  63, 175, 187,  62,  79, 222, 213, // '.w.&?..>O..
+ 231,  10, 182,   2, 218,  74, 136, 182, 161, 130,  76,   2, // .....J....L.
+ 129, 250,  11, 211,  65, 182, 160,  42,  55,  37,  62, 117, // ....A..*7%>u
+ 135, 138, 120, 131, 167,  18, 254, 198,  29, 131,  70, 137, // ..x.......F.
+ 129, 167, 161,  81, 172, 186,  68, 235, 133,  69, 136, 184, // ...Q..D..E..
+ 161, 161,  97,  17,  38, 182,  27, 211,  89, 144, 156, 246, // ..a.&...Y...
+ 126, 165,   5, 231,  59, 146,  54, 254,  12,   8,   7, 146, // ~...;.6.....
+  96, 170, 120, 101,  44, 155, 254, 116, 161, 233,  95, 109, // `.xe,..t.._m
+ 113, 199, 250, 152, 254, 122, 245, 236, 138, 164, 125, 123, // q....z....}{
+  59, 221, 105, 211, 234, 254,  43,  45, 139, 183, 183, 223, // ;.i...+-....
+ 145, 240, 115, 123, 251,  39,  11,  66, 154,  88, 108,  62, // ..s{.'.B.Xl>
+ 101,  71,  52, 133,  36,  65, 179, 103,  71, 117, 219, 221, // eG4.$A.gGu..
+ 149, 213,  85, 196,  88,  60, 131, 201, 252,   4, 215, 174, // ..U.X<......
+  16, 174,  77, 107, 235,  55,  20,  54, 144, 169, 112, 170, // ..Mk.7.6..p.
+  14,  75, 108,  48, 145, 181,  82, 246, 112, 140,  30, 203, // .Kl0..R.p...
+ 227, 151, 181,  28, 175,  88,   3, 189,  47, 154, 137, 178, // .....X../...
+ 199, 192, 210, 179, 155, 152, 181, 229,  98, 155, 133, 235, // ........b...
+  83, 120, 147, 129,  10, 140, 215,  88,  16, 196,  27,  36, // Sx.....X...$
+ 161,  89, 193, 122,  52, 160,  24,  32, 146,  41,  59,  62, // .Y.z4.. .);>
+ 198, 195, 135, 125,  83,  21, 130,  90, 219, 141, 180, 167, // ...}S..Z....
+ 138, 229, 214,  76, 151, 253, 164,  18,  22,  12,  23,  86, // ...L.......V
+  42, 198, 130, 202,  72,  62,  99,  27, 138, 121,  53,  33, // *...H>c..y5!
+ 142, 249, 241, 152, 151,  40,  70, 165, 157, 127, 181, 180, // .....(F.....
+ 247, 132, 234,  21, 251, 130,  24,  62,  67, 244,  18, 187, // .......>C...
+   9, 190, 134,  64,  46, 108,  72, 222, 155,  41, 245,  18, // ...@.lH..)..
+ 246, 176, 201,  75, 120,  56, 155, 232,  97, 122,  73,   4, // ...Kx8..azI.
+ 230, 157, 178, 223, 152, 207,  65, 242, 161, 248, 158, 210, // ......A.....
+  52, 121, 138, 175, 225, 113, 204, 167, 250, 131, 228,  25, // 4y...q......
+  62,  75, 149, 121, 229,  78, 233, 155,  38,  45, 142,  68, // >K.y.N..&-.D
+  81,  92,  86, 116,  50, 241,  60, 232,  30, 122, 230, 172, // Q.Vt2.<..z..
+  42, 140, 128, 249,  40, 125,  98,  96,  57, 171, 168,  97, // *...(}b`9..a
+ 104,  94, 209,  76, 250, 168, 146, 119, 236,  65,  96, 196, // h^.L...w.A`.
+ 239,  31, 248, 253,  20, 239, 172, 100, 149, 133, 131, 105, // .......d...i
+ 196, 140, 163,  78,  16,  53, 183,  25, 180, 196, 215, 128, // ...N.5......
+ 182,  71, 158, 147,   1,  51, 248, 131,  82,  44, 143, 153, // .G...3..R,..
+  22, 192, 172, 165,  38, 152,  38,  44, 153,  14,  69,  52, // ....&.&,..E4
+  29, 226,  29, 198, 233, 132,  96, 192, 150, 160, 211,  38, // ......`....&
+   6,  19, 124,   5,  49, 140,  32, 164, 236, 116,  25,  97, // ..|.1. ..t.a
+ 216,  19, 192, 241, 147,  95, 177,  14,  33, 125, 204,  62, // ....._..!}.>
+ 225, 137, 125, 219,  73, 242, 126, 155, 141,  40, 192,  59, // ..}.I.~..(.;
+  32,  20, 140, 220,  78,  18,  35, 244,  87,  79, 213, 215, //  ...N.#.WO..
+  88, 197, 219, 149,  51, 179, 184, 201, 186,  54, 159, 132, // X...3....6..
+  79, 185,  13, 160, 143, 102,  80, 156,  51, 196, 158,  17, // O....fP.3...
+  30,  36, 236, 211,   8, 187, 173,  58,  43, 174, 248,   8, // .$.....:+...
+ 146, 125,  51, 252, 236, 242, 254,  52,  77, 207, 224,  33, // .}3....4M..!
+ 157, 159, 226, 157, 173, 192, 173,  87, 197, 238,  92, 218, // .......W....
+  79, 204, 245, 234,   7,  28, 116, 232, 249,  60,  23, 147, // O.....t..<..
+ 223, 168,  15, 191, 225,  16,  88, 221,  46, 158,  72,  66, // ......X...HB
+  44, 109,  52,  35,  14, 159,  83,  95, 112,  59,  95, 223, // ,m4#..S_p;_.
+  90, 148, 198, 120,  84,  48, 241, 153,  46,  63,  36,  75, // Z..xT0...?$K
+ 113, 251,   7,  39, 192,  38, 163,  93,  29, 126,  46, 245, // q..'.&.].~..
+ 206,  96,  48, 121, 199,  20, 254,  73, 185,  13,   5, 138, // .`0y...I....
+ 226,  90,  95, 177, 172, 154, 248,  55, 227, 233, 177, 175, // .Z_....7....
+  79, 113,  65,  47,  61, 102, 114, 187,  53, 238, 119, 254, // OqA/=fr.5.w.
+  69,  85, 157,  15, 150,  55,  76, 211,  34,  11,  60, 166, // EU...7L.".<.
+  20, 132, 108, 180,  26, 255, 124, 104,  47,  55,  62,  40, // ..l...|h/7>(
+ 182, 164,  14,   5, 147,   9, 212,  94,  15,  87, 166,  26, // .......^.W..
+ 220,  47,  14,  51,  23,   1, 226,  84, 225, 103, 207,  38, // ./.3...T.g.&
+ 167, 164, 210, 145,  79, 200,  68,  45,  87, 201, 139,  32, // ....O.D-W.. 
+ 255, 232,  18, 203,  93,  25, 144,  55, 243, 119,  89,  82, // ....]..7.wYR
+  90, 211,  31, 115, 177, 111,  53, 150, 170, 123, 177,  36, // Z..s.o5..{.$
+ 184,  66,  60, 222,  98, 157,  36, 182,  19, 151, 216,  56, // .B<.b.$....8
+ 176, 139, 166, 246, 124, 114, 167, 240, 182, 193,  55, 247, // ....|r....7.
+ 178,  41,   5, 219, 209, 247, 177,  65, 251, 139, 249, 240, // .).....A....
+ 124, 166,  86, 249, 163, 160, 144, 196, 221, 210, 112, 133, // |.V.......p.
+  48, 223, 238, 145, 236, 180, 229, 152,  51, 159, 107,  38, // 0.......3.k&
+ 178, 148,  27, 170, 148,  91, 211,  17, 123,  97,  13,  53, // .....[..{a.5
+ 148, 175,  67,  22,  84, 165,  54,  47, 177,  75,  92, 232, // ..C.T.6/.K..
+ 241, 100,  89, 143,  95, 194,  93, 161, 221,  99, 168, 220, // .dY._.]..c..
+  26, 200, 187, 103, 208, 222,  92,   7,  21,  53,  56, 213, // ...g.....58.
+ 107,  46,  98, 206, 120, 190,  24, 175, 130,  90, 220,  26, // k.b.x....Z..
+ 178, 229,  11, 117, 244, 153,  37, 155,  74, 191,  47,  29, // ...u..%.J./.
+  24,  60, 233, 151, 239, 226, 172, 128, 139, 135, 171, 233, // .<..........
+ 202,  62, 108, 124,  92, 179, 255,  90, 240, 141,  97,  28, // .>l|...Z..a.
+ 188,   5, 226,  78,  68, 233, 138, 178, 144, 247,  16,  74, // ...ND......J
+ 247,  74,  70, 146,  73, 196,  89,  12, 155,  52, 104, 195, // .JF.I.Y..4h.
+ 133, 214, 112,  21, 235, 104,  53, 159, 103, 116, 212,   9, // ..p..h5.gt..
+  31, 210, 238, 233, 194,  37, 149,  54,  30, 169, 180,  24, // .....%.6....
+ 134, 154,  32, 188,  34, 204,  24,  25, 114, 160, 188,  83, // .. ."...r..S
+ 232,  46, 182,  75,  96, 130, 137, 211,  87, 242,  86, 159, // ...K`...W.V.
+ 249,  87, 236,   8,  76, 123, 196,  50,  92,  25,  13, 147, // .W..L{.2....
+ 198,  53, 215, 188, 195,  37,  25, 164,  72, 126, 165, 213, // .5...%..H~..
+  15, 179, 196,  94, 145, 242, 131, 159, 246, 141,  35, 212, // ...^......#.
+ 109,  63, 167, 158, 124,  47, 238, 109, 196,  28, 211,  52, // m?..|/.m...4
+  15, 239, 240,  49, 182, 186, 218,  41, 179, 230,  25, 156, // ...1...)....
+ 230,  22,  95, 151, 216,  50,  44, 190, 246, 252, 252, 216, // .._..2,.....
+  91, 238, 180,   9, 161, 240, 129,  94, 139, 170,   4,  32, // [......^... 
+ 158,  61, 245, 215,  18,  84,  67, 144,  66,  52, 137, 181, // .=...TC.B4..
+  36, 181,  32, 187, 103, 106,  28,  98,  77, 172, 103, 172, // $. .gj.bM.g.
+   9, 252,  30, 195, 153, 196,  10, 158, 216, 120, 234,  83, // .........x.S
+ 230, 204,  35,  48, 112,  68, 191, 112,  15, 155, 177,  83, // ..#0pD.p...S
+  88,  95, 239,  35,  20, 156, 250,  11,  92, 191, 101, 189, // X_.#......e.
+ 221,  20, 134, 167, 148,  26, 176, 166, 148,  25, 205, 225, // ............
+   9, 255,  94, 137,  71,  42, 227, 168, 201, 190,  19,   4, // ..^.G*......
+  55, 118,  12, 132, 110, 111,  59,  80, 254, 226,  56, 127, // 7v..no;P..8.
+ 191, 132,  34, 239,  88,  73,  96, 254, 217, 215,  99,  63, // ..".XI`...c?
+ 255, 192,  64, 148,  19, 231,  67,  87, 222,  60, 235, 188, // ..@...CW.<..
+ 235,  69,  17,  92, 124, 122, 214,  57,  97, 160,  11,  61, // .E..|z.9a..=
+ 165, 153, 153, 109, 137,  19, 180,  43,  12,  90, 181, 181, // ...m...+.Z..
+ 243, 213, 214, 112,  87,  23, 198, 184, 186,  48, 148,  53, // ...pW....0.5
+ 231, 173, 184, 100,  54, 100, 138,  47, 177,  78,  64,  82, // ...d6d./.N@R
+ 111,  29, 233,  88, 172, 113, 194, 171, 104, 194,  87, 162, // o..X.q..h.W.
+ 176, 217, 196,  69, 255, 162, 122,  38, 239, 229, 135, 189, // ...E..z&....
+ 215, 207,  99,  22, 125, 251, 238,  69, 253, 138,  21, 154, // ..c.}..E....
+ 228,  32, 139, 158, 127, 193, 205, 125,  75,  82, 238,  91, // . .....}KR.[
+  28,  97, 204, 102, 241,  73,  43, 156,  76, 216,  59, 213, // .a.f.I+.L.;.
+  59, 246, 203, 118, 158, 191, 153, 158,   7, 223, 225, 157, // ;..v........
+ 237, 191, 240, 245, 162, 248, 122, 157, 158,   4, 191,  21, // ......z.....
+  95,  79, 176,  69,  29, 188, 194,  55,  49,  22, 236, 227, // _O.E...71...
+ 245, 147, 170,  94, 154, 133, 143,  79, 240,  35, 176,  64, // ...^...O.#.@
+  33, 150, 120, 131, 199,  78,   3, 182,  89, 130, 124, 254, // !.x..N..Y.|.
+   2, 227,   4,  30,  55, 234, 135, 239,  42, 167,  23, 224, // ....7...*...
+ 218, 133,  74, 180,  55, 134, 227, 152, 147,  61,   1, 203, // ..J.7....=..
+ 225, 124, 151,  66, 205,  65, 134, 217, 124,  66,  36,  17, // .|.B.A..|B$.
+  86, 156, 225, 211, 197,  17, 218, 142, 189, 141, 110, 165, // V.........n.
+  13,  91, 148, 106, 235, 172, 239, 141, 154,   5, 165, 174, // .[.j........
+ 239, 242, 228, 197,  77, 129,  56,  54,  95,  94, 232, 101, // ....M.86_^.e
+ 109,   0, 106,  54, 100, 157, 118, 225,  66, 168, 122, 183, // m.j6d.v.B.z.
+  93, 103, 167, 236, 130, 152,  61, 203, 109, 233, 113,  83, // ]g....=.m.qS
+  14, 113, 224, 126, 209, 194, 235,  51, 159,  99, 242,   8, // .q.~...3.c..
+  36, 203, 162,  82, 138,  74, 155,  77,  49, 158,  47,  78, // $..R.J.M1./N
+  64, 153,  66, 217,  24, 190, 163, 254, 116, 221, 180, 153, // @.B.....t...
+ 172, 117, 188, 245, 188, 178, 145,  37,  39, 249, 225, 120, // .u.....%'..x
+ 113,  45,  67, 161, 232,  93, 144,  85, 206, 175,  84, 206, // q-C..].U..T.
+ 182,  36, 198,  31,  82, 144, 148, 128,  39, 142, 172,  10, // .$..R...'...
+  72, 190, 129, 143,  15,   8,  44,  31, 248, 202, 168,  23, // H.....,.....
+ 247, 239, 197, 245,  29, 235, 100, 238, 128,  32,  59,  55, // ......d.. ;7
+ 233, 201, 185,  34, 123, 200,   3,   3, 201, 215, 238, 121, // ..."{......y
+ 133, 123, 180, 175,  94, 224,  45, 158,  13,  84, 180, 188, // .{..^.-..T..
+ 214,   2,  87, 216,  47, 240,   1, 106,  61, 236,  25,  87, // ..W./..j=..W
+  84,  81, 177, 210, 167,  51,  62,  76, 144, 207, 140, 255, // TQ...3>L....
+ 126, 123,  65, 221,  87, 170, 150, 131, 120, 232,  62,  22, // ~{A.W...x.>.
+ 178,  57, 164,  71, 237, 169, 117,  47, 195,  60,  47,  95, // .9.G..u/.</_
+ 207,  55, 147, 140,   7, 220,  90, 150,  11, 169, 201,   5, // .7....Z.....
+  16, 216, 121,  78,  51, 247, 184, 196, 210,  25,  13, 206, // ..yN3.......
+ 112,  89, 111, 201,  75, 138, 103, 221, 158, 139, 244,  80, // pYo.K.g....P
+ 211, 232, 250, 221, 134, 122, 249,  54, 166, 236,  98,  70, // .....z.6..bF
+ 243,  23,  23,  70,  75, 238,  23, 153,   4, 124, 227, 238, // ...FK....|..
+ 212,  64,  56, 245, 100,  23, 202, 184,  37,  37,  41,  61, // .@8.d...%%)=
+ 239,  99, 204, 112, 205,   9, 113, 178, 213,  49,  67,  35, // .c.p..q..1C#
+  39,  75, 111,  44,  49, 155, 242,  25, 239, 253, 132, 114, // 'Ko,1......r
+  74, 212, 220,  59, 222, 111, 243,   1,  52, 119, 202,  87, // J..;.o..4w.W
+  49, 194,  88,  11,  82, 188,  12,  25, 172, 174,  36, 124, // 1.X.R.....$|
+ 230,  46,  59, 119, 111, 246, 190, 104, 186, 101,  36, 148, // ..;wo..h.e$.
+ 244,  44,  78, 238, 164, 189, 180, 236, 123, 110, 252, 149, // .,N.....{n..
+  70,  59, 153, 228,  74, 130, 136,  18,  39,  98, 235,  92, // F;..J...'b..
+ 153, 149, 244, 219, 108,  30, 150, 187, 224, 148, 110, 173, // ....l.....n.
+  67,  40, 149, 204,  39, 163, 225,  89,  91,  59, 180,  94, // C(..'..Y[;.^
+ 236,  61, 119, 138, 109,  12, 162, 217, 210, 232, 169,  87, // .=w.m......W
+ 220, 144, 153, 204,  12, 145, 126, 198,  75,  11,  19, 102, // ......~.K..f
+ 113, 220,  30,  44,  49, 215,  48,  68, 199, 249, 248,  97, // q..,1.0D...a
+ 215, 225,  67,   8, 206, 243, 124, 176, 110, 190, 250, 130, // ..C...|.n...
+ 167, 236, 230, 125,  77, 175,  61, 208, 155, 247,  53, 160, // ...}M.=...5.
+   9,  23, 149, 159, 211,  68, 191,  29, 141, 128,  21,   4, // .....D......
+ 176, 156,  26, 250, 134, 146, 107, 168, 231, 139,  60, 216, // ......k...<.
+ 218, 123, 157, 130,  25, 219, 207, 179,  40,  57, 113,  29, // .{......(9q.
+ 157,  52,  63, 238,  59, 234,   6,  28, 217, 111,  84,   2, // .4?.;....oT.
+  60, 224, 122,  30, 112, 107, 143, 198,  59, 154, 104, 146, // <.z.pk..;.h.
+ 116, 134,  19, 151, 107, 169, 133, 192, 238, 148,  59, 198, // t...k.....;.
+  66,  67, 254, 177, 135, 155,  23,   9, 227, 191,  11, 199, // BC..........
+ 193,  29, 238,  83,  14,  74, 151,   8, 108, 216, 149, 136, // ...S.J..l...
+   3, 135, 126, 194, 103,  28, 125, 109, 228,  58, 150, 234, // ..~.g.}m.:..
+ 184, 104, 156, 206, 199, 197, 174,  36, 189, 218,  27,  27, // .h.....$....
+  78, 140, 183, 198,  27, 227, 129,  35, 223, 154,  97, 196, // N......#..a.
+ 163, 132,  24, 228,  32, 198, 197, 118, 147,  92, 211,  50, // .... ..v...2
+  90,  49,  77,  43, 140, 168, 113, 213,  94, 104, 111,  33, // Z1M+..q.^ho!
+  75, 228, 115,  50, 120, 166,  39,   3, 150,  47, 210,  50, // K.s2x.'../.2
+ 129, 185,  52, 153, 125, 198, 228,  45, 125, 149, 211, 178, // ..4.}..-}...
+ 204, 151, 125,  20, 215,  58, 139,  50, 217, 220, 215,  29, // ..}..:.2....
+  41, 183, 118, 123, 178, 226, 107, 147, 213, 181,  53, 123, // ).v{..k...5{
+ 188,  10, 166, 197,  13, 202, 162,   2,  59,  54, 202, 175, // ........;6..
+  75, 123,  59, 182, 218, 131, 173, 213, 149,  75, 220,  43, // K{;......K.+
+ 149, 114, 132, 187, 136, 212, 153,   4, 157,  80, 208,  80, // .r.......P.P
+  93, 171,  11,  28, 162, 128, 134, 119,  44, 234, 220,  95, // ]......w,.._
+ 252, 252,  71, 181, 251,  95, 114,  91, 242, 189,  96, 215, // ..G.._r[..`.
+  58, 229, 220, 167, 226, 237, 181, 204, 227, 242,  90, 230, // :.........Z.
+  94,  24, 188, 116,  71, 124, 242, 136,  47,  85, 181,  31, // ^..tG|../U..
+ 205, 142, 189, 190, 251, 204,  29, 225,  78, 229, 253, 126, // ........N..~
+ 232,  79, 248,  78, 229,  61, 119,  80,  13, 120,  30, 124, // .O.N.=wP.x.|
+  86,  79, 130, 207, 240, 219,  14, 195, 188,  24,  54, 186, // VO........6.
+ 247,  40, 228,  88, 125, 128,  77, 219,  61, 245, 153,  94, // .(.X}.M.=..^
+ 234, 119,  42, 115,  86, 220, 169,  28, 174, 174,  78, 204, // .w*sV.....N.
+ 157, 202, 251, 150, 154, 140, 106,  22, 241, 249, 220, 157, // ......j.....
+ 100,  92,  59, 110,  70,  77, 169,  97, 185,   7, 203, 145, // d.;nFM.a....
+ 184, 143,  90,  18, 170, 197, 199, 203, 115, 204,  86,   9, // ..Z.....s.V.
+  73, 113, 237,  83,  74,  45,  76, 152,  82, 191,  11, 158, // Iq.SJ-L.R...
+ 163, 149, 101,  35, 223,   5, 199, 107, 151, 104,  29, 212, // ..e#...k.h..
+ 248,  79, 213,  51, 190, 229,  56,  55, 222,  52, 101,  61, // .O.3..87.4e=
+ 157, 150, 183,  28,  63,  45, 156,  36,  46, 220, 114, 124, // ....?-.$..r|
+  15, 206,  65, 206, 220, 169, 189, 229,  24, 168,  51,  21, // ..A.......3.
+ 171, 119, 182, 115, 127,  74, 171,  57, 236, 202, 222,  97, // .w.s.J.9...a
+ 175,  31,  47,  79, 148,  56,  59,  92, 153, 206, 221, 114, // ../O.8;....r
+ 204,   7, 244, 179, 234,  21, 199, 192,  63, 140, 200, 190, // ........?...
+ 218, 195,  86,  27, 131,   1, 219, 197, 230, 150, 162, 245, // ..V.........
+ 174,  58,  53,  78, 148, 227, 254, 208, 111,  14, 213, 137, // .:5N....o...
+ 117, 199,  28, 247, 155,  67, 127, 216, 203, 234,   2,  20, // u....C......
+  77, 206, 181, 224, 148, 239,  65,  93,  11,  78, 136, 119, // M.....A].N.w
+ 221, 149,  59, 147,  51,  42, 147, 239,  76,  54, 147,  64, // ..;.3*..L6.@
+ 101, 136, 178, 119,  38, 103, 138, 145, 166, 152,   1, 149, // e..w&g......
+  59, 147, 225, 141, 106, 183, 184,  51, 249,  25, 223, 153, // ;...j..3....
+ 108, 203, 184, 103, 239,  76,  46,   3, 204, 157, 201, 101, // l..g.L.....e
+ 192,  51, 194, 255, 221, 153,   7, 139, 242, 227,  48, 155, // .3........0.
+  44, 157, 224, 176,  21,  21, 215,  46,  96, 202, 213,  65, // ,.......`..A
+ 235, 129, 210, 161, 130,  27,  73,  28, 101, 224, 185,  77, // ......I.e..M
+  99, 132, 171, 220, 208,   7, 188, 102, 184, 112,  52,  28, // c......f.p4.
+  70, 211,   9,  76,  31,  72, 232,  49,  70,  49,  89, 159, // F..L.H.1F1Y.
+  79, 240, 249,  78,  50,  61,  63, 214,  25, 168, 239, 245, // O..N2=?.....
+  24,  60,  59,  69, 100, 136, 200, 112, 209, 112, 167, 201, // .<;Ed..p.p..
+ 215,  17,  77, 224, 241,   5, 167, 203, 117, 232, 209, 154, // ..M.....u...
+ 137, 143,  46, 159, 180,  25,  48,   1,  33,  49, 102, 172, // ......0.!1f.
+ 168,  81, 180,  80,  50,  61,  33,  24, 203, 101, 181,   4, // .Q.P2=!..e..
+ 213,  27, 227,  51, 200, 204, 226, 225,  44,  24, 244,  42, // ...3....,..*
+ 151, 199, 103, 234, 212,  82, 153,  88, 185,   5, 101,  81, // ..g..R.X..eQ
+  87, 138,  72,   8, 141,  52,  46, 223,  54,  84, 102,  23, // W.H..4..6Tf.
+ 183, 113,   7,  39,   5, 165,  33, 148, 190, 175, 105,  30, // .q.'..!...i.
+  78, 232, 247, 121,  48, 189, 175, 161,  79,  60, 226,  41, // N..y0...O<.)
+ 125,  64, 105,  15, 131, 136, 207, 227, 251,   7, 247, 212, // }@i.........
+ 174, 253,  96, 172, 121,  66, 169,  44,   9,  56, 170, 220, // ..`.yB.,.8..
+ 204, 254,  78,  17, 238, 171, 247,  65,  17,  44, 183, 211, // ..N....A.,..
+ 189,  44,   3,  70, 254, 156,  30,   4,  26,  53,  19, 148, // .,.F.....5..
+ 242, 209, 197, 140, 198, 239,  55, 134,   2, 223, 132, 168, // ......7.....
+ 244,  25,  56, 139, 100, 200, 231, 115, 170, 126, 125, 104, // ..8.d..s.~}h
+   2, 188,  10,  78, 202, 137,  66, 116, 139,  39, 202, 137, // ...N..Bt.'..
+  28, 239, 231,  73, 247,  91, 255,  55,  52,  20, 150, 159, // ...I.[.74...
+  63,   7, 251, 238, 177, 251, 138,  32, 243,  90, 237, 177, // ?...... .Z..
+  73, 220, 153, 250,  68,  97,  39,  22, 255,  61, 245,   2, // I...Da'..=..
+ 155,  19, 111,  69, 106, 251,  85,  30, 223, 201, 227,  39, // ..oEj.U....'
+  89, 238, 101, 224, 199,  60, 137,  63, 217, 229,  30, 155, // Y.e..<.?....
+ 213,  47,  32, 211, 189,  13, 172, 109,  97,  49,  48,  40, // ./ ....ma10(
+  70,  88,  52, 101,  61, 185, 191, 173, 171,  19,  11,  21, // FX4e=.......
+ 250, 175, 214,  22, 168, 244, 154,  68, 131, 207,   7, 156, // .......D....
+ 220, 239, 130, 225,  66, 201,  63,  45, 148, 252, 221,  29, // ....B.?-....
+  37, 255, 180, 172, 100, 179, 219, 115, 213, 246, 127,  80, // %...d..s...P
+ 124, 176, 239, 123, 224,  85,  65, 173, 126, 176,  27, 178, // |..{.UA.~...
+ 223, 123,  55, 231, 193,  15,  11, 181, 211, 252, 252,   1, // .{7.........
+ 166,   9,  57, 187, 148,  58, 183,  98, 125,  94, 216, 136, // ..9..:.b}^..
+ 184, 151, 107, 250, 254, 153,  58,  98,   5,  33, 187, 211, // ..k...:b.!..
+  51, 246,  68, 223, 207, 151, 213, 123, 138, 217, 254,  61, // 3.D....{...=
+ 151, 214,   7,  81, 185, 127, 230,  95, 185,  44,  63,  28, // ...Q..._.,?.
+  17, 246,  94, 122, 205,  43, 183, 109,  94, 213, 179, 192, // ..^z.+.m^...
+ 253,  24, 196, 185,  11,  44, 191, 146,  64, 245, 209, 243, // .....,..@...
+ 154,  79, 215,  62, 200,   6, 201,  29,   9, 238, 135, 107, // .O.>.......k
+  31, 212, 211, 224,  99, 243,  89, 175, 179,   3,  58, 243, // ....c.Y...:.
+  44, 192, 173, 208, 235, 221, 157,  79,  52, 124, 159, 240, // ,......O4|..
+ 177, 197, 225, 251, 108, 230, 135, 166, 254,  18,  60, 219, // ....l.....<.
+ 105,  83, 227, 246,  93,  61, 117,  41,  99, 211, 253, 165, // iS..]=u)c...
+ 255,   9, 152, 244,  92, 125,  38, 252, 121,  23, 176, 195, // .....}&.y...
+ 153,  62, 149, 225,  39,  65, 240, 164, 223, 246, 159, 122, // .>..'A.....z
+ 205, 228, 254, 147, 251, 174,  68, 124, 160, 136, 182, 183, // ......D|....
+ 134,  92, 252,  38, 165, 254,  88,  46, 199, 188, 192, 254, // ...&..X.....
+ 165, 133, 184,  61,  83,  58,  14,  94, 136,  93,  96, 101, // ...=S:.^.]`e
+  57, 215,  73, 225,  67, 223, 224, 189, 167,  65, 206, 160, // 9.I.C....A..
+  25,  61, 248, 173, 226, 224, 170, 240,  60, 112, 115, 221, // .=......<ps.
+ 246, 181, 186, 238, 248,   9, 134, 189, 220, 199,  17, 209, // ............
+ 143, 125,  93,  37,  11, 131, 174, 147,  66,  47,  84,   4, // .}]%....B/T.
+ 154, 187, 134, 210,  96, 247, 254,  83, 220,  89, 124, 239, // ....`..S.Y|.
+ 254, 211, 250,  18, 253, 164, 159, 249, 167,  88, 162, 105, // .........X.i
+ 193,  60,  53,  75, 244,  19, 203, 241,  93, 212, 150, 232, // .<5K....]...
+ 164,  92, 162,  75,  91, 169, 164, 144,  40,  33,  41, 245, // ...K[...(!).
+ 251, 236, 154,  44, 105,  18, 251, 218,  46, 147, 255,  28, // ...,i.......
+  28,  83, 139, 100, 106, 207,  68,  72, 188, 130, 123, 212, // .S.dj.DH..{.
+  35, 171,  54, 178, 251, 215, 231, 144,  71, 180, 197, 166, // #.6.....G...
+ 140, 178, 189, 113,  19, 245, 202,  51, 121, 137, 194, 239, // ...q...3y...
+ 147, 224, 252,  14, 148, 123,  31, 238, 204,  51, 245,  51, // .....{...3.3
+  60, 163, 226,  67, 155, 143, 105,  16,  54,  39,  53,  57, // <..C..i.6'59
+ 217,  24, 214, 238,  36, 125, 157, 249,  58, 101,  43,  68, // ....$}..:e+D
+ 122,  79, 125, 157, 245,  94, 244,  93, 158, 195, 146, 248, // zO}..^.]....
+  59, 118,  16, 243, 222, 253, 137,  37, 156, 239, 228, 102, // ;v.....%...f
+ 118,  53,  89, 251, 211, 253, 132,  11,  68,   9, 130,  56, // v5Y.....D..8
+ 186,  56, 109, 126, 242, 120, 239, 212,  90, 228, 155,  92, // .8m~.x..Z...
+ 191, 114, 174, 183,  95, 203, 229, 249, 239,  93,  29, 127, // .r.._....]..
+ 177, 220, 151, 114, 249, 182, 138, 154,  20,  79, 107, 231, // ...r.....Ok.
+ 211, 181,  79, 170,  34, 144,  80, 139, 251,  63,  90,  37, // ..O.".P..?Z%
+ 225, 139, 254,  79, 190, 142, 253,  23,  52,  79, 126,  52, // ...O....4O~4
+ 142, 241,   8, 191,  13, 217, 236, 159,  72, 144, 127,  98, // ........H..b
+  29, 215, 245, 109, 144, 250, 209,  24, 228, 209, 148, 249, // ...m........
+  81,  24, 157,  23, 253,  95, 169,  40, 245, 163, 172, 209, // Q...._.(....
+  80, 151,  37, 122,  81, 119,  96, 181,  42, 112, 151, 166, // P.%zQw`.*p..
+ 251, 117, 126,  27,  42,   1,  37, 231, 133, 242,  79, 252, // .u~.*.%...O.
+ 225, 214, 188, 141,  89,   6, 219,  46, 121, 102,  53,  36, // ....Y...yf5$
+ 145, 210,  46, 122, 124, 100, 225, 218, 197, 117, 232,  19, // ...z|d...u..
+  74,  57, 246,  96, 188, 198,  65,  88, 135, 166, 196, 155, // J9.`..AX....
+  15,  61, 118,  29,  53, 145, 125, 181, 243,  32, 255,  94, // .=v.5.}.. .^
+  29,   5, 249,  47, 234,  34, 200,  31, 120,  62,   2, 254, // .../."..x>..
+  68, 192, 143,   8, 216, 148,  89, 125,  73, 169, 237, 130, // D.....Y}I...
+  56, 169, 240, 196,   9, 177, 193,  33, 175, 117,  44,  62, // 8......!.u,>
+ 216,  15, 203,  19, 239,  17, 150,  70,  96, 129,  47, 251, // .......F`./.
+ 137, 159,  30, 130, 161, 223,  35,  14, 254, 224, 144, 184, // ......#.....
+ 246, 154, 192, 108, 147,  96,  30, 209, 236,  76, 205,  60, // ...l.`...L.<
+ 186,  44, 109,  10,  89,  90,  54,  51,   5, 133,  66, 118, // .,m.YZ63..Bv
+ 126,  45, 220, 223,  25,  28,  53, 238, 202, 251, 177, 136, // ~-....5.....
+ 213,  50,  73, 238,  21, 180, 136,   4, 247, 215, 106, 151, // .2I.......j.
+ 120, 135,  35, 130, 215, 181, 247, 215, 229, 131, 253, 224, // x.#.........
+ 158, 149,  15,  14,  62, 168, 207, 204, 255,  66, 123,  83, // ....>....B{S
+ 206, 147, 172, 228, 127,  63, 216, 134, 222,  91, 224, 127, // .....?...[..
+ 247, 193, 135,  29, 187, 153,  93, 214,  53, 251,  84,  40, // ......].5.T(
+ 189, 246, 124, 160, 177,  57,  34, 228,  61, 131,   1,  25, // ..|..9".=...
+  94, 246, 140, 125, 213,  74,  54, 199, 255,  78,   1, 193, // ^..}.J6..N..
+ 105, 149, 255,   5, 154,   0, 250, 151, 234, 138, 221, 179, // i...........
+ 221,  19, 118, 117,  10, 125,   3, 216,  85, 131,  90, 216, // ..vu.}..U.Z.
+  90, 186,  87, 176, 171,  83, 197, 227,  89, 224,  85, 133, // Z.W..S..Y.U.
+  93, 133, 167, 214, 123,   5, 187, 250, 153, 217,  85,  91, // ]...{.....U[
+ 198, 190, 101,  87, 203,   0, 195, 174, 150,   1,  88,  69, // ..eW......XE
+ 238, 205, 202,  89,  23, 159, 224, 178, 155,  98, 203, 235, // ...Y.....b..
+ 178,  84, 166, 141, 137, 155, 213, 175,  18, 190,   6, 102, // .T.........f
+ 122,  60,  17, 201, 188, 131, 187,  21,  58,  15,  32,  48, // z<......:. 0
+  44, 141, 223,  80,  91,  18, 159,  44, 143, 223,  82,  15, // ,..P[..,..R.
+  57, 222,  76, 183,  63, 178, 147,  99, 247, 222,  77,  62, // 9.L.?..c..M>
+  83, 141, 123,  55,  49, 255,  38, 244, 219, 110, 117, 182, // S.{71.&..nu.
+ 188,  63, 102, 130, 173,  75, 180,  17, 129,  94, 119, 243, // .?f..K...^w.
+ 157, 142, 126, 208, 167, 255,  62, 222,  54, 232, 109, 195, // ..~...>.6.m.
+  47,  69, 225,  55, 204,  30, 183, 162,   9,  53,  64, 159, // /E.7.....5@.
+ 104,  66, 105, 185, 184,   5, 231,  26,  94,  68,  87, 122, // hBi.....^DWz
+ 232, 118, 205,  33,  84, 175,  79, 152, 184, 102, 138, 115, // .v.!T.O..f.s
+ 206,  29,  83, 156, 115, 230, 248,  14, 246, 170, 206, 130, // ..S.s.......
+ 218,  54,  66,  30, 236, 236, 225, 198, 160, 190,  49, 129, // .6B.......1.
+ 234, 183, 174, 251, 114,  91,  30,  27, 239,  91,  56, 190, // ....r[...[8.
+  46, 225,  40, 234, 181, 104,  34,  42,  43, 174, 239, 128, // ..(..h"*+...
+ 181, 148, 184, 138, 177, 127,  51,  35,  80,  25,  11,  32, // ......3#P.. 
+ 226,  90,  38,  80, 193,  89, 231,  22, 193, 206,   2, 155, // .Z&P.Y......
+  31, 243,  28, 179, 180, 202, 114,  64, 137, 109,  26,  31, // ......r@.m..
+  44, 173, 236,  96, 238, 186,  55, 131, 201, 132, 214,  30, // ,..`..7.....
+ 246,  14, 175,  39, 126, 174, 176,  60, 251, 132, 223,  58, // ...'~..<...:
+ 140, 161,  93, 241,  19, 149, 159, 106, 122, 166, 240, 238, // ..]....jz...
+ 147, 142, 145, 109, 226, 103, 248,  32,   4, 142, 102,  86, // ...m.g. ..fV
+ 239,  70, 148,  60, 108,  77,  39, 122, 159, 232,  98,  24, // .F.<lM'z..b.
+ 123, 110, 189,  87, 177,  71,  82,  44, 152, 246,  67,  44, // {n.W.GR,..C,
+  85,  54, 237, 123, 226, 106,  92,  72,  27, 105, 235,  36, // U6.{.j.H.i.$
+  11, 199, 167, 240, 171, 203, 246, 228, 183, 183,  41, 223, // ..........).
+ 224, 105,  62, 156, 191, 111, 108,  60, 122,  52,  24,  56, // .i>..ol<z4.8
+  80, 217,  13, 148, 243, 119,  61, 124, 168,  59,  15,  29, // P....w=|.;..
+ 229, 228, 212,  74, 122, 156, 100,  90,  39, 244,  76, 121, // ...Jz.dZ'.Ly
+ 175, 128,  94,   6, 215,  33, 190, 199, 211, 108, 204,  23, // ..^..!...l..
+ 213, 141, 163, 228, 204, 129, 189,  20, 188, 255,  31, 179, // ............
+ 235, 127, 202,  20,  94, 211, 227,  90, 199, 113, 122, 137, // ....^..Z.qz.
+ 224,  44, 189,  76, 156,  67,  53,  14,  22, 220, 227,  76, // .,.L.C5....L
+ 204, 141,  44, 184, 255, 110, 110, 180,  86,  87, 231,  66, // ..,..nn.VW.B
+ 216,  23,  87,  85, 149, 207, 206, 198, 101, 107,  93,  23, // ..WU....ek].
+ 254, 201, 161,  56, 246, 136,  18,  12,  78, 195, 140, 216, // ...8....N...
+  85, 243,  98, 253, 201, 194,  89, 225,  76,  13,   3, 215, // U.b...Y.L...
+ 174,  24, 133, 120, 178, 152, 197, 108, 155, 186, 246, 148, // ...x...l....
+ 224,  20, 230, 121, 153,  78, 242, 187, 140,  31, 137, 139, // ...y.N......
+  56, 192, 125,  39, 162, 202, 233, 180, 182, 172,  16,  55, // 8.}'.......7
+  16,  10, 123, 233,  14, 188, 217,  33, 213, 126,  64,   3, // ..{....!.~@.
+ 108, 122, 206, 168, 120, 112,  88, 165, 254, 221, 158, 126, // lz..xpX....~
+  60,  44,  60, 144, 175, 173, 121, 161, 144, 181, 197, 114, // <,<...y....r
+  71,   7, 186,  73, 114, 165,  41,  92, 190, 172, 225, 193, // G..Ir.).....
+ 169, 197, 109, 217,  26, 114, 203, 134,  69, 246, 250, 183, // ..m..r..E...
+ 226,  30, 184, 205, 118,  97, 186,  22, 153,  13, 112, 196, // ....va....p.
+ 218, 183,  78, 183, 173,  68,  65, 233,  19, 132, 143, 141, // ..N..DA.....
+ 178, 210,  45, 180, 136,  52, 107,  33,  79,  57, 207, 167, // ..-..4k!O9..
+  48, 161,  91, 127, 157,  38, 195,  52, 113,  60, 101, 140, // 0.[..&.4q<e.
+  42, 120, 210, 177, 209, 169,  95, 222, 253, 199, 247, 207, // *x...._.....
+  31, 220,  24,  59,   5, 231, 230, 229,  75, 185,  55, 210, // ...;....K.7.
+  17, 241, 164, 187,  69, 205,  53, 145, 103,   4,  51, 115, // ....E.5.g.3s
+  69, 114,  56, 163, 133,  97,  58, 142, 211,  28, 243, 215, // Er8..a:.....
+ 235, 157,  90, 195, 141, 192,  61, 173, 219, 112,  24, 131, // ..Z...=..p..
+ 140,   3, 162,  60,  48, 125, 129, 136,  95, 142, 121, 112, // ...<0}.._.yp
+ 231,  16, 246,  98, 115, 238,  97, 237, 146, 132, 208, 244, // ...bs.a.....
+ 146, 104,  77, 150, 198,  49, 111,  92, 195, 200, 179,  30, // .hM..1o.....
+ 252,  43,  53, 146,  13,  62, 252,  27,  24,  42, 248,  49, // .+5..>...*.1
+ 206, 245,  17, 165, 227,  75, 189,   8,  27, 135, 233,  96, // .....K.....`
+ 138, 189, 188, 214, 128,  38, 125, 174, 205, 206, 158, 235, // .....&}.....
+  12, 163,  11, 199, 243, 228, 226, 136,  55, 225, 185,  14, // ........7...
+  28, 158, 165, 205,  60,  77, 137,  52, 140, 203, 211,  12, // ....<M.4....
+  36,  94,  69, 152,  47, 129,  19,  30,  79, 210, 120, 154, // $^E./...O.x.
+ 211, 244,  42,  10, 197, 125, 144, 245,  45,  66,  98,  58, // ..*..}..-Bb:
+  96, 253,   0, 181, 235, 115, 220,  18, 245, 154, 184,  97, // `....s.....a
+ 157,  16,  65, 115, 216,  80,  74, 238,  75,  23,  77, 131, // ..As.PJ.K.M.
+ 173,   1, 170, 136,  56, 188,  14, 104, 238, 166, 131,  51, // ....8..h...3
+ 103, 246, 133, 236, 177,  14,  47, 244,  93, 217, 147,  52, // g...../.]..4
+ 209, 206, 140,  47, 179, 102, 167,  29, 108,  54, 121, 147, // .../.f..l6y.
+ 186,  18,  34,  38, 200, 190, 185, 106, 101,  69,  87,  28, // .."&...jeEW.
+  27, 221,  68, 195,  43,  63, 157,  21, 198, 175, 119,  58, // ..D.+?....w:
+ 251,  19, 249, 166, 223, 194, 140, 105, 225,  68, 119,  84, // .......i.DwT
+   6, 117,  36, 168, 204, 155,  89, 175, 113, 209, 237, 109, // .u$...Y.q..m
+ 177,  34, 189,   9, 223, 184, 153,  55,  23,  16, 121, 213, // .".....7..y.
+ 106,  96, 132, 107,  79, 162, 246, 203,  87, 226,  58, 113, // j`.kO...W.:q
+  13, 173,  49, 218, 185,  35,  77, 164, 112,  69, 173,  95, // ..1..#M.pE._
+  23, 205,  66,  43,  11,  76, 172,  51, 172, 130, 113, 157, // ..B+.L.3..q.
+ 187,  32, 229, 143, 123,  55, 115,  23, 118, 100, 215, 214, // . ..{7s.vd..
+ 159,  53,  45, 140, 157,  78, 127,  47, 196,  61,  54, 113, // .5-..N./.=6q
+  10, 223, 194, 235,  52, 233,  60,  95, 236, 144,  49, 151, // ....4.<_..1.
+ 216,   9, 186,  24,   0, 115, 229, 188, 157, 231, 216,   2, // .....s......
+ 203, 101, 204, 138, 121, 133,  47, 130, 226, 164, 167, 226, // .e..y./.....
+  45, 183,   5,  66, 140, 139,  33, 243, 186,   3, 172,   6, // -..B..!.....
+  22, 208, 194,   3, 161,  35,  12, 198,  98,  21, 171, 171, // .....#..b...
+ 199, 118, 151, 195, 102,  44,   2, 220, 162,  29, 226, 163, // .v..f,......
+ 103,  54, 128, 241,  17, 150, 238,  89, 181, 203, 220,  61, // g6.....Y...=
+  90,  26, 185, 123, 120,  26, 218, 211, 175, 125, 185, 241, // Z..{x....}..
+  50, 208, 120, 126,  65, 160, 226, 126, 238, 131,  72, 229, // 2.x~A..~..H.
+ 124, 173, 118, 176,  99,  54,  59, 180, 135, 219,  46, 246, // |.v.c6;.....
+ 115,  34, 246, 110,  87,  57, 109, 167,  96, 142, 238,  17, // s".nW9m.`...
+ 230,  38, 160,  17,  47,  83,  66,  74, 152, 181, 251,  69, // .&../SBJ...E
+ 208,  30, 137, 160, 185, 230, 192,  63, 224,   5,  44, 243, // .......?..,.
+ 102, 141, 223, 167,  55, 221, 118, 183,  59,  35,  46, 106, // f...7.v.;#.j
+ 143, 240,  32,  95, 198, 163, 204, 254,  80, 119,  76,  58, // .. _....PwL:
+ 108,  11, 175, 133, 180, 124,  39, 107, 240,  41, 174, 239, // l....|'k.)..
+  92,  95,  70,  65, 186, 182,  77, 203, 232, 180,  57,  48, // ._FA..M...90
+ 196, 185, 185, 141, 147,  51,  53,  82, 181,  86,  16,   8, // .....35R.V..
+ 251,  98, 232, 142, 177,  87, 231, 235,   2, 212, 104, 205, // .b...W....h.
+  56,  22, 223, 193,  65,  14,  42, 184, 105, 190, 155, 219, // 8...A.*.i...
+  68, 184,  31, 215, 201,  28, 165, 160,  74, 215, 182, 203, // D.......J...
+  19,  89, 124,  92, 117,  84,  63, 122, 133, 115, 171,  99, // .Y|.uT?z.s.c
+  14, 194,  18,  43, 139, 167, 144,   1, 226, 217, 136,  39, // ...+.......'
+ 165, 186, 113, 147,  21, 134, 178, 252,  50, 150,  74,   5, // ..q.....2.J.
+   1,  51,  87,  47, 228, 197,  62,  26, 248,  26,  89, 144, // .3W/..>...Y.
+  89, 112,  56, 118,  79,  21, 173,  39, 197,  90,  76, 141, // Yp8vO..'.ZL.
+   5, 141,  57, 173, 178,  22,  83, 182,  39,  74, 167, 249, // ..9...S.'J..
+  43, 234,  27, 155,  74, 125, 144, 111, 183,  18, 131,  98, // +...J}.o...b
+ 139, 143,  96,  34, 123, 102,  72, 195,  45,  30, 186, 245, // ..`"{fH.-...
+ 120, 185, 116, 108, 139,  70, 209, 242, 185, 134, 211, 122, // x.tl.F.....z
+  62,  26, 193, 151,   9, 231, 114, 145,  11, 218,  20, 201, // >.....r.....
+ 153, 161,  84, 112, 193,  25, 161, 250, 162, 103,  64,  96, // ..Tp.....g@`
+ 102,  43,  73,  47,  65, 177,   3, 221,   4, 126, 146,  32, // f+I/A....~. 
+ 116, 197, 140,  22, 173, 185,  91, 224, 244,  45, 123, 196, // t.....[..-{.
+ 102,   1, 113, 197,  31,  77,  44, 134,  22, 143, 243, 158, // f.q..M,.....
+   7, 251, 212, 104, 132, 181, 107, 236,  22, 176, 170,  49, // ...h..k....1
+  62, 108,   7, 141, 123, 180, 171, 126,  76,  52, 136,  53, // >l..{..~L4.5
+  22,  83,  34, 161, 122, 143,  86, 205,  46,  46, 119,  54, // .S".z.V...w6
+ 227, 190, 184,   2, 100,  26, 235, 178,   3, 189,  16,   3, // ....d.......
+ 200,  36, 148, 209, 187,  59, 173, 208, 190, 192,   0, 196, // .$...;......
+ 140,  70,   1,  19,  19,  12, 205, 231,   1, 137, 124, 112, // .F........|p
+ 190, 186,   4, 172,  55,  73, 223, 192, 193, 108,   8,  86, // ....7I...l.V
+  32,   7, 123,  79, 215, 196,   6,  96, 132, 129,  14, 212, //  .{O...`....
+  49,  98, 102,  51,  68,  74, 129, 167, 249, 121, 236, 253, // 1bf3DJ...y..
+ 209, 120,  76, 235, 238, 223,  26, 244,  39, 211, 163, 224, // .xL.....'...
+ 222, 205, 116, 198,  31, 188,  10, 155,  21, 152, 230,  47, // ..t......../
+ 113,  22, 142,  51, 115,  56, 138, 241,  58, 112,   8, 104, // q..3s8..:p.h
+  77, 195,  30,  53,  30,  82, 143, 123,  13, 132,   8,  51, // M..5.R.{...3
+ 213, 232, 180,  57, 228,  30, 238, 253,  40,  50,  18, 127, // ...9....(2..
+ 119, 239,  38,  66, 249,  59, 143, 215, 215, 119, 254,  48, // w.&B.;...w.0
+ 242, 247,  31, 143, 251,  87, 231, 113, 131, 184, 131,   9, // .....W.q....
+  47, 234, 157,  86, 219, 105, 232, 100, 144, 242, 245,  57, // /..V.i.d...9
+ 206,  52,  31,  53, 183, 157, 254, 206, 223,  30,  79,  46, // .4.5......O.
+  78,  26,  23, 145, 190, 124, 154,  94,   5,  78, 187, 209, // N....|.^.N..
+ 110,  60, 104, 183,  27, 157,  45,  74,  77, 249, 137, 219, // n<h...-JM...
+ 113,  78, 243, 124, 236, 175, 175,  95,  94,  94, 182,  46, // qN.|..._^^..
+  55,  72,  98,  61,  89, 239, 182, 219, 237, 117, 202, 231, // 7Hb=Y....u..
+ 236,  80, 173, 143, 113, 126, 161, 129, 188,  78, 227, 154, // .P..q~...N..
+ 127,  69,  55, 227,  80,  57,  78, 195,  28, 167, 116, 184, // .E7.P9N...t.
+ 192, 140,  82, 117, 241, 188, 150, 167, 233, 179, 225,  48, // ..Ru.......0
+  27,  88, 215, 123,  13, 230,  48,  27, 127, 215,  29, 189, // .X.{..0.....
+ 165,  31, 245, 156, 117, 174,   3, 139, 151,  77, 110,  18, // ....u....Mn.
+  60, 218, 124, 178, 241, 116, 155, 210, 211, 154, 214,  28, // <.|..t......
+ 133, 231,  81, 124, 237,  55, 158, 100,  81,  24, 171, 198, // ..Q|.7.dQ...
+  36,  76,  38, 124, 183, 221, 200, 196,  51, 163, 215, 120, // $L&|....3..x
+ 212,  29,  95, 245, 134,  41,  65,  52, 164, 176,  99, 115, // .._..)A4..cs
+   1, 136,  79,  32,  30,  14,  99, 170,  26, 181,  52, 195, // ..O ..c...4.
+ 100, 112,  74, 252,  67,  17, 232, 160, 111,  91, 237, 127, // dpJ.C...o[..
+ 112, 239, 240, 220,  57, 191, 110, 196, 233,  73, 250, 120, // p...9.n..I.x
+  29, 233,   9, 130,   0, 197, 206,  31, 106,  63, 112, 204, // ........j?p.
+ 237,  68,  62, 201, 182,  15, 183, 120, 172,  72, 252, 199, // .D>....x.H..
+ 215,  86,  49, 148, 118, 112, 187,  28,  98, 168, 179, 223, // .V1.vp..b...
+  24, 197, 250, 170, 199, 191, 205,  97,   4, 136, 210, 160, // .......a....
+ 249, 141,   1, 241,  97, 231, 137,   9,  63,  33, 209, 134, // ....a...?!..
+ 112, 160, 215,   0, 203,  71, 235,  15, 125, 192,   5, 111, // p....G..}..o
+ 175,  81,  96,  71, 251,  31, 212,  92, 245,  33, 184,  25, // .Q`G.....!..
+ 234,  81,  56, 141, 115, 255, 230, 248, 132, 165,  47, 223, // .Q8.s...../.
+ 249, 251, 112, 123,  56,  24, 142,  28, 118, 174, 119,  28, // ..p{8...v.w.
+ 102,  79, 139, 136,  17, 255,  41,  34, 152, 100, 251,  78, // fO....)".d.N
+ 119, 179,  13, 122, 139,  30,  50, 139, 229, 116,  54, 237, // w..z..2..t6.
+ 183, 205, 184, 249, 112, 107, 235, 193,  35,  71, 141, 195, // ....pk..#G..
+  68, 199, 181, 242, 108,  88, 121, 182,  24,  13, 216, 194, // D...lXy.....
+ 223,  90, 212, 123, 222, 251, 242, 157, 118, 171,  11,   0, // .Z.{....v...
+ 153, 184, 119,   6, 136, 142, 128, 205, 194, 210, 196, 126, // ..w........~
+ 136, 242,  88, 239, 241, 193,  90, 223, 105, 154,  36,  77, // ..X...Z.i.$M
+ 147, 134, 176, 183, 185,  36, 249,  29,  37, 210, 115, 227, // .....$..%.s.
+ 142,  10,  42, 221, 121, 132, 191, 213,  56,  88, 245, 253, // ..*.y...8X..
+  44, 163, 200,  56,  62,  23,  37, 224, 106, 183,  40,  15, // ,..8>.%.j.(.
+  46, 227,  73, 147,  15,  21, 152,  49, 112,  36, 184, 172, // ..I....1p$..
+ 162, 187, 245,  96,  67,  31,  23, 225,  53, 168, 213, 227, // ...`C...5...
+  94,  98, 232, 109, 212, 198, 241, 118, 119, 244, 192,  70, // ^b.m...vw..F
+  61, 139,  38, 184, 207, 125,  88, 128, 187,  67, 224,  46, // =.&..}X..C..
+  50,  86,  32, 208, 237, 214, 250,  28,  37, 227, 105,  94, // 2V .....%.i^
+ 175, 115,   0,  33, 157, 195, 159, 103,  89, 154, 205,  69, // .s.!...gY..E
+ 110, 109, 217,  76, 245,  33, 175,  20, 180,  48, 174,  28, // nm.L.!...0..
+  87, 109, 131,   1, 191, 196, 202, 201, 224, 106, 116,  71, // Wm.......jtG
+ 162,  77, 110,  61, 140, 114,  61, 172,  84, 183,  69,  21, // .Mn=.r=.T.E.
+   2, 238,  89, 122,  66, 244, 127, 114,  23,  50, 213, 162, // ..YzB..r.2..
+  77, 102, 246, 149,  47,  44,   1, 137,  55,  86,  59,  65, // Mf../,..7V;A
+ 133, 110, 119, 134, 163, 193,  67,  71, 209, 242, 149,  21, // .nw...CG....
+ 195, 165,  71, 155,  91, 155,  91,  14, 177,  24,  97, 118, // ..G.[.[...av
+  86, 157,  77,  15, 182, 232, 111, 184, 100,  54, 109, 116, // V.M...o.d6mt
+ 233, 239, 118, 125, 162, 104, 173,  23, 102, 137,  77, 183, // ..v}.h..f.M.
+  12, 229,  54, 187, 244, 119, 123, 233,  36, 122, 240, 224, // ..6..w{.$z..
+ 193,  18, 180, 186,  60, 141,  32, 173, 205, 227, 213, 131, // ....<. .....
+ 206, 163, 227, 237, 112,  41,  94, 213, 192, 176,   4, 183, // ....p)^.....
+  30, 118, 194, 227,  71, 225,  93, 184, 245, 240, 225, 195, // .v..G.].....
+ 165, 136, 195, 225,  75, 128,  74,  60, 218, 231, 224, 143, // ....K.J<....
+ 191,  97, 105,  84,  13, 136, 146, 141, 155, 134, 165, 131, // .aiT........
+  66, 181, 228, 164,  60,  81, 202,  94, 163, 164, 161,  61, // B...<Q.^...=
+  74, 123,   5, 210, 205, 159,  98,  76, 220, 132,  63, 129, // J{....bL..?.
+  26, 205, 159,  70, 205, 146, 220, 171, 201,  53, 113,   6, // ...F.....5q.
+ 231, 205, 105, 164,  42, 129,  79, 198, 227,  88,  55, 184, // ..i.*.O..X7.
+  81, 141, 231, 231, 233, 167,  72, 237, 235, 147,  84,  55, // Q.....H...T7
+  62, 190, 154, 255, 220, 191,  62,  63,  78,  99, 245,  38, // >.....>?Nc.&
+ 205, 211, 106, 250,  94,  99, 246, 183, 197, 118,  95, 156, // ..j.^c...v_.
+  34,  60,  84, 141, 208, 191, 136,  38, 192,  81, 188, 210, // "<T....&.Q..
+ 146, 114,  70, 233, 248, 154,  80,  90, 166, 182, 182,  70, // .rF...PZ...F
+ 102,  97,  25, 234,  65, 154, 133,  66, 216, 101, 169, 155, // fa..A..B.e..
+ 253, 237, 111, 247, 213, 223, 238, 251, 254,  49, 223, 217, // ..o......1..
+ 200, 175, 225, 136,  24, 150, 198,  13,  45, 122, 119, 116, // ........-zwt
+ 254, 111, 148, 139, 216, 231, 207,  97,  54, 108, 178,  82, // .o.....a6l.R
+ 143,  19,  87,  86, 185, 139,  48, 115, 155,  77,  75, 185, // ..WV..0s.MK.
+ 189,  30, 197, 154, 198, 148,  49, 220,  55, 142,  42, 189, // ......1.7.*.
+  66, 216, 120, 131, 229, 158, 212, 132, 141, 176, 144,  86, // B.x........V
+  73, 106, 211, 252, 106, 133, 104, 125,  62, 206, 175, 155, // Ij..j.h}>...
+ 149,  68, 115,  69,  78, 179, 216, 141, 206, 195,  19,  61, // .DsEN......=
+  89, 135, 236,  54, 198,  77, 140,  23,  39,  30, 177,  69, // Y..6.M..'..E
+  99,  29, 230, 141,   1, 235,   9, 236,  99,   4, 157,  45, // c.......c..-
+  26,  53,  87,  17, 239, 211,  52,   9, 192, 231,  19, 223, // .5W...4.....
+ 164, 237,  53,  62,  77,  39, 121,  52, 146, 186,  41, 168, // ..5>M'y4..).
+ 136, 160, 236, 149, 101,  88,  22,  94,   1,  31,  13, 218, // ....eX.^....
+ 248, 170,  49,  73, 227, 104, 216, 248, 123,  24, 134, 210, // ..1I.h..{...
+  65, 198,  99, 213,  48, 254,   9, 184,   3, 182, 250,  40, // A.c.0......(
+   1, 127, 208, 148,  70, 152,  33,  16, 123,  13,  11, 171, // ....F.!.{...
+   5, 162, 119,   7,  76, 171,   4,  83, 153, 176,  42,  69, // ..w.L..S..*E
+ 240, 188, 222,  23,   7, 105, 161, 253,  11, 213, 207,  39, // .....i.....'
+ 182,  60,  35, 241, 227,   3, 119,  33,  53,  48,  67,  53, // .<#...w!50C5
+  58,  94, 227,  62, 202, 228, 108,  36, 124,   8,  55,  36, // :^.>..l$|.7$
+ 184, 121,  23, 246,  53,   4, 153,  75,  30,  68, 199, 113, // .y..5..K.D.q
+  52, 158,  68,  19, 226,  67,  64, 134, 154, 114, 179,  50, // 4.D..C@..r.2
+ 149, 114,  73,  92, 110, 149,  89,  57,  37, 134,  74,  39, // .rI.n.Y9%.J'
+ 197,  92, 111,  47,  32,  38, 183, 239,  67, 173, 227,  21, // ..o/ &..C...
+ 180, 158, 239, 136,  93, 107, 177, 145, 176, 189, 177, 177, // ....]k......
+ 197, 125, 161, 209,  46, 243,  93, 154, 169,  58, 151,  73, // .}....]..:.I
+ 214, 110, 143,   6,  95, 198, 158,  16, 187,  64, 152,  74, // .n.._....@.J
+  82, 179,  30, 121, 192, 243,   2,  57, 230,  83, 214, 150, // R..y...9.S..
+  46,  79, 166, 196, 132, 198, 103, 217, 116,  89, 138, 197, // .O....g.tY..
+ 134,  63, 236,  10, 158,  46,   2, 107,  86, 148, 183, 211, // .?.....kV...
+ 224, 102,  29,  64, 243,  17,  56, 162,  35,  63, 164,  90, // .f.@..8.#?.Z
+ 234, 188, 161,  25, 245,  45,  16, 213, 112, 128,  90, 154, // .....-..p.Z.
+  53,  24, 215, 214,   8, 239, 238, 242,  49, 200,  92, 188, // 5.......1...
+  41, 112, 195,  54, 177, 152,  50, 254, 208, 172,  10, 197, // )p.6..2.....
+ 220, 169, 134, 112, 146, 214,  66, 146,  90,   8, 215,  91, // ...p..B.Z..[
+ 132,  80,  93, 119, 211, 162, 198,  74, 116,  62,  78, 179, // .P]w...Jt>N.
+ 156, 248, 118, 154,  40, 162, 225,  35,  20,  35, 110,  29, // ..v.(..#.#n.
+ 122, 127,  34,  26,  13,  59, 154,  45, 225,  22, 202,  26, // z."..;.-....
+ 203, 111, 169,  79, 190, 119, 238,  47, 173, 175, 198, 106, // .o.O.w./...j
+ 120, 213,  82, 193,   9,  33, 139,  76, 133,  69, 188, 157, // x.R..!.L.E..
+ 103, 149,  12,  50,   8, 188, 239, 166,  42,  85, 164, 184, // g..2....*U..
+ 139, 178,  85, 113, 197,  80,  52,  42, 174,  58, 219, 236, // ..Uq.P4*.:..
+ 100, 155, 163,  81, 149,  41,  83, 229,   1, 132,  82,  41, // d..Q.)S...R)
+  70, 187, 114, 214, 204, 163, 118, 141, 113, 172,  18, 150, // F.r...v.q...
+ 201, 105,  56,   4, 182,   9, 157, 176, 131, 193,  54, 177, // .i8.......6.
+ 104, 101,  58, 173, 147,  17, 161,  92, 119,  52, 101, 142, // he:.....w4e.
+  14, 213, 136, 219,   2, 219, 178,  48, 179, 171, 233, 202, // .......0....
+ 153, 173,  32, 193, 206, 211, 211,  57, 158, 137, 162, 151, // .. ....9....
+  32,  91, 125, 110, 220,  73, 126, 202,  10, 239, 160,  63, //  [}n.I~....?
+  51,  59, 238, 254,  41, 102, 244, 114, 204, 158,  99, 186, // 3;..)f.r..c.
+ 168,  69, 141,  50,  95,  72,   2, 224, 133, 198, 236, 230, // .E.2_H......
+  93,  66,  34, 193,  25, 186, 150,  16,  59, 235, 146, 104, // ]B".....;..h
+  33, 152, 105, 210,  86, 166,  84, 181, 214, 197, 240, 214, // !.i.V.T.....
+  29,  41, 191,  50,   5,  23,  89, 192, 250, 116,  92,  54, // .).2..Y..t.6
+  37, 150, 101, 186, 115, 226, 254, 205, 248, 166, 110,  14, // %.e.s.....n.
+ 162, 108,  16, 235,  10, 229, 188, 123, 142,  84, 230, 194, // .l.....{.T..
+ 210, 153, 192, 132, 173,  90, 106, 147, 183,  23,  43, 140, // .....Zj...+.
+  89, 119, 176, 213,  91,  76, 149,  49,  20, 108,  26, 189, // Yw..[L.1.l..
+ 185, 201,  13, 252,  91,  43,  79,  79,  78,  98,  97, 181, // ....[+OONba.
+ 236,  70, 137,  79,  76,  76,  28,  98, 156,  10, 178, 219, // .F.OLL.b....
+ 181,  98, 127, 193,  37, 182,  30, 136, 228,  95, 240, 183, // .b..%...._..
+  84,   0, 129,  60, 143,   8, 159, 154, 220,  49, 191,   1, // T..<.....1..
+ 135,  30, 141, 101,  51,  69,  42, 253, 250,  76, 169, 166, // ...e3E*..L..
+  51,  44,  70, 133, 193,  95, 138, 235, 146, 229,  67,  70, // 3,F.._....CF
+  17, 156, 227, 237, 104, 164, 190,  48, 118, 213, 249, 191, // ....h..0v...
+ 132, 186,  84,  27,  80,  82, 151, 135,  85, 234,  50, 199, // ..T.PR..U.2.
+  94, 204, 147,  13,  42, 158, 102, 245, 241,  89,  68, 152, // ^...*.f..YD.
+  49,  38, 214,  48, 195,  41,  53, 155, 184, 121, 158, 126, // 1&.0.)5..y.~
+  94,  18, 188,  16, 130, 137,  39,  77, 169, 242, 209,   5, // ^.....'M....
+ 131, 232,  56, 189, 202, 224, 217,  93, 174,  94, 131, 173, // ..8....].^..
+ 226,   1, 213,  30, 134, 194, 190,   1, 128,  54, 105,  28, // .........6i.
+  67,  87,  48,  97, 178, 107, 148,  45, 173, 141, 249, 145, // CW0a.k.-....
+  54,   1, 119, 193, 250, 101, 152,  12,  99, 253,  69,  14, // 6.w..e..c.E.
+ 112,  14, 192,  88, 196,  43,  93,  26, 156, 234, 193, 217, // p..X.+].....
+  29, 147, 116,  97,  56,  19, 181, 148, 168,   9, 225, 168, // ..ta8.......
+  23,  88, 192,  74, 250,  76, 146, 200, 185, 223,  40, 238, // .X.J.L....(.
+ 148, 251, 197, 229, 113, 134, 152, 214, 104,  54,  54,   8, // ....q...h66.
+ 245, 106, 101,  20,  36, 197,   4, 252, 117,  90, 242,   5, // .je.$...uZ..
+ 178,  48,  32,  25, 103, 145, 231, 170,  42, 137, 188,  59, // .0 .g...*..;
+ 248, 242,   5,  37, 147, 215, 187, 147, 137, 158,  23, 179, // ...%........
+ 151, 206, 151, 218,  80, 137,  66, 142,  74, 162, 191, 109, // ....P.B.J..m
+  76, 238, 171, 102,  77,   7,  55,  51,  77, 223,  33,  66, // L..fM.73M.!B
+ 118, 225,  39, 249, 105, 115, 192, 123,  14,  52, 123, 111, // v.'.is.{.4{o
+  12,  41,  32, 102, 154,  64, 113,  94, 225, 253, 150, 114, // .) f.@q^...r
+ 207, 119, 149, 212,  69,  73, 149, 213, 169, 243,   0, 245, // .w..EI......
+ 214, 184,  94,  90,   4, 151,  49, 148, 127, 141, 123, 199, // ..^Z..1...{.
+  40, 112, 215, 107,  28, 204,  87, 180, 149,  85, 157, 231, // (p.k..W..U..
+  82, 105, 168,  14, 204,  47, 200,  55, 139,  67, 243,  37, // Ri.../.7.C.%
+ 249, 166, 146, 122, 137, 124, 243, 173, 120,   2,  81, 104, // ...z.|..x.Qh
+  30, 106,  85, 153, 114,  25,  18,  46, 151,  56,  56,  77, // .jU.r....88M
+  69, 226, 184, 155, 163,  40,  82,  22,  12, 197, 195, 186, // E....(R.....
+  60,  83,  91,  92,  69, 103,  84, 145, 147, 102, 118, 144, // <S[.EgT..fv.
+   4,  77, 216, 187, 172,  32,  10,  15, 155,  93, 124, 170, // .M... ...]|.
+ 185,  75,  45, 234,  34, 231, 183, 160,  56, 173, 194, 207, // .K-."...8...
+ 226, 237,  95,  25, 170, 175, 193, 252, 238, 136, 182, 172, // .._.........
+ 152, 119, 160,  80,  85, 111, 246, 197,  65, 152, 211, 219, // .w.PUo..A...
+ 126, 109,  36, 106, 186, 220, 197, 225, 192, 164, 224, 243, // ~m$j........
+ 221,  76, 229, 190, 206, 171, 204, 243, 243,  60, 199, 154, // .L.......<..
+ 199,  58, 191, 212, 218,  78, 151,  78,  33,  92,  89, 181, // .:...N.N!.Y.
+ 101,  33, 123,   9,  77,  41, 112, 210,  78, 228, 229, 176, // e!{.M)p.N...
+  93, 162,  18,  85, 150, 198,  44,  39, 108,  38,  71, 185, // ]..U..,'l&G.
+ 118, 168,  57, 217, 203, 171, 172, 154,  37, 199, 243, 215, // v.9.....%...
+ 187, 109, 195, 151,  48,  58, 245, 102,  27, 168,  47, 101, // .m..0:.f../e
+ 117, 150,  40, 117, 101,  61, 178,  17,  77,  30,  25,   2, // u.(ue=..M...
+ 222, 103, 146, 203, 134, 160, 210, 143, 122,  95, 147, 218, // .g......z_..
+ 235, 179, 203,   2, 164,  34,  43, 220, 129,  43,  38, 101, // ....."+..+&e
+ 137,  41, 157,  10, 195, 179,  12,  23,  43,  25,  12,  38, // .)......+..&
+  86,  91, 126,  28,  98,  17,  46,  96,  93,  50,  40, 102, // V[~.b..`]2(f
+ 206, 181, 193, 151, 136, 183,  47, 203, 171, 240, 203, 221, // ....../.....
+ 131, 250,  52, 204, 106,  67,  90, 232, 102,  61,  35, 158, // ..4.jCZ.f=#.
+ 158, 132, 211,  19,  93, 136, 181, 181, 222, 113, 148, 128, // ....]....q..
+  89, 182, 241, 239,  24, 145,  74, 186,  98, 249, 188, 147, // Y.....J.b...
+  81, 172,  36,  46, 144, 179,   2, 179, 153, 105, 145,   8, // Q.$......i..
+  19,  29, 106, 152, 221,  27, 172, 102, 255, 114, 167, 170, // ..j....f.r..
+  37, 116, 151, 151, 240,  69,  92,  47,  74, 224, 141, 222, // %t...E./J...
+   2, 157, 150, 163,   0, 167,  92,  62, 254, 203, 118,  53, // .......>..v5
+ 171, 109, 176, 232, 165,  22,  52, 126, 203, 145, 167, 168, // .m....4~....
+ 202,  74, 185,  15,  89, 202,  93, 186, 103,  57, 215,   7, // .J..Y.].g9..
+  65,  44, 105,  80, 193, 169, 108,   3, 117, 164,  89,  86, // A,iP..l.u.YV
+  27, 109,  50, 133,  89, 150,  94, 138, 236, 137, 141, 214, // .m2.Y.^.....
+ 205,  71, 248,  59, 223, 161, 122, 234, 230,  48, 205, 139, // .G.;..z..0..
+  28, 204,  73, 220, 153,  30, 126,  67,  42, 195, 242, 247, // ..I...~C*...
+ 225,  35, 252, 237, 205,  53, 143, 216,   7, 211,  58, 201, // .#...5....:.
+ 110,   5,  44,  70, 248,  90,  89,  12, 184, 229, 227, 252, // n.,F.ZY.....
+  30,  74, 178,  10, 160,  77,  87, 188,  37, 195, 113, 119, // .J...MW.%.qw
+ 210, 101, 237, 186,  27,  23, 184, 156, 234, 210, 177,  89, // .e.........Y
+ 147, 130, 238,  26, 215,  34, 155,  29, 220,  14,  15, 238, // ....."......
+  95, 221, 171, 166,  41, 125,  96,  12, 251,  14, 171, 164, // _...)}`.....
+ 164,  34, 169, 206, 202,  20,  37, 227, 191,  76, 160, 224, // ."....%..L..
+  52, 133, 202, 250, 239, 155, 155, 155,  95, 156, 217,  54, // 4......._..6
+ 195, 151,  52,  76, 117,  13, 183, 100, 168, 194,  92, 107, // ..4Lu..d...k
+ 237,  85, 246, 196, 101, 228,  11, 218, 109, 118,  13, 101, // .U..e...mv.e
+ 165,  92,  38, 199,  93,   9,  76,  68, 168, 182, 171,  77, // ..&.].LD...M
+ 185,  12, 208, 159, 187, 134, 174, 210, 150,  59, 151, 253, // .........;..
+ 101,  99,  55, 151, 207, 114,  23, 117,  32, 203, 230, 206, // ec7..r.u ...
+  95, 129, 114,  33, 177, 254, 179, 241, 207,  69, 120,  44, // _.r!.....Ex,
+ 233, 185, 157, 211, 117, 137, 148, 191, 230, 250,  95, 109, // ....u....._m
+ 153, 168, 137,  10,  36,  40, 234,  97,  75, 177, 165,  73, // ....$(.aK..I
+ 139, 174, 124,  41, 109,  81,  96, 209, 141,  48, 207,  51, // ..|)mQ`..0.3
+ 215, 196, 123, 197, 114,   6, 209,  73,  68, 111, 214,  86, // ..{.r..IDo.V
+  47,  19,  62, 221,  38,  69, 169,  70,  41, 129, 174, 209, // /.>.&E.F)...
+ 196,  16,  17, 244,  14, 113, 101,  41, 220, 255,  51, 245, // .....qe)..3.
+ 109, 161, 186, 134, 185,  94, 114, 115, 107, 168, 173, 154, // m....^rsk...
+  63,  39, 100, 160,  74, 239, 152, 102,   5, 128, 140, 182, // ?'d.J..f....
+ 183, 128,  19, 229, 155, 211,  34,  45, 172, 243, 181, 250, // ......"-....
+ 187,  16,  95,  26, 235, 247,  41,  25, 141, 129, 232, 232, // .._...).....
+  27, 247, 215, 169,   4, 233,  75, 117, 199, 116, 147, 120, // ......Ku.t.x
+ 114,  38, 235, 115, 211, 148, 194, 231, 185, 232, 191,  15, // r&.s........
+ 182,   8, 215,  54, 139,  57, 137,  61, 252, 218, 236, 232, // ...6.9.=....
+ 192,  86, 166, 202,  68,  45, 217, 119, 156, 219, 123, 248, // .V..D-.w..{.
+  70, 241, 144,  96,  48,  12,  39, 167, 199,  41,  74,   2, // F..`0.'..)J.
+   8, 199, 186, 198, 247, 148,  64, 252,  87, 139,  31, 135, // ......@.W...
+ 204, 212, 220, 187, 217, 159, 217, 207, 230, 104,  26, 199, // .........h..
+  66, 196,  27,  54, 190, 186, 211, 204,  90,  72, 217, 204, // B..6....ZH..
+ 111, 138, 188,  84, 138, 234,  12, 104, 195,  57,  86, 140, // o..T...h.9V.
+ 100, 204, 238, 137, 201, 180, 164,  35, 223, 206, 192,  85, // d......#...U
+ 162, 101,  42,  47, 173, 173, 162, 146,  10, 227, 184, 250, // .e*/........
+ 221,  28,  78, 205, 206, 242,  70, 187, 125,  62, 169,  15, // ..N...F.}>..
+ 100, 103, 235,  31,   5,  84,  42, 205, 156,  83, 112, 125, // dg...T*..Sp}
+ 185, 184, 127, 101,  32, 106,  42, 145, 121, 155, 165,  18, // ...e j*.y...
+ 114, 203, 135, 222,  16,  49, 201,  60, 157,  96, 219,  65, // r....1.<.`.A
+ 246, 152, 204, 182, 194,   2,  41, 173,  91,  98, 120, 243, // ......).[bx.
+   2, 202,  23, 176,   5, 182,  92, 229, 198, 254, 166,  40, // ...........(
+  99, 170, 109,  55, 250, 169,  98, 135, 227,  11, 251, 122, // c.m7..b....z
+  95, 147, 125, 108, 117,  48, 186, 187,  89,  84,  28,  33, // _.}lu0..YT.!
+ 160, 110,  24,  97,  50,  84, 198, 205, 100, 216, 158, 211, // .n.a2T..d...
+  62, 110, 213, 236, 201, 238, 108, 217,  93, 187, 230, 162, // >n....l.]...
+ 210,  75,  99,  12, 200,  28,  68, 202, 150,  88,  92,  71, // .Kc...D..X.G
+ 137, 205,  56, 154, 128, 237, 186, 123,  96,  57, 217, 130, // ..8....{`9..
+ 128,  60,  15, 204, 175,  41, 247, 237,  36,  37,  78, 170, // .<...)..$%N.
+  92, 253, 191, 162, 139,  48,  13, 120,  69, 133, 214, 148, // .....0.xE...
+ 226, 203, 120, 125, 219,  88,  65,  47,  61, 180, 173, 190, // ..x}.XA/=...
+  19, 195, 246,  77,  66, 148, 126,  87, 185, 115, 202, 110, // ...MB.~W.s.n
+ 192, 214,  46,  49, 205, 171, 102, 187, 166, 106,  45,  23, // ...1..f..j-.
+  31, 154, 255,  44,  14, 153, 197, 134, 222,  38, 103, 250, // ...,.....&g.
+ 242,  23, 251, 242,  43, 191, 192, 190, 246,  23, 104,  18, // ....+.....h.
+ 249, 237,  87, 122, 227, 242, 155, 213,  10,  64, 235, 238, // ..Wz.....@..
+ 168, 163, 137, 193, 252, 151, 107,  49,  88,  83, 193,  70, // ......k1XS.F
+ 163,   8, 237, 125, 121,  17,  44, 237,  69,  44, 142, 221, // ...}y.,.E,..
+ 252, 107,  58, 133,  42, 102, 212, 144, 192, 204, 163, 206, // .k:.*f......
+ 114, 121, 120, 129,  56, 204,  89, 136, 148, 246, 154, 119, // ryx.8.Y....w
+  25,  97, 124, 155, 222, 212, 240,  33, 229,  92,  34, 180, // .a|....!..".
+  98, 130,  67, 162, 236, 215, 186,  83, 146, 108, 102,  60, // b.C....S.lf<
+  57, 140,  89,   7,  75,  10, 203,  29, 248, 249, 210,  73, // 9.Y.K......I
+ 204, 253,  79, 228, 222, 104, 220, 252,  53, 192,  87, 138, // ..O..h..5.W.
+  24,  70,  23, 198, 216, 225,  47,  52, 224, 111, 173, 104, // .F..../4.o.h
+ 128,  61, 241, 154, 244,  89,  23, 223, 144, 192,  76,  46, // .=...Y....L.
+  99, 124, 111, 199, 193, 136,  99,  40, 122,   0, 197,  25, // c|o...c(z...
+ 143, 243, 188, 148, 198, 188,  75,  37,  37, 124,  10,  22, // ......K%%|..
+  73, 151,  24, 198,  80, 109,  70, 128, 127,  80, 168, 140, // I...PmF..P..
+  11, 242, 247, 181, 132, 176,  17, 128, 133, 211,  95,  33, // .........._!
+ 234, 127, 107, 137,  26, 175, 202,  74,  23, 180,   2, 163, // ..k....J....
+ 176, 220, 218,  42, 199, 190, 137, 229, 187, 150, 175, 102, // ...*.......f
+ 146, 100, 126, 191,  32,  29,  14, 189, 165,  68, 109, 137, // .d~. ....Dm.
+  30,  85, 120, 161,  49, 115,  64,  97,  66,  93, 147,  58, // .Ux.1s@aB].:
+  16, 210,  44, 190,  27, 157,   9, 241, 162,  35,  28,  69, // ..,......#.E
+ 211,  13, 113, 129, 133, 140, 255, 215, 153, 190,  30, 101, // ..q........e
+ 225, 185, 158, 204, 167,   7, 207,  75,  12, 109, 109, 147, // .......K.mm.
+ 201, 146,  32, 203,  84,  55,  24,  62,  75, 211, 108,  60, // .. .T7.>K.l<
+  40,  82, 177,  89, 133, 177, 178, 171, 180, 143, 131, 234, // (R.Y........
+  13, 148, 118,  21, 237, 156, 107, 224, 124,   6, 180, 112, // ..v...k.|..p
+ 139, 171,  55, 247, 141,  26, 198, 144, 149, 178,  83, 156, // ..7.......S.
+  64, 170, 213, 199,  65, 213, 250,  90,  91, 147, 187, 170, // @...A..Z[...
+ 154,  79, 203,  22, 123,  89, 202, 235,  12, 236, 172, 140, // .O..{Y......
+  69,  69,  91, 254, 210, 106, 150, 157,  28, 135, 110, 119, // EE[..j....nw
+ 107,  75,  53, 202,  31,  18, 166,  13, 148, 242, 116, 105, // kK5.......ti
+ 198, 110, 145, 243, 193, 166, 106, 216, 255, 109,  11, 180, // .n....j..m..
+ 255, 235,  92,  15, 163, 176, 225,  86,  16, 244,   1, 172, // .......V....
+ 188,  61, 110, 142, 236,  32, 168, 134, 221, 116,  43, 119, // .=n.. ...t+w
+ 184,  44, 206,  82, 154,  47, 114, 200,   2, 173,  74, 170, // .,.R./r...J.
+ 114, 149,  40, 196, 136,  78, 167, 109, 205,  58,  77, 211, // r.(..N.m.:M.
+ 177, 118, 183, 205, 255,  57, 251,  67, 110, 246,  31, 234, // .v...9.Cn...
+ 121, 112, 147,   3,  65, 125, 135, 248, 146,  40, 113,  20, // yp..A}...(q.
+ 102, 161, 239, 128,  41, 116,  84, 172,  47, 116, 236, 183, // f...)tT./t..
+  21,  14,  64, 239,  43, 154,  46, 180, 244, 250,   7,  55, // ..@.+......7
+ 246,  36, 180,  83,  88,  38,  58, 156, 196, 169, 115, 178, // .$.SX&:...s.
+ 119, 113,  67, 206,  55, 148, 100, 150,  16, 211, 247,   7, // wqC.7.d.....
+ 150, 188, 217,  96, 222,  73, 222, 108, 213,  86,  21,  99, // ...`.I.l.V.c
+ 107,  95,  95, 161, 216, 196, 251, 249, 211, 111, 219,  78, // k__......o.N
+ 155, 227, 196, 249,  11,  96, 246,  27, 188, 240, 124,  75, // .....`....|K
+ 187, 107, 102, 104,  19,  28,  72, 251,  82,  21, 149,  18, // .kfh..H.R...
+  97,  24, 230,  59,  76, 234, 104,  12, 240, 240, 239, 149, // a..;L.h.....
+  64,  21,  36, 172,  29,  72, 216, 110, 213, 183, 200,  55, // @.$..H.n...7
+ 151,  20,  63,  59, 156, 169, 187, 219, 186, 216, 174,  74, // ..?;.......J
+ 103, 239, 106, 231,  23, 199, 126,  73,  51,  59, 210, 174, // g.j...~I3;..
+ 101, 112, 249, 246,  33,  89,  62,   8,  32,  97,  97, 238, // ep..!Y>. aa.
+  59,  63, 235, 120, 144, 158, 235,  21, 219, 144, 170,  38, // ;?.x.......&
+ 105,  27,  51, 162,  34, 175, 113, 107,  28, 130, 138, 205, // i.3.".qk....
+ 252,  82, 103,  36, 247,  79, 254, 227, 223, 195, 255, 248, // .Rg$.O......
+ 119, 102,  51, 136, 229,  64,  16, 213, 209,  56,  71,  25, // wf3..@...8G.
+ 141, 203,  48, 201, 137,  40, 252, 199, 191,  15, 245, 100, // ..0..(.....d
+ 144,  69, 199, 186,  65,   2, 122,  67,  19,  20,  18,  74, // .E..A.zC...J
+ 157, 142, 254, 227, 223,  41, 109, 214, 160,   9, 115,  17, // .....)m...s.
+  33,  32, 163, 178, 146, 235,  70,  74, 169, 152,  58, 114, // ! ....FJ..:r
+  69, 160,  75,  40, 146, 160,  54, 225,  53, 189,  48, 241, // E.K(..6.5.0.
+ 161, 214, 101,  44, 131,  77, 184,  18, 220,  29, 223,  48, // ..e,.M.....0
+ 202,  21, 154, 145,  52,  37,  79, 254, 227, 223, 163, 164, // ....4%O.....
+ 245, 101,  40, 119,  43,  92, 142, 237, 250, 230,  92, 215, // .e(w+.......
+  45, 143,   0, 172,  56, 252,  50, 102, 212, 102, 144, 157, // -...8.2f.f..
+  86, 119,  13, 215, 157,  66, 207, 151,  76,  50, 255, 171, // Vw...B..L2..
+ 230, 155,  33, 145,  76,  15, 182, 139,  50, 151, 225,  97, // ..!.L...2..a
+  25, 251,  95, 129, 115, 240, 225, 208,   0, 185,  44,  81, // .._.s.....,Q
+  78, 160, 220,  93,  28,   8, 198, 193,  57, 195,   4, 145, // N..]....9...
+ 180, 170, 136, 248, 145,  80,  32, 161, 245, 204,  41,  28, // .....P ...).
+  77,  56,  76, 152, 145, 198,  16,   7, 104, 167, 204, 209, // M8L.....h...
+   0,  95, 108,  72,  85, 166,  71, 134, 114, 227, 176, 157, // ._lHU.G.r...
+  20,  80,  41, 244,  29, 149, 116,  73, 156, 252, 183,  22, // .P)...tI....
+  58,  46, 210,  87,  10,  46,   2, 235, 173, 109, 132, 195, // :..W.....m..
+ 243,  40,  89, 231, 223, 134, 193, 225, 117, 252,  96,   5, // .(Y.....u.`.
+  53, 139,   9,  67, 199, 210, 103,  24, 133, 215,  14, 140, // 5..C..g.....
+ 241, 137, 170, 162,  37, 156,  69, 108,  88,  28, 101, 214, // ....%.ElX.e.
+  36,   6, 243, 171,  98,  85, 154,  48,  66,  37, 213, 214, // $...bU.0B%..
+  45, 193, 131,  78,  21, 203,   9, 207, 159,   4,  55, 139, // -..N......7.
+ 171, 147, 243, 191, 116,  57,  91,  54,  21, 190, 137, 248, // ....t9[6....
+ 223,  65, 236, 173,  70, 226,  47, 217, 238, 207, 241, 188, // .A..F./.....
+  95,  89,  29, 106, 204, 135,  76, 165,  37, 181, 125, 165, // _Y.j..L.%.}.
+ 243,  70,  95, 236,  59, 207,  52,  19,  71, 138,  74, 100, // .F_.;.4.G.Jd
+ 234,  53, 196,  50, 208,  84, 246,  13, 198, 220, 139, 224, // .5.2.T......
+  26, 164,   5,  98, 136, 125, 161,  20, 246, 207, 123,  55, // ...b.}....{7
+  49,  60, 225, 182,  82,  86,  14,  55, 250,  13, 131, 129, // 1<..RV.7....
+ 243,  27, 154,  61, 167, 225, 215, 227,  10, 230, 200, 153, // ...=........
+ 253, 147, 161,  35,  53, 201,  84, 179, 168,  79, 221, 204, // ...#5.T..O..
+  27, 240, 141, 235,  55, 108,  77,   8,  66, 200, 172,   6, // ....7lM.B...
+  59, 223, 112, 156,  50,  86, 149,  41, 184, 208, 192, 127, // ;.p.2V.)....
+ 138, 188, 242,  79, 106, 207,  63, 255,  57, 115, 238, 168, // ...Oj.?.9s..
+ 248, 118, 161, 116,  83, 242,  29, 233, 247, 174,  27, 227, // .v.tS.......
+  44,  29,  78,   7,  57,  47,  59, 105, 117, 218, 255, 231, // ,.N.9/;iu...
+  74, 182,  29, 176,  36, 167, 210, 228, 234, 168,   8,  19, // J...$.......
+  89,  45, 185,   0,  71, 109, 218, 211, 168, 218, 121,  95, // Y-..Gm....y_
+ 153, 231,  20,  90,  44,  85, 239, 254, 191,  41, 252, 191, // ...Z,U...)..
+  98,  10, 127,  43,  22, 153,  81, 121, 186, 244,  10,  21, // b..+..Qy....
+ 235, 133,  27,  30,  91, 229,  50, 141, 190, 121, 186,  78, // ....[.2..y.N
+ 203, 129,  63, 135, 131, 188, 116,  23, 173, 112, 233, 108, // ..?...t..p.l
+  10, 247, 231, 143, 203,  80, 246, 239,  13, 199, 222, 184, // .....P......
+ 170, 231, 246, 214, 213,   7, 248,  56,  12, 224,  86,  85, // .......8..VU
+   7, 230, 203, 186, 112,  42, 110,  93, 143,  87,  87, 229, // ....p*n].WW.
+ 114, 149,   6, 123, 203, 151, 240,  21,  14, 119,  17,   2, // r..{.....w..
+ 207, 163, 217,  76,  61, 171,  57,  47,  34,  60, 198,  43, // ...L=.9/"<.+
+ 238,  20,  57, 181, 173, 236,  59, 222,  65, 231, 208, 248, // ..9...;.A...
+ 189, 188,  41,  28,   5, 124,  33, 237, 237, 173, 227, 120, // ..)..|!....x
+  54, 104, 213,  41,  29, 122, 230, 198,  83,  77,  28,  20, // 6h.).z..SM..
+  48,   8,  28, 175, 167,  15, 112,  94, 109, 168,  63, 190, // 0.....p^m.?.
+ 127, 181, 155,  18,  39, 152, 192, 155,  12,  92,   1, 120, // ....'......x
+ 135, 193, 210, 152, 206,  33,  95, 111,  50,  83, 239, 173, // .....!_o2S..
+  47,  45, 118, 190,  70,  82, 110,  52, 209, 110,  28, 236, // /-v.FRn4.n..
+  84, 252,  30, 196, 114, 117, 187, 122,  25,  28,  84,  81, // T...ru.z..TQ
+ 194, 140, 171, 153, 161,  22,  85,  45,   3, 224, 136, 133, // ......U-....
+  41, 189,  12, 179, 116, 140, 155, 186, 232,  85,  14, 117, // )...t....U.u
+ 224, 197,  16, 107, 103,  18,  94, 104,  59,  87, 157,  80, // ...kg.^h;W.P
+  92, 146,  40,  39, 205,  67, 120, 144,  50, 118,  49, 112, // ..('.Cx.2v1p
+  28, 133, 109, 119, 113,  32,  53,  62, 165,  39,  60, 253, // ..mwq 5>.'<.
+ 132, 112,  44,  85,  91, 228, 231, 230,  62, 206, 158, 107, // .p,U[...>..k
+ 231, 176, 244,   0, 246, 155,  11, 240,  91,   7,  39,  47, // ........[.'/
+  91,  44, 230, 190, 197, 133,  54,  64, 212, 210, 135, 215, // [,....6@....
+  99, 248,  90, 205, 131,  53, 215,  17, 164, 117, 128,  54, // c.Z..5...u.6
+   0, 192,  65, 126, 200,   7, 246,  95,   1,  25, 111, 102, // ..A~..._..of
+ 184,  55,  94, 221, 192, 147,  26, 243, 241, 126,   5, 123, // .7^......~.{
+  19, 239, 166, 112, 137, 162,  15, 113,  55,   2, 174,  24, // ...p...q7...
+   0, 190, 229, 124, 175, 252,  97, 144, 168, 120, 109, 109, // ...|..a..xmm
+ 166, 248,  46, 159, 197, 252, 177, 119,  99,  46, 246, 145, // .......wc...
+ 252, 148, 243,   0,  87,  53, 141, 167, 199, 113,  52,  57, // ....W5...q49
+ 157,  75,  74, 171,  13, 238, 149,  54,  41, 123, 181, 187, // .KJ....6){..
+ 231,  18, 190,  76, 193, 141, 249,  86, 145, 159, 237, 104, // ...L...V...h
+  23,  72, 196,  54,  39, 253, 214,  52, 234, 183,  96, 182, // .H.6'..4..`.
+ 192, 123, 133, 132, 125, 230,  76, 186,  99,  97, 178, 224, // .{..}.L.ca..
+  50,  74, 183,  76,  18, 197, 142, 181, 102, 234, 227,  29, // 2J.L....f...
+ 206, 220, 225, 194,  44, 136, 171, 245, 112,  29, 236, 102, // ....,...p..f
+  45, 171,  71,  24, 194,   3, 119,   9, 149,  62, 164, 163, // -.G...w..>..
+  70, 213,  25,  91,  94, 184, 112, 170, 134, 166, 158, 103, // F..[^.p....g
+  29, 209, 165,  12,   6,   0, 163, 199,  55, 152,   1, 240, // ........7...
+ 177,  56,  58, 140, 106, 110, 221,  18, 207, 250,   6, 251, // .8:.jn......
+ 163, 217, 188, 119, 163, 103,  88, 128, 145, 124, 214, 251, // ...w.gX..|..
+ 195, 227, 155,  77,  92, 231, 247, 164, 209,  40, 188, 191, // ...M.....(..
+  52, 224, 148, 132, 200, 229,  64,  19, 229, 169, 111, 174, // 4.....@...o.
+  18,  11, 185,  70, 137, 231,  66,  57, 247,  90, 132,  24, // ...F..B9.Z..
+ 199, 155, 245,  48,  76,  97, 224,  70, 174, 243, 240, 227, // ...0La.F....
+  15, 225, 119, 142, 167, 190, 246,  42,  30, 187,  62, 137, // ..w....*..>.
+ 251,  54, 241,  21, 197,  94, 129, 174, 114, 120, 113, 123, // .6...^..rxq{
+  81, 243, 153, 105,  92, 178,  50,  36,  65, 156, 101,  50, // Q..i..2$A.e2
+  16,   4, 172, 235, 142,  41,  92, 250,  35,  12,  19,  59, // .....)..#..;
+  91, 112, 129, 114,  87, 178, 210, 247, 199, 124, 204, 188, // [p.rW....|..
+ 115, 148, 145, 134, 171,  30,  39,  28,  71, 235,  82,  57, // s.....'.G.R9
+  17,  46, 130,  68, 194, 145,   5, 181, 203,  52, 230, 174, // ...D.....4..
+ 203,  55, 243,  44, 107, 241, 125, 120, 233,  33, 132, 122, // .7.,k.}x.!.z
+  19, 220, 117,  59, 184,  65, 154,  22,  85, 212, 111, 209, // ..u;.A..U.o.
+ 156,  52, 184, 148,  74,  48,  79, 129,   5, 111,  69,  38, // .4..J0O..oE&
+ 210,  91,  93,  93, 240,  67, 152,  16, 234, 152, 104,  80, // .[]].C....hP
+ 117,  93, 187, 160,  66,  63, 206, 170,  30, 215,  12, 237, // u]..B?......
+ 200, 128,  93, 197,  61,  26, 152, 102,  57, 220, 173,  64, // ..].=..f9..@
+  15,  49, 249,  57, 202,   9,   8, 211, 232, 200, 193, 253, // .1.9........
+ 202, 182,  96,  66,  66, 190, 186, 100,  38, 238, 145, 106, // ..`BB..d&..j
+ 183, 199, 153,  52, 180, 112, 101,  94, 254, 197,  82, 114, // ...4.pe^..Rr
+  92,  83, 146, 227,   2,  20, 147, 229, 166, 213, 106, 153, // .S........j.
+ 247,  89, 229,  30, 188, 183, 149,  11,  88, 170, 192,  98, // .Y......X..b
+  54, 171,  95, 204,  57, 226, 167,  88,  37, 215, 239, 183, // 6._.9..X%...
+  85,  92,  77,   9,  24, 222, 233,   4,  49,  49, 228,  35, // U.M.....11.#
+  53, 211,  98, 197, 162,  14, 168,  58, 238, 139, 208, 225, // 5.b....:....
+ 249, 219, 177,  78,  86,  87, 153, 206, 107,   7,  30, 125, // ...NVW..k..}
+ 169,  19,  14, 124, 114, 209,  71,  76,  80, 102, 138,  75, // ...|r.GLPf.K
+ 116,  38, 196, 224, 204, 133,  13, 136,  89,  73, 207, 171, // t&......YI..
+ 129,  12,   2, 254,  84,  43, 218, 182,  30, 158,  78, 208, // ....T+....N.
+  35,  90,   0, 112, 185,  86,  11, 154, 142,  35, 219,  29, // #Z.p.V...#..
+ 239, 177,  92,  46, 152,   6,  85,  36,  51, 140,   7,  65, // ......U$3..A
+ 168, 159,  91, 116, 253,   3, 232,  10, 127, 151, 127,  24, // ..[t........
+ 100, 101, 255, 226, 159,  38,  88, 206,  77,   8,  45, 135, // de...&X.M.-.
+ 111, 112, 205,  44, 238, 224, 108,  25, 127,  84, 193, 142, // op.,..l..T..
+ 225,  94, 208,   2, 215, 121, 149,  80,  45, 196,  31, 124, // .^...y.P-..|
+ 191, 255, 246,  77, 131, 251, 137, 196, 236, 228, 232, 189, // ...M........
+ 219, 217, 106, 175, 209, 255, 251, 236, 139,  42,  11,   9, // ..j......*..
+  86, 231, 110, 121, 105, 144,  89, 116,  91, 124, 255, 160, // V.nyi.Yt[|..
+ 165,  72,  41,  95, 138,  85, 122, 141, 252, 213, 189,  33, // .H)_.Uz....!
+ 202,  75, 115, 127,   4, 255,  60,  55,  21,  87,  67, 226, // .Ks...<7.WC.
+ 194, 230, 111, 112,  97,  99, 125, 174,  88, 141,  56, 204, // ..opac}.X.8.
+ 223,  74, 249, 248, 225, 214,  63, 122, 229, 254, 108, 109, // .J....?z..lm
+  35, 173, 182, 163, 116, 167, 154, 197,  30, 126, 112, 172, // #...t....~p.
+ 103, 156,  75,  26,  92,  90,  31, 179,  51, 113,  45,   3, // g.K..Z..3q-.
+ 191, 171,  59, 227, 244,  82, 227,  88, 214, 241, 117, 227, // ..;..R.X..u.
+ 113, 216,  32,  84,  62, 209, 121, 224,  28,  29, 199,  97, // q. T>.y....a
+ 114, 230,  52,  78, 225,  96, 135, 125, 212,  76, 252, 245, // r.4N.`.}.L..
+ 245, 243,  52,  57,  73,  83, 234, 250, 229, 164, 112,  47, // ..49IS....p/
+  51, 127, 248, 158, 247,  89, 156, 157,  61, 147,  20,  78, // 3....Y..=..N
+ 115,  30, 175, 135, 240, 227,   2, 239,  57,   5, 124, 190, // s.......9.|.
+  99, 248, 188,   3, 155, 172, 149, 133,  84, 174,  96,  69, // c.......T.`E
+  49, 241, 227, 187,  33, 102, 122,  98, 148, 224, 210, 143, // 1...!fzb....
+ 197, 240, 114,  15, 157,  83,  52,  32, 168, 245, 197, 203, // ..r..S4 ....
+ 164, 185,  60, 180,  58,  31, 170, 149,  52, 248,  15,  23, // ..<.:...4...
+  73, 139,  22, 223,  65, 122, 239,  70, 252,  13,  86, 185, // I...Az.F..V.
+ 191, 160, 206,  11, 218,  85, 102, 253, 247, 126, 235, 254, // .....Uf..~..
+ 186,  34,  94,  80, 213,  18, 172,   5, 127, 244, 199,   1, // ."^P........
+  28, 179, 254,  97, 137,  40, 110, 100,  50, 181,  85, 124, // ...a.(nd2.U|
+  23, 213,  54, 247, 239, 217,  37,   2,  94, 201, 157, 165, // ..6...%.^...
+  91, 233, 112, 176,  58,  51, 125, 228, 134, 195,  25,  82, // [.p.:3}....R
+   3,  34,  25, 213,  22, 243,  78, 224, 172, 177,  94, 198, // ."....N...^.
+  83, 145, 185, 107, 149,  56, 113, 139, 181,  44,  51, 154, // S..k.8q..,3.
+  40, 127,  48, 224,  91, 247, 110, 210,  89, 235, 195, 171, // (.0.[.n.Y...
+  15, 175, 159, 255, 225, 217, 214, 201, 192, 241,  39,  94, // ..........'^
+  45, 192, 173, 187, 160,  66, 190,  34, 121, 108, 199,  36, // -....B."yl.$
+ 160, 217,  89, 153, 196,  73, 122, 121,  78,  28, 130,  47, // ..Y..IzyN../
+  96, 246, 220,  95, 169, 172,  57, 108, 248, 169,  50,  91, // `.._..9l..2[
+ 212,  52, 194,  57,  97,  66,   6,  10, 122,  73, 235,  93, // .4.9aB..zI.]
+ 254, 148, 150, 209, 215,  36,  97, 239, 147, 132, 141, 229, // .....$a.....
+ 203, 143, 107,  81,  47,  66,  98,  27, 135, 126,  82,  32, // ..kQ/Bb..~R 
+  77,  67, 227,  62,  28, 219,   0, 187, 155,  10,  49, 194, // MC.>......1.
+   4,   2, 159, 133,  16, 245, 159, 248, 239, 104,  93,   3, // .........h].
+ 247, 203, 137, 112,  67, 101, 113, 211, 102, 101,  58, 255, // ...pCeq.fe:.
+  80, 109,  32, 189, 237, 211,  96,  60,  13, 179, 191, 222, // Pm ...`<....
+  72, 219, 187,  84,  25, 209, 238, 103, 217, 198, 121, 175, // H..T...g..y.
+  71, 126, 182,  20, 237,  11, 124,  52,  40,  98,  91, 106, // G~....|4(b[j
+   7, 149, 134, 252, 116, 214, 224, 145,  12,  28, 167, 129, // ....t.......
+  33,  15, 156, 115, 157,  76, 157,  57,  12,  54,  99,  18, // !..s.L.9.6c.
+ 172, 152, 151,  10,  98, 220,  53, 162,  95,  49, 243, 161, // ....b.5._1..
+  68,  75, 247, 179, 235,   8, 249,  83,  21, 207,  13,  20, // DK.....S....
+   3, 176, 111, 149,  96, 129,  74,   0, 252, 171, 132, 138, // ..o.`.J.....
+ 119, 175, 172,  12,  42,  27, 188,  78,  45, 150, 143, 210, // w...*..N-...
+  45, 215, 247, 129, 123,  99, 186,  76, 163, 148,  38, 236, // -...{c.L..&.
+ 235, 146,  77,  43,  65,  88,  72,   6, 167,  33,  65,  31, // ..M+AXH..!A.
+ 129,  42,  66,   2, 216, 139, 233, 147, 225, 240, 231, 104, // .*B........h
+  72, 100, 239,  89,  20,  18,  82, 208, 208,  68,   9,  45, // Hd.Y..R..D.-
+ 180, 112, 248, 150,  90, 115,  20,  26, 155, 194,  37, 111, // .p..Zs....%o
+ 193, 208, 125, 242, 122, 203, 169, 212, 223, 172, 195,  49, // ..}.z......1
+ 154, 241, 236,  75,  12, 167, 158, 138, 177, 208, 242,  89, // ...K.......Y
+ 180,  46, 192,  98, 246, 183, 130,   4, 148, 222,  62, 230, // ...b......>.
+ 188, 127, 192,  33,  25,  86, 170,  38, 250, 130, 233,  61, // ...!.V.&...=
+ 251,  91,  65, 198, 237, 224,  57,  59, 207, 145, 169,  81, // .[A...9;...Q
+ 100, 226,  25,  41,  32,  82, 127, 206, 187, 108, 191,  25, // d..) R...l..
+  16, 100, 160,  41, 136,  11, 221,  20,  73, 240,   6, 130, // .d.)....I...
+ 105,  13, 130, 153,  69, 220, 168, 160, 214,  19,  37, 110, // i...E.....%n
+  70, 128, 186,  83, 243, 254, 138,  55,  34,   7, 240, 123, // F..S...7"..{
+  60, 154,  17, 127,  52,  14,  52,  95, 235, 212, 239, 235, // <...4.4_....
+   3, 167, 104, 188,   3, 215, 185, 147, 165, 235, 188,  58, // ..h........:
+  13,  42,  66,  92, 174,  78, 130, 149, 211, 213,  85,  66, // .*B..N....UB
+  89, 209,  81, 244, 237,  21, 106, 231, 184, 190,  67,  36, // Y.Q...j...C$
+  90, 146, 240, 127, 115, 105, 132, 189, 126, 222, 202, 195, // Z...si..~...
+  19,   8,  67, 209, 133, 227, 195, 239, 187, 161, 116, 239, // ..C.......t.
+ 195,  75,  63, 111,  21, 239,   6,  11,  98, 241,  44,  42, // .K?o....b.,*
+  93, 247,  19, 243, 117,  87, 247, 113, 211, 239,  88,  13, // ]...uW.q..X.
+  97,  73, 158,  81, 112, 124, 189,  15, 151, 128,   4,  97, // aI.Qp|.....a
+ 220, 244, 232, 159, 246, 111, 142, 142, 128,   1,  69,  61, // .....o....E=
+ 212, 140, 255, 248, 119, 103,  38, 142,  70, 169,  89,  62, // ....wg&.F.Y>
+  55,  78,   0,  99,  57,   9, 220,  64, 114,  81, 131,  75, // 7N.c9..@rQ.K
+  48, 182, 142, 238,  60, 247, 132, 250,  61, 236, 127, 239, // 0...<...=...
+ 195,  21, 126, 217, 127,  94, 196, 204, 213, 114, 154, 125, // ..~..^...r.}
+ 225, 255, 113, 239, 102,  60, 107,  49,  71, 132,  75, 135, // ..q.f<k1G.K.
+ 212,   0, 140,  72, 201,  90, 254, 226, 222, 160, 122, 173, // ...H.Z....z.
+  42, 176, 176, 211, 193, 118,  22, 163, 126,  28,  79,  51, // *....v..~.O3
+ 234, 245,  93,  61, 204,  12, 212,  34, 139,   8,  19, 244, // ..]=..."....
+ 101, 106, 164, 243, 193, 130, 115, 107, 220, 187,  53,  90, // ej....sk..5Z
+   8, 205,  61, 117,  35, 142,  10, 141,  43,  75,  98, 166, // ..=u#...+Kb.
+ 198, 254, 248, 235, 147, 203, 115, 181,  25,  88,  85, 206, // ......s..XU.
+ 113, 227, 132, 118,  96,  68, 133, 130, 129,  54,  70,  45, // q..v`D...6F-
+  31, 152, 153, 233, 205, 123, 132, 196,   8,  17, 203, 234, // .....{......
+ 218, 139,  77,  12,  51, 124, 130,  27, 156,  99, 109,  20, // ..M.3|...cm.
+  67, 196,  94, 207, 249, 252, 229,  67,   4, 200, 100,  92, // C.^....C..d.
+  95, 192, 231, 165, 241, 248,  10,  33,  23, 238, 204, 197, // _......!....
+ 135, 226, 147,  56, 230, 180,  19, 151,   3, 137, 131, 147, // ...8........
+ 172, 124,  67, 117, 210, 111, 209, 160, 225,  74, 237, 145, // .|Cu.o...J..
+  33, 199,  52,   3,  45,  97, 110, 207, 236,  56, 160, 107, // !.4.-an..8.k
+  69, 112,  71, 165, 200, 229,  33, 150, 208,  16, 186,  25, // EpG...!.....
+  78, 224,  58, 207,  89, 127,  23,  80, 151,  41,  28,  23, // N.:.Y..P.)..
+ 202,  77,   6, 225,  88, 219,   0, 112, 225, 149,  66, 104, // .M..X..p..Bh
+  38, 102,  26, 254,  29, 159, 137,  34, 192,  45,   4, 197, // &f.....".-..
+ 122, 215, 151, 244, 195,  86,  61,  29, 115, 197,  99, 226, // z....V=.s.c.
+ 162, 236,  44,  85, 115, 224, 174, 122, 194, 245, 102, 119, // ..,Us..z..fw
+ 162, 147, 105,  87,  49, 109,  12,  52, 102, 132, 103, 102, // ..iW1m.4f.gf
+  97,   4, 146, 193, 218, 198,  38, 165,  73, 116,  44, 118, // a.....&.It,v
+  14,  54, 111, 199, 120, 241, 101, 188, 164,  89,  16,  49, // .6o.x.e..Y.1
+ 173, 173, 216,   7, 222, 179,  48, 236, 139,  87,  99, 223, // ......0..Wc.
+ 153,  18, 101, 207,  41, 205,  31,   6, 121, 203,  21, 254, // ..e.)...y...
+ 199, 242, 186, 228,  62, 203,  48,  43, 129,  17, 118,  42, // ....>.0+..v*
+ 110, 134, 173,   4, 154,  23, 202,  11, 155,  58,   8,  68, // n........:.D
+  90, 234, 107,  35, 173, 249, 186,  16, 219,  32,   0, 214, // Z.k#..... ..
+ 244,  60, 114,   5,  57, 161,  70, 158, 103, 209,  49, 124, // .<r.9.F.g.1|
+ 208, 226,  62, 136,  63,  72, 120, 228,  89,  76, 145, 229, // ..>.?Hx.YL..
+ 141, 163, 115, 226,  39,  73, 184, 249, 227, 178, 104,  35, // ..s.'I....h#
+ 233, 230, 114, 127, 170, 244, 161, 188,  87, 180, 184,  68, // ..r.....W..D
+ 149,  17,  93,   7,  53,  45, 173,  97, 130,  35, 171,  83, // ..].5-.a.#.S
+  98, 129,  19, 130, 121,  24, 228, 203,  69, 176,  62,  33, // b...y...E.>!
+ 209, 193,  68,  77,  15,   3, 220, 215, 172,  71,   0, 183, // ..DM.....G..
+  87, 106, 118,  85,  23, 126, 234, 163, 131, 137, 200, 247, // WjvU.~......
+ 163,  96,  96, 154,  73, 171,  64,  33,  55,  14,  24,  90, // .``.I.@!7..Z
+  36, 105, 150, 203,  26, 200, 247, 162, 147, 248,  81,  33, // $i........Q!
+ 111, 141, 137,  14, 134, 236, 218, 246,  96, 116, 208,  62, // o.......`t.>
+  60, 244, 212, 184,  63,  18,  58,  40, 253, 224,  75, 146, // <...?.:(..K.
+ 164,  99, 220,  46, 190,  74, 165,  18, 152, 242, 221,  84, // .c...J.....T
+  36, 214, 204, 247,  31, 250, 157, 136, 169,   0, 188, 245, // $...........
+ 206, 195, 225, 248, 139, 112, 184,  84, 123,  95, 128, 195, // .....p.T{_..
+  89, 112, 217, 151, 107, 216, 221, 245, 127, 115, 127, 223, // Yp..k....s..
+  95, 243, 126,  63, 144, 199, 225, 189, 117, 175, 119,   6, // _.~?....u.w.
+  45,  79, 112,   6, 173,  46,  87, 255,  58,  24,  28,  92, // -Op...W.:...
+  30, 170, 123, 193, 235,  18, 105,   4,  29, 246, 102, 127, // ..{...i...f.
+  28, 226, 146, 142, 126, 191,  18, 181, 119, 216, 123,  93, // ....~...w.{]
+ 160, 157,  64, 118, 117, 245,  50,   8,  82,  42, 150, 138, // ..@vu.2.R*..
+ 118,  34,  90,  19, 207,  14, 186, 135, 244, 153,   5, 107, // v"Z........k
+ 120, 243, 168,  12, 183,  86, 124, 118,  88, 171, 195, 171, // x....V|vX...
+  85, 192, 145, 123, 166, 113, 159, 145, 173,  68,  85, 142, // U..{.q...DU.
+   1, 128, 108,  27,  42,  19, 101, 143,  22, 180, 253, 178, // ..l.*.e.....
+ 150, 254, 129,  41, 226,  57,  65, 106, 201,  94, 129, 189, // ...).9Aj.^..
+ 240, 142, 128,  29,   5,  55, 124, 171,  66,  71, 113,  89, // .....7|.BGqY
+ 244, 100, 213, 135, 223, 153, 211, 142, 102, 173, 163,  79, // .d......f..O
+  19, 232, 199, 131,  84,  65,  91,  72, 179,  50,  72,  60, // ....TA[H.2H<
+ 194, 122, 220, 121, 123, 160,  69, 253, 128, 132,  17, 193, // .z.y{.E.....
+ 129,  91, 193, 124,   4, 174, 124, 128, 135, 107, 163, 209, // .[.|..|..k..
+  40,  82, 218, 105,  12,  53,  64, 139, 111, 219, 112, 249, // (R.i.5@.o.p.
+  85,  60,  97,  71, 163, 107,  41,  84, 214,  23, 175, 222, // U<aG.k)T....
+  20, 226, 246,  24, 124,  90, 102,  44, 110, 137, 102, 213, // ....|Zf,n.f.
+ 229,  65,  17, 140, 107,  38,  56,  72,  38, 113,  38,  74, // .A..k&8H&q&J
+  37,  91, 158, 113,  83, 126, 119, 213, 186, 212,  57, 216, // %[.qS~w...9.
+ 125,  13, 241, 148, 164, 170, 122,  30,  93, 187, 236, 130, // }.....z.]...
+ 208, 145,   6,  95, 215,  55,  32, 128, 231, 177, 220, 158, // ..._.7 .....
+ 216, 179, 116, 155, 128,  64,  45,  14,  15, 254,   0, 201, // ..t..@-.....
+  33, 166, 224, 143,  67, 190, 254, 214,  83,  33, 148,  86, // !...C...S!.V
+ 184, 255,  27, 247, 240,  38, 124, 211,  12,  52,  16,  29, // .....&|..4..
+  37, 247, 104, 208, 203,  49,  73,  32,  58,  76, 112, 125, // %.h..1I :Lp}
+ 204, 130, 203, 240, 184,  31,  87, 164,  97,  18,  60,  90, // ......W.a.<Z
+ 107, 125, 111, 182, 126, 162, 204, 245,  14,  70, 240, 134, // k}o.~....F..
+  71, 244, 116, 233, 181,  36, 185,  29, 224, 158, 233, 115, // G.t..$.....s
+  25, 128,  76,  47, 108,  22,  98,  38, 188, 210, 215, 120, // ..L/l.b&...x
+  76, 172, 175, 185, 139, 215, 192, 102, 148, 105, 253,  89, // L......f.i.Y
+ 187, 236,  40, 124,  78, 137,  44, 154,  98,  85, 170, 137, // ..(|N.,.bU..
+ 139,  66, 225,  89, 249,  15, 108,  91, 194, 188,  53,  26, // .B.Y..l[..5.
+ 228,  14, 159,  22, 131,  37,  62,  36, 147,  89,  35, 104, // .....%>$.Y#h
+  92, 245, 248, 150, 149,  94, 195, 100, 197,  56, 247, 254, // .....^.d.8..
+ 240, 168, 216,  25,  45, 138, 153, 109,  82,  14, 245,  46, // ....-..mR...
+ 143,  21,  86, 117,  67, 103,   5,  66,  41,  43, 249, 109, // ..VuCg.B)+.m
+ 213,  17, 139, 165,  54, 165, 167, 162, 126, 138, 139,  90, // ....6...~..Z
+ 125,  48,  11,  42, 156,  17, 100,   6, 124, 225,  94,  77, // }0.*..d.|.^M
+ 241,  47, 240,  96, 178, 227, 181, 136, 127, 199, 155, 122, // ./.`.......z
+   2, 198, 167, 162, 144, 143,   2,  98, 217,   2, 247, 245, // .......b....
+ 220, 250, 100,  39, 167,  95, 153, 238, 145, 172,  79, 106, // ..d'._....Oj
+  62, 241, 237, 237,  60, 153,  33,  50,  93, 208,  12, 234, // >...<.!2]...
+ 198, 132,  80, 232, 201,  90, 224,  52, 196, 179, 151, 227, // ..P..Z.4....
+ 217, 237,  36, 112,  32,  66, 232,  87, 150,  13,  50, 173, // ..$p B.W..2.
+  77, 236,  61, 252, 226,  60,  74, 202, 231, 154, 188, 236, // M.=..<J.....
+ 172,   1,  51,  41,  17, 113, 144,  38,  85, 120,  85,  62, // ..3).q.&UxU>
+ 215, 228, 229, 113, 153, 138,  17,  67,  82, 102, 180,  60, // ...q...CRf.<
+  83, 154,  21, 108, 142, 189, 215,  39, 207, 175, 198, 174, // S..l...'....
+  13, 245, 136,  51, 153, 228, 236,   5,  95, 178,  85,  60, // ...3...._.U<
+ 213, 219, 139, 124, 202,  13, 196, 214, 197, 136,  36, 118, // ...|......$v
+  21, 139, 214,   0, 239,  60,  60,  49,  70, 100, 223,  43, // .....<<1Fd.+
+ 186, 141, 113, 115, 132, 198, 189,  11, 136, 183,  75,  19, // ..qs......K.
+  97, 164, 250, 118, 219,   6,  46, 213, 211,  49, 184, 220, // a..v.....1..
+ 240,  36,  52, 172, 229,  18,  70, 172, 154, 181,   5, 213, // .$4...F.....
+ 165, 103,  36, 135, 167,  82,  42, 123, 178, 234, 235, 191, // .g$..R*{....
+  88, 160, 228, 106, 129, 243, 148, 210, 158, 213,  22, 185, // X..j........
+  47, 105, 151,  95,  22, 106, 130, 121, 197,  45, 161, 196, // /i._.j.y.-..
+ 101,  70, 163,  45, 170,  91, 248, 195, 127,  28,  60,  83, // eF.-.[....<S
+ 191,  17, 120,   2, 140, 186, 245,  80,   3, 233,  44, 155, // ..x....P..,.
+  10,  47,  90, 134, 173, 188, 188, 189,  61, 134, 158, 185, // ./Z.....=...
+ 220,  70, 172, 160, 202, 143, 238, 107,  92, 114, 246, 170, // .F.....k.r..
+  38, 167, 130, 195, 167,  44, 110, 185, 218, 220, 133, 155, // &....,n.....
+ 246, 110, 130, 247, 238,  22, 206, 247,  10, 170,  45,  67, // .n........-C
+ 191,  10,  43, 150,  48,  43, 230,  65,  85,  29, 228, 197, // ..+.0+.AU...
+ 138, 152,  16, 237, 238, 247, 241, 157, 144, 168, 106, 232, // ..........j.
+  80,  45, 214, 206, 223, 152, 183,  46,  22,  87, 227, 149, // P-.......W..
+   5, 158,  49,  91,  96, 113, 236,  12,  44,  26,  94, 213, // ..1[`q..,.^.
+  44, 151, 211, 179,  34, 241, 185,  55,  52, 200, 217,  53, // ,..."..74..5
+   9, 115, 194,   9, 227,  74, 231,  10, 245,   7, 252, 180, // .s...J......
+ 236, 146, 122, 158, 189, 207, 168, 166,  53, 215,  51, 168, // ..z.....5.3.
+ 206,  37,   9, 137, 139,  55, 231,  58,  63,  77, 135, 190, // .%...7.:?M..
+  51,  78,  39, 112,  85, 155,  14, 175, 253, 185,  69, 136, // 3N'pU.....E.
+  91,  82, 174, 254,  68, 136, 184,   9,  30,  95,  69, 137, // [R..D...._E.
+  11,  62, 169, 177, 196, 173, 213,  43, 249, 170, 106, 158, // .>.....+..j.
+ 249,  84, 175, 103, 182,  28, 191, 133,  70, 101, 184,  68, // .T.g....Fe.D
+ 125, 190,  49,   9,  46, 254,  43, 107, 181, 131, 178,  56, // }.1...+k...8
+  28, 110, 180,  22, 252, 177,  14,  93, 210,  31,  36, 121, // .n.....]..$y
+ 113,  99, 163, 111, 233, 125,  74, 221, 252, 122,  87, 192, // qc.o.}J..zW.
+ 112, 206, 106,  59, 170, 246, 106,   0, 231, 105,  56, 137, // p.j;..j..i8.
+   6,  13, 103, 237,  56,  79,  67, 183,  50, 168, 214, 114, // ..g.8OC.2..r
+ 134,  13,   7, 214,  72,  50,  89, 171,  68,  90, 131,  59, // ....H2Y.DZ.;
+ 142,  44,  86, 169, 227, 126, 125, 191,  14, 182, 111,  55, // .,V..~}...o7
+ 167,  58,  28, 234, 108, 226, 223,  60, 153,  82,  95, 178, // .:..l..<.R_.
+ 232, 179, 104, 225, 245, 204, 182,  59, 145, 137,  91,  25, // ..h....;..[.
+ 170, 178, 141, 139,  53,  98, 158,  89,  15, 253,  38,  40, // ....5b.Y..&(
+ 128,  54, 123, 177, 225, 149, 148,  54,   8,  41, 103, 184, // .6{....6.)g.
+ 196,  16, 211, 111, 166,  62, 205,  79,  99, 115, 133, 192, // ...o.>.Ocs..
+ 254, 234,  42, 205, 231, 215, 244, 207, 202, 237, 181,  25, // ..*.........
+ 196,  40, 224, 153, 184,  10, 135,  26, 104,  69, 209, 129, // .(......hE..
+ 141, 216,  59,  44, 136, 245,  98, 218, 158, 189, 210, 100, // ..;,..b....d
+ 129,  70,  24,  29, 193, 235,  10,  94, 177, 104, 150,  47, // .F.....^.h./
+ 214, 148,  87, 235, 168, 198,  11,  55,  87,  54,  36,  32, // ..W....7W6$ 
+ 214, 164, 178, 189, 103, 213, 171, 132,  17,  47,   2, 176, // ....g..../..
+  95, 180,  38,  98,  69, 252, 108, 200, 156,  91, 185,  23, // _.&bE.l..[..
+  46, 247,  64,  64, 149,  51,  76, 167,  68,  32, 151,  36, // ..@@.3L.D .$
+ 122,  17, 167,  97, 145, 236,  19, 235,  25, 120, 235,  21, // z..a.....x..
+   4,  20,  43,  30, 241, 123, 171, 171, 175, 220,  75, 130, // ..+..{....K.
+ 247, 175,  65, 109, 115, 131,  53, 111,  89, 120,  62,  33, // ..Ams.5oYx>!
+  44, 242,  61,   7, 100, 202,  25, 179, 121,  70, 128, 235, // ,.=.d...yF..
+ 161, 137,  83,  36,  38, 110,  34, 155, 125, 246, 130,  26, // ..S$&n".}...
+  93, 229,  70,  83, 175, 199,  11, 203, 100,   2, 203, 138, // ].FS....d...
+  34,  43,  24, 170,   5,  70, 117, 113,  45, 181, 216, 106, // "+...Fuq-..j
+ 102, 103, 124,   7, 181,  73,  43, 243, 235,  45, 228, 234, // fg|..I+..-..
+   2, 125, 138,  27, 124, 111, 160, 122,  43, 117,  85, 239, // .}..|o.z+uU.
+ 106, 138, 185, 167, 133,  50, 237, 152, 214, 166, 159, 234, // j....2......
+ 202, 180, 216,  83,  79,   8, 148,  63,  89, 190,  40, 120, // ...SO..?Y.(x
+ 226, 169, 231,  18,  64, 157, 122, 238, 169, 223, 248, 195, // ....@.z.....
+  46,  79, 193, 111, 128, 174, 169, 135,  99, 172, 210, 182, // .O.o....c...
+   8,  69,   2,  99, 211, 200,   9, 204, 123,  80, 132, 210, // .E.c....{P..
+  88,  18,  11, 195,   6,  40, 156, 128,  62,  40, 146, 126, // X....(..>(.~
+  17,  17,  94,  85,  34, 194,  43,  68, 132,  87,  30, 152, // ..^U".+D.W..
+ 104,  61,  46,  99, 240,  21, 104, 126, 120,  21,   6, 219, // h=.c..h~x...
+  98, 198, 103, 190,   0, 155, 175,  23, 230,  82,  68,   5, // b.g......RD.
+  16,  72,  48,  46,  47,  52, 252, 138, 112,  76, 147,  19, // .H0./4..pL..
+  78,  71, 140,  74,  32, 159,  94,  97, 233,  83,  46, 188, // NG.J .^a.S..
+ 238, 119,  65, 161, 116,  84,  64, 225, 159,   0, 237,  83, // .wA.tT@....S
+ 168, 110, 252, 119,   4,  86, 168, 205,  94, 184,  43, 251, // .n.w.V..^.+.
+ 158, 167, 132,  46, 239,  43, 177, 154, 172, 155, 163, 240, // .....+......
+ 122,  62, 161, 117, 193, 216,  24,  45, 173,  96, 106,  42, // z>.u...-.`j*
+   0, 193, 240,  53, 239,  80,  17, 187,  10,  51, 121,  71, // ...5.P...3yG
+ 114, 178,  89, 210, 210, 172,  87,  38, 171,  88, 215, 105, // r.Y...W&.X.i
+  57,  23, 198, 153,  10, 203, 163, 165, 249, 142,  76, 190, // 9.........L.
+ 122, 219, 137,  91, 230,  35, 112, 184,  72, 133,  71,  72, // z..[.#p.H.GH
+  46,  83,   1,  72, 185,  76,  49,  93,  90,  90, 224, 174, // .S.H.L1]ZZ..
+  41,  80, 110, 253, 115, 235,  38,  58,  63, 243,  39, 223, // )Pn.s.&:?.'.
+  74, 190, 212, 134,  38,  13, 106,  22,  63, 115, 214,  50, // J...&.j.?s.2
+ 241,  82, 107, 153, 196,  43, 238, 203,  75, 216,  90,   6, // .Rk..+..K.Z.
+ 146, 102,  15,  12, 112, 202,  50, 101, 113, 187,  37,  77, // .f..p.2eq.%M
+  39, 247,   3, 170, 103,  97, 122, 191, 188, 162, 112, 142, // '...gaz...p.
+ 190,  22, 183,  20, 242, 245,  75, 145,  29,  54,  49, 219, // ......K..61.
+  90, 218, 231, 139, 191,  10,  68,   5, 247,  49, 168, 128, // Z.....D..1..
+ 159,  10, 183,  68, 227, 139, 159, 146, 251, 232, 115, 154, // ...D......s.
+ 232, 137,  45,  67, 190,   4,   7, 230, 100, 136,  74,  51, // ..-C....d.J3
+ 168, 104,  98, 112,  35, 232, 247, 250,  99, 127,  52, 215, // .hbp#...c.4.
+ 168,   2, 107,  53,  16, 150, 178, 139,  74,  82, 150,  25, // ..k5....JR..
+ 138,  21,  43, 119, 138, 252, 180,  36, 210, 170,  86, 171, // ..+w...$..V.
+ 171,  86, 101, 201, 186, 189,  93, 194, 102, 215,  53, 176, // .Ve...].f.5.
+ 152, 114,  82, 106,   1, 237, 194, 118,  30,  54, 136, 139, // .rRj...v.6..
+ 249,  63, 178, 110, 149, 205,  46, 181, 248,  66, 166, 201, // .?.n.....B..
+ 192, 187,  26,  12,   8,  99, 127, 183,  20,  18,  67, 211, // .....c....C.
+ 119,  75, 189, 252, 223, 190, 220, 193, 101,  67,   4,  26, // wK......eC..
+ 227,  11, 169, 249,  54,  24, 114, 171,  10,   3, 193, 165, // ....6.r.....
+ 237,  58, 159,  31, 147, 121,  76, 251, 134,  26, 150, 138, // .:...yL.....
+   7, 149,  58,  78,  45,  37, 128, 181, 176,  16,  17, 115, // ..:N-%.....s
+  98,  64, 203, 158, 118, 185,  90,  24, 242, 133,  37,  82, // b@..v.Z...%R
+ 202, 174,  90,  32, 254,  23,  21, 206, 163, 104, 202,  46, // ..Z .....h..
+ 237,  25, 255, 139,  10,  95, 194, 246,  85,  89,  59, 108, // ....._..UY;l
+ 107,  20, 171, 166, 180,  34, 180,  55, 197, 253, 167, 235, // k....".7....
+ 167, 176,  44,  58,  33, 233, 229,  40,  77, 142, 152,   3, // ..,:!..(M...
+  56,  10, 147, 225, 145,  97,  29, 228,  58, 115, 180, 241, // 8....a..:s..
+  87, 247,  82,  57, 156, 141, 248,  85, 187,  62, 203,  62, // W.R9...U.>.>
+ 197, 151,  75, 144, 204, 162, 181,  53,  44, 134, 185, 155, // ..K....5,...
+ 207,  20, 130,  29, 135, 191,  80, 132, 101, 106, 164,  16, // ......P.ej..
+  64, 195, 101, 227,  84,  11,  11, 226, 123, 140,  41, 106, // @.e.T...{.)j
+  37, 132, 205,  78, 237, 183,  87,   3, 215, 245,  87, 193, // %..N..W...W.
+ 197, 235, 216, 165, 130,  55, 248,  49, 205, 188, 150, 188, // .....7.1....
+ 216,  41, 141,   7, 117,   5,  53, 242, 141, 155, 125, 240, // .)..u.5...}.
+  56,  69, 219, 190,  35,  16, 151, 117, 253, 105, 234,  26, // 8E..#..u.i..
+ 144, 120, 103, 246, 231, 204,  86,  91,  82, 177, 144,  41, // .xg...V[R..)
+ 247,  92, 211, 218, 158, 107, 198,   5,  86, 246, 253, 116, // .....k..V..t
+  92, 181,  89, 128, 125,  71, 185, 239, 103, 203, 173, 153, // ..Y.}G..g...
+  76, 228,  74, 174,  56, 174, 216,  63, 240,  18, 149,   4, // L.J.8..?....
+  55, 142, 185, 232, 138, 228, 148,  78, 171, 221, 218, 112, // 7......N...p
+  20, 219,   4,  57, 254, 141, 121,  66, 212, 151, 176, 137, // ...9..yB....
+ 253, 152,  70, 246,  77, 144, 214,  31, 133, 196,  54, 207, // ..F.M.....6.
+ 136,  13, 250,  51, 207, 145,  83,  39, 160,  91,  38, 156, // ...3..S'.[&.
+ 210, 103,  49,  21, 143,  72, 127, 125, 253,  24, 135, 203, // .g1..H.}....
+ 179, 214, 105, 116, 161, 207, 255, 164, 245, 225, 220, 239, // ..it........
+ 108, 111, 111,  56, 148, 251,  82,  31,  79, 210, 193, 153, // loo8..R.O...
+ 174,  21, 129, 122,  40, 110, 152,  76,  16,  10, 160,  83, // ...z(n.L...S
+  81, 214,  36, 214,  22,  61,  29, 226, 162, 173, 237,  22, // Q.$..=......
+ 255, 245, 183, 208, 137,  65,  56, 134, 111, 132, 178, 109, // .....A8.o..m
+ 147,  68, 122,  53, 215,  54,  41, 177,  93,  47,   9, 235, // .Dz5.6).]/..
+ 106, 235,  36,  77, 225, 151, 151,  91, 216, 221,  96, 115, // j.$M...[..`s
+ 106, 185,  18, 205, 241,  55,  30, 180, 219, 232, 110,  58, // j....7....n:
+  60, 158,  78, 150,  20, 138, 243, 127, 142, 191, 213, 238, // <.N.........
+ 162,  87, 209,  40,  66, 146, 112,  92,  68,  79,   8, 109, // .W.(B.p.DO.m
+ 237, 123,  56,  62, 226, 147,  93, 176, 198, 127,  50, 126, // .{8>..]...2~
+ 163, 209,  41,  10, 195, 226,   2,  11,  32,  78,  92, 166, // ..)..... N..
+ 160, 120,  90, 114, 206,  76, 176,  73, 180, 119, 253, 174, // .xZr.L.I.w..
+  60, 198, 229,  28,  79, 163, 120, 136,  10, 169, 117, 200, // <...O.x...u.
+ 148, 104, 190, 222,  23,  78, 131, 232, 139, 126, 167,  81, // .h...N...~.Q
+ 146,  54, 245, 100, 188, 209,  69, 159,  56, 205,  19,   9, // .6.d..E.8...
+ 197,  29, 193,  36, 127,  56,  56,  37, 152,  17,  83, 147, // ...$.88%..S.
+  83,  95, 103, 104,  14, 119,  96,  72, 116, 251, 164,  58, // S_gh.w`Ht..:
+   8, 204, 109,  56, 165, 173,  31, 131, 177, 162,  64, 226, // ..m8......@.
+ 239,  82, 164,  71,  86,   3,  46,  83,   2, 132,  39, 101, // .R.GV..S..'e
+  84, 249, 172, 114,  62, 190, 206, 245, 195, 187,  18, 180, // T..r>.......
+  77, 130,   7,  95,  75, 176, 245, 181,   4, 155,  95,  75, // M.._K....._K
+ 176, 241, 181,   4, 221, 175,  37, 232, 124,  45,  65, 251, // ......%.|-A.
+  75,   9,   4, 157, 134, 149,  36,  80, 204, 151, 105,  44, // K.....$P..i,
+  78, 135, 195,  33,  19, 214,  47,  20,  69,  66,  46,   9, // N..!../.EB..
+ 199,  95, 105, 204, 157,  37, 108, 147, 164, 107, 223, 205, // ._i..%l..k..
+ 232, 117, 138,  97, 106,  23, 227, 209,  46,   0, 223,  46, // .u.aj.......
+  32, 220,  46,  64, 217,  46,  96, 214,  46, 128, 211,  46, //  ..@..`.....
+ 160, 208, 174, 116, 215, 206,   9, 219, 173, 118, 209, 254, // ...t.....v..
+ 118, 209,  80, 110, 146,  24, 179,  46, 197,  69,  34, 201, // v.Pn.....E".
+ 215, 101,  73,  53, 236, 155, 140, 117,  13, 168,  11, 176, // .eI5...u....
+  32, 198,  41,  58, 159, 158, 239, 127,  41,  93, 135, 167, //  .):....)]..
+ 126,  54,  62, 255, 134, 130, 222, 191, 219, 187,  43,  21, // ~6>.......+.
+ 173, 233,  72, 120, 162, 195, 172, 146, 196, 136, 132,  69, // ..Hx.......E
+  42, 231,  29, 166,  58,  46, 106, 244,  55,  40, 245, 104, // *...:.j.7(.h
+ 138,  89, 245, 133, 177,  12,   7, 103,  49, 206,  32, 221, // .Y.....g1. .
+ 153, 200, 150, 134, 212,   3, 194, 169,  48, 201, 143, 114, // ........0..r
+ 125,  62, 254, 134, 206, 236,  74, 242,  15,  95,  72, 221, // }>....J.._H.
+ 217, 226, 244,  81, 242, 173, 233, 145, 156, 216, 156,  97, // ...Q.......a
+  74,  66, 194, 215, 154, 113,  74,  29,  59,  58, 214, 225, // JB...qJ.;:..
+ 249,  87, 167, 197, 121,  24,  37,  71,  12, 135, 201,  87, // .W..y.%G...W
+ 211, 226,   4, 213,  81, 148,  12,  35,  18, 204, 210, 236, // ....Q..#....
+ 171, 201, 249,  54, 137, 191, 144, 126, 148, 158,  28, 141, // ...6...~....
+ 178,  52, 201, 191,  41, 101,  86, 199, 134, 229,   9,  25, // .4..)eV.....
+  88, 233,  88,  39,  95,  79,  57,  25, 124, 157, 132,  28, // X.X'_O9.|...
+ 127,  29,  70, 196, 210,  15, 143, 179, 240,  76, 127,  53, // ..F......L.5
+ 101, 116, 146, 176, 111, 162,  59,  19, 154, 229, 188,   0, // et..o.;.....
+ 224, 228, 136, 189, 137, 124, 189,  43,  25,  45, 230,  71, // .....|.+.-.G
+ 178, 164, 221,  61,  91, 118, 211, 243,  17, 150,  94, 139, // ...=[v....^.
+ 229, 132,  95, 179, 197,  37, 169, 160, 103, 134,  30, 180, // .._..%..g...
+ 231,  39,  62,  77, 113,  51, 195, 219, 245, 169, 140,  73, // .'>Mq3.....I
+ 107, 231,  44,  79,  77, 153, 144, 237, 218, 204, 107, 207, // k.,OM.....k.
+ 207, 172, 246, 242,  41,  68, 147, 101, 249,  92, 233, 180, // ....)D.e....
+ 231,  39,  69, 187, 134, 253, 134, 182, 213, 176, 220, 132, // .'E.........
+ 205,  99, 179,   9,  94, 192,  90,  19,  94, 193, 206,  74, // .c..^.Z.^..J
+ 136,  96, 161,   9, 168,  96, 155,  13,   1,  86,  89, 250, // .`...`...VY.
+ 122,  92, 214,  93, 193,  18,  19,  82,  98, 131, 112, 139, // z..]...Rb.p.
+ 139, 163, 110, 139, 172, 140, 110,  49, 136,  66, 231, 181, // ..n...n1.B..
+ 198,  24,  31, 137, 224,  37,  50,  66, 141,  54,  23,   7, // .....%2B.6..
+ 213, 190, 200, 135, 204,  10,  86, 245,  63, 197, 190,  20, // ......V.?...
+  34, 255,  23, 112, 176,  68,  62, 170, 180,  56, 184, 255, // "..p.D>..8..
+ 109,  25, 102,  75, 150, 176,   2,  91, 203, 202, 145, 165, // m.fK...[....
+  44, 217,  97,  72, 241, 134,  95, 165,  26, 249, 158, 239, // ,.aH.._.....
+ 128,  61, 205, 252,  77, 237,  97,  98,  46,   7, 153, 191, // .=..M.ab....
+  60, 159, 171,  60,  66,  89,   3,  10, 178, 185,  37, 217, // <..<BY....%.
+  76,  68, 135,  27, 167, 180, 184,  41, 186, 121, 140, 195, // LD.....).y..
+  24, 204, 204,  54, 158, 242, 171, 136, 220,  20,  82, 191, // ...6......R.
+ 143, 247, 119, 136,  41, 191,  87, 110, 228, 253,  93, 174, // ..w.).Wn..].
+ 228, 253, 221, 233, 239, 252, 158, 212,  46, 229, 253, 189, // ............
+ 122,  43, 239, 239, 246,  90, 222, 223, 191, 112,  47, 239, // z+...Z...p/.
+ 239, 206,  14, 206, 137, 217, 155, 121, 169, 128, 223, 113, // .......y...q
+ 123, 173,  60, 229, 118, 222, 223, 113, 117, 233, 239, 197, // {.<.v..qu...
+ 253, 188, 191,  59,  82, 118, 134, 212,  93, 126, 187, 182, // ...;Rv..]~..
+ 111,  98, 184, 251, 251,  23, 175, 233, 253, 221,  89, 151, // ob........Y.
+  42,  43,  23, 245, 254, 254, 191, 250, 166,  94, 192, 134, // *+.......^..
+ 106, 221, 106, 255, 195, 116, 151, 223, 230, 174, 235,  37, // j.j..t.....%
+ 224, 242, 125, 189,  78, 105,  81,  79,  35,  57,  96,   9, // ..}.NiQO#9`.
+ 100, 238, 236, 182,  35,  22, 173, 142, 127,  64,   9,  68, // d...#....@.D
+  63, 239, 212, 142,  48,  47, 203, 246, 123, 114, 247,  17, // ?...0/..{r..
+ 238, 111,  45, 176, 158, 210, 152, 195,  16,  69,   9, 179, // .o-......E..
+ 221, 152,  10, 215, 217, 127, 252, 123,  89, 249, 156,  99, // .......{Y..c
+  15,  57, 112, 253, 197, 226,  23,  15,  93, 255, 158,  44, // .9p.....]..,
+  63,  59,  94,  54, 195, 156, 167, 118,  78, 113,  92, 128, // ?;^6...vNq..
+ 232,  55, 133, 117, 105,  86,  22,  71, 236, 152, 202, 176, // .7.uiV.G....
+  10, 153, 192,   9, 166, 172, 168,  31, 199, 110, 113, 116, // .........nqt
+ 131, 251,  34, 174,  61, 168,  43, 210,  15, 123, 214,  23, // ..".=.+..{..
+ 162, 240, 228,  44,  79, 199, 168, 178,  32,  90, 210, 218, // ...,O... Z..
+ 133,  59, 149, 127,  79, 170, 174,  80, 126,  79,  22, 110, // .;..O..P~O.n
+  85, 254,  61, 169, 159,  65, 255,  61, 185, 195, 167, 138, // U.=..A.=....
+ 137,  40, 135, 110, 206, 153, 229,  95,  68, 129, 101,  21, // .(.n..._D.e.
+ 212, 155, 186, 232, 182, 229,  95, 196, 177, 249, 130, 234, // ......_.....
+  21, 221,  85,  44, 187, 248, 250,  98, 145,  52, 211, 162, // ..U,...b.4..
+  73, 197,  55, 205, 183,  55, 240,  11, 245, 115, 252,  50, // I.7..7...s.2
+ 127, 205, 191,  39, 119, 121,  85, 164, 230,  84, 253, 211, // ...'wyU..T..
+  60, 108, 183,  81, 104,  49,  19, 152, 193, 249,  61,  49, // <l.Qh1....=1
+ 184, 110,  87,   0, 123,  20,  28,  22, 102, 190, 200,  86, // .nW.{...f..V
+  45, 225, 141,   4,  83, 161, 179, 181, 107,  56, 118, 186, // -...S...k8v.
+ 224,  37,  66,  82,  85, 249, 166, 153,  99, 182, 187, 124, // .%BRU...c..|
+ 167, 227, 200,  94, 153, 239, 180,  23, 166, 213, 255,  54, // ...^.......6
+ 176,  36, 142, 240, 247, 228, 155,  96,   9,  86, 242,  27, // .$.....`.V..
+  33,  73, 133,  86, 225, 136,  91, 178, 255, 247, 135, 164, // !I.V..[.....
+  61, 138, 211,  96, 206, 186,   6, 207, 138, 199, 130,  42, // =..`.......*
+  68,  57,  33, 177,  23, 178, 237,   0, 102,  92, 189,  87, // D9!.....f..W
+ 111, 212,  51, 181, 175,  58, 170, 171,  54, 212, 166, 218, // o.3..:..6...
+  82,  15, 212,  67, 181, 173,  30, 169,  78, 123,   1, 250, // R..C....N{..
+ 198,  75, 214, 255,  71,  57, 190, 121, 140,  94, 144, 164, // .K..G9.y.^..
+ 211, 248, 115,  74,  92,  69, 148,  95, 127,   3, 206, 179, // ..sJ.E._....
+ 100, 116,  23, 210,  11,  94, 255, 159,  68,  44, 158,  90, // dt...^..D,.Z
+ 249, 176, 188, 144, 242,  27, 128,  88,  74, 149, 255, 163, // .......XJ...
+  33,  89, 250, 197, 105,  63, 218, 176, 188, 200, 127,  41, // !Y..i?.....)
+ 120, 141, 252, 220, 128, 184, 172, 179,  48, 159, 102, 250, // x.......0.f.
+  27, 192,  91,  19, 211, 191, 145,  64,  87,  36, 245,  26, // ..[....@W$..
+ 161,  46,  64,  95, 164,  95, 144, 236, 103, 255, 135,  13, // ..@_._..g...
+ 202,  91, 209,  97, 252, 197,  65, 169, 105,  62, 238,  26, // .[.a..A.i>..
+ 148, 205, 165,  88, 223, 220, 104,  59, 223,  76, 217, 255, // ...X..h;.L..
+  71, 145, 242,  57, 207, 135, 191,  39, 203,  71, 175, 188, // G..9...'.G..
+  76, 181, 211, 222, 236, 108, 118, 186,  27,  91,  27,  91, // L....lv..[.[
+ 157, 173,   7, 255,  15,  12, 238, 243,  43,  18,  67,  34, // ........+.C"
+  26,  93, 163, 129, 250,  58, 212,  23, 196, 187, 250, 117, // .]...:.....u
+ 110, 127, 141, 229,  47, 218, 241, 146, 170, 111, 176,  94, // n.../....o.^
+ 172, 130,  88, 133, 195, 163,  42,  98, 149,  26, 180,  37, // ..X...*b...%
+ 220, 192, 255,  43, 109, 223,  11, 113, 186, 196, 192, 239, // ...+m..q....
+  43, 173, 175, 106, 251, 254, 187, 180, 255,  53,   9, 194, // +..j.....5..
+ 141,  82, 171, 248, 181,  46, 204,  41,  39, 255, 187, 244, // .R.....)'...
+ 226,  61,  47, 203, 223, 222, 141, 121, 101, 234, 127, 151, // .=/....ye...
+ 126, 188, 128,  34, 183,  49,  74,  79, 190,  21, 165,  74, // ~..".1JO...J
+ 237, 239, 127, 155, 161, 128, 215, 241, 191, 216, 131,  76, // ...........L
+  68, 129, 175, 241, 247, 255, 219, 112, 146, 175,  10,  37, // D......p...%
+ 250, 255, 107,  52, 247,  25,  86, 117, 222,  19, 248, 218, // ..k4..Vu....
+   0, 149, 187,   7, 255,  93,  80, 236, 217, 254, 238, 215, // .....]P.....
+  91,  61,  25, 252, 183, 105, 239, 147, 167, 251,  95, 109, // [=...i...._m
+  47, 118,  97, 254, 187, 180, 247, 101, 177,  11, 244, 213, // /va....e....
+ 245, 184,  72, 249, 223, 123, 246, 254,  47,  96, 148, 225, // ..H..{../`..
+  79, 252, 255, 189, 233, 252, 202, 110, 211, 125, 109, 196, // O......n.}m.
+ 138, 253, 188, 255,  46, 200, 118, 240, 211, 207, 135, 141, // ......v.....
+ 146,  32, 202, 205,  20,  95, 239, 198, 252,  54, 228, 127, // . ..._...6..
+ 155, 238,  60, 221, 251, 185, 241, 226, 176, 241,  12, 219, // ..<.........
+ 161,  13, 222,  14, 253, 186,  42, 172, 178, 119,  90,  85, // ......*..wZU
+ 136, 225, 170,  86, 246, 186,  98, 182,  83, 213, 254, 184, // ...V..b.S...
+ 248,  93,  83,  68,   5,  27, 233, 104, 164, 158,  15,  82, // .]SD...h...R
+ 184, 128,  93,  62,   3, 255,  55, 148, 163, 254, 159, 159, // ..]>..7.....
+ 203,  79,   6,  50,   2,  95, 135, 222, 178, 157, 163, 187, // .O.2._......
+  55, 193, 254,  26,  74, 205, 111, 142, 219, 237, 163, 125, // 7...J.o....}
+ 179, 159, 222, 144, 253, 244,  70, 167, 220,  72, 170, 160, // ......F..H..
+ 213, 242,  61, 119, 108,  71, 225, 208,  17, 139, 220, 255, // ..=wlG......
+  51, 186, 215, 253, 215, 186, 215, 253,  31, 210, 189, 141, // 3...........
+ 127, 173, 123,  27, 255,  67, 186, 183, 249, 175, 117, 111, // ..{..C....uo
+ 243, 127,  72, 247, 182, 254, 181, 238, 109, 253,  15, 233, // ..H.....m...
+ 222, 131, 127, 173, 123,  15, 156, 255, 211, 184, 191,  87, // ....{......W
+ 124,  64, 142, 187,  92, 132, 189,  73, 243, 255, 127, 123, // |@.....I...{
+ 103, 183, 211,  54,  18, 197, 241, 251,  62, 133,  19, 181, // g..6....>...
+ 200, 222, 154, 224,  64, 248,  16, 105,  64,  90, 181, 219, // ....@..i@Z..
+ 173, 118, 185,  41, 173, 184, 160, 168,  36, 196,  33,  86, // .v.)....$.!V
+ 131,  29, 217,  14, 161,  37, 126,  23, 158, 133,  39, 219, // .....%~...'.
+ 115, 206, 124, 120, 198,  30, 135,  20, 170, 144,  93, 173, // s.|x......].
+ 144,  72,  50, 182, 199, 227,  51, 199, 103,  60, 227, 153, // .H2...3.g<..
+ 255,  15, 217, 162, 150, 152, 242, 159,  88, 221, 216, 183, // ........X...
+ 186, 215, 221,  96,  68, 152,  50, 176,  47, 110, 190,  96, // ...`D.2./n.`
+ 179,   1, 146, 154, 130, 196, 200, 231,  10,  80, 198, 178, // .........P..
+  18,   2, 246, 107, 101, 231,   6,  24,  42, 249,  95, 211, // ...ke...*._.
+  35, 151,  32, 160,  98,  61, 230,  51,  79,  80, 133,  53, // #. .b=.3OP.5
+ 246, 188,  81, 208, 248,  18, 190, 233, 197,  22,  78, 251, // ..Q.......N.
+  17, 159, 239, 131, 116,  56, 233, 237,  91, 111, 186,   7, // ....t8..[o..
+  66, 143, 245, 146, 146, 112, 241, 193,   6,  29, 181, 145, // B....p......
+ 231, 132, 154, 171, 229,  60,  78, 252, 158, 245, 249, 131, // .....<N.....
+ 133, 179, 255,  83, 107, 146, 224, 141,  40, 132,  90, 181, // ...Sk...(.Z.
+ 140,  21, 161,  87, 150,  81, 189, 232,  54,  31, 125, 156, // ...W.Q..6.}.
+ 107, 229,  91, 126, 120,   9,  54, 245, 249, 236,  48, 238, // k.[~x.6...0.
+  69,  23, 236,  57, 211,  16, 102,  24, 249, 169,  84, 251, // E..9..f...T.
+ 191, 194, 211,  30,  61, 187, 228, 113, 147,  72, 202, 158, // ....=..q.H..
+ 168,  13, 189,  27,  93,  83,  14, 190,  51,  24, 209, 138, // ....]S..3...
+ 122, 234,  17, 132,  91,   2,  46, 250,  33, 190, 120, 225, // z...[...!.x.
+ 113, 150, 206,  83, 180, 249, 130,  77, 136, 177, 223, 211, // q..S...M....
+  44,  95,  76, 254, 124, 204, 231, 246,  63, 212, 132, 105, // ,_L.|...?..i
+ 132,  79,  89, 113, 213, 237, 145,  96,  29, 176, 134, 134, // .OYq...`....
+ 214, 170,  52, 196,  58, 130, 202, 170,  84, 145, 192, 229, // ..4.:...T...
+  62, 144, 122,  35, 123,  55,  47, 111, 181,  76,  27, 105, // >.z#{7/o.L.i
+ 116,  76,  51,  39, 237, 230, 142, 147, 229, 141, 214,  82, // tL3'.......R
+ 141, 249,  22,  23,  71,  88, 246,  85, 226, 168,  29,  69, // ....GX.U...E
+ 147,  41, 216,  50, 138,  71,  26, 226,  25, 174, 140, 105, // .).2.G.....i
+ 172, 224,  18, 106, 182, 236,  99,  94,  63, 152,  93,  33, // ...j..c^?.]!
+ 219,  79, 237,   2,  23, 102, 130,  60, 139, 187, 255,  62, // .O...f.<...>
+  89, 168, 236, 147,  82, 201,  87, 162,  22, 142,  33,  78, // Y...R.W...!N
+  96,  75,  34,  22, 232,  84, 143, 172, 176, 235,  16, 251, // `K"..T......
+ 205,  43, 187, 138, 243,  18,  50, 230,  37,  40,  14, 156, // .+....2.%(..
+ 183, 189,  24,  91, 183,  92, 254, 179, 255, 240, 224,  63, // ...[.......?
+  15, 224, 207, 227, 202, 112, 131,  89, 158, 188, 110, 229, // .....p.Y..n.
+ 193, 120, 103,  83,  34, 165,  42,  94, 237, 231, 183, 168, // .xgS".*^....
+ 103, 174,   6, 101, 230, 138, 120, 199, 191, 185, 189, 173, // g..e..x.....
+ 191, 228,  95,  40,  60, 211,  57, 202, 193, 249, 121, 172, // .._(<.9...y.
+ 213, 124,  48, 226, 110,  54, 118, 154, 205, 214, 246, 222, // .|0.n6v.....
+ 238, 238, 222, 214,  94, 115, 171, 181, 187, 203, 158,  85, // ....^s.....U
+  30, 105, 221, 230,  18, 172, 219,  92,  21, 235, 110, 126, // .i........n~
+   9, 151, 109, 223, 205,  37, 216, 119, 115,  85, 236, 187, // ..m..%.wsU..
+ 165, 216, 247, 145, 246, 218, 170, 180,  87, 105,  94, 143, // ........Wi^.
+ 193, 126, 115, 140, 180, 181,  42,  70, 106,  61, 213,  68, // .~s...*Fj=.D
+ 173,  37, 184,  84, 107,  85, 172, 181, 253,  84, 107, 109, // .%.TkU...Tkm
+  47, 193,  90, 219, 171,  98, 173, 157, 167,  90, 107, 103, // /.Z..b...Zkg
+   9, 214, 218,  89,  21, 107, 237,  62, 213,  90, 187,  75, // ...Y.k.>.Z.K
+ 176, 214, 174, 169, 223,   8, 127, 234, 250,  68,  62,  14, // .........D>.
+ 195, 117,   0, 197, 200,  11,  35, 110,  62, 188, 202,  71, // .u....#n>..G
+ 231,  29, 151,  70,  87,  10, 152, 201,  74, 106, 178,  78, // ...FW...Jj.N
+ 215, 124, 218, 250, 158,   5,  32, 157, 139, 230, 183, 154, // .|.... .....
+ 240, 248,  69,  75, 255, 179,   8, 121, 211,  56, 135,  96, // ..EK...y.8.`
+  59, 210, 231, 255, 171,  35,  87, 111, 117, 164, 241, 129, // ;....#Wou...
+ 212, 170,  64, 197, 182,  12, 213, 254, 240, 251, 157, 185, // ..@.........
+  72, 243,  39,  44, 198,  52, 193, 213,  91, 101, 148,  45, // H.',.4..[e.-
+ 247, 220,  71,   2, 215, 141,  17, 252, 196,  31,  93,  68, // ..G.......]D
+  87, 126,  77,  95, 158, 169,  97, 214, 149, 122, 108, 201, // W~M_..a..zl.
+ 152, 158, 207,  59, 242,  99, 223,  10, 146, 251, 187, 238, // ...;.c......
+ 253,  29, 181,  31, 214, 116, 136,  73, 112,  42, 168,  73, // .....t.Ip*.I
+ 156, 225,  57, 165,   5,   2, 209, 253,  93, 223, 103, 144, // ..9.....].g.
+  79,  43,  29, 250,  22, 190, 128,  10,  47,  80, 172, 239, // O+....../P..
+ 254,  14, 246, 141,  45, 240,  26, 226,  89,  71,  49, 228, // ....-...YG1.
+  21, 126, 183,  34, 156, 156,  99,   5, 249,  24,  63, 101, // .~."..c...?e
+ 137, 218, 225, 216, 140,  88, 193,  21, 206, 168, 232, 210, // .....X......
+ 204,  75,   6,  74,  79, 232,  36, 184, 142, 219, 234, 249, // .K.JO.$.....
+ 144, 232, 163, 159,  64,  40, 191, 188, 191,  11, 194, 198, // ....@(......
+  67, 246, 230,   1,  77, 187, 252,  86, 225, 242, 155, 130, // C...M..V....
+ 254, 182, 216,  52,  13,  45, 238, 137,  96,  88,  85, 121, // ...4.-..`XUy
+ 149, 120, 226,  74,  22, 221,  47, 143, 146, 234,   8, 209, // .x.J../.....
+ 158, 204, 217, 228, 155, 249, 214,  95, 229, 135,  68, 165, // ......._..D.
+  15, 194, 202,  85, 194,  86, 217,  47, 121, 113, 123,  81, // ...U.V./yq{Q
+ 154,  70,  87, 252,  57, 197, 210, 157, 243, 179,  88, 172, // .FW.9.....X.
+ 175, 174, 239, 101, 237, 188,  97, 220, 150, 125,  10,  88, // ...e..a..}.X
+  51, 127,  76, 161, 167,   1, 169, 199, 171, 103,  47, 229, // 3.L......g/.
+ 159, 126,  42, 251, 113, 126, 148, 122, 138, 113, 174,  37, // .~*.q~.z.q.%
+ 165,  95, 129, 213, 237,  67, 224, 220, 160, 255,  22, 247, // ._...C......
+ 245,  13, 252,   7, 254, 110, 137, 135,  21, 102,  53, 209, // .....n...f5.
+ 242, 118, 187,  93,  61, 254, 122, 175, 184, 105, 164,  74, // .v.]=.z..i.J
+ 129, 202,  12, 150, 175, 146, 177,  18,  62,  40, 207,  62, // ........>(.>
+   4,  13,  15,  66, 189, 164,  70, 127, 105, 170, 247, 197, // ...B..F.i...
+  25,  73, 226, 112, 146, 174,  34,  27, 150, 101, 109,  31, // .I.p.."..em.
+ 108,  25, 160, 112,  35, 126,  42,   4,  16, 148, 130, 103, // l..p#~*....g
+ 240, 160, 136, 169, 183,  37,  28, 111, 228, 135, 142, 235, // .....%.o....
+ 199, 122,  26, 236,  74, 191,  99, 122, 157, 226, 216,  66, // .z..J.cz...B
+ 238,  77, 202,  76,  86, 160, 239, 136, 141,  72,  16, 185, // .M.LV....H..
+  79, 221, 222, 126, 232,  98, 147, 140, 114, 185, 156, 153, // O..~.b..r...
+  81, 226,  45,  73,  92,  17, 234, 234,  54,  46,  70,   1, // Q.-I....6.F.
+ 194, 229, 240,  22, 152, 205,  42,  55,  29, 236, 180, 144, // ......*7....
+  57,  80, 193, 220, 116, 147,  78,  64,  42, 178,   5, 104, // 9P..t.N@*..h
+ 158,  59,  41, 159, 221,  67, 246,  75,  49, 149,  68, 228, // .;)..C.K1.D.
+  12,  20,  40,  84, 246,  31,  27,  83, 251, 229,  84, 245, // ..(T...S..T.
+ 252,  92, 133, 222, 113, 135, 114, 191, 143, 254,   0, 209, // ....q.r.....
+ 186, 151, 197, 132, 171, 162,  24, 119,  42,  64,  79, 130, // .......w*@O.
+ 204, 232,  34, 108,   2, 174,  54, 141, 192,  19, 115,  80, // .."l..6...sP
+  48,   9, 218, 185, 245, 105, 130, 186, 220,  27,  27, 245, // 0....i......
+ 215, 105,  99,  24,  37,  41, 124, 160, 120,  30, 222,  87, // .ic.%)|.x..W
+ 175,  73, 138,  49,  33, 110, 106, 221,  13,  73, 167, 184, // .I.1!nj..I..
+  45, 144, 170,   8,  57,  98,  10, 112, 170, 210,  54, 170, // -...9b.p..6.
+  95, 207, 102, 181,  62,  23, 185, 100, 162, 123, 109, 174, // _.f.>..d.{m.
+ 232, 234,  79, 173,  19, 191, 119,  76, 170, 118, 246, 200, // ..O...wL.v..
+ 105, 167, 141,  40, 196, 233, 208, 234,  21, 152, 137, 173, // i..(........
+ 224, 136, 238, 135,   6, 103,  76, 219,  66,  72, 131, 196, // .....gL.BH..
+ 103,  51,  55,  37, 209, 226,  40, 241,  23, 201, 167, 169, // g37%..(.....
+ 229,  51,  24, 200, 140,  72, 171, 144, 242, 186,  98, 195, // .3...H....b.
+ 202, 121, 110, 169, 115, 139, 194, 209,  68,  23,  81, 133, // .yn.s...D.Q.
+ 163, 211,   6, 202, 166,  56, 237, 154, 153, 239, 193,  85, // .....8.....U
+ 113,   5, 102,   7,  79,  46, 244, 112,  79,  83,  55,  58, // q.f.O..pOS7:
+ 203,  21, 113,  81, 105,  62, 240,  17, 113,  34, 244, 212, // ..qQi>..q"..
+  71, 167,  41, 233, 117, 187, 177, 240,  89,  65,  15,  22, // G.).u...YA..
+ 104,  23, 174, 226, 120, 171,  83,  99,  28, 223, 140, 233, // h...x.Sc....
+  69, 245,  92, 196, 178,  56, 109, 178, 165, 224, 109,  74, // E....8m...mJ
+  14, 110, 122, 136, 154, 140,  49, 210, 162, 162,  12, 238, // .nz...1.....
+  62, 161,  43,  94,  96,  21, 151, 164, 253,  99,  71,  41, // >.+^`....cG)
+   1,  81, 137,  35, 206, 106, 130,  27,  74,  39,  20, 107, // .Q.#.j..J'.k
+  80,  40,  42,  75,  90,  89,  86, 198,  19, 166, 207,  66, // P(*KZYV....B
+ 137, 163,  44,  11,  81,  53, 188, 172,  67, 238, 130, 161, // ..,.Q5..C...
+ 145, 168, 138, 124,  18, 223,  81, 171,  25,  92, 220,  29, // ...|..Q.....
+  41, 210, 221,  70,  64, 238,  52, 177,   6,  49, 106,  92, // )..F@.4..1j.
+ 214,  93,  86, 175, 144,   9, 138, 180,  32, 244, 217, 157, // .]V..... ...
+ 239, 244,  80, 160, 176, 129, 111, 145, 109,  20, 134, 119, // ..P...o.m..w
+ 183, 224, 136, 204, 189, 238, 204,  37,  79,  35, 226, 162, // .......%O#..
+ 159,  51, 203,   4,  54, 217, 203,  28, 247,  43, 137, 169, // .3..6....+..
+  35,  14,   2, 188, 241, 155, 163, 238,  54, 145,  95, 185, // #.......6._.
+  26, 120, 150, 114, 173, 126, 150, 107, 170, 230, 234, 185, // .x.r.~.k....
+ 191, 219,  10,  58, 153, 171, 226,  20, 180, 236, 241, 106, // ...:.......j
+ 241, 187, 243, 208, 206, 172, 171, 141, 128,  62, 252,  34, // .........>."
+  25, 217,  84,   3, 252, 123, 230, 254,   1, 230, 117,  79, // ..T..{....uO
+ 235, 164, 104, 138, 104,  53, 136,  47,  92, 109,  24,  71, // ..h.h5./.m.G
+   8,  46, 226, 104,  52,  34, 197, 148, 201, 197, 144, 170, // ...h4"......
+ 190, 126, 166, 241, 123, 100, 252, 134,  14, 236,  59,  20, // .~..{d....;.
+  16, 254,  59,  72, 224, 185,  11,  65, 100,  46, 211, 230, // ..;H...Ad...
+ 134, 236,  33,   4, 103, 146,  86, 128, 169, 200, 148, 206, // ..!.g.V.....
+ 101, 255,  49,  37,  55, 147, 147, 181,  69, 188, 124,  55, // e.1%7...E.|7
+  24, 192, 189, 230, 216, 133, 112,  73, 144, 172, 118, 178, // ......pI..v.
+ 182,  86, 165,  62, 251, 213, 113, 147, 217,  12,  79, 146, // .V.>..q...O.
+ 159,  82,  57,   1, 167,  27, 189, 181,  29,  29, 123, 214, // .R9.......{.
+  69, 125, 235, 129, 200, 150, 253, 170,  68,  44, 164, 152, // E}......D,..
+ 194,  49, 121,  14,  20,  23,  69, 215, 133,  75,  72,  13, // .1y...E..KH.
+ 125,  72, 118, 160,  17, 203,  91,  42,  41,  17, 122, 200, // }Hv...[*).z.
+ 223,  53, 174, 173,  93, 217, 218,  30, 216, 206,  73, 173, // .5..].....I.
+  21, 146,  82,  15,  43, 218,  64,  99, 251, 167,  66, 170, // ..R.+.@c..B.
+ 243, 124,  32,  38, 121, 238, 156, 248, 191, 182,  86,  51, // .| &y.....V3
+ 177, 189,  85, 178, 150, 116, 168, 170, 182,   2,  76, 116, // ..U..t....Lt
+  78, 168,  11,   8, 181, 253,  99, 116,  21, 123, 211, 173, // N.....ct.{..
+ 123, 117, 167,  61,  22, 225, 208,  30, 231, 142, 174, 212, // {u.=........
+  93,  46,  45, 147,  91, 187, 229, 109, 117,  72, 105, 190, // ].-.[..muHi.
+ 155,  78, 146, 195, 107, 219, 217,  47,  35,  46,  56, 162, // .N..k../#.8.
+   3,  27, 169, 183,  16,  19, 219,   2,  40, 152, 218,  33, // ........(..!
+ 114,   3, 255, 132, 222,  16,   2,   2,   9,  97, 193, 211, // r........a..
+ 142, 130,  16,  47, 167, 144, 122, 236,  67,  85, 247,  49, // .../..z.CU.1
+  85, 162,  15,   9,  74,  88, 201, 163,  97, 173,  25,  92, // U...JX..a...
+ 208, 156,  59, 144, 183, 120,   4,  84,  52, 221, 121,  14, // ..;..x.T4.y.
+  70,  16,  54, 236,  81, 235, 196, 196,  67, 147,   9,  46, // F.6.Q...C...
+ 250, 174, 249, 168,  76,  96, 195, 241, 238,  27,  44,  20, // ....L`....,.
+  56, 100,  73, 154, 115,  67, 134,  84, 190,  18, 212,  71, // 8dI.sC.T...G
+ 115,   9,  50,  35, 175,  67, 214, 108,  51,  67, 217, 112, // s.2#.C.l3C.p
+   8, 193, 191,  69, 142, 204, 128, 154,  84, 209, 204,  42, // ...E....T..*
+   5, 128, 198,   2,  27, 200, 154, 157, 243, 208,  70,  26, // ..........F.
+ 222,  93, 232,  32,  51,  53,  48,  37,  65, 194, 222,  89, // .]. 350%A..Y
+ 155,  90, 104,  84,  37, 210,  62,   3,  35,  43,  94,  12, // .ZhT%.>.#+^.
+ 141, 186, 195, 183,  17, 252,  76, 217, 150, 179, 207,  10, // ......L.....
+ 121,  43, 247, 245,  41, 255, 114,   6, 205,  12,  62, 115, // y+..).r...>s
+  93, 226,  19,  93, 103,   8,  17, 150,  43,  74, 225, 207, // ]..]g...+J..
+  75,  12, 184, 120,  47, 118, 190, 178, 111, 208, 132, 116, // K..x/v..o..t
+ 174,  93, 145, 201,  27, 111,  54, 227,  95,  15,  58, 182, // .]...o6._.:.
+ 175,  10, 241, 147,  90, 146,   0,  39,  34, 120, 222,  81, // ....Z..'"x.Q
+ 206, 141, 220,   9, 193, 172, 251, 222, 249, 108, 255, 112, // .........l.p
+  79, 236,  79, 216, 106, 250,  14, 154, 112, 162, 221, 146, // O.O.j...p...
+ 245,  58, 237, 119, 211, 145, 240, 108, 158,  77, 118, 238, // .:.w...l.Mv.
+ 246, 208,  91, 166, 248, 239,  72,  15,  44, 236, 236,  28, // ..[...H.,...
+ 217,   3, 222, 101, 243, 134, 131, 113, 148, 108, 127,  49, // ...e...q.l.1
+  60, 147, 131, 132, 193, 163, 195, 134, 180,  21,  61,   5, // <.........=.
+ 113,  94, 106, 112, 152,  32,  57, 150,  35, 116, 120,  55, // q^jp. 9.#tx7
+ 168, 211, 193, 135,  20, 187, 135, 247, 220,  20, 255, 221, // ............
+ 116,  68,   7, 233, 155,  86,  66, 142, 121, 122,  39,  56, // tD...VB.yz'8
+ 180, 156, 106,  76, 195, 106,   7,  47, 111, 191, 103, 140, // ..jL.j./o.g.
+  40, 172,   0, 169, 167, 193, 143, 110, 220,  95, 103, 253, // (......n._g.
+  39,   9,  62, 134,  48, 213,  67, 234, 119, 125, 125, 157, // '.>.0.C.w}}.
+ 147, 203, 169, 199, 177, 239,  65, 199,  11,  81, 157, 117, // ......A..Q.u
+ 101, 208, 185, 233, 121, 215, 195,  54, 118, 210, 180, 180, // e...y..6v...
+  87, 176, 235, 121,  86,  68, 188, 247, 187, 201, 144, 132, // W..yVD......
+ 138, 169, 163,  62, 246, 227, 122,   1, 166, 204,  88, 215, // ...>..z...X.
+  57, 253, 138,  73,  89,  11,  14, 252,  20, 172,  80, 230, // 9..IY.....P.
+ 189, 191, 188, 253,  43, 167,  76, 231, 124, 111, 157,  62, // ....+.L.|o.>
+ 109, 100,  87,  87, 241, 191,  97, 175,  11, 243,  94,  12, // mdWW..a...^.
+   5,  14, 219,   7, 249, 118, 201, 191,  78, 243, 180,  18, // .....v..N...
+  32,  28,  54,  95, 138, 205, 156, 132, 125, 158, 149, 248, //  .6_....}...
+ 224, 252,  48, 105,  29, 129, 204, 134, 250,  48,  93, 186, // ..0i.....0].
+ 126, 176, 128, 204, 243, 131, 225, 160,  88,  16,  84, 211, // ~.......X.T.
+ 184,  27,  38,  35, 104,   2, 214, 111, 214,  61, 172,  87, // ..&#h..o.=.W
+  53,  97,   0,  54, 214,  64, 244, 100, 211, 247, 153, 197, // 5a.6.@.d....
+  59, 178, 132, 171, 182, 200, 251,  59,   8, 209, 209, 108, // ;......;...l
+ 169,   2, 234,  57,  65,  94, 185,  54, 189, 128, 152, 133, // ...9A^.6....
+ 169, 116, 162, 224, 172, 155,  79, 122, 135, 176, 185,   6, // .t....Oz....
+  46,  72,  71,  96, 249, 214, 105,  64, 136,  54, 233, 128, // .HG`..i@.6..
+ 114, 127, 164,  66, 199, 121, 255,  31,  74,  86, 243, 212, // r..B.y..JV..
+ 244,  49, 187, 140, 111, 122,  26, 145, 184, 111, 126, 134, // .1..oz...o~.
+ 112, 158, 150,   9, 231,  67,  35, 225, 124,  35, 231, 155, // p....C#.|#..
+ 191, 224,  31,  28, 228, 157, 143,  24,  68, 114, 164, 192, // ........Dr..
+ 151, 132, 238,  91, 104,  61,  92, 173, 203, 239, 180, 223, // ...[h=......
+ 108, 224, 104, 230,  56,  61, 120, 241, 226,  31,  57, 221, // l.h.8=x...9.
+  90, 117, 209,  67,   2,   0, 0 // Zu.C..
 };
 
 const struct mg_mem_file mg_packed_files[] = {
-  {"/web_root/index.html.gz", v1, sizeof(v1) - 1, 1781539879},
+  {"/web_root/index.html.gz", v1, sizeof(v1) - 1, 1792393699},
   {NULL, NULL, 0, 0}
 };
 
@@ -101,6 +101,32 @@ void glue_unlock(void);     // Unlock global Mongoose mutex
 // Send a message to the websocket API connections, return number of connections
 int mongoose_ws_printf(const char *api_name, const char *fmt, ...);
 
+// Send delta frames to the websocket API connections, at most every
+// min_interval_ms per connection and only if less than max_backlog bytes are
+// queued. Connections that miss a delta get a full frame on the next call.
+// print_fn is only called if a frame is actually needed by some connection.
+// Return number of connections
+typedef size_t (*mongoose_ws_stream_print_fn)(void *userdata, char *buf,
+                                              size_t len, bool full);
+int mongoose_ws_stream(const char *api_name, unsigned min_interval_ms,
+                       size_t max_backlog, bool changed,
+                       mongoose_ws_stream_print_fn print_fn, void *userdata);
+
+// Counters of the cached GET responses of a data API (see handle_object).
+// rendered: serialized because the state changed, served: 200 responses,
+// not_modified: 304 responses. Returns false if there is no such data API
+struct mongoose_http_cache_stats {
+  unsigned long rendered;
+  unsigned long served;
+  unsigned long not_modified;
+};
+bool mongoose_http_cache_stats(const char *name,
+                               struct mongoose_http_cache_stats *stats);
+
+// Print [timestamp,value] pairs, for use with %M.
+// Arguments: uint32_t *timestamps, double *values, size_t count
+size_t print_timeseries(void (*out)(char, void *), void *ptr, va_list *ap);
+
 // Update MDNS name. Works when MDNS is enabled.
 void glue_mdns_update_name(const char *newname);
 
@@ -51,6 +51,7 @@
 #define CONN_ACTION 'A'
 #define CONN_WEBSOCKET 'W'
 #define CONN_HANDLED 'Z'
+#define CONN_ASSET 'S'
 
 typedef void (*data_func_t)(void *);
 typedef bool (*array_get_func_t)(void *, size_t);
@@ -73,6 +74,9 @@ struct mg_mgr g_mgr;  // Mongoose event manager
 // Every time device state changes, this counter increments.
 // Used by the heartbeat endpoint, to signal the UI when to refresh
 static unsigned long s_device_change_version = 0;
+// Random per boot, part of the ETag so that a reboot (version back at 0)
+// does not make clients keep a stale response
+static unsigned long s_boot_id = 0;
 
 struct attribute {
   const char *name;
@@ -127,6 +131,11 @@ struct apihandler_data {
   size_t data_size;                    // Size of C structure
   data_func_t getter;                  // Getter/check/begin function
   data_func_t setter;                  // Setter/start/end function
+  char *cache;                         // Serialized response, see handle_object
+  size_t cache_len;
+  void *cache_data;                    // Structure the cache was rendered from
+  unsigned long cache_version;         // s_device_change_version of the cache
+  struct mongoose_http_cache_stats stats;
 };
 
 struct apihandler_array {
@@ -155,6 +164,8 @@ struct file_state {
 struct websocket_state {
   char marker;
   struct apihandler_websocket *h;
+  uint64_t last_sent;  // Used by mongoose_ws_stream() for per client rate limit
+  bool stale;          // Client missed an update and needs a full frame
 };
 
 struct custom_api_handler {
@@ -217,6 +228,8 @@ struct attribute s_login_attributes[] = {
 
 struct apihandler_data s_apihandler_debug = {{"debug", "data", false, 0, 0, 0UL}, s_debug_attributes, sizeof(struct debug), (void (*)(void *)) glue_get_debug, (void (*)(void *)) glue_set_debug};
 struct apihandler_data s_apihandler_state = {{"state", "data", false, 0, 0, 0UL}, s_state_attributes, sizeof(struct state), (void (*)(void *)) glue_get_state, (void (*)(void *)) glue_set_state};
+struct apihandler_custom s_apihandler_timeseries = {{"timeseries", "custom", true, 0, 0, 0UL}, NULL};
+struct apihandler_websocket s_apihandler_stream = {{"stream", "websocket", false, 0, 0, 0UL}, NULL};
 struct apihandler_action s_apihandler_steering_button_pressed = {{"steering_button_pressed", "action", false, 0, 0, 0UL}, glue_check_steering_button_pressed, glue_start_steering_button_pressed};
 struct apihandler_data s_apihandler_login = {{"login", "data", false, 0, 0, 0UL}, s_login_attributes, sizeof(struct login), (void (*)(void *)) glue_get_login, (void (*)(void *)) glue_set_login};
 
@@ -224,6 +237,8 @@ static struct apihandler *s_apihandlers[] = {
   (struct apihandler *) &s_apihandler_debug,
   (struct apihandler *) &s_apihandler_state,
   (struct apihandler *) &s_apihandler_steering_button_pressed,
+  (struct apihandler *) &s_apihandler_stream,
+  (struct apihandler *) &s_apihandler_timeseries,
   (struct apihandler *) &s_apihandler_login
 };
 
@@ -517,23 +532,78 @@ static void populate_struct_from_json(struct mg_str json, char *tmp,
   }
 }
 
+// The serialized object is cached and reused for every GET until the structure
+// or s_device_change_version changes, so polling dashboards do not serialize
+// the same state over and over. The getter runs on every request and its result
+// is compared with the structure the cache was rendered from, a difference
+// bumps the version, so the response is never older than the getter. The
+// version is also the ETag, clients that send it back in If-None-Match get a
+// 304 without a body.
 static void handle_object(struct mg_connection *c, struct mg_http_message *hm,
                           struct apihandler_data *h) {
+  bool write = hm->body.len > 0 && h->data_size > 0;
   void *data = mg_calloc(1, h->data_size);
+  if (data == NULL) {
+    mg_http_reply(c, 500, JSON_HEADERS, "null\n");
+    return;
+  }
   h->getter(data);
-  if (hm->body.len > 0 && h->data_size > 0) {
-    char *tmp = mg_calloc(1, h->data_size);
-    memcpy(tmp, data, h->data_size);
-    populate_struct_from_json(hm->body, tmp, h->attributes);
-    // If structure changes, increment version
-    if (memcmp(data, tmp, h->data_size) != 0) s_device_change_version++;
-    if (h->setter != NULL) h->setter(tmp);  // Can be NULL if readonly
-    mg_free(tmp);
-    h->getter(data);  // Re-sync again after setting
+  if (h->cache_data != NULL && h->cache_version == s_device_change_version &&
+      memcmp(data, h->cache_data, h->data_size) != 0) {
+    s_device_change_version++;
+  }
+  if (write || h->cache == NULL || h->cache_version != s_device_change_version) {
+    if (write) {
+      char *tmp = mg_calloc(1, h->data_size);
+      memcpy(tmp, data, h->data_size);
+      populate_struct_from_json(hm->body, tmp, h->attributes);
+      // If structure changes, increment version
+      if (memcmp(data, tmp, h->data_size) != 0) s_device_change_version++;
+      if (h->setter != NULL) h->setter(tmp);  // Can be NULL if readonly
+      mg_free(tmp);
+      h->getter(data);  // Re-sync again after setting
+    }
+    mg_free(h->cache);
+    h->cache_len = mg_snprintf(NULL, 0, "{%M}\n", print_struct, h->attributes,
+                               data, 0);
+    h->cache = (char *) mg_calloc(1, h->cache_len + 1);
+    if (h->cache != NULL) {
+      mg_snprintf(h->cache, h->cache_len + 1, "{%M}\n", print_struct,
+                  h->attributes, data, 0);
+    }
+    // The rendered structure is kept instead of freed
+    mg_free(h->cache_data);
+    h->cache_data = data;
+    data = NULL;
+    h->cache_version = s_device_change_version;
+    h->stats.rendered++;
   }
-  mg_http_reply(c, 200, JSON_HEADERS, "{%M}\n", print_struct, h->attributes,
-                data, 0);
   mg_free(data);
+
+  char etag[32], headers[128];
+  struct mg_str *inm = mg_http_get_header(hm, "If-None-Match");
+  mg_snprintf(etag, sizeof(etag), "\"%lx-%lu\"", s_boot_id, h->cache_version);
+  mg_snprintf(headers, sizeof(headers), "%sETag: %s\r\n", JSON_HEADERS, etag);
+  if (!write && inm != NULL && mg_strcmp(*inm, mg_str(etag)) == 0) {
+    mg_http_reply(c, 304, headers, "");
+    h->stats.not_modified++;
+  } else if (h->cache != NULL) {
+    mg_http_reply(c, 200, headers, "%s", h->cache);
+    h->stats.served++;
+  } else {
+    mg_http_reply(c, 500, JSON_HEADERS, "null\n");
+  }
+}
+
+bool mongoose_http_cache_stats(const char *name,
+                               struct mongoose_http_cache_stats *stats) {
+  struct apihandler *h = get_api_handler(mg_str(name));
+  if (h == NULL || (strcmp(h->type, "object") != 0 &&
+                    strcmp(h->type, "data") != 0)) {
+    return false;
+  }
+  *stats = ((struct apihandler_data *) h)->stats;
+  return true;
 }
 
 static size_t print_array(void (*out)(char, void *), void *ptr, va_list *ap) {
@@ -665,6 +735,8 @@ static void handle_api_call(struct mg_connection *c, struct mg_http_message *hm,
     struct websocket_state *s = (struct websocket_state *) c->data;
     s->marker = CONN_WEBSOCKET;
     s->h = (struct apihandler_websocket *) h;
+    s->last_sent = 0;
+    s->stale = true;
     mg_ws_upgrade(c, hm, NULL);
   } else {
     mg_http_reply(c, 500, JSON_HEADERS, "API type %s unknown\n", h->type);
@@ -696,6 +768,105 @@ struct custom_api_handler *find_custom_handler(struct mg_http_message *hm) {
   return NULL;
 }
 
+#if WIZARD_ENABLE_HTTP_UI
+// Web UI file being sent straight out of flash
+struct asset_state {
+  char marker;       // Tells that we're sending a packed file
+  const char *data;  // Part of the file that is not queued yet
+  size_t len;
+};
+
+// Part of the web UI ETag. Packed files keep their timestamp when only the
+// firmware changes, so a new build has to invalidate them too.
+static const char s_build_time[] = __DATE__ " " __TIME__;
+
+static const char *asset_content_type(const char *path) {
+  struct mg_str p = mg_str(path);
+  if (mg_match(p, mg_str("#.html"), NULL)) return "text/html; charset=utf-8";
+  if (mg_match(p, mg_str("#.js"), NULL)) return "text/javascript; charset=utf-8";
+  if (mg_match(p, mg_str("#.css"), NULL)) return "text/css; charset=utf-8";
+  if (mg_match(p, mg_str("#.svg"), NULL)) return "image/svg+xml";
+  if (mg_match(p, mg_str("#.json"), NULL)) return "application/json";
+  if (mg_match(p, mg_str("#.png"), NULL)) return "image/png";
+  if (mg_match(p, mg_str("#.ico"), NULL)) return "image/x-icon";
+  return "application/octet-stream";
+}
+
+// Serves the gzip file stored in the packed filesystem as is, without
+// unpacking it and without opening it through mg_fs (which allocates a file
+// handle and reads it into the send buffer through a bounce copy). Every
+// browser accepts gzip, so Accept-Encoding is not checked. index.html is
+// revalidated on every load (answered with 304 until the firmware changes),
+// everything else is cached by the browser for a week.
+// Returns false if there is no packed gzip file for the URI.
+static bool serve_packed_asset(struct mg_connection *c,
+                               struct mg_http_message *hm) {
+  char path[MG_PATH_MAX], gz[MG_PATH_MAX + 3], etag[48], cache[160];
+  struct asset_state *as = (struct asset_state *) c->data;
+  struct mg_str *inm = mg_http_get_header(hm, "If-None-Match");
+  struct mg_str file;
+  size_t size = 0;
+  time_t mtime = 0;
+  bool is_html;
+
+  if (hm->uri.len == 0 || hm->uri.len >= sizeof(path) - 10) return false;
+  mg_snprintf(path, sizeof(path), "/web_root%.*s%s", (int) hm->uri.len,
+              hm->uri.buf, hm->uri.buf[hm->uri.len - 1] == '/' ? "index.html" : "");
+  mg_snprintf(gz, sizeof(gz), "%s.gz", path);
+
+  mg_mem_files = mg_packed_files;
+  file = mg_unpacked(gz);
+  if (file.buf == NULL || mg_fs_packed.st(gz, &size, &mtime) == 0) return false;
+
+  mg_snprintf(etag, sizeof(etag), "\"%lx-%lx-%lx\"",
+              (unsigned long) mg_crc32(0, s_build_time, sizeof(s_build_time) - 1),
+              (unsigned long) mtime, (unsigned long) file.len);
+  is_html = mg_match(mg_str(path), mg_str("#.html"), NULL);
+  // A 304 carries the same validator and caching headers as the 200, so the
+  // browser keeps caching the file the same way after it revalidates it
+  mg_snprintf(cache, sizeof(cache),
+              "Cache-Control: %s\r\nEtag: %s\r\nVary: Accept-Encoding\r\n",
+              is_html ? "no-cache" : "public, max-age=604800", etag);
+
+  if (inm != NULL && mg_strcasecmp(*inm, mg_str(etag)) == 0) {
+    mg_http_reply(c, 304, cache, "");  // mg_http_reply() ends the response
+    return true;
+  }
+
+  mg_printf(c,
+            "HTTP/1.1 200 OK\r\n"
+            "Content-Type: %s\r\n"
+            "Content-Encoding: gzip\r\n"
+            "%s"
+            "Content-Length: %lu\r\n\r\n",
+            asset_content_type(path), cache, (unsigned long) file.len);
+
+  if (mg_strcasecmp(hm->method, mg_str("HEAD")) == 0) {
+    c->is_resp = 0;
+  } else {
+    // The body is queued from flash a send buffer at a time on MG_EV_POLL and
+    // MG_EV_WRITE, is_resp holds back pipelined requests until it is all sent
+    as->marker = CONN_ASSET;
+    as->data = file.buf;
+    as->len = file.len;
+  }
+  return true;
+}
+
+static void send_packed_asset(struct mg_connection *c) {
+  struct asset_state *as = (struct asset_state *) c->data;
+  size_t n = as->len;
+  if (c->send.len >= MG_IO_SIZE) return;  // Socket has not taken it all yet
+  if (n > MG_IO_SIZE - c->send.len) n = MG_IO_SIZE - c->send.len;
+  mg_send(c, as->data, n);
+  as->data += n, as->len -= n;
+  if (as->len == 0) {
+    memset(as, 0, sizeof(*as));
+    c->is_resp = 0;  // Mark response end
+  }
+}
+#endif  // WIZARD_ENABLE_HTTP_UI
+
 // Mongoose event handler function, gets called by the mg_mgr_poll()
 static void http_ev_handler(struct mg_connection *c, int ev, void *ev_data) {
   if (ev == MG_EV_HTTP_HDRS && c->data[0] == 0) {
@@ -732,6 +903,11 @@ static void http_ev_handler(struct mg_connection *c, int ev, void *ev_data) {
       mg_http_reply(c, 200, JSON_HEADERS, "true");
       memset(as, 0, sizeof(*as));
     }
+#if WIZARD_ENABLE_HTTP_UI
+  } else if ((ev == MG_EV_POLL || ev == MG_EV_WRITE) && c->is_websocket == 0 &&
+             c->data[0] == CONN_ASSET) {
+    send_packed_asset(c);
+#endif
   } else if ((ev == MG_EV_READ || ev == MG_EV_CLOSE) && c->is_websocket == 0 &&
              (c->data[0] == CONN_OTA || c->data[0] == CONN_FILE_UPLOAD)) {
     do_upload(c, ev);
@@ -764,13 +940,15 @@ static void http_ev_handler(struct mg_connection *c, int ev, void *ev_data) {
 #endif  // WIZARD_ENABLE_HTTP || WIZARD_ENABLE_HTTPS
     {
 #if WIZARD_ENABLE_HTTP_UI
-      struct mg_http_serve_opts opts;
-      memset(&opts, 0, sizeof(opts));
-      opts.root_dir = "/web_root/";
-      opts.fs = &mg_fs_packed;
-      opts.extra_headers = NO_CACHE_HEADERS;
-      mg_mem_files = mg_packed_files;
-      mg_http_serve_dir(c, hm, &opts);
+      if (!serve_packed_asset(c, hm)) {
+        struct mg_http_serve_opts opts;
+        memset(&opts, 0, sizeof(opts));
+        opts.root_dir = "/web_root/";
+        opts.fs = &mg_fs_packed;
+        opts.extra_headers = NO_CACHE_HEADERS;
+        mg_mem_files = mg_packed_files;
+        mg_http_serve_dir(c, hm, &opts);
+      }
 #else
       mg_http_reply(c, 200, "", ":)\n");
 #endif  // WIZARD_ENABLE_HTTP_UI
@@ -836,6 +1014,49 @@ int mongoose_ws_printf(const char *api_name, const char *fmt, ...) {
   return result;
 }
 
+int mongoose_ws_stream(const char *api_name, unsigned min_interval_ms,
+                       size_t max_backlog, bool changed,
+                       mongoose_ws_stream_print_fn print_fn, void *userdata) {
+  struct apihandler_websocket *h =
+      (struct apihandler_websocket *) get_api_handler(mg_str(api_name));
+  static char delta[512], full[512];
+  size_t delta_len = 0, full_len = 0;
+  uint64_t now = mg_millis();
+  int result = 0;
+  struct mg_connection *c;
+
+  if (h == NULL) return 0;
+  for (c = g_mgr.conns; c != NULL; c = c->next) {
+    struct websocket_state *s = (struct websocket_state *) c->data;
+    if (c->is_websocket == 0 || s->marker != CONN_WEBSOCKET || s->h != h) {
+      continue;
+    }
+    result++;
+
+    // Slow client, skip it. If it missed an update, resync it with a full frame
+    if (c->send.len > max_backlog || now - s->last_sent < min_interval_ms) {
+      if (changed) s->stale = true;
+      continue;
+    }
+
+    // Frames are only serialized if at least one client needs them
+    if (s->stale) {
+      if (full_len == 0) full_len = print_fn(userdata, full, sizeof(full), true);
+      mg_ws_send(c, full, full_len, WEBSOCKET_OP_TEXT);
+      s->stale = false;
+    } else if (changed) {
+      if (delta_len == 0) {
+        delta_len = print_fn(userdata, delta, sizeof(delta), false);
+      }
+      mg_ws_send(c, delta, delta_len, WEBSOCKET_OP_TEXT);
+    } else {
+      continue;
+    }
+    s->last_sent = now;
+  }
+  return result;
+}
+
 #if WIZARD_ENABLE_WEBSOCKET
 struct ws_handler {
   unsigned timeout_ms;
@@ -1097,6 +1318,9 @@ void mongoose_set_wifi_handler(mg_tcpip_event_handler_t eh) {
 
 void mongoose_init(void) {
   mg_mgr_init(&g_mgr);      // Initialise event manager
+#if WIZARD_ENABLE_HTTP || WIZARD_ENABLE_HTTPS
+  mg_random(&s_boot_id, sizeof(s_boot_id));
+#endif
   mg_log_set(MG_LL_DEBUG);  // Set log level to debug
 
 #if WIZARD_DNS_TYPE == 2
@@ -0,0 +1,133 @@
+// ####################################################################################################################
+//
+// Code part of CarCluster project by Andrej Rolih. See .ino file more details
+//
+// Runs BlinkerGenerator (CarCluster/src/Other/BlinkerGenerator.cpp) with irregular tick intervals (like a loop that
+// sometimes stalls) and checks the lamp against the ideal flasher: every sample has the state of the ideal rhythm at
+// its time, every lamp change is seen in the tick that follows the ideal change, the number of flashes per minute
+// does not depend on the tick rate, left/right/hazard share one phase and the cycle restarts lit. Runs on the
+// computer, not on the ESP32:
+//
+//   g++ -std=c++11 -ITools/host -o blinker Tools/blinker.cpp && ./blinker
+//
+// ####################################################################################################################
+
+#include "Arduino.h"
+
+#include "../CarCluster/src/Other/BlinkerGenerator.cpp"
+
+#include "HostCheck.h"
+
+// The ideal flasher: lit for onTime at the start of every period since start
+static bool idealLamp(unsigned long start, unsigned long period, unsigned long onTime, unsigned long time) {
+  return (time - start) % period < onTime;
+}
+
+// Blinks for the given time with ticks minimumTick to maximumTick ms apart (and a 2 s stall now and then),
+// returns the number of flashes seen. Every flash of the ideal flasher has to be seen unless a stall covered all of it.
+static uint32_t blink(BlinkerGenerator &blinker, unsigned long period, unsigned long onTime, unsigned long duration,
+                      long minimumTick, long maximumTick, bool stalls) {
+  unsigned long start = 5000 + random(10000);
+  unsigned long time = start, previousTime = start;
+  bool previous = false;
+  uint32_t flashes = 0, wrongStates = 0, lateChanges = 0, covered = 0;
+
+  while (time - start < duration) {
+    bool left = true, right = false;       // Indicator changes while blinking, the phase has to stay
+    switch ((time - start) / 3000 % 3) {
+      case 1: left = false; right = true; break;
+      case 2: right = true; break;
+    }
+
+    bool lamp = blinker.lampOnAt(left, right, true, time);
+    if (lamp != idealLamp(start, period, onTime, time)) wrongStates++;
+    // A stall can go from one flash right into another one without seeing the lamp off
+    if (lamp && (!previous || (time - start) / period != (previousTime - start) / period)) flashes++;
+    previous = lamp;
+    previousTime = time;
+
+    unsigned long tick = stalls && random(500) == 0 ? 2000 : random(minimumTick, maximumTick + 1);
+    if (time - start + tick > duration) tick = start + duration - time;
+    for (unsigned long flash = (time - start) / period * period + period; flash + onTime <= time - start + tick; flash += period) {
+      if (onTime > 0) covered++;
+    }
+    // The next change of the ideal flasher has to show up in the tick right after it
+    if (tick < onTime && tick < period - onTime) {
+      unsigned long phase = (time - start) % period;
+      unsigned long nextChange = phase < onTime ? onTime - phase : period - phase;
+      if (tick >= nextChange && idealLamp(start, period, onTime, time + tick) == lamp) lateChanges++;
+    }
+    time += tick;
+  }
+
+  check(wrongStates == 0, "lamp follows the ideal flasher at every tick");
+  check(lateChanges == 0, "every change shows up in the tick after it");
+  check(flashes + covered == (onTime > 0 ? (duration + period - 1) / period : 0), "only flashes a stall covered are missed");
+  blinker.lampOnAt(false, false, true, time);
+  return flashes;
+}
+
+static void testTickRates() {
+  printf("Same rhythm at every tick rate\n");
+
+  BlinkerGenerator blinker;                // 800 ms, 50 %, what the clusters use
+  uint32_t fast = blink(blinker, 800, 400, 60000, 1, 5, false);
+  uint32_t slow = blink(blinker, 800, 400, 60000, 50, 150, false);
+  uint32_t irregular = blink(blinker, 800, 400, 60000, 1, 390, false);
+  printf("   Flashes per minute: %u with 1-5 ms ticks, %u with 50-150 ms ticks, %u with 1-390 ms ticks\n",
+         (unsigned)fast, (unsigned)slow, (unsigned)irregular);
+  check(fast == 75 && slow == 75 && irregular == 75, "75 flashes per minute no matter the tick rate");
+
+  // Stalls longer than a period skip flashes but do not shift the rhythm
+  uint32_t stalled = blink(blinker, 800, 400, 600000, 1, 100, true);
+  printf("   Flashes in ten minutes with stalls: %u\n", (unsigned)stalled);
+}
+
+static void testConfiguration() {
+  printf("Other periods and duty cycles\n");
+
+  BlinkerGenerator blinker(660, 40);
+  blink(blinker, 660, 264, 60000, 1, 200, true);
+
+  blinker.configure(1000, 70);
+  blink(blinker, 1000, 700, 60000, 1, 250, true);
+
+  blinker.configure(500, 0);
+  check(!blinker.lampOnAt(true, false, true, 1000) && !blinker.lampOnAt(true, false, true, 1100), "0 % duty is never lit");
+  blinker.lampOnAt(false, false, true, 1200);
+  blinker.configure(500, 150);
+  check(blinker.lampOnAt(true, false, true, 2000) && blinker.lampOnAt(true, false, true, 2499), "duty cycle is clamped to 100 %");
+  blinker.configure(0, 50);
+  check(!blinker.lampOnAt(true, false, true, 3000) && !blinker.lampOnAt(true, false, true, 3001), "zero period does not divide by zero");
+}
+
+static void testStartAndSteady() {
+  printf("Start, stop and steady indicators\n");
+
+  BlinkerGenerator blinker;
+  check(!blinker.lampOnAt(false, false, true, 1000), "no indicator, no lamp");
+  check(blinker.lampOnAt(true, false, true, 1234), "cycle starts lit");
+  check(!blinker.lampOnAt(true, false, true, 1634), "lamp goes off after the on time");
+  check(blinker.lampOnAt(false, true, true, 2034), "switching to the other side keeps the phase");
+  check(!blinker.lampOnAt(true, true, true, 2434), "hazard keeps the phase");
+
+  // Indicator off and on again restarts lit, also in the middle of the old off time
+  check(!blinker.lampOnAt(false, false, true, 2500), "indicator off, lamp off");
+  check(blinker.lampOnAt(true, false, true, 2550), "restarted cycle starts lit");
+  check(!blinker.lampOnAt(true, false, true, 2950), "restarted cycle has its own phase");
+
+  // The game blinks itself: lit while the indicator is on, and blinking starts a fresh cycle afterwards
+  check(blinker.lampOnAt(true, false, false, 3000) && blinker.lampOnAt(true, false, false, 3400), "game controlled indicator is steady");
+  check(blinker.lampOnAt(true, false, true, 3401), "blinking after steady starts lit");
+  check(!blinker.lampOnAt(true, false, true, 3801), "and keeps its own phase");
+}
+
+int main() {
+  randomSeed(1);
+
+  testTickRates();
+  testConfiguration();
+  testStartAndSteady();
+
+  return hostCheckResult();
+}
@@ -0,0 +1,47 @@
+// ####################################################################################################################
+//
+// Code part of CarCluster project by Andrej Rolih. See .ino file more details
+//
+// Prints the CAN bus load and worst case frame response times of every cluster frame schedule
+// (CarCluster/src/Clusters/ClusterBusSchedules.h). Runs on the computer, not on the ESP32:
+//
+//   g++ -std=c++11 -o busload Tools/busload.cpp && ./busload
+//
+// ####################################################################################################################
+
+#include <stdio.h>
+
+#include "../CarCluster/src/Clusters/ClusterBusSchedules.h"
+
+static void printBus(const CanBusLoad::Bus &bus) {
+  uint32_t load = CanBusLoad::utilization(bus);
+  printf("%s, %u kbit/s: %u frames, load %u.%02u%% (budget %u%%)%s\n", bus.name, bus.bitrate, bus.frameCount,
+         load / 10000, (load / 100) % 100, static_cast<unsigned>(CanBusLoad::utilizationBudget / 10000),
+         CanBusLoad::withinBudget(bus) ? "" : " - OVER BUDGET");
+  printf("   ID        DLC  period  bits  transmission  worst response\n");
+
+  for (uint8_t i = 0; i < bus.frameCount; i++) {
+    const CanBusLoad::Frame &frame = bus.frames[i];
+    uint32_t response = CanBusLoad::responseTime(bus, i);
+    printf("   0x%-8X %u  %4u ms  %4u  %7u us  %9u us%s\n", frame.id, frame.dlc, frame.period, CanBusLoad::frameBits(frame),
+           CanBusLoad::transmissionTime(bus, i), response, response > CanBusLoad::deadline(bus, i) ? " - MISSES DEADLINE" : "");
+  }
+  printf("\n");
+}
+
+template <size_t N>
+static void printBuses(const CanBusLoad::Bus (&buses)[N]) {
+  for (size_t i = 0; i < N; i++) printBus(buses[i]);
+}
+
+int main() {
+  printBuses(bmwFSeriesBuses);
+  printBuses(vwMQBBuses);
+  printBuses(vwPQ25Buses);
+  printBuses(vwPQ46Buses);
+  printBuses(bmwESeriesBuses);
+  printBuses(bmwE46Buses);
+  printBuses(mercedesW204Buses);
+  printBuses(mercedesW221Buses);
+  return 0;
+}
@@ -0,0 +1,187 @@
+// ####################################################################################################################
+//
+// Code part of CarCluster project by Andrej Rolih. See .ino file more details
+//
+// Checks GaugeCalibration (CarCluster/src/Other/GaugeCalibration.cpp) on the curves of the clusters and on random
+// curves: every calibration point is hit exactly, inputs outside the points are clamped at both ends, a monotonic set of
+// points gives a monotonic curve and every output is the exact interpolation rounded to the nearest value. Also checks
+// that invalid points are rejected. Runs on the computer, not on the ESP32:
+//
+//   g++ -std=c++11 -O2 -ITools/host -o calibration Tools/calibration.cpp && ./calibration
+//
+// ####################################################################################################################
+
+#include "Arduino.h"
+
+#include "../CarCluster/src/Other/GaugeCalibration.cpp"
+
+#include "HostCheck.h"
+
+// Exact interpolation of the points, rounded to the nearest output (halves away from the start of the segment)
+static int64_t reference(const GaugeCalibration &curve, int64_t input) {
+  uint8_t last = curve.pointCount() - 1;
+  if (input <= curve.pointInput(0)) return curve.pointOutput(0);
+  if (input >= curve.pointInput(last)) return curve.pointOutput(last);
+  uint8_t segment = 0;
+  while (input >= curve.pointInput(segment + 1)) segment++;
+
+  long double inputStart = curve.pointInput(segment), outputStart = curve.pointOutput(segment);
+  long double value = outputStart + (curve.pointOutput(segment + 1) - outputStart) * (input - inputStart) /
+                                    (curve.pointInput(segment + 1) - inputStart);
+  long double offset = value - outputStart;
+  return (int64_t)outputStart + (int64_t)(offset >= 0 ? floorl(offset + 0.5L) : -floorl(-offset + 0.5L));
+}
+
+static bool monotonicPoints(const GaugeCalibration &curve) {
+  bool rising = true, falling = true;
+  for (uint8_t i = 1; i < curve.pointCount(); i++) {
+    rising = rising && curve.pointOutput(i) >= curve.pointOutput(i - 1);
+    falling = falling && curve.pointOutput(i) <= curve.pointOutput(i - 1);
+  }
+  return rising || falling;
+}
+
+// Checks one curve at every input of its range (or evenly spread inputs for wide ranges)
+static void checkCurve(const char *name, const GaugeCalibration &curve) {
+  uint8_t last = curve.pointCount() - 1;
+  bool points = true;
+  for (uint8_t i = 0; i <= last; i++) points = points && curve.apply(curve.pointInput(i)) == curve.pointOutput(i);
+
+  bool clamped = curve.apply(INT32_MIN) == curve.pointOutput(0) && curve.apply(INT32_MAX) == curve.pointOutput(last);
+  if (curve.pointInput(0) > INT32_MIN) clamped = clamped && curve.apply(curve.pointInput(0) - 1) == curve.pointOutput(0);
+  if (curve.pointInput(last) < INT32_MAX) clamped = clamped && curve.apply(curve.pointInput(last) + 1) == curve.pointOutput(last);
+
+  int64_t first = curve.pointInput(0), end = curve.pointInput(last);
+  int64_t step = (end - first) / 200000 + 1;
+  bool exact = true, monotonic = true;
+  int64_t previous = curve.apply(first);
+  int direction = curve.pointOutput(last) >= curve.pointOutput(0) ? 1 : -1;
+  for (int64_t input = first; input <= end; input += step) {
+    int64_t output = curve.apply((int32_t)input);
+    exact = exact && output == reference(curve, input);
+    monotonic = monotonic && (output - previous) * direction >= 0;
+    previous = output;
+  }
+
+  char description[160];
+  snprintf(description, sizeof(description), "%s: apply(pointInput(i)) == pointOutput(i)", name);
+  check(points, description);
+  snprintf(description, sizeof(description), "%s: clamped at both ends", name);
+  check(clamped, description);
+  snprintf(description, sizeof(description), "%s: exact interpolation rounded to the nearest output", name);
+  check(exact, description);
+  if (monotonicPoints(curve)) {
+    snprintf(description, sizeof(description), "%s: monotonic", name);
+    check(monotonic, description);
+  }
+}
+
+static void testClusterCurves() {
+  printf("Cluster curves\n");
+  checkCurve("identity", GaugeCalibration());
+  checkCurve("MQB coolant", GaugeCalibration(50, 130, 0x80, 0xED));
+  checkCurve("W204 coolant", GaugeCalibration(40, 120, 77, 161));
+  checkCurve("W204 fuel", GaugeCalibration(0, 100, 240, 0));
+  checkCurve("W221 fuel A", GaugeCalibration(0, 40, 210, 0));
+  checkCurve("W221 fuel B", GaugeCalibration(40, 100, 210, 20));
+  checkCurve("BMW F RPM", GaugeCalibration(0, 6900, 0x00, 0x2B));
+  checkCurve("speed", GaugeCalibration(0, 229, 0, 260));
+
+  GaugeCalibration fuel;
+  const int32_t fuelInputs[] = { 0, 50, 100 };
+  const int32_t fuelOutputs[] = { 37, 18, 4 };
+  check(fuel.setPoints(fuelInputs, fuelOutputs, 3), "BMW F fuel curve is valid");
+  checkCurve("BMW F fuel", fuel);
+}
+
+static void testCorners() {
+  printf("Corners\n");
+  // A sharp corner between two steep segments used to be rounded off by the table
+  GaugeCalibration corner;
+  const int32_t inputs[] = { 0, 1000, 1003, 10000 };
+  const int32_t outputs[] = { 0, 10, 250, 255 };
+  check(corner.setPoints(inputs, outputs, 4), "corner curve is valid");
+  checkCurve("corner", corner);
+  check(corner.apply(1001) == 90 && corner.apply(1002) == 170, "steep segment is followed between its points");
+
+  GaugeCalibration peak;
+  const int32_t peakInputs[] = { -50, 0, 1, 50 };
+  const int32_t peakOutputs[] = { -100, 100, -100, 100 };
+  check(peak.setPoints(peakInputs, peakOutputs, 4), "peak curve is valid");
+  checkCurve("peak", peak);
+}
+
+static void testRandomCurves() {
+  printf("Random curves\n");
+  randomSeed(37);
+  bool points = true, clamped = true, exact = true, monotonic = true;
+  for (int curveIndex = 0; curveIndex < 2000; curveIndex++) {
+    uint8_t count = random(2, GaugeCalibration::maximumPoints + 1);
+    bool rising = curveIndex % 2 == 0;
+    int32_t inputs[GaugeCalibration::maximumPoints], outputs[GaugeCalibration::maximumPoints];
+    int32_t input = random(-10000, 10000), output = random(-10000, 10000);
+    for (uint8_t i = 0; i < count; i++) {
+      inputs[i] = input;
+      outputs[i] = output;
+      input += random(1, curveIndex % 3 == 0 ? 5 : 3000);
+      output += (rising ? 1 : -1) * random(0, curveIndex % 5 == 0 ? 100000 : 300);
+    }
+    GaugeCalibration curve;
+    if (!check(curve.setPoints(inputs, outputs, count), "random curve is valid")) continue;
+
+    for (uint8_t i = 0; i < count; i++) points = points && curve.apply(inputs[i]) == outputs[i];
+    clamped = clamped && curve.apply(inputs[0] - 1) == outputs[0] && curve.apply(inputs[count - 1] + 1) == outputs[count - 1];
+    int32_t previous = curve.apply(inputs[0]);
+    for (int32_t value = inputs[0]; value <= inputs[count - 1]; value++) {
+      int32_t result = curve.apply(value);
+      exact = exact && result == reference(curve, value);
+      monotonic = monotonic && (rising ? result >= previous : result <= previous);
+      previous = result;
+    }
+  }
+  check(points, "random curves: apply(pointInput(i)) == pointOutput(i)");
+  check(clamped, "random curves: clamped at both ends");
+  check(exact, "random curves: exact interpolation rounded to the nearest output");
+  check(monotonic, "random curves: monotonic");
+}
+
+static void testWideRanges() {
+  printf("Wide ranges\n");
+  GaugeCalibration wide;
+  const int32_t inputs[] = { INT32_MIN, -1, 0, INT32_MAX };
+  const int32_t outputs[] = { -1000000000, 1000000000, -1000000000, 1000000000 };
+  check(wide.setPoints(inputs, outputs, 4), "segments of maximumSpan are valid");
+  checkCurve("wide", wide);
+
+  const int32_t tooWideInputs[] = { -1, INT32_MAX };
+  const int32_t tooWideOutputs[] = { 0, 1 };
+  check(!wide.setPoints(tooWideInputs, tooWideOutputs, 2), "input span over maximumSpan is rejected");
+  const int32_t steepInputs[] = { 0, 1 };
+  const int32_t steepOutputs[] = { INT32_MIN, INT32_MAX };
+  check(!wide.setPoints(steepInputs, steepOutputs, 2), "output span over maximumSpan is rejected");
+  check(wide.pointCount() == 4 && wide.apply(0) == -1000000000, "rejected points keep the curve");
+}
+
+static void testInvalidPoints() {
+  printf("Invalid points\n");
+  GaugeCalibration curve(0, 100, 0, 1000);
+  const int32_t inputs[] = { 0, 10, 20, 30, 40, 50, 60, 70, 80 };
+  const int32_t outputs[] = { 0, 1, 2, 3, 4, 5, 6, 7, 8 };
+  const int32_t repeatedInputs[] = { 0, 10, 10 };
+  check(!curve.setPoints(inputs, outputs, 1), "one point is rejected");
+  check(!curve.setPoints(inputs, outputs, GaugeCalibration::maximumPoints + 1), "more than maximumPoints is rejected");
+  check(!curve.setPoints(repeatedInputs, outputs, 3), "inputs that do not increase are rejected");
+  check(curve.pointCount() == 2 && curve.apply(50) == 500, "rejected points keep the curve");
+
+  GaugeCalibration degenerate(10, 10, 5, 50);
+  check(degenerate.apply(0) == 5 && degenerate.apply(10) == 5 && degenerate.apply(100) == 5, "degenerate range is constant");
+}
+
+int main() {
+  testClusterCurves();
+  testCorners();
+  testRandomCurves();
+  testWideRanges();
+  testInvalidPoints();
+  return hostCheckResult();
+}
@@ -0,0 +1,240 @@
+// ####################################################################################################################
+//
+// Code part of CarCluster project by Andrej Rolih. See .ino file more details
+//
+// Runs CanBusController (CarCluster/src/Other/CanBusController.cpp) against a fake MCP2515 (Tools/host/HostCan.h)
+// through init failure and backoff, error passive, bus off (reported by the controller and from unacknowledged
+// frames), recovery probes and listen only, and checks the state, the send gate and the counters at every step.
+// Runs on the computer, not on the ESP32:
+//
+//   g++ -std=c++11 -ITools/host -o canbus Tools/canbus.cpp && ./canbus
+//
+// ####################################################################################################################
+
+#include "Arduino.h"
+#include "HostCan.h"
+
+#include "../CarCluster/src/Other/SerialOutput.cpp"
+#include "../CarCluster/src/Other/CanBusController.cpp"
+
+#include "HostCheck.h"
+
+static const INT8U canCs = 5;
+static MCP_CAN CAN(canCs);
+static HostCanController &fake = hostCanController(canCs);
+
+static uint32_t hookedFrames = 0;
+static uintptr_t hookedBus = 0;
+
+static void frameHook(void *context, INT8U direction, INT32U id, INT8U ext, INT8U rtr, INT8U len, const INT8U *buf, INT8U result) {
+  hookedFrames++;
+  hookedBus = (uintptr_t)context;
+}
+
+// Sends a frame like a cluster does (without looking at the controller), returns the send result
+static INT8U sendFrame() {
+  INT8U data[8] = { 1, 2, 3, 4, 5, 6, 7, 8 };
+  return CAN.sendMsgBuf(0x123, 0, 8, data);
+}
+
+// Moves time and calls update() every 10 ms like the loop does, returns true if update() reported the controller up
+static bool run(unsigned long ms, CanBusController &controller) {
+  bool cameUp = false;
+  for (unsigned long elapsed = 0; elapsed < ms; elapsed += 10) {
+    hostAdvance(10000);
+    if (controller.update()) cameUp = true;
+  }
+  return cameUp;
+}
+
+static void testInitBackoff(CanBusController &controller) {
+  printf("Init failure and backoff\n");
+
+  fake.beginResult = CAN_FAILINIT;
+  controller.begin(CAN_500KBPS, frameHook);
+  check(controller.state() == CanBusController::State_Backoff, "failed init goes to backoff");
+  check(controller.attempts() == 1 && fake.beginCalls == 1, "first attempt is made by begin()");
+  check(controller.backoff() == CanBusController::initialBackoff, "first backoff is the initial backoff");
+
+  // Frames sent before the controller is up never reach the MCP2515
+  check(sendFrame() == CAN_FAILTX, "send fails while not initialized");
+  check(fake.sendCalls == 0, "gate stops frames before the controller is touched");
+  check(controller.droppedFrames() == 1, "frame counts as dropped");
+
+  run(90, controller);
+  check(fake.beginCalls == 1, "no attempt before the backoff is over");
+  run(10, controller);
+  check(fake.beginCalls == 2, "second attempt after 100 ms");
+  check(controller.backoff() == 200, "backoff doubles");
+  run(200, controller);
+  check(fake.beginCalls == 3 && controller.backoff() == 400, "third attempt after 200 ms, backoff 400 ms");
+
+  // Backoff is capped
+  for (int i = 0; i < 10; i++) run(controller.backoff(), controller);
+  check(controller.backoff() == CanBusController::maximumBackoff, "backoff is capped at the maximum");
+
+  fake.beginResult = CAN_OK;
+  check(run(CanBusController::maximumBackoff, controller), "update() reports the controller coming up");
+  check(controller.state() == CanBusController::State_Running, "running after a successful attempt");
+  check(controller.readyTime() == millis(), "ready time is recorded");
+  check(controller.backoff() == CanBusController::initialBackoff, "backoff is reset");
+  check(fake.mode == MCP_NORMAL, "controller is in normal mode");
+  check(!run(100, controller), "update() reports the controller coming up only once");
+
+  check(sendFrame() == CAN_OK && fake.sent.size() == 1, "frames are sent once running");
+  check(hookedFrames == 1 && hookedBus == 1, "frame hook gets the sent frame with the bus number");
+}
+
+static void testErrorPassive(CanBusController &controller) {
+  printf("Error passive\n");
+
+  fake.errorFlags = MCP_EFLG_TXEP | MCP_EFLG_TXWAR | MCP_EFLG_EWARN;
+  fake.transmitErrors = 130;
+  run(CanBusController::healthUpdateInterval, controller);
+  check(controller.state() == CanBusController::State_ErrorPassive, "TXEP makes the controller error passive");
+  check(controller.transmitErrors() == 130, "TEC is read");
+  check(controller.isSending(), "error passive still sends");
+  check(sendFrame() == CAN_OK, "frames are sent while error passive");
+
+  fake.errorFlags = 0;
+  fake.transmitErrors = 90;
+  run(CanBusController::healthUpdateInterval, controller);
+  check(controller.state() == CanBusController::State_Running, "back to running when the flags clear");
+
+  fake.errorFlags = MCP_EFLG_RX0OVR | MCP_EFLG_RX1OVR;
+  run(CanBusController::healthUpdateInterval, controller);
+  check(controller.receiveOverflows() == 2, "both receive overflows are counted");
+  check((fake.errorFlags & (MCP_EFLG_RX0OVR | MCP_EFLG_RX1OVR)) == 0, "overflow flags are cleared");
+  run(CanBusController::healthUpdateInterval, controller);
+  check(controller.receiveOverflows() == 2, "cleared overflow is not counted again");
+  check(controller.state() == CanBusController::State_Running, "overflow alone does not change the state");
+}
+
+static void testReportedBusOff(CanBusController &controller) {
+  printf("Bus off reported by the controller, probe and recovery\n");
+
+  fake.errorFlags = MCP_EFLG_TXBO | MCP_EFLG_TXEP;
+  fake.transmitErrors = 255;
+  run(CanBusController::healthUpdateInterval, controller);
+  check(controller.state() == CanBusController::State_BusOff, "TXBO is bus off");
+  check(controller.busOffCount() == 1, "bus off is counted");
+  check(fake.abortCalls == 1, "pending transmissions are aborted");
+  check(!controller.isSending() && controller.isRunning(), "bus off does not send but is still running");
+
+  uint32_t sendCalls = fake.sendCalls;
+  uint32_t dropped = controller.droppedFrames();
+  for (int i = 0; i < 20; i++) sendFrame();
+  check(fake.sendCalls == sendCalls, "no frame reaches the controller while bus off");
+  check(controller.droppedFrames() == dropped + 20, "frames are dropped while bus off");
+
+  // The controller still reports TXBO, the probe waits (128 x 11 recessive bits not seen yet)
+  run(CanBusController::initialBackoff, controller);
+  check(fake.resumeCalls == 0, "no probe while TXBO is still set");
+  check(controller.backoff() == 2 * CanBusController::initialBackoff, "probe backoff doubles");
+  check(sendFrame() == CAN_FAILTX && fake.sendCalls == sendCalls, "frames still dropped");
+
+  // Controller rejoined the bus, the next probe lets one frame through
+  fake.errorFlags = 0;
+  fake.transmitErrors = 0;
+  run(controller.backoff(), controller);
+  check(fake.resumeCalls == 1 && !fake.aborted, "probe resumes transmission");
+  check(controller.state() == CanBusController::State_BusOff, "still bus off until a frame is acknowledged");
+
+  check(sendFrame() == CAN_OK, "probe frame is sent");
+  check(controller.state() == CanBusController::State_Running, "acknowledged probe frame recovers the controller");
+  check(controller.backoff() == CanBusController::initialBackoff, "backoff is reset after recovery");
+  check(sendFrame() == CAN_OK && sendFrame() == CAN_OK, "frames are sent after recovery");
+}
+
+static void testUnacknowledgedBusOff(CanBusController &controller) {
+  printf("Bus off from unacknowledged frames (cluster unplugged), failed probe and recovery\n");
+
+  fake.sendResult = CAN_SENDMSGTIMEOUT;
+  for (uint8_t i = 0; i < CanBusController::sendFailureLimit - 1; i++) sendFrame();
+  check(controller.state() == CanBusController::State_Running, "a few failed sends are tolerated");
+  sendFrame();
+  check(controller.state() == CanBusController::State_BusOff, "a run of failed sends is bus off");
+  check(controller.busOffCount() == 2, "second bus off is counted");
+  check(controller.failedSends() == CanBusController::sendFailureLimit, "failed sends are counted");
+
+  uint32_t sendCalls = fake.sendCalls;
+  sendFrame();
+  check(fake.sendCalls == sendCalls, "no more waiting for send timeouts once bus off");
+
+  // The first probe frame is not acknowledged either
+  run(CanBusController::initialBackoff, controller);
+  check(sendFrame() == CAN_SENDMSGTIMEOUT, "probe frame is let through and times out");
+  check(fake.sendCalls == sendCalls + 1, "exactly one probe frame reaches the controller");
+  check(fake.aborted, "failed probe aborts the transmission");
+  check(controller.backoff() == 2 * CanBusController::initialBackoff, "failed probe doubles the backoff");
+  sendFrame();
+  check(fake.sendCalls == sendCalls + 1, "frames are dropped again after a failed probe");
+
+  // Cluster plugged back in
+  fake.sendResult = CAN_OK;
+  run(controller.backoff() - 10, controller);
+  sendFrame();
+  check(fake.sendCalls == sendCalls + 1, "no probe before the backoff is over");
+  run(10, controller);
+  check(sendFrame() == CAN_OK, "second probe frame is acknowledged");
+  check(controller.state() == CanBusController::State_Running, "recovered");
+
+  // A run of failures that is interrupted by a success does not count
+  fake.sendResult = CAN_SENDMSGTIMEOUT;
+  for (uint8_t i = 0; i < CanBusController::sendFailureLimit - 1; i++) sendFrame();
+  fake.sendResult = CAN_OK;
+  sendFrame();
+  fake.sendResult = CAN_SENDMSGTIMEOUT;
+  for (uint8_t i = 0; i < CanBusController::sendFailureLimit - 1; i++) sendFrame();
+  check(controller.state() == CanBusController::State_Running, "only failures in a row count");
+  fake.sendResult = CAN_OK;
+  sendFrame();
+}
+
+static void testListenOnly(CanBusController &controller) {
+  printf("Listen only\n");
+
+  check(controller.setListenOnly(true), "listen only can be set while running");
+  check(fake.mode == MCP_LISTENONLY && controller.isListenOnly(), "controller is in listen only mode");
+  check(!controller.isSending(), "listen only does not send");
+
+  uint32_t sendCalls = fake.sendCalls;
+  uint32_t dropped = controller.droppedFrames();
+  check(sendFrame() == CAN_FAILTX && fake.sendCalls == sendCalls, "frames are dropped by the gate");
+  check(controller.droppedFrames() == dropped + 1, "dropped frame is counted");
+
+  INT8U data[2] = { 0xAA, 0x55 };
+  INT32U id;
+  INT8U length, buffer[8];
+  uint32_t hooked = hookedFrames;
+  fake.receive(0x1A0, 2, data);
+  check(CAN.readMsgBuf(&id, &length, buffer) == CAN_OK && id == 0x1A0 && length == 2, "frames are still received");
+  check(hookedFrames == hooked + 1, "received frame goes through the frame hook");
+
+  check(controller.setListenOnly(false) && fake.mode == MCP_NORMAL, "back to normal mode");
+  check(sendFrame() == CAN_OK, "frames are sent again");
+
+  fake.modeResult = MCP2515_FAIL;
+  check(!controller.setListenOnly(true) && !controller.isListenOnly(), "failed mode change is not recorded");
+  fake.modeResult = MCP2515_OK;
+}
+
+int main() {
+  serialOutput.setMuted(true);
+
+  CanBusController controller(CAN, 1);
+  testInitBackoff(controller);
+  testErrorPassive(controller);
+  testReportedBusOff(controller);
+  testUnacknowledgedBusOff(controller);
+  testListenOnly(controller);
+
+  // Listen only needs an initialized controller
+  MCP_CAN CAN2(canCs + 1);
+  hostCanController(canCs + 1).beginResult = CAN_FAILINIT;
+  CanBusController controller2(CAN2, 2);
+  controller2.begin(CAN_500KBPS, frameHook);
+  check(!controller2.setListenOnly(true), "listen only is refused before the controller is up");
+
+  return hostCheckResult();
+}
@@ -0,0 +1,99 @@
+// ####################################################################################################################
+//
+// Code part of CarCluster project by Andrej Rolih. See .ino file more details
+//
+// Runs DistanceIntegrator (CarCluster/src/Other/DistanceIntegrator.cpp) with the constants of every cluster that uses
+// it over simulated hours: one hour at a constant speed with irregular update intervals has to give exactly the
+// units the cluster wants per km, and ten hours of random speeds, update intervals and stalls have to match an
+// independent running total after every update (no unit lost to rounding, wrap at the cluster's limit). Runs on the
+// computer, not on the ESP32:
+//
+//   g++ -std=c++11 -O2 -ITools/host -o distance Tools/distance.cpp && ./distance
+//
+// ####################################################################################################################
+
+#include "Arduino.h"
+
+#include "../CarCluster/src/Other/DistanceIntegrator.cpp"
+
+#include "HostCheck.h"
+
+struct Counter {
+  const char *name;
+  uint32_t numerator;
+  uint32_t denominator;
+  uint32_t wrap;
+  uint32_t rateAt100;                      // Rate the cluster passes at 100 km/h
+  uint32_t maximumRate;
+  uint64_t unitsPerHourAt100;              // What one hour at 100 km/h has to give
+};
+
+// Same constants as the clusters
+static const Counter counters[] = {
+  { "VW MQB ESP_24", 44708, DistanceIntegrator::msPerHour * 100, 30000, 10000, 30000, 4470800 },
+  { "BMW F distance", 104400, DistanceIntegrator::msPerHour, 0x10000, 100, 300, 10440000 },
+  { "VW PQ25/PQ46 distance", 1, 182, 30000, 100, 300, 360000000 / 182 },
+  { "BMW E speed sum", 1, 100, 0x10000, 100, 300, 3600000 },
+  { "BMW E time x pi", 355, 113, 0x1000, 1, 1, 3600000ULL * 355 / 113 },
+  { "32 bit wrap", 1, 1, 0, 100, 100000, 360000000 },
+};
+
+static uint32_t wrapped(uint64_t units, uint32_t wrap) {
+  return wrap > 0 ? units % wrap : (uint32_t)units;
+}
+
+static void testConstantHour(const Counter &counter) {
+  DistanceIntegrator integrator(counter.numerator, counter.denominator, counter.wrap);
+  uint64_t start = hostTime;
+  integrator.update(counter.rateAt100);    // First call only starts the clock
+
+  uint32_t previous = 0;
+  uint64_t wraps = 0;
+  while (hostTime - start < 3600ULL * 1000000) {
+    hostAdvance(min<uint64_t>(random(1, 120) * 1000ULL, start + 3600ULL * 1000000 - hostTime));
+    uint32_t value = integrator.update(counter.rateAt100);
+    if (value < previous) wraps++;
+    previous = value;
+  }
+
+  uint64_t expectedWraps = counter.wrap > 0 ? counter.unitsPerHourAt100 / counter.wrap : counter.unitsPerHourAt100 >> 32;
+  printf("   %s: %u after one hour at 100 km/h, %u wraps\n", counter.name, (unsigned)integrator.value(), (unsigned)wraps);
+  check(integrator.value() == wrapped(counter.unitsPerHourAt100, counter.wrap), "one hour at 100 km/h gives the units per km");
+  check(wraps == expectedWraps, "counter wraps at the cluster's limit");
+}
+
+static void testRandomHours(const Counter &counter) {
+  DistanceIntegrator integrator(counter.numerator, counter.denominator, counter.wrap);
+  uint64_t total = 0;                      // rate x ms x numerator since the start, in 1 / denominator units
+  uint32_t mismatches = 0;
+  uint32_t rate = 0;
+
+  for (uint64_t elapsed = 0; elapsed < 10 * DistanceIntegrator::msPerHour;) {
+    if (random(200) == 0) rate = random(counter.maximumRate + 1);
+    unsigned long interval = random(20) == 0 ? random(100, 5000) : random(0, 30);  // Now and then a stall
+    elapsed += interval;
+
+    total += (uint64_t)rate * interval * counter.numerator;
+    if (integrator.advance(rate, interval) != wrapped(total / counter.denominator, counter.wrap)) mismatches++;
+  }
+
+  printf("   %s: %llu units in ten hours, %u mismatches\n", counter.name,
+         (unsigned long long)(total / counter.denominator), (unsigned)mismatches);
+  check(mismatches == 0, "counter matches the running total after every update");
+
+  integrator.reset();
+  check(integrator.value() == 0 && integrator.advance(counter.maximumRate, 1) == wrapped((uint64_t)counter.maximumRate *
+        counter.numerator / counter.denominator, counter.wrap), "reset clears the counter and the remainder");
+}
+
+int main() {
+  randomSeed(1);
+
+  printf("One hour at 100 km/h with irregular updates\n");
+  for (const Counter &counter : counters) testConstantHour(counter);
+
+  printf("Ten hours of random speeds, update intervals and stalls\n");
+  for (const Counter &counter : counters) testRandomHours(counter);
+
+  return hostCheckResult();
+}
@@ -0,0 +1,358 @@
+// ####################################################################################################################
+//
+// Code part of CarCluster project by Andrej Rolih. See .ino file more details
+//
+// Runs the telemetry fan-out on a simulated network (Tools/host/AsyncUDP.h): a leader with FanoutPublisher
+// (CarCluster/src/Other/FanoutPublisher.cpp) and several FanoutGame followers (CarCluster/src/Games/FanoutGame.cpp),
+// one on a perfect link and the others on links that lose, duplicate or reorder packets. Checks the received, lost
+// and out of order counters of every follower, that followers end with the leader's state and get every button press
+// (with its hold duration) once, the publisher intervals, sequence number wrap and invalid packets. Also checks
+// GameStateSnapshot (CarCluster/src/Games/GameStateSnapshot.cpp) encode/decode with every field mask. Runs on the
+// computer, not on the ESP32:
+//
+//   g++ -std=c++11 -ITools/host -o fanout Tools/fanout.cpp && ./fanout
+//
+// ####################################################################################################################
+
+#include "Arduino.h"
+#include "AsyncUDP.h"
+
+#include "../CarCluster/src/Other/GaugeCalibration.cpp"
+#include "../CarCluster/src/Games/GameStateSnapshot.cpp"
+#include "../CarCluster/src/Games/FanoutGame.cpp"
+#include "../CarCluster/src/Other/FanoutPublisher.cpp"
+
+#include "HostCheck.h"
+
+static const IPAddress multicastAddress(239, 1, 2, 3);
+static const int port = 5556;
+
+static GameStateSnapshot randomSnapshot() {
+  GameStateSnapshot snapshot;
+  snapshot.speed = random(-300, 400);
+  snapshot.rpm = random(0x10000);
+  snapshot.gear = random(1, 16);
+  snapshot.backlightBrightness = random(100);
+  snapshot.coolantTemperature = random(-40, 200);
+  snapshot.fuelQuantity = random(-10, 200);
+  snapshot.outdoorTemperature = random(-50, 51);
+  snapshot.driveMode = random(8);
+  snapshot.flags = random(1 << 13);
+  snapshot.buttonEvent = random(256);
+  snapshot.buttonHoldDuration = random(0x10000);
+  return snapshot;
+}
+
+static void randomizeGame(GameState &game) {
+  game.speed = random(0, 300);
+  game.rpm = random(0, 8000);
+  game.gear = static_cast<GearState>(random(1, 16));
+  game.backlightBrightness = random(100);
+  game.coolantTemperature = random(50, 131);
+  game.fuelQuantity = random(0, 101);
+  game.outdoorTemperature = random(-50, 51);
+  game.driveMode = random(1, 8);
+  game.ignition = random(2);
+  game.leftTurningIndicator = random(2);
+  game.rightTurningIndicator = random(2);
+  game.turningIndicatorsBlinking = random(2);
+  game.mainLights = random(2);
+  game.handbrake = random(2);
+  game.rearFogLight = random(2);
+  game.frontFogLight = random(2);
+  game.highBeam = random(2);
+  game.doorOpen = random(2);
+  game.offroadLight = random(2);
+  game.absLight = random(2);
+  game.batteryLight = random(2);
+}
+
+static void testSnapshot() {
+  printf("Snapshot encode and decode\n");
+
+  uint8_t buffer[GameStateSnapshot::maximumEncodedSize];
+  uint32_t wrongSizes = 0, wrongValues = 0, acceptedTruncated = 0;
+  for (int i = 0; i < 20000; i++) {
+    GameStateSnapshot snapshot = randomSnapshot();
+    GameStateSnapshot base = randomSnapshot();
+    uint16_t mask = i == 0 ? GameStateSnapshot::allFields : random(1 << GameStateSnapshot::Field_Count);
+
+    size_t length = snapshot.encode(mask, buffer);
+    if (length != GameStateSnapshot::encodedSize(mask)) wrongSizes++;
+
+    // Fields in the mask come from the packet, the others stay
+    GameStateSnapshot decoded = base;
+    if (decoded.decode(buffer, length) != length) wrongSizes++;
+    if ((decoded.changedFields(snapshot) & mask) != 0 || (decoded.changedFields(base) & ~mask) != 0) wrongValues++;
+
+    GameStateSnapshot truncated;
+    if (truncated.decode(buffer, random(length)) != 0) acceptedTruncated++;
+  }
+  check(wrongSizes == 0, "encoded size matches the mask");
+  check(wrongValues == 0, "decode sets exactly the fields in the mask");
+  check(acceptedTruncated == 0, "truncated data is not decoded");
+  check(GameStateSnapshot::encodedSize(GameStateSnapshot::allFields) == GameStateSnapshot::maximumEncodedSize, "all fields fit in maximumEncodedSize");
+
+  uint8_t unknownField[] = { 0x00, 1 << (GameStateSnapshot::Field_Count - 8), 0, 0, 0, 0 };
+  GameStateSnapshot snapshot;
+  check(snapshot.decode(unknownField, sizeof(unknownField)) == 0, "unknown field bits are rejected");
+
+  // Every field is seen as a change on its own
+  bool separate = true;
+  for (uint8_t field = 0; field < GameStateSnapshot::Field_Count; field++) {
+    GameStateSnapshot changed;
+    GameStateSnapshot original = changed;
+    uint8_t encoded[GameStateSnapshot::maximumEncodedSize];
+    GameStateSnapshot donor = randomSnapshot();
+    donor.encode(1 << field, encoded);
+    changed.decode(encoded, GameStateSnapshot::encodedSize(1 << field));
+    if (changed.changedFields(original) != (1 << field) && changed.changedFields(original) != 0) separate = false;
+  }
+  check(separate, "every field has its own change bit");
+
+  // Game state goes through the snapshot and back
+  uint32_t mismatches = 0;
+  for (int i = 0; i < 1000; i++) {
+    GameState game((ClusterConfiguration()));
+    GameState copy((ClusterConfiguration()));
+    randomizeGame(game);
+    GameStateSnapshot::fromGame(game).applyTo(copy);
+    if (GameStateSnapshot::fromGame(copy).changedFields(GameStateSnapshot::fromGame(game)) != 0 ||
+        copy.outdoorTemperature != game.outdoorTemperature || copy.highBeam != game.highBeam) mismatches++;
+  }
+  check(mismatches == 0, "game state survives the snapshot");
+
+  GameStateSnapshot press;
+  press.setButtonEvent({ 3, 1500 });
+  check(press.buttonEvent == 3 && press.buttonHoldDuration == 1500, "button press and hold duration are kept");
+  press.setButtonEvent({ 4, 100000 });
+  check(press.buttonHoldDuration == 0xFFFF, "long hold is clamped");
+  GameState game((ClusterConfiguration()));
+  check(GameStateSnapshot::fromGame(game).buttonEvent == 0, "fromGame() carries no press");
+}
+
+// A follower and what its link does to the packets
+struct Follower {
+  const char *name;
+  uint8_t dropPercent;
+  uint8_t duplicatePercent;
+  uint8_t reorderPercent;                  // Packet is held back and delivered after the next one
+
+  GameState *game;
+  FanoutGame *fanout;
+  AsyncUDP *listener;
+  std::vector<HostUdpPacket> held;
+  uint32_t dropped, duplicated, reordered;
+  uint32_t buttonPosition;
+  std::vector<ButtonEvent> presses;
+};
+
+static Follower followers[] = {
+  { "perfect link", 0, 0, 0, nullptr, nullptr, nullptr, {}, 0, 0, 0, 0, {} },
+  { "10 % lost", 10, 0, 0, nullptr, nullptr, nullptr, {}, 0, 0, 0, 0, {} },
+  { "10 % duplicated", 0, 10, 0, nullptr, nullptr, nullptr, {}, 0, 0, 0, 0, {} },
+  { "10 % reordered", 0, 0, 10, nullptr, nullptr, nullptr, {}, 0, 0, 0, 0, {} },
+};
+
+static void deliver(Follower &follower, const HostUdpPacket &packet, bool impaired) {
+  if (impaired && random(100) < follower.dropPercent) {
+    follower.dropped++;
+    return;
+  }
+  if (impaired && follower.held.empty() && random(100) < follower.reorderPercent) {
+    follower.held.push_back(packet);
+    follower.reordered++;
+    return;
+  }
+
+  hostUdpDeliver(packet, *follower.listener);
+  if (impaired && random(100) < follower.duplicatePercent) {
+    hostUdpDeliver(packet, *follower.listener);
+    follower.duplicated++;
+  }
+  for (const HostUdpPacket &late : follower.held) hostUdpDeliver(late, *follower.listener);
+  follower.held.clear();
+}
+
+static bool samePress(const ButtonEvent &first, const ButtonEvent &second) {
+  return first.button == second.button && first.holdDuration == second.holdDuration;
+}
+
+static void testFollowers() {
+  printf("Leader and followers on lossy links\n");
+
+  GameState leader((ClusterConfiguration()));
+  FanoutPublisher publisher(leader, multicastAddress, port, 20, 1000);
+  ClusterConfiguration configuration;
+  GameState games[] = { GameState(configuration), GameState(configuration), GameState(configuration), GameState(configuration) };
+  FanoutGame fanouts[] = { { games[0], multicastAddress, port }, { games[1], multicastAddress, port },
+                           { games[2], multicastAddress, port }, { games[3], multicastAddress, port } };
+  for (size_t i = 0; i < sizeof(followers) / sizeof(followers[0]); i++) {
+    Follower &follower = followers[i];
+    follower.game = &games[i];
+    follower.fanout = &fanouts[i];
+    follower.fanout->begin();
+    follower.listener = hostUdpListeners.back();
+  }
+
+  std::vector<ButtonEvent> pushed;
+  uint64_t lastStatePacket = 0;
+  uint32_t statePacketsTooClose = 0, lateButtons = 0;
+  size_t delivered = hostUdpSent.size();
+
+  // A minute of driving: the state changes at random, now and then one or two presses
+  for (int tick = 0; tick < 12000; tick++) {
+    hostAdvance(5000);
+    if (random(4) == 0) randomizeGame(leader);
+    uint64_t pressTime = 0;
+    if (random(50) == 0) {
+      for (long presses = random(1, 3); presses > 0; presses--) {
+        ButtonEvent press = { (int)random(1, 10), (unsigned long)(random(3) == 0 ? random(100, 3000) : 0) };
+        leader.pushButtonEvent(press.button, press.holdDuration);
+        pushed.push_back(press);
+      }
+      pressTime = hostTime;
+    }
+    publisher.update();
+
+    for (; delivered < hostUdpSent.size(); delivered++) {
+      const HostUdpPacket &packet = hostUdpSent[delivered];
+      GameStateSnapshot snapshot;
+      snapshot.decode(packet.data.data() + FanoutGame::headerSize, packet.data.size() - FanoutGame::headerSize);
+      if (snapshot.buttonEvent == 0) {
+        if (lastStatePacket != 0 && packet.time - lastStatePacket < 20000) statePacketsTooClose++;
+        lastStatePacket = packet.time;
+      }
+      for (Follower &follower : followers) deliver(follower, packet, true);
+    }
+    if (pressTime != 0 && (hostUdpSent.empty() || hostUdpSent.back().time != pressTime)) lateButtons++;
+
+    for (Follower &follower : followers) {
+      ButtonEvent event;
+      while (follower.game->nextButtonEvent(follower.buttonPosition, event)) follower.presses.push_back(event);
+    }
+  }
+
+  // Last heartbeat goes through on every link
+  hostAdvance(1000000);
+  publisher.update();
+  for (; delivered < hostUdpSent.size(); delivered++) {
+    for (Follower &follower : followers) deliver(follower, hostUdpSent[delivered], false);
+  }
+
+  uint32_t sent = publisher.sentPackets();
+  printf("   %u packets sent, %u button presses\n", (unsigned)sent, (unsigned)pushed.size());
+  check(sent == hostUdpSent.size() && publisher.failedPackets() == 0, "every packet is written");
+  check(statePacketsTooClose == 0, "state packets are at least minimumInterval apart");
+  check(lateButtons == 0, "button press goes out right away");
+
+  GameStateSnapshot leaderSnapshot = GameStateSnapshot::fromGame(leader);
+  for (Follower &follower : followers) {
+    FanoutGame &fanout = *follower.fanout;
+    printf("   %s: %lu received, %lu lost, %lu out of order (%u dropped, %u duplicated, %u reordered)\n", follower.name,
+           fanout.receivedPackets(), fanout.lostPackets(), fanout.outOfOrderPackets(), (unsigned)follower.dropped,
+           (unsigned)follower.duplicated, (unsigned)follower.reordered);
+
+    // A reordered packet is counted lost when the next one overtakes it and out of order when it arrives
+    check(fanout.receivedPackets() == sent - follower.dropped - follower.reordered, "received counter");
+    check(fanout.lostPackets() == follower.dropped + follower.reordered, "lost counter");
+    check(fanout.outOfOrderPackets() == follower.duplicated + follower.reordered, "out of order counter");
+    check(fanout.invalidPackets() == 0 && fanout.decodeErrorCount() == 0, "no invalid packets");
+    check(fanout.packetCount() == fanout.receivedPackets(), "applied packets are counted");
+    check(GameStateSnapshot::fromGame(*follower.game).changedFields(leaderSnapshot) == 0, "follower ends with the leader's state");
+
+    // Presses arrive once, in order and with their hold duration, the lost ones are missing
+    size_t next = 0;
+    bool subsequence = true;
+    for (const ButtonEvent &press : follower.presses) {
+      while (next < pushed.size() && !samePress(pushed[next], press)) next++;
+      if (next == pushed.size()) subsequence = false;
+      else next++;
+    }
+    check(subsequence, "presses arrive in order and at most once");
+    if (follower.dropPercent == 0 && follower.reorderPercent == 0) {
+      bool same = follower.presses.size() == pushed.size();
+      for (size_t i = 0; same && i < pushed.size(); i++) same = samePress(follower.presses[i], pushed[i]);
+      check(same, "every press arrives with its hold duration");
+    }
+  }
+
+  // Nothing changes, only heartbeats
+  size_t packets = hostUdpSent.size();
+  for (int tick = 0; tick < 1000; tick++) {
+    hostAdvance(5000);
+    publisher.update();
+  }
+  check(hostUdpSent.size() - packets == 5, "heartbeat every heartbeatInterval while nothing changes");
+
+  hostUdpFailWrites = true;
+  leader.speed++;
+  hostAdvance(100000);
+  publisher.update();
+  hostUdpFailWrites = false;
+  check(publisher.failedPackets() == 1 && publisher.sentPackets() == sent + 5, "failed write is counted");
+}
+
+static HostUdpPacket packet(uint32_t sequence, const GameStateSnapshot &snapshot, uint8_t version = FanoutGame::protocolVersion) {
+  HostUdpPacket packet = { hostTime, multicastAddress, port, { 'C', 'F', version, 0, (uint8_t)sequence, (uint8_t)(sequence >> 8),
+                           (uint8_t)(sequence >> 16), (uint8_t)(sequence >> 24) } };
+  uint8_t encoded[GameStateSnapshot::maximumEncodedSize];
+  size_t length = snapshot.encode(GameStateSnapshot::allFields, encoded);
+  packet.data.insert(packet.data.end(), encoded, encoded + length);
+  return packet;
+}
+
+static void testSequenceWrap() {
+  printf("Sequence number wrap and invalid packets\n");
+
+  GameState game((ClusterConfiguration()));
+  FanoutGame fanout(game, multicastAddress, port);
+  fanout.begin();
+  GameStateSnapshot snapshot;
+
+  snapshot.speed = 10;
+  hostUdpDeliver(packet(0xFFFFFFFE, snapshot));
+  snapshot.speed = 20;
+  hostUdpDeliver(packet(0xFFFFFFFF, snapshot));
+  snapshot.speed = 30;
+  hostUdpDeliver(packet(0, snapshot));
+  snapshot.speed = 40;
+  hostUdpDeliver(packet(2, snapshot));
+  check(fanout.receivedPackets() == 4 && fanout.lostPackets() == 1 && game.speed == 40, "sequence number wraps around");
+
+  snapshot.speed = 50;
+  hostUdpDeliver(packet(0xFFFFFFFF, snapshot));
+  hostUdpDeliver(packet(2, snapshot));
+  check(fanout.outOfOrderPackets() == 2 && game.speed == 40, "older and repeated sequence numbers are not applied");
+
+  // First packet after a long gap still counts what was lost
+  hostUdpDeliver(packet(1002, snapshot));
+  check(fanout.lostPackets() == 1000 && game.speed == 50, "gap is counted as lost");
+
+  HostUdpPacket badMagic = packet(1003, snapshot);
+  badMagic.data[0] = 'X';
+  HostUdpPacket truncated = packet(1004, snapshot);
+  truncated.data.resize(truncated.data.size() - 1);
+  hostUdpDeliver(badMagic);
+  hostUdpDeliver(packet(1005, snapshot, 1));
+  hostUdpDeliver(truncated);
+  hostUdpDeliver(HostUdpPacket{ hostTime, multicastAddress, port, { 'C', 'F' } });
+  check(fanout.invalidPackets() == 4 && fanout.decodeErrorCount() == 4, "invalid packets are rejected");
+  check(fanout.receivedPackets() == 5 && fanout.lostPackets() == 1000, "invalid packets do not move the sequence");
+
+  hostUdpDeliver(packet(1003, snapshot));
+  check(fanout.receivedPackets() == 6 && fanout.lostPackets() == 1000, "next valid packet continues the sequence");
+
+  hostUdpDeliver(HostUdpPacket{ hostTime, IPAddress(239, 1, 2, 4), port, packet(1004, snapshot).data });
+  check(fanout.receivedPackets() == 6, "other multicast groups are not received");
+}
+
+int main() {
+  randomSeed(1);
+
+  testSnapshot();
+  testFollowers();
+  testSequenceWrap();
+
+  return hostCheckResult();
+}
@@ -0,0 +1,195 @@
+// ####################################################################################################################
+//
+// Code part of CarCluster project by Andrej Rolih. See .ino file more details
+//
+// Runs FuelPotDriver (CarCluster/src/Other/FuelPotDriver.cpp) against two modelled X9C10X potentiometers that share
+// the INC and DIR pins: the recorded pin writes (Tools/host/Arduino.h) are played into the chips, a chip moves its
+// wiper on a falling INC edge while its CS is low and stores the wiper when CS rises with INC high. Checks the pin
+// order at begin(), homing, that only one CS is low at a time and the pots take turns, the step budget per update,
+// the INC and DIR timing, that the position is never stored and that the chip wipers end where the driver thinks
+// they are. Runs on the computer, not on the ESP32:
+//
+//   g++ -std=c++11 -ITools/host -o fuelpots Tools/fuelpots.cpp && ./fuelpots
+//
+// ####################################################################################################################
+
+#include "Arduino.h"
+
+#include "../CarCluster/src/Other/FuelPotDriver.cpp"
+
+#include "HostCheck.h"
+
+static const uint8_t incPin = 14;
+static const uint8_t dirPin = 27;
+static const uint8_t csPins[FuelPotDriver::potCount] = { 12, 33 };
+
+struct Chip {
+  uint8_t wiper;
+  uint32_t steps;                          // Wiper moves
+  uint32_t stores;                         // Wiper written to the non volatile memory
+};
+
+static Chip chips[FuelPotDriver::potCount] = { { 30, 0, 0 }, { 70, 0, 0 } };  // Wherever the wipers were left
+
+// What the model saw in the writes played so far
+static size_t played = 0;
+static uint8_t levels[64];
+static uint64_t lastIncEdge = 0;
+static uint64_t lastDirChange = 0;
+static uint32_t bothSelected = 0;          // Writes with both CS low
+static uint32_t stepsTooShort = 0;         // INC high or low for less than 1 us
+static uint32_t dirTooLate = 0;            // INC falling less than 3 us after a DIR change
+static uint32_t dirWhileSelected = 0;      // DIR changed with a CS low
+static std::vector<uint8_t> selections;    // Pot of every CS falling edge
+
+static void play() {
+  for (; played < hostPinWrites.size(); played++) {
+    const HostPinWrite &write = hostPinWrites[played];
+    uint8_t previous = levels[write.pin];
+    levels[write.pin] = write.value;
+    if (previous == write.value) continue;
+
+    if (write.pin == incPin) {
+      if (write.time - lastIncEdge < 1) stepsTooShort++;
+      lastIncEdge = write.time;
+      if (write.value == LOW && write.time - lastDirChange < 3) dirTooLate++;
+    } else if (write.pin == dirPin) {
+      lastDirChange = write.time;
+      if (levels[csPins[0]] == LOW || levels[csPins[1]] == LOW) dirWhileSelected++;
+    }
+
+    for (uint8_t pot = 0; pot < FuelPotDriver::potCount; pot++) {
+      Chip &chip = chips[pot];
+      if (levels[csPins[pot]] == LOW && write.pin == incPin && write.value == LOW) {
+        if (levels[dirPin] == HIGH && chip.wiper < FuelPotDriver::maximumPosition) chip.wiper++;
+        if (levels[dirPin] == LOW && chip.wiper > 0) chip.wiper--;
+        chip.steps++;
+      }
+      if (write.pin == csPins[pot] && write.value == HIGH && levels[incPin] == HIGH) chip.stores++;
+      if (write.pin == csPins[pot] && write.value == LOW) selections.push_back(pot);
+    }
+    if (levels[csPins[0]] == LOW && levels[csPins[1]] == LOW) bothSelected++;
+  }
+}
+
+static uint32_t totalSteps() { return chips[0].steps + chips[1].steps; }
+
+// Calls update() like the loop does and checks the budget of every call, returns the number of calls
+static uint32_t runUntilSettled(FuelPotDriver &driver, uint8_t budget, uint32_t maximumUpdates = 1000) {
+  uint32_t updates = 0;
+  while (!driver.isSettled() && updates < maximumUpdates) {
+    uint32_t steps = totalSteps();
+    uint64_t start = hostTime;
+    driver.update();
+    play();
+    updates++;
+    check(totalSteps() - steps <= budget, "update() stays within the step budget");
+    check(hostTime - start <= (uint64_t)(3 * FuelPotDriver::potCount + 2 * budget), "update() takes a few microseconds");
+    hostAdvance(1000);
+  }
+  return updates;
+}
+
+static void testBegin(FuelPotDriver &driver) {
+  printf("Pin order at begin()\n");
+
+  driver.update();
+  check(hostPinWrites.empty(), "update() does nothing before begin()");
+
+  driver.begin(incPin, dirPin, csPins[0], csPins[1]);
+  check(hostPinWrites.size() == 4, "begin() writes every pin once");
+  check(hostPinWrites[0].pin == csPins[0] && hostPinWrites[1].pin == csPins[1] && hostPinWrites[0].value == HIGH &&
+        hostPinWrites[1].value == HIGH, "both CS go high first");
+  check(hostPinWrites[2].pin == incPin && hostPinWrites[3].pin == dirPin, "INC and DIR go high after that");
+  check(hostPinModes[incPin] == OUTPUT && hostPinModes[dirPin] == OUTPUT && hostPinModes[csPins[0]] == OUTPUT &&
+        hostPinModes[csPins[1]] == OUTPUT, "pins are outputs");
+
+  for (uint8_t pin = 0; pin < 64; pin++) levels[pin] = HIGH;
+  play();
+  check(chips[0].stores == 0 && chips[1].stores == 0, "nothing is stored");
+}
+
+static void testHoming(FuelPotDriver &driver) {
+  printf("Homing\n");
+
+  check(!driver.isHomed(0) && !driver.isHomed(1), "pots start unhomed");
+  uint32_t updates = runUntilSettled(driver, 8);
+  check(driver.isHomed(0) && driver.isHomed(1), "both pots are homed");
+  check(chips[0].wiper == 99 && chips[1].wiper == 99, "homing drives both wipers to the top");
+  check(chips[0].steps == 99 && chips[1].steps == 99, "homing takes the full range of steps");
+  check(updates == 2 * 99 / 8 + 1, "homing is spread over updates at the full budget");
+
+  // Both pots had a long way to go, the first pot of an update gets the whole budget and they take turns
+  bool alternating = selections.size() == updates + 1;
+  for (size_t i = 0; i + 1 < selections.size(); i++) {
+    if (selections[i] != i % 2) alternating = false;
+  }
+  check(alternating, "pots take turns");
+  check(alternating && selections[updates - 1] != selections[updates], "leftover budget goes to the other pot");
+}
+
+static void testTargets(FuelPotDriver &driver) {
+  printf("Targets\n");
+
+  uint32_t steps0 = chips[0].steps;
+  uint32_t steps1 = chips[1].steps;
+  driver.setTarget(0, 20);
+  driver.setTarget(1, 80);
+  check(!driver.isSettled(), "new targets are not settled");
+  runUntilSettled(driver, 8);
+  check(chips[0].wiper == 20 && chips[1].wiper == 80, "wipers are at the targets");
+  check(driver.currentPosition(0) == 20 && driver.currentPosition(1) == 80, "driver knows where the wipers are");
+  check(chips[0].steps - steps0 == 79 && chips[1].steps - steps1 == 19, "shortest way to the targets");
+
+  // Only pot 1 moves, pot 0 keeps its position although INC and DIR are shared
+  driver.setTarget(1, 10);
+  runUntilSettled(driver, 8);
+  check(chips[0].wiper == 20 && chips[1].wiper == 10, "only the selected pot moves");
+
+  driver.setTarget(0, 150);
+  check(driver.targetPosition(0) == FuelPotDriver::maximumPosition, "target is clamped");
+  driver.setTarget(2, 50);
+  check(driver.targetPosition(2) == 0, "unknown pot is ignored");
+  runUntilSettled(driver, 8);
+  check(chips[0].wiper == 99, "clamped target is reached");
+}
+
+static void testRandomTargets() {
+  printf("Random targets with a budget of 3\n");
+
+  FuelPotDriver driver(3);
+  driver.begin(incPin, dirPin, csPins[0], csPins[1]);
+  play();
+  runUntilSettled(driver, 3);
+
+  for (int i = 0; i < 2000; i++) {
+    driver.setTarget(random(2), random(100));
+    for (long updates = random(1, 20); updates > 0; updates--) {
+      uint32_t steps = totalSteps();
+      driver.update();
+      play();
+      check(totalSteps() - steps <= 3, "update() stays within the step budget");
+      hostAdvance(1000);
+    }
+  }
+  runUntilSettled(driver, 3);
+  check(chips[0].wiper == driver.targetPosition(0) && chips[1].wiper == driver.targetPosition(1), "wipers end at the targets");
+}
+
+int main() {
+  randomSeed(1);
+
+  FuelPotDriver driver;
+  testBegin(driver);
+  testHoming(driver);
+  testTargets(driver);
+  testRandomTargets();
+
+  check(bothSelected == 0, "never more than one CS low");
+  check(chips[0].stores == 0 && chips[1].stores == 0, "wiper position is never stored");
+  check(stepsTooShort == 0, "INC is high and low for at least 1 us");
+  check(dirTooLate == 0, "DIR is set at least 3 us before the first step");
+  check(dirWhileSelected == 0, "DIR only changes with both pots deselected");
+
+  return hostCheckResult();
+}
@@ -0,0 +1,393 @@
+// ####################################################################################################################
+//
+// Code part of CarCluster project by Andrej Rolih. See .ino file more details
+//
+// Minimal Arduino environment for running the CarCluster sources on the computer (used by the Tools programs).
+// Time only moves when the program moves it (hostAdvance(), delay(), delayMicroseconds()), every pin write and
+// LEDC call is recorded, and the serial ports are byte queues. Serial prints to stdout unless muted.
+//
+// Header only: each tool is a single translation unit that includes the sources it checks, so this file (and
+// HostCan.h) are included exactly once per program. unsigned long is 64 bits on the computer, so millis() and
+// micros() do not wrap like they do on the ESP32.
+//
+// ####################################################################################################################
+
+#ifndef HOST_ARDUINO
+#define HOST_ARDUINO
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdarg.h>
+#include <string.h>
+#include <stdlib.h>
+#include <stdio.h>
+#include <math.h>
+#include <ctype.h>
+
+#include <algorithm>
+#include <deque>
+#include <string>
+#include <utility>
+#include <vector>
+
+using std::min;
+using std::max;
+
+typedef bool boolean;
+typedef uint8_t byte;
+
+#define HIGH 1
+#define LOW 0
+#define INPUT 0
+#define OUTPUT 1
+#define INPUT_PULLUP 2
+
+#define HEX 16
+#define DEC 10
+#define BIN 2
+
+#define SERIAL_8N1 0x800001c
+#define SERIAL_8E1 0x800001e
+
+#define F(x) x
+#define IRAM_ATTR
+#define ESP_ARDUINO_VERSION_MAJOR 3
+
+#define portMUX_TYPE int
+#define portMUX_INITIALIZER_UNLOCKED 0
+#define portENTER_CRITICAL(x)
+#define portEXIT_CRITICAL(x)
+#define portENTER_CRITICAL_ISR(x)
+#define portEXIT_CRITICAL_ISR(x)
+
+#define bitRead(value, bit) (((value) >> (bit)) & 0x01)
+#define bitSet(value, bit) ((value) |= (1UL << (bit)))
+#define bitClear(value, bit) ((value) &= ~(1UL << (bit)))
+#define bitWrite(value, bit, bitvalue) ((bitvalue) ? bitSet(value, bit) : bitClear(value, bit))
+
+template<class T, class L, class H> T constrain(T value, L low, H high) { return value < low ? low : (value > high ? high : value); }
+
+// Time ###############################################################################################################
+
+static uint64_t hostTime = 0;              // us since boot
+
+void hostAdvance(uint64_t us) { hostTime += us; }
+unsigned long millis() { return (unsigned long)(hostTime / 1000); }
+unsigned long micros() { return (unsigned long)hostTime; }
+void delay(unsigned long ms) { hostTime += (uint64_t)ms * 1000; }
+void delayMicroseconds(unsigned int us) { hostTime += us; }
+
+// Pins ###############################################################################################################
+
+struct HostPinWrite {
+  uint64_t time;                           // us
+  uint8_t pin;
+  uint8_t value;
+};
+
+static std::vector<HostPinWrite> hostPinWrites;
+static uint8_t hostPinLevels[64] = {};
+static uint8_t hostPinModes[64] = {};
+
+void pinMode(uint8_t pin, uint8_t mode) { if (pin < 64) hostPinModes[pin] = mode; }
+int digitalRead(uint8_t pin) { return pin < 64 ? hostPinLevels[pin] : LOW; }
+void hostSetPin(uint8_t pin, uint8_t value) { if (pin < 64) hostPinLevels[pin] = value ? HIGH : LOW; }
+
+void digitalWrite(uint8_t pin, uint8_t value) {
+  hostSetPin(pin, value);
+  HostPinWrite write = { hostTime, pin, (uint8_t)(value ? HIGH : LOW) };
+  hostPinWrites.push_back(write);
+}
+
+// LEDC ###############################################################################################################
+
+// Arduino ESP32 3.x LEDC calls (they take the pin), the ESP-IDF calls are in driver/ledc.h. Every call is recorded
+// with the state of the pin after it, the program turns the record into the waveform the LEDC would put out. As on
+// the ESP32, ledcChangeFrequency() goes through ledc_timer_config() and restarts the timer.
+struct HostLedcWrite {
+  uint64_t time;                           // us
+  uint8_t pin;
+  bool restart;                            // The timer starts a new period right away, other writes wait for its end
+  uint32_t frequency;                      // Hz, set by the Arduino calls
+  uint32_t divider;                        // 80 MHz clock divider in 1/256 steps, set by the ESP-IDF calls (0 if not)
+  uint8_t resolution;                      // bits
+  uint32_t duty;
+};
+
+static std::vector<HostLedcWrite> hostLedcWrites;
+static HostLedcWrite hostLedcState[64] = {};
+static bool hostLedcAttached[64] = {};
+
+bool hostLedcRecord(uint8_t pin, bool restart) {
+  if (pin >= 64 || (!restart && !hostLedcAttached[pin])) return false;
+  HostLedcWrite write = hostLedcState[pin];
+  write.time = hostTime;
+  write.pin = pin;
+  write.restart = restart;
+  hostLedcWrites.push_back(write);
+  hostLedcAttached[pin] = true;
+  return true;
+}
+
+// Length of one period in us
+double hostLedcPeriod(const HostLedcWrite &write) {
+  if (write.divider != 0) return write.divider / 256.0 * (1 << write.resolution) / 80.0;
+  return 1000000.0 / write.frequency;
+}
+
+bool ledcAttach(uint8_t pin, uint32_t frequency, uint8_t resolution) {
+  if (pin >= 64 || frequency == 0 || resolution == 0 || resolution > 20) return false;
+  hostLedcState[pin].frequency = frequency;
+  hostLedcState[pin].divider = 0;
+  hostLedcState[pin].resolution = resolution;
+  hostLedcState[pin].duty = 0;
+  return hostLedcRecord(pin, true);
+}
+
+bool ledcWrite(uint8_t pin, uint32_t duty) {
+  if (pin >= 64 || !hostLedcAttached[pin]) return false;
+  hostLedcState[pin].duty = duty;
+  return hostLedcRecord(pin, false);
+}
+
+uint32_t ledcChangeFrequency(uint8_t pin, uint32_t frequency, uint8_t resolution) {
+  if (pin >= 64 || !hostLedcAttached[pin] || frequency == 0) return 0;
+  hostLedcState[pin].frequency = frequency;
+  hostLedcState[pin].divider = 0;
+  hostLedcState[pin].resolution = resolution;
+  return hostLedcRecord(pin, true) ? frequency : 0;
+}
+
+// Memory #############################################################################################################
+
+// No PSRAM on the computer, buffers come from the heap
+bool psramFound() { return false; }
+void* ps_malloc(size_t size) { return malloc(size); }
+
+// Heap numbers in the health reports
+static uint32_t hostFreeHeap = 200000;
+static uint32_t hostMinimumFreeHeap = 150000;
+
+class EspClass {
+  public:
+    uint32_t getFreeHeap() { return hostFreeHeap; }
+    uint32_t getMinFreeHeap() { return hostMinimumFreeHeap; }
+};
+
+static EspClass ESP;
+
+// Math ###############################################################################################################
+
+static uint32_t hostRandomState = 2463534242UL;
+
+void randomSeed(unsigned long seed) { hostRandomState = seed != 0 ? (uint32_t)seed : 2463534242UL; }
+
+long random(long howBig) {
+  // xorshift32, same sequence on every run
+  hostRandomState ^= hostRandomState << 13;
+  hostRandomState ^= hostRandomState >> 17;
+  hostRandomState ^= hostRandomState << 5;
+  return howBig > 0 ? (long)(hostRandomState % (uint32_t)howBig) : 0;
+}
+
+long random(long howSmall, long howBig) { return howSmall >= howBig ? howSmall : howSmall + random(howBig - howSmall); }
+
+long map(long x, long inMin, long inMax, long outMin, long outMax) {
+  return (x - inMin) * (outMax - outMin) / (inMax - inMin) + outMin;
+}
+
+bool isAlpha(int c) { return isalpha(c) != 0; }
+bool isDigit(int c) { return isdigit(c) != 0; }
+
+// Print ##############################################################################################################
+
+class String {
+  public:
+    String(const char *text = "") : text(text != nullptr ? text : "") {}
+    String(const std::string &text) : text(text) {}
+    const char* c_str() const { return text.c_str(); }
+    unsigned int length() const { return text.length(); }
+    bool operator==(const char *other) const { return text == other; }
+    String operator+(const String &other) const { return String(text + other.text); }
+
+  private:
+    std::string text;
+};
+
+class Print {
+  public:
+    virtual ~Print() {}
+    virtual size_t write(uint8_t c) = 0;
+    virtual size_t write(const uint8_t *buffer, size_t size) {
+      size_t written = 0;
+      while (size--) written += write(*buffer++);
+      return written;
+    }
+    size_t write(const char *buffer, size_t size) { return write((const uint8_t *)buffer, size); }
+    size_t write(const char *text) { return text != nullptr ? write(text, strlen(text)) : 0; }
+
+    size_t print(const char *text) { return write(text); }
+    size_t print(const String &text) { return write(text.c_str()); }
+    size_t print(char c) { return write((uint8_t)c); }
+    size_t print(unsigned char value, int base = DEC) { return print((unsigned long)value, base); }
+    size_t print(int value, int base = DEC) { return print((long)value, base); }
+    size_t print(unsigned int value, int base = DEC) { return print((unsigned long)value, base); }
+    size_t print(long value, int base = DEC) {
+      if (base == DEC && value < 0) return print('-') + print((unsigned long)-value, base);
+      return print((unsigned long)value, base);
+    }
+    size_t print(unsigned long value, int base = DEC) {
+      char buffer[8 * sizeof(value) + 1];
+      char *text = &buffer[sizeof(buffer) - 1];
+      *text = '\0';
+      if (base < 2) base = DEC;
+      do {
+        uint8_t digit = value % base;
+        *--text = digit < 10 ? '0' + digit : 'A' + digit - 10;
+        value /= base;
+      } while (value > 0);
+      return write(text);
+    }
+    size_t print(double value, int digits = 2) { return printf("%.*f", digits, value); }
+
+    size_t println() { return write("\r\n"); }
+    template<class T> size_t println(T value) { return print(value) + println(); }
+    template<class T> size_t println(T value, int format) { return print(value, format) + println(); }
+
+    size_t printf(const char *format, ...) {
+      char buffer[512];
+      va_list args;
+      va_start(args, format);
+      int length = vsnprintf(buffer, sizeof(buffer), format, args);
+      va_end(args);
+      if (length <= 0) return 0;
+      return write(buffer, (size_t)length < sizeof(buffer) ? length : sizeof(buffer) - 1);
+    }
+};
+
+class Stream: public Print {
+  public:
+    virtual int available() = 0;
+    virtual int read() = 0;
+    virtual int peek() = 0;
+    virtual void flush() {}
+};
+
+// A UART. What the program writes is kept in sent (and printed when toStdout is set), hostReceive() queues bytes
+// for read(). With loopback set everything written is also received, like a single wire bus (K-bus) does.
+//
+// hostPace() adds the line rate (10 bits per byte at baudRate): written bytes leave through the transmit FIFO
+// (txFifoSize, availableForWrite() is its free space, write() waits for space like on the ESP32 and moves the time),
+// hostReceive() bytes arrive one byte time after the other into the receive buffer (setRxBufferSize()), bytes that
+// arrive while it is full are lost.
+class HardwareSerial: public Stream {
+  public:
+    std::vector<uint8_t> sent;
+    std::deque<uint8_t> receiveQueue;
+    bool toStdout = false;
+    bool loopback = false;
+    unsigned long baudRate = 0;
+    uint32_t config = 0;
+
+    bool paced = false;
+    size_t txFifoSize = 128;
+    size_t rxBufferSize = 256;
+    uint64_t receiveLost = 0;              // Bytes that arrived while the receive buffer was full
+    uint64_t writeWaitTime = 0;            // us write() waited for the transmit FIFO
+
+    HardwareSerial(bool toStdout = false) : toStdout(toStdout) {}
+
+    void begin(unsigned long baud, uint32_t config = SERIAL_8N1, int8_t rxPin = -1, int8_t txPin = -1) {
+      baudRate = baud;
+      this->config = config;
+    }
+    void end() {}
+    operator bool() { return true; }
+    size_t setRxBufferSize(size_t size) {
+      rxBufferSize = size;
+      return size;
+    }
+    int availableForWrite() { return paced ? (int)(txFifoSize - transmitFifoUsed()) : 128; }
+
+    int available() override {
+      receivePaced();
+      return receiveQueue.size();
+    }
+    int peek() override {
+      receivePaced();
+      return receiveQueue.empty() ? -1 : receiveQueue.front();
+    }
+    int read() override {
+      receivePaced();
+      if (receiveQueue.empty()) return -1;
+      uint8_t c = receiveQueue.front();
+      receiveQueue.pop_front();
+      return c;
+    }
+
+    size_t write(uint8_t c) override {
+      if (paced) {
+        if (transmitFifoUsed() >= txFifoSize) {
+          // Waits until the oldest byte has left
+          uint64_t free = transmitEmptyTime - (txFifoSize - 1) * byteTime();
+          uint64_t wait = (free - hostTime * 1000 + 999) / 1000;
+          hostAdvance(wait);
+          writeWaitTime += wait;
+        }
+        transmitEmptyTime = std::max(transmitEmptyTime, hostTime * 1000) + byteTime();
+      }
+      sent.push_back(c);
+      if (toStdout) fputc(c == '\r' ? '\n' : c, stdout);
+      if (loopback) receiveQueue.push_back(c);
+      return 1;
+    }
+    using Print::write;
+
+    void hostPace(bool paced) {
+      this->paced = paced;
+      transmitEmptyTime = 0;
+      lastArrivalTime = 0;
+      incoming.clear();
+    }
+    void hostReceive(const uint8_t *data, size_t length) {
+      if (!paced) {
+        receiveQueue.insert(receiveQueue.end(), data, data + length);
+        return;
+      }
+      for (size_t i = 0; i < length; i++) {
+        lastArrivalTime = std::max(lastArrivalTime, hostTime * 1000) + byteTime();
+        incoming.push_back(std::make_pair(lastArrivalTime, data[i]));
+      }
+    }
+    void hostReceive(const char *text) { hostReceive((const uint8_t *)text, strlen(text)); }
+    uint64_t hostReceiveEndTime() { return paced ? lastArrivalTime / 1000 : hostTime; }  // us when the last byte arrives
+    uint64_t hostTransmitEndTime() { return paced ? transmitEmptyTime / 1000 : hostTime; }  // us when the FIFO is empty
+
+  private:
+    uint64_t transmitEmptyTime = 0;        // ns when the last written byte has left
+    uint64_t lastArrivalTime = 0;          // ns when the last hostReceive() byte arrives
+    std::deque<std::pair<uint64_t, uint8_t>> incoming;
+
+    uint64_t byteTime() { return baudRate > 0 ? 10000000000ULL / baudRate : 0; }  // ns
+
+    size_t transmitFifoUsed() {
+      uint64_t now = hostTime * 1000;
+      if (transmitEmptyTime <= now || byteTime() == 0) return 0;
+      return (transmitEmptyTime - now + byteTime() - 1) / byteTime();
+    }
+
+    void receivePaced() {
+      uint64_t now = hostTime * 1000;
+      while (!incoming.empty() && incoming.front().first <= now) {
+        if (receiveQueue.size() < rxBufferSize) receiveQueue.push_back(incoming.front().second);
+        else receiveLost++;
+        incoming.pop_front();
+      }
+    }
+};
+
+HardwareSerial Serial(true);
+HardwareSerial Serial1;
+HardwareSerial Serial2;
+
+#endif
@@ -0,0 +1,105 @@
+// ####################################################################################################################
+//
+// Code part of CarCluster project by Andrej Rolih. See .ino file more details
+//
+// AsyncUDP on the computer: a network that only moves packets when the program says so. Every writeTo() is kept in
+// hostUdpSent, hostUdpDeliver() hands a packet to every AsyncUDP listening on its address and port (right away, in
+// the calling thread), so the program decides which packets get lost, duplicated or reordered. Also has IPAddress,
+// which comes with Arduino.h on the ESP32.
+//
+// Header only, include it once per program (after Arduino.h).
+//
+// ####################################################################################################################
+
+#ifndef HOST_ASYNC_UDP
+#define HOST_ASYNC_UDP
+
+#include <functional>
+
+#include "Arduino.h"
+
+class IPAddress {
+  public:
+    IPAddress(uint8_t first = 0, uint8_t second = 0, uint8_t third = 0, uint8_t fourth = 0) {
+      address = (uint32_t)first << 24 | (uint32_t)second << 16 | (uint32_t)third << 8 | fourth;
+    }
+    bool operator==(const IPAddress &other) const { return address == other.address; }
+    bool operator!=(const IPAddress &other) const { return address != other.address; }
+
+  private:
+    uint32_t address;
+};
+
+struct HostUdpPacket {
+  uint64_t time;                           // us
+  IPAddress address;
+  uint16_t port;
+  std::vector<uint8_t> data;
+};
+
+static std::vector<HostUdpPacket> hostUdpSent;
+static bool hostUdpFailWrites = false;     // writeTo() sends nothing and returns 0
+
+class AsyncUDPPacket {
+  public:
+    AsyncUDPPacket(const std::vector<uint8_t> &data) : bytes(data) {}
+    uint8_t* data() { return bytes.data(); }
+    size_t length() { return bytes.size(); }
+
+  private:
+    std::vector<uint8_t> bytes;
+};
+
+class AsyncUDP;
+static std::vector<AsyncUDP*> hostUdpListeners;
+
+class AsyncUDP {
+  AsyncUDP(const AsyncUDP &other) = delete;
+  AsyncUDP(AsyncUDP &&other) = delete;
+  AsyncUDP &operator=(const AsyncUDP &other) = delete;
+  AsyncUDP &operator=(AsyncUDP &&other) = delete;
+
+  public:
+    IPAddress listenAddress;
+    uint16_t listenPort = 0;
+    std::function<void(AsyncUDPPacket)> handler;
+
+    AsyncUDP() {}
+    ~AsyncUDP() { close(); }
+
+    bool listenMulticast(const IPAddress &address, uint16_t port) {
+      close();
+      listenAddress = address;
+      listenPort = port;
+      hostUdpListeners.push_back(this);
+      return true;
+    }
+    void onPacket(std::function<void(AsyncUDPPacket)> callback) { handler = callback; }
+    void close() { hostUdpListeners.erase(std::remove(hostUdpListeners.begin(), hostUdpListeners.end(), this), hostUdpListeners.end()); }
+
+    size_t writeTo(const uint8_t *data, size_t length, const IPAddress &address, uint16_t port) {
+      if (hostUdpFailWrites) return 0;
+      HostUdpPacket packet = { hostTime, address, port, std::vector<uint8_t>(data, data + length) };
+      hostUdpSent.push_back(packet);
+      return length;
+    }
+};
+
+// Hands the packet to every listener on its address and port
+void hostUdpDeliver(const HostUdpPacket &packet) {
+  std::vector<AsyncUDP*> listeners = hostUdpListeners;
+  for (AsyncUDP *listener : listeners) {
+    if (listener->listenAddress == packet.address && listener->listenPort == packet.port && listener->handler) {
+      listener->handler(AsyncUDPPacket(packet.data));
+    }
+  }
+}
+
+// Hands the packet to one listener only (a follower with its own link)
+void hostUdpDeliver(const HostUdpPacket &packet, AsyncUDP &listener) {
+  if (listener.listenAddress == packet.address && listener.listenPort == packet.port && listener.handler) {
+    listener.handler(AsyncUDPPacket(packet.data));
+  }
+}
+
+#endif
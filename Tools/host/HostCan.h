@@ -0,0 +1,213 @@
+// ####################################################################################################################
+//
+// Code part of CarCluster project by Andrej Rolih. See .ino file more details
+//
+// MCP_CAN on the computer: the real class declaration (Libs/MCP_CAN/mcp_can.h) backed by a fake controller instead
+// of an MCP2515 on SPI. Each chip select pin gets its own fake controller (hostCanController(cs)), the program sets
+// what begin() and the sends return and which error flags and counters the controller reports, and reads back the
+// frames that were sent. The send gate and frame hook behave like in mcp_can.cpp.
+//
+// Header only, include it once per program (after Arduino.h).
+//
+// ####################################################################################################################
+
+#ifndef HOST_CAN
+#define HOST_CAN
+
+#include "../../CarCluster/src/Libs/MCP_CAN/mcp_can.h"
+
+struct HostCanFrame {
+  uint64_t time;                           // us
+  INT32U id;                               // Without the extended and RTR bits
+  INT8U extended;
+  INT8U length;
+  INT8U data[8];
+};
+
+struct HostCanController {
+  INT8U beginResult = CAN_OK;              // Returned by begin()
+  INT8U sendResult = CAN_OK;               // Returned by every send (once begun, before that sends fail)
+  INT8U modeResult = MCP2515_OK;           // Returned by setMode()
+  INT8U errorFlags = 0;                    // EFLG
+  INT8U receiveErrors = 0;                 // REC
+  INT8U transmitErrors = 0;                // TEC
+
+  bool begun = false;
+  bool aborted = false;                    // abortTX() called and not resumed
+  INT8U mode = MCP_NORMAL;
+  uint32_t beginCalls = 0;
+  uint32_t abortCalls = 0;
+  uint32_t resumeCalls = 0;
+  uint32_t sendCalls = 0;                  // Sends that got past the gate
+
+  std::vector<HostCanFrame> sent;          // Acknowledged frames
+  std::deque<HostCanFrame> receiveQueue;   // Returned by readMsgBuf()
+
+  void receive(INT32U id, INT8U length, const INT8U *data, bool extended = false) {
+    HostCanFrame frame = { hostTime, id, (INT8U)(extended ? 1 : 0), length, {} };
+    memcpy(frame.data, data, length < 8 ? length : 8);
+    receiveQueue.push_back(frame);
+  }
+};
+
+static HostCanController hostCanControllers[64];
+
+HostCanController& hostCanController(INT8U cs) { return hostCanControllers[cs % 64]; }
+
+MCP_CAN::MCP_CAN(INT8U _CS) {
+  MCPCS = _CS;
+  mcpSPI = &SPI;
+  mcpMode = MCP_LOOPBACK;
+}
+
+MCP_CAN::MCP_CAN(SPIClass *_SPI, INT8U _CS) {
+  MCPCS = _CS;
+  mcpSPI = _SPI;
+  mcpMode = MCP_LOOPBACK;
+}
+
+INT8U MCP_CAN::begin(INT8U idmodeset, INT8U speedset, INT8U clockset) {
+  HostCanController &controller = hostCanController(MCPCS);
+  controller.beginCalls++;
+  controller.begun = controller.beginResult == CAN_OK;
+  return controller.beginResult;
+}
+
+INT8U MCP_CAN::init_Mask(INT8U num, INT8U ext, INT32U ulData) { return MCP2515_OK; }
+INT8U MCP_CAN::init_Mask(INT8U num, INT32U ulData) { return MCP2515_OK; }
+INT8U MCP_CAN::init_Filt(INT8U num, INT8U ext, INT32U ulData) { return MCP2515_OK; }
+INT8U MCP_CAN::init_Filt(INT8U num, INT32U ulData) { return MCP2515_OK; }
+
+INT8U MCP_CAN::setMode(INT8U opMode) {
+  HostCanController &controller = hostCanController(MCPCS);
+  if (controller.modeResult == MCP2515_OK) {
+    controller.mode = opMode;
+    mcpMode = opMode;
+  }
+  return controller.modeResult;
+}
+
+INT8U MCP_CAN::setMsg(INT32U id, INT8U rtr, INT8U ext, INT8U len, INT8U *pData) {
+  m_nID = id;
+  m_nRtr = rtr;
+  m_nExtFlg = ext;
+  m_nDlc = len;
+  memset(m_nDta, 0, sizeof(m_nDta));
+  memcpy(m_nDta, pData, len < MAX_CHAR_IN_MESSAGE ? len : MAX_CHAR_IN_MESSAGE);
+  return MCP2515_OK;
+}
+
+INT8U MCP_CAN::sendMsg() {
+  HostCanController &controller = hostCanController(MCPCS);
+  controller.sendCalls++;
+
+  // Not initialized the MCP2515 never finishes a transmission, aborted transmissions fail right away
+  INT8U result = controller.sendResult;
+  if (!controller.begun) {
+    result = CAN_SENDMSGTIMEOUT;
+  } else if (controller.aborted) {
+    result = CAN_FAILTX;
+  }
+  if (result == CAN_OK && controller.mode != MCP_LISTENONLY) {
+    HostCanFrame frame = { hostTime, m_nID & 0x1FFFFFFF, m_nExtFlg, m_nDlc, {} };
+    memcpy(frame.data, m_nDta, sizeof(frame.data));
+    controller.sent.push_back(frame);
+  }
+  return result;
+}
+
+INT8U MCP_CAN::sendMsgBuf(INT32U id, INT8U ext, INT8U len, INT8U *buf) {
+  if (sendGate != nullptr && !sendGate(sendGateContext)) return CAN_FAILTX;
+
+  setMsg(id, 0, ext, len, buf);
+  INT8U result = sendMsg();
+  notifyFrameHook(MCP_FRAME_TX, result);
+  return result;
+}
+
+INT8U MCP_CAN::sendMsgBuf(INT32U id, INT8U len, INT8U *buf) {
+  if (sendGate != nullptr && !sendGate(sendGateContext)) return CAN_FAILTX;
+
+  setMsg(id, (id & 0x40000000) ? 1 : 0, (id & 0x80000000) ? 1 : 0, len, buf);
+  INT8U result = sendMsg();
+  notifyFrameHook(MCP_FRAME_TX, result);
+  return result;
+}
+
+INT8U MCP_CAN::readMsg() {
+  HostCanController &controller = hostCanController(MCPCS);
+  if (controller.receiveQueue.empty()) return CAN_NOMSG;
+
+  HostCanFrame frame = controller.receiveQueue.front();
+  controller.receiveQueue.pop_front();
+  setMsg(frame.id, 0, frame.extended, frame.length, frame.data);
+  return CAN_OK;
+}
+
+INT8U MCP_CAN::readMsgBuf(INT32U *id, INT8U *ext, INT8U *len, INT8U buf[]) {
+  if (readMsg() == CAN_NOMSG) return CAN_NOMSG;
+
+  notifyFrameHook(MCP_FRAME_RX, CAN_OK);
+  *id = m_nID;
+  *len = m_nDlc;
+  *ext = m_nExtFlg;
+  for (int i = 0; i < m_nDlc; i++) buf[i] = m_nDta[i];
+  return CAN_OK;
+}
+
+INT8U MCP_CAN::readMsgBuf(INT32U *id, INT8U *len, INT8U buf[]) {
+  if (readMsg() == CAN_NOMSG) return CAN_NOMSG;
+
+  notifyFrameHook(MCP_FRAME_RX, CAN_OK);
+  if (m_nExtFlg) m_nID |= 0x80000000;
+  *id = m_nID;
+  *len = m_nDlc;
+  for (int i = 0; i < m_nDlc; i++) buf[i] = m_nDta[i];
+  return CAN_OK;
+}
+
+INT8U MCP_CAN::checkReceive(void) {
+  return hostCanController(MCPCS).receiveQueue.empty() ? CAN_NOMSG : CAN_MSGAVAIL;
+}
+
+INT8U MCP_CAN::checkError(void) {
+  return (hostCanController(MCPCS).errorFlags & MCP_EFLG_ERRORMASK) ? CAN_CTRLERROR : CAN_OK;
+}
+
+INT8U MCP_CAN::getError(void) { return hostCanController(MCPCS).errorFlags; }
+INT8U MCP_CAN::errorCountRX(void) { return hostCanController(MCPCS).receiveErrors; }
+INT8U MCP_CAN::errorCountTX(void) { return hostCanController(MCPCS).transmitErrors; }
+
+INT8U MCP_CAN::abortTX(void) {
+  HostCanController &controller = hostCanController(MCPCS);
+  controller.abortCalls++;
+  controller.aborted = true;
+  return MCP2515_OK;
+}
+
+INT8U MCP_CAN::resumeTX(void) {
+  HostCanController &controller = hostCanController(MCPCS);
+  controller.resumeCalls++;
+  controller.aborted = false;
+  return MCP2515_OK;
+}
+
+void MCP_CAN::clearRXOverflow(void) {
+  hostCanController(MCPCS).errorFlags &= ~(MCP_EFLG_RX0OVR | MCP_EFLG_RX1OVR);
+}
+
+void MCP_CAN::setFrameHook(MCP_CAN_FrameHook hook, void *context) {
+  frameHook = hook;
+  frameHookContext = context;
+}
+
+void MCP_CAN::setSendGate(MCP_CAN_SendGate gate, void *context) {
+  sendGate = gate;
+  sendGateContext = context;
+}
+
+void MCP_CAN::notifyFrameHook(INT8U direction, INT8U result) {
+  if (frameHook != nullptr) frameHook(frameHookContext, direction, m_nID & 0x1FFFFFFF, m_nExtFlg, m_nRtr, m_nDlc, m_nDta, result);
+}
+
+#endif
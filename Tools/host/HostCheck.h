@@ -0,0 +1,34 @@
+// ####################################################################################################################
+//
+// Code part of CarCluster project by Andrej Rolih. See .ino file more details
+//
+// Checks for the host test programs. Every failed check is printed with its line, main() returns hostCheckResult()
+// so a failing program exits with 1.
+//
+// ####################################################################################################################
+
+#ifndef HOST_CHECK
+#define HOST_CHECK
+
+#include <stdio.h>
+
+static unsigned hostChecks = 0;
+static unsigned hostCheckFailures = 0;
+
+#define check(condition, description) hostCheck((condition), (description), __LINE__)
+
+bool hostCheck(bool condition, const char *description, int line) {
+  hostChecks++;
+  if (!condition) {
+    hostCheckFailures++;
+    printf("FAIL line %d: %s\n", line, description);
+  }
+  return condition;
+}
+
+int hostCheckResult() {
+  printf("%u checks, %u failed\n", hostChecks, hostCheckFailures);
+  return hostCheckFailures == 0 ? 0 : 1;
+}
+
+#endif
@@ -0,0 +1,32 @@
+// ####################################################################################################################
+//
+// Code part of CarCluster project by Andrej Rolih. See .ino file more details
+//
+// SPI declarations needed by the MCP_CAN header on the computer. Nothing is transferred, see HostCan.h.
+//
+// ####################################################################################################################
+
+#ifndef HOST_SPI
+#define HOST_SPI
+
+#include "Arduino.h"
+
+#define MSBFIRST 1
+#define SPI_MODE0 0
+
+class SPISettings {
+  public:
+    SPISettings(uint32_t clock = 1000000, uint8_t bitOrder = MSBFIRST, uint8_t dataMode = SPI_MODE0) {}
+};
+
+class SPIClass {
+  public:
+    void begin() {}
+    void beginTransaction(SPISettings settings) {}
+    void endTransaction() {}
+    uint8_t transfer(uint8_t data) { return 0; }
+};
+
+SPIClass SPI;
+
+#endif
@@ -0,0 +1,136 @@
+// ####################################################################################################################
+//
+// Code part of CarCluster project by Andrej Rolih. See .ino file more details
+//
+// ESP-IDF LEDC driver on the computer, only what the CarCluster sources use. The calls are recorded in hostLedcWrites
+// (Arduino.h) for every pin on the channel or timer they change. Like on the ESP32 low speed LEDC,
+// ledc_timer_config() and ledc_channel_config() restart the timer, while ledc_timer_set() and ledc_update_duty()
+// are taken over when the running period ends.
+//
+// Header only, include it once per program (after Arduino.h).
+//
+// ####################################################################################################################
+
+#ifndef HOST_DRIVER_LEDC
+#define HOST_DRIVER_LEDC
+
+#include "../Arduino.h"
+
+typedef int esp_err_t;
+#define ESP_OK 0
+#define ESP_FAIL -1
+#define ESP_ERR_INVALID_ARG 0x102
+
+typedef enum { LEDC_HIGH_SPEED_MODE = 0, LEDC_LOW_SPEED_MODE, LEDC_SPEED_MODE_MAX } ledc_mode_t;
+typedef enum { LEDC_TIMER_0 = 0, LEDC_TIMER_1, LEDC_TIMER_2, LEDC_TIMER_3, LEDC_TIMER_MAX } ledc_timer_t;
+typedef enum {
+  LEDC_CHANNEL_0 = 0, LEDC_CHANNEL_1, LEDC_CHANNEL_2, LEDC_CHANNEL_3,
+  LEDC_CHANNEL_4, LEDC_CHANNEL_5, LEDC_CHANNEL_6, LEDC_CHANNEL_7, LEDC_CHANNEL_MAX
+} ledc_channel_t;
+typedef enum { LEDC_TIMER_13_BIT = 13, LEDC_TIMER_14_BIT = 14, LEDC_TIMER_15_BIT = 15, LEDC_TIMER_BIT_MAX = 21 } ledc_timer_bit_t;
+typedef enum { LEDC_AUTO_CLK = 0, LEDC_USE_APB_CLK } ledc_clk_cfg_t;
+typedef enum { LEDC_REF_TICK = 0, LEDC_APB_CLK } ledc_clk_src_t;
+typedef enum { LEDC_INTR_DISABLE = 0, LEDC_INTR_FADE_END } ledc_intr_type_t;
+
+typedef struct {
+  ledc_mode_t speed_mode;
+  ledc_timer_bit_t duty_resolution;
+  ledc_timer_t timer_num;
+  uint32_t freq_hz;
+  ledc_clk_cfg_t clk_cfg;
+} ledc_timer_config_t;
+
+typedef struct {
+  int gpio_num;
+  ledc_mode_t speed_mode;
+  ledc_channel_t channel;
+  ledc_intr_type_t intr_type;
+  ledc_timer_t timer_sel;
+  uint32_t duty;
+  int hpoint;
+} ledc_channel_config_t;
+
+struct HostLedcTimer {
+  uint32_t divider;                        // 1/256 steps of the 80 MHz APB clock
+  uint8_t resolution;
+};
+
+struct HostLedcChannel {
+  int pin = -1;
+  ledc_timer_t timer = LEDC_TIMER_0;
+  uint32_t duty = 0;                       // Set by ledc_set_duty(), put out by ledc_update_duty()
+};
+
+static HostLedcTimer hostLedcTimers[LEDC_SPEED_MODE_MAX][LEDC_TIMER_MAX] = {};
+static HostLedcChannel hostLedcChannels[LEDC_SPEED_MODE_MAX][LEDC_CHANNEL_MAX];
+
+// Records the timer settings for every pin on the timer
+void hostLedcTimerChanged(ledc_mode_t mode, ledc_timer_t timer, bool restart) {
+  for (HostLedcChannel &channel : hostLedcChannels[mode]) {
+    if (channel.pin < 0 || channel.timer != timer) continue;
+    hostLedcState[channel.pin].divider = hostLedcTimers[mode][timer].divider;
+    hostLedcState[channel.pin].resolution = hostLedcTimers[mode][timer].resolution;
+    hostLedcRecord(channel.pin, restart);
+  }
+}
+
+esp_err_t ledc_timer_config(const ledc_timer_config_t *config) {
+  if (config->speed_mode >= LEDC_SPEED_MODE_MAX || config->timer_num >= LEDC_TIMER_MAX || config->freq_hz == 0 ||
+      config->duty_resolution < 1 || config->duty_resolution >= LEDC_TIMER_BIT_MAX) return ESP_ERR_INVALID_ARG;
+
+  // Rounded like the driver does it
+  uint64_t precision = (uint64_t)config->freq_hz << config->duty_resolution;
+  uint64_t divider = ((80000000ULL << 8) + precision / 2) / precision;
+  if (divider < 256 || divider > 0x3FFFF) return ESP_FAIL;
+
+  HostLedcTimer &timer = hostLedcTimers[config->speed_mode][config->timer_num];
+  timer.divider = (uint32_t)divider;
+  timer.resolution = config->duty_resolution;
+  hostLedcTimerChanged(config->speed_mode, config->timer_num, true);
+  return ESP_OK;
+}
+
+esp_err_t ledc_channel_config(const ledc_channel_config_t *config) {
+  if (config->speed_mode >= LEDC_SPEED_MODE_MAX || config->channel >= LEDC_CHANNEL_MAX ||
+      config->timer_sel >= LEDC_TIMER_MAX || config->gpio_num < 0 || config->gpio_num >= 64) return ESP_ERR_INVALID_ARG;
+
+  HostLedcChannel &channel = hostLedcChannels[config->speed_mode][config->channel];
+  channel.pin = config->gpio_num;
+  channel.timer = config->timer_sel;
+  channel.duty = config->duty;
+
+  const HostLedcTimer &timer = hostLedcTimers[config->speed_mode][config->timer_sel];
+  hostLedcState[channel.pin].frequency = 0;
+  hostLedcState[channel.pin].divider = timer.divider;
+  hostLedcState[channel.pin].resolution = timer.resolution;
+  hostLedcState[channel.pin].duty = config->duty;
+  hostLedcRecord(channel.pin, true);
+  return ESP_OK;
+}
+
+// Writes the divider without resetting the timer, it is taken over when the running period ends
+esp_err_t ledc_timer_set(ledc_mode_t mode, ledc_timer_t timer, uint32_t divider, uint32_t resolution, ledc_clk_src_t source) {
+  if (mode >= LEDC_SPEED_MODE_MAX || timer >= LEDC_TIMER_MAX || divider < 256 || divider > 0x3FFFF ||
+      resolution < 1 || resolution >= LEDC_TIMER_BIT_MAX || source != LEDC_APB_CLK) return ESP_ERR_INVALID_ARG;
+
+  hostLedcTimers[mode][timer].divider = divider;
+  hostLedcTimers[mode][timer].resolution = resolution;
+  hostLedcTimerChanged(mode, timer, false);
+  return ESP_OK;
+}
+
+esp_err_t ledc_set_duty(ledc_mode_t mode, ledc_channel_t channel, uint32_t duty) {
+  if (mode >= LEDC_SPEED_MODE_MAX || channel >= LEDC_CHANNEL_MAX) return ESP_ERR_INVALID_ARG;
+  hostLedcChannels[mode][channel].duty = duty;
+  return ESP_OK;
+}
+
+esp_err_t ledc_update_duty(ledc_mode_t mode, ledc_channel_t channel) {
+  if (mode >= LEDC_SPEED_MODE_MAX || channel >= LEDC_CHANNEL_MAX || hostLedcChannels[mode][channel].pin < 0) return ESP_ERR_INVALID_ARG;
+  HostLedcChannel &ledcChannel = hostLedcChannels[mode][channel];
+  hostLedcState[ledcChannel.pin].duty = ledcChannel.duty;
+  hostLedcRecord(ledcChannel.pin, false);
+  return ESP_OK;
+}
+
+#endif
@@ -0,0 +1,301 @@
+// ####################################################################################################################
+//
+// Code part of CarCluster project by Andrej Rolih. See .ino file more details
+//
+// Runs KBus (CarCluster/src/Clusters/BMW_E46/KBus.cpp) on a simulated single wire bus: time is cut into byte slots,
+// every transmitter (KBus through its HardwareSerial and the other modules of the test) puts its bytes into the next
+// free slots and two bytes in the same slot are ANDed like on the real open collector bus. Every slot is received
+// back by KBus, so it sees its own echo. Checks echo matching, idle waiting, collision backoff and retry, dropping
+// after the maximum retries, resync after bad checksums, the IKE/MFL events and that a loop polling only every
+// 5-10 ms (several bytes per update(), all with the same time) still gets every message. Runs on the computer, not on the ESP32:
+//
+//   g++ -std=c++11 -ITools/host -o kbus Tools/kbus.cpp && ./kbus
+//
+// ####################################################################################################################
+
+#include <map>
+
+#include "Arduino.h"
+
+#include "../CarCluster/src/Clusters/BMW_E46/KBus.cpp"
+
+#include "HostCheck.h"
+
+static HardwareSerial kbusSerial;
+static KBus kbus(kbusSerial);
+
+static std::map<uint64_t, uint8_t> slots;  // Slot number -> byte on the wire
+static uint64_t lastKBusSlot = 0;          // Last slot used by KBus (a UART sends its bytes back to back)
+static size_t wiredBytes = 0;              // Bytes of kbusSerial.sent that are on the wire
+static uint64_t lastKBusStart = 0;         // Time KBus started its last write (us)
+static bool jamming = false;               // Another module pulls byte 2 of every KBus write low
+static unsigned long minimumPoll = 100;    // Time between update() calls (us), random in this range
+static unsigned long maximumPoll = 100;
+static uint64_t nextPoll = 0;
+
+static uint64_t currentSlot() { return hostTime / KBus::byteTime; }
+
+// Puts bytes on the wire from the next slot on, back to back. Returns the first slot.
+static uint64_t putOnWire(const uint8_t *bytes, size_t length, uint64_t firstSlot) {
+  for (size_t i = 0; i < length; i++) {
+    uint64_t slot = firstSlot + i;
+    std::map<uint64_t, uint8_t>::iterator existing = slots.find(slot);
+    if (existing == slots.end()) {
+      slots[slot] = bytes[i];
+    } else {
+      existing->second &= bytes[i];
+    }
+  }
+  return firstSlot;
+}
+
+static void otherModuleSends(const std::vector<uint8_t> &bytes) {
+  putOnWire(bytes.data(), bytes.size(), currentSlot() + 1);
+}
+
+static std::vector<uint8_t> message(uint8_t source, uint8_t destination, std::vector<uint8_t> data) {
+  std::vector<uint8_t> bytes = { source, (uint8_t)(data.size() + 2), destination };
+  bytes.insert(bytes.end(), data.begin(), data.end());
+  uint8_t checksum = 0;
+  for (uint8_t byte : bytes) checksum ^= byte;
+  bytes.push_back(checksum);
+  return bytes;
+}
+
+// Moves time in 100 us steps: new KBus bytes go on the wire, finished slots are received and update() is called
+// when the next poll is due
+static void run(unsigned long us) {
+  for (unsigned long elapsed = 0; elapsed < us; elapsed += 100) {
+    hostAdvance(100);
+
+    if (wiredBytes < kbusSerial.sent.size()) {
+      uint64_t first = currentSlot() + 1;
+      if (first <= lastKBusSlot) first = lastKBusSlot + 1;
+      if (wiredBytes == 0 || first > lastKBusSlot + 1) lastKBusStart = hostTime;
+      putOnWire(kbusSerial.sent.data() + wiredBytes, kbusSerial.sent.size() - wiredBytes, first);
+      if (jamming) putOnWire((const uint8_t *)"\0", 1, first + 2);
+      lastKBusSlot = first + kbusSerial.sent.size() - wiredBytes - 1;
+      wiredBytes = kbusSerial.sent.size();
+    }
+
+    while (!slots.empty() && (slots.begin()->first + 1) * KBus::byteTime <= hostTime) {
+      kbusSerial.receiveQueue.push_back(slots.begin()->second);
+      slots.erase(slots.begin());
+    }
+
+    if (hostTime >= nextPoll) {
+      kbus.update();
+      nextPoll = hostTime + random(minimumPoll, maximumPoll + 1);
+    }
+  }
+}
+
+static void testEchoMatch() {
+  printf("Echo match and idle wait\n");
+
+  // Another module is talking (KBus only knows once the first byte is in), it has to wait for the bus to be idle
+  otherModuleSends(message(KBus::Address_GT, KBus::Address_IKE, { 0x01 }));
+  uint64_t otherEnd = (currentSlot() + 1 + 5) * KBus::byteTime;
+  run(2 * KBus::byteTime);
+  uint8_t data[] = { 0x5B, 0x00, 0x00 };
+  check(kbus.send(KBus::Address_LCM, KBus::Address_Broadcast, data, 3), "message is queued");
+  run(50000);
+
+  std::vector<uint8_t> expected = message(KBus::Address_LCM, KBus::Address_Broadcast, { 0x5B, 0x00, 0x00 });
+  check(kbusSerial.sent == expected, "message is written with length and checksum");
+  check(lastKBusStart >= otherEnd + KBus::idleTime, "write waits until the bus was idle for idleTime");
+  check(kbus.sentMessages() == 1 && kbus.collisions() == 0, "matching echo finishes the message");
+  check(kbus.receivedMessages() == 2, "own message and the other module's message are received");
+}
+
+static void testCollisionRetry() {
+  printf("Collision during the echo, backoff and retry\n");
+
+  kbusSerial.sent.clear();
+  wiredBytes = 0;
+  uint8_t data[] = { 0x5B, 0x01, 0x02, 0x03, 0x04 };
+  kbus.send(KBus::Address_LCM, KBus::Address_Broadcast, data, 5);
+
+  // Start the write, then another module starts talking in the middle of it
+  unsigned long waited = 0;
+  while (kbusSerial.sent.empty() && waited < 20000) {
+    run(100);
+    waited += 100;
+  }
+  run(3 * KBus::byteTime);
+  otherModuleSends({ 0x00, 0x00 });
+  size_t firstWrite = kbusSerial.sent.size();
+  unsigned long collisionTime = 0;
+  while (kbus.collisions() == 0 && collisionTime < 20 * KBus::byteTime) {
+    run(100);
+    collisionTime += 100;
+  }
+
+  check(kbus.collisions() == 1, "corrupted echo byte is a collision");
+  check(kbus.sentMessages() == 1, "collided message is not counted as sent");
+  run(KBus::idleTime);
+  check(kbusSerial.sent.size() == firstWrite, "no retry before the bus was idle for idleTime");
+
+  // Retry comes after the backoff and goes through
+  run(50000);
+  std::vector<uint8_t> expected = message(KBus::Address_LCM, KBus::Address_Broadcast, { 0x5B, 0x01, 0x02, 0x03, 0x04 });
+  std::vector<uint8_t> twice = expected;
+  twice.insert(twice.end(), expected.begin(), expected.end());
+  check(kbusSerial.sent == twice, "message is written again");
+  check(kbus.sentMessages() == 2 && kbus.collisions() == 1 && kbus.droppedMessages() == 0, "retry is sent");
+}
+
+static void testMaximumRetries() {
+  printf("Collision on every try, message is dropped\n");
+
+  kbusSerial.sent.clear();
+  wiredBytes = 0;
+  uint32_t collisions = kbus.collisions();
+  uint8_t first[] = { 0x01 };
+  uint8_t second[] = { 0x02 };
+  kbus.send(KBus::Address_LCM, KBus::Address_IKE, first, 1);
+  kbus.send(KBus::Address_LCM, KBus::Address_IKE, second, 1);
+
+  jamming = true;
+  while (kbus.collisions() - collisions < KBus::maximumRetries + 1 && hostTime < 10000000) run(100);
+  jamming = false;
+  run(50000);
+
+  check(kbus.collisions() - collisions == KBus::maximumRetries + 1, "every try collides");
+  check(kbus.droppedMessages() == 1, "message is dropped after the maximum retries");
+  check(kbus.sentMessages() == 3, "next message in the queue is sent");
+  std::vector<uint8_t> last = message(KBus::Address_LCM, KBus::Address_IKE, { 0x02 });
+  check(kbusSerial.sent.size() >= last.size() && std::equal(last.begin(), last.end(), kbusSerial.sent.end() - last.size()),
+        "the next message is the last one written");
+}
+
+static void testResync() {
+  printf("Resync after a bad checksum\n");
+
+  uint32_t received = kbus.receivedMessages();
+  uint32_t checksumErrors = kbus.checksumErrors();
+  KBus::Event event;
+  while (kbus.readEvent(event)) {}
+
+  // Broken message followed right away by a good one
+  std::vector<uint8_t> broken = message(KBus::Address_IKE, KBus::Address_Broadcast, { 0x18, 50, 30 });
+  broken[4] ^= 0x10;
+  std::vector<uint8_t> good = message(KBus::Address_IKE, KBus::Address_Broadcast, { 0x18, 60, 20 });
+  std::vector<uint8_t> bytes = broken;
+  bytes.insert(bytes.end(), good.begin(), good.end());
+  otherModuleSends(bytes);
+  run(20 * KBus::byteTime);
+
+  check(kbus.checksumErrors() > checksumErrors, "bad checksum is counted");
+  check(kbus.receivedMessages() == received + 1, "message after the broken one is found");
+  check(kbus.readEvent(event) && event.type == KBus::Event_SpeedRpm && event.value1 == 120 && event.value2 == 2000,
+        "message after the broken one is decoded");
+  check(!kbus.readEvent(event), "broken message has no event");
+
+  // Garbage, silence, then a message
+  otherModuleSends({ 0x80, 0x0A, 0xBF });
+  run(10000);
+  otherModuleSends(message(KBus::Address_IKE, KBus::Address_Broadcast, { 0x11, 0x01 }));
+  run(10000);
+  check(kbus.readEvent(event) && event.type == KBus::Event_Ignition && event.value1 == 1, "partial message is skipped after silence");
+}
+
+static void testEvents() {
+  printf("IKE and MFL events\n");
+
+  KBus::Event event;
+  while (kbus.readEvent(event)) {}
+
+  otherModuleSends(message(KBus::Address_IKE, KBus::Address_Broadcast, { 0x11, 0x03 }));
+  run(10000);
+  otherModuleSends(message(KBus::Address_IKE, KBus::Address_Broadcast, { 0x19, (uint8_t)-12, 90 }));
+  run(10000);
+  otherModuleSends(message(KBus::Address_IKE, KBus::Address_GT, { 0x57, 0x02 }));
+  run(10000);
+  otherModuleSends(message(KBus::Address_MFL, 0x68, { 0x32, 0x11 }));
+  run(10000);
+  otherModuleSends(message(KBus::Address_MFL, 0x68, { 0x3B, 0x21 }));
+  run(10000);
+  otherModuleSends(message(KBus::Address_GT, KBus::Address_Broadcast, { 0x18, 50, 30 }));  // Not from the IKE
+  run(10000);
+
+  check(kbus.readEvent(event) && event.type == KBus::Event_Ignition && event.value1 == 3, "ignition");
+  check(kbus.readEvent(event) && event.type == KBus::Event_Temperatures && event.value1 == -12 && event.value2 == 90, "temperatures");
+  check(kbus.readEvent(event) && event.type == KBus::Event_IkeButton && event.value1 == 0x02, "IKE button");
+  check(kbus.readEvent(event) && event.type == KBus::Event_MflButton && event.value1 == 0x32 && event.value2 == 0x11, "MFL volume");
+  check(kbus.readEvent(event) && event.type == KBus::Event_MflButton && event.value1 == 0x3B && event.value2 == 0x21 &&
+        event.source == KBus::Address_MFL, "MFL button");
+  check(!kbus.readEvent(event), "speed from another module is not an event");
+
+  // Oldest events are dropped when nobody reads them
+  for (uint8_t i = 0; i < KBus::eventQueueSize + 2; i++) {
+    otherModuleSends(message(KBus::Address_IKE, KBus::Address_GT, { 0x57, i }));
+    run(10000);
+  }
+  check(kbus.readEvent(event) && event.value1 == 2, "oldest events are dropped");
+}
+
+static void testSlowPolling() {
+  printf("Polling every 5-10 ms\n");
+
+  minimumPoll = 5000;
+  maximumPoll = 10000;
+  uint32_t received = kbus.receivedMessages();
+  uint32_t checksumErrors = kbus.checksumErrors();
+  uint32_t sent = kbus.sentMessages();
+  uint32_t collisions = kbus.collisions();
+  KBus::Event event;
+  while (kbus.readEvent(event)) {}
+
+  // 10 byte messages (11.5 ms each) back to back and with short gaps, several bytes come in with every update()
+  int16_t events = 0;
+  uint32_t wrong = 0;
+  for (uint8_t i = 0; i < 100; i++) {
+    std::vector<uint8_t> speed = message(KBus::Address_IKE, KBus::Address_Broadcast, { 0x18, i, 30, 0x00, 0x00, 0x00 });
+    otherModuleSends(speed);
+    run(speed.size() * KBus::byteTime + random(0, 3) * KBus::byteTime);
+    while (kbus.readEvent(event)) {
+      if (event.type != KBus::Event_SpeedRpm || event.value1 != events * 2) wrong++;
+      events++;
+    }
+  }
+  run(20000);
+  while (kbus.readEvent(event)) {
+    if (event.type != KBus::Event_SpeedRpm || event.value1 != events * 2) wrong++;
+    events++;
+  }
+  check(kbus.receivedMessages() - received == 100 && events == 100 && wrong == 0, "every message is received in order");
+  check(kbus.checksumErrors() == checksumErrors, "no message is cut apart");
+
+  // Garbage, then a message while the loop is slow
+  otherModuleSends({ 0x80, 0x0A, 0xBF });
+  run(20000);
+  otherModuleSends(message(KBus::Address_IKE, KBus::Address_Broadcast, { 0x11, 0x03 }));
+  run(20000);
+  check(kbus.readEvent(event) && event.type == KBus::Event_Ignition && event.value1 == 3, "message after garbage is found");
+
+  // Own messages still go out and match their echo
+  kbusSerial.sent.clear();
+  wiredBytes = 0;
+  uint8_t data[] = { 0x5B, 0x00, 0x00, 0x00, 0x00, 0x00 };
+  kbus.send(KBus::Address_LCM, KBus::Address_Broadcast, data, 6);
+  run(100000);
+  check(kbus.sentMessages() == sent + 1 && kbus.collisions() == collisions, "own message is sent");
+
+  minimumPoll = maximumPoll = 100;
+}
+
+int main() {
+  randomSeed(1);
+  kbus.begin(16, 17);
+  check(kbusSerial.baudRate == 9600 && kbusSerial.config == SERIAL_8E1, "UART is 9600 8E1");
+
+  testEchoMatch();
+  testCollisionRetry();
+  testMaximumRetries();
+  testResync();
+  testEvents();
+  testSlowPolling();
+
+  return hostCheckResult();
+}
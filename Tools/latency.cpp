@@ -0,0 +1,120 @@
+// ####################################################################################################################
+//
+// Code part of CarCluster project by Andrej Rolih. See .ino file more details
+//
+// Simulates the telemetry to CAN latency of the traced signals (speed, RPM, gear, indicators) for every cluster and
+// prints the same percentiles the device reports on /api/latency and with serial action 42. Runs on the computer,
+// not on the ESP32:
+//
+//   g++ -std=c++11 -o latency Tools/latency.cpp && ./latency [loop period in us, default 1000]
+//
+// Model: a packet arrives at a random time, is picked up by the next loop iteration (uniform within the loop period)
+// and waits for the next cluster update of the frame that carries the signal (period from ClusterBusSchedules.h).
+// The cluster sends its frames one after another in table order, so the frame goes out after the transmission of
+// every frame before it that is sent at least as often. Other traffic on the bus and SPI time are not included,
+// compare with what the device measures to see how much they add.
+//
+// ####################################################################################################################
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "../CarCluster/src/Clusters/ClusterBusSchedules.h"
+#include "../CarCluster/src/Clusters/ClusterSignalFrames.h"
+
+static const uint32_t sampleCount = 100000;
+static const uint32_t simulatedTime = 10000000;  // Arrivals are spread over 10 s (us)
+
+struct ClusterModel {
+  const char *name;
+  const CanBusLoad::Bus *buses;
+  uint8_t busCount;
+  const SignalFrame *signalFrames;
+  uint8_t signalFrameCount;
+};
+
+// When the frame goes out after the start of a cluster update (us) and its period (ms). False if it is not scheduled.
+static bool frameTiming(const ClusterModel &cluster, uint32_t id, uint32_t &offset, uint32_t &period) {
+  for (uint8_t b = 0; b < cluster.busCount; b++) {
+    const CanBusLoad::Bus &bus = cluster.buses[b];
+    for (uint8_t i = 0; i < bus.frameCount; i++) {
+      if (bus.frames[i].id != id) continue;
+
+      offset = CanBusLoad::transmissionTime(bus, i);
+      for (uint8_t j = 0; j < i; j++) {
+        if (bus.frames[j].period <= bus.frames[i].period) offset += CanBusLoad::transmissionTime(bus, j);
+      }
+      period = bus.frames[i].period;
+      return true;
+    }
+  }
+  return false;
+}
+
+static uint32_t randomState = 0x12345678;
+
+static uint32_t random32() {
+  // xorshift32, the same sequence on every run
+  randomState ^= randomState << 13;
+  randomState ^= randomState >> 17;
+  randomState ^= randomState << 5;
+  return randomState;
+}
+
+static void simulateCluster(const ClusterModel &cluster, uint32_t loopPeriod) {
+  printf("%s (loop period %u us)\n", cluster.name, loopPeriod);
+  printf("   signal       p50 us    p90 us    p99 us    max us\n");
+
+  for (uint8_t signal = 0; signal < LatencySignal_Count; signal++) {
+    LatencyHistogram histogram;
+
+    for (uint32_t sample = 0; sample < sampleCount; sample++) {
+      uint64_t arrival = random32() % simulatedTime;
+      uint64_t pickup = arrival + random32() % loopPeriod;
+      uint64_t best = UINT64_MAX;
+
+      for (uint8_t f = 0; f < cluster.signalFrameCount; f++) {
+        const SignalFrame &frame = cluster.signalFrames[f];
+        uint32_t offset, period;
+        if ((frame.signals & (1 << signal)) == 0 || !frameTiming(cluster, frame.id, offset, period)) continue;
+
+        uint64_t periodUs = period * 1000ULL;
+        uint64_t update = (pickup + periodUs - 1) / periodUs * periodUs;
+        if (update + offset - arrival < best) best = update + offset - arrival;
+      }
+
+      if (best == UINT64_MAX) break;
+      histogram.record(best);
+    }
+
+    if (histogram.count() == 0) {
+      printf("   %-10s   not traced\n", latencySignalName(signal));
+      continue;
+    }
+    printf("   %-10s %8u  %8u  %8u  %8u\n", latencySignalName(signal), histogram.percentile(50), histogram.percentile(90),
+           histogram.percentile(99), histogram.maximum());
+  }
+  printf("\n");
+}
+
+#define CLUSTER_MODEL(name, buses, signalFrames) \
+  { name, buses, sizeof(buses) / sizeof(buses[0]), signalFrames, sizeof(signalFrames) / sizeof(signalFrames[0]) }
+
+int main(int argc, char **argv) {
+  uint32_t loopPeriod = argc > 1 ? strtoul(argv[1], NULL, 10) : 1000;
+  if (loopPeriod == 0) loopPeriod = 1;
+
+  const ClusterModel clusters[] = {
+    CLUSTER_MODEL("BMW F", bmwFSeriesBuses, bmwFSeriesSignalFrames),
+    CLUSTER_MODEL("VW MQB", vwMQBBuses, vwMQBSignalFrames),
+    CLUSTER_MODEL("VW PQ25", vwPQ25Buses, vwPQSignalFrames),
+    CLUSTER_MODEL("VW PQ46", vwPQ46Buses, vwPQSignalFrames),
+    CLUSTER_MODEL("BMW E", bmwESeriesBuses, bmwESeriesSignalFrames),
+    CLUSTER_MODEL("BMW E46", bmwE46Buses, bmwE46SignalFrames),
+    CLUSTER_MODEL("Mercedes W204", mercedesW204Buses, mercedesSignalFrames),
+    CLUSTER_MODEL("Mercedes W221", mercedesW221Buses, mercedesSignalFrames)
+  };
+
+  for (size_t i = 0; i < sizeof(clusters) / sizeof(clusters[0]); i++) simulateCluster(clusters[i], loopPeriod);
+  return 0;
+}
@@ -0,0 +1,376 @@
+// ####################################################################################################################
+//
+// Code part of CarCluster project by Andrej Rolih. See .ino file more details
+//
+// Runs MqttPublisher (CarCluster/src/Other/MqttPublisher.cpp) against a local broker stand-in on 127.0.0.1. Both use
+// the sketch's Mongoose (it builds for Unix as it is) and run in one thread, the time is moved 1 ms at a time and the
+// sockets are polled at every step, so the broker can hold back CONNACK and PUBACK for as long as a test wants. The
+// tests check the batching (one message per publishInterval with every changed sample), the backpressure (one message
+// in flight, a full batch drops samples instead of growing), the PUBACK latency, the ack timeout, the commands, the
+// CONNACK timeout and reconnecting.
+//
+//   M=CarCluster/src/Other/mongoose
+//   gcc -O2 -DMG_DATA_SIZE=64 '-DHTTP_URL="http://127.0.0.1:18190"' '-DHTTPS_URL="https://127.0.0.1:18543"' -c $M/*.c
+//   g++ -std=c++11 -O2 -Wno-narrowing -DMG_DATA_SIZE=64 -ITools/host -o mqtt Tools/mqtt.cpp mongoose*.o && ./mqtt
+//
+// ####################################################################################################################
+
+#include <string>
+
+#include "Arduino.h"
+#include "HostCan.h"
+
+#include "../CarCluster/src/Other/GaugeCalibration.cpp"
+#include "../CarCluster/src/Other/SerialOutput.cpp"
+#include "../CarCluster/src/Other/CanBusController.cpp"
+#include "../CarCluster/src/Games/GameStateSnapshot.cpp"
+#include "../CarCluster/src/Other/MqttPublisher.cpp"
+
+#include "HostCheck.h"
+
+static const char *brokerUrl = "tcp://127.0.0.1:18830";
+static const char *publisherUrl = "mqtt://127.0.0.1:18830";
+
+// Broker stand-in ####################################################################################################
+
+struct BrokerMessage {
+  unsigned long time;                      // ms
+  std::string topic;
+  std::string data;
+  uint16_t id;
+};
+
+struct BrokerAck {
+  unsigned long time;                      // ms when it is sent
+  uint16_t id;
+};
+
+struct Broker {
+  // Behaviour, set by the tests
+  bool answerConnect = true;
+  uint8_t connectResult = 0;               // CONNACK return code
+  long ackDelay = 0;                       // ms, < 0 never acknowledges
+
+  // What it saw
+  struct mg_connection *client = nullptr;
+  unsigned connects = 0;
+  std::vector<unsigned long> connectTimes;
+  unsigned closes = 0;
+  std::string subscribed;
+  std::vector<BrokerMessage> messages;
+  std::vector<BrokerAck> pendingAcks;
+};
+
+static Broker broker;
+
+static void brokerSend(struct mg_connection *c, uint8_t cmd, const uint8_t *data, size_t length) {
+  mg_mqtt_send_header(c, cmd, 0, length);
+  mg_send(c, data, length);
+}
+
+static void brokerEvent(struct mg_connection *c, int ev, void *ev_data) {
+  if (ev == MG_EV_ACCEPT) {
+    broker.client = c;
+  } else if (ev == MG_EV_CLOSE && c == broker.client) {
+    broker.client = nullptr;
+    broker.closes++;
+    broker.pendingAcks.clear();
+  } else if (ev == MG_EV_READ) {
+    struct mg_mqtt_message mm;
+    while (mg_mqtt_parse(c->recv.buf, c->recv.len, 4, &mm) == MQTT_OK) {
+      if (mm.cmd == MQTT_CMD_CONNECT) {
+        broker.connects++;
+        broker.connectTimes.push_back(millis());
+        uint8_t connack[] = { 0, broker.connectResult };
+        if (broker.answerConnect) brokerSend(c, MQTT_CMD_CONNACK, connack, sizeof(connack));
+      } else if (mm.cmd == MQTT_CMD_SUBSCRIBE) {
+        // Packet ID, then the topic filter (length, name) and its QoS
+        const uint8_t *body = (const uint8_t *)mm.dgram.buf + 1;
+        while (*body & 0x80) body++;
+        body++;
+        uint16_t topicLength = (uint16_t)(body[2] << 8 | body[3]);
+        broker.subscribed = std::string((const char *)body + 4, topicLength);
+        uint8_t suback[] = { body[0], body[1], 0 };
+        brokerSend(c, MQTT_CMD_SUBACK, suback, sizeof(suback));
+      } else if (mm.cmd == MQTT_CMD_PUBLISH) {
+        BrokerMessage message = { millis(), std::string(mm.topic.buf, mm.topic.len), std::string(mm.data.buf, mm.data.len), mm.id };
+        broker.messages.push_back(message);
+        if (mm.qos > 0 && broker.ackDelay >= 0) broker.pendingAcks.push_back({ millis() + broker.ackDelay, mm.id });
+      } else if (mm.cmd == MQTT_CMD_PINGREQ) {
+        brokerSend(c, MQTT_CMD_PINGRESP, NULL, 0);
+      }
+      mg_iobuf_del(&c->recv, 0, mm.dgram.len);
+    }
+  }
+}
+
+static void brokerUpdate() {
+  while (broker.client != nullptr && !broker.pendingAcks.empty() && millis() >= broker.pendingAcks.front().time) {
+    uint16_t id = broker.pendingAcks.front().id;
+    uint8_t puback[] = { (uint8_t)(id >> 8), (uint8_t)id };
+    brokerSend(broker.client, MQTT_CMD_PUBACK, puback, sizeof(puback));
+    broker.pendingAcks.erase(broker.pendingAcks.begin());
+  }
+}
+
+// Sends a command like a client publishing on the command topic would
+static void brokerCommand(const char *topic, const char *json) {
+  struct mg_mqtt_opts opts;
+  memset(&opts, 0, sizeof(opts));
+  opts.topic = mg_str(topic);
+  opts.message = mg_str(json);
+  if (broker.client != nullptr) mg_mqtt_pub(broker.client, &opts);
+}
+
+static void brokerReset(long ackDelay) {
+  broker.answerConnect = true;
+  broker.connectResult = 0;
+  broker.ackDelay = ackDelay;
+  broker.messages.clear();
+  broker.connectTimes.clear();
+  broker.connects = 0;
+  broker.closes = 0;
+}
+
+// Publisher ##########################################################################################################
+
+static GameState game(ClusterConfiguration{});
+static RuntimeMetrics metrics;
+static MCP_CAN CAN(5);
+static CanBusController canController(CAN, 1);
+static CanBusController *controllers[] = { &canController };
+
+// Moves time 1 ms at a time, polls the sockets and updates the broker and the publisher like the loop does
+static void run(unsigned long ms, MqttPublisher &publisher, void (*everyMs)() = nullptr) {
+  for (unsigned long elapsed = 0; elapsed < ms; elapsed++) {
+    hostAdvance(1000);
+    mg_mgr_poll(&g_mgr, 0);
+    mg_mgr_poll(&g_mgr, 0);
+    brokerUpdate();
+    if (everyMs != nullptr) everyMs();
+    publisher.update();
+  }
+}
+
+static void changeSpeed() {
+  if (millis() % 10 == 0) game.speed = (game.speed + 1) % 250;
+}
+
+// The samples of a telemetry message, empty if it does not parse
+static JsonArray messageSamples(const BrokerMessage &message, JsonDocument &doc) {
+  if (deserializeJson(doc, message.data)) return JsonArray();
+  return doc["s"].as<JsonArray>();
+}
+
+static void testConnect(MqttPublisher &publisher) {
+  printf("Connect and subscribe\n");
+  brokerReset(0);
+  run(100, publisher);
+  check(publisher.isConnected(), "publisher connects");
+  check(broker.connects == 1, "one CONNECT");
+  check(broker.subscribed == "cluster/cmd", "publisher subscribes to the command topic");
+}
+
+static void testBatching(MqttPublisher &publisher) {
+  printf("Batching\n");
+  brokerReset(5);
+  run(1000, publisher, changeSpeed);
+  size_t first = broker.messages.size();
+  run(5000, publisher, changeSpeed);
+
+  // publishInterval 500 ms, sampleInterval 50 ms, the state changes every 10 ms
+  size_t count = broker.messages.size() - first;
+  check(count >= 9 && count <= 11, "one message per publish interval");
+  bool topics = true, sequence = true, samples = true, offsets = true;
+  long lastSequence = -1;
+  for (size_t i = first; i < broker.messages.size(); i++) {
+    JsonDocument doc;
+    JsonArray s = messageSamples(broker.messages[i], doc);
+    topics = topics && broker.messages[i].topic == "cluster/telemetry";
+    long seq = doc["seq"] | -1;
+    sequence = sequence && (lastSequence < 0 || seq == lastSequence + 1);
+    lastSequence = seq;
+    samples = samples && s.size() >= 9 && s.size() <= 11;
+    long lastOffset = -1;
+    for (JsonArray sample : s) {
+      offsets = offsets && sample[0].as<long>() > lastOffset;
+      lastOffset = sample[0];
+    }
+  }
+  check(topics, "telemetry goes to <topic>/telemetry");
+  check(sequence, "sequence numbers follow each other");
+  check(samples, "every message has the samples of its interval");
+  check(offsets, "sample offsets grow");
+  check(publisher.droppedSamples() == 0, "no samples are dropped with a fast broker");
+
+  // An unchanged state is sampled once per batch
+  size_t before = broker.messages.size();
+  run(2000, publisher);
+  bool single = broker.messages.size() > before;
+  for (size_t i = before + 1; i < broker.messages.size(); i++) {
+    JsonDocument doc;
+    single = single && messageSamples(broker.messages[i], doc).size() == 1;
+  }
+  check(single, "unchanged state gives one sample per message");
+
+  JsonDocument doc;
+  deserializeJson(doc, broker.messages.back().data);
+  check(doc["h"]["heap"] == hostFreeHeap && doc["h"]["can"].size() == 1, "health is in every message");
+}
+
+static void testLatency(MqttPublisher &publisher) {
+  printf("PUBACK latency\n");
+  brokerReset(20);
+  run(2000, publisher, changeSpeed);
+  printf("  broker acknowledges after 20 ms: latency %lu ms\n", publisher.lastLatency());
+  check(publisher.lastLatency() >= 20 && publisher.lastLatency() <= 23, "latency is the time to the PUBACK");
+}
+
+static void testBackpressure(MqttPublisher &publisher) {
+  printf("Backpressure\n");
+  brokerReset(3000);
+  uint32_t dropped = publisher.droppedSamples();
+  uint32_t published = publisher.publishedMessages();
+  run(10000, publisher, changeSpeed);
+
+  // One message in flight: the next one only goes after the PUBACK of the previous one
+  bool oneInFlight = true;
+  for (size_t i = 1; i < broker.messages.size(); i++) {
+    oneInFlight = oneInFlight && broker.messages[i].time - broker.messages[i - 1].time >= 3000;
+  }
+  check(broker.messages.size() >= 3 && oneInFlight, "next message waits for the PUBACK");
+  check(publisher.publishedMessages() - published == broker.messages.size(), "every message reaches the broker");
+
+  bool bounded = true;
+  for (const BrokerMessage &message : broker.messages) {
+    JsonDocument doc;
+    bounded = bounded && messageSamples(message, doc).size() <= MqttPublisher::maximumBatchSamples;
+  }
+  check(bounded, "a full batch does not grow");
+  check(publisher.droppedSamples() > dropped, "a full batch drops samples");
+  printf("  broker acknowledges after 3000 ms: %zu messages in 10 s, %u samples dropped, latency %lu ms\n",
+         broker.messages.size(), publisher.droppedSamples() - dropped, publisher.lastLatency());
+  check(publisher.lastLatency() >= 3000 && publisher.lastLatency() <= 3003, "latency with a slow broker");
+  check(publisher.maximumLatency() >= 3000, "maximum latency is kept");
+}
+
+static void testAckTimeout(MqttPublisher &publisher) {
+  printf("Ack timeout\n");
+  brokerReset(-1);
+  run(1000, publisher, changeSpeed);  // Acks of the previous test still go out
+  broker.pendingAcks.clear();
+  uint32_t lost = publisher.lostMessages();
+  broker.messages.clear();
+  run(12000, publisher, changeSpeed);
+  check(publisher.lostMessages() - lost >= 2, "unacknowledged messages are counted as lost");
+  bool waited = broker.messages.size() >= 2;
+  for (size_t i = 1; i < broker.messages.size(); i++) {
+    waited = waited && broker.messages[i].time - broker.messages[i - 1].time >= MqttPublisher::ackTimeout;
+  }
+  check(waited, "next message goes after the ack timeout");
+  check(publisher.isConnected(), "connection stays up");
+}
+
+static void testCommands(MqttPublisher &publisher) {
+  printf("Commands\n");
+  brokerReset(0);
+  run(100, publisher);
+  uint32_t commands = publisher.receivedCommands();
+  uint32_t invalid = publisher.invalidCommands();
+  uint32_t buttons = game.buttonEventCount;
+  game.gear = GearState_Auto_P;
+  game.highBeam = false;
+  game.handbrake = false;
+
+  brokerCommand("cluster/cmd", "{\"gear\":14,\"high_beam\":true,\"handbrake\":true,\"button\":3,\"hold\":500}");
+  run(10, publisher);
+  check(publisher.receivedCommands() - commands == 1, "command is received");
+  check(game.gear == GearState_Auto_D && game.highBeam && game.handbrake, "command changes the game state");
+  check(game.buttonEventCount - buttons == 1, "command pushes the button press");
+  ButtonEvent &event = game.buttonEvents[(game.buttonEventCount - 1) % GameState::buttonEventCapacity];
+  check(event.button == 3 && event.holdDuration == 500, "button press has its hold time");
+
+  brokerCommand("cluster/cmd", "{\"gear\":40}");
+  brokerCommand("cluster/cmd", "{\"gear\":");
+  brokerCommand("cluster/other", "{\"gear\":1}");
+  run(10, publisher);
+  check(game.gear == GearState_Auto_D, "gear out of range is ignored");
+  check(publisher.receivedCommands() - commands == 2, "other topics are ignored");
+  check(publisher.invalidCommands() - invalid == 1, "invalid JSON is counted");
+}
+
+// Time between two CONNECTs the broker saw, in ms
+static unsigned long connectGap(size_t index) {
+  return broker.connectTimes[index] - broker.connectTimes[index - 1];
+}
+
+static void testReconnect(MqttPublisher &publisher) {
+  printf("Reconnect\n");
+  brokerReset(-1);
+  run(MqttPublisher::ackTimeout + 1000, publisher, changeSpeed);  // Message of the ack timeout test is given up first
+  uint32_t lost = publisher.lostMessages();
+  check(broker.messages.size() >= 1 && broker.pendingAcks.empty(), "message is in flight");
+
+  broker.ackDelay = 0;
+  broker.client->is_closing = 1;
+  run(100, publisher);
+  check(broker.closes == 1, "broker closes the connection");
+  check(publisher.lostMessages() - lost == 1, "message in flight is lost with the connection");
+  check(publisher.isConnected() && broker.connects == 1, "publisher reconnects");
+
+  size_t messages = broker.messages.size();
+  run(1000, publisher, changeSpeed);
+  check(broker.messages.size() > messages, "publisher sends after reconnecting");
+}
+
+static void testConnackTimeout(MqttPublisher &publisher) {
+  printf("CONNACK timeout\n");
+  brokerReset(0);
+  broker.answerConnect = false;
+  broker.client->is_closing = 1;
+
+  run(MqttPublisher::connackTimeout * 3 + 100, publisher);
+  check(!publisher.isConnected(), "publisher is not connected without CONNACK");
+  check(broker.connects >= 3 && broker.closes >= 3, "connection without CONNACK is closed and tried again");
+  bool gaps = broker.connects >= 2;
+  for (size_t i = 1; i < broker.connectTimes.size(); i++) {
+    printf("  CONNECT %lu ms after the previous one\n", connectGap(i));
+    gaps = gaps && connectGap(i) >= MqttPublisher::connackTimeout && connectGap(i) <= MqttPublisher::connackTimeout + 5;
+  }
+  check(gaps, "next attempt right after the timeout");
+
+  broker.answerConnect = true;
+  run(MqttPublisher::connackTimeout + 100, publisher);
+  check(publisher.isConnected(), "publisher connects once the broker answers");
+
+  // A refused connection is closed and tried again after the reconnect interval
+  brokerReset(0);
+  broker.connectResult = 5;
+  broker.client->is_closing = 1;
+  run(MqttPublisher::reconnectInterval * 2 + 100, publisher);
+  gaps = broker.connects >= 2;
+  for (size_t i = 1; i < broker.connectTimes.size(); i++) {
+    gaps = gaps && connectGap(i) >= MqttPublisher::reconnectInterval && connectGap(i) <= MqttPublisher::reconnectInterval + 5;
+  }
+  check(!publisher.isConnected() && gaps, "refused connection is tried again after the reconnect interval");
+}
+
+int main() {
+  mg_mgr_init(&g_mgr);
+  mg_log_set(MG_LL_NONE);
+  check(mg_listen(&g_mgr, brokerUrl, brokerEvent, NULL) != NULL, "broker listens");
+  hostAdvance(1000000);
+
+  MqttPublisher publisher(game, metrics, controllers, 1, publisherUrl, "cluster", 50, 500);
+  testConnect(publisher);
+  testBatching(publisher);
+  testLatency(publisher);
+  testBackpressure(publisher);
+  testAckTimeout(publisher);
+  testCommands(publisher);
+  testReconnect(publisher);
+  testConnackTimeout(publisher);
+
+  mg_mgr_free(&g_mgr);
+  return hostCheckResult();
+}
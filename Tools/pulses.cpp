@@ -0,0 +1,252 @@
+// ####################################################################################################################
+//
+// Code part of CarCluster project by Andrej Rolih. See .ino file more details
+//
+// Runs PulseGenerator (CarCluster/src/Other/PulseGenerator.cpp) on a model of the low speed LEDC: the recorded LEDC
+// calls (Tools/host/Arduino.h and Tools/host/driver/ledc.h) are turned into the output waveform, with a new divider
+// or duty taken over when the running period ends and a timer configuration (ledc_timer_config(), ledcAttach(),
+// ledcChangeFrequency()) restarting the timer. Checks that the fractional frequency comes out on average, that
+// frequency changes never restart the timer and keep the phase (every period is a whole period of one of the set
+// dividers), the ramp, the output stopping at 0 and that the pulse count matches the edges over a simulated hour of
+// random speeds and update intervals. Runs on the computer, not on the ESP32:
+//
+//   g++ -std=c++11 -O2 -ITools/host -o pulses Tools/pulses.cpp && ./pulses
+//
+// ####################################################################################################################
+
+#include "Arduino.h"
+#include "driver/ledc.h"
+
+#include "../CarCluster/src/Other/PulseGenerator.cpp"
+
+#include "HostCheck.h"
+
+static const uint8_t pin = 27;
+
+struct Period {
+  double start;                            // us
+  double length;                           // us
+  uint32_t divider;
+  bool pulse;                              // Output goes high at the start
+};
+
+// The LEDC output of a pin from its first timer start until the end time
+static std::vector<Period> waveform(uint8_t pin, uint64_t end) {
+  std::vector<HostLedcWrite> writes;
+  for (const HostLedcWrite &write : hostLedcWrites) {
+    if (write.pin == pin) writes.push_back(write);
+  }
+
+  std::vector<Period> periods;
+  if (writes.empty()) return periods;
+
+  // Kept in whole ns, so an hour of periods adds up without rounding
+  HostLedcWrite state = writes[0];
+  uint64_t start = state.time * 1000;
+  size_t next = 1, restart = 1;
+  while (start < end * 1000) {
+    // New settings are taken over at the end of the period (a write right at the end is too late for it)
+    while (next < writes.size() && !writes[next].restart && writes[next].time * 1000 < start) state = writes[next++];
+    uint64_t length = llround(hostLedcPeriod(state) * 1000);
+
+    // A timer configuration restarts the timer right away and cuts the running period short
+    if (restart < next) restart = next;
+    while (restart < writes.size() && !writes[restart].restart) restart++;
+    if (restart < writes.size() && writes[restart].time * 1000 < start + length) {
+      if (writes[restart].time * 1000 > start) {
+        Period cut = { start / 1000.0, writes[restart].time - start / 1000.0, state.divider, state.duty != 0 };
+        periods.push_back(cut);
+      }
+      start = writes[restart].time * 1000;
+      state = writes[restart];
+      next = restart + 1;
+      continue;
+    }
+
+    Period period = { start / 1000.0, length / 1000.0, state.divider, state.duty != 0 };
+    periods.push_back(period);
+    start += length;
+  }
+  return periods;
+}
+
+static uint32_t countPulses(const std::vector<Period> &periods, double from, double to) {
+  uint32_t pulses = 0;
+  for (const Period &period : periods) {
+    if (period.pulse && period.start >= from && period.start < to) pulses++;
+  }
+  return pulses;
+}
+
+static void run(PulseGenerator &generator, unsigned long ms, unsigned long interval = 1) {
+  for (unsigned long elapsed = 0; elapsed < ms; elapsed += interval) {
+    hostAdvance(interval * 1000);
+    generator.update();
+  }
+}
+
+static void testFractionalFrequency(PulseGenerator &generator) {
+  printf("Fractional frequency\n");
+
+  check(hostLedcWrites.size() == 1 && hostLedcWrites[0].restart && hostLedcWrites[0].resolution == PulseGenerator::resolution &&
+        hostLedcWrites[0].duty == 0, "LEDC channel is set up with the output off");
+
+  // 1249.5 steps of 800 ns
+  generator.setFrequency(1000.4f);
+  check(generator.outputDivider() == 1249 || generator.outputDivider() == 1250, "output is a neighbouring divider");
+  check(hostLedcState[pin].duty == 1 << (PulseGenerator::resolution - 1), "duty is half");
+
+  size_t writes = hostLedcWrites.size();
+  uint64_t start = hostTime;
+  uint32_t startCount = generator.pulseCount();
+  run(generator, 20000);
+
+  std::vector<Period> periods = waveform(pin, hostTime);
+  uint32_t pulses = countPulses(periods, start, hostTime);
+  printf("   1000.4 Hz for 20 s: %u pulses, %u LEDC changes\n", (unsigned)pulses, (unsigned)(hostLedcWrites.size() - writes));
+  check(pulses >= 20007 && pulses <= 20009, "fraction comes out on average");
+  check(generator.pulseCount() - startCount >= 20007 && generator.pulseCount() - startCount <= 20009, "pulses are counted");
+  check(hostLedcWrites.size() - writes <= 200, "dithering does not change the frequency on every update");
+
+  bool neighbours = true;
+  for (size_t i = writes; i < hostLedcWrites.size(); i++) {
+    if (hostLedcWrites[i].divider != 1249 && hostLedcWrites[i].divider != 1250) neighbours = false;
+  }
+  check(neighbours, "only the two neighbouring dividers are used");
+}
+
+static void testPhaseContinuity(PulseGenerator &generator) {
+  printf("Frequency changes keep the phase\n");
+
+  generator.setFrequency(400);
+  run(generator, 1000);
+  size_t writes = hostLedcWrites.size();
+  uint64_t change = hostTime;
+
+  // Changes at random points in the period, faster than the period and back
+  for (int i = 0; i < 200; i++) {
+    hostAdvance(random(100, 5000));
+    generator.setFrequency(i % 2 ? 400 : 1000);
+  }
+  run(generator, 100);
+
+  std::vector<Period> periods = waveform(pin, hostTime);
+  bool whole = true;
+  bool continuous = true;
+  for (size_t i = 1; i < periods.size(); i++) {
+    if (periods[i].start < change) continue;
+    if (periods[i].divider != 3125 && periods[i].divider != 1250) whole = false;
+    if (fabs(periods[i - 1].start + periods[i - 1].length - periods[i].start) > 0.001) continuous = false;
+    if (!periods[i].pulse) continuous = false;
+  }
+  bool restarted = false;
+  for (size_t i = writes; i < hostLedcWrites.size(); i++) {
+    if (hostLedcWrites[i].restart) restarted = true;
+  }
+  check(!restarted, "the timer is never restarted");
+  check(whole, "every period is a whole period of one of the set dividers");
+  check(continuous, "every period starts where the one before ended");
+}
+
+static void testChangeFrequency() {
+  printf("ledcChangeFrequency() restarts the timer\n");
+
+  uint8_t arduinoPin = pin + 3;
+  ledcAttach(arduinoPin, 1000, 10);
+  ledcWrite(arduinoPin, 512);
+  uint64_t start = hostTime;
+  hostAdvance(1250);
+  ledcChangeFrequency(arduinoPin, 400, 10);
+  hostAdvance(10000);
+
+  std::vector<Period> periods = waveform(arduinoPin, hostTime);
+  check(periods.size() >= 3 && periods[0].start == start && periods[0].length == 1000 && periods[1].length == 250 &&
+        periods[2].length == 2500, "the running period is cut short");
+}
+
+static void testRampAndStop() {
+  printf("Ramp and stop\n");
+
+  PulseGenerator generator(1320);          // Like the E46 speedometer, 200 km/h per second
+  uint8_t rampPin = pin + 1;
+  check(generator.begin(rampPin, LEDC_CHANNEL_5, LEDC_TIMER_3), "second generator starts");
+
+  generator.setFrequency(1320);
+  float previous = 0;
+  unsigned long previousTime = micros();
+  bool limited = true;
+  unsigned long reached = 0;
+  for (unsigned long ms = 0; ms < 2000; ms++) {
+    hostAdvance(1000);
+    generator.update();
+    if (generator.outputFrequency() != previous) {
+      // The output may be up to one divider step above the ramp
+      float step = generator.outputFrequency() * generator.outputFrequency() * PulseGenerator::dividerStep / 1e9f;
+      if (generator.outputFrequency() > previous + 1320 * (micros() - previousTime) / 1000000.0 + step + 0.01f) limited = false;
+      previous = generator.outputFrequency();
+      previousTime = micros();
+    }
+    if (reached == 0 && generator.currentFrequency() == 1320) reached = ms;
+  }
+  check(limited, "frequency does not rise faster than the ramp");
+  check(reached >= 990 && reached <= 1010, "target is reached after one second");
+
+  generator.setFrequency(0);
+  run(generator, 2000);
+  check(generator.outputFrequency() == 0 && hostLedcState[rampPin].duty == 0, "output is off at 0");
+  uint32_t count = generator.pulseCount();
+  run(generator, 1000);
+  check(generator.pulseCount() == count, "nothing is counted while off");
+}
+
+static void testLongRun() {
+  printf("One hour of random speeds and update intervals\n");
+
+  PulseGenerator generator(1320);
+  uint8_t longPin = pin + 2;
+  generator.begin(longPin, LEDC_CHANNEL_6, LEDC_TIMER_1);
+
+  uint64_t start = hostTime;
+  double wanted = 0;                       // Pulses the ramped fractional frequency asks for
+  uint64_t nextChange = hostTime;
+  uint32_t worst = 0;
+
+  while (hostTime - start < 3600ULL * 1000000) {
+    if (hostTime >= nextChange) {
+      generator.setFrequency(random(0, 198000) / 100.0f);
+      nextChange = hostTime + random(500, 3000) * 1000ULL;
+    }
+    uint64_t interval = random(1, 21) * 1000ULL;
+    if (generator.currentFrequency() >= PulseGenerator::minimumFrequency) wanted += generator.currentFrequency() * interval / 1000000.0;
+    hostAdvance(interval);
+    generator.update();
+
+    // Compare with the waveform every simulated minute
+    if ((hostTime - start) % 60000000ULL < interval) {
+      uint32_t pulses = countPulses(waveform(longPin, hostTime), start, hostTime);
+      uint32_t difference = pulses > generator.pulseCount() ? pulses - generator.pulseCount() : generator.pulseCount() - pulses;
+      if (difference > worst) worst = difference;
+    }
+  }
+
+  uint32_t pulses = countPulses(waveform(longPin, hostTime), start, hostTime);
+  printf("   %u pulses on the output, %u counted, %.0f asked for, worst difference %u\n", (unsigned)pulses,
+         (unsigned)generator.pulseCount(), wanted, (unsigned)worst);
+  check(worst <= 1, "count stays within a pulse of the output");
+  check(fabs(generator.pulseCount() - wanted) <= wanted / 10000, "output follows the fractional frequency within 0.01 %");
+}
+
+int main() {
+  randomSeed(1);
+
+  PulseGenerator generator;
+  check(generator.begin(pin), "generator starts");
+
+  testFractionalFrequency(generator);
+  testPhaseContinuity(generator);
+  testChangeFrequency();
+  testRampAndStop();
+  testLongRun();
+
+  return hostCheckResult();
+}
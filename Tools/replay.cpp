@@ -0,0 +1,466 @@
+// ####################################################################################################################
+//
+// Code part of CarCluster project by Andrej Rolih. See .ino file more details
+//
+// Replays a telemetry recording (recording.cctr from the web dashboard, or the hex dump of serial action 25) through a
+// cluster build on the computer, with MCP_CAN stubbed (Tools/host/HostCan.h). The recording goes through the same
+// TelemetryRecorder as on the ESP32 and the cluster is updated every simulated ms like in loop(). Every CAN frame the
+// cluster sends is printed as one line (ms since the start of the replay, bus, ID, data), the same recording gives the
+// same lines on every run, so the frames of two firmware versions can be diffed:
+//
+//   g++ -std=c++11 -O2 -Wno-narrowing -Wno-return-type -ITools/host -o replay Tools/replay.cpp
+//   ./replay recording.cctr [bmwf|mqb|w204|w221, default bmwf] [rate, default 1] > frames.txt
+//
+// Without a file it records a generated session and checks the session reader (GameStateSnapshot) against what was
+// recorded, the replay timing at 1x, 4x and stepwise, button presses (also on the BMW F cluster), import/export and that
+// replays are deterministic.
+//
+// ####################################################################################################################
+
+#include <string>
+
+#include "Arduino.h"
+#include "HostCan.h"
+
+#include "../CarCluster/src/Other/GaugeCalibration.cpp"
+#include "../CarCluster/src/Other/BlinkerGenerator.cpp"
+#include "../CarCluster/src/Other/DistanceIntegrator.cpp"
+#include "../CarCluster/src/Other/ButtonEventQueue.cpp"
+#include "../CarCluster/src/Other/FuelPotDriver.cpp"
+#include "../CarCluster/src/Other/SerialOutput.cpp"
+#include "../CarCluster/src/Games/GameStateSnapshot.cpp"
+#include "../CarCluster/src/Other/TelemetryRecorder.cpp"
+#include "../CarCluster/src/Clusters/BMW_F/CRC8.cpp"
+#include "../CarCluster/src/Clusters/BMW_F/BMWFSeriesCluster.cpp"
+#include "../CarCluster/src/Clusters/VW_MQB/VWMQBCluster.cpp"
+#include "../CarCluster/src/Clusters/MERCEDES_W204/MercedesW204Cluster.cpp"
+#include "../CarCluster/src/Clusters/MERCEDES_W221/MercedesW221Cluster.cpp"
+
+#include "HostCheck.h"
+
+static const size_t recorderBufferSize = 32768;  // TELEMETRY_RECORDER_BUFFER_SIZE
+
+// Session reader ####################################################################################################
+
+struct SessionRecord {
+  uint32_t time;                           // ms since the first record
+  uint16_t mask;                           // Fields in the record
+  GameStateSnapshot state;                 // Whole state after the record
+};
+
+// Decodes a CCTR recording without the recorder: header, then per record the delta time (LEB128) and a snapshot
+// with the changed fields. The first record has to have all of them.
+static bool readSession(const std::vector<uint8_t> &data, std::vector<SessionRecord> &records) {
+  records.clear();
+  if (data.size() < TelemetryRecorder::headerSize || memcmp(data.data(), "CCTR", 4) != 0 || data[4] != 2 ||
+      data[5] != GameStateSnapshot::Field_Count) return false;
+
+  SessionRecord record = { 0, 0, GameStateSnapshot() };
+  size_t offset = TelemetryRecorder::headerSize;
+  while (offset < data.size()) {
+    uint32_t deltaTime = 0;
+    for (uint8_t shift = 0;; shift += 7) {
+      if (offset >= data.size() || shift > 28) return false;
+      uint8_t byte = data[offset++];
+      deltaTime |= (uint32_t)(byte & 0x7F) << shift;
+      if ((byte & 0x80) == 0) break;
+    }
+
+    if (data.size() - offset < 2) return false;
+    record.mask = data[offset] | (data[offset + 1] << 8);
+    if (records.empty() && record.mask != GameStateSnapshot::allFields) return false;
+
+    // Fields that are not in the record keep their value, a press is only in the record where it happened
+    record.state.setButtonEvent({ 0, 0 });
+    size_t length = record.state.decode(data.data() + offset, data.size() - offset);
+    if (length == 0) return false;
+    offset += length;
+
+    record.time += records.empty() ? 0 : deltaTime;
+    records.push_back(record);
+  }
+  return !records.empty();
+}
+
+// Binary file, or the hex dump that serial action 25 prints
+static bool loadFile(const char *path, std::vector<uint8_t> &data) {
+  FILE *file = fopen(path, "rb");
+  if (file == nullptr) return false;
+  std::string content;
+  char buffer[4096];
+  size_t length;
+  while ((length = fread(buffer, 1, sizeof(buffer), file)) > 0) content.append(buffer, length);
+  fclose(file);
+
+  data.clear();
+  if (content.compare(0, 4, "CCTR") == 0) {
+    data.assign(content.begin(), content.end());
+    return true;
+  }
+
+  int high = -1;
+  for (char c : content) {
+    if (isspace((unsigned char)c)) continue;
+    if (!isxdigit((unsigned char)c)) return false;
+    int value = isdigit((unsigned char)c) ? c - '0' : toupper(c) - 'A' + 10;
+    if (high < 0) {
+      high = value;
+    } else {
+      data.push_back(high << 4 | value);
+      high = -1;
+    }
+  }
+  return high < 0 && !data.empty();
+}
+
+// Replay through a cluster #########################################################################################
+
+struct ReplayFrame {
+  uint64_t time;                           // us since the start of the replay
+  uint8_t bus;
+  HostCanFrame frame;
+};
+
+struct ReplayResult {
+  bool started;
+  uint32_t duration;                       // ms until the recorder finished the replay
+  std::vector<ReplayFrame> frames;
+  std::vector<GameStateSnapshot> states;   // Game state after the recorder in every ms
+  std::vector<ButtonEvent> presses;        // Presses the replay pushed
+};
+
+static bool isCluster(const char *name) {
+  return strcmp(name, "bmwf") == 0 || strcmp(name, "mqb") == 0 || strcmp(name, "w204") == 0 || strcmp(name, "w221") == 0;
+}
+
+static ClusterConfiguration clusterConfig(const char *name) {
+  if (strcmp(name, "mqb") == 0) return VWMQBCluster::clusterConfig();
+  if (strcmp(name, "w204") == 0) return MercedesW204Cluster::clusterConfig();
+  if (strcmp(name, "w221") == 0) return MercedesW221Cluster::clusterConfig();
+  return BMWFSeriesCluster::clusterConfig(false);
+}
+
+// Runs the recording like loop() does: recorder, then the cluster, one ms at a time. Rate 0 steps one record per ms.
+static ReplayResult runReplay(const std::vector<uint8_t> &recording, Cluster &cluster, GameState &game, uint8_t rate, uint32_t tail) {
+  ReplayResult result = { false, 0, {}, {}, {} };
+  TelemetryRecorder recorder(game, recorderBufferSize);
+  recorder.begin();
+  uint32_t buttonPosition = game.buttonEventCount;
+
+  if (recorder.importRecording(recording.data(), recording.size()) && recorder.startReplay(rate)) {
+    result.started = true;
+    uint32_t finished = 0;
+    for (uint32_t ms = 1; finished == 0 || ms < finished + tail; ms++) {
+      hostAdvance(1000);
+      recorder.update();
+      if (rate == 0) recorder.step();
+      if (!recorder.isReplaying() && finished == 0) finished = ms;
+      result.states.push_back(GameStateSnapshot::fromGame(game));
+
+      ButtonEvent press;
+      while (game.nextButtonEvent(buttonPosition, press)) result.presses.push_back(press);
+
+      cluster.updateWithGame(game);
+      for (uint8_t bus = 0; bus < 2; bus++) {
+        for (const HostCanFrame &frame : hostCanController(bus).sent) result.frames.push_back({ frame.time, bus, frame });
+        hostCanController(bus).sent.clear();
+      }
+    }
+    result.duration = finished;
+  }
+  return result;
+}
+
+// Time and random() start over on every replay and the cluster starts from boot, so the same recording always gives
+// the same frames
+static ReplayResult replay(const std::vector<uint8_t> &recording, const char *clusterName, uint8_t rate, uint32_t tail = 1000) {
+  hostTime = 0;
+  randomSeed(1);
+  for (uint8_t cs = 0; cs < 2; cs++) hostCanController(cs) = HostCanController();
+
+  MCP_CAN can(0);
+  MCP_CAN can2(1);
+  can.begin(MCP_ANY, CAN_500KBPS, MCP_8MHZ);
+  can2.begin(MCP_ANY, CAN_500KBPS, MCP_8MHZ);
+  GameState game(clusterConfig(clusterName));
+
+  if (strcmp(clusterName, "mqb") == 0) {
+    VWMQBCluster cluster(can, 14, 27, 12, 33);
+    return runReplay(recording, cluster, game, rate, tail);
+  } else if (strcmp(clusterName, "w204") == 0) {
+    MercedesW204Cluster cluster(can, can2);
+    return runReplay(recording, cluster, game, rate, tail);
+  } else if (strcmp(clusterName, "w221") == 0) {
+    MercedesW221Cluster cluster(can);
+    return runReplay(recording, cluster, game, rate, tail);
+  }
+  BMWFSeriesCluster cluster(can, false);
+  return runReplay(recording, cluster, game, rate, tail);
+}
+
+static void printFrames(const std::vector<ReplayFrame> &frames) {
+  for (const ReplayFrame &replayFrame : frames) {
+    const HostCanFrame &frame = replayFrame.frame;
+    printf("%10.3f %u %0*X", replayFrame.time / 1000.0, replayFrame.bus, frame.extended ? 8 : 3, (unsigned)frame.id);
+    for (uint8_t i = 0; i < frame.length; i++) printf(" %02X", frame.data[i]);
+    printf("\n");
+  }
+}
+
+// Checks ############################################################################################################
+
+static const GearState gears[] = {
+  GearState_Manual_1, GearState_Manual_2, GearState_Manual_3, GearState_Manual_4, GearState_Manual_5,
+  GearState_Manual_6, GearState_Manual_7, GearState_Manual_8, GearState_Manual_9, GearState_Manual_10,
+  GearState_Auto_P, GearState_Auto_R, GearState_Auto_N, GearState_Auto_D, GearState_Auto_S
+};
+
+// Changes a few random parts of the game state, like a game would
+static void changeGame(GameState &game) {
+  switch (random(10)) {
+    case 0: game.speed = random(0, 300); break;
+    case 1: game.rpm = random(0, 9000); break;
+    case 2: game.gear = gears[random(sizeof(gears) / sizeof(gears[0]))]; break;
+    case 3: game.leftTurningIndicator = random(2); game.rightTurningIndicator = random(2); break;
+    case 4: game.coolantTemperature = random(40, 140); break;
+    case 5: game.fuelQuantity = random(0, 101); break;
+    case 6: game.backlightBrightness = random(0, 100); break;
+    case 7: game.mainLights = random(2); game.highBeam = random(2); break;
+    case 8: game.handbrake = random(2); game.doorOpen = random(2); break;
+    case 9: game.outdoorTemperature = random(-50, 51); break;
+  }
+}
+
+struct GeneratedSession {
+  std::vector<uint8_t> recording;
+  std::vector<GameStateSnapshot> states;   // Game state in every ms of the recording, the first one is the start
+  std::vector<ButtonEvent> presses;
+  uint32_t lastChange;                     // ms of the last change or press, where the recording ends
+};
+
+// Records two minutes of a game that sends a packet every 5 to 40 ms, with a press every few seconds
+static GeneratedSession recordSession() {
+  GeneratedSession session = { {}, {}, {}, 0 };
+  hostTime = 0;
+  GameState game(BMWFSeriesCluster::clusterConfig(false));
+  TelemetryRecorder recorder(game, recorderBufferSize);
+  recorder.begin();
+
+  hostAdvance(1000);
+  check(recorder.startRecording(), "recording starts");
+  session.states.push_back(GameStateSnapshot::fromGame(game));
+
+  unsigned long nextPacket = 0;
+  for (uint32_t ms = 1; ms <= 120000; ms++) {
+    hostAdvance(1000);
+    if (ms >= nextPacket) {
+      for (long changes = random(1, 4); changes > 0; changes--) changeGame(game);
+      nextPacket = ms + random(5, 41);
+    }
+    if (random(3000) == 0) {
+      ButtonEvent press = { (int)random(1, 6), (unsigned long)(random(2) ? random(200, 2000) : 0) };
+      game.pushButtonEvent(press.button, press.holdDuration);
+      session.presses.push_back(press);
+      session.lastChange = ms;
+    }
+    recorder.update();
+    session.states.push_back(GameStateSnapshot::fromGame(game));
+    if (session.states[ms].changedFields(session.states[ms - 1]) != 0) session.lastChange = ms;
+  }
+  recorder.stopRecording();
+
+  session.recording.resize(recorder.exportSize());
+  check(recorder.exportChunk(0, session.recording.data(), session.recording.size()) == session.recording.size(), "whole recording is exported");
+  printf("   %u records, %lu ms, %u bytes, %u presses\n", (unsigned)recorder.recordCount(), recorder.durationMs(),
+         (unsigned)session.recording.size(), (unsigned)session.presses.size());
+  check(recorder.recordCount() > 3000 && recorder.durationMs() == session.lastChange, "whole session fits in the buffer");
+  return session;
+}
+
+static void testReader(const GeneratedSession &session, const std::vector<SessionRecord> &records) {
+  printf("Session reader\n");
+
+  check(records.size() > 0 && records[0].time == 0 && records.back().time == session.lastChange, "records span the session");
+
+  // Every record has the state the game had when it was recorded
+  uint32_t mismatches = 0, missedChanges = 0;
+  std::vector<ButtonEvent> presses;
+  for (size_t i = 0; i < records.size(); i++) {
+    GameStateSnapshot expected = session.states[records[i].time];
+    GameStateSnapshot recorded = records[i].state;
+    if ((records[i].mask & (1 << GameStateSnapshot::Field_ButtonEvent)) && recorded.buttonEvent != 0) {
+      presses.push_back({ recorded.buttonEvent, recorded.buttonHoldDuration });
+    }
+    recorded.setButtonEvent({ 0, 0 });
+    if (recorded.changedFields(expected) != 0) mismatches++;
+  }
+  for (size_t i = 0; i + 1 < records.size(); i++) {
+    // No change of the game may be missing between two records
+    for (uint32_t ms = records[i].time + 1; ms < records[i + 1].time; ms++) {
+      if (session.states[ms].changedFields(session.states[records[i].time]) != 0) missedChanges++;
+    }
+  }
+  check(mismatches == 0, "every record has the game state of its time");
+  check(missedChanges == 0, "every change of the game state is recorded");
+
+  bool samePresses = presses.size() == session.presses.size();
+  for (size_t i = 0; samePresses && i < presses.size(); i++) {
+    samePresses = presses[i].button == session.presses[i].button && presses[i].holdDuration == session.presses[i].holdDuration;
+  }
+  check(samePresses, "every press is recorded with its hold duration");
+
+  // Broken files are rejected
+  std::vector<SessionRecord> rejected;
+  std::vector<uint8_t> truncated(session.recording.begin(), session.recording.end() - 1);
+  std::vector<uint8_t> oldVersion = session.recording;
+  oldVersion[4] = 1;
+  check(!readSession(truncated, rejected) && !readSession(oldVersion, rejected), "truncated and old recordings are rejected");
+  GameState game((ClusterConfiguration()));
+  TelemetryRecorder recorder(game, recorderBufferSize);
+  recorder.begin();
+  check(!recorder.importRecording(truncated.data(), truncated.size()) && !recorder.importRecording(oldVersion.data(), oldVersion.size()),
+        "recorder rejects them too");
+  check(recorder.importRecording(session.recording.data(), session.recording.size()) && recorder.recordCount() == records.size(),
+        "recorder imports the recording");
+  std::vector<uint8_t> exported(recorder.exportSize());
+  recorder.exportChunk(0, exported.data(), exported.size());
+  check(exported == session.recording, "import and export give the same bytes");
+}
+
+// State the replay has to show rate * ms into the recording: the last record at or before that time
+static const GameStateSnapshot& stateAt(const std::vector<SessionRecord> &records, uint64_t time) {
+  size_t record = 0;
+  while (record + 1 < records.size() && records[record + 1].time <= time) record++;
+  return records[record].state;
+}
+
+static void testReplay(const GeneratedSession &session, const std::vector<SessionRecord> &records) {
+  printf("Replay timing\n");
+
+  const uint8_t rates[] = { 1, 4 };
+  for (uint8_t rate : rates) {
+    ReplayResult result = replay(session.recording, "bmwf", rate, 100);
+    uint32_t mismatches = 0;
+    for (size_t ms = 0; ms < result.states.size(); ms++) {
+      GameStateSnapshot expected = stateAt(records, (uint64_t)(ms + 1) * rate);
+      expected.setButtonEvent({ 0, 0 });
+      if (result.states[ms].changedFields(expected) != 0) mismatches++;
+    }
+    printf("   %ux: finished after %u ms, %u frames\n", rate, (unsigned)result.duration, (unsigned)result.frames.size());
+    check(result.started && result.duration == (records.back().time + rate - 1) / rate, "replay takes the recorded time divided by the rate");
+    check(mismatches == 0, "game has the recorded state at every ms of the replay");
+
+    bool samePresses = result.presses.size() == session.presses.size();
+    for (size_t i = 0; samePresses && i < result.presses.size(); i++) {
+      samePresses = result.presses[i].button == session.presses[i].button && result.presses[i].holdDuration == session.presses[i].holdDuration;
+    }
+    check(samePresses, "every press is replayed once with its hold duration");
+  }
+
+  // Stepwise: one record per step
+  ReplayResult stepped = replay(session.recording, "bmwf", 0, 0);
+  uint32_t mismatches = 0;
+  for (size_t step = 0; step + 1 < records.size() && step < stepped.states.size(); step++) {
+    GameStateSnapshot expected = records[step + 1].state;
+    expected.setButtonEvent({ 0, 0 });
+    if (stepped.states[step].changedFields(expected) != 0) mismatches++;
+  }
+  check(stepped.duration == records.size(), "stepping goes through every record");
+  check(mismatches == 0, "every step applies the next record");
+}
+
+// BMW F menu button (button 1) goes through the cluster's button queue: one 0x1EE press per replayed press, held for
+// its hold duration (at least the press duration of the queue)
+static void testClusterButtons(const GeneratedSession &session) {
+  printf("Button presses on the cluster\n");
+
+  ReplayResult result = replay(session.recording, "bmwf", 1);
+  std::vector<unsigned long> holds;
+  for (const ButtonEvent &press : session.presses) {
+    if (press.button == 1) holds.push_back(std::max(press.holdDuration, 200UL));
+  }
+
+  std::vector<uint64_t> pressLengths;
+  uint64_t pressStart = 0;
+  size_t pressCount = 0;
+  bool pressed = false;
+  for (const ReplayFrame &replayFrame : result.frames) {
+    if (replayFrame.frame.id != 0x1EE) continue;
+    bool menu = replayFrame.frame.data[0] == 76;
+    if (menu && !pressed) {
+      pressStart = replayFrame.time;
+      pressCount++;
+    }
+    if (!menu && pressed) pressLengths.push_back((replayFrame.time - pressStart) / 1000);
+    pressed = menu;
+  }
+
+  bool lengths = pressLengths.size() == holds.size();
+  for (size_t i = 0; lengths && i < holds.size(); i++) {
+    lengths = pressLengths[i] >= holds[i] && pressLengths[i] <= holds[i] + 2;
+  }
+  printf("   %u menu presses, %u sent\n", (unsigned)holds.size(), (unsigned)pressCount);
+  check(holds.size() > 0 && pressCount == holds.size(), "every menu press is sent once");
+  check(lengths, "every menu press is held for its hold duration");
+}
+
+static void testDeterminism(const GeneratedSession &session) {
+  printf("Same frames on every replay\n");
+
+  const char *clusters[] = { "bmwf", "mqb", "w204", "w221" };
+  for (const char *cluster : clusters) {
+    ReplayResult first = replay(session.recording, cluster, 1);
+    ReplayResult second = replay(session.recording, cluster, 1);
+
+    bool same = first.frames.size() == second.frames.size();
+    for (size_t i = 0; same && i < first.frames.size(); i++) {
+      const HostCanFrame &a = first.frames[i].frame, &b = second.frames[i].frame;
+      same = first.frames[i].time == second.frames[i].time && first.frames[i].bus == second.frames[i].bus && a.id == b.id &&
+             a.length == b.length && memcmp(a.data, b.data, a.length) == 0;
+    }
+    printf("   %s: %u frames\n", cluster, (unsigned)first.frames.size());
+    check(first.frames.size() > 1000, "cluster sends frames during the replay");
+    check(same, "two replays give the same frames");
+  }
+}
+
+int main(int argc, char **argv) {
+  serialOutput.setMuted(true);
+
+  if (argc > 1) {
+    const char *cluster = argc > 2 ? argv[2] : "bmwf";
+    int rate = argc > 3 ? atoi(argv[3]) : 1;
+    std::vector<uint8_t> recording;
+    std::vector<SessionRecord> records;
+    if (!isCluster(cluster) || rate < 1 || rate > 255) {
+      fprintf(stderr, "Usage: %s recording.cctr [bmwf|mqb|w204|w221] [rate]\n", argv[0]);
+      return 2;
+    }
+    if (!loadFile(argv[1], recording) || !readSession(recording, records)) {
+      fprintf(stderr, "%s is not a CCTR recording\n", argv[1]);
+      return 1;
+    }
+
+    ReplayResult result = replay(recording, cluster, rate);
+    if (!result.started) {
+      fprintf(stderr, "Recording does not fit in the %u byte replay buffer\n", (unsigned)recorderBufferSize);
+      return 1;
+    }
+    fprintf(stderr, "%u records, %u ms, %u frames\n", (unsigned)records.size(), (unsigned)records.back().time, (unsigned)result.frames.size());
+    printFrames(result.frames);
+    return 0;
+  }
+
+  randomSeed(1);
+  printf("Recording a generated session\n");
+  GeneratedSession session = recordSession();
+  std::vector<SessionRecord> records;
+  check(readSession(session.recording, records), "recording is read");
+
+  testReader(session, records);
+  testReplay(session, records);
+  testClusterButtons(session);
+  testDeterminism(session);
+
+  return hostCheckResult();
+}
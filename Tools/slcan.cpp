@@ -0,0 +1,251 @@
+// ####################################################################################################################
+//
+// Code part of CarCluster project by Andrej Rolih. See .ino file more details
+//
+// Measures the sustained SLCAN frame rate (CarCluster/src/Other/SlcanInterface.cpp) over the 921600 baud serial link,
+// in both directions, with and without timestamps (Z1). The serial port is paced at the line rate (Tools/host/Arduino.h,
+// 128 byte transmit FIFO, SERIAL_RX_BUFFER_SIZE receive buffer), the MCP2515 is the fake from Tools/host/HostCan.h with
+// its two receive buffers and a 500 kbit/s bus, and the loop is modelled like loop() in the sketch: SLCAN update, serial
+// read (at most maximumCommandsPerUpdate commands), then at most two received frames per pass, and the rest of the
+// loop (cluster update, web, ...) as a fixed time per pass.
+//
+// - host to CAN: the host sends t frames with 8 data bytes back to back, every frame is sent on the bus (the send waits
+//   for the transmission like mcp_can does), the reply goes back to the host
+// - CAN to host: the bus is fully loaded with 8 byte frames, they are read from the MCP2515 and streamed to the host
+//
+// Frames on the bus take their worst case bit count (CanBusLoad::frameBits), SPI times are estimates for an MCP2515 on
+// 10 MHz SPI. Other traffic on the bus is not modelled. Runs on the computer, not on the ESP32:
+//
+//   g++ -std=c++11 -O2 -Wno-narrowing -ITools/host -o slcan Tools/slcan.cpp && ./slcan
+//
+// ####################################################################################################################
+
+#include "Arduino.h"
+#include "HostCan.h"
+
+#include "../CarCluster/src/Other/SerialOutput.cpp"
+#include "../CarCluster/src/Other/CanBusController.cpp"
+#include "../CarCluster/src/Other/CanBusLoad.h"
+#include "../CarCluster/src/Other/SlcanInterface.cpp"
+
+#include "HostCheck.h"
+
+static const unsigned long baudRate = 921600;    // SERIAL_BAUD_RATE
+static const size_t receiveBufferSize = 2048;    // SERIAL_RX_BUFFER_SIZE
+static const uint16_t bitrate = 500;             // kbit/s
+static const uint32_t spiSendTime = 30;          // us to load a transmit buffer and request the transmission
+static const uint32_t spiReadTime = 25;          // us to read a receive buffer
+static const uint8_t framesPerPass = 2;          // readCanBuffer() reads both receive buffers
+static const uint8_t receiveBuffers = 2;
+static const uint64_t measuredTime = 5000000;    // us, after one second to settle
+
+static const INT8U canCs = 5;
+static MCP_CAN CAN(canCs);
+static HostCanController &fake = hostCanController(canCs);
+static CanBusController canController(CAN, 1);
+static CanBusController *controllers[] = { &canController };
+static SlcanInterface slcan(controllers, 1);
+
+static const CanBusLoad::Frame busFrame = { 0x123, 8, 0, false };
+static const uint32_t frameTime = CanBusLoad::frameBits(busFrame) * 1000 / bitrate;  // us on the bus
+
+struct Result {
+  double framesPerSecond;
+  double lineLimit;                              // Frames/s the serial link can carry
+  double busLimit;                               // Frames/s the bus can carry
+  double loopLimit;                              // Frames/s the loop can take (commands per pass or two reads per pass)
+  uint32_t lost;                                 // Host to CAN: commands lost in the receive buffer or failed
+                                                 // CAN to host: frames lost in the MCP2515 or the SLCAN queue
+  uint32_t invalid;                              // Commands cut by lost bytes
+  bool valid;                                    // Everything sent to the host is a valid SLCAN line or reply
+};
+
+static double limit(const Result &result) {
+  return std::min(std::min(result.lineLimit, result.busLimit), result.loopLimit);
+}
+
+static void frameHook(void *context, INT8U direction, INT32U id, INT8U ext, INT8U rtr, INT8U len, const INT8U *buf, INT8U result) {
+  if (direction == MCP_FRAME_TX) hostAdvance(spiSendTime + frameTime);  // sendMsg() waits for the transmission
+  if (result == CAN_OK) slcan.frameSeen((uintptr_t)context, direction == MCP_FRAME_TX, id, ext, rtr, len, buf);
+}
+
+// One pass of loop(), with the time of everything that is not modelled
+static void loopPass(uint32_t passTime) {
+  canController.update();
+  slcan.update();
+
+  // readSerialJson()
+  while (Serial.available() > 0 && slcan.acceptsCommands()) {
+    slcan.readByte(Serial.read());
+  }
+
+  // readCanBuffer()
+  INT32U id;
+  INT8U length, data[8];
+  for (uint8_t i = 0; i < framesPerPass && !fake.receiveQueue.empty(); i++) {
+    hostAdvance(spiReadTime);
+    CAN.readMsgBuf(&id, &length, data);
+  }
+
+  hostAdvance(passTime);
+}
+
+static void command(const char *text) {
+  Serial.hostReceive(text);
+  for (int i = 0; i < 100; i++) loopPass(100);
+}
+
+static void openChannel(bool timestamps) {
+  Serial.hostPace(true);
+  Serial.sent.clear();
+  fake.receiveQueue.clear();
+  command("C\r");
+  command(timestamps ? "Z1\r" : "Z0\r");
+  command("O\r");
+  Serial.sent.clear();
+}
+
+// Checks that the host got only replies (z for a sent frame, BEL for an invalid command) and one z per sent frame
+static bool validReplies(const std::vector<uint8_t> &sent, uint32_t sentFrames) {
+  uint32_t frames = 0;
+  for (size_t i = 0; i < sent.size(); i++) {
+    if (sent[i] == 'z' && i + 1 < sent.size() && sent[i + 1] == '\r') {
+      frames++;
+      i++;
+    } else if (sent[i] != '\a') {
+      return false;
+    }
+  }
+  return frames == sentFrames;
+}
+
+// Checks that the host got only t frames (with a timestamp with Z1), the last one can still be on its way
+static bool validStream(const std::vector<uint8_t> &sent, bool timestamps) {
+  std::string line;
+  for (uint8_t c : sent) {
+    if (c != '\r') {
+      line += (char)c;
+      continue;
+    }
+    if (line.size() != 1 + 3 + 1 + 16 + (timestamps ? 4 : 0) || line.compare(0, 5, "t1238") != 0) return false;
+    line.clear();
+  }
+  return true;
+}
+
+static Result hostToCan(bool timestamps, uint32_t passTime) {
+  openChannel(timestamps);
+  static const char frame[] = "t12380102030405060708\r";
+  uint32_t sent = slcan.sentFrames(), failed = slcan.failedFrames(), invalid = slcan.invalidCommands();
+  uint64_t lostBytes = Serial.receiveLost;
+  uint64_t offered = 0;
+
+  uint64_t start = hostTime + 1000000, end = start + measuredTime;
+  uint32_t sentAtStart = 0;
+  bool started = false;
+  while (hostTime < end) {
+    // The host keeps its transmitter busy (ahead of the longest loop pass)
+    while (Serial.hostReceiveEndTime() < hostTime + 50000) {
+      Serial.hostReceive(frame);
+      offered++;
+    }
+    if (!started && hostTime >= start) {
+      sentAtStart = slcan.sentFrames();
+      started = true;
+    }
+    loopPass(passTime);
+  }
+  uint64_t measured = hostTime - start;
+
+  Result result;
+  result.framesPerSecond = (slcan.sentFrames() - sentAtStart) * 1e6 / measured;
+  result.lineLimit = baudRate / 10.0 / (sizeof(frame) - 1);
+  result.busLimit = 1e6 / (frameTime + spiSendTime);
+  result.loopLimit = SlcanInterface::maximumCommandsPerUpdate * 1e6 /
+                     (SlcanInterface::maximumCommandsPerUpdate * (frameTime + spiSendTime) + passTime);
+  result.lost = (Serial.receiveLost - lostBytes) / (sizeof(frame) - 1) + (slcan.failedFrames() - failed);
+  result.invalid = slcan.invalidCommands() - invalid;
+  result.valid = validReplies(Serial.sent, slcan.sentFrames() - sent);
+  command("C\r");
+  return result;
+}
+
+static Result canToHost(bool timestamps, uint32_t passTime) {
+  openChannel(timestamps);
+  static const INT8U data[8] = { 1, 2, 3, 4, 5, 6, 7, 8 };
+  uint32_t streamed = slcan.streamedFrames(), dropped = slcan.droppedFrames();
+  uint32_t overflows = 0;
+
+  uint64_t start = hostTime + 1000000, end = start + measuredTime;
+  uint64_t nextFrame = hostTime;
+  uint32_t streamedAtStart = 0;
+  bool started = false;
+  while (hostTime < end) {
+    // Frames that finished on the bus since the last pass, the MCP2515 only keeps two
+    for (; nextFrame <= hostTime; nextFrame += frameTime) {
+      if (fake.receiveQueue.size() < receiveBuffers) fake.receive(busFrame.id, 8, data);
+      else if (nextFrame >= start) overflows++;
+    }
+    if (!started && hostTime >= start) {
+      streamedAtStart = slcan.streamedFrames();
+      dropped = slcan.droppedFrames();
+      started = true;
+    }
+    loopPass(passTime);
+  }
+  uint64_t measured = hostTime - start;
+
+  Result result;
+  result.framesPerSecond = (slcan.streamedFrames() - streamedAtStart) * 1e6 / measured;
+  result.lineLimit = baudRate / 10.0 / (1 + 3 + 1 + 16 + (timestamps ? 4 : 0) + 1);
+  result.busLimit = 1e6 / frameTime;
+  result.loopLimit = framesPerPass * 1e6 / (passTime + framesPerPass * spiReadTime);
+  result.lost = overflows + slcan.droppedFrames() - dropped;
+  result.invalid = 0;
+  result.valid = validStream(Serial.sent, timestamps) && slcan.streamedFrames() - streamed > 0;
+  command("C\r");
+  return result;
+}
+
+static void print(const char *direction, bool timestamps, uint32_t passTime, const Result &result) {
+  printf("%-12s %s %5u us %6.0f frames/s   line %4.0f  bus %4.0f  loop %4.0f   %5.1f%% %7u lost\n", direction,
+         timestamps ? "Z1" : "Z0", passTime, result.framesPerSecond, result.lineLimit, result.busLimit, result.loopLimit,
+         100.0 * result.framesPerSecond / limit(result), result.lost);
+}
+
+int main() {
+  Serial.toStdout = false;
+  Serial.begin(baudRate);
+  Serial.setRxBufferSize(receiveBufferSize);
+  canController.begin(CAN_500KBPS, frameHook);
+  check(canController.isRunning(), "controller is running");
+
+  static const uint32_t passTimes[] = { 100, 250, 500, 1000 };
+  printf("%u us per frame on the bus, frames/s sustained and the limits of the serial line, the bus and the loop\n", frameTime);
+  printf("direction       loop pass  sustained          line       bus       loop   of limit\n");
+
+  // The host sends at the line rate without flow control, what the loop does not take in time overflows the receive
+  // buffer and the cut commands are answered with BEL
+  for (bool timestamps : { false, true }) {
+    for (uint32_t passTime : passTimes) {
+      Result result = hostToCan(timestamps, passTime);
+      print("host -> CAN", timestamps, passTime, result);
+      check(result.valid, "host gets a z for every sent frame and nothing else");
+      // Cut commands take command slots of the pass too, so the loop limit is not quite reached
+      check(result.framesPerSecond >= limit(result) * 0.9 && result.framesPerSecond <= limit(result) * 1.01,
+            "host to CAN reaches its limit");
+    }
+  }
+
+  for (bool timestamps : { false, true }) {
+    for (uint32_t passTime : passTimes) {
+      Result result = canToHost(timestamps, passTime);
+      print("CAN -> host", timestamps, passTime, result);
+      check(result.valid, "every streamed frame is a valid SLCAN line");
+      check(result.framesPerSecond >= limit(result) * 0.95 && result.framesPerSecond <= limit(result) * 1.01,
+            "CAN to host reaches its limit");
+      check(limit(result) < result.busLimit || result.lost == 0, "no frames are lost when the bus is the limit");
+    }
+  }
+  return hostCheckResult();
+}
@@ -0,0 +1,197 @@
+// ####################################################################################################################
+//
+// Code part of CarCluster project by Andrej Rolih. See .ino file more details
+//
+// Closed loop check of the clusters that have a frame decoder (BMW F, VW MQB, Mercedes W204 and W221): the cluster
+// is updated every ms with a game state that changes at random, every frame it sends goes through the frame
+// validator (CarCluster/src/Other/FrameValidator.h) and the validator has to find every checksum valid, every counter
+// in sequence, every frame on time and every decoded signal equal to the game state. A second run flips one random
+// bit in one of every 50 frames and every flipped frame that carries a checksum has to be reported. Runs on the computer,
+// not on the ESP32:
+//
+//   g++ -std=c++11 -O2 -Wno-narrowing -Wno-return-type -ITools/host -o validate Tools/validate.cpp && ./validate [seconds per cluster, default 3600] [seed]
+//
+// The default is one simulated hour (3.6 million updates) per cluster.
+//
+// ####################################################################################################################
+
+#include "Arduino.h"
+#include "HostCan.h"
+
+#include "../CarCluster/src/Other/GaugeCalibration.cpp"
+#include "../CarCluster/src/Other/BlinkerGenerator.cpp"
+#include "../CarCluster/src/Other/DistanceIntegrator.cpp"
+#include "../CarCluster/src/Other/ButtonEventQueue.cpp"
+#include "../CarCluster/src/Other/FuelPotDriver.cpp"
+#include "../CarCluster/src/Clusters/BMW_F/CRC8.cpp"
+#include "../CarCluster/src/Clusters/BMW_F/BMWFSeriesCluster.cpp"
+#include "../CarCluster/src/Clusters/VW_MQB/VWMQBCluster.cpp"
+#include "../CarCluster/src/Clusters/MERCEDES_W204/MercedesW204Cluster.cpp"
+#include "../CarCluster/src/Clusters/MERCEDES_W221/MercedesW221Cluster.cpp"
+#include "../CarCluster/src/Clusters/ClusterBusSchedules.h"
+#include "../CarCluster/src/Other/FrameValidator.cpp"
+#include "../CarCluster/src/Clusters/ClusterFrameDecoders.cpp"
+
+#include "HostCheck.h"
+
+static const GearState gears[] = {
+  GearState_Manual_1, GearState_Manual_2, GearState_Manual_3, GearState_Manual_4, GearState_Manual_5,
+  GearState_Manual_6, GearState_Manual_7, GearState_Manual_8, GearState_Manual_9, GearState_Manual_10,
+  GearState_Auto_P, GearState_Auto_R, GearState_Auto_N, GearState_Auto_D, GearState_Auto_S
+};
+
+static FrameValidator *validator = nullptr;
+static ClusterFrameDecoder *decoder = nullptr;
+static uint32_t flipRate = 0;              // One frame in flipRate gets a bit flipped, 0 = none
+static uint32_t flippedFrames = 0;         // Flipped frames that carry a checksum
+static uint32_t transitions = 0;
+
+static void frameHook(void *context, INT8U direction, INT32U id, INT8U ext, INT8U rtr, INT8U len, const INT8U *buf, INT8U result) {
+  if (direction != MCP_FRAME_TX || result != CAN_OK) return;
+
+  uint8_t frame[8];
+  memcpy(frame, buf, len);
+  if (flipRate != 0 && len > 0 && random(flipRate) == 0) {
+    frame[random(len)] ^= 1 << random(8);
+    DecodedFrame decoded;
+    decoder->decode(id, len, buf, decoded);
+    if (decoded.checksumPresent) flippedFrames++;
+  }
+  validator->frameSent((uintptr_t)context, id, len, frame, millis());
+}
+
+// Changes a few random parts of the game state, like a game would
+static void changeGame(GameState &game) {
+  switch (random(12)) {
+    case 0: game.speed = random(0, 300); break;
+    case 1: game.rpm = random(0, 9000); break;
+    case 2: game.gear = gears[random(sizeof(gears) / sizeof(gears[0]))]; break;
+    case 3: game.leftTurningIndicator = random(2); break;
+    case 4: game.rightTurningIndicator = random(2); break;
+    case 5: game.coolantTemperature = random(40, 140); break;
+    case 6: game.fuelQuantity = random(0, 101); break;
+    case 7: game.backlightBrightness = random(0, 100); break;
+    case 8: game.mainLights = random(2); game.highBeam = random(2); break;
+    case 9: game.handbrake = random(2); game.doorOpen = random(2); break;
+    case 10: game.driveMode = random(1, 8); break;
+    case 11: game.outdoorTemperature = random(-50, 51); break;
+  }
+  transitions++;
+}
+
+// Runs the cluster for the given time and checks what the validator found. Returns the number of problems.
+static uint32_t run(const char *name, Cluster &cluster, GameState &game, MCP_CAN &can, MCP_CAN *can2,
+                    const CanBusLoad::Bus *buses, uint8_t busCount, ClusterFrameDecoder &clusterDecoder, uint32_t seconds, uint32_t flips) {
+  can.begin(MCP_ANY, CAN_500KBPS, MCP_8MHZ);
+  can.setFrameHook(frameHook, (void *)1);
+  if (can2 != nullptr) {
+    can2->begin(MCP_ANY, CAN_500KBPS, MCP_8MHZ);
+    can2->setFrameHook(frameHook, (void *)2);
+  }
+
+  FrameValidator frameValidator(game, buses, busCount, &clusterDecoder);
+  validator = &frameValidator;
+  decoder = &clusterDecoder;
+  flipRate = flips;
+  flippedFrames = 0;
+  transitions = 0;
+
+  // A game packet every 5 to 20 ms with a few changes in it
+  unsigned long nextChange = 0;
+  for (uint32_t ms = 0; ms < seconds * 1000; ms++) {
+    if (ms >= nextChange) {
+      for (long changes = random(1, 4); changes > 0; changes--) changeGame(game);
+      nextChange = ms + random(5, 21);
+    }
+    hostAdvance(1000);
+    cluster.updateWithGame(game);
+    hostCanController(0).sent.clear();
+    hostCanController(1).sent.clear();
+  }
+
+  uint32_t frames = 0, checksumErrors = 0, counterErrors = 0, late = 0, early = 0, missing = 0;
+  for (uint8_t i = 0; i < frameValidator.frameCount(); i++) {
+    const FrameValidator::FrameStats &stats = frameValidator.frameStats(i);
+    bool isMissing = frameValidator.isMissing(i, millis());
+    frames += stats.frames;
+    checksumErrors += stats.checksumErrors;
+    counterErrors += stats.counterErrors;
+    late += stats.lateFrames;
+    early += stats.earlyFrames;
+    if (isMissing) missing++;
+
+    if (flips == 0 && (stats.checksumErrors || stats.counterErrors || stats.lateFrames || stats.earlyFrames || isMissing)) {
+      printf("   0x%03X bus %u (%u ms): %u frames, %u checksum errors, %u counter errors, %u late, %u early, max interval %u ms%s\n",
+             (unsigned)stats.id, stats.bus, stats.period, (unsigned)stats.frames, (unsigned)stats.checksumErrors,
+             (unsigned)stats.counterErrors, (unsigned)stats.lateFrames, (unsigned)stats.earlyFrames,
+             (unsigned)stats.maximumInterval, isMissing ? ", MISSING" : "");
+    }
+  }
+
+  uint32_t matches = 0, mismatches = 0;
+  for (uint8_t signal = 0; signal < LatencySignal_Count; signal++) {
+    const FrameValidator::SignalStats &stats = frameValidator.signalStats(signal);
+    matches += stats.matches;
+    mismatches += stats.mismatches;
+    if (flips == 0 && stats.mismatches != 0) {
+      printf("   %s: %u mismatched, last in 0x%03X decoded %d expected %d\n", latencySignalName(signal),
+             (unsigned)stats.mismatches, (unsigned)stats.lastMismatchId, (int)stats.lastMismatchDecoded, (int)stats.lastMismatchExpected);
+    }
+  }
+
+  printf("%s%s: %u transitions, %u frames, %u decoded signals", name, flips ? " with bit flips" : "",
+         (unsigned)transitions, (unsigned)frames, (unsigned)(matches + mismatches));
+  if (flips) {
+    printf(", %u flipped frames with a checksum, %u checksum errors\n", (unsigned)flippedFrames, (unsigned)checksumErrors);
+    check(frames > 0, "cluster sent frames");
+    check(checksumErrors == flippedFrames, "every flipped bit is found by the checksum");
+    return checksumErrors == flippedFrames ? 0 : 1;
+  }
+
+  printf(", %u mismatches, %u checksum errors, %u counter errors, %u late, %u early, %u missing\n", (unsigned)mismatches,
+         (unsigned)checksumErrors, (unsigned)counterErrors, (unsigned)late, (unsigned)early, (unsigned)missing);
+  check(frames > 0 && matches > 0, "cluster sent frames with signals");
+  check(mismatches == 0, "decoded signals match the game state");
+  check(checksumErrors == 0, "checksums are valid");
+  check(counterErrors == 0, "counters are in sequence");
+  check(late == 0 && early == 0 && missing == 0, "frames are sent on schedule");
+  return mismatches + checksumErrors + counterErrors + late + early + missing;
+}
+
+int main(int argc, char **argv) {
+  uint32_t seconds = argc > 1 ? atoi(argv[1]) : 3600;
+  randomSeed(argc > 2 ? atoi(argv[2]) : 1);
+
+  MCP_CAN CAN(0);
+  MCP_CAN CAN2(1);
+
+  for (uint32_t flips = 0; flips <= 50; flips += 50) {
+    // Bit flips only need enough frames to hit every byte of every ID a few times
+    uint32_t duration = flips ? (seconds < 600 ? seconds : 600) : seconds;
+
+    BMWFSeriesCluster bmwF(CAN, false);
+    GameState bmwFGame(BMWFSeriesCluster::clusterConfig(false));
+    BMWFSeriesFrameDecoder bmwFDecoder;
+    run("BMW F", bmwF, bmwFGame, CAN, nullptr, bmwFSeriesBuses, 1, bmwFDecoder, duration, flips);
+
+    VWMQBCluster mqb(CAN, 14, 27, 12, 33);
+    GameState mqbGame(VWMQBCluster::clusterConfig());
+    VWMQBFrameDecoder mqbDecoder;
+    run("VW MQB", mqb, mqbGame, CAN, nullptr, vwMQBBuses, 1, mqbDecoder, duration, flips);
+
+    // The Mercedes clusters have no checksums to flip bits against
+    if (flips != 0) continue;
+
+    MercedesW204Cluster w204(CAN, CAN2);
+    GameState w204Game(MercedesW204Cluster::clusterConfig());
+    MercedesW204FrameDecoder w204Decoder;
+    run("Mercedes W204", w204, w204Game, CAN, &CAN2, mercedesW204Buses, 2, w204Decoder, duration, flips);
+
+    MercedesW221Cluster w221(CAN);
+    GameState w221Game(MercedesW221Cluster::clusterConfig());
+    MercedesW221FrameDecoder w221Decoder;
+    run("Mercedes W221", w221, w221Game, CAN, nullptr, mercedesW221Buses, 1, w221Decoder, duration, flips);
+  }
+
+  return hostCheckResult();
+}
@@ -0,0 +1,243 @@
+// ####################################################################################################################
+//
+// Code part of CarCluster project by Andrej Rolih. See .ino file more details
+//
+// Local HTTP load test for the web dashboard. Runs the sketch's Mongoose server (mongoose_impl.c with the wizard's
+// mongoose_glue.c, Mongoose builds for Unix as it is) in a thread on 127.0.0.1 and puts keep-alive clients on it:
+//
+// - GET / cold (no If-None-Match) and revalidating with the ETag of the first answer
+// - GET /api/state cold and revalidating
+//
+// For every load it prints the answers per second, bytes received per request and the p50/p99 latency, and checks the
+// headers: the page is sent gzipped with ETag and Cache-Control, and a 304 carries the same ETag and Cache-Control
+// without a body. The latencies depend on the computer, only the headers and the answers are checked.
+//
+//   M=CarCluster/src/Other/mongoose
+//   gcc -O2 -DMG_DATA_SIZE=64 '-DHTTP_URL="http://127.0.0.1:18190"' '-DHTTPS_URL="https://127.0.0.1:18543"' -c $M/*.c
+//   g++ -std=c++11 -O2 -DMG_DATA_SIZE=64 -ITools/host -o webload Tools/webload.cpp mongoose*.o -lpthread
+//   ./webload [seconds per load]
+//
+// MG_DATA_SIZE is bigger than on the ESP32 because the connection data holds pointers, which have 8 bytes here.
+//
+// ####################################################################################################################
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <strings.h>
+#include <unistd.h>
+#include <sys/socket.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <arpa/inet.h>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <map>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "../CarCluster/src/Other/mongoose/mongoose_glue.h"
+
+#include "HostCheck.h"
+
+static const uint16_t port = 18190;        // HTTP_URL in the build line
+static const int clients = 4;
+
+struct Answer {
+  int status = 0;
+  std::string headers;                     // Status line and headers, without the empty line
+  size_t bodyLength = 0;
+  size_t bytes = 0;                        // Everything received
+};
+
+struct LoadResult {
+  unsigned requests = 0;
+  unsigned failures = 0;                   // Connection closed or answer could not be read
+  uint64_t bytes = 0;
+  std::vector<double> latencies;           // us
+  std::map<int, unsigned> statuses;
+  Answer first;                            // Answer to the request before the load
+  Answer last;                             // Last answer of the load
+};
+
+static std::string header(const Answer &answer, const char *name) {
+  size_t nameLength = strlen(name);
+  size_t position = answer.headers.find("\r\n");
+  while (position != std::string::npos) {
+    size_t start = position + 2;
+    size_t end = answer.headers.find("\r\n", start);
+    std::string line = answer.headers.substr(start, end == std::string::npos ? std::string::npos : end - start);
+    if (line.size() > nameLength && line[nameLength] == ':' && strncasecmp(line.c_str(), name, nameLength) == 0) {
+      size_t value = line.find_first_not_of(' ', nameLength + 1);
+      return value == std::string::npos ? "" : line.substr(value);
+    }
+    position = end;
+  }
+  return "";
+}
+
+static int connectServer() {
+  int fd = socket(AF_INET, SOCK_STREAM, 0);
+  if (fd < 0) return -1;
+  int on = 1;
+  setsockopt(fd, IPPROTO_TCP, TCP_NODELAY, &on, sizeof(on));
+  sockaddr_in address = {};
+  address.sin_family = AF_INET;
+  address.sin_port = htons(port);
+  address.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+  if (connect(fd, (sockaddr *)&address, sizeof(address)) != 0) {
+    close(fd);
+    return -1;
+  }
+  return fd;
+}
+
+// One request on a keep-alive connection, reads the whole answer (304 has no body, everything else a Content-Length)
+static bool request(int fd, const std::string &path, const std::string &etag, Answer &answer) {
+  std::string text = "GET " + path + " HTTP/1.1\r\nHost: 127.0.0.1\r\nAccept-Encoding: gzip\r\n";
+  if (!etag.empty()) text += "If-None-Match: " + etag + "\r\n";
+  text += "\r\n";
+  if (send(fd, text.data(), text.size(), 0) != (ssize_t)text.size()) return false;
+
+  std::string received;
+  char buffer[16384];
+  size_t headerEnd = std::string::npos;
+  while (headerEnd == std::string::npos) {
+    ssize_t length = recv(fd, buffer, sizeof(buffer), 0);
+    if (length <= 0) return false;
+    received.append(buffer, length);
+    headerEnd = received.find("\r\n\r\n");
+  }
+
+  answer = Answer();
+  answer.headers = received.substr(0, headerEnd);
+  answer.status = atoi(answer.headers.c_str() + answer.headers.find(' ') + 1);
+  std::string contentLength = header(answer, "Content-Length");
+  answer.bodyLength = answer.status == 304 || contentLength.empty() ? 0 : strtoul(contentLength.c_str(), NULL, 10);
+  while (received.size() < headerEnd + 4 + answer.bodyLength) {
+    ssize_t length = recv(fd, buffer, sizeof(buffer), 0);
+    if (length <= 0) return false;
+    received.append(buffer, length);
+  }
+  answer.bytes = received.size();
+  return received.size() == headerEnd + 4 + answer.bodyLength;
+}
+
+// Clients sending requests back to back for the given time, with the ETag of a first answer when revalidating
+static LoadResult load(const std::string &path, bool revalidate, double seconds) {
+  LoadResult result;
+  int fd = connectServer();
+  bool answered = fd >= 0 && request(fd, path, "", result.first);
+  if (fd >= 0) close(fd);
+  if (!answered) {
+    result.failures++;
+    return result;
+  }
+  std::string etag = revalidate ? header(result.first, "Etag") : "";
+
+  std::vector<LoadResult> results(clients);
+  std::vector<std::thread> threads;
+  auto end = std::chrono::steady_clock::now() + std::chrono::duration<double>(seconds);
+  for (int i = 0; i < clients; i++) {
+    threads.push_back(std::thread([&, i]() {
+      LoadResult &own = results[i];
+      int client = connectServer();
+      while (client >= 0 && std::chrono::steady_clock::now() < end) {
+        Answer answer;
+        auto start = std::chrono::steady_clock::now();
+        if (!request(client, path, etag, answer)) {
+          own.failures++;
+          break;
+        }
+        own.latencies.push_back(std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - start).count());
+        own.requests++;
+        own.bytes += answer.bytes;
+        own.statuses[answer.status]++;
+        own.last = answer;
+      }
+      if (client < 0) own.failures++;
+      else close(client);
+    }));
+  }
+  for (std::thread &thread : threads) thread.join();
+
+  for (const LoadResult &own : results) {
+    result.requests += own.requests;
+    result.failures += own.failures;
+    result.bytes += own.bytes;
+    result.latencies.insert(result.latencies.end(), own.latencies.begin(), own.latencies.end());
+    for (const auto &status : own.statuses) result.statuses[status.first] += status.second;
+    if (own.requests > 0) result.last = own.last;
+  }
+  return result;
+}
+
+static double percentile(std::vector<double> values, double fraction) {
+  if (values.empty()) return 0;
+  std::sort(values.begin(), values.end());
+  return values[std::min(values.size() - 1, (size_t)(fraction * values.size()))];
+}
+
+static void print(const char *name, const LoadResult &result, double seconds) {
+  printf("%-30s %7.0f requests/s %8.0f bytes/request   p50 %6.0f us   p99 %6.0f us   ", name,
+         result.requests / seconds, result.requests > 0 ? (double)result.bytes / result.requests : 0,
+         percentile(result.latencies, 0.5), percentile(result.latencies, 0.99));
+  for (const auto &status : result.statuses) printf(" %d x%u", status.first, status.second);
+  printf("\n");
+}
+
+// Every answer of the load has the status, and there were some
+static bool allAnswered(const LoadResult &result, int status) {
+  return result.failures == 0 && result.requests > 0 && result.statuses.size() == 1 &&
+         result.statuses.begin()->first == status;
+}
+
+int main(int argc, char *argv[]) {
+  double seconds = argc > 1 ? atof(argv[1]) : 3;
+
+  mongoose_init();
+  mg_log_set(MG_LL_ERROR);
+  std::atomic<bool> running(true);
+  std::thread server([&]() {
+    while (running) mongoose_poll();
+  });
+  usleep(100000);
+
+  // Page
+  LoadResult pageCold = load("/", false, seconds);
+  print("GET /", pageCold, seconds);
+  const Answer &page = pageCold.first;
+  check(page.status == 200, "Page is answered with 200");
+  check(header(page, "Content-Encoding") == "gzip", "Page is sent gzipped");
+  check(!header(page, "Etag").empty(), "Page has an ETag");
+  check(header(page, "Cache-Control") == "no-cache", "Page is revalidated on every load");
+  check(page.bodyLength > 1000, "Page has a body");
+  check(allAnswered(pageCold, 200), "Every cold page request is answered with 200");
+
+  LoadResult pageRevalidate = load("/", true, seconds);
+  print("GET / If-None-Match", pageRevalidate, seconds);
+  check(allAnswered(pageRevalidate, 304), "Every page revalidation is answered with 304");
+  const Answer &notModified = pageRevalidate.last;
+  check(header(notModified, "Etag") == header(page, "Etag"), "304 for the page has its ETag");
+  check(header(notModified, "Cache-Control") == "no-cache", "304 for the page has its Cache-Control");
+  check(header(notModified, "Content-Encoding").empty(), "304 for the page has no body encoding");
+  check(notModified.bytes < 300, "304 for the page has no body");
+
+  // State
+  LoadResult stateCold = load("/api/state", false, seconds);
+  print("GET /api/state", stateCold, seconds);
+  check(allAnswered(stateCold, 200), "Every cold state request is answered with 200");
+  check(!header(stateCold.first, "Etag").empty(), "State has an ETag");
+  check(stateCold.first.bodyLength > 2, "State has a body");
+
+  LoadResult stateRevalidate = load("/api/state", true, seconds);
+  print("GET /api/state If-None-Match", stateRevalidate, seconds);
+  check(allAnswered(stateRevalidate, 304), "Every unchanged state revalidation is answered with 304");
+
+  running = false;
+  server.join();
+  return hostCheckResult();
+}
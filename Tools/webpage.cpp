@@ -0,0 +1,249 @@
+// ####################################################################################################################
+//
+// Code part of CarCluster project by Andrej Rolih. See .ino file more details
+//
+// Regenerates the web dashboard from the Mongoose Wizard project ("Mongoose Wizard output/wizard.json") and the page
+// the wizard generated (wizard/src/mongoose_fs.c in wizard.zip). The wizard puts the project into its page as it is
+// and its mongoose_wizard.json is the project with the value of every attribute collected in "value", so both are
+// rebuilt from the project here:
+//
+// - <wizard src>/mongoose_wizard.json and mongoose_fs.c: what the wizard generates for the project (for wizard.zip)
+// - <sketch mongoose>/mongoose_wizard.json and mongoose_fs.c: the same page with the CarCluster changes below
+//
+// CarCluster changes to the page: the wizard's websocket client connects to api/stream instead of websocket, stream
+// frames ({"type":"full"|"delta","state":{...}}) are merged into the state value (every other value is replaced like
+// the wizard does) and the heartbeat refresh does not fetch api/state while the stream is open. Every change has to
+// match exactly once, so a new wizard version that moves things around stops this program instead of giving a broken
+// page. The pages are packed like the Mongoose pack tool does, with the time they were packed.
+//
+//   g++ -std=c++11 -O2 -o webpage Tools/webpage.cpp -lz
+//   unzip -o "Mongoose Wizard output/wizard.zip" -d /tmp/wizard
+//   ./webpage "Mongoose Wizard output/wizard.json" /tmp/wizard/wizard/src CarCluster/src/Other/mongoose
+//   (cd /tmp/wizard && zip -r wizard.zip wizard) && cp /tmp/wizard/wizard.zip "Mongoose Wizard output/"
+//
+// ####################################################################################################################
+
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+#include <ctype.h>
+#include <zlib.h>
+
+#include <string>
+#include <vector>
+
+#include "../CarCluster/src/Libs/ArduinoJson/ArduinoJson.h"
+
+struct PagePatch {
+  const char *description;
+  const char *from;
+  const char *to;
+};
+
+static const PagePatch patches[] = {
+  { "websocket client connects to api/stream",
+    "\"ws\")+\"//\"+t.host+t.pathname+\"websocket\"",
+    "\"ws\")+\"//\"+t.host+t.pathname+\"api/stream\"" },
+  { "stream open flag is set on open",
+    "t.onopen=function(){I.publish(\"online\")",
+    "t.onopen=function(){window.stateStreamOpen=!0,I.publish(\"online\")" },
+  { "stream open flag is cleared on close",
+    "t.onclose=function(){I.publish(\"offline\")",
+    "t.onclose=function(){window.stateStreamOpen=!1,I.publish(\"offline\")" },
+  { "stream frames are merged into the state value",
+    "if(\"data\"==e.type){for(let e in r)e.startsWith(\"ui_\")&&(o[e]=r[e]);n=!0,e.value=o}",
+    "if(\"data\"==e.type){for(let e in r)e.startsWith(\"ui_\")&&(o[e]=r[e]);n=!0,e.value=\"state\"==t?{...r,...o}:o}" },
+  { "heartbeat refresh skips api/state while the stream is open",
+    "return(\"data\"==l[n].type||\"array\"==l[n].type||\"custom\"==l[n].type)",
+    "return!(window.stateStreamOpen&&\"state\"==n)&&(\"data\"==l[n].type||\"array\"==l[n].type||\"custom\"==l[n].type)" },
+};
+
+static bool readFile(const std::string &path, std::string &contents) {
+  FILE *file = fopen(path.c_str(), "rb");
+  if (file == NULL) return false;
+  char buffer[4096];
+  size_t length;
+  contents.clear();
+  while ((length = fread(buffer, 1, sizeof(buffer), file)) > 0) contents.append(buffer, length);
+  fclose(file);
+  return true;
+}
+
+static bool writeFile(const std::string &path, const std::string &contents) {
+  FILE *file = fopen(path.c_str(), "wb");
+  if (file == NULL) return false;
+  bool written = fwrite(contents.data(), 1, contents.size(), file) == contents.size();
+  return fclose(file) == 0 && written;
+}
+
+// The byte array of a packed file (v1[] in mongoose_fs.c), without the 0 the pack tool adds at the end
+static bool unpackArray(const std::string &source, std::string &data) {
+  size_t start = source.find("v1[] = {");
+  size_t end = source.find("\n};", start);
+  if (start == std::string::npos || end == std::string::npos) return false;
+
+  data.clear();
+  bool comment = false;
+  int value = -1;
+  for (size_t i = source.find('{', start) + 1; i < end; i++) {
+    char c = source[i];
+    if (comment) {
+      if (c == '\n') comment = false;
+    } else if (c == '/' && source[i + 1] == '/') {
+      comment = true;
+    } else if (isdigit((unsigned char)c)) {
+      value = (value < 0 ? 0 : value * 10) + (c - '0');
+    } else if (c == ',') {
+      if (value < 0 || value > 255) return false;
+      data.push_back((char)value);
+      value = -1;
+    }
+  }
+  return value == 0;
+}
+
+// Same output as the Mongoose pack tool: 12 bytes per line with their printable characters in a comment
+static std::string packArray(const std::string &data, const char *name, unsigned long modified) {
+  std::string out = "#include \"mongoose.h\"\n\nstatic const unsigned char v1[] = {\n";
+  char ascii[13] = "";
+  size_t used = 0;
+  char number[8];
+  for (unsigned char c : data) {
+    if (used == sizeof(ascii) - 1) {
+      out += std::string(" // ") + ascii + "\n";
+      used = 0;
+    }
+    ascii[used++] = (isprint(c) && c != '\\') ? (char)c : '.';
+    ascii[used] = '\0';
+    snprintf(number, sizeof(number), " %3d,", c);
+    out += number;
+  }
+  out += std::string(" 0 // ") + ascii + "\n};\n\n";
+
+  char entry[128];
+  snprintf(entry, sizeof(entry), "  {\"%s\", v1, sizeof(v1) - 1, %lu},\n", name, modified);
+  out += "const struct mg_mem_file mg_packed_files[] = {\n";
+  out += entry;
+  out += "  {NULL, NULL, 0, 0}\n};\n\n";
+  return out;
+}
+
+static bool gunzip(const std::string &in, std::string &out) {
+  z_stream stream = {};
+  if (inflateInit2(&stream, 15 + 16) != Z_OK) return false;
+  stream.next_in = (Bytef *)in.data();
+  stream.avail_in = in.size();
+  char buffer[16384];
+  int result;
+  out.clear();
+  do {
+    stream.next_out = (Bytef *)buffer;
+    stream.avail_out = sizeof(buffer);
+    result = inflate(&stream, Z_NO_FLUSH);
+    if (result != Z_OK && result != Z_STREAM_END) break;
+    out.append(buffer, sizeof(buffer) - stream.avail_out);
+  } while (result != Z_STREAM_END);
+  inflateEnd(&stream);
+  return result == Z_STREAM_END;
+}
+
+// gzip -9 without a name and time, like the page in the wizard output
+static std::string gzip(const std::string &in) {
+  z_stream stream = {};
+  deflateInit2(&stream, 9, Z_DEFLATED, 15 + 16, 9, Z_DEFAULT_STRATEGY);
+  std::string out(deflateBound(&stream, in.size()), '\0');
+  stream.next_in = (Bytef *)in.data();
+  stream.avail_in = in.size();
+  stream.next_out = (Bytef *)&out[0];
+  stream.avail_out = out.size();
+  deflate(&stream, Z_FINISH);
+  out.resize(stream.total_out);
+  deflateEnd(&stream);
+  return out;
+}
+
+// End of the JSON object that starts at start (strings can have braces)
+static size_t objectEnd(const std::string &text, size_t start) {
+  int depth = 0;
+  bool string = false;
+  for (size_t i = start; i < text.size(); i++) {
+    char c = text[i];
+    if (string) {
+      if (c == '\\') i++;
+      else if (c == '"') string = false;
+    } else if (c == '"') {
+      string = true;
+    } else if (c == '{') {
+      depth++;
+    } else if (c == '}' && --depth == 0) {
+      return i + 1;
+    }
+  }
+  return std::string::npos;
+}
+
+static bool replaceOnce(std::string &text, const std::string &from, const std::string &to) {
+  size_t position = text.find(from);
+  if (position == std::string::npos || text.find(from, position + 1) != std::string::npos) return false;
+  text.replace(position, from.size(), to);
+  return true;
+}
+
+int main(int argc, char *argv[]) {
+  if (argc != 4) {
+    printf("Usage: %s <wizard project json> <wizard src directory> <sketch mongoose directory>\n", argv[0]);
+    return 2;
+  }
+  std::string wizardDirectory = argv[2], sketchDirectory = argv[3];
+
+  // mongoose_wizard.json is the project with a value object next to every attributes object
+  std::string projectText;
+  JsonDocument project;
+  if (!readFile(argv[1], projectText) ||
+      deserializeJson(project, projectText, DeserializationOption::NestingLimit(64)) != DeserializationError::Ok) {
+    printf("Can not read the project %s\n", argv[1]);
+    return 1;
+  }
+  for (JsonPair api : project["api"].as<JsonObject>()) {
+    JsonObject attributes = api.value()["attributes"];
+    if (attributes.isNull()) continue;
+    JsonObject value = api.value()["value"].to<JsonObject>();
+    for (JsonPair attribute : attributes) value[attribute.key()] = attribute.value()["value"];
+  }
+  std::string wizardJson;
+  serializeJson(project, wizardJson);
+
+  // The page the wizard generated, with its project replaced by this one
+  std::string packed, gzipped, page;
+  if (!readFile(wizardDirectory + "/mongoose_fs.c", packed) || !unpackArray(packed, gzipped) || !gunzip(gzipped, page)) {
+    printf("Can not unpack the page in %s/mongoose_fs.c\n", wizardDirectory.c_str());
+    return 1;
+  }
+  size_t start = page.find("{\"version\":\"");
+  size_t end = start == std::string::npos ? start : objectEnd(page, start);
+  if (end == std::string::npos || page.find("{\"version\":\"", start + 1) != std::string::npos) {
+    printf("Can not find the project in the page\n");
+    return 1;
+  }
+  page.replace(start, end - start, wizardJson);
+
+  std::string sketchPage = page;
+  for (const PagePatch &patch : patches) {
+    if (!replaceOnce(sketchPage, patch.from, patch.to)) {
+      printf("Page change does not match exactly once: %s\n", patch.description);
+      return 1;
+    }
+  }
+
+  unsigned long modified = (unsigned long)time(NULL);
+  if (!writeFile(wizardDirectory + "/mongoose_wizard.json", wizardJson) ||
+      !writeFile(wizardDirectory + "/mongoose_fs.c", packArray(gzip(page), "/web_root/index.html.gz", modified)) ||
+      !writeFile(sketchDirectory + "/mongoose_wizard.json", wizardJson) ||
+      !writeFile(sketchDirectory + "/mongoose_fs.c", packArray(gzip(sketchPage), "/web_root/index.html.gz", modified))) {
+    printf("Can not write the output\n");
+    return 1;
+  }
+
+  printf("Page: %zu bytes, %zu for the sketch, packed at %lu\n", page.size(), sketchPage.size(), modified);
+  return 0;
+}